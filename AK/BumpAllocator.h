@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/Atomic.h>
+#include <AK/Forward.h>
 #include <AK/StdLibExtras.h>
 #include <AK/Types.h>
 #include <AK/kmalloc.h>
@@ -16,7 +17,18 @@ namespace AK {
 
 template<bool use_mmap = false, size_t chunk_size = use_mmap ? 4 * MiB : 4 * KiB>
 class BumpAllocator {
+protected:
+    constexpr static FlatPtr chunk_magic = explode_byte(0xdf);
+    struct ChunkHeader {
+        FlatPtr magic;
+        FlatPtr next_chunk;
+    };
+
 public:
+    // Safe lower bound for the largest single allocation a chunk can hold;
+    // the actual chunk may be slightly larger (kmalloc_good_size rounding).
+    static constexpr size_t maximum_single_allocation_size = chunk_size - sizeof(ChunkHeader) - 1;
+
     BumpAllocator()
     {
         if constexpr (use_mmap)
@@ -138,11 +150,6 @@ protected:
         return true;
     }
 
-    constexpr static FlatPtr chunk_magic = explode_byte(0xdf);
-    struct ChunkHeader {
-        FlatPtr magic;
-        FlatPtr next_chunk;
-    };
     FlatPtr m_head_chunk { 0 };
     FlatPtr m_current_chunk { 0 };
     size_t m_byte_offset_into_current_chunk { 0 };
@@ -195,9 +202,46 @@ public:
 template<bool use_mmap, size_t size>
 inline Atomic<FlatPtr> BumpAllocator<use_mmap, size>::s_unused_allocation_cache { 0 };
 
+// Bucket allocator for HashTable/HashMap that draws the bucket arrays from a
+// BumpAllocator arena. Individual frees are no-ops; everything is reclaimed
+// at once when the arena is destroyed, which is what short-lived tables in
+// parsers want. The arena must outlive every table using it.
+template<bool use_mmap = false, size_t chunk_size = use_mmap ? 4 * MiB : 4 * KiB>
+class BumpHashTableAllocator {
+public:
+    explicit BumpHashTableAllocator(BumpAllocator<use_mmap, chunk_size>& arena)
+        : m_arena(&arena)
+    {
+    }
+
+    void* allocate_zeroed_buckets(size_t size, size_t alignment)
+    {
+        if (size + alignment > BumpAllocator<use_mmap, chunk_size>::maximum_single_allocation_size)
+            return nullptr;
+        auto* buckets = m_arena->allocate(size, alignment);
+        if (buckets)
+            __builtin_memset(buckets, 0, size);
+        return buckets;
+    }
+
+    static void free_buckets(void*, size_t) { }
+
+private:
+    BumpAllocator<use_mmap, chunk_size>* m_arena;
+};
+
+template<typename T, typename TraitsForT = Traits<T>, bool IsOrdered = false>
+using BumpAllocatedHashTable = HashTable<T, TraitsForT, IsOrdered, BumpHashTableAllocator<>>;
+
+template<typename K, typename V, typename KeyTraits = Traits<K>, typename ValueTraits = Traits<V>, bool IsOrdered = false>
+using BumpAllocatedHashMap = HashMap<K, V, KeyTraits, ValueTraits, IsOrdered, BumpHashTableAllocator<>>;
+
 }
 
 #if USING_AK_GLOBALLY
+using AK::BumpAllocatedHashMap;
+using AK::BumpAllocatedHashTable;
 using AK::BumpAllocator;
+using AK::BumpHashTableAllocator;
 using AK::UniformBumpAllocator;
 #endif
@@ -290,16 +290,23 @@ private:
     NEVER_INLINE ErrorOr<void> try_ensure_capacity_slowpath(size_t new_capacity)
     {
         new_capacity = kmalloc_good_size(new_capacity);
+
+        if (!m_inline) {
+            // Growing an outline buffer goes through realloc(), which can
+            // extend the allocation in place instead of copying the contents.
+            auto* new_buffer = (u8*)krealloc_sized(m_outline_buffer, m_outline_capacity, new_capacity);
+            if (!new_buffer)
+                return Error::from_errno(ENOMEM);
+            m_outline_buffer = new_buffer;
+            m_outline_capacity = new_capacity;
+            return {};
+        }
+
         auto* new_buffer = (u8*)kmalloc(new_capacity);
         if (!new_buffer)
             return Error::from_errno(ENOMEM);
 
-        if (m_inline) {
-            __builtin_memcpy(new_buffer, data(), m_size);
-        } else if (m_outline_buffer) {
-            __builtin_memcpy(new_buffer, m_outline_buffer, min(new_capacity, m_outline_capacity));
-            kfree_sized(m_outline_buffer, m_outline_capacity);
-        }
+        __builtin_memcpy(new_buffer, data(), m_size);
 
         m_outline_buffer = new_buffer;
         m_outline_capacity = new_capacity;
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Assertions.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/StdLibExtras.h>
+#include <coroutine>
+
+namespace AK {
+
+template<typename T>
+class Coroutine;
+
+namespace Detail {
+
+// Provides exactly one of return_value()/return_void(), as the promise
+// concept requires; the non-void flavor also carries the result storage.
+template<typename T, typename Promise>
+struct CoroutinePromiseValue {
+    void return_value(T value) { m_result = move(value); }
+    Optional<T> m_result;
+};
+
+template<typename Promise>
+struct CoroutinePromiseValue<void, Promise> {
+    void return_void() { }
+};
+
+}
+
+// A lazily started coroutine task. The coroutine body does not run until the
+// task is co_await'ed; when the body finishes, control returns to the awaiter
+// by symmetric transfer. A chain of nested awaits therefore compiles down to
+// one state machine per coroutine frame, with no allocation or scheduler
+// round-trip per step.
+//
+// Tasks are single-consumer: exactly one coroutine may await a given task,
+// and the result is moved out when it resumes. A task that is destroyed
+// without ever being awaited simply never runs.
+template<typename T = void>
+class [[nodiscard]] Coroutine {
+    AK_MAKE_NONCOPYABLE(Coroutine);
+
+public:
+    struct PromiseType;
+    using promise_type = PromiseType;
+
+    struct FinalAwaiter {
+        bool await_ready() const noexcept { return false; }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseType> handle) noexcept
+        {
+            // Hand control straight back to whoever was awaiting us.
+            if (auto awaiter = handle.promise().m_awaiter)
+                return awaiter;
+            return std::noop_coroutine();
+        }
+        void await_resume() const noexcept { }
+    };
+
+    struct PromiseType : public Detail::CoroutinePromiseValue<T, PromiseType> {
+        Coroutine get_return_object() { return Coroutine { std::coroutine_handle<PromiseType>::from_promise(*this) }; }
+        std::suspend_always initial_suspend() { return {}; }
+        FinalAwaiter final_suspend() noexcept { return {}; }
+        void unhandled_exception() { VERIFY_NOT_REACHED(); }
+
+        std::coroutine_handle<> m_awaiter;
+    };
+
+    Coroutine(Coroutine&& other)
+        : m_handle(exchange(other.m_handle, {}))
+    {
+    }
+
+    Coroutine& operator=(Coroutine&& other)
+    {
+        if (this != &other) {
+            if (m_handle)
+                m_handle.destroy();
+            m_handle = exchange(other.m_handle, {});
+        }
+        return *this;
+    }
+
+    ~Coroutine()
+    {
+        if (m_handle)
+            m_handle.destroy();
+    }
+
+    bool await_ready() const { return false; }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter)
+    {
+        m_handle.promise().m_awaiter = awaiter;
+        return m_handle;
+    }
+
+    T await_resume()
+    {
+        if constexpr (!IsVoid<T>)
+            return m_handle.promise().m_result.release_value();
+    }
+
+    [[nodiscard]] bool is_done() const { return m_handle.done(); }
+
+private:
+    explicit Coroutine(std::coroutine_handle<PromiseType> handle)
+        : m_handle(handle)
+    {
+    }
+
+    std::coroutine_handle<PromiseType> m_handle;
+};
+
+}
+
+#if USING_AK_GLOBALLY
+using AK::Coroutine;
+#endif
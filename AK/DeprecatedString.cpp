@@ -5,6 +5,7 @@
  */
 
 #include <AK/ByteBuffer.h>
+#include <AK/CharacterTypes.h>
 #include <AK/DeprecatedString.h>
 #include <AK/FlyString.h>
 #include <AK/Format.h>
@@ -16,14 +17,29 @@
 
 namespace AK {
 
+void DeprecatedString::materialize_impl()
+{
+    VERIFY(is_short_string());
+    auto length = m_short_string.byte_count();
+    if (!length) {
+        m_impl = &StringImpl::the_empty_stringimpl();
+        m_impl->ref();
+        return;
+    }
+    char* buffer;
+    auto impl = StringImpl::create_uninitialized(length, buffer);
+    memcpy(buffer, m_short_string.storage, length);
+    m_impl = &impl.leak_ref();
+}
+
 bool DeprecatedString::operator==(FlyString const& fly_string) const
 {
-    return m_impl == fly_string.impl() || view() == fly_string.view();
+    return view() == fly_string.view();
 }
 
 bool DeprecatedString::operator==(DeprecatedString const& other) const
 {
-    return m_impl == other.impl() || view() == other.view();
+    return view() == other.view();
 }
 
 bool DeprecatedString::operator==(StringView other) const
@@ -55,13 +71,16 @@ bool DeprecatedString::copy_characters_to_buffer(char* buffer, size_t buffer_siz
 
 DeprecatedString DeprecatedString::isolated_copy() const
 {
-    if (!m_impl)
+    if (is_null())
         return {};
-    if (!m_impl->length())
+    // A short string is already isolated; copying it copies the bytes.
+    if (is_short_string())
+        return *this;
+    if (!length())
         return empty();
     char* buffer;
     auto impl = StringImpl::create_uninitialized(length(), buffer);
-    memcpy(buffer, m_impl->characters(), m_impl->length());
+    memcpy(buffer, characters(), length());
     return DeprecatedString(move(*impl));
 }
 
@@ -69,30 +88,30 @@ DeprecatedString DeprecatedString::substring(size_t start, size_t length) const
 {
     if (!length)
         return DeprecatedString::empty();
-    VERIFY(m_impl);
+    VERIFY(!is_null());
     VERIFY(!Checked<size_t>::addition_would_overflow(start, length));
-    VERIFY(start + length <= m_impl->length());
+    VERIFY(start + length <= this->length());
     return { characters() + start, length };
 }
 
 DeprecatedString DeprecatedString::substring(size_t start) const
 {
-    VERIFY(m_impl);
+    VERIFY(!is_null());
     VERIFY(start <= length());
     return { characters() + start, length() - start };
 }
 
 StringView DeprecatedString::substring_view(size_t start, size_t length) const
 {
-    VERIFY(m_impl);
+    VERIFY(!is_null());
     VERIFY(!Checked<size_t>::addition_would_overflow(start, length));
-    VERIFY(start + length <= m_impl->length());
+    VERIFY(start + length <= this->length());
     return { characters() + start, length };
 }
 
 StringView DeprecatedString::substring_view(size_t start) const
 {
-    VERIFY(m_impl);
+    VERIFY(!is_null());
     VERIFY(start <= length());
     return { characters() + start, length() - start };
 }
@@ -157,7 +176,7 @@ Vector<StringView> DeprecatedString::split_view(char const separator, SplitBehav
 
 ByteBuffer DeprecatedString::to_byte_buffer() const
 {
-    if (!m_impl)
+    if (is_null())
         return {};
     // FIXME: Handle OOM failure.
     return ByteBuffer::copy(bytes()).release_value_but_fixme_should_propagate_errors();
@@ -226,6 +245,11 @@ DeprecatedString DeprecatedString::repeated(char ch, size_t count)
 {
     if (!count)
         return empty();
+    if (count <= MAX_SHORT_STRING_BYTE_COUNT) {
+        char buffer[MAX_SHORT_STRING_BYTE_COUNT];
+        memset(buffer, ch, count);
+        return DeprecatedString { StringView { buffer, count } };
+    }
     char* buffer;
     auto impl = StringImpl::create_uninitialized(count, buffer);
     memset(buffer, ch, count);
@@ -376,21 +400,35 @@ DeprecatedString escape_html_entities(StringView html)
 }
 
 DeprecatedString::DeprecatedString(FlyString const& string)
-    : m_impl(string.impl())
+    : m_impl(const_cast<StringImpl*>(string.impl()))
 {
+    if (m_impl)
+        m_impl->ref();
 }
 
 DeprecatedString DeprecatedString::to_lowercase() const
 {
-    if (!m_impl)
+    if (is_null())
         return {};
+    if (is_short_string()) {
+        ShortString result = m_short_string;
+        for (size_t i = 0; i < result.byte_count(); ++i)
+            result.storage[i] = to_ascii_lowercase(result.storage[i]);
+        return DeprecatedString { StringView { result.storage, result.byte_count() } };
+    }
     return m_impl->to_lowercase();
 }
 
 DeprecatedString DeprecatedString::to_uppercase() const
 {
-    if (!m_impl)
+    if (is_null())
         return {};
+    if (is_short_string()) {
+        ShortString result = m_short_string;
+        for (size_t i = 0; i < result.byte_count(); ++i)
+            result.storage[i] = to_ascii_uppercase(result.storage[i]);
+        return DeprecatedString { StringView { result.storage, result.byte_count() } };
+    }
     return m_impl->to_uppercase();
 }
 
@@ -11,6 +11,7 @@
 #include <AK/RefPtr.h>
 #include <AK/Stream.h>
 #include <AK/StringBuilder.h>
+#include <AK/StringHash.h>
 #include <AK/StringImpl.h>
 #include <AK/StringUtils.h>
 #include <AK/Traits.h>
@@ -18,13 +19,14 @@
 namespace AK {
 
 // DeprecatedString is a convenience wrapper around StringImpl, suitable for passing
-// around as a value type. It's basically the same as passing around a
-// RefPtr<StringImpl>, with a bit of syntactic sugar.
+// around as a value type.
 //
-// Note that StringImpl is an immutable object that cannot shrink or grow.
-// Its allocation size is snugly tailored to the specific string it contains.
-// Copying a DeprecatedString is very efficient, since the internal StringImpl is
-// retainable and so copying only requires modifying the ref count.
+// Short strings are stored inline, without any heap allocation, much like
+// AK::String. Longer strings are backed by a StringImpl. A StringImpl is an
+// immutable object that cannot shrink or grow; its allocation size is snugly
+// tailored to the specific string it contains. Copying a DeprecatedString is
+// very efficient: either a small memcpy() for a short string, or a ref-count
+// bump on the shared StringImpl.
 //
 // There are three main ways to construct a new DeprecatedString:
 //
@@ -39,57 +41,80 @@ namespace AK {
 
 class DeprecatedString {
 public:
-    ~DeprecatedString() = default;
+    // NOTE: A short string must leave room for its NUL-terminator, so that
+    //       characters() keeps working without a heap allocation.
+    static constexpr size_t MAX_SHORT_STRING_BYTE_COUNT = 3 * sizeof(StringImpl*) - 2;
 
-    DeprecatedString() = default;
+    ~DeprecatedString()
+    {
+        destroy_string();
+    }
+
+    DeprecatedString()
+        : m_impl(nullptr)
+    {
+    }
 
     DeprecatedString(StringView view)
-        : m_impl(StringImpl::create(view.characters_without_null_termination(), view.length()))
     {
+        construct_from(view.characters_without_null_termination(), view.length(), NoChomp);
     }
 
     DeprecatedString(DeprecatedString const& other)
-        : m_impl(const_cast<DeprecatedString&>(other).m_impl)
     {
+        if (other.is_short_string()) {
+            m_short_string = other.m_short_string;
+        } else {
+            m_impl = other.m_impl;
+            if (m_impl)
+                m_impl->ref();
+        }
     }
 
     DeprecatedString(DeprecatedString&& other)
-        : m_impl(move(other.m_impl))
     {
+        if (other.is_short_string())
+            m_short_string = other.m_short_string;
+        else
+            m_impl = other.m_impl;
+        other.m_impl = nullptr;
     }
 
     DeprecatedString(char const* cstring, ShouldChomp shouldChomp = NoChomp)
-        : m_impl(StringImpl::create(cstring, shouldChomp))
     {
+        construct_from(cstring, cstring ? __builtin_strlen(cstring) : 0, shouldChomp);
     }
 
     DeprecatedString(char const* cstring, size_t length, ShouldChomp shouldChomp = NoChomp)
-        : m_impl(StringImpl::create(cstring, length, shouldChomp))
     {
+        construct_from(cstring, length, shouldChomp);
     }
 
     explicit DeprecatedString(ReadonlyBytes bytes, ShouldChomp shouldChomp = NoChomp)
-        : m_impl(StringImpl::create(bytes, shouldChomp))
     {
+        construct_from(reinterpret_cast<char const*>(bytes.data()), bytes.size(), shouldChomp);
     }
 
     DeprecatedString(StringImpl const& impl)
-        : m_impl(const_cast<StringImpl&>(impl))
+        : m_impl(const_cast<StringImpl*>(&impl))
     {
+        m_impl->ref();
     }
 
     DeprecatedString(StringImpl const* impl)
         : m_impl(const_cast<StringImpl*>(impl))
     {
+        if (m_impl)
+            m_impl->ref();
     }
 
     DeprecatedString(RefPtr<StringImpl>&& impl)
-        : m_impl(move(impl))
+        : m_impl(impl.leak_ref())
     {
     }
 
     DeprecatedString(NonnullRefPtr<StringImpl>&& impl)
-        : m_impl(move(impl))
+        : m_impl(&impl.leak_ref())
     {
     }
 
@@ -170,32 +195,41 @@ public:
     [[nodiscard]] StringView substring_view(size_t start, size_t length) const;
     [[nodiscard]] StringView substring_view(size_t start) const;
 
-    [[nodiscard]] bool is_null() const { return !m_impl; }
+    [[nodiscard]] bool is_null() const { return !is_short_string() && !m_impl; }
     [[nodiscard]] ALWAYS_INLINE bool is_empty() const { return length() == 0; }
-    [[nodiscard]] ALWAYS_INLINE size_t length() const { return m_impl ? m_impl->length() : 0; }
+
+    [[nodiscard]] ALWAYS_INLINE size_t length() const
+    {
+        if (is_short_string())
+            return m_short_string.byte_count();
+        return m_impl ? m_impl->length() : 0;
+    }
+
     // Includes NUL-terminator, if non-nullptr.
-    [[nodiscard]] ALWAYS_INLINE char const* characters() const { return m_impl ? m_impl->characters() : nullptr; }
+    [[nodiscard]] ALWAYS_INLINE char const* characters() const
+    {
+        if (is_short_string())
+            return m_short_string.storage;
+        return m_impl ? m_impl->characters() : nullptr;
+    }
 
     [[nodiscard]] bool copy_characters_to_buffer(char* buffer, size_t buffer_size) const;
 
     [[nodiscard]] ALWAYS_INLINE ReadonlyBytes bytes() const
     {
-        if (m_impl) {
-            return m_impl->bytes();
-        }
-        return {};
+        return { reinterpret_cast<u8 const*>(characters()), length() };
     }
 
     [[nodiscard]] ALWAYS_INLINE char const& operator[](size_t i) const
     {
-        VERIFY(!is_null());
-        return (*m_impl)[i];
+        VERIFY(i < length());
+        return characters()[i];
     }
 
     [[nodiscard]] ALWAYS_INLINE u8 byte_at(size_t i) const
     {
-        VERIFY(!is_null());
-        return bit_cast<u8>((*m_impl)[i]);
+        VERIFY(i < length());
+        return bit_cast<u8>(characters()[i]);
     }
 
     using ConstIterator = SimpleIterator<const DeprecatedString, char const>;
@@ -233,40 +267,72 @@ public:
         return StringImpl::the_empty_stringimpl();
     }
 
-    [[nodiscard]] StringImpl* impl() { return m_impl.ptr(); }
-    [[nodiscard]] StringImpl const* impl() const { return m_impl.ptr(); }
+    // NOTE: This is primarily interesting to unit tests.
+    [[nodiscard]] bool is_short_string() const
+    {
+        return (m_short_string.byte_count_and_short_string_flag & SHORT_STRING_FLAG) != 0;
+    }
+
+    // NOTE: For a short string, this materializes (and caches) a StringImpl,
+    //       which also invalidates any pointer previously returned by characters().
+    [[nodiscard]] StringImpl* impl()
+    {
+        if (is_short_string())
+            materialize_impl();
+        return m_impl;
+    }
+    [[nodiscard]] StringImpl const* impl() const
+    {
+        return const_cast<DeprecatedString*>(this)->impl();
+    }
 
     DeprecatedString& operator=(DeprecatedString&& other)
     {
-        if (this != &other)
-            m_impl = move(other.m_impl);
+        if (this != &other) {
+            destroy_string();
+            if (other.is_short_string())
+                m_short_string = other.m_short_string;
+            else
+                m_impl = other.m_impl;
+            other.m_impl = nullptr;
+        }
         return *this;
     }
 
     DeprecatedString& operator=(DeprecatedString const& other)
     {
-        if (this != &other)
-            m_impl = const_cast<DeprecatedString&>(other).m_impl;
+        if (this != &other) {
+            destroy_string();
+            if (other.is_short_string()) {
+                m_short_string = other.m_short_string;
+            } else {
+                m_impl = other.m_impl;
+                if (m_impl)
+                    m_impl->ref();
+            }
+        }
         return *this;
     }
 
     DeprecatedString& operator=(nullptr_t)
     {
+        destroy_string();
         m_impl = nullptr;
         return *this;
     }
 
     DeprecatedString& operator=(ReadonlyBytes bytes)
     {
-        m_impl = StringImpl::create(bytes);
+        destroy_string();
+        construct_from(reinterpret_cast<char const*>(bytes.data()), bytes.size(), NoChomp);
         return *this;
     }
 
     [[nodiscard]] u32 hash() const
     {
-        if (!m_impl)
-            return 0;
-        return m_impl->hash();
+        if (is_short_string())
+            return string_hash(m_short_string.storage, m_short_string.byte_count());
+        return m_impl ? m_impl->hash() : 0;
     }
 
     [[nodiscard]] ByteBuffer to_byte_buffer() const;
@@ -322,16 +388,65 @@ public:
     }
 
 private:
-    RefPtr<StringImpl> m_impl;
+    // NOTE: If the least significant bit of the first byte is set, this is a
+    //       short string. StringImpl pointers come from kmalloc and are at
+    //       least word-aligned, so the flag bit can never be set for them.
+    static constexpr u8 SHORT_STRING_FLAG = 1;
+
+    struct ShortString {
+        [[nodiscard]] size_t byte_count() const { return byte_count_and_short_string_flag >> 1; }
+
+        // NOTE: This is the byte count shifted left 1 step and or'ed with a 1 (the SHORT_STRING_FLAG)
+        u8 byte_count_and_short_string_flag { 0 };
+        char storage[MAX_SHORT_STRING_BYTE_COUNT + 1] = { 0 };
+    };
+
+    ALWAYS_INLINE void construct_from(char const* characters, size_t length, ShouldChomp should_chomp)
+    {
+        if (!characters) {
+            m_impl = nullptr;
+            return;
+        }
+        if (should_chomp == Chomp) {
+            while (length) {
+                char last_ch = characters[length - 1];
+                if (!last_ch || last_ch == '\n' || last_ch == '\r')
+                    --length;
+                else
+                    break;
+            }
+        }
+        if (length <= MAX_SHORT_STRING_BYTE_COUNT) {
+            m_short_string = ShortString {};
+            if (length)
+                __builtin_memcpy(m_short_string.storage, characters, length);
+            m_short_string.byte_count_and_short_string_flag = (length << 1) | SHORT_STRING_FLAG;
+            return;
+        }
+        m_impl = StringImpl::create(characters, length).leak_ref();
+    }
+
+    ALWAYS_INLINE void destroy_string()
+    {
+        if (!is_short_string() && m_impl)
+            m_impl->unref();
+    }
+
+    void materialize_impl();
+
+    union {
+        ShortString m_short_string;
+        StringImpl* m_impl { nullptr };
+    };
 };
 
 template<>
 struct Traits<DeprecatedString> : public GenericTraits<DeprecatedString> {
-    static unsigned hash(DeprecatedString const& s) { return s.impl() ? s.impl()->hash() : 0; }
+    static unsigned hash(DeprecatedString const& s) { return s.hash(); }
 };
 
 struct CaseInsensitiveStringTraits : public Traits<DeprecatedString> {
-    static unsigned hash(DeprecatedString const& s) { return s.impl() ? s.impl()->case_insensitive_hash() : 0; }
+    static unsigned hash(DeprecatedString const& s) { return s.is_null() ? 0 : case_insensitive_string_hash(s.characters(), s.length()); }
     static bool equals(DeprecatedString const& a, DeprecatedString const& b) { return a.equals_ignoring_case(b); }
 };
 
@@ -74,13 +74,15 @@ class CircularQueue;
 template<typename T>
 struct Traits;
 
-template<typename T, typename TraitsForT = Traits<T>, bool IsOrdered = false>
+struct DefaultHashTableAllocator;
+
+template<typename T, typename TraitsForT = Traits<T>, bool IsOrdered = false, typename BucketAllocator = DefaultHashTableAllocator>
 class HashTable;
 
 template<typename T, typename TraitsForT = Traits<T>>
 using OrderedHashTable = HashTable<T, TraitsForT, true>;
 
-template<typename K, typename V, typename KeyTraits = Traits<K>, typename ValueTraits = Traits<V>, bool IsOrdered = false>
+template<typename K, typename V, typename KeyTraits = Traits<K>, typename ValueTraits = Traits<V>, bool IsOrdered = false, typename BucketAllocator = DefaultHashTableAllocator>
 class HashMap;
 
 template<typename K, typename V, typename KeyTraits = Traits<K>, typename ValueTraits = Traits<V>>
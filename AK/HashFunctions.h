@@ -7,15 +7,23 @@
 #pragma once
 
 #include <AK/Types.h>
+#ifndef KERNEL
+#    include <AK/Random.h>
+#endif
+
+// The 32- and 64-bit mixers below are the finalizers of MurmurHash3 (by
+// Austin Appleby, placed in the public domain). Every input bit affects
+// every output bit, which keeps keys that only differ in a few low or high
+// bits -- counters, aligned pointers, tagged values -- from clustering into
+// the same buckets of the hash tables built on top of these.
 
 constexpr unsigned int_hash(u32 key)
 {
-    key += ~(key << 15);
-    key ^= (key >> 10);
-    key += (key << 3);
-    key ^= (key >> 6);
-    key += ~(key << 11);
-    key ^= (key >> 16);
+    key ^= key >> 16;
+    key *= 0x85ebca6b;
+    key ^= key >> 13;
+    key *= 0xc2b2ae35;
+    key ^= key >> 16;
     return key;
 }
 
@@ -33,24 +41,47 @@ constexpr unsigned double_hash(u32 key)
     return key;
 }
 
+constexpr unsigned u64_hash(u64 key)
+{
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return static_cast<unsigned>(key) ^ static_cast<unsigned>(key >> 32);
+}
+
 constexpr unsigned pair_int_hash(u32 key1, u32 key2)
 {
-    return int_hash((int_hash(key1) * 209) ^ (int_hash(key2 * 413)));
+    return u64_hash((static_cast<u64>(key1) << 32) | key2);
 }
 
-constexpr unsigned u64_hash(u64 key)
+// Pointer keys are mixed with a random seed drawn once per process, so that
+// bucket indices cannot be predicted from outside the process (for example
+// by scripts timing LibJS property accesses). The kernel has no entropy
+// source at this layer, so kernel-side pointer hashes stay unseeded; kernel
+// addresses are not attacker-chosen the way userspace object identities
+// can be.
+inline FlatPtr ptr_hash_seed()
 {
-    u32 first = key & 0xFFFFFFFF;
-    u32 last = key >> 32;
-    return pair_int_hash(first, last);
+#ifdef KERNEL
+    return 0;
+#else
+    static FlatPtr const seed = [] {
+        FlatPtr value = 0;
+        AK::fill_with_random(&value, sizeof(value));
+        return value;
+    }();
+    return seed;
+#endif
 }
 
-constexpr unsigned ptr_hash(FlatPtr ptr)
+inline unsigned ptr_hash(FlatPtr ptr)
 {
     if constexpr (sizeof(ptr) == 8)
-        return u64_hash(ptr);
+        return u64_hash(ptr ^ ptr_hash_seed());
     else
-        return int_hash(ptr);
+        return int_hash(ptr ^ ptr_hash_seed());
 }
 
 inline unsigned ptr_hash(void const* ptr)
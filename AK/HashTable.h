@@ -17,6 +17,16 @@
 
 namespace AK {
 
+// The bucket allocator is only responsible for the bucket array itself;
+// element construction and destruction stay with the table. Alternative
+// allocators (e.g. the BumpAllocator-backed one in AK/BumpAllocator.h) let
+// short-lived tables place their buckets in an arena that is reclaimed in
+// O(1) when the arena dies.
+struct DefaultHashTableAllocator {
+    static void* allocate_zeroed_buckets(size_t size, size_t) { return kcalloc(1, size); }
+    static void free_buckets(void* buckets, size_t size) { kfree_sized(buckets, size); }
+};
+
 enum class HashSetResult {
     InsertedNewEntry,
     ReplacedExistingEntry,
@@ -106,7 +116,7 @@ private:
     BucketType* m_bucket { nullptr };
 };
 
-template<typename T, typename TraitsForT, bool IsOrdered>
+template<typename T, typename TraitsForT, bool IsOrdered, typename BucketAllocator>
 class HashTable {
     static constexpr size_t load_factor_in_percent = 60;
 
@@ -143,6 +153,17 @@ public:
     HashTable() = default;
     explicit HashTable(size_t capacity) { rehash(capacity); }
 
+    explicit HashTable(BucketAllocator allocator)
+        : m_allocator(move(allocator))
+    {
+    }
+
+    HashTable(size_t capacity, BucketAllocator allocator)
+        : m_allocator(move(allocator))
+    {
+        rehash(capacity);
+    }
+
     ~HashTable()
     {
         if (!m_buckets)
@@ -153,10 +174,11 @@ public:
                 m_buckets[i].slot()->~T();
         }
 
-        kfree_sized(m_buckets, size_in_bytes(m_capacity));
+        m_allocator.free_buckets(m_buckets, size_in_bytes(m_capacity));
     }
 
     HashTable(HashTable const& other)
+        : m_allocator(other.m_allocator)
     {
         rehash(other.capacity());
         for (auto& it : other)
@@ -176,6 +198,7 @@ public:
         , m_size(other.m_size)
         , m_capacity(other.m_capacity)
         , m_deleted_count(other.m_deleted_count)
+        , m_allocator(move(other.m_allocator))
     {
         other.m_size = 0;
         other.m_capacity = 0;
@@ -198,6 +221,7 @@ public:
         swap(a.m_size, b.m_size);
         swap(a.m_capacity, b.m_capacity);
         swap(a.m_deleted_count, b.m_deleted_count);
+        swap(a.m_allocator, b.m_allocator);
 
         if constexpr (IsOrdered)
             swap(a.m_collection_data, b.m_collection_data);
@@ -287,7 +311,7 @@ public:
 
     void clear()
     {
-        *this = HashTable();
+        *this = HashTable(m_allocator);
     }
     void clear_with_capacity()
     {
@@ -483,7 +507,7 @@ private:
         auto old_capacity = m_capacity;
         Iterator old_iter = begin();
 
-        auto* new_buckets = kcalloc(1, size_in_bytes(new_capacity));
+        auto* new_buckets = m_allocator.allocate_zeroed_buckets(size_in_bytes(new_capacity), alignof(BucketType));
         if (!new_buckets)
             return Error::from_errno(ENOMEM);
 
@@ -505,7 +529,7 @@ private:
             it->~T();
         }
 
-        kfree_sized(old_buckets, size_in_bytes(old_capacity));
+        m_allocator.free_buckets(old_buckets, size_in_bytes(old_capacity));
         return {};
     }
     void rehash(size_t new_capacity)
@@ -721,6 +745,7 @@ private:
     size_t m_size { 0 };
     size_t m_capacity { 0 };
     size_t m_deleted_count { 0 };
+    [[no_unique_address]] BucketAllocator m_allocator;
 };
 }
 
@@ -22,6 +22,22 @@ ErrorOr<DeprecatedString> JsonParser::consume_and_unescape_string()
 {
     if (!consume_specific('"'))
         return Error::from_string_literal("JsonParser: Expected '\"'");
+
+    // Fast path: most strings have no escapes, so we can copy the input range
+    // into the result directly instead of going through a StringBuilder.
+    for (size_t peek_index = m_index; peek_index < m_input.length(); ++peek_index) {
+        char ch = m_input[peek_index];
+        if (ch == '\\')
+            break;
+        if (ch == '"') {
+            auto contents = m_input.substring_view(m_index, peek_index - m_index);
+            m_index = peek_index + 1;
+            return contents.to_deprecated_string();
+        }
+        if (is_ascii_c0_control(ch))
+            return Error::from_string_literal("JsonParser: Error while parsing string");
+    }
+
     StringBuilder final_sb;
 
     for (;;) {
@@ -38,9 +54,9 @@ ErrorOr<DeprecatedString> JsonParser::consume_and_unescape_string()
             ++peek_index;
         }
 
-        while (peek_index != m_index) {
-            final_sb.append(m_input[m_index]);
-            m_index++;
+        if (peek_index != m_index) {
+            final_sb.append(m_input.substring_view(m_index, peek_index - m_index));
+            m_index = peek_index;
         }
 
         if (m_index == m_input.length())
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Atomic.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/StdLibExtras.h>
+#include <AK/Types.h>
+#include <AK/kmalloc.h>
+
+namespace AK {
+
+// A bounded, lock-free multi-producer/multi-consumer queue, based on the
+// bounded MPMC queue design by Dmitry Vyukov. Each slot carries a sequence
+// number that tells producers and consumers whose turn it is, so neither
+// side ever takes a lock; a full or empty queue is reported immediately
+// instead of blocking.
+template<typename T, size_t Capacity = 1024>
+class MPMCQueue {
+    AK_MAKE_NONCOPYABLE(MPMCQueue);
+    AK_MAKE_NONMOVABLE(MPMCQueue);
+
+    static_assert(is_power_of_two(Capacity), "MPMCQueue capacity must be a power of two");
+    static_assert(Capacity >= 2);
+
+public:
+    MPMCQueue()
+    {
+        for (size_t i = 0; i < Capacity; ++i)
+            m_slots[i].sequence.store(i, MemoryOrder::memory_order_relaxed);
+    }
+
+    ~MPMCQueue()
+    {
+        while (try_dequeue().has_value())
+            ;
+    }
+
+    [[nodiscard]] constexpr size_t capacity() const { return Capacity; }
+
+    // Returns false if the queue is currently full; the value is only
+    // consumed on success, so callers may retry with the same object.
+    [[nodiscard]] bool try_enqueue(T&& value)
+    {
+        auto position = m_head.load(MemoryOrder::memory_order_relaxed);
+        for (;;) {
+            auto& slot = m_slots[position & (Capacity - 1)];
+            auto sequence = slot.sequence.load(MemoryOrder::memory_order_acquire);
+            auto difference = static_cast<ssize_t>(sequence) - static_cast<ssize_t>(position);
+            if (difference == 0) {
+                if (m_head.compare_exchange_strong(position, position + 1, MemoryOrder::memory_order_relaxed)) {
+                    new (slot.storage) T(move(value));
+                    slot.sequence.store(position + 1, MemoryOrder::memory_order_release);
+                    return true;
+                }
+                // compare_exchange_strong updated `position` on failure; retry with it.
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = m_head.load(MemoryOrder::memory_order_relaxed);
+            }
+        }
+    }
+
+    [[nodiscard]] bool try_enqueue(T const& value)
+    {
+        return try_enqueue(T(value));
+    }
+
+    // Returns an empty Optional if the queue is currently empty.
+    [[nodiscard]] Optional<T> try_dequeue()
+    {
+        auto position = m_tail.load(MemoryOrder::memory_order_relaxed);
+        for (;;) {
+            auto& slot = m_slots[position & (Capacity - 1)];
+            auto sequence = slot.sequence.load(MemoryOrder::memory_order_acquire);
+            auto difference = static_cast<ssize_t>(sequence) - static_cast<ssize_t>(position + 1);
+            if (difference == 0) {
+                if (m_tail.compare_exchange_strong(position, position + 1, MemoryOrder::memory_order_relaxed)) {
+                    auto* slotted_value = reinterpret_cast<T*>(slot.storage);
+                    Optional<T> value = move(*slotted_value);
+                    slotted_value->~T();
+                    slot.sequence.store(position + Capacity, MemoryOrder::memory_order_release);
+                    return value;
+                }
+            } else if (difference < 0) {
+                return {};
+            } else {
+                position = m_tail.load(MemoryOrder::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    static constexpr size_t cache_line_size = 64;
+
+    struct Slot {
+        Atomic<size_t> sequence;
+        alignas(T) u8 storage[sizeof(T)];
+    };
+
+    alignas(cache_line_size) Array<Slot, Capacity> m_slots;
+    // Producers and consumers contend on different cache lines.
+    alignas(cache_line_size) Atomic<size_t> m_head { 0 };
+    alignas(cache_line_size) Atomic<size_t> m_tail { 0 };
+};
+
+}
+
+#if USING_AK_GLOBALLY
+using AK::MPMCQueue;
+#endif
@@ -8,10 +8,15 @@
 
 #include <AK/Array.h>
 #include <AK/Assertions.h>
+#include <AK/BuiltinWrappers.h>
 #include <AK/Span.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
 
+#ifndef KERNEL
+#    include <AK/SIMD.h>
+#endif
+
 namespace AK {
 
 namespace Detail {
@@ -40,6 +45,56 @@ constexpr void const* bitap_bitwise(void const* haystack, size_t haystack_length
 
     return nullptr;
 }
+
+#ifndef KERNEL
+// Finds candidate positions by comparing the first and last needle bytes
+// across 16-byte blocks, then verifies each candidate with memcmp.
+// This compiles to SSE2 on x86-64 and NEON on AArch64 via the vector
+// extensions in AK/SIMD.h, without any explicit intrinsics.
+inline void const* memmem_vectorized(void const* haystack, size_t haystack_length, void const* needle, size_t needle_length)
+{
+    VERIFY(needle_length > 0);
+    VERIFY(haystack_length >= needle_length);
+
+    auto const* haystack_bytes = (u8 const*)haystack;
+    auto const* needle_bytes = (u8 const*)needle;
+
+    SIMD::u8x16 const first_splat = SIMD::u8x16 {} + needle_bytes[0];
+    SIMD::u8x16 const last_splat = SIMD::u8x16 {} + needle_bytes[needle_length - 1];
+    size_t const last_offset = needle_length - 1;
+
+    size_t position = 0;
+    while (position + last_offset + 16 <= haystack_length) {
+        SIMD::u8x16 first_block;
+        SIMD::u8x16 last_block;
+        __builtin_memcpy(&first_block, haystack_bytes + position, 16);
+        __builtin_memcpy(&last_block, haystack_bytes + position + last_offset, 16);
+
+        auto const matches = (first_block == first_splat) & (last_block == last_splat);
+        u64 match_words[2];
+        __builtin_memcpy(match_words, &matches, 16);
+
+        for (size_t word = 0; word < 2; ++word) {
+            while (match_words[word] != 0) {
+                size_t const bit = count_trailing_zeroes(match_words[word]);
+                size_t const candidate = position + word * 8 + bit / 8;
+                if (__builtin_memcmp(haystack_bytes + candidate, needle_bytes, needle_length) == 0)
+                    return haystack_bytes + candidate;
+                // A matching byte sets all eight of its bits; clear the whole byte.
+                match_words[word] &= ~(0xffull << (bit & ~7u));
+            }
+        }
+        position += 16;
+    }
+
+    for (; position + needle_length <= haystack_length; ++position) {
+        if (haystack_bytes[position] == needle_bytes[0] && __builtin_memcmp(haystack_bytes + position, needle_bytes, needle_length) == 0)
+            return haystack_bytes + position;
+    }
+
+    return nullptr;
+}
+#endif
 }
 
 template<typename HaystackIterT>
@@ -115,6 +170,15 @@ inline Optional<size_t> memmem_optional(void const* haystack, size_t haystack_le
         return {};
     }
 
+#ifndef KERNEL
+    if (haystack_length >= 16) {
+        auto const* ptr = Detail::memmem_vectorized(haystack, haystack_length, needle, needle_length);
+        if (ptr)
+            return static_cast<size_t>((FlatPtr)ptr - (FlatPtr)haystack);
+        return {};
+    }
+#endif
+
     if (needle_length < 32) {
         auto const* ptr = Detail::bitap_bitwise(haystack, haystack_length, needle, needle_length);
         if (ptr)
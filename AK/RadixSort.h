@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Concepts.h>
+#include <AK/InsertionSort.h>
+#include <AK/StdLibExtras.h>
+#include <AK/Vector.h>
+
+namespace AK {
+
+// This is a least-significant-digit radix sort over integral keys, processing
+// one byte per pass. Unlike the comparison-based quick_sort it runs in
+// O(n * sizeof(key)) regardless of the input distribution, which makes it the
+// better choice for large collections of integers (or records keyed by one).
+//
+// The sort is stable: elements with equal keys keep their relative order.
+// It scatters elements between the collection and a scratch buffer of the
+// same size, so it trades memory for speed; values must be movable and
+// default-constructible.
+//
+// `key_for_value` maps an element to its integral sort key and may be called
+// several times per element, so it should be cheap.
+template<typename Collection, typename KeyForValue, typename T = decltype(declval<Collection>()[declval<int>()])>
+void radix_sort(Collection& collection, KeyForValue key_for_value)
+requires(Indexable<Collection, T>)
+{
+    using ValueType = RemoveCVReference<T>;
+    using KeyType = RemoveCVReference<decltype(key_for_value(declval<ValueType&>()))>;
+    static_assert(IsIntegral<KeyType>, "radix_sort requires an integral sort key");
+    using UnsignedKeyType = MakeUnsigned<KeyType>;
+
+    size_t const size = collection.size();
+
+    // Below this size the counting passes cost more than they save.
+    constexpr size_t smallest_worthwhile_size = 64;
+    if (size < smallest_worthwhile_size) {
+        insertion_sort(collection, [&](auto& a, auto& b) { return key_for_value(a) < key_for_value(b); });
+        return;
+    }
+
+    // Flipping the sign bit makes signed keys compare correctly as unsigned.
+    auto sortable_key = [&](ValueType const& value) -> UnsignedKeyType {
+        auto key = static_cast<UnsignedKeyType>(key_for_value(value));
+        if constexpr (IsSigned<KeyType>)
+            key ^= static_cast<UnsignedKeyType>(1) << (8 * sizeof(KeyType) - 1);
+        return key;
+    };
+
+    Vector<ValueType> buffer;
+    buffer.resize(size);
+
+    bool data_is_in_buffer = false;
+    for (size_t pass = 0; pass < sizeof(KeyType); ++pass) {
+        size_t const shift = pass * 8;
+        size_t counts[256] {};
+
+        auto scatter_pass = [&](auto& from, auto& to) {
+            for (size_t i = 0; i < size; ++i)
+                ++counts[(sortable_key(from[i]) >> shift) & 0xff];
+
+            // If every key has the same byte at this position, the pass
+            // wouldn't move anything; skip the scatter.
+            if (counts[(sortable_key(from[0]) >> shift) & 0xff] == size)
+                return false;
+
+            size_t position = 0;
+            for (auto& count : counts) {
+                size_t bucket_size = count;
+                count = position;
+                position += bucket_size;
+            }
+
+            for (size_t i = 0; i < size; ++i)
+                to[counts[(sortable_key(from[i]) >> shift) & 0xff]++] = move(from[i]);
+            return true;
+        };
+
+        bool scattered = data_is_in_buffer
+            ? scatter_pass(buffer, collection)
+            : scatter_pass(collection, buffer);
+        if (scattered)
+            data_is_in_buffer = !data_is_in_buffer;
+    }
+
+    if (data_is_in_buffer) {
+        for (size_t i = 0; i < size; ++i)
+            collection[i] = move(buffer[i]);
+    }
+}
+
+template<typename Collection, typename T = decltype(declval<Collection>()[declval<int>()])>
+void radix_sort(Collection& collection)
+requires(Indexable<Collection, T>)
+{
+    radix_sort(collection, [](auto& value) { return value; });
+}
+
+}
+
+#if USING_AK_GLOBALLY
+using AK::radix_sort;
+#endif
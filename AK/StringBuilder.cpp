@@ -8,6 +8,7 @@
 #include <AK/Checked.h>
 #include <AK/PrintfImplementation.h>
 #include <AK/StdLibExtras.h>
+#include <AK/Stream.h>
 #include <AK/String.h>
 #include <AK/StringBuilder.h>
 #include <AK/StringView.h>
@@ -66,9 +67,12 @@ ErrorOr<void> StringBuilder::try_append(char ch)
 
 ErrorOr<void> StringBuilder::try_append_repeated(char ch, size_t n)
 {
+    if (n == 0)
+        return {};
     TRY(will_append(n));
-    for (size_t i = 0; i < n; ++i)
-        TRY(try_append(ch));
+    auto old_size = m_buffer.size();
+    TRY(m_buffer.try_resize(old_size + n));
+    __builtin_memset(data() + old_size, ch, n);
     return {};
 }
 
@@ -130,6 +134,13 @@ ErrorOr<String> StringBuilder::to_string() const
 }
 #endif
 
+ErrorOr<void> StringBuilder::try_write_to(OutputStream& stream) const
+{
+    if (!stream.write_or_error(string_view().bytes()))
+        return Error::from_string_literal("StringBuilder: Failed to write to stream");
+    return {};
+}
+
 StringView StringBuilder::string_view() const
 {
     return StringView { data(), m_buffer.size() };
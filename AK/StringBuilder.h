@@ -69,6 +69,11 @@ public:
 
     [[nodiscard]] ByteBuffer to_byte_buffer() const;
 
+    // Writes the accumulated contents to the given stream without creating an
+    // intermediate string. Combined with clear(), this lets generators of
+    // large output flush periodically instead of building it all in memory.
+    ErrorOr<void> try_write_to(OutputStream&) const;
+
     [[nodiscard]] StringView string_view() const;
     void clear();
 
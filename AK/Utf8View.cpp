@@ -103,10 +103,36 @@ static inline bool decode_first_byte(
     return false;
 }
 
+// Returns the number of leading ASCII bytes, checking a machine word at a time.
+// Most text going through Utf8View is plain ASCII, so it pays off to skip over
+// whole words of it before falling back to byte-wise decoding.
+static inline size_t count_leading_ascii_bytes(u8 const* bytes, size_t length)
+{
+    constexpr size_t high_bits = static_cast<size_t>(0x8080808080808080ULL);
+    size_t count = 0;
+    while (count + sizeof(size_t) <= length) {
+        size_t word;
+        __builtin_memcpy(&word, bytes + count, sizeof(size_t));
+        if (word & high_bits)
+            break;
+        count += sizeof(size_t);
+    }
+    while (count < length && bytes[count] < 0x80)
+        ++count;
+    return count;
+}
+
 bool Utf8View::validate(size_t& valid_bytes) const
 {
     valid_bytes = 0;
     for (auto ptr = begin_ptr(); ptr < end_ptr(); ptr++) {
+        if (auto ascii_bytes = count_leading_ascii_bytes(ptr, end_ptr() - ptr); ascii_bytes > 0) {
+            valid_bytes += ascii_bytes;
+            ptr += ascii_bytes;
+            if (ptr >= end_ptr())
+                break;
+        }
+
         size_t code_point_length_in_bytes = 0;
         u32 code_point = 0;
         bool first_byte_makes_sense = decode_first_byte(*ptr, code_point_length_in_bytes, code_point);
@@ -136,9 +162,21 @@ bool Utf8View::validate(size_t& valid_bytes) const
 size_t Utf8View::calculate_length() const
 {
     size_t length = 0;
-    for ([[maybe_unused]] auto code_point : *this) {
+
+    for (size_t offset = 0; offset < m_string.length();) {
+        // Since every ASCII byte is a code point of its own, a leading run of
+        // ASCII contributes exactly its byte count to the length.
+        if (auto ascii_bytes = count_leading_ascii_bytes(begin_ptr() + offset, m_string.length() - offset); ascii_bytes > 0) {
+            length += ascii_bytes;
+            offset += ascii_bytes;
+            continue;
+        }
+
+        Utf8CodePointIterator iterator { begin_ptr() + offset, m_string.length() - offset };
+        offset += iterator.underlying_code_point_length_in_bytes();
         ++length;
     }
+
     return length;
 }
 
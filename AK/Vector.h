@@ -647,6 +647,26 @@ public:
         if (m_capacity >= needed_capacity)
             return {};
         size_t new_capacity = kmalloc_good_size(needed_capacity * sizeof(StorageType)) / sizeof(StorageType);
+
+        if constexpr (Traits<StorageType>::is_trivial()) {
+            // Trivial storage may be moved bytewise by the allocator, so let
+            // realloc() extend the allocation in place when it can instead of
+            // unconditionally copying into a fresh buffer. Without inline
+            // storage the first allocation takes this branch too (realloc of
+            // null is just malloc), so the copy below can never see an empty
+            // vector's null data pointer.
+            if (inline_capacity == 0 || m_outline_buffer) {
+                auto size_in_bytes = AK::Checked<size_t>(new_capacity) * AK::Checked<size_t>(sizeof(StorageType));
+                VERIFY(!size_in_bytes.has_overflow());
+                auto* new_buffer = static_cast<StorageType*>(krealloc_sized(m_outline_buffer, m_capacity * sizeof(StorageType), size_in_bytes.value()));
+                if (new_buffer == nullptr)
+                    return Error::from_errno(ENOMEM);
+                m_outline_buffer = new_buffer;
+                m_capacity = new_capacity;
+                return {};
+            }
+        }
+
         auto* new_buffer = static_cast<StorageType*>(kmalloc_array(new_capacity, sizeof(StorageType)));
         if (new_buffer == nullptr)
             return Error::from_errno(ENOMEM);
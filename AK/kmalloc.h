@@ -40,6 +40,24 @@ inline size_t malloc_good_size(size_t size) { return size; }
 
 using std::nothrow;
 
+// Reallocation that can extend in place: in userland, realloc() reuses the
+// existing allocation whenever the new size still fits it. The kernel heap has
+// no realloc, so this falls back to allocate-and-copy there.
+inline void* krealloc_sized(void* ptr, size_t old_size, size_t new_size)
+{
+#if defined(KERNEL)
+    auto* new_ptr = kmalloc(new_size);
+    if (new_ptr && ptr) {
+        __builtin_memcpy(new_ptr, ptr, old_size < new_size ? old_size : new_size);
+        kfree_sized(ptr, old_size);
+    }
+    return new_ptr;
+#else
+    (void)old_size;
+    return realloc(ptr, new_size);
+#endif
+}
+
 inline void* kmalloc_array(AK::Checked<size_t> a, AK::Checked<size_t> b)
 {
     auto size = a * b;
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+// Operations for event_queue_ctl().
+enum class EventQueueOperation : u32 {
+    Add = 1,
+    Modify = 2,
+    Remove = 3,
+};
+
+// A single readiness notification, as filled in by event_queue_wait().
+// `events` is also the registration mask for event_queue_ctl(); Error and
+// HangUp are always reported and need not be registered for.
+struct EventQueueEvent {
+    enum Flags : u32 {
+        None = 0,
+        Read = 1 << 0,
+        Write = 1 << 1,
+        Error = 1 << 2,
+        HangUp = 1 << 3,
+    };
+
+    int fd { -1 };
+    u32 events { None };
+};
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+// Operation types for iobatch().
+enum class IOBatchOperation : u32 {
+    Read = 1,
+    Write = 2,
+};
+
+// A single operation submitted through iobatch(). The kernel fills in
+// `result` with the number of bytes transferred, or a negative errno if the
+// operation failed. Operations are executed in submission order; a failed
+// operation does not stop the ones after it.
+struct IOBatchOp {
+    u32 operation { 0 };
+    int fd { -1 };
+    void* buffer { nullptr };
+    size_t buffer_size { 0 };
+    ssize_t result { 0 };
+};
+
+static constexpr size_t max_iobatch_op_count = 64;
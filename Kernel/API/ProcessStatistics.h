@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+namespace Kernel {
+
+// Binary layout of /sys/kernel/processes_binary.
+//
+// The file starts with a single ProcessStatisticsHeader. After the header,
+// process records follow until end of file: each one is a
+// BinaryProcessStatistics immediately followed by its thread_count
+// BinaryThreadStatistics. All strings are NUL-terminated and truncated to
+// their array size. Bump the version whenever any of these structs change.
+
+static constexpr u32 process_statistics_magic = 0x53504253; // "SBPS"
+static constexpr u32 process_statistics_version = 2;
+
+struct ProcessStatisticsHeader {
+    u32 magic;
+    u32 version;
+    u64 total_time_scheduled;
+    u64 total_time_scheduled_kernel;
+};
+
+struct BinaryThreadStatistics {
+    i32 tid;
+    u32 times_scheduled;
+    u64 time_user;
+    u64 time_kernel;
+    u32 cpu;
+    u32 priority;
+    u32 syscall_count;
+    u32 inode_faults;
+    u32 zero_faults;
+    u32 cow_faults;
+    u32 unix_socket_read_bytes;
+    u32 unix_socket_write_bytes;
+    u32 ipv4_socket_read_bytes;
+    u32 ipv4_socket_write_bytes;
+    u32 file_read_bytes;
+    u32 file_write_bytes;
+    char state[16];
+    char name[64];
+};
+static_assert(sizeof(BinaryThreadStatistics) == 152);
+
+struct BinaryProcessStatistics {
+    i32 pid;
+    i32 pgid;
+    i32 pgp;
+    i32 sid;
+    u32 uid;
+    u32 gid;
+    i32 ppid;
+    u32 nfds;
+    u8 kernel;
+    u8 dumpable;
+    u8 padding[2];
+    u32 thread_count;
+    u64 amount_virtual;
+    u64 amount_resident;
+    u64 amount_shared;
+    u64 amount_dirty_private;
+    u64 amount_clean_inode;
+    u64 amount_purgeable_volatile;
+    u64 amount_purgeable_nonvolatile;
+    // Incremented whenever any of the process's statistics may have changed.
+    // A reader that sees the same value twice can reuse its previous snapshot
+    // of this record and its thread records.
+    u64 change_sequence;
+    char name[64];
+    char executable[192];
+    char tty[32];
+    char pledge[256];
+    char veil[16];
+};
+static_assert(sizeof(BinaryProcessStatistics) == 664);
+
+}
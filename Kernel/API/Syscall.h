@@ -16,6 +16,8 @@ extern "C" {
 struct pollfd;
 struct timeval;
 struct timespec;
+struct EventQueueEvent;
+struct IOBatchOp;
 struct sockaddr;
 struct siginfo;
 struct stat;
@@ -64,6 +66,9 @@ enum class NeedsBigProcessLock {
     S(dump_backtrace, NeedsBigProcessLock::No)              \
     S(dup2, NeedsBigProcessLock::No)                        \
     S(emuctl, NeedsBigProcessLock::No)                      \
+    S(event_queue_create, NeedsBigProcessLock::Yes)         \
+    S(event_queue_ctl, NeedsBigProcessLock::Yes)            \
+    S(event_queue_wait, NeedsBigProcessLock::Yes)           \
     S(execve, NeedsBigProcessLock::Yes)                     \
     S(exit, NeedsBigProcessLock::Yes)                       \
     S(exit_thread, NeedsBigProcessLock::Yes)                \
@@ -105,6 +110,7 @@ enum class NeedsBigProcessLock {
     S(getuid, NeedsBigProcessLock::No)                      \
     S(inode_watcher_add_watch, NeedsBigProcessLock::Yes)    \
     S(inode_watcher_remove_watch, NeedsBigProcessLock::Yes) \
+    S(iobatch, NeedsBigProcessLock::Yes)                    \
     S(ioctl, NeedsBigProcessLock::Yes)                      \
     S(join_thread, NeedsBigProcessLock::Yes)                \
     S(jail_create, NeedsBigProcessLock::No)                 \
@@ -151,6 +157,7 @@ enum class NeedsBigProcessLock {
     S(scheduler_get_parameters, NeedsBigProcessLock::No)    \
     S(scheduler_set_parameters, NeedsBigProcessLock::No)    \
     S(sendfd, NeedsBigProcessLock::No)                      \
+    S(sendfile, NeedsBigProcessLock::Yes)                   \
     S(sendmsg, NeedsBigProcessLock::Yes)                    \
     S(set_coredump_metadata, NeedsBigProcessLock::No)       \
     S(set_mmap_name, NeedsBigProcessLock::Yes)              \
@@ -257,6 +264,13 @@ struct SC_poll_params {
     u32 const* sigmask;
 };
 
+struct SC_event_queue_wait_params {
+    int queue_fd;
+    struct EventQueueEvent* events;
+    size_t max_events;
+    const struct timespec* timeout;
+};
+
 struct SC_clock_nanosleep_params {
     int clock_id;
     int flags;
@@ -1002,6 +1002,16 @@ void Processor::check_invoke_scheduler()
 
 void Processor::flush_tlb_local(VirtualAddress vaddr, size_t page_count)
 {
+    // For large user ranges, reloading CR3 once is far cheaper than issuing an
+    // INVLPG per page; it flushes every non-global TLB entry, and user pages
+    // are never global. Kernel ranges must keep taking the INVLPG path, since
+    // their (global) mappings survive a CR3 reload while CR4.PGE is enabled.
+    static constexpr size_t full_flush_threshold = 32;
+    if (page_count >= full_flush_threshold && Memory::is_user_range(vaddr, page_count * PAGE_SIZE)) {
+        write_cr3(read_cr3());
+        return;
+    }
+
     auto ptr = vaddr.as_ptr();
     while (page_count > 0) {
         // clang-format off
@@ -182,7 +182,7 @@ ErrorOr<void> Coredump::write_program_headers(size_t notes_size)
         phdr.p_vaddr = region.vaddr().get();
         phdr.p_paddr = 0;
 
-        phdr.p_filesz = region.page_count() * PAGE_SIZE;
+        phdr.p_filesz = region.file_page_count() * PAGE_SIZE;
         phdr.p_memsz = region.page_count() * PAGE_SIZE;
         phdr.p_align = 0;
 
@@ -212,9 +212,56 @@ ErrorOr<void> Coredump::write_program_headers(size_t notes_size)
     return {};
 }
 
+static bool page_is_untouched(Memory::Region const& region, size_t page_index)
+{
+    auto page = region.physical_page(page_index);
+    return !page || page->is_shared_zero_page() || page->is_lazy_committed_page();
+}
+
+ErrorOr<void> Coredump::determine_file_page_counts()
+{
+    // Pages the process never touched (unbacked, or still backed by the
+    // shared zero page or the lazy committed page) are all zero. Trailing
+    // runs of them are dropped from each PT_LOAD segment by shrinking
+    // p_filesz below p_memsz; readers zero-fill the difference. This also
+    // makes the regions readable so write_regions() can copy from them.
+    return m_process->address_space().with([&](auto& space) -> ErrorOr<void> {
+        for (auto& region : m_regions) {
+#if !INCLUDE_USERSPACE_HEAP_MEMORY_IN_COREDUMPS
+            if (region.looks_like_userspace_heap_region())
+                continue;
+#endif
+
+            if (region.access() == Memory::Region::Access::None)
+                continue;
+
+            auto* real_region = space->region_tree().regions().find(region.vaddr().get());
+            if (!real_region || !region.is_consistent_with_region(*real_region))
+                continue;
+
+            // If we crashed in the middle of mapping in Regions, they do not have a page directory yet, and will crash on a remap() call
+            if (!real_region->is_mapped())
+                continue;
+
+            real_region->set_readable(true);
+            real_region->remap();
+
+            auto file_page_count = region.page_count();
+            while (file_page_count > 0 && page_is_untouched(*real_region, file_page_count - 1))
+                --file_page_count;
+            region.set_file_page_count(file_page_count);
+        }
+        return {};
+    });
+}
+
 ErrorOr<void> Coredump::write_regions()
 {
-    u8 zero_buffer[PAGE_SIZE] = {};
+    // Regions are copied out in bounded chunks so dumping a large process
+    // doesn't have to allocate a region-sized kernel buffer, and so the
+    // address space lock is never held across file I/O.
+    constexpr size_t chunk_page_count = 64;
+    auto buffer = TRY(KBuffer::try_create_with_size("Coredump Region Copy Buffer"sv, chunk_page_count * PAGE_SIZE));
 
     for (auto& region : m_regions) {
         VERIFY(!region.is_kernel());
@@ -227,39 +274,41 @@ ErrorOr<void> Coredump::write_regions()
         if (region.access() == Memory::Region::Access::None)
             continue;
 
-        auto buffer = TRY(KBuffer::try_create_with_size("Coredump Region Copy Buffer"sv, region.page_count() * PAGE_SIZE));
-
-        TRY(m_process->address_space().with([&](auto& space) -> ErrorOr<void> {
-            auto* real_region = space->region_tree().regions().find(region.vaddr().get());
+        for (size_t chunk_base = 0; chunk_base < region.file_page_count(); chunk_base += chunk_page_count) {
+            auto pages_in_chunk = min(chunk_page_count, region.file_page_count() - chunk_base);
 
-            if (!real_region)
-                return Error::from_string_view("Failed to find matching region in the process"sv);
+            TRY(m_process->address_space().with([&](auto& space) -> ErrorOr<void> {
+                auto* real_region = space->region_tree().regions().find(region.vaddr().get());
 
-            if (!region.is_consistent_with_region(*real_region))
-                return Error::from_string_view("Found region does not match stored metadata"sv);
+                if (!real_region)
+                    return Error::from_string_view("Failed to find matching region in the process"sv);
 
-            // If we crashed in the middle of mapping in Regions, they do not have a page directory yet, and will crash on a remap() call
-            if (!real_region->is_mapped())
-                return {};
+                if (!region.is_consistent_with_region(*real_region))
+                    return Error::from_string_view("Found region does not match stored metadata"sv);
 
-            real_region->set_readable(true);
-            real_region->remap();
+                if (!real_region->is_mapped()) {
+                    memset(buffer->data(), 0, pages_in_chunk * PAGE_SIZE);
+                    return {};
+                }
 
-            for (size_t i = 0; i < region.page_count(); i++) {
-                auto page = real_region->physical_page(i);
-                auto src_buffer = [&]() -> ErrorOr<UserOrKernelBuffer> {
-                    if (page)
-                        return UserOrKernelBuffer::for_user_buffer(reinterpret_cast<uint8_t*>((region.vaddr().as_ptr() + (i * PAGE_SIZE))), PAGE_SIZE);
-                    // If the current page is not backed by a physical page, we zero it in the coredump file.
-                    return UserOrKernelBuffer::for_kernel_buffer(zero_buffer);
-                }();
-                TRY(src_buffer.value().read(buffer->bytes().slice(i * PAGE_SIZE, PAGE_SIZE)));
-            }
+                for (size_t i = 0; i < pages_in_chunk; i++) {
+                    auto page_index = chunk_base + i;
+                    auto dest = buffer->bytes().slice(i * PAGE_SIZE, PAGE_SIZE);
+                    // Untouched pages are zeroed in the coredump file without
+                    // reading (and thereby committing) the page.
+                    if (page_is_untouched(*real_region, page_index)) {
+                        memset(dest.data(), 0, PAGE_SIZE);
+                        continue;
+                    }
+                    auto src_buffer = UserOrKernelBuffer::for_user_buffer(reinterpret_cast<uint8_t*>(region.vaddr().as_ptr() + (page_index * PAGE_SIZE)), PAGE_SIZE);
+                    TRY(src_buffer.read(dest));
+                }
 
-            return {};
-        }));
+                return {};
+            }));
 
-        TRY(m_description->write(UserOrKernelBuffer::for_kernel_buffer(buffer->data()), buffer->size()));
+            TRY(m_description->write(UserOrKernelBuffer::for_kernel_buffer(buffer->data()), pages_in_chunk * PAGE_SIZE));
+        }
     }
 
     return {};
@@ -389,6 +438,7 @@ ErrorOr<void> Coredump::write()
 
     auto builder = TRY(KBufferBuilder::try_create());
     TRY(create_notes_segment_data(builder));
+    TRY(determine_file_page_counts());
     TRY(write_elf_header());
     TRY(write_program_headers(builder.bytes().size()));
     TRY(write_regions());
@@ -35,6 +35,7 @@ private:
             , m_is_writable(region.is_writable())
             , m_name(move(name))
             , m_page_count(region.page_count())
+            , m_file_page_count(region.page_count())
             , m_size(region.size())
             , m_vaddr(region.vaddr())
         {
@@ -50,6 +51,11 @@ private:
         auto size() const { return m_size; }
         auto vaddr() const { return m_vaddr; }
 
+        // Number of leading pages that end up in the coredump file; the
+        // remaining (all-zero) pages are only represented by p_memsz.
+        auto file_page_count() const { return m_file_page_count; }
+        void set_file_page_count(size_t count) { m_file_page_count = count; }
+
         bool looks_like_userspace_heap_region() const;
         bool is_consistent_with_region(Memory::Region const& region) const;
 
@@ -61,6 +67,7 @@ private:
         bool m_is_writable;
         NonnullOwnPtr<KString> m_name;
         size_t m_page_count;
+        size_t m_file_page_count;
         size_t m_size;
         VirtualAddress m_vaddr;
     };
@@ -68,6 +75,7 @@ private:
     Coredump(NonnullLockRefPtr<Process>, NonnullLockRefPtr<OpenFileDescription>, Vector<FlatRegionData>);
     static ErrorOr<NonnullLockRefPtr<OpenFileDescription>> try_create_target_file(Process const&, StringView output_path);
 
+    ErrorOr<void> determine_file_page_counts();
     ErrorOr<void> write_elf_header();
     ErrorOr<void> write_program_headers(size_t notes_size);
     ErrorOr<void> write_regions();
@@ -6,12 +6,14 @@
 
 #include <Kernel/Devices/AsyncDeviceRequest.h>
 #include <Kernel/Devices/Device.h>
+#include <Kernel/Time/TimeManagement.h>
 
 namespace Kernel {
 
 AsyncDeviceRequest::AsyncDeviceRequest(Device& device)
     : m_device(device)
     , m_process(Process::current())
+    , m_enqueue_time(TimeManagement::the().monotonic_time())
 {
 }
 
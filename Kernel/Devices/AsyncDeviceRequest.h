@@ -81,6 +81,8 @@ public:
     }
     void* get_private() const { return m_private; }
 
+    Time const& enqueue_time() const { return m_enqueue_time; }
+
     template<typename... Args>
     ErrorOr<void> write_to_buffer(UserOrKernelBuffer& buffer, Args... args)
     {
@@ -150,6 +152,7 @@ private:
     AsyncDeviceSubRequestList m_sub_requests_complete;
     WaitQueue m_queue;
     NonnullLockRefPtr<Process> m_process;
+    Time m_enqueue_time;
     void* m_private { nullptr };
     mutable Spinlock m_lock { LockRank::None };
 };
@@ -75,6 +75,7 @@ void Device::process_next_queued_request(Badge<AsyncDeviceRequest>, AsyncDeviceR
     VERIFY(m_requests.first().ptr() == &completed_request);
     m_requests.remove(m_requests.begin());
     if (!m_requests.is_empty()) {
+        select_next_queued_request(m_requests, completed_request);
         auto* next_request = m_requests.first().ptr();
         next_request->do_start(move(lock));
     }
@@ -71,6 +71,11 @@ protected:
     void set_uid(UserID uid) { m_uid = uid; }
     void set_gid(GroupID gid) { m_gid = gid; }
 
+    // Called with the request queue lock held after a request completes, so
+    // subclasses can move their preferred next request to the front of the
+    // queue before it gets started. The default keeps FIFO order.
+    virtual void select_next_queued_request(DoublyLinkedList<LockRefPtr<AsyncDeviceRequest>>&, AsyncDeviceRequest const&) { }
+
     void after_inserting_add_to_device_management();
     void before_will_be_destroyed_remove_from_device_management();
 
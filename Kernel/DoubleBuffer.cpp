@@ -36,6 +36,39 @@ DoubleBuffer::DoubleBuffer(size_t capacity, NonnullOwnPtr<KBuffer> storage)
     m_space_for_writing = capacity;
 }
 
+ErrorOr<void> DoubleBuffer::try_set_capacity(size_t capacity)
+{
+    if (capacity == 0)
+        return EINVAL;
+    MutexLocker locker(m_lock);
+    if (capacity == m_capacity)
+        return {};
+    size_t pending = (m_read_buffer->size - m_read_buffer_index) + m_write_buffer->size;
+    if (pending > capacity)
+        return EBUSY;
+
+    auto storage = TRY(KBuffer::try_create_with_size("DoubleBuffer: Resized"sv, capacity * 2, Memory::Region::Access::ReadWrite));
+
+    // Compact all buffered bytes into the new read half, and hand writers a
+    // fresh write half.
+    u8* data = storage->data();
+    size_t readable_in_read_half = m_read_buffer->size - m_read_buffer_index;
+    memcpy(data + capacity, m_read_buffer->data + m_read_buffer_index, readable_in_read_half);
+    memcpy(data + capacity + readable_in_read_half, m_write_buffer->data, m_write_buffer->size);
+
+    m_storage = move(storage);
+    m_capacity = capacity;
+    m_buffer1 = { data, 0 };
+    m_buffer2 = { data + capacity, pending };
+    m_write_buffer = &m_buffer1;
+    m_read_buffer = &m_buffer2;
+    m_read_buffer_index = 0;
+    compute_lockfree_metadata();
+    if (m_unblock_callback && m_space_for_writing > 0)
+        m_unblock_callback();
+    return {};
+}
+
 void DoubleBuffer::flip()
 {
     VERIFY(m_read_buffer_index == m_read_buffer->size);
@@ -60,6 +93,19 @@ ErrorOr<size_t> DoubleBuffer::write(UserOrKernelBuffer const& data, size_t size)
     return bytes_to_write;
 }
 
+ErrorOr<size_t> DoubleBuffer::write_with(Function<ErrorOr<size_t>(Bytes)> writer)
+{
+    MutexLocker locker(m_lock);
+    u8* write_ptr = m_write_buffer->data + m_write_buffer->size;
+    size_t nwritten = TRY(writer(Bytes { write_ptr, m_space_for_writing }));
+    VERIFY(nwritten <= m_space_for_writing);
+    m_write_buffer->size += nwritten;
+    compute_lockfree_metadata();
+    if (m_unblock_callback && !m_empty)
+        m_unblock_callback();
+    return nwritten;
+}
+
 ErrorOr<size_t> DoubleBuffer::read_impl(UserOrKernelBuffer& data, size_t size, MutexLocker&, bool advance_buffer_index)
 {
     if (size == 0)
@@ -22,6 +22,10 @@ public:
     {
         return write(UserOrKernelBuffer::for_kernel_buffer(const_cast<u8*>(data)), size);
     }
+    // Hands the writable region to the given callback so producers can fill it
+    // in place instead of copying through an intermediate buffer. The callback
+    // returns how many bytes it actually wrote.
+    ErrorOr<size_t> write_with(Function<ErrorOr<size_t>(Bytes)>);
     ErrorOr<size_t> read(UserOrKernelBuffer&, size_t);
     ErrorOr<size_t> read(u8* data, size_t size)
     {
@@ -37,6 +41,11 @@ public:
 
     bool is_empty() const { return m_empty; }
 
+    size_t capacity() const { return m_capacity; }
+    // Replaces the backing storage with one of the given capacity, carrying
+    // any buffered bytes over. Fails with EBUSY if they wouldn't fit.
+    ErrorOr<void> try_set_capacity(size_t);
+
     size_t space_for_writing() const { return m_space_for_writing; }
     size_t immediately_readable() const
     {
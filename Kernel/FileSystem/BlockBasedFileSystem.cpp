@@ -5,6 +5,7 @@
  */
 
 #include <AK/IntrusiveList.h>
+#include <AK/QuickSort.h>
 #include <Kernel/Debug.h>
 #include <Kernel/FileSystem/BlockBasedFileSystem.h>
 #include <Kernel/Process.h>
@@ -245,10 +246,55 @@ ErrorOr<void> BlockBasedFileSystem::read_block(BlockIndex index, UserOrKernelBuf
         }
         if (buffer)
             TRY(buffer->write(entry->data + offset, count));
+        // A failed readahead must not fail the read that triggered it.
+        if (auto result = readahead_after_sequential_read(*cache, index); result.is_error())
+            dbgln_if(BBFS_DEBUG, "BlockBasedFileSystem: Readahead after block {} failed: {}", index, result.error());
         return {};
     });
 }
 
+ErrorOr<void> BlockBasedFileSystem::readahead_after_sequential_read(DiskCache& cache, BlockIndex index) const
+{
+    // Called with the cache lock held. Track whether cached reads are walking
+    // the disk sequentially; once a streak is established, pull the next run
+    // of uncached blocks into the cache with a single contiguous read, so the
+    // reader's next few misses are serviced from memory instead of paying a
+    // device round-trip per block.
+    if (index.value() == m_last_cached_read_block_index.value() + 1)
+        ++m_sequential_read_streak;
+    else
+        m_sequential_read_streak = 0;
+    m_last_cached_read_block_index = index;
+
+    if (m_sequential_read_streak < 2)
+        return {};
+
+    size_t readahead_count = 0;
+    while (readahead_count < max_readahead_block_count) {
+        auto* entry = cache.get(BlockIndex { index.value() + 1 + readahead_count });
+        if (entry && entry->has_data)
+            break;
+        ++readahead_count;
+    }
+    if (readahead_count == 0)
+        return {};
+
+    auto buffered_data = TRY(ByteBuffer::create_uninitialized(readahead_count * block_size()));
+    auto data_buffer = UserOrKernelBuffer::for_kernel_buffer(buffered_data.data());
+    auto base_offset = (index.value() + 1) * block_size();
+    auto nread = TRY(file_description().read(data_buffer, base_offset, readahead_count * block_size()));
+
+    // The device may end before the full readahead window; cache whole blocks only.
+    for (size_t i = 0; i < nread / block_size(); ++i) {
+        auto* entry = TRY(cache.ensure(BlockIndex { index.value() + 1 + i }));
+        if (entry->has_data)
+            continue;
+        memcpy(entry->data, buffered_data.data() + i * block_size(), block_size());
+        entry->has_data = true;
+    }
+    return {};
+}
+
 ErrorOr<void> BlockBasedFileSystem::read_blocks(BlockIndex index, unsigned count, UserOrKernelBuffer& buffer, bool allow_cache) const
 {
     VERIFY(m_logical_block_size);
@@ -287,12 +333,52 @@ void BlockBasedFileSystem::flush_writes_impl()
     m_cache.with_exclusive([&](auto& cache) {
         if (!cache->is_dirty())
             return;
+
+        // Collect the dirty entries and sort them by block index, so runs of
+        // adjacent dirty blocks (the common case after a large sequential
+        // write) go to the device as single contiguous writes instead of one
+        // round-trip per block.
+        Vector<CacheEntry*> dirty_entries;
         cache->for_each_dirty_entry([&](CacheEntry& entry) {
-            auto base_offset = entry.block_index.value() * block_size();
-            auto entry_data_buffer = UserOrKernelBuffer::for_kernel_buffer(entry.data);
-            [[maybe_unused]] auto rc = file_description().write(base_offset, entry_data_buffer, block_size());
-            ++count;
+            if (dirty_entries.try_append(&entry).is_error()) {
+                // Can't track this entry for coalescing, so write it out by itself.
+                auto base_offset = entry.block_index.value() * block_size();
+                auto entry_data_buffer = UserOrKernelBuffer::for_kernel_buffer(entry.data);
+                [[maybe_unused]] auto rc = file_description().write(base_offset, entry_data_buffer, block_size());
+                ++count;
+            }
         });
+        quick_sort(dirty_entries, [](auto* a, auto* b) { return a->block_index.value() < b->block_index.value(); });
+
+        // The cached blocks are scattered around the cache's backing buffer,
+        // so coalesced runs get gathered into a bounce buffer first. If that
+        // can't be allocated, we degrade to per-block writes below.
+        auto bounce_buffer_or_error = ByteBuffer::create_uninitialized(max_coalesced_flush_block_count * block_size());
+
+        for (size_t i = 0; i < dirty_entries.size();) {
+            size_t run_length = 1;
+            if (!bounce_buffer_or_error.is_error()) {
+                while (i + run_length < dirty_entries.size()
+                    && run_length < max_coalesced_flush_block_count
+                    && dirty_entries[i + run_length]->block_index.value() == dirty_entries[i]->block_index.value() + run_length)
+                    ++run_length;
+            }
+
+            auto base_offset = dirty_entries[i]->block_index.value() * block_size();
+            if (run_length == 1) {
+                auto entry_data_buffer = UserOrKernelBuffer::for_kernel_buffer(dirty_entries[i]->data);
+                [[maybe_unused]] auto rc = file_description().write(base_offset, entry_data_buffer, block_size());
+            } else {
+                auto& bounce_buffer = bounce_buffer_or_error.value();
+                for (size_t j = 0; j < run_length; ++j)
+                    memcpy(bounce_buffer.data() + j * block_size(), dirty_entries[i + j]->data, block_size());
+                auto data_buffer = UserOrKernelBuffer::for_kernel_buffer(bounce_buffer.data());
+                [[maybe_unused]] auto rc = file_description().write(base_offset, data_buffer, run_length * block_size());
+            }
+            count += run_length;
+            i += run_length;
+        }
+
         cache->mark_all_clean();
         dbgln("{}: Flushed {} blocks to disk", class_name(), count);
     });
@@ -46,8 +46,16 @@ protected:
 private:
     DiskCache& cache() const;
     void flush_specific_block_if_needed(BlockIndex index);
+    ErrorOr<void> readahead_after_sequential_read(DiskCache&, BlockIndex) const;
+
+    static constexpr size_t max_readahead_block_count = 8;
+    static constexpr size_t max_coalesced_flush_block_count = 32;
 
     mutable MutexProtected<OwnPtr<DiskCache>> m_cache;
+
+    // Readahead state, guarded by the cache lock.
+    mutable BlockIndex m_last_cached_read_block_index { 0 };
+    mutable size_t m_sequential_read_streak { 0 };
 };
 
 }
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashMap.h>
 #include <AK/RefPtr.h>
 #include <AK/Singleton.h>
 #include <AK/StringBuilder.h>
@@ -14,8 +15,36 @@
 
 namespace Kernel {
 
+struct CustodyCacheKey {
+    Custody const* parent { nullptr };
+    StringView name;
+    bool operator==(CustodyCacheKey const&) const = default;
+};
+
+}
+
+namespace AK {
+
+template<>
+struct Traits<Kernel::CustodyCacheKey> : public GenericTraits<Kernel::CustodyCacheKey> {
+    static unsigned hash(Kernel::CustodyCacheKey const& key)
+    {
+        return pair_int_hash(ptr_hash(key.parent), key.name.hash());
+    }
+};
+
+}
+
+namespace Kernel {
+
 static Singleton<SpinlockProtected<Custody::AllCustodiesList>> s_all_instances;
 
+// Secondary index over all live custodies, keyed by (parent, name), so that
+// re-resolving a path doesn't scan every custody in the system. The values
+// are non-owning; entries are removed by remove_from_secondary_lists() when
+// the last reference dies. Only ever accessed under the all_instances() lock.
+static Singleton<HashMap<CustodyCacheKey, Custody*>> s_custody_cache;
+
 SpinlockProtected<Custody::AllCustodiesList>& Custody::all_instances()
 {
     return s_all_instances;
@@ -24,22 +53,36 @@ SpinlockProtected<Custody::AllCustodiesList>& Custody::all_instances()
 ErrorOr<NonnullRefPtr<Custody>> Custody::try_create(Custody* parent, StringView name, Inode& inode, int mount_flags)
 {
     return all_instances().with([&](auto& all_custodies) -> ErrorOr<NonnullRefPtr<Custody>> {
-        for (Custody& custody : all_custodies) {
-            if (custody.parent() == parent
-                && custody.name() == name
-                && &custody.inode() == &inode
-                && custody.mount_flags() == mount_flags) {
+        if (auto it = s_custody_cache->find(CustodyCacheKey { parent, name }); it != s_custody_cache->end()) {
+            auto& custody = *it->value;
+            if (&custody.inode() == &inode && custody.mount_flags() == mount_flags)
                 return NonnullRefPtr { custody };
-            }
+            // The name refers to something else now (the old file was
+            // unlinked, or something was mounted over it); drop the stale
+            // entry and index the replacement below.
+            s_custody_cache->remove(it);
         }
 
         auto name_kstring = TRY(KString::try_create(name));
         auto custody = TRY(adopt_nonnull_ref_or_enomem(new (nothrow) Custody(parent, move(name_kstring), inode, mount_flags)));
         all_custodies.prepend(*custody);
+        // NOTE: The key must view the custody's own name string, which lives
+        // exactly as long as the custody. Failing to index is harmless: later
+        // lookups simply miss and create an equivalent custody.
+        (void)s_custody_cache->try_set(CustodyCacheKey { parent, custody->name() }, custody.ptr());
         return custody;
     });
 }
 
+void Custody::remove_from_secondary_lists()
+{
+    // Called under the all_instances() lock when the last reference dies. If
+    // this custody was displaced from the cache by a newer one for the same
+    // (parent, name), the entry is no longer ours to remove.
+    if (auto it = s_custody_cache->find(CustodyCacheKey { m_parent.ptr(), name() }); it != s_custody_cache->end() && it->value == this)
+        s_custody_cache->remove(it);
+}
+
 Custody::Custody(Custody* parent, NonnullOwnPtr<KString> name, Inode& inode, int mount_flags)
     : m_parent(parent)
     , m_name(move(name))
@@ -22,6 +22,8 @@ public:
 
     ~Custody();
 
+    void remove_from_secondary_lists();
+
     RefPtr<Custody> parent() { return m_parent; }
     RefPtr<Custody const> parent() const { return m_parent; }
     Inode& inode() { return *m_inode; }
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <Kernel/FileSystem/EventQueue.h>
+#include <Kernel/FileSystem/OpenFileDescription.h>
+
+namespace Kernel {
+
+using BlockFlags = Thread::FileBlocker::BlockFlags;
+
+ErrorOr<NonnullLockRefPtr<EventQueue>> EventQueue::try_create()
+{
+    return adopt_nonnull_lock_ref_or_enomem(new (nothrow) EventQueue);
+}
+
+EventQueue::~EventQueue() = default;
+
+ErrorOr<void> EventQueue::close()
+{
+    MutexLocker locker(m_lock);
+    m_registrations.clear();
+    return {};
+}
+
+ErrorOr<NonnullOwnPtr<KString>> EventQueue::pseudo_path(OpenFileDescription const&) const
+{
+    return KString::try_create(":event-queue:"sv);
+}
+
+ErrorOr<void> EventQueue::register_fd(int fd, NonnullLockRefPtr<OpenFileDescription> description, u32 events)
+{
+    MutexLocker locker(m_lock);
+    if (m_registrations.contains(fd))
+        return EEXIST;
+    TRY(m_registrations.try_set(fd, Registration { move(description), events }));
+    return {};
+}
+
+ErrorOr<void> EventQueue::modify_fd(int fd, u32 events)
+{
+    MutexLocker locker(m_lock);
+    auto it = m_registrations.find(fd);
+    if (it == m_registrations.end())
+        return ENOENT;
+    it->value.events = events;
+    return {};
+}
+
+ErrorOr<void> EventQueue::unregister_fd(int fd)
+{
+    MutexLocker locker(m_lock);
+    if (!m_registrations.remove(fd))
+        return ENOENT;
+    return {};
+}
+
+ErrorOr<void> EventQueue::collect_registrations(Thread::SelectBlocker::FDVector& fds_info, Vector<int>& fds) const
+{
+    MutexLocker locker(m_lock);
+    TRY(fds_info.try_ensure_capacity(m_registrations.size()));
+    TRY(fds.try_ensure_capacity(m_registrations.size()));
+    for (auto const& it : m_registrations) {
+        // Error and hang-up are always of interest, like POLLERR/POLLHUP.
+        BlockFlags block_flags = BlockFlags::WriteError | BlockFlags::WriteHangUp;
+        if (it.value.events & EventQueueEvent::Read)
+            block_flags |= BlockFlags::Read;
+        if (it.value.events & EventQueueEvent::Write)
+            block_flags |= BlockFlags::Write;
+        fds_info.unchecked_append({ it.value.description, block_flags, BlockFlags::None });
+        fds.unchecked_append(it.key);
+    }
+    return {};
+}
+
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <Kernel/API/EventQueue.h>
+#include <Kernel/FileSystem/File.h>
+#include <Kernel/Forward.h>
+#include <Kernel/Thread.h>
+
+namespace Kernel {
+
+// A persistent set of file descriptors to wait on, created with
+// sys$event_queue_create(). Unlike sys$poll(), the registrations live in the
+// kernel across waits, so a waiting process neither re-submits its interest
+// set every iteration nor receives state for descriptors that are not ready.
+//
+// NOTE: A registration keeps the open file description alive; userspace must
+// remove a descriptor from every queue before close() can release it.
+class EventQueue final : public File {
+public:
+    static ErrorOr<NonnullLockRefPtr<EventQueue>> try_create();
+    virtual ~EventQueue() override;
+
+    // An event queue is not itself selectable or readable; it only hands out
+    // events through sys$event_queue_wait().
+    virtual bool can_read(OpenFileDescription const&, u64) const override { return false; }
+    virtual ErrorOr<size_t> read(OpenFileDescription&, u64, UserOrKernelBuffer&, size_t) override { return EIO; }
+    virtual bool can_write(OpenFileDescription const&, u64) const override { return false; }
+    virtual ErrorOr<size_t> write(OpenFileDescription&, u64, UserOrKernelBuffer const&, size_t) override { return EIO; }
+    virtual ErrorOr<void> close() override;
+
+    virtual ErrorOr<NonnullOwnPtr<KString>> pseudo_path(OpenFileDescription const&) const override;
+    virtual StringView class_name() const override { return "EventQueue"sv; }
+    virtual bool is_event_queue() const override { return true; }
+
+    ErrorOr<void> register_fd(int fd, NonnullLockRefPtr<OpenFileDescription>, u32 events);
+    ErrorOr<void> modify_fd(int fd, u32 events);
+    ErrorOr<void> unregister_fd(int fd);
+
+    // Builds the interest set for a Thread::SelectBlocker from the current
+    // registrations. The fd numbers corresponding to each entry are appended
+    // to `fds`.
+    ErrorOr<void> collect_registrations(Thread::SelectBlocker::FDVector&, Vector<int>& fds) const;
+
+private:
+    EventQueue() = default;
+
+    struct Registration {
+        NonnullLockRefPtr<OpenFileDescription> description;
+        u32 events { 0 };
+    };
+
+    mutable Mutex m_lock;
+    HashMap<int, Registration> m_registrations;
+};
+
+}
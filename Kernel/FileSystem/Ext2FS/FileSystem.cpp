@@ -267,12 +267,21 @@ auto Ext2FS::allocate_blocks(GroupIndex preferred_group_index, size_t count) ->
         auto first_unset_bit_index = block_bitmap.find_longest_range_of_unset_bits(count - blocks.size(), free_region_size);
         VERIFY(first_unset_bit_index.has_value());
         dbgln_if(EXT2_DEBUG, "Ext2FS: allocating free region of size: {} [{}]", free_region_size, group_index);
+        // Claim the entire free region in the cached bitmap at once instead of
+        // re-resolving the bitmap block and toggling one bit per block.
         for (size_t i = 0; i < free_region_size; ++i) {
-            BlockIndex block_index = (first_unset_bit_index.value() + i) + first_block_in_group.value();
-            TRY(set_block_allocation_state(block_index, true));
+            size_t bit_index = first_unset_bit_index.value() + i;
+            block_bitmap.set(bit_index, true);
+            BlockIndex block_index = bit_index + first_block_in_group.value();
             blocks.unchecked_append(block_index);
             dbgln_if(EXT2_DEBUG, "  allocated > {}", block_index);
         }
+        cached_bitmap->dirty = true;
+        auto& mutable_bgd = const_cast<ext2_group_desc&>(bgd);
+        m_super_block.s_free_blocks_count -= free_region_size;
+        mutable_bgd.bg_free_blocks_count -= free_region_size;
+        m_super_block_dirty = true;
+        m_block_group_descriptors_dirty = true;
     }
 
     VERIFY(blocks.size() == count);
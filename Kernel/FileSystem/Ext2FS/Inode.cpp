@@ -817,6 +817,45 @@ ErrorOr<void> Ext2FSInode::write_directory(Vector<Ext2FSDirectoryEntry>& entries
     return {};
 }
 
+ErrorOr<void> Ext2FSInode::remove_directory_entry(StringView name)
+{
+    VERIFY(m_inode_lock.is_exclusively_locked_by_current_thread());
+    VERIFY(is_directory());
+
+    u8 buffer[max_block_size];
+    auto buf = UserOrKernelBuffer::for_kernel_buffer(buffer);
+
+    auto block_size = fs().block_size();
+    auto file_size = size();
+
+    for (u64 offset = 0; offset < file_size; offset += block_size) {
+        TRY(read_bytes(offset, block_size, buf, nullptr));
+
+        using ext2_extended_dir_entry = ext2_dir_entry_2;
+        auto* entry = reinterpret_cast<ext2_extended_dir_entry*>(buffer);
+        auto* entries_end = reinterpret_cast<ext2_extended_dir_entry*>(buffer + block_size);
+        ext2_extended_dir_entry* previous_entry = nullptr;
+        while (entry < entries_end) {
+            if (entry->inode != 0 && name == StringView { entry->name, entry->name_len }) {
+                // Instead of rewriting the entire directory, fold the entry
+                // into its predecessor's record, or mark it unused if it's
+                // the first entry in its block. Directory traversal skips
+                // entries with inode 0, and the next full rewrite (e.g. in
+                // add_child()) re-compacts the blocks.
+                if (previous_entry)
+                    previous_entry->rec_len += entry->rec_len;
+                else
+                    entry->inode = 0;
+                TRY(write_bytes(offset, block_size, buf, nullptr));
+                return {};
+            }
+            previous_entry = entry;
+            entry = (ext2_extended_dir_entry*)((char*)entry + entry->rec_len);
+        }
+    }
+    return ENOENT;
+}
+
 ErrorOr<NonnullLockRefPtr<Inode>> Ext2FSInode::create_child(StringView name, mode_t mode, dev_t dev, UserID uid, GroupID gid)
 {
     if (Kernel::is_directory(mode))
@@ -834,10 +873,12 @@ ErrorOr<void> Ext2FSInode::add_child(Inode& child, StringView name, mode_t mode)
 
     dbgln_if(EXT2_DEBUG, "Ext2FSInode[{}]::add_child(): Adding inode {} with name '{}' and mode {:o} to directory {}", identifier(), child.index(), name, mode, index());
 
+    TRY(populate_lookup_cache());
+    if (m_lookup_cache.find(name) != m_lookup_cache.end())
+        return EEXIST;
+
     Vector<Ext2FSDirectoryEntry> entries;
     TRY(traverse_as_directory([&](auto& entry) -> ErrorOr<void> {
-        if (name == entry.name)
-            return EEXIST;
         auto entry_name = TRY(KString::try_create(entry.name));
         TRY(entries.try_append({ move(entry_name), entry.inode.index(), entry.file_type }));
         return {};
@@ -872,16 +913,10 @@ ErrorOr<void> Ext2FSInode::remove_child(StringView name)
 
     InodeIdentifier child_id { fsid(), child_inode_index };
 
-    Vector<Ext2FSDirectoryEntry> entries;
-    TRY(traverse_as_directory([&](auto& entry) -> ErrorOr<void> {
-        if (name != entry.name) {
-            auto entry_name = TRY(KString::try_create(entry.name));
-            TRY(entries.try_append({ move(entry_name), entry.inode.index(), entry.file_type }));
-        }
-        return {};
-    }));
-
-    TRY(write_directory(entries));
+    // Unlink the entry in place; this touches a single directory block
+    // instead of rewriting the whole directory.
+    TRY(remove_directory_entry(name));
+    set_metadata_dirty(true);
 
     m_lookup_cache.remove(it);
 
@@ -46,6 +46,7 @@ private:
     virtual ErrorOr<int> get_block_address(int) override;
 
     ErrorOr<void> write_directory(Vector<Ext2FSDirectoryEntry>&);
+    ErrorOr<void> remove_directory_entry(StringView name);
     ErrorOr<void> populate_lookup_cache();
     ErrorOr<void> resize(u64);
     ErrorOr<void> write_indirect_block(BlockBasedFileSystem::BlockIndex, Span<BlockBasedFileSystem::BlockIndex>);
@@ -328,6 +328,25 @@ InodeWatcher* OpenFileDescription::inode_watcher()
     return static_cast<InodeWatcher*>(m_file.ptr());
 }
 
+bool OpenFileDescription::is_event_queue() const
+{
+    return m_file->is_event_queue();
+}
+
+EventQueue const* OpenFileDescription::event_queue() const
+{
+    if (!is_event_queue())
+        return nullptr;
+    return static_cast<EventQueue const*>(m_file.ptr());
+}
+
+EventQueue* OpenFileDescription::event_queue()
+{
+    if (!is_event_queue())
+        return nullptr;
+    return static_cast<EventQueue*>(m_file.ptr());
+}
+
 bool OpenFileDescription::is_master_pty() const
 {
     return m_file->is_master_pty();
@@ -82,6 +82,10 @@ public:
     InodeWatcher const* inode_watcher() const;
     InodeWatcher* inode_watcher();
 
+    bool is_event_queue() const;
+    EventQueue const* event_queue() const;
+    EventQueue* event_queue();
+
     bool is_master_pty() const;
     MasterPTY const* master_pty() const;
     MasterPTY* master_pty();
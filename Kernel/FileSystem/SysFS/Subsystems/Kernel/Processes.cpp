@@ -6,6 +6,7 @@
 
 #include <AK/JsonObjectSerializer.h>
 #include <AK/Try.h>
+#include <Kernel/API/ProcessStatistics.h>
 #include <Kernel/FileSystem/SysFS/Subsystems/Kernel/Processes.h>
 #include <Kernel/Process.h>
 #include <Kernel/Scheduler.h>
@@ -162,4 +163,136 @@ ErrorOr<void> SysFSOverallProcesses::try_generate(KBufferBuilder& builder)
     return {};
 }
 
+UNMAP_AFTER_INIT SysFSOverallProcessesBinary::SysFSOverallProcessesBinary(SysFSDirectory const& parent_directory)
+    : SysFSGlobalInformation(parent_directory)
+{
+}
+
+UNMAP_AFTER_INIT NonnullLockRefPtr<SysFSOverallProcessesBinary> SysFSOverallProcessesBinary::must_create(SysFSDirectory const& parent_directory)
+{
+    return adopt_lock_ref_if_nonnull(new (nothrow) SysFSOverallProcessesBinary(parent_directory)).release_nonnull();
+}
+
+ErrorOr<void> SysFSOverallProcessesBinary::try_generate(KBufferBuilder& builder)
+{
+    // NOTE: The records are value-initialized before being filled in, so the
+    //       padding and the tails of the string arrays never leak kernel data.
+    auto copy_string = []<size_t buffer_size>(char (&buffer)[buffer_size], StringView string) {
+        auto length = min(string.length(), buffer_size - 1);
+        memcpy(buffer, string.characters_without_null_termination(), length);
+    };
+
+    // Keep the exported data in sync with the JSON in /sys/kernel/processes.
+    auto build_process = [&](Process const& process) -> ErrorOr<void> {
+        BinaryProcessStatistics record {};
+
+        if (process.is_user_process()) {
+            StringBuilder pledge_builder;
+
+#define __ENUMERATE_PLEDGE_PROMISE(promise)    \
+    if (process.has_promised(Pledge::promise)) \
+        TRY(pledge_builder.try_append(#promise " "sv));
+            ENUMERATE_PLEDGE_PROMISES
+#undef __ENUMERATE_PLEDGE_PROMISE
+
+            copy_string(record.pledge, pledge_builder.string_view());
+
+            switch (process.veil_state()) {
+            case VeilState::None:
+                copy_string(record.veil, "None"sv);
+                break;
+            case VeilState::Dropped:
+                copy_string(record.veil, "Dropped"sv);
+                break;
+            case VeilState::Locked:
+            case VeilState::LockedInherited:
+                // Note: We don't reveal if the locked state is either by our choice
+                // or someone else applied it.
+                copy_string(record.veil, "Locked"sv);
+                break;
+            }
+        }
+
+        record.pid = process.pid().value();
+        record.pgid = process.tty() ? process.tty()->pgid().value() : 0;
+        record.pgp = process.pgid().value();
+        record.sid = process.sid().value();
+        auto credentials = process.credentials();
+        record.uid = credentials->uid().value();
+        record.gid = credentials->gid().value();
+        record.ppid = process.ppid().value();
+        if (process.tty()) {
+            auto tty_pseudo_name = TRY(process.tty()->pseudo_name());
+            copy_string(record.tty, tty_pseudo_name->view());
+        }
+        record.nfds = process.fds().with_shared([](auto& fds) { return fds.open_count(); });
+        copy_string(record.name, process.name());
+        if (process.executable())
+            copy_string(record.executable, TRY(process.executable()->try_serialize_absolute_path())->view());
+
+        TRY(process.address_space().with([&](auto& space) -> ErrorOr<void> {
+            record.amount_virtual = space->amount_virtual();
+            record.amount_resident = space->amount_resident();
+            record.amount_dirty_private = space->amount_dirty_private();
+            record.amount_clean_inode = TRY(space->amount_clean_inode());
+            record.amount_shared = space->amount_shared();
+            record.amount_purgeable_volatile = space->amount_purgeable_volatile();
+            record.amount_purgeable_nonvolatile = space->amount_purgeable_nonvolatile();
+            return {};
+        }));
+
+        record.dumpable = process.is_dumpable();
+        record.kernel = process.is_kernel_process();
+
+        Vector<BinaryThreadStatistics> threads;
+        TRY(process.try_for_each_thread([&](Thread const& thread) -> ErrorOr<void> {
+            SpinlockLocker locker(thread.get_lock());
+            BinaryThreadStatistics thread_record {};
+            thread_record.tid = thread.tid().value();
+            copy_string(thread_record.name, thread.name());
+            thread_record.times_scheduled = thread.times_scheduled();
+            thread_record.time_user = thread.time_in_user();
+            thread_record.time_kernel = thread.time_in_kernel();
+            copy_string(thread_record.state, thread.state_string());
+            thread_record.cpu = thread.cpu();
+            thread_record.priority = thread.priority();
+            thread_record.syscall_count = thread.syscall_count();
+            thread_record.inode_faults = thread.inode_faults();
+            thread_record.zero_faults = thread.zero_faults();
+            thread_record.cow_faults = thread.cow_faults();
+            thread_record.file_read_bytes = thread.file_read_bytes();
+            thread_record.file_write_bytes = thread.file_write_bytes();
+            thread_record.unix_socket_read_bytes = thread.unix_socket_read_bytes();
+            thread_record.unix_socket_write_bytes = thread.unix_socket_write_bytes();
+            thread_record.ipv4_socket_read_bytes = thread.ipv4_socket_read_bytes();
+            thread_record.ipv4_socket_write_bytes = thread.ipv4_socket_write_bytes();
+            TRY(threads.try_append(thread_record));
+            return {};
+        }));
+
+        record.thread_count = threads.size();
+        record.change_sequence = process.statistics_sequence();
+        TRY(builder.append_bytes(ReadonlyBytes { &record, sizeof(record) }));
+        for (auto const& thread_record : threads)
+            TRY(builder.append_bytes(ReadonlyBytes { &thread_record, sizeof(thread_record) }));
+        return {};
+    };
+
+    auto total_time_scheduled = Scheduler::get_total_time_scheduled();
+    ProcessStatisticsHeader header {};
+    header.magic = process_statistics_magic;
+    header.version = process_statistics_version;
+    header.total_time_scheduled = total_time_scheduled.total;
+    header.total_time_scheduled_kernel = total_time_scheduled.total_kernel;
+    TRY(builder.append_bytes(ReadonlyBytes { &header, sizeof(header) }));
+
+    // FIXME: Do we actually want to expose the colonel process in a Jail environment?
+    TRY(build_process(*Scheduler::colonel()));
+    TRY(Process::for_each_in_same_jail([&](Process& process) -> ErrorOr<void> {
+        TRY(build_process(process));
+        return {};
+    }));
+    return {};
+}
+
 }
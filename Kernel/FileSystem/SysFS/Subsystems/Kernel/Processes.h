@@ -27,4 +27,20 @@ private:
     virtual bool is_readable_by_jailed_processes() const override { return true; }
 };
 
+// Same data as /sys/kernel/processes, but in the fixed binary layout from
+// Kernel/API/ProcessStatistics.h, so periodic consumers don't have to pay for
+// JSON serialization and parsing every refresh.
+class SysFSOverallProcessesBinary final : public SysFSGlobalInformation {
+public:
+    virtual StringView name() const override { return "processes_binary"sv; }
+
+    static NonnullLockRefPtr<SysFSOverallProcessesBinary> must_create(SysFSDirectory const& parent_directory);
+
+private:
+    explicit SysFSOverallProcessesBinary(SysFSDirectory const& parent_directory);
+    virtual ErrorOr<void> try_generate(KBufferBuilder& builder) override;
+
+    virtual bool is_readable_by_jailed_processes() const override { return true; }
+};
+
 }
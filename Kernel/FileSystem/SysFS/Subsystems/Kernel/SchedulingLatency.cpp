@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonObjectSerializer.h>
+#include <Kernel/FileSystem/SysFS/Subsystems/Kernel/SchedulingLatency.h>
+#include <Kernel/Sections.h>
+#include <Kernel/Thread.h>
+
+namespace Kernel {
+
+UNMAP_AFTER_INIT SysFSSchedulingLatency::SysFSSchedulingLatency(SysFSDirectory const& parent_directory)
+    : SysFSGlobalInformation(parent_directory)
+{
+}
+
+UNMAP_AFTER_INIT NonnullLockRefPtr<SysFSSchedulingLatency> SysFSSchedulingLatency::must_create(SysFSDirectory const& parent_directory)
+{
+    return adopt_lock_ref_if_nonnull(new (nothrow) SysFSSchedulingLatency(parent_directory)).release_nonnull();
+}
+
+ErrorOr<void> SysFSSchedulingLatency::try_generate(KBufferBuilder& builder)
+{
+    // One object per thread; bucket i counts waits of [2^(i-1), 2^i) microseconds
+    // in the run queue, with sub-microsecond waits in bucket 0 and everything
+    // else in the last bucket. The counters are sampled without taking the
+    // scheduler lock, so a reader may see a histogram that is mid-update.
+    auto array = TRY(JsonArraySerializer<>::try_create(builder));
+    ErrorOr<void> result;
+    Thread::for_each([&](Thread& thread) {
+        result = ([&]() -> ErrorOr<void> {
+            auto obj = TRY(array.add_object());
+            TRY(obj.add("pid"sv, thread.pid().value()));
+            TRY(obj.add("tid"sv, thread.tid().value()));
+            auto buckets = TRY(obj.add_array("buckets"sv));
+            for (auto count : thread.scheduling_latency_buckets())
+                TRY(buckets.add(count));
+            TRY(buckets.finish());
+            TRY(obj.finish());
+            return {};
+        })();
+        return result.is_error() ? IterationDecision::Break : IterationDecision::Continue;
+    });
+    TRY(result);
+    TRY(array.finish());
+    return {};
+}
+
+}
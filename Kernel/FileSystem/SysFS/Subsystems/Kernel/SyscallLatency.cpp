@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonObjectSerializer.h>
+#include <Kernel/API/SyscallString.h>
+#include <Kernel/FileSystem/SysFS/Subsystems/Kernel/SyscallLatency.h>
+#include <Kernel/Sections.h>
+#include <Kernel/SyscallLatency.h>
+
+namespace Kernel {
+
+UNMAP_AFTER_INIT SysFSSyscallLatency::SysFSSyscallLatency(SysFSDirectory const& parent_directory)
+    : SysFSGlobalInformation(parent_directory)
+{
+}
+
+UNMAP_AFTER_INIT NonnullLockRefPtr<SysFSSyscallLatency> SysFSSyscallLatency::must_create(SysFSDirectory const& parent_directory)
+{
+    return adopt_lock_ref_if_nonnull(new (nothrow) SysFSSyscallLatency(parent_directory)).release_nonnull();
+}
+
+ErrorOr<void> SysFSSyscallLatency::try_generate(KBufferBuilder& builder)
+{
+    // One object per syscall that has been sampled at least once; bucket i
+    // counts syscalls that took [2^(i-1), 2^i) microseconds, with
+    // sub-microsecond calls in bucket 0 and everything else in the last
+    // bucket. The counters are sampled without synchronizing with the
+    // syscall path, so a reader may see a histogram that is mid-update.
+    auto array = TRY(JsonArraySerializer<>::try_create(builder));
+    for (size_t function = 0; function < Syscall::Function::__Count; ++function) {
+        u64 buckets[SyscallLatency::bucket_count];
+        u64 total_sample_count = 0;
+        for (size_t bucket = 0; bucket < SyscallLatency::bucket_count; ++bucket) {
+            buckets[bucket] = SyscallLatency::bucket_value(static_cast<Syscall::Function>(function), bucket);
+            total_sample_count += buckets[bucket];
+        }
+        if (total_sample_count == 0)
+            continue;
+        auto obj = TRY(array.add_object());
+        TRY(obj.add("syscall"sv, Syscall::to_string(static_cast<Syscall::Function>(function))));
+        TRY(obj.add("count"sv, total_sample_count));
+        auto bucket_array = TRY(obj.add_array("buckets"sv));
+        for (auto count : buckets)
+            TRY(bucket_array.add(count));
+        TRY(bucket_array.finish());
+        TRY(obj.finish());
+    }
+    TRY(array.finish());
+    return {};
+}
+
+}
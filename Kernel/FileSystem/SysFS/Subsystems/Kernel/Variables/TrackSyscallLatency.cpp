@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <Kernel/FileSystem/SysFS/Subsystems/Kernel/Variables/TrackSyscallLatency.h>
+#include <Kernel/Sections.h>
+#include <Kernel/SyscallLatency.h>
+
+namespace Kernel {
+
+UNMAP_AFTER_INIT SysFSTrackSyscallLatency::SysFSTrackSyscallLatency(SysFSDirectory const& parent_directory)
+    : SysFSSystemBooleanVariable(parent_directory)
+{
+}
+
+UNMAP_AFTER_INIT NonnullLockRefPtr<SysFSTrackSyscallLatency> SysFSTrackSyscallLatency::must_create(SysFSDirectory const& parent_directory)
+{
+    return adopt_lock_ref_if_nonnull(new (nothrow) SysFSTrackSyscallLatency(parent_directory)).release_nonnull();
+}
+
+bool SysFSTrackSyscallLatency::value() const
+{
+    return SyscallLatency::is_tracking_enabled();
+}
+void SysFSTrackSyscallLatency::set_value(bool new_value)
+{
+    SyscallLatency::set_tracking_enabled(new_value);
+}
+
+}
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+#include <Kernel/FileSystem/SysFS/Subsystems/Kernel/Variables/BooleanVariable.h>
+#include <Kernel/Library/LockRefPtr.h>
+#include <Kernel/UserOrKernelBuffer.h>
+
+namespace Kernel {
+
+class SysFSTrackSyscallLatency final : public SysFSSystemBooleanVariable {
+public:
+    virtual StringView name() const override { return "track_syscall_latency"sv; }
+    static NonnullLockRefPtr<SysFSTrackSyscallLatency> must_create(SysFSDirectory const&);
+
+private:
+    virtual bool value() const override;
+    virtual void set_value(bool new_value) override;
+
+    explicit SysFSTrackSyscallLatency(SysFSDirectory const&);
+};
+
+}
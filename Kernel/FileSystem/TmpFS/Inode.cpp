@@ -130,7 +130,8 @@ ErrorOr<size_t> TmpFSInode::read_bytes_from_content_space(size_t offset, size_t
     if (static_cast<size_t>(m_metadata.size) < offset)
         return 0;
     auto mapping_region = TRY(MM.allocate_kernel_region(DataBlock::block_size, "TmpFSInode Mapping Region"sv, Memory::Region::Access::Read, AllocationStrategy::Reserve));
-    return const_cast<TmpFSInode&>(*this).do_io_on_content_space(*mapping_region, offset, io_size, buffer, false);
+    Optional<size_t> mapped_block_index;
+    return const_cast<TmpFSInode&>(*this).do_io_on_content_space(*mapping_region, mapped_block_index, offset, io_size, buffer, false);
 }
 
 ErrorOr<size_t> TmpFSInode::read_bytes_locked(off_t offset, size_t size, UserOrKernelBuffer& buffer, OpenFileDescription*) const
@@ -140,11 +141,35 @@ ErrorOr<size_t> TmpFSInode::read_bytes_locked(off_t offset, size_t size, UserOrK
     return read_bytes_from_content_space(offset, size, buffer);
 }
 
+ErrorOr<Memory::Region*> TmpFSInode::ensure_content_mapping_region(size_t block_index)
+{
+    VERIFY(m_inode_lock.is_locked());
+    if (!m_content_mapping_region) {
+        m_content_mapping_region = TRY(MM.allocate_kernel_region(DataBlock::block_size, "TmpFSInode Mapping Region"sv, Memory::Region::Access::Write, AllocationStrategy::Reserve));
+        m_mapped_block_index = {};
+    }
+    if (m_mapped_block_index != block_index) {
+        VERIFY(m_blocks[block_index]);
+        NonnullLockRefPtr<Memory::AnonymousVMObject> block_vmobject = m_blocks[block_index]->vmobject();
+        m_content_mapping_region->set_vmobject(block_vmobject);
+        m_content_mapping_region->remap();
+        m_mapped_block_index = block_index;
+    }
+    return m_content_mapping_region.ptr();
+}
+
 ErrorOr<size_t> TmpFSInode::write_bytes_to_content_space(size_t offset, size_t io_size, UserOrKernelBuffer const& buffer)
 {
     VERIFY(m_inode_lock.is_locked());
-    auto mapping_region = TRY(MM.allocate_kernel_region(DataBlock::block_size, "TmpFSInode Mapping Region"sv, Memory::Region::Access::Write, AllocationStrategy::Reserve));
-    return do_io_on_content_space(*mapping_region, offset, io_size, const_cast<UserOrKernelBuffer&>(buffer), true);
+    // Reuse one persistent mapping region for writes instead of allocating
+    // (and tearing down) a fresh kernel region on every call. Sequential
+    // appends also keep hitting the same data block, so the vmobject usually
+    // stays mapped between calls as well.
+    if (!m_content_mapping_region) {
+        m_content_mapping_region = TRY(MM.allocate_kernel_region(DataBlock::block_size, "TmpFSInode Mapping Region"sv, Memory::Region::Access::Write, AllocationStrategy::Reserve));
+        m_mapped_block_index = {};
+    }
+    return do_io_on_content_space(*m_content_mapping_region, m_mapped_block_index, offset, io_size, const_cast<UserOrKernelBuffer&>(buffer), true);
 }
 
 ErrorOr<size_t> TmpFSInode::write_bytes_locked(off_t offset, size_t size, UserOrKernelBuffer const& buffer, OpenFileDescription*)
@@ -169,7 +194,7 @@ ErrorOr<size_t> TmpFSInode::write_bytes_locked(off_t offset, size_t size, UserOr
     return nwritten;
 }
 
-ErrorOr<size_t> TmpFSInode::do_io_on_content_space(Memory::Region& mapping_region, size_t offset, size_t io_size, UserOrKernelBuffer& buffer, bool write)
+ErrorOr<size_t> TmpFSInode::do_io_on_content_space(Memory::Region& mapping_region, Optional<size_t>& mapped_block_index, size_t offset, size_t io_size, UserOrKernelBuffer& buffer, bool write)
 {
     VERIFY(m_inode_lock.is_locked());
     size_t remaining_bytes = 0;
@@ -208,9 +233,12 @@ ErrorOr<size_t> TmpFSInode::do_io_on_content_space(Memory::Region& mapping_regio
             return Error::from_errno(EIO);
         }
 
-        NonnullLockRefPtr<Memory::AnonymousVMObject> block_vmobject = block->vmobject();
-        mapping_region.set_vmobject(block_vmobject);
-        mapping_region.remap();
+        if (mapped_block_index != block_index) {
+            NonnullLockRefPtr<Memory::AnonymousVMObject> block_vmobject = block->vmobject();
+            mapping_region.set_vmobject(block_vmobject);
+            mapping_region.remap();
+            mapped_block_index = block_index;
+        }
         if (write)
             TRY(current_buffer.read(mapping_region.vaddr().offset(offset_in_block).as_ptr(), 0, current_io_size));
         else
@@ -231,6 +259,8 @@ ErrorOr<void> TmpFSInode::truncate_to_block_index(size_t block_index)
 {
     VERIFY(m_inode_lock.is_locked());
     TRY(m_blocks.try_resize(block_index));
+    // The cached mapping might refer to a block that was just freed.
+    m_mapped_block_index = {};
     return {};
 }
 
@@ -369,11 +399,7 @@ ErrorOr<void> TmpFSInode::truncate(u64 size)
 
     u64 last_possible_block_index = size / DataBlock::block_size;
     if ((size % DataBlock::block_size != 0) && m_blocks[last_possible_block_index]) {
-        auto mapping_region = TRY(MM.allocate_kernel_region(DataBlock::block_size, "TmpFSInode Mapping Region"sv, Memory::Region::Access::Write, AllocationStrategy::Reserve));
-        VERIFY(m_blocks[last_possible_block_index]);
-        NonnullLockRefPtr<Memory::AnonymousVMObject> block_vmobject = m_blocks[last_possible_block_index]->vmobject();
-        mapping_region->set_vmobject(block_vmobject);
-        mapping_region->remap();
+        auto* mapping_region = TRY(ensure_content_mapping_region(last_possible_block_index));
         memset(mapping_region->vaddr().offset(size % DataBlock::block_size).as_ptr(), 0, DataBlock::block_size - (size % DataBlock::block_size));
     }
     m_metadata.size = size;
@@ -46,7 +46,8 @@ private:
     virtual ErrorOr<size_t> read_bytes_locked(off_t, size_t, UserOrKernelBuffer& buffer, OpenFileDescription*) const override;
     virtual ErrorOr<size_t> write_bytes_locked(off_t, size_t, UserOrKernelBuffer const& buffer, OpenFileDescription*) override;
 
-    ErrorOr<size_t> do_io_on_content_space(Memory::Region& mapping_region, size_t offset, size_t io_size, UserOrKernelBuffer& buffer, bool write);
+    ErrorOr<size_t> do_io_on_content_space(Memory::Region& mapping_region, Optional<size_t>& mapped_block_index, size_t offset, size_t io_size, UserOrKernelBuffer& buffer, bool write);
+    ErrorOr<Memory::Region*> ensure_content_mapping_region(size_t block_index);
 
     struct Child {
         NonnullOwnPtr<KString> name;
@@ -89,6 +90,13 @@ private:
 
     DataBlock::List m_blocks;
     Child::List m_children;
+
+    // Persistent mapping region for writes (and truncation), so appending
+    // doesn't allocate and tear down a kernel region on every call. Only
+    // accessed with the inode lock held exclusively; reads use a region of
+    // their own since they only take the lock in shared mode.
+    OwnPtr<Memory::Region> m_content_mapping_region;
+    Optional<size_t> m_mapped_block_index;
 };
 
 }
@@ -885,13 +885,30 @@ NonnullRefPtr<Custody> VirtualFileSystem::root_custody()
     return m_root_custody.with([](auto& root_custody) -> NonnullRefPtr<Custody> { return *root_custody; });
 }
 
-UnveilNode const& VirtualFileSystem::find_matching_unveiled_path(StringView path)
+UnveilAccess VirtualFileSystem::find_matching_unveiled_path_permissions(StringView path)
 {
     auto& current_process = Process::current();
     VERIFY(current_process.veil_state() != VeilState::None);
-    return current_process.unveil_data().with([&](auto const& unveil_data) -> UnveilNode const& {
+    return current_process.unveil_data().with([&](auto& unveil_data) -> UnveilAccess {
+        for (auto& entry : unveil_data.permissions_cache) {
+            if (entry.path && entry.path->view() == path)
+                return entry.permissions;
+        }
+
         auto path_parts = KLexicalPath::parts(path);
-        return unveil_data.paths.traverse_until_last_accessible_node(path_parts.begin(), path_parts.end());
+        auto& node = unveil_data.paths.traverse_until_last_accessible_node(path_parts.begin(), path_parts.end());
+        auto permissions = node.permissions();
+
+        // Remember the result for subsequent syscalls on the same path; if
+        // there's no memory for the copy, just skip caching.
+        auto path_copy_or_error = KString::try_create(path);
+        if (!path_copy_or_error.is_error()) {
+            auto& entry = unveil_data.permissions_cache[unveil_data.permissions_cache_cursor];
+            unveil_data.permissions_cache_cursor = (unveil_data.permissions_cache_cursor + 1) % array_size(unveil_data.permissions_cache);
+            entry.path = path_copy_or_error.release_value();
+            entry.permissions = permissions;
+        }
+        return permissions;
     });
 }
 
@@ -919,22 +936,22 @@ ErrorOr<void> VirtualFileSystem::validate_path_against_process_veil(StringView p
         return {};
 #endif
 
-    auto& unveiled_path = find_matching_unveiled_path(path);
-    if (unveiled_path.permissions() == UnveilAccess::None) {
+    auto unveiled_permissions = find_matching_unveiled_path_permissions(path);
+    if (unveiled_permissions == UnveilAccess::None) {
         dbgln("Rejecting path '{}' since it hasn't been unveiled.", path);
         dump_backtrace();
         return ENOENT;
     }
 
     if (options & O_CREAT) {
-        if (!(unveiled_path.permissions() & UnveilAccess::CreateOrRemove)) {
+        if (!(unveiled_permissions & UnveilAccess::CreateOrRemove)) {
             dbgln("Rejecting path '{}' since it hasn't been unveiled with 'c' permission.", path);
             dump_backtrace();
             return EACCES;
         }
     }
     if (options & O_UNLINK_INTERNAL) {
-        if (!(unveiled_path.permissions() & UnveilAccess::CreateOrRemove)) {
+        if (!(unveiled_permissions & UnveilAccess::CreateOrRemove)) {
             dbgln("Rejecting path '{}' for unlink since it hasn't been unveiled with 'c' permission.", path);
             dump_backtrace();
             return EACCES;
@@ -943,13 +960,13 @@ ErrorOr<void> VirtualFileSystem::validate_path_against_process_veil(StringView p
     }
     if (options & O_RDONLY) {
         if (options & O_DIRECTORY) {
-            if (!(unveiled_path.permissions() & (UnveilAccess::Read | UnveilAccess::Browse))) {
+            if (!(unveiled_permissions & (UnveilAccess::Read | UnveilAccess::Browse))) {
                 dbgln("Rejecting path '{}' since it hasn't been unveiled with 'r' or 'b' permissions.", path);
                 dump_backtrace();
                 return EACCES;
             }
         } else {
-            if (!(unveiled_path.permissions() & UnveilAccess::Read)) {
+            if (!(unveiled_permissions & UnveilAccess::Read)) {
                 dbgln("Rejecting path '{}' since it hasn't been unveiled with 'r' permission.", path);
                 dump_backtrace();
                 return EACCES;
@@ -957,14 +974,14 @@ ErrorOr<void> VirtualFileSystem::validate_path_against_process_veil(StringView p
         }
     }
     if (options & O_WRONLY) {
-        if (!(unveiled_path.permissions() & UnveilAccess::Write)) {
+        if (!(unveiled_permissions & UnveilAccess::Write)) {
             dbgln("Rejecting path '{}' since it hasn't been unveiled with 'w' permission.", path);
             dump_backtrace();
             return EACCES;
         }
     }
     if (options & O_EXEC) {
-        if (!(unveiled_path.permissions() & UnveilAccess::Execute)) {
+        if (!(unveiled_permissions & UnveilAccess::Execute)) {
             dbgln("Rejecting path '{}' since it hasn't been unveiled with 'x' permission.", path);
             dump_backtrace();
             return EACCES;
@@ -97,7 +97,7 @@ public:
 private:
     friend class OpenFileDescription;
 
-    UnveilNode const& find_matching_unveiled_path(StringView path);
+    UnveilAccess find_matching_unveiled_path_permissions(StringView path);
     ErrorOr<void> validate_path_against_process_veil(Custody const& path, int options);
     ErrorOr<void> validate_path_against_process_veil(StringView path, int options);
 
@@ -26,6 +26,7 @@ class DisplayConnector;
 class FileSystem;
 class FutexQueue;
 class IPv4Socket;
+class EventQueue;
 class Inode;
 class InodeIdentifier;
 class InodeWatcher;
@@ -6,6 +6,7 @@
 
 #include <Kernel/Debug.h>
 #include <Kernel/FutexQueue.h>
+#include <Kernel/Scheduler.h>
 #include <Kernel/Thread.h>
 
 namespace Kernel {
@@ -38,19 +39,26 @@ ErrorOr<u32> FutexQueue::wake_n_requeue(u32 wake_count, Function<ErrorOr<FutexQu
     dbgln_if(FUTEXQUEUE_DEBUG, "FutexQueue @ {}: wake_n_requeue({}, {})", this, wake_count, requeue_count);
 
     u32 did_wake = 0, did_requeue = 0;
-    unblock_all_blockers_whose_conditions_are_met_locked([&](Thread::Blocker& b, void*, bool& stop_iterating) {
-        VERIFY(b.blocker_type() == Thread::Blocker::Type::Futex);
-        auto& blocker = static_cast<Thread::FutexBlocker&>(b);
-
-        dbgln_if(FUTEXQUEUE_DEBUG, "FutexQueue @ {}: wake_n_requeue unblocking {}", this, blocker.thread());
-        VERIFY(did_wake < wake_count);
-        if (blocker.unblock()) {
-            if (++did_wake >= wake_count)
-                stop_iterating = true;
-            return true;
-        }
-        return false;
-    });
+    {
+        // Hold the scheduler lock across the whole batch so that each
+        // thread's unblock only re-enters the already-held (recursive) lock
+        // instead of performing its own global acquisition. It must be
+        // released again before we touch the target queue's lock below.
+        SpinlockLocker scheduler_lock(g_scheduler_lock);
+        unblock_all_blockers_whose_conditions_are_met_locked([&](Thread::Blocker& b, void*, bool& stop_iterating) {
+            VERIFY(b.blocker_type() == Thread::Blocker::Type::Futex);
+            auto& blocker = static_cast<Thread::FutexBlocker&>(b);
+
+            dbgln_if(FUTEXQUEUE_DEBUG, "FutexQueue @ {}: wake_n_requeue unblocking {}", this, blocker.thread());
+            VERIFY(did_wake < wake_count);
+            if (blocker.unblock()) {
+                if (++did_wake >= wake_count)
+                    stop_iterating = true;
+                return true;
+            }
+            return false;
+        });
+    }
     is_empty = is_empty_and_no_imminent_waits_locked();
     if (requeue_count > 0) {
         auto blockers_to_requeue = do_take_blockers(requeue_count);
@@ -96,6 +104,12 @@ u32 FutexQueue::wake_n(u32 wake_count, Optional<u32> const& bitset, bool& is_emp
     SpinlockLocker lock(m_lock);
     dbgln_if(FUTEXQUEUE_DEBUG, "FutexQueue @ {}: wake_n({})", this, wake_count);
     u32 did_wake = 0;
+    if (is_empty_locked()) {
+        is_empty = is_empty_and_no_imminent_waits_locked();
+        return 0;
+    }
+    // Unblock the whole batch under one scheduler lock acquisition.
+    SpinlockLocker scheduler_lock(g_scheduler_lock);
     unblock_all_blockers_whose_conditions_are_met_locked([&](Thread::Blocker& b, void*, bool& stop_iterating) {
         VERIFY(b.blocker_type() == Thread::Blocker::Type::Futex);
         auto& blocker = static_cast<Thread::FutexBlocker&>(b);
@@ -118,6 +132,12 @@ u32 FutexQueue::wake_all(bool& is_empty)
     SpinlockLocker lock(m_lock);
     dbgln_if(FUTEXQUEUE_DEBUG, "FutexQueue @ {}: wake_all", this);
     u32 did_wake = 0;
+    if (is_empty_locked()) {
+        is_empty = is_empty_and_no_imminent_waits_locked();
+        return 0;
+    }
+    // Unblock the whole batch under one scheduler lock acquisition.
+    SpinlockLocker scheduler_lock(g_scheduler_lock);
     unblock_all_blockers_whose_conditions_are_met_locked([&](Thread::Blocker& b, void*, bool&) {
         VERIFY(b.blocker_type() == Thread::Blocker::Type::Futex);
         auto& blocker = static_cast<Thread::FutexBlocker&>(b);
@@ -5,6 +5,8 @@
  */
 
 #include <AK/Assertions.h>
+#include <AK/Atomic.h>
+#include <AK/Optional.h>
 #include <AK/Types.h>
 #include <Kernel/Arch/PageDirectory.h>
 #include <Kernel/Debug.h>
@@ -206,6 +208,70 @@ private:
     KmallocSlabBlock::List m_full_blocks;
 };
 
+// NOTE: Must match the slab sizes of KmallocGlobalData::slabheaps below;
+//       kmalloc_init() verifies this.
+static constexpr size_t kmalloc_slab_size_classes[] = { 16, 32, 64, 128, 256, 512 };
+
+// Per-CPU magazines in front of the slab size classes. Recently freed slabs
+// are stashed here and handed back out under a per-CPU lock, so the hot
+// small-allocation paths usually avoid serializing on the global heap lock.
+// Magazines are bounded, so when one fills up the surplus drains back to the
+// global slabheaps, which rebalances free slabs between CPUs over time.
+struct KmallocPerCpuCache {
+    static constexpr size_t slab_capacity_per_size_class = 16;
+
+    struct Magazine {
+        Spinlock lock { LockRank::None };
+        void* slabs[slab_capacity_per_size_class];
+        size_t count { 0 };
+    };
+
+    Magazine magazines[array_size(kmalloc_slab_size_classes)];
+};
+
+static KmallocPerCpuCache s_per_cpu_caches[KERNEL_MAX_CPU_COUNT];
+
+static Optional<size_t> size_class_index_for_size(size_t size)
+{
+    for (size_t i = 0; i < array_size(kmalloc_slab_size_classes); ++i) {
+        if (size <= kmalloc_slab_size_classes[i])
+            return i;
+    }
+    return {};
+}
+
+static void* try_allocate_from_per_cpu_cache(size_t size, CallerWillInitializeMemory caller_will_initialize_memory)
+{
+    auto size_class_index = size_class_index_for_size(size);
+    if (!size_class_index.has_value())
+        return nullptr;
+    // NOTE: Migrating to another processor between reading the current
+    //       processor id and locking the magazine is harmless; the lock keeps
+    //       this correct either way, we just briefly use a sibling's magazine.
+    auto& magazine = s_per_cpu_caches[Processor::current_id()].magazines[size_class_index.value()];
+    SpinlockLocker locker(magazine.lock);
+    if (magazine.count == 0)
+        return nullptr;
+    auto* ptr = magazine.slabs[--magazine.count];
+    if (caller_will_initialize_memory == CallerWillInitializeMemory::No)
+        memset(ptr, KMALLOC_SCRUB_BYTE, kmalloc_slab_size_classes[size_class_index.value()]);
+    return ptr;
+}
+
+static bool try_deallocate_to_per_cpu_cache(void* ptr, size_t size)
+{
+    auto size_class_index = size_class_index_for_size(size);
+    if (!size_class_index.has_value())
+        return false;
+    auto& magazine = s_per_cpu_caches[Processor::current_id()].magazines[size_class_index.value()];
+    SpinlockLocker locker(magazine.lock);
+    if (magazine.count == KmallocPerCpuCache::slab_capacity_per_size_class)
+        return false;
+    memset(ptr, KFREE_SCRUB_BYTE, kmalloc_slab_size_classes[size_class_index.value()]);
+    magazine.slabs[magazine.count++] = ptr;
+    return true;
+}
+
 struct KmallocGlobalData {
     static constexpr size_t minimum_subheap_size = 1 * MiB;
 
@@ -403,8 +469,8 @@ struct KmallocGlobalData {
 READONLY_AFTER_INIT static KmallocGlobalData* g_kmalloc_global;
 alignas(KmallocGlobalData) static u8 g_kmalloc_global_heap[sizeof(KmallocGlobalData)];
 
-static size_t g_kmalloc_call_count;
-static size_t g_kfree_call_count;
+static Atomic<size_t> g_kmalloc_call_count;
+static Atomic<size_t> g_kfree_call_count;
 static size_t g_nested_kfree_calls;
 bool g_dump_kmalloc_stacks;
 
@@ -419,6 +485,9 @@ UNMAP_AFTER_INIT void kmalloc_init()
     memset(initial_kmalloc_memory, 0, sizeof(initial_kmalloc_memory));
     g_kmalloc_global = new (g_kmalloc_global_heap) KmallocGlobalData(initial_kmalloc_memory, sizeof(initial_kmalloc_memory));
 
+    for (size_t i = 0; i < array_size(kmalloc_slab_size_classes); ++i)
+        VERIFY(g_kmalloc_global->slabheaps[i].slab_size() == kmalloc_slab_size_classes[i]);
+
     s_lock.initialize();
 }
 
@@ -429,8 +498,20 @@ static void* kmalloc_impl(size_t size, CallerWillInitializeMemory caller_will_in
         Processor::verify_no_spinlocks_held();
     }
 
+    g_kmalloc_call_count.fetch_add(1, AK::memory_order_relaxed);
+
+    if (auto* ptr = try_allocate_from_per_cpu_cache(size, caller_will_initialize_memory)) {
+        Thread* current_thread = Thread::current();
+        if (!current_thread)
+            current_thread = Processor::idle_thread();
+        if (current_thread) {
+            VERIFY(current_thread->is_allocation_enabled());
+            PerformanceManager::add_kmalloc_perf_event(*current_thread, size, (FlatPtr)ptr);
+        }
+        return ptr;
+    }
+
     SpinlockLocker lock(s_lock);
-    ++g_kmalloc_call_count;
 
     if (g_dump_kmalloc_stacks && Kernel::g_kernel_symbols_available) {
         dbgln("kmalloc({})", size);
@@ -480,8 +561,20 @@ void kfree_sized(void* ptr, size_t size)
         Processor::verify_no_spinlocks_held();
     }
 
+    g_kfree_call_count.fetch_add(1, AK::memory_order_relaxed);
+
+    if (try_deallocate_to_per_cpu_cache(ptr, size)) {
+        Thread* current_thread = Thread::current();
+        if (!current_thread)
+            current_thread = Processor::idle_thread();
+        if (current_thread) {
+            VERIFY(current_thread->is_allocation_enabled());
+            PerformanceManager::add_kfree_perf_event(*current_thread, 0, (FlatPtr)ptr);
+        }
+        return;
+    }
+
     SpinlockLocker lock(s_lock);
-    ++g_kfree_call_count;
     ++g_nested_kfree_calls;
 
     if (g_nested_kfree_calls == 1) {
@@ -592,6 +685,6 @@ void get_kmalloc_stats(kmalloc_stats& stats)
     SpinlockLocker lock(s_lock);
     stats.bytes_allocated = g_kmalloc_global->allocated_bytes();
     stats.bytes_free = g_kmalloc_global->free_bytes();
-    stats.kmalloc_call_count = g_kmalloc_call_count;
-    stats.kfree_call_count = g_kfree_call_count;
+    stats.kmalloc_call_count = g_kmalloc_call_count.load(AK::memory_order_relaxed);
+    stats.kfree_call_count = g_kfree_call_count.load(AK::memory_order_relaxed);
 }
@@ -6,9 +6,50 @@
 
 #include <AK/StdLibExtras.h>
 #include <Kernel/KBufferBuilder.h>
+#include <Kernel/Locking/Spinlock.h>
 
 namespace Kernel {
 
+// Reads of /proc and /sys files create a KBufferBuilder each, so the backing
+// buffers churn constantly under periodic monitoring tools. Keep a small stash
+// of recently discarded buffers and hand those out again instead of allocating
+// (and committing) a fresh kernel region for every builder.
+static constexpr size_t initial_buffer_size = 1 * MiB;
+static constexpr size_t maximum_pooled_buffer_count = 8;
+static Spinlock s_buffer_pool_lock { LockRank::None };
+static OwnPtr<KBuffer> s_buffer_pool[maximum_pooled_buffer_count];
+
+static OwnPtr<KBuffer> take_pooled_buffer(size_t minimum_capacity)
+{
+    SpinlockLocker locker(s_buffer_pool_lock);
+    for (auto& slot : s_buffer_pool) {
+        if (slot && slot->capacity() >= minimum_capacity)
+            return move(slot);
+    }
+    return {};
+}
+
+static void return_buffer_to_pool(NonnullOwnPtr<KBuffer> buffer)
+{
+    // Don't let one giant expanded buffer sit in the pool forever.
+    if (buffer->capacity() > 4 * initial_buffer_size)
+        return;
+    SpinlockLocker locker(s_buffer_pool_lock);
+    for (auto& slot : s_buffer_pool) {
+        if (!slot) {
+            slot = move(buffer);
+            return;
+        }
+    }
+    // The pool is full; the buffer is freed once the lock is released.
+}
+
+KBufferBuilder::~KBufferBuilder()
+{
+    if (m_buffer)
+        return_buffer_to_pool(m_buffer.release_nonnull());
+}
+
 inline bool KBufferBuilder::check_expand(size_t size)
 {
     if (!m_buffer)
@@ -28,7 +69,9 @@ inline bool KBufferBuilder::check_expand(size_t size)
     if (new_buffer_or_error.is_error())
         return false;
     auto new_buffer = new_buffer_or_error.release_value();
-    memcpy(new_buffer->data(), m_buffer->data(), m_buffer->size());
+    // Only the appended part of the old buffer holds meaningful data.
+    memcpy(new_buffer->data(), m_buffer->data(), m_size);
+    return_buffer_to_pool(m_buffer.release_nonnull());
     m_buffer = move(new_buffer);
     return true;
 }
@@ -51,7 +94,11 @@ OwnPtr<KBuffer> KBufferBuilder::build()
 
 ErrorOr<KBufferBuilder> KBufferBuilder::try_create()
 {
-    auto buffer = TRY(KBuffer::try_create_with_size("KBufferBuilder"sv, 4 * MiB, Memory::Region::Access::ReadWrite));
+    if (auto pooled_buffer = take_pooled_buffer(initial_buffer_size)) {
+        pooled_buffer->set_size(pooled_buffer->capacity());
+        return KBufferBuilder { pooled_buffer.release_nonnull() };
+    }
+    auto buffer = TRY(KBuffer::try_create_with_size("KBufferBuilder"sv, initial_buffer_size, Memory::Region::Access::ReadWrite));
     return KBufferBuilder { move(buffer) };
 }
 
@@ -23,7 +23,7 @@ public:
 
     KBufferBuilder(KBufferBuilder&&) = default;
     KBufferBuilder& operator=(KBufferBuilder&&) = default;
-    ~KBufferBuilder() = default;
+    ~KBufferBuilder();
 
     ErrorOr<void> append(StringView);
     ErrorOr<void> append(char);
@@ -45,6 +45,10 @@ public:
     bool flush();
     OwnPtr<KBuffer> build();
 
+    // Forgets everything appended so far, keeping the backing buffer, so a
+    // long-lived builder can be reused instead of reallocated.
+    void clear() { m_size = 0; }
+
     ReadonlyBytes bytes() const
     {
         if (!m_buffer)
@@ -40,7 +40,7 @@ ErrorOr<NonnullOwnPtr<AddressSpace>> AddressSpace::try_create(AddressSpace const
 
 AddressSpace::AddressSpace(NonnullLockRefPtr<PageDirectory> page_directory, VirtualRange total_range)
     : m_page_directory(move(page_directory))
-    , m_region_tree(total_range)
+    , m_region_tree(total_range, CacheRegionLookups::Yes)
 {
 }
 
@@ -5,7 +5,9 @@
  */
 
 #include <Kernel/FileSystem/Inode.h>
+#include <Kernel/InterruptDisabler.h>
 #include <Kernel/Memory/InodeVMObject.h>
+#include <Kernel/Memory/MemoryManager.h>
 
 namespace Kernel::Memory {
 
@@ -48,6 +50,49 @@ size_t InodeVMObject::amount_dirty() const
     return count * PAGE_SIZE;
 }
 
+ErrorOr<void> InodeVMObject::ensure_pages_present(size_t first_page_index, size_t page_count)
+{
+    if (first_page_index >= this->page_count() || page_count > this->page_count() - first_page_index)
+        return EINVAL;
+
+    for (size_t i = 0; i < page_count; ++i) {
+        auto page_index = first_page_index + i;
+        {
+            SpinlockLocker locker(m_lock);
+            if (m_physical_pages[page_index])
+                continue;
+        }
+
+        // NOTE: This mirrors Region::handle_inode_fault(), but without a
+        //       faulting region: read the page contents into a stack buffer
+        //       first, since reading from the inode may block.
+        u8 page_buffer[PAGE_SIZE];
+        auto buffer = UserOrKernelBuffer::for_kernel_buffer(page_buffer);
+        auto nread = TRY(m_inode->read_bytes(page_index * PAGE_SIZE, PAGE_SIZE, buffer, nullptr));
+        if (nread < PAGE_SIZE) {
+            // If we read less than a page, zero out the rest to avoid leaking uninitialized data.
+            memset(page_buffer + nread, 0, PAGE_SIZE - nread);
+        }
+
+        auto new_physical_page = TRY(MM.allocate_physical_page(MemoryManager::ShouldZeroFill::No));
+        {
+            InterruptDisabler disabler;
+            u8* dest_ptr = MM.quickmap_page(*new_physical_page);
+            memcpy(dest_ptr, page_buffer, PAGE_SIZE);
+            MM.unquickmap_page();
+        }
+
+        SpinlockLocker locker(m_lock);
+        auto& page_slot = m_physical_pages[page_index];
+        // If someone else faulted in this page while we were reading from the
+        // inode, keep their copy; regions that already map it would otherwise
+        // go stale.
+        if (page_slot.is_null())
+            page_slot = move(new_physical_page);
+    }
+    return {};
+}
+
 int InodeVMObject::release_all_clean_pages()
 {
     SpinlockLocker locker(m_lock);
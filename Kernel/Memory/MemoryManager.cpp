@@ -83,7 +83,9 @@ static UNMAP_AFTER_INIT VirtualRange kernel_virtual_range()
 }
 
 MemoryManager::GlobalData::GlobalData()
-    : region_tree(kernel_virtual_range())
+    // The flat map cache would allocate while this tree's lock is held, which
+    // kmalloc expansion cannot tolerate; kernel VM lookups stay on the tree.
+    : region_tree(kernel_virtual_range(), CacheRegionLookups::No)
 {
 }
 
@@ -136,8 +138,7 @@ UNMAP_AFTER_INIT void MemoryManager::unmap_prekernel()
     auto start = start_of_prekernel_image.page_base().get();
     auto end = end_of_prekernel_image.page_base().get();
 
-    for (auto i = start; i <= end; i += PAGE_SIZE)
-        release_pte(kernel_page_directory(), VirtualAddress(i), i == end ? IsLastPTERelease::Yes : IsLastPTERelease::No);
+    release_pte_range(kernel_page_directory(), VirtualAddress(start), (end - start) / PAGE_SIZE + 1);
     flush_tlb(&kernel_page_directory(), VirtualAddress(start), (end - start) / PAGE_SIZE);
 }
 
@@ -526,7 +527,7 @@ UNMAP_AFTER_INIT void MemoryManager::initialize_physical_pages()
             auto& physical_page_entry = m_physical_page_entries[physical_page_index];
             auto physical_page = adopt_lock_ref(*new (&physical_page_entry.allocated.physical_page) PhysicalPage(MayReturnToFreeList::No));
 
-            // NOTE: This leaked ref is matched by the unref in MemoryManager::release_pte()
+            // NOTE: This leaked ref is matched by the unref in MemoryManager::release_pte_range()
             (void)physical_page.leak_ref();
 
             virtual_page_array_current_page += (PAGE_SIZE / sizeof(PageTableEntry)) * PAGE_SIZE;
@@ -602,42 +603,59 @@ PageTableEntry* MemoryManager::ensure_pte(PageDirectory& page_directory, Virtual
     pde.set_writable(true);
     pde.set_global(&page_directory == m_kernel_page_directory.ptr());
 
-    // NOTE: This leaked ref is matched by the unref in MemoryManager::release_pte()
+    // NOTE: This leaked ref is matched by the unref in MemoryManager::release_pte_range()
     (void)page_table.leak_ref();
 
     return &quickmap_pt(PhysicalAddress(pde.page_table_base()))[page_table_index];
 }
 
-void MemoryManager::release_pte(PageDirectory& page_directory, VirtualAddress vaddr, IsLastPTERelease is_last_pte_release)
+PageTableEntry* MemoryManager::ensure_pte_run(PageDirectory& page_directory, VirtualAddress vaddr, size_t page_count, size_t& run_length)
 {
-    VERIFY_INTERRUPTS_DISABLED();
-    VERIFY(page_directory.get_lock().is_locked_by_current_processor());
-    u32 page_directory_table_index = (vaddr.get() >> 30) & 0x1ff;
-    u32 page_directory_index = (vaddr.get() >> 21) & 0x1ff;
+    // The returned entries all live in the same page table, so callers can
+    // fill `run_length` consecutive PTEs without re-walking the paging
+    // structures (and re-quickmapping the page table) for every page.
     u32 page_table_index = (vaddr.get() >> 12) & 0x1ff;
+    run_length = min(page_count, static_cast<size_t>(0x200 - page_table_index));
+    return ensure_pte(page_directory, vaddr);
+}
 
-    auto* pd = quickmap_pd(page_directory, page_directory_table_index);
-    PageDirectoryEntry& pde = pd[page_directory_index];
-    if (pde.is_present()) {
-        auto* page_table = quickmap_pt(PhysicalAddress((FlatPtr)pde.page_table_base()));
-        auto& pte = page_table[page_table_index];
-        pte.clear();
+void MemoryManager::release_pte_range(PageDirectory& page_directory, VirtualAddress base_vaddr, size_t page_count)
+{
+    VERIFY_INTERRUPTS_DISABLED();
+    VERIFY(page_directory.get_lock().is_locked_by_current_processor());
 
-        if (is_last_pte_release == IsLastPTERelease::Yes || page_table_index == 0x1ff) {
-            // If this is the last PTE in a region or the last PTE in a page table then
-            // check if we can also release the page table
-            bool all_clear = true;
-            for (u32 i = 0; i <= 0x1ff; i++) {
-                if (!page_table[i].is_null()) {
-                    all_clear = false;
-                    break;
+    size_t page_index = 0;
+    while (page_index < page_count) {
+        auto vaddr = base_vaddr.offset(page_index * PAGE_SIZE);
+        u32 page_directory_table_index = (vaddr.get() >> 30) & 0x1ff;
+        u32 page_directory_index = (vaddr.get() >> 21) & 0x1ff;
+        u32 page_table_index = (vaddr.get() >> 12) & 0x1ff;
+        size_t run_length = min(page_count - page_index, static_cast<size_t>(0x200 - page_table_index));
+
+        auto* pd = quickmap_pd(page_directory, page_directory_table_index);
+        PageDirectoryEntry& pde = pd[page_directory_index];
+        if (pde.is_present()) {
+            auto* page_table = quickmap_pt(PhysicalAddress((FlatPtr)pde.page_table_base()));
+            for (size_t i = 0; i < run_length; ++i)
+                page_table[page_table_index + i].clear();
+
+            // If this run reached the end of the page table, or was the last one
+            // in the range, check if we can also release the page table.
+            if (page_table_index + run_length == 0x200 || page_index + run_length == page_count) {
+                bool all_clear = true;
+                for (u32 i = 0; i <= 0x1ff; i++) {
+                    if (!page_table[i].is_null()) {
+                        all_clear = false;
+                        break;
+                    }
+                }
+                if (all_clear) {
+                    get_physical_page_entry(PhysicalAddress { pde.page_table_base() }).allocated.physical_page.unref();
+                    pde.clear();
                 }
-            }
-            if (all_clear) {
-                get_physical_page_entry(PhysicalAddress { pde.page_table_base() }).allocated.physical_page.unref();
-                pde.clear();
             }
         }
+        page_index += run_length;
     }
 }
 
@@ -819,15 +837,16 @@ ErrorOr<NonnullOwnPtr<Region>> MemoryManager::allocate_kernel_region(PhysicalAdd
     return region;
 }
 
-ErrorOr<NonnullOwnPtr<Region>> MemoryManager::allocate_kernel_region_with_vmobject(VMObject& vmobject, size_t size, StringView name, Region::Access access, Region::Cacheable cacheable)
+ErrorOr<NonnullOwnPtr<Region>> MemoryManager::allocate_kernel_region_with_vmobject(VMObject& vmobject, size_t size, StringView name, Region::Access access, Region::Cacheable cacheable, size_t offset_in_vmobject)
 {
     VERIFY(!(size % PAGE_SIZE));
+    VERIFY(!(offset_in_vmobject % PAGE_SIZE));
 
     OwnPtr<KString> name_kstring;
     if (!name.is_null())
         name_kstring = TRY(KString::try_create(name));
 
-    auto region = TRY(Region::create_unplaced(vmobject, 0, move(name_kstring), access, cacheable));
+    auto region = TRY(Region::create_unplaced(vmobject, offset_in_vmobject, move(name_kstring), access, cacheable));
     TRY(m_global_data.with([&](auto& global_data) { return global_data.region_tree.place_anywhere(*region, RandomizeVirtualAddress::No, size); }));
     TRY(region->map(kernel_page_directory()));
     return region;
@@ -943,61 +962,101 @@ NonnullRefPtr<PhysicalPage> MemoryManager::allocate_committed_physical_page(Badg
     return page.release_nonnull();
 }
 
+void MemoryManager::refill_free_page_cache(Vector<NonnullRefPtr<PhysicalPage>, 8>& cache)
+{
+    // Grab a whole batch of uncommitted pages with a single acquisition of
+    // the global lock instead of paying for it on every allocation.
+    m_global_data.with([&](auto& global_data) {
+        while (cache.size() < 8) {
+            if (global_data.system_memory_info.physical_pages_uncommitted == 0)
+                return;
+            RefPtr<PhysicalPage> page;
+            for (auto& region : global_data.physical_regions) {
+                page = region.take_free_page();
+                if (!page.is_null())
+                    break;
+            }
+            if (page.is_null())
+                return;
+            global_data.system_memory_info.physical_pages_uncommitted--;
+            ++global_data.system_memory_info.physical_pages_used;
+            cache.unchecked_append(page.release_nonnull());
+        }
+    });
+}
+
 ErrorOr<NonnullRefPtr<PhysicalPage>> MemoryManager::allocate_physical_page(ShouldZeroFill should_zero_fill, bool* did_purge)
 {
-    return m_global_data.with([&](auto&) -> ErrorOr<NonnullRefPtr<PhysicalPage>> {
-        auto page = find_free_physical_page(false);
-        bool purged_pages = false;
-
-        if (!page) {
-            // We didn't have a single free physical page. Let's try to free something up!
-            // First, we look for a purgeable VMObject in the volatile state.
-            for_each_vmobject([&](auto& vmobject) {
-                if (!vmobject.is_anonymous())
-                    return IterationDecision::Continue;
-                auto& anonymous_vmobject = static_cast<AnonymousVMObject&>(vmobject);
-                if (!anonymous_vmobject.is_purgeable() || !anonymous_vmobject.is_volatile())
+    RefPtr<PhysicalPage> page;
+    bool purged_pages = false;
+
+    {
+        InterruptDisabler disabler;
+        auto& cache = get_data().free_page_cache;
+        if (cache.is_empty())
+            refill_free_page_cache(cache);
+        if (!cache.is_empty())
+            page = cache.take_last();
+    }
+
+    if (!page) {
+        TRY(m_global_data.with([&](auto&) -> ErrorOr<void> {
+            page = find_free_physical_page(false);
+
+            if (!page) {
+                // We didn't have a single free physical page. Let's try to free something up!
+                // First, we look for a purgeable VMObject in the volatile state.
+                for_each_vmobject([&](auto& vmobject) {
+                    if (!vmobject.is_anonymous())
+                        return IterationDecision::Continue;
+                    auto& anonymous_vmobject = static_cast<AnonymousVMObject&>(vmobject);
+                    if (!anonymous_vmobject.is_purgeable() || !anonymous_vmobject.is_volatile())
+                        return IterationDecision::Continue;
+                    if (auto purged_page_count = anonymous_vmobject.purge()) {
+                        dbgln("MM: Purge saved the day! Purged {} pages from AnonymousVMObject", purged_page_count);
+                        page = find_free_physical_page(false);
+                        purged_pages = true;
+                        VERIFY(page);
+                        return IterationDecision::Break;
+                    }
                     return IterationDecision::Continue;
-                if (auto purged_page_count = anonymous_vmobject.purge()) {
-                    dbgln("MM: Purge saved the day! Purged {} pages from AnonymousVMObject", purged_page_count);
-                    page = find_free_physical_page(false);
-                    purged_pages = true;
-                    VERIFY(page);
-                    return IterationDecision::Break;
-                }
-                return IterationDecision::Continue;
-            });
-        }
-        if (!page) {
-            // Second, we look for a file-backed VMObject with clean pages.
-            for_each_vmobject([&](auto& vmobject) {
-                if (!vmobject.is_inode())
+                });
+            }
+            if (!page) {
+                // Second, we look for a file-backed VMObject with clean pages.
+                for_each_vmobject([&](auto& vmobject) {
+                    if (!vmobject.is_inode())
+                        return IterationDecision::Continue;
+                    auto& inode_vmobject = static_cast<InodeVMObject&>(vmobject);
+                    if (auto released_page_count = inode_vmobject.try_release_clean_pages(1)) {
+                        dbgln("MM: Clean inode release saved the day! Released {} pages from InodeVMObject", released_page_count);
+                        page = find_free_physical_page(false);
+                        VERIFY(page);
+                        return IterationDecision::Break;
+                    }
                     return IterationDecision::Continue;
-                auto& inode_vmobject = static_cast<InodeVMObject&>(vmobject);
-                if (auto released_page_count = inode_vmobject.try_release_clean_pages(1)) {
-                    dbgln("MM: Clean inode release saved the day! Released {} pages from InodeVMObject", released_page_count);
-                    page = find_free_physical_page(false);
-                    VERIFY(page);
-                    return IterationDecision::Break;
-                }
-                return IterationDecision::Continue;
-            });
-        }
-        if (!page) {
-            dmesgln("MM: no physical pages available");
-            return ENOMEM;
-        }
+                });
+            }
+            if (!page) {
+                dmesgln("MM: no physical pages available");
+                return ENOMEM;
+            }
+            return {};
+        }));
+    }
 
-        if (should_zero_fill == ShouldZeroFill::Yes) {
-            auto* ptr = quickmap_page(*page);
-            memset(ptr, 0, PAGE_SIZE);
-            unquickmap_page();
-        }
+    // Zero-fill after dropping the global lock; other CPUs are free to
+    // allocate in the meantime.
+    if (should_zero_fill == ShouldZeroFill::Yes) {
+        InterruptDisabler disabler;
+        auto* ptr = quickmap_page(*page);
+        memset(ptr, 0, PAGE_SIZE);
+        unquickmap_page();
+    }
 
-        if (did_purge)
-            *did_purge = purged_pages;
-        return page.release_nonnull();
-    });
+    if (did_purge)
+        *did_purge = purged_pages;
+    return page.release_nonnull();
 }
 
 ErrorOr<NonnullRefPtrVector<PhysicalPage>> MemoryManager::allocate_contiguous_physical_pages(size_t size)
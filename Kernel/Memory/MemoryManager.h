@@ -91,6 +91,12 @@ struct MemoryManagerData {
 
     Spinlock m_quickmap_in_use { LockRank::None };
     InterruptsState m_quickmap_previous_interrupts_state;
+
+    // Small cache of free (uncommitted) physical pages, refilled in bulk so
+    // that most single-page allocations don't have to take the global MM
+    // lock. Only ever accessed with interrupts disabled. The inline capacity
+    // matches the refill batch size, so the cache never allocates.
+    Vector<NonnullRefPtr<PhysicalPage>, 8> free_page_cache;
 };
 
 // This class represents a set of committed physical pages.
@@ -128,6 +134,7 @@ private:
 class MemoryManager {
     friend class PageDirectory;
     friend class AnonymousVMObject;
+    friend class InodeVMObject;
     friend class Region;
     friend class RegionTree;
     friend class VMObject;
@@ -178,7 +185,7 @@ public:
     ErrorOr<NonnullOwnPtr<Memory::Region>> allocate_dma_buffer_pages(size_t size, StringView name, Memory::Region::Access access);
     ErrorOr<NonnullOwnPtr<Region>> allocate_kernel_region(size_t, StringView name, Region::Access access, AllocationStrategy strategy = AllocationStrategy::Reserve, Region::Cacheable = Region::Cacheable::Yes);
     ErrorOr<NonnullOwnPtr<Region>> allocate_kernel_region(PhysicalAddress, size_t, StringView name, Region::Access access, Region::Cacheable = Region::Cacheable::Yes);
-    ErrorOr<NonnullOwnPtr<Region>> allocate_kernel_region_with_vmobject(VMObject&, size_t, StringView name, Region::Access access, Region::Cacheable = Region::Cacheable::Yes);
+    ErrorOr<NonnullOwnPtr<Region>> allocate_kernel_region_with_vmobject(VMObject&, size_t, StringView name, Region::Access access, Region::Cacheable = Region::Cacheable::Yes, size_t offset_in_vmobject = 0);
     ErrorOr<NonnullOwnPtr<Region>> allocate_unbacked_region_anywhere(size_t size, size_t alignment);
     ErrorOr<NonnullOwnPtr<Region>> create_identity_mapped_region(PhysicalAddress, size_t);
 
@@ -258,6 +265,7 @@ private:
     static Region* find_region_from_vaddr(VirtualAddress);
 
     RefPtr<PhysicalPage> find_free_physical_page(bool);
+    void refill_free_page_cache(Vector<NonnullRefPtr<PhysicalPage>, 8>&);
 
     ALWAYS_INLINE u8* quickmap_page(PhysicalPage& page)
     {
@@ -271,11 +279,8 @@ private:
 
     PageTableEntry* pte(PageDirectory&, VirtualAddress);
     PageTableEntry* ensure_pte(PageDirectory&, VirtualAddress);
-    enum class IsLastPTERelease {
-        Yes,
-        No
-    };
-    void release_pte(PageDirectory&, VirtualAddress, IsLastPTERelease);
+    PageTableEntry* ensure_pte_run(PageDirectory&, VirtualAddress, size_t page_count, size_t& run_length);
+    void release_pte_range(PageDirectory&, VirtualAddress, size_t page_count);
 
     // NOTE: These are outside of GlobalData as they are only assigned on startup,
     //       and then never change. Atomic ref-counting covers that case without
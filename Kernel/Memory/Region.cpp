@@ -202,7 +202,7 @@ ErrorOr<void> Region::set_should_cow(size_t page_index, bool cow)
     return {};
 }
 
-bool Region::map_individual_page_impl(size_t page_index, RefPtr<PhysicalPage> page)
+void Region::map_individual_page_impl(size_t page_index, PageTableEntry& pte, RefPtr<PhysicalPage> page)
 {
     VERIFY(m_page_directory->get_lock().is_locked_by_current_processor());
 
@@ -213,40 +213,40 @@ bool Region::map_individual_page_impl(size_t page_index, RefPtr<PhysicalPage> pa
         PANIC("About to map mmap'ed page at a kernel address");
     }
 
-    auto* pte = MM.ensure_pte(*m_page_directory, page_vaddr);
-    if (!pte)
-        return false;
-
     if (!page || (!is_readable() && !is_writable())) {
-        pte->clear();
-        return true;
+        pte.clear();
+        return;
     }
 
-    pte->set_cache_disabled(!m_cacheable);
-    pte->set_physical_page_base(page->paddr().get());
-    pte->set_present(true);
+    pte.set_cache_disabled(!m_cacheable);
+    pte.set_physical_page_base(page->paddr().get());
+    pte.set_present(true);
     if (page->is_shared_zero_page() || page->is_lazy_committed_page() || should_cow(page_index))
-        pte->set_writable(false);
+        pte.set_writable(false);
+    else if (m_shared && vmobject().is_inode() && !static_cast<InodeVMObject&>(vmobject()).is_page_dirty(translate_to_vmobject_page(page_index)))
+        // Shared inode-backed pages start out write-protected, so the first
+        // write faults and marks the page dirty for writeback (see
+        // handle_dirty_fault() below).
+        pte.set_writable(false);
     else
-        pte->set_writable(is_writable());
+        pte.set_writable(is_writable());
     if (Processor::current().has_nx())
-        pte->set_execute_disabled(!is_executable());
+        pte.set_execute_disabled(!is_executable());
     if (Processor::current().has_pat())
-        pte->set_pat(is_write_combine());
-    pte->set_user_allowed(user_allowed);
-
-    return true;
+        pte.set_pat(is_write_combine());
+    pte.set_user_allowed(user_allowed);
 }
 
-bool Region::map_individual_page_impl(size_t page_index)
+bool Region::map_individual_page_impl(size_t page_index, RefPtr<PhysicalPage> page)
 {
-    RefPtr<PhysicalPage> page;
-    {
-        SpinlockLocker vmobject_locker(vmobject().m_lock);
-        page = physical_page(page_index);
-    }
+    VERIFY(m_page_directory->get_lock().is_locked_by_current_processor());
+
+    auto* pte = MM.ensure_pte(*m_page_directory, vaddr_from_page_index(page_index));
+    if (!pte)
+        return false;
 
-    return map_individual_page_impl(page_index, page);
+    map_individual_page_impl(page_index, *pte, move(page));
+    return true;
 }
 
 bool Region::remap_vmobject_page(size_t page_index, NonnullRefPtr<PhysicalPage> physical_page)
@@ -274,11 +274,7 @@ void Region::unmap_with_locks_held(ShouldFlushTLB should_flush_tlb, SpinlockLock
 {
     if (!m_page_directory)
         return;
-    size_t count = page_count();
-    for (size_t i = 0; i < count; ++i) {
-        auto vaddr = vaddr_from_page_index(i);
-        MM.release_pte(*m_page_directory, vaddr, i == count - 1 ? MemoryManager::IsLastPTERelease::Yes : MemoryManager::IsLastPTERelease::No);
-    }
+    MM.release_pte_range(*m_page_directory, vaddr(), page_count());
     if (should_flush_tlb == ShouldFlushTLB::Yes)
         MemoryManager::flush_tlb(m_page_directory, vaddr(), page_count());
     m_page_directory = nullptr;
@@ -302,9 +298,20 @@ ErrorOr<void> Region::map(PageDirectory& page_directory, ShouldFlushTLB should_f
     set_page_directory(page_directory);
     size_t page_index = 0;
     while (page_index < page_count()) {
-        if (!map_individual_page_impl(page_index))
+        size_t run_length = 0;
+        auto* pte = MM.ensure_pte_run(page_directory, vaddr_from_page_index(page_index), page_count() - page_index, run_length);
+        if (!pte)
             break;
-        ++page_index;
+        // All entries of a run share one page table, so we can fill them
+        // without re-walking the paging structures for every page.
+        for (size_t i = 0; i < run_length; ++i, ++page_index) {
+            RefPtr<PhysicalPage> page;
+            {
+                SpinlockLocker vmobject_locker(vmobject().m_lock);
+                page = physical_page(page_index);
+            }
+            map_individual_page_impl(page_index, pte[i], move(page));
+        }
     }
     if (page_index > 0) {
         if (should_flush_tlb == ShouldFlushTLB::Yes)
@@ -385,6 +392,10 @@ PageFaultResponse Region::handle_fault(PageFault const& fault)
         return PageFaultResponse::ShouldCrash;
     }
     VERIFY(fault.type() == PageFault::Type::ProtectionViolation);
+    if (fault.access() == PageFault::Access::Write && is_writable() && m_shared && vmobject().is_inode()) {
+        dbgln_if(PAGE_FAULT_DEBUG, "PV(dirty) fault in Region({})[{}] at {}", this, page_index_in_region, fault.vaddr());
+        return handle_dirty_fault(page_index_in_region);
+    }
     if (fault.access() == PageFault::Access::Write && is_writable() && should_cow(page_index_in_region)) {
         dbgln_if(PAGE_FAULT_DEBUG, "PV(cow) fault in Region({})[{}] at {}", this, page_index_in_region, fault.vaddr());
         auto phys_page = physical_page(page_index_in_region);
@@ -398,6 +409,24 @@ PageFaultResponse Region::handle_fault(PageFault const& fault)
     return PageFaultResponse::ShouldCrash;
 }
 
+PageFaultResponse Region::handle_dirty_fault(size_t page_index_in_region)
+{
+    // A write to a clean page of a shared inode mapping: mark the page dirty
+    // so writeback knows about it, then remap the page writable.
+    VERIFY(vmobject().is_inode());
+    auto& inode_vmobject = static_cast<InodeVMObject&>(vmobject());
+    auto page_index_in_vmobject = translate_to_vmobject_page(page_index_in_region);
+    {
+        SpinlockLocker locker(inode_vmobject.m_lock);
+        inode_vmobject.set_page_dirty(page_index_in_vmobject, true);
+    }
+    auto phys_page = physical_page(page_index_in_region);
+    VERIFY(phys_page);
+    if (!remap_vmobject_page(page_index_in_vmobject, *phys_page))
+        return PageFaultResponse::OutOfMemory;
+    return PageFaultResponse::Continue;
+}
+
 PageFaultResponse Region::handle_zero_fault(size_t page_index_in_region, PhysicalPage& page_in_slot_at_time_of_fault)
 {
     VERIFY(vmobject().is_anonymous());
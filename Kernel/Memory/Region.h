@@ -20,6 +20,7 @@
 
 namespace Kernel {
 class PageFault;
+class PageTableEntry;
 }
 
 namespace Kernel::Memory {
@@ -219,10 +220,11 @@ private:
     }
 
     [[nodiscard]] PageFaultResponse handle_cow_fault(size_t page_index);
+    [[nodiscard]] PageFaultResponse handle_dirty_fault(size_t page_index);
     [[nodiscard]] PageFaultResponse handle_inode_fault(size_t page_index);
     [[nodiscard]] PageFaultResponse handle_zero_fault(size_t page_index, PhysicalPage& page_in_slot_at_time_of_fault);
 
-    [[nodiscard]] bool map_individual_page_impl(size_t page_index);
+    void map_individual_page_impl(size_t page_index, PageTableEntry&, RefPtr<PhysicalPage>);
     [[nodiscard]] bool map_individual_page_impl(size_t page_index, RefPtr<PhysicalPage>);
 
     LockRefPtr<PageDirectory> m_page_directory;
@@ -25,6 +25,8 @@ void RegionTree::delete_all_regions_assuming_they_are_unmapped()
         m_regions.remove(region.vaddr().get());
         delete &region;
     }
+    m_flat_map.clear();
+    m_flat_map_dirty = false;
 }
 
 ErrorOr<VirtualRange> RegionTree::allocate_range_anywhere(size_t size, size_t alignment)
@@ -154,6 +156,7 @@ ErrorOr<void> RegionTree::place_anywhere(Region& region, RandomizeVirtualAddress
     auto range = TRY(randomize_virtual_address == RandomizeVirtualAddress::Yes ? allocate_range_randomized(size, alignment) : allocate_range_anywhere(size, alignment));
     region.m_range = range;
     m_regions.insert(region.vaddr().get(), region);
+    rebuild_flat_map();
     return {};
 }
 
@@ -162,16 +165,68 @@ ErrorOr<void> RegionTree::place_specifically(Region& region, VirtualRange const&
     auto allocated_range = TRY(allocate_range_specific(range.base(), range.size()));
     region.m_range = allocated_range;
     m_regions.insert(region.vaddr().get(), region);
+    rebuild_flat_map();
     return {};
 }
 
 bool RegionTree::remove(Region& region)
 {
-    return m_regions.remove(region.range().base().get());
+    bool did_remove = m_regions.remove(region.range().base().get());
+    if (did_remove)
+        rebuild_flat_map();
+    return did_remove;
+}
+
+void RegionTree::rebuild_flat_map()
+{
+    // Only the mutation paths rebuild the map, and their callers hold the
+    // owning address space's lock. Lookups must never rebuild: the page
+    // fault path reaches them without taking any lock, so mutating the map
+    // there would race lookups on other CPUs.
+    if (!m_cache_region_lookups)
+        return;
+
+    m_flat_map.clear_with_capacity();
+    if (m_flat_map.try_ensure_capacity(m_regions.size()).is_error()) {
+        // Lookups fall back to the tree until a rebuild after a later
+        // mutation succeeds.
+        m_flat_map_dirty = true;
+        return;
+    }
+
+    // In-order traversal of the tree yields the entries already sorted by base address.
+    for (auto& region : m_regions)
+        m_flat_map.unchecked_append({ region.vaddr().get(), region.range().end().get() - 1, &region });
+
+    m_flat_map_dirty = false;
+}
+
+Region* RegionTree::find_region_in_flat_map(VirtualAddress address)
+{
+    auto const* entry = m_flat_map.data();
+    size_t count = m_flat_map.size();
+    if (count == 0)
+        return nullptr;
+
+    // Branchless lower bound: the halving step compiles to a conditional
+    // move, so the unpredictable comparisons on this hot path don't cost a
+    // pipeline flush.
+    while (count > 1) {
+        size_t half = count / 2;
+        entry = (entry[half].base <= address.get()) ? entry + half : entry;
+        count -= half;
+    }
+
+    if (address.get() < entry->base || address.get() > entry->last)
+        return nullptr;
+    return entry->region;
 }
 
 Region* RegionTree::find_region_containing(VirtualAddress address)
 {
+    if (m_cache_region_lookups && !m_flat_map_dirty)
+        return find_region_in_flat_map(address);
+
     auto* region = m_regions.find_largest_not_above(address.get());
     if (!region || !region->contains(address))
         return nullptr;
@@ -180,7 +235,11 @@ Region* RegionTree::find_region_containing(VirtualAddress address)
 
 Region* RegionTree::find_region_containing(VirtualRange range)
 {
-    auto* region = m_regions.find_largest_not_above(range.base().get());
+    Region* region = nullptr;
+    if (m_cache_region_lookups && !m_flat_map_dirty)
+        region = find_region_in_flat_map(range.base());
+    else
+        region = m_regions.find_largest_not_above(range.base().get());
     if (!region || !region->contains(range))
         return nullptr;
     return region;
@@ -8,6 +8,7 @@
 
 #include <AK/Error.h>
 #include <AK/IntrusiveRedBlackTree.h>
+#include <AK/Vector.h>
 #include <Kernel/Locking/Spinlock.h>
 #include <Kernel/Memory/Region.h>
 #include <Kernel/Memory/VirtualRange.h>
@@ -20,16 +21,29 @@ enum class RandomizeVirtualAddress {
     Yes,
 };
 
+enum class CacheRegionLookups {
+    No,
+    Yes,
+};
+
 // RegionTree represents a virtual address space.
 // It is used by MemoryManager for kernel VM and by AddressSpace for user VM.
 // Regions are stored in an intrusive data structure and there are no allocations when interacting with it.
+//
+// With CacheRegionLookups::Yes, address lookups are additionally served from a
+// flat sorted array of packed (base, last address, region) entries that is
+// rebuilt lazily after mutations, so page faults binary-search a few cache
+// lines instead of chasing tree node pointers. Rebuilding allocates, so the
+// kernel's own region tree (whose lock may be held while kmalloc expands)
+// must not enable this.
 class RegionTree {
     AK_MAKE_NONCOPYABLE(RegionTree);
     AK_MAKE_NONMOVABLE(RegionTree);
 
 public:
-    explicit RegionTree(VirtualRange total_range)
+    RegionTree(VirtualRange total_range, CacheRegionLookups cache_region_lookups)
         : m_total_range(total_range)
+        , m_cache_region_lookups(cache_region_lookups == CacheRegionLookups::Yes)
     {
     }
 
@@ -55,8 +69,20 @@ private:
     ErrorOr<VirtualRange> allocate_range_specific(VirtualAddress base, size_t size);
     ErrorOr<VirtualRange> allocate_range_randomized(size_t size, size_t alignment = PAGE_SIZE);
 
+    struct FlatMapEntry {
+        FlatPtr base { 0 };
+        FlatPtr last { 0 };
+        Region* region { nullptr };
+    };
+
+    Region* find_region_in_flat_map(VirtualAddress);
+    void rebuild_flat_map();
+
     IntrusiveRedBlackTree<&Region::m_tree_node> m_regions;
+    Vector<FlatMapEntry> m_flat_map;
     VirtualRange const m_total_range;
+    bool const m_cache_region_lookups { false };
+    bool m_flat_map_dirty { false };
 };
 
 }
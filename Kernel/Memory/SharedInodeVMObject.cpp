@@ -54,16 +54,29 @@ ErrorOr<void> SharedInodeVMObject::sync(off_t offset_in_pages, size_t pages)
     SpinlockLocker locker(m_lock);
 
     size_t highest_page_to_flush = min(page_count(), offset_in_pages + pages);
+    size_t pages_flushed = 0;
 
     for (size_t page_index = offset_in_pages; page_index < highest_page_to_flush; ++page_index) {
         auto& physical_page = m_physical_pages[page_index];
         if (!physical_page)
             continue;
+        if (!m_dirty_pages.get(page_index))
+            continue;
 
         u8 page_buffer[PAGE_SIZE];
         MM.copy_physical_page(*physical_page, page_buffer);
 
         TRY(m_inode->write_bytes(page_index * PAGE_SIZE, PAGE_SIZE, UserOrKernelBuffer::for_kernel_buffer(page_buffer), nullptr));
+        m_dirty_pages.set(page_index, false);
+        ++pages_flushed;
+    }
+
+    if (pages_flushed > 0) {
+        // Write-protect the flushed pages again, so the next write to them
+        // faults and marks them dirty for the next writeback pass.
+        for_each_region([](auto& region) {
+            region.remap();
+        });
     }
 
     return {};
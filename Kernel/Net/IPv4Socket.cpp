@@ -49,7 +49,7 @@ ErrorOr<NonnullLockRefPtr<Socket>> IPv4Socket::create(int type, int protocol)
     if (type == SOCK_DGRAM)
         return TRY(UDPSocket::try_create(protocol, move(receive_buffer)));
     if (type == SOCK_RAW) {
-        auto raw_socket = adopt_lock_ref_if_nonnull(new (nothrow) IPv4Socket(type, protocol, move(receive_buffer), {}));
+        auto raw_socket = adopt_lock_ref_if_nonnull(new (nothrow) IPv4Socket(type, protocol, move(receive_buffer)));
         if (raw_socket)
             return raw_socket.release_nonnull();
         return ENOMEM;
@@ -57,16 +57,12 @@ ErrorOr<NonnullLockRefPtr<Socket>> IPv4Socket::create(int type, int protocol)
     return EINVAL;
 }
 
-IPv4Socket::IPv4Socket(int type, int protocol, NonnullOwnPtr<DoubleBuffer> receive_buffer, OwnPtr<KBuffer> optional_scratch_buffer)
+IPv4Socket::IPv4Socket(int type, int protocol, NonnullOwnPtr<DoubleBuffer> receive_buffer)
     : Socket(AF_INET, type, protocol)
     , m_receive_buffer(move(receive_buffer))
-    , m_scratch_buffer(move(optional_scratch_buffer))
 {
     dbgln_if(IPV4_SOCKET_DEBUG, "IPv4Socket({}) created with type={}, protocol={}", this, type, protocol);
     m_buffer_mode = type == SOCK_STREAM ? BufferMode::Bytes : BufferMode::Packets;
-    if (m_buffer_mode == BufferMode::Bytes) {
-        VERIFY(m_scratch_buffer);
-    }
 
     all_sockets().with_exclusive([&](auto& table) {
         table.append(*this);
@@ -431,11 +427,12 @@ bool IPv4Socket::did_receive(IPv4Address const& source_address, u16 source_port,
             VERIFY(m_can_read);
             return false;
         }
-        auto scratch_buffer = UserOrKernelBuffer::for_kernel_buffer(m_scratch_buffer->data());
-        auto nreceived_or_error = protocol_receive(packet, scratch_buffer, m_scratch_buffer->size(), 0);
-        if (nreceived_or_error.is_error())
-            return false;
-        auto nwritten_or_error = m_receive_buffer->write(scratch_buffer, nreceived_or_error.value());
+        // Unpack the payload directly into the receive buffer instead of
+        // taking a detour through a scratch buffer.
+        auto nwritten_or_error = m_receive_buffer->write_with([&](Bytes bytes) -> ErrorOr<size_t> {
+            auto buffer = UserOrKernelBuffer::for_kernel_buffer(bytes.data());
+            return protocol_receive(packet, buffer, bytes.size(), 0);
+        });
         if (nwritten_or_error.is_error())
             return false;
         set_can_read(!m_receive_buffer->is_empty());
@@ -73,7 +73,7 @@ public:
     BufferMode buffer_mode() const { return m_buffer_mode; }
 
 protected:
-    IPv4Socket(int type, int protocol, NonnullOwnPtr<DoubleBuffer> receive_buffer, OwnPtr<KBuffer> optional_scratch_buffer);
+    IPv4Socket(int type, int protocol, NonnullOwnPtr<DoubleBuffer> receive_buffer);
     virtual StringView class_name() const override { return "IPv4Socket"sv; }
 
     PortAllocationResult allocate_local_port_if_needed();
@@ -132,8 +132,6 @@ private:
 
     BufferMode m_buffer_mode { BufferMode::Packets };
 
-    OwnPtr<KBuffer> m_scratch_buffer;
-
     IntrusiveListNode<IPv4Socket> m_list_node;
 
 public:
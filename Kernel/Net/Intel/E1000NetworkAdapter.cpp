@@ -11,6 +11,7 @@
 #include <Kernel/Net/Intel/E1000NetworkAdapter.h>
 #include <Kernel/Net/NetworkingManagement.h>
 #include <Kernel/Sections.h>
+#include <Kernel/WorkQueue.h>
 
 namespace Kernel {
 
@@ -245,8 +246,24 @@ bool E1000NetworkAdapter::handle_irq(RegisterState const&)
     if (status & INTERRUPT_RXO) {
         dbgln_if(E1000_DEBUG, "E1000: RX buffer overrun");
     }
-    if (status & INTERRUPT_RXT0) {
-        receive();
+    if (status & (INTERRUPT_RXT0 | INTERRUPT_RXO)) {
+        // Hybrid interrupt/poll receive: mask RX interrupts and drain the
+        // ring from the work queue, so a high packet rate keeps us polling
+        // descriptors instead of taking an interrupt per batch. rx_poll()
+        // re-arms the interrupt once the ring has been emptied.
+        out32(REG_INTERRUPT_MASK_CLEAR, INTERRUPT_RXT0 | INTERRUPT_RXO);
+        if (!m_rx_poll_task_scheduled.exchange(true)) {
+            auto work_item_creation_result = g_io_work->try_queue([this]() {
+                rx_poll();
+            });
+            if (work_item_creation_result.is_error()) {
+                // No memory for a work item; drain the ring right here and
+                // re-arm immediately like the old fully interrupt-driven path.
+                m_rx_poll_task_scheduled.store(false);
+                receive();
+                out32(REG_INTERRUPT_MASK_SET, INTERRUPT_RXT0 | INTERRUPT_RXO);
+            }
+        }
     }
 
     m_wait_queue.wake_all();
@@ -416,6 +433,17 @@ void E1000NetworkAdapter::send_raw(ReadonlyBytes payload)
     dbgln_if(E1000_DEBUG, "E1000: Sent packet, status is now {:#02x}!", (u8)descriptor.status);
 }
 
+void E1000NetworkAdapter::rx_poll()
+{
+    // Drain the ring with RX interrupts still masked, then re-arm them and
+    // poll one final time to catch any packet that arrived between the last
+    // empty poll and the re-arm.
+    receive();
+    m_rx_poll_task_scheduled.store(false);
+    out32(REG_INTERRUPT_MASK_SET, INTERRUPT_RXT0 | INTERRUPT_RXO);
+    receive();
+}
+
 void E1000NetworkAdapter::receive()
 {
     auto* rx_descriptors = (e1000_tx_desc*)m_rx_descriptors_region->vaddr().as_ptr();
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/OwnPtr.h>
 #include <Kernel/Bus/PCI/Access.h>
 #include <Kernel/Bus/PCI/Device.h>
@@ -78,6 +79,7 @@ protected:
     u32 in32(u16 address);
 
     void receive();
+    void rx_poll();
 
     static constexpr size_t number_of_rx_descriptors = 256;
     static constexpr size_t number_of_tx_descriptors = 256;
@@ -92,6 +94,7 @@ protected:
     Array<void*, number_of_tx_descriptors> m_tx_buffers;
     bool m_has_eeprom { false };
     bool m_link_up { false };
+    Atomic<bool> m_rx_poll_task_scheduled { false };
     EntropySource m_entropy_source;
 
     WaitQueue m_wait_queue;
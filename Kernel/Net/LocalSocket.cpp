@@ -22,6 +22,9 @@ namespace Kernel {
 
 static Singleton<MutexProtected<LocalSocket::List>> s_list;
 
+static constexpr size_t minimum_buffer_capacity = 4 * KiB;
+static constexpr size_t maximum_buffer_capacity = 4 * MiB;
+
 static MutexProtected<LocalSocket::List>& all_sockets()
 {
     return *s_list;
@@ -392,6 +395,33 @@ ErrorOr<NonnullOwnPtr<KString>> LocalSocket::pseudo_path(OpenFileDescription con
     return KString::try_create(builder.string_view());
 }
 
+ErrorOr<void> LocalSocket::setsockopt(int level, int option, Userspace<void const*> user_value, socklen_t user_value_size)
+{
+    if (level != SOL_SOCKET)
+        return Socket::setsockopt(level, option, user_value, user_value_size);
+
+    switch (option) {
+    case SO_SNDBUF:
+    case SO_RCVBUF: {
+        if (user_value_size != sizeof(int))
+            return EINVAL;
+        int requested_size = TRY(copy_typed_from_user(static_ptr_cast<int const*>(user_value)));
+        if (requested_size <= 0)
+            return EINVAL;
+        MutexLocker locker(mutex());
+        // Both ends of a local socket share this object and each direction
+        // has its own buffer, so size both of them; shrinking fails with
+        // EBUSY if buffered bytes wouldn't fit.
+        size_t capacity = clamp(static_cast<size_t>(requested_size), minimum_buffer_capacity, maximum_buffer_capacity);
+        TRY(m_for_client->try_set_capacity(capacity));
+        TRY(m_for_server->try_set_capacity(capacity));
+        return {};
+    }
+    default:
+        return Socket::setsockopt(level, option, user_value, user_value_size);
+    }
+}
+
 ErrorOr<void> LocalSocket::getsockopt(OpenFileDescription& description, int level, int option, Userspace<void*> value, Userspace<socklen_t*> value_size)
 {
     if (level != SOL_SOCKET)
@@ -403,10 +433,28 @@ ErrorOr<void> LocalSocket::getsockopt(OpenFileDescription& description, int leve
     TRY(copy_from_user(&size, value_size.unsafe_userspace_ptr()));
 
     switch (option) {
-    case SO_SNDBUF:
-        return ENOTSUP;
-    case SO_RCVBUF:
-        return ENOTSUP;
+    case SO_SNDBUF: {
+        if (size < sizeof(int))
+            return EINVAL;
+        auto* buffer = send_buffer_for(description);
+        if (!buffer)
+            return EINVAL;
+        int capacity = static_cast<int>(buffer->capacity());
+        TRY(copy_to_user(static_ptr_cast<int*>(value), &capacity));
+        size = sizeof(int);
+        return copy_to_user(value_size, &size);
+    }
+    case SO_RCVBUF: {
+        if (size < sizeof(int))
+            return EINVAL;
+        auto* buffer = receive_buffer_for(description);
+        if (!buffer)
+            return EINVAL;
+        int capacity = static_cast<int>(buffer->capacity());
+        TRY(copy_to_user(static_ptr_cast<int*>(value), &capacity));
+        size = sizeof(int);
+        return copy_to_user(value_size, &size);
+    }
     case SO_PEERCRED: {
         if (size < sizeof(ucred))
             return EINVAL;
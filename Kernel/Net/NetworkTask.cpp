@@ -97,35 +97,47 @@ void NetworkTask_main(void*)
     auto buffer = (u8*)buffer_region->vaddr().get();
     Time packet_timestamp;
 
+    // Drain the adapter queues in one pass so that a burst of packets is
+    // handled back to back, and the delayed-ACK and retransmit bookkeeping
+    // below runs once per batch instead of once per packet. The batch is
+    // bounded so that a continuous stream of incoming packets cannot starve
+    // ACK generation indefinitely.
+    constexpr size_t max_packets_per_batch = 64;
+
     for (;;) {
+        size_t batched_packets = 0;
+        size_t packet_size = 0;
+        while (batched_packets < max_packets_per_batch && (packet_size = dequeue_packet(buffer, buffer_size, packet_timestamp)) != 0) {
+            ++batched_packets;
+            if (packet_size < sizeof(EthernetFrameHeader)) {
+                dbgln("NetworkTask: Packet is too small to be an Ethernet packet! ({})", packet_size);
+                continue;
+            }
+            auto& eth = *(EthernetFrameHeader const*)buffer;
+            dbgln_if(ETHERNET_DEBUG, "NetworkTask: From {} to {}, ether_type={:#04x}, packet_size={}", eth.source().to_string(), eth.destination().to_string(), eth.ether_type(), packet_size);
+
+            switch (eth.ether_type()) {
+            case EtherType::ARP:
+                handle_arp(eth, packet_size);
+                break;
+            case EtherType::IPv4:
+                handle_ipv4(eth, packet_size, packet_timestamp);
+                break;
+            case EtherType::IPv6:
+                // ignore
+                break;
+            default:
+                dbgln_if(ETHERNET_DEBUG, "NetworkTask: Unknown ethernet type {:#04x}", eth.ether_type());
+            }
+        }
+
         flush_delayed_tcp_acks();
         retransmit_tcp_packets();
-        size_t packet_size = dequeue_packet(buffer, buffer_size, packet_timestamp);
-        if (!packet_size) {
+
+        if (batched_packets == 0) {
             auto timeout_time = Time::from_milliseconds(500);
             auto timeout = Thread::BlockTimeout { false, &timeout_time };
             [[maybe_unused]] auto result = packet_wait_queue.wait_on(timeout, "NetworkTask"sv);
-            continue;
-        }
-        if (packet_size < sizeof(EthernetFrameHeader)) {
-            dbgln("NetworkTask: Packet is too small to be an Ethernet packet! ({})", packet_size);
-            continue;
-        }
-        auto& eth = *(EthernetFrameHeader const*)buffer;
-        dbgln_if(ETHERNET_DEBUG, "NetworkTask: From {} to {}, ether_type={:#04x}, packet_size={}", eth.source().to_string(), eth.destination().to_string(), eth.ether_type(), packet_size);
-
-        switch (eth.ether_type()) {
-        case EtherType::ARP:
-            handle_arp(eth, packet_size);
-            break;
-        case EtherType::IPv4:
-            handle_ipv4(eth, packet_size, packet_timestamp);
-            break;
-        case EtherType::IPv6:
-            // ignore
-            break;
-        default:
-            dbgln_if(ETHERNET_DEBUG, "NetworkTask: Unknown ethernet type {:#04x}", eth.ether_type());
         }
     }
 }
@@ -305,11 +317,9 @@ void handle_udp(IPv4Packet const& ipv4_packet, Time const& packet_timestamp)
 void send_delayed_tcp_ack(LockRefPtr<TCPSocket> socket)
 {
     VERIFY(socket->mutex().is_locked());
-    if (!socket->should_delay_next_ack()) {
-        [[maybe_unused]] auto result = socket->send_ack();
-        return;
-    }
-
+    // Always defer: flush_delayed_tcp_acks() runs after every batch of
+    // received packets, so all segments received in one batch collapse into a
+    // single cumulative ACK per socket.
     delayed_ack_sockets->set(move(socket));
 }
 
@@ -6,6 +6,7 @@
 
 #include <AK/HashMap.h>
 #include <AK/Singleton.h>
+#include <AK/Vector.h>
 #include <Kernel/Debug.h>
 #include <Kernel/Locking/MutexProtected.h>
 #include <Kernel/Net/LoopbackAdapter.h>
@@ -19,6 +20,22 @@ namespace Kernel {
 static Singleton<SpinlockProtected<HashMap<IPv4Address, MACAddress>>> s_arp_table;
 static Singleton<SpinlockProtected<Route::RouteList>> s_routing_table;
 
+// Read-mostly snapshots of the ARP and routing tables for the per-packet
+// lookup in route_to(). Writers rebuild a fresh immutable snapshot while
+// still holding the table lock and publish it by swapping the LockRefPtr,
+// so readers never contend on the table locks and always see either the old
+// or the new table, never a partially updated one.
+struct ArpTableSnapshot final : public AtomicRefCounted<ArpTableSnapshot> {
+    HashMap<IPv4Address, MACAddress> entries;
+};
+
+struct RoutingTableSnapshot final : public AtomicRefCounted<RoutingTableSnapshot> {
+    Vector<NonnullLockRefPtr<Route>> routes;
+};
+
+static LockRefPtr<ArpTableSnapshot> s_arp_table_snapshot;
+static LockRefPtr<RoutingTableSnapshot> s_routing_table_snapshot;
+
 class ARPTableBlocker final : public Thread::Blocker {
 public:
     ARPTableBlocker(IPv4Address ip_addr, Optional<MACAddress>& addr);
@@ -118,6 +135,23 @@ void update_arp_table(IPv4Address const& ip_addr, MACAddress const& addr, Update
             table.set(ip_addr, addr);
         if (update == UpdateTable::Delete)
             table.remove(ip_addr);
+
+        auto new_snapshot = adopt_lock_ref_if_nonnull(new (nothrow) ArpTableSnapshot);
+        auto copy_result = [&]() -> ErrorOr<void> {
+            if (!new_snapshot)
+                return ENOMEM;
+            TRY(new_snapshot->entries.try_ensure_capacity(table.size()));
+            for (auto& it : table)
+                TRY(new_snapshot->entries.try_set(it.key, it.value));
+            return {};
+        }();
+        // If we couldn't allocate a fresh snapshot, retire the old one
+        // entirely so readers fall back to the locked table instead of
+        // acting on stale entries.
+        if (copy_result.is_error())
+            s_arp_table_snapshot = nullptr;
+        else
+            s_arp_table_snapshot = move(new_snapshot);
     });
     s_arp_table_blocker_set->unblock_blockers_waiting_for_ipv4_address(ip_addr, addr);
 
@@ -144,12 +178,28 @@ ErrorOr<void> update_routing_table(IPv4Address const& destination, IPv4Address c
         return ENOMEM;
 
     TRY(routing_table().with([&](auto& table) -> ErrorOr<void> {
+        auto publish_snapshot = [&] {
+            auto new_snapshot = adopt_lock_ref_if_nonnull(new (nothrow) RoutingTableSnapshot);
+            auto copy_result = [&]() -> ErrorOr<void> {
+                if (!new_snapshot)
+                    return ENOMEM;
+                TRY(new_snapshot->routes.try_ensure_capacity(table.size_slow()));
+                for (auto& route : table)
+                    TRY(new_snapshot->routes.try_append(NonnullLockRefPtr<Route>(route)));
+                return {};
+            }();
+            if (copy_result.is_error())
+                s_routing_table_snapshot = nullptr;
+            else
+                s_routing_table_snapshot = move(new_snapshot);
+        };
         if (update == UpdateTable::Set) {
             for (auto const& route : table) {
                 if (route == *route_entry)
                     return EEXIST;
             }
             table.append(*route_entry);
+            publish_snapshot();
         }
         if (update == UpdateTable::Delete) {
             for (auto& route : table) {
@@ -157,6 +207,7 @@ ErrorOr<void> update_routing_table(IPv4Address const& destination, IPv4Address c
                 if (route.matches(*route_entry)) {
                     // FIXME: Remove all entries, not only the first one.
                     table.remove(route);
+                    publish_snapshot();
                     return {};
                 }
             }
@@ -223,7 +274,7 @@ RoutingDecision route_to(IPv4Address const& target, IPv4Address const& source, L
     });
 
     u32 longest_prefix_match = 0;
-    routing_table().for_each([&target_addr, &matches, &longest_prefix_match, &chosen_route](auto& route) {
+    auto check_route = [&target_addr, &matches, &longest_prefix_match, &chosen_route](auto& route) {
         auto route_addr = route.destination.to_u32();
         auto route_mask = route.netmask.to_u32();
 
@@ -253,7 +304,17 @@ RoutingDecision route_to(IPv4Address const& target, IPv4Address const& source, L
                 chosen_route = route;
             }
         }
-    });
+    };
+
+    // Walk the published immutable snapshot instead of taking the routing
+    // table lock on every outgoing packet. If no snapshot could be allocated
+    // on the last update, fall back to the locked table.
+    if (auto snapshot = s_routing_table_snapshot) {
+        for (auto& route : snapshot->routes)
+            check_route(*route);
+    } else {
+        routing_table().for_each([&](auto& route) { check_route(route); });
+    }
 
     if (local_adapter && target == local_adapter->ipv4_address())
         return { local_adapter, local_adapter->mac_address() };
@@ -301,9 +362,13 @@ RoutingDecision route_to(IPv4Address const& target, IPv4Address const& source, L
         return { adapter, multicast_ethernet_address(target) };
 
     {
-        auto addr = arp_table().with([&](auto const& table) -> auto{
-            return table.get(next_hop_ip);
-        });
+        auto addr = [&]() -> Optional<MACAddress> {
+            if (auto snapshot = s_arp_table_snapshot)
+                return snapshot->entries.get(next_hop_ip);
+            return arp_table().with([&](auto const& table) -> auto{
+                return table.get(next_hop_ip);
+            });
+        }();
         if (addr.has_value()) {
             dbgln_if(ARP_DEBUG, "Routing: Using cached ARP entry for {} ({})", next_hop_ip, addr.value().to_string());
             return { adapter, addr.value() };
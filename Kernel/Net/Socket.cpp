@@ -128,6 +128,14 @@ ErrorOr<void> Socket::setsockopt(int level, int option, Userspace<void const*> u
     case SO_REUSEADDR:
         dbgln("FIXME: SO_REUSEADDR requested, but not implemented.");
         return {};
+    case SO_REUSEPORT: {
+        if (user_value_size != sizeof(int))
+            return EINVAL;
+        // NOTE: The flag is only consulted when the socket starts listening,
+        //       so flipping it later has no effect on an established group.
+        m_reuseport_allowed = TRY(copy_typed_from_user(static_ptr_cast<int const*>(user_value))) != 0;
+        return {};
+    }
     default:
         dbgln("setsockopt({}) at SOL_SOCKET not implemented.", option);
         return ENOPROTOOPT;
@@ -223,6 +231,14 @@ ErrorOr<void> Socket::getsockopt(OpenFileDescription&, int level, int option, Us
         size = sizeof(accepting_connections);
         return copy_to_user(value_size, &size);
     }
+    case SO_REUSEPORT: {
+        int reuseport_allowed = m_reuseport_allowed ? 1 : 0;
+        if (size < sizeof(reuseport_allowed))
+            return EINVAL;
+        TRY(copy_to_user(static_ptr_cast<int*>(value), &reuseport_allowed));
+        size = sizeof(reuseport_allowed);
+        return copy_to_user(value_size, &size);
+    }
     case SO_DONTROUTE: {
         int routing_disabled = m_routing_disabled ? 1 : 0;
         if (size < sizeof(routing_disabled))
@@ -109,6 +109,8 @@ public:
 
     bool wants_timestamp() const { return m_timestamp; }
 
+    bool is_reuseport_allowed() const { return m_reuseport_allowed; }
+
 protected:
     Socket(int domain, int type, int protocol);
 
@@ -177,6 +179,7 @@ private:
     Time m_receive_timeout {};
     Time m_send_timeout {};
     int m_timestamp { 0 };
+    bool m_reuseport_allowed { false };
 
     ErrorOr<void> m_so_error;
 
@@ -6,6 +6,7 @@
 
 #include <AK/Singleton.h>
 #include <AK/Time.h>
+#include <AK/Vector.h>
 #include <Kernel/Debug.h>
 #include <Kernel/Devices/RandomDevice.h>
 #include <Kernel/FileSystem/OpenFileDescription.h>
@@ -22,10 +23,30 @@
 
 namespace Kernel {
 
+// Listeners that opted into SO_REUSEPORT and share a listen tuple, keyed by
+// that tuple. The first member of each group is also the occupant of the
+// sockets_by_tuple() entry for the tuple. Always acquired after
+// sockets_by_tuple().
+static Singleton<MutexProtected<HashMap<IPv4SocketTuple, Vector<TCPSocket*>>>> s_reuseport_listeners;
+
+static MutexProtected<HashMap<IPv4SocketTuple, Vector<TCPSocket*>>>& reuseport_listeners()
+{
+    return *s_reuseport_listeners;
+}
+
 void TCPSocket::for_each(Function<void(TCPSocket const&)> callback)
 {
-    sockets_by_tuple().for_each_shared([&](auto const& it) {
-        callback(*it.value);
+    sockets_by_tuple().with_shared([&](auto const& sockets) {
+        for (auto& it : sockets)
+            callback(*it.value);
+        reuseport_listeners().with_shared([&](auto const& groups) {
+            for (auto& group : groups) {
+                // The first group member is the sockets_by_tuple() occupant
+                // and was already visited above.
+                for (size_t i = 1; i < group.value.size(); ++i)
+                    callback(*group.value[i]);
+            }
+        });
     });
 }
 
@@ -34,7 +55,13 @@ ErrorOr<void> TCPSocket::try_for_each(Function<ErrorOr<void>(TCPSocket const&)>
     return sockets_by_tuple().with_shared([&](auto const& sockets) -> ErrorOr<void> {
         for (auto& it : sockets)
             TRY(callback(*it.value));
-        return {};
+        return reuseport_listeners().with_shared([&](auto const& groups) -> ErrorOr<void> {
+            for (auto& group : groups) {
+                for (size_t i = 1; i < group.value.size(); ++i)
+                    TRY(callback(*group.value[i]));
+            }
+            return {};
+        });
     });
 }
 
@@ -43,7 +70,23 @@ bool TCPSocket::unref() const
     bool did_hit_zero = sockets_by_tuple().with_exclusive([&](auto& table) {
         if (deref_base())
             return false;
-        table.remove(tuple());
+        // With SO_REUSEPORT several listeners share one tuple, so only evict
+        // the table entry if we are the socket it actually points at, and
+        // promote another group member in our place if there is one.
+        auto it = table.find(tuple());
+        bool was_table_occupant = it != table.end() && it->value == this;
+        if (was_table_occupant)
+            table.remove(it);
+        reuseport_listeners().with_exclusive([&](auto& groups) {
+            auto group_it = groups.find(tuple());
+            if (group_it == groups.end())
+                return;
+            group_it->value.remove_all_matching([&](auto* socket) { return socket == this; });
+            if (was_table_occupant && !group_it->value.is_empty())
+                table.set(tuple(), group_it->value.first());
+            if (group_it->value.size() <= 1)
+                groups.remove(group_it);
+        });
         const_cast<TCPSocket&>(*this).revoke_weak_ptrs();
         return true;
     });
@@ -102,6 +145,19 @@ MutexProtected<HashMap<IPv4SocketTuple, TCPSocket*>>& TCPSocket::sockets_by_tupl
     return *s_socket_tuples;
 }
 
+static TCPSocket* select_listener(IPv4SocketTuple const& listen_tuple, TCPSocket* fallback, IPv4SocketTuple const& incoming_tuple)
+{
+    return reuseport_listeners().with_shared([&](auto const& groups) -> TCPSocket* {
+        auto it = groups.find(listen_tuple);
+        if (it == groups.end())
+            return fallback;
+        // Hash only the remote end, so every segment of a given connection
+        // attempt lands on the same listener.
+        auto index = pair_int_hash(incoming_tuple.peer_address().to_u32(), incoming_tuple.peer_port()) % it->value.size();
+        return it->value[index];
+    });
+}
+
 LockRefPtr<TCPSocket> TCPSocket::from_tuple(IPv4SocketTuple const& tuple)
 {
     return sockets_by_tuple().with_shared([&](auto const& table) -> LockRefPtr<TCPSocket> {
@@ -112,12 +168,12 @@ LockRefPtr<TCPSocket> TCPSocket::from_tuple(IPv4SocketTuple const& tuple)
         auto address_tuple = IPv4SocketTuple(tuple.local_address(), tuple.local_port(), IPv4Address(), 0);
         auto address_match = table.get(address_tuple);
         if (address_match.has_value())
-            return { *address_match.value() };
+            return { *select_listener(address_tuple, address_match.value(), tuple) };
 
         auto wildcard_tuple = IPv4SocketTuple(IPv4Address(), tuple.local_port(), IPv4Address(), 0);
         auto wildcard_match = table.get(wildcard_tuple);
         if (wildcard_match.has_value())
-            return { *wildcard_match.value() };
+            return { *select_listener(wildcard_tuple, wildcard_match.value(), tuple) };
 
         return {};
     });
@@ -162,8 +218,8 @@ void TCPSocket::release_for_accept(NonnullLockRefPtr<TCPSocket> socket)
     [[maybe_unused]] auto rc = queue_connection_from(move(socket));
 }
 
-TCPSocket::TCPSocket(int protocol, NonnullOwnPtr<DoubleBuffer> receive_buffer, NonnullOwnPtr<KBuffer> scratch_buffer)
-    : IPv4Socket(SOCK_STREAM, protocol, move(receive_buffer), move(scratch_buffer))
+TCPSocket::TCPSocket(int protocol, NonnullOwnPtr<DoubleBuffer> receive_buffer)
+    : IPv4Socket(SOCK_STREAM, protocol, move(receive_buffer))
 {
     m_last_retransmit_time = kgettimeofday();
 }
@@ -177,9 +233,7 @@ TCPSocket::~TCPSocket()
 
 ErrorOr<NonnullLockRefPtr<TCPSocket>> TCPSocket::try_create(int protocol, NonnullOwnPtr<DoubleBuffer> receive_buffer)
 {
-    // Note: Scratch buffer is only used for SOCK_STREAM sockets.
-    auto scratch_buffer = TRY(KBuffer::try_create_with_size("TCPSocket: Scratch buffer"sv, 65536));
-    return adopt_nonnull_lock_ref_or_enomem(new (nothrow) TCPSocket(protocol, move(receive_buffer), move(scratch_buffer)));
+    return adopt_nonnull_lock_ref_or_enomem(new (nothrow) TCPSocket(protocol, move(receive_buffer)));
 }
 
 ErrorOr<size_t> TCPSocket::protocol_size(ReadonlyBytes raw_ipv4_packet)
@@ -348,7 +402,9 @@ bool TCPSocket::should_delay_next_ack() const
     const size_t mss = 1500;
 
     // RFC 1122 says we should send an ACK for every two full-sized segments.
-    if (m_ack_number >= m_last_ack_number_sent + 2 * mss)
+    // The subtraction is sequence number arithmetic, so this also holds once
+    // the sequence space wraps around.
+    if (m_ack_number - m_last_ack_number_sent >= 2 * mss)
         return false;
 
     // RFC 1122 says we should not delay ACKs for more than 500 milliseconds.
@@ -414,9 +470,22 @@ ErrorOr<void> TCPSocket::protocol_listen(bool did_allocate_port)
 {
     if (!did_allocate_port) {
         bool ok = sockets_by_tuple().with_exclusive([&](auto& table) -> bool {
-            if (table.contains(tuple()))
+            auto existing = table.get(tuple());
+            if (!existing.has_value()) {
+                table.set(tuple(), this);
+                return true;
+            }
+            // Multiple listeners may share a listen tuple if they all opted
+            // into SO_REUSEPORT and belong to the same user; incoming
+            // connections are then distributed across the group by a hash of
+            // the peer's address and port.
+            auto* occupant = existing.value();
+            if (occupant == this || !is_reuseport_allowed() || !occupant->is_reuseport_allowed() || occupant->origin_uid() != origin_uid())
                 return false;
-            table.set(tuple(), this);
+            reuseport_listeners().with_exclusive([&](auto& groups) {
+                auto& group = groups.ensure(tuple(), [&] { return Vector<TCPSocket*> { occupant }; });
+                group.append(this);
+            });
             return true;
         });
         if (!ok)
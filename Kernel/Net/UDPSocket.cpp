@@ -49,7 +49,7 @@ LockRefPtr<UDPSocket> UDPSocket::from_port(u16 port)
 }
 
 UDPSocket::UDPSocket(int protocol, NonnullOwnPtr<DoubleBuffer> receive_buffer)
-    : IPv4Socket(SOCK_DGRAM, protocol, move(receive_buffer), {})
+    : IPv4Socket(SOCK_DGRAM, protocol, move(receive_buffer))
 {
 }
 
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashFunctions.h>
 #include <AK/JsonArraySerializer.h>
 #include <AK/JsonObjectSerializer.h>
 #include <AK/ScopeGuard.h>
@@ -17,11 +18,79 @@
 
 namespace Kernel {
 
-PerformanceEventBuffer::PerformanceEventBuffer(NonnullOwnPtr<KBuffer> buffer)
-    : m_buffer(move(buffer))
+// One slot of the stack deduplication hash table. Empty slots have offset_plus_one == 0;
+// occupied ones point at an entry in the frame arena: a FlatPtr frame count followed by
+// that many frames.
+struct StackTableSlot {
+    u32 hash { 0 };
+    u32 offset_plus_one { 0 };
+};
+
+PerformanceEventBuffer::PerformanceEventBuffer(NonnullOwnPtr<KBuffer> event_buffer, NonnullOwnPtr<KBuffer> stack_table, size_t stack_slot_count)
+    : m_buffer(move(event_buffer))
+    , m_stack_table(move(stack_table))
+    , m_stack_slot_count(stack_slot_count)
+    , m_stack_arena_size(m_stack_table->size() - stack_slot_count * sizeof(StackTableSlot))
 {
 }
 
+void PerformanceEventBuffer::clear()
+{
+    m_count = 0;
+    memset(m_stack_table->data(), 0, m_stack_slot_count * sizeof(StackTableSlot));
+    m_stack_arena_used = 0;
+    m_unique_stack_count = 0;
+}
+
+ErrorOr<u32> PerformanceEventBuffer::register_stack(FlatPtr const* frames, size_t frame_count)
+{
+    u32 hash = u64_hash(frame_count);
+    for (size_t i = 0; i < frame_count; ++i)
+        hash = pair_int_hash(hash, ptr_hash(frames[i]));
+
+    auto* slots = reinterpret_cast<StackTableSlot*>(m_stack_table->data());
+    auto* arena = m_stack_table->data() + m_stack_slot_count * sizeof(StackTableSlot);
+    size_t slot_mask = m_stack_slot_count - 1;
+
+    for (size_t slot_index = hash & slot_mask;; slot_index = (slot_index + 1) & slot_mask) {
+        auto& slot = slots[slot_index];
+        if (slot.offset_plus_one != 0) {
+            if (slot.hash != hash)
+                continue;
+            u32 offset = slot.offset_plus_one - 1;
+            auto const* entry = reinterpret_cast<FlatPtr const*>(arena + offset);
+            if (entry[0] == frame_count && memcmp(entry + 1, frames, frame_count * sizeof(FlatPtr)) == 0)
+                return offset;
+            continue;
+        }
+
+        // Never seen this stack before. Refuse to fill the table past half capacity,
+        // so probe sequences stay short.
+        if (m_unique_stack_count * 2 >= m_stack_slot_count)
+            return ENOBUFS;
+        size_t entry_size = (1 + frame_count) * sizeof(FlatPtr);
+        if (m_stack_arena_used + entry_size > m_stack_arena_size)
+            return ENOBUFS;
+
+        u32 offset = m_stack_arena_used;
+        auto* entry = reinterpret_cast<FlatPtr*>(arena + offset);
+        entry[0] = frame_count;
+        memcpy(entry + 1, frames, frame_count * sizeof(FlatPtr));
+        m_stack_arena_used += entry_size;
+        slot.hash = hash;
+        slot.offset_plus_one = offset + 1;
+        ++m_unique_stack_count;
+        return offset;
+    }
+}
+
+Span<FlatPtr const> PerformanceEventBuffer::stack_at(u32 stack_index) const
+{
+    auto const* arena = m_stack_table->data() + m_stack_slot_count * sizeof(StackTableSlot);
+    auto const* entry = reinterpret_cast<FlatPtr const*>(arena + stack_index);
+    return { entry + 1, static_cast<size_t>(entry[0]) };
+}
+
 NEVER_INLINE ErrorOr<void> PerformanceEventBuffer::append(int type, FlatPtr arg1, FlatPtr arg2, StringView arg3, Thread* current_thread, FlatPtr arg4, u64 arg5, ErrorOr<FlatPtr> arg6)
 {
     FlatPtr base_pointer = (FlatPtr)__builtin_frame_address(0);
@@ -170,8 +239,7 @@ ErrorOr<void> PerformanceEventBuffer::append_with_ip_and_bp(ProcessID pid, Threa
     }
 
     auto backtrace = raw_backtrace(bp, ip);
-    event.stack_size = min(sizeof(event.stack) / sizeof(FlatPtr), static_cast<size_t>(backtrace.size()));
-    memcpy(event.stack, backtrace.data(), event.stack_size * sizeof(FlatPtr));
+    event.stack_index = TRY(register_stack(backtrace.data(), backtrace.size()));
 
     event.pid = pid.value();
     event.tid = tid.value();
@@ -304,8 +372,7 @@ ErrorOr<void> PerformanceEventBuffer::to_json_impl(Serializer& object) const
         if (event.type == PERF_EVENT_SAMPLE)
             seen_first_sample = true;
         auto stack_array = TRY(event_object.add_array("stack"sv));
-        for (size_t j = 0; j < event.stack_size; ++j) {
-            auto address = event.stack[j];
+        for (auto address : stack_at(event.stack_index)) {
             if (!show_kernel_addresses && !Memory::is_user_address(VirtualAddress { address }))
                 address = 0xdeadc0de;
             TRY(stack_array.add(address));
@@ -329,7 +396,18 @@ OwnPtr<PerformanceEventBuffer> PerformanceEventBuffer::try_create_with_size(size
     auto buffer_or_error = KBuffer::try_create_with_size("Performance events"sv, buffer_size, Memory::Region::Access::ReadWrite, AllocationStrategy::AllocateNow);
     if (buffer_or_error.is_error())
         return {};
-    return adopt_own_if_nonnull(new (nothrow) PerformanceEventBuffer(buffer_or_error.release_value()));
+
+    // Size the frame arena at half of the event buffer, and assume stacks average out
+    // to at least four frames each when choosing how many hash slots to provide.
+    // Everything is allocated up front since events get appended from interrupt handlers.
+    size_t stack_arena_size = buffer_size / 2;
+    size_t stack_slot_count = 1;
+    while (stack_slot_count < stack_arena_size / 32)
+        stack_slot_count *= 2;
+    auto stack_table_or_error = KBuffer::try_create_with_size("Performance event stacks"sv, stack_slot_count * sizeof(StackTableSlot) + stack_arena_size, Memory::Region::Access::ReadWrite, AllocationStrategy::AllocateNow);
+    if (stack_table_or_error.is_error())
+        return {};
+    return adopt_own_if_nonnull(new (nothrow) PerformanceEventBuffer(buffer_or_error.release_value(), stack_table_or_error.release_value(), stack_slot_count));
 }
 
 ErrorOr<void> PerformanceEventBuffer::add_process(Process const& process, ProcessEventType event_type)
@@ -78,7 +78,6 @@ struct [[gnu::packed]] ReadPerformanceEvent {
 
 struct [[gnu::packed]] PerformanceEvent {
     u32 type { 0 };
-    u8 stack_size { 0 };
     u32 pid { 0 };
     u32 tid { 0 };
     u64 timestamp;
@@ -98,7 +97,8 @@ struct [[gnu::packed]] PerformanceEvent {
         ReadPerformanceEvent read;
     } data;
     static constexpr size_t max_stack_frame_count = 64;
-    FlatPtr stack[max_stack_frame_count];
+    // Byte offset of this event's deduplicated stack in the buffer's stack table.
+    u32 stack_index { 0 };
 };
 
 enum class ProcessEventType {
@@ -116,10 +116,7 @@ public:
     ErrorOr<void> append_with_ip_and_bp(ProcessID pid, ThreadID tid, RegisterState const& regs,
         int type, u32 lost_samples, FlatPtr arg1, FlatPtr arg2, StringView arg3, FlatPtr arg4 = 0, u64 arg5 = {}, ErrorOr<FlatPtr> arg6 = 0);
 
-    void clear()
-    {
-        m_count = 0;
-    }
+    void clear();
 
     size_t capacity() const { return m_buffer->size() / sizeof(PerformanceEvent); }
     size_t count() const { return m_count; }
@@ -135,16 +132,29 @@ public:
     ErrorOr<FlatPtr> register_string(NonnullOwnPtr<KString>);
 
 private:
-    explicit PerformanceEventBuffer(NonnullOwnPtr<KBuffer>);
+    PerformanceEventBuffer(NonnullOwnPtr<KBuffer> event_buffer, NonnullOwnPtr<KBuffer> stack_table, size_t stack_slot_count);
 
     template<typename Serializer>
     ErrorOr<void> to_json_impl(Serializer&) const;
 
     PerformanceEvent& at(size_t index);
 
+    // Stores the given backtrace in the stack table (unless an identical one is
+    // already there) and returns its byte offset in the frame arena.
+    ErrorOr<u32> register_stack(FlatPtr const* frames, size_t frame_count);
+    Span<FlatPtr const> stack_at(u32 stack_index) const;
+
     size_t m_count { 0 };
     NonnullOwnPtr<KBuffer> m_buffer;
 
+    // Deduplicated backtraces: a linearly probed hash table of slots, followed by
+    // an arena of (frame count, frames...) entries that the slots point into.
+    NonnullOwnPtr<KBuffer> m_stack_table;
+    size_t m_stack_slot_count { 0 };
+    size_t m_stack_arena_size { 0 };
+    size_t m_stack_arena_used { 0 };
+    size_t m_unique_stack_count { 0 };
+
     HashMap<NonnullOwnPtr<KString>, size_t> m_strings;
 };
 
@@ -204,6 +204,13 @@ public:
     bool is_profiling() const { return m_profiling; }
     void set_profiling(bool profiling) { m_profiling = profiling; }
 
+    // Incremented whenever one of our threads is scheduled or changes state.
+    // Every statistic we export (CPU times, memory use, I/O counters, ...)
+    // only moves while one of our threads runs, so a statistics reader that
+    // sees the same sequence twice can reuse its previous snapshot of us.
+    u64 statistics_sequence() const { return m_statistics_sequence.load(AK::MemoryOrder::memory_order_relaxed); }
+    void bump_statistics_sequence() { m_statistics_sequence.fetch_add(1, AK::MemoryOrder::memory_order_relaxed); }
+
     bool should_generate_coredump() const { return m_should_generate_coredump; }
     void set_should_generate_coredump(bool b) { m_should_generate_coredump = b; }
 
@@ -293,6 +300,10 @@ public:
     ErrorOr<FlatPtr> sys$create_inode_watcher(u32 flags);
     ErrorOr<FlatPtr> sys$inode_watcher_add_watch(Userspace<Syscall::SC_inode_watcher_add_watch_params const*> user_params);
     ErrorOr<FlatPtr> sys$inode_watcher_remove_watch(int fd, int wd);
+    ErrorOr<FlatPtr> sys$event_queue_create();
+    ErrorOr<FlatPtr> sys$event_queue_ctl(int queue_fd, int operation, int fd, u32 events);
+    ErrorOr<FlatPtr> sys$event_queue_wait(Userspace<Syscall::SC_event_queue_wait_params const*> user_params);
+    ErrorOr<FlatPtr> sys$iobatch(Userspace<IOBatchOp*> user_ops, size_t op_count);
     ErrorOr<FlatPtr> sys$dbgputstr(Userspace<char const*>, size_t);
     ErrorOr<FlatPtr> sys$dump_backtrace();
     ErrorOr<FlatPtr> sys$gettid();
@@ -430,6 +441,7 @@ public:
     ErrorOr<FlatPtr> sys$get_stack_bounds(Userspace<FlatPtr*> stack_base, Userspace<size_t*> stack_size);
     ErrorOr<FlatPtr> sys$ptrace(Userspace<Syscall::SC_ptrace_params const*>);
     ErrorOr<FlatPtr> sys$sendfd(int sockfd, int fd);
+    ErrorOr<FlatPtr> sys$sendfile(int out_fd, int in_fd, Userspace<off_t*>, size_t count);
     ErrorOr<FlatPtr> sys$recvfd(int sockfd, int options);
     ErrorOr<FlatPtr> sys$sysconf(int name);
     ErrorOr<FlatPtr> sys$disown(ProcessID);
@@ -497,15 +509,17 @@ public:
     Mutex& big_lock() { return m_big_lock; }
     Mutex& ptrace_lock() { return m_ptrace_lock; }
 
+    // NOTE: The promise bits are atomics, so pledge checks (which run on
+    //       every syscall) can read them without bouncing the protected-data
+    //       lock between processors. The protected region is always mapped
+    //       at least readable.
     bool has_promises() const
     {
-        return with_protected_data([](auto& protected_data) { return protected_data.has_promises.load(); });
+        return m_protected_values_do_not_access_directly.has_promises.load();
     }
     bool has_promised(Pledge pledge) const
     {
-        return with_protected_data([&](auto& protected_data) {
-            return (protected_data.promises & (1U << (u32)pledge)) != 0;
-        });
+        return (m_protected_values_do_not_access_directly.promises.load() & (1U << (u32)pledge)) != 0;
     }
 
     VeilState veil_state() const
@@ -520,6 +534,23 @@ public:
         }
         VeilState state { VeilState::None };
         UnveilNode paths;
+
+        // Recently validated paths and the permissions their matching unveil
+        // node granted, so repeated syscalls on the same paths don't have to
+        // split the path and walk the trie again. Must be flushed whenever
+        // the unveil tree changes.
+        struct CachedPathPermissions {
+            OwnPtr<KString> path;
+            UnveilAccess permissions { UnveilAccess::None };
+        };
+        CachedPathPermissions permissions_cache[8];
+        size_t permissions_cache_cursor { 0 };
+
+        void flush_permissions_cache()
+        {
+            for (auto& entry : permissions_cache)
+                entry.path.clear();
+        }
     };
 
     auto& unveil_data() { return m_unveil_data; }
@@ -858,6 +889,7 @@ private:
 
     bool const m_is_kernel_process;
     Atomic<State> m_state { State::Running };
+    Atomic<u64> m_statistics_sequence { 0 };
     bool m_profiling { false };
     Atomic<bool, AK::MemoryOrder::memory_order_relaxed> m_is_stopped { false };
     bool m_should_generate_coredump { false };
@@ -117,12 +117,14 @@ ErrorOr<size_t> ProcFSExposedLink::read_bytes(off_t offset, size_t count, UserOr
     auto builder = TRY(KBufferBuilder::try_create());
     if (!const_cast<ProcFSExposedLink&>(*this).acquire_link(builder))
         return Error::from_errno(EFAULT);
-    auto blob = builder.build();
-    if (!blob)
+    if (!builder.flush())
         return Error::from_errno(EFAULT);
 
-    ssize_t nread = min(static_cast<off_t>(blob->size() - offset), static_cast<off_t>(count));
-    TRY(buffer.write(blob->data() + offset, nread));
+    // NOTE: Copy out of the builder instead of build()ing a KBuffer, so the
+    //       backing buffer goes back to the builder pool when we return.
+    auto bytes = builder.bytes();
+    ssize_t nread = min(static_cast<off_t>(bytes.size() - offset), static_cast<off_t>(count));
+    TRY(buffer.write(bytes.data() + offset, nread));
     return nread;
 }
 
@@ -93,6 +93,41 @@ void KernelRng::wake_if_ready()
 
 size_t EntropySource::next_source { static_cast<size_t>(EntropySource::Static::MaxHardcodedSourceIndex) };
 
+// Entropy events (often raised from interrupt handlers) accumulate in a
+// per-processor pool and only take the global KernelRng lock when a batch is
+// flushed. We don't lock the per-processor mixing itself: a race with an
+// interrupt on the same processor at worst scrambles the pool some more,
+// entropy isn't lost.
+struct FastEntropyPool {
+    u64 words[4] {};
+    size_t event_count { 0 };
+    size_t fold_cursor { 0 };
+};
+static constexpr size_t fast_entropy_pool_fold_threshold = 32;
+static FastEntropyPool s_fast_entropy_pools[MAX_CPU_COUNT];
+
+void add_entropy_event_to_fast_pool(u64 folded_event)
+{
+    auto& pool = s_fast_entropy_pools[Processor::current_id()];
+
+    pool.words[0] ^= folded_event;
+    pool.words[1] += pool.words[0];
+    pool.words[0] = pool.words[0] << 29 | pool.words[0] >> 35;
+    pool.words[2] ^= pool.words[1];
+    pool.words[3] += pool.words[2];
+    pool.words[2] = pool.words[2] << 17 | pool.words[2] >> 47;
+    pool.words[3] ^= pool.words[0];
+
+    if (++pool.event_count < fast_entropy_pool_fold_threshold)
+        return;
+    pool.event_count = 0;
+
+    auto& kernel_rng = KernelRng::the();
+    SpinlockLocker lock(kernel_rng.get_lock());
+    kernel_rng.add_random_event(pool.words, pool.fold_cursor++);
+    kernel_rng.wake_if_ready();
+}
+
 static void do_get_fast_random_bytes(Bytes buffer)
 {
 
@@ -157,10 +192,42 @@ bool get_good_random_bytes(Bytes buffer, bool allow_wait, bool fallback_to_fast)
     return result;
 }
 
+// Small non-blocking requests are served from a per-processor buffer of
+// KernelRng output; the global lock is only taken to refill the buffer once
+// it runs dry. The per-processor spinlock is effectively uncontended (and
+// keeps interrupt handlers on the same processor from handing out the same
+// bytes twice), so these reads don't bounce a shared cache line around.
+struct FastRandomStream {
+    Spinlock lock { LockRank::None };
+    u8 buffer[256] {};
+    size_t position { sizeof(buffer) };
+};
+static FastRandomStream s_fast_random_streams[MAX_CPU_COUNT];
+
 void get_fast_random_bytes(Bytes buffer)
 {
-    // Try to get good randomness, but don't block if we can't right now
-    // and allow falling back to fast randomness
+    // If we get preempted and migrated between the lookup and the lock, we
+    // just briefly share another processor's stream; that's still correct.
+    auto& stream = s_fast_random_streams[Processor::current_id()];
+    SpinlockLocker lock(stream.lock);
+
+    if (buffer.size() <= sizeof(stream.buffer)) {
+        if (stream.position + buffer.size() > sizeof(stream.buffer)) {
+            if (KernelRng::the().get_random_bytes({ stream.buffer, sizeof(stream.buffer) }))
+                stream.position = 0;
+        }
+        if (stream.position + buffer.size() <= sizeof(stream.buffer)) {
+            memcpy(buffer.data(), stream.buffer + stream.position, buffer.size());
+            // Scrub what we handed out so stale output never lingers.
+            memset(stream.buffer + stream.position, 0, buffer.size());
+            stream.position += buffer.size();
+            return;
+        }
+    }
+
+    // Requests larger than the buffer (or made before the rng is seeded) take
+    // the old path: try to get good randomness without blocking, and allow
+    // falling back to fast randomness.
     auto result = get_good_random_bytes(buffer, false, true);
     VERIFY(result);
 }
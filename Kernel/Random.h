@@ -134,6 +134,11 @@ private:
     WaitQueue m_seed_queue;
 };
 
+// Mixes a folded entropy event into the current processor's fast pool. Once
+// enough events have accumulated there, they are flushed into the KernelRng
+// pools in one go under the global lock.
+void add_entropy_event_to_fast_pool(u64 folded_event);
+
 class EntropySource {
     template<typename T>
     struct Event {
@@ -161,18 +166,19 @@ public:
     template<typename T>
     void add_random_event(T const& event_data)
     {
-        auto& kernel_rng = KernelRng::the();
-        SpinlockLocker lock(kernel_rng.get_lock());
-        // We don't lock this because on the off chance a pool is corrupted, entropy isn't lost.
+        // Instead of taking the global KernelRng lock for every event, fold
+        // the event down to a word and mix it into this processor's fast
+        // pool; the fast pool is periodically flushed into the Fortuna pools.
         Event<T> event = { Processor::read_cpu_counter(), m_source, event_data };
-        kernel_rng.add_random_event(event, m_pool);
-        m_pool++;
-        kernel_rng.wake_if_ready();
+        auto const* bytes = reinterpret_cast<u8 const*>(&event);
+        u64 folded = 0xcbf29ce484222325ull;
+        for (size_t i = 0; i < sizeof(event); ++i)
+            folded = (folded ^ bytes[i]) * 0x100000001b3ull;
+        add_entropy_event_to_fast_pool(folded);
     }
 
 private:
     static size_t next_source;
-    size_t m_pool { 0 };
     size_t m_source;
 };
 
@@ -6,7 +6,6 @@
 
 #include <AK/BuiltinWrappers.h>
 #include <AK/ScopeGuard.h>
-#include <AK/Singleton.h>
 #include <AK/Time.h>
 #include <Kernel/Arch/TrapFrame.h>
 #include <Kernel/Debug.h>
@@ -41,12 +40,17 @@ struct ThreadReadyQueue {
 };
 
 struct ThreadReadyQueues {
+    Spinlock lock { LockRank::None };
     u32 mask {};
     static constexpr size_t count = sizeof(mask) * 8;
     Array<ThreadReadyQueue, count> queues;
 };
 
-static Singleton<SpinlockProtected<ThreadReadyQueues>> g_ready_queues;
+// One set of priority-bucketed ready queues per processor. A thread is queued
+// on the processor that made it runnable (or the first processor in its
+// affinity mask), and a processor whose own queues are empty steals runnable
+// threads from its siblings in pull_next_runnable_thread().
+static ThreadReadyQueues s_ready_queues[KERNEL_MAX_CPU_COUNT];
 
 static SpinlockProtected<TotalTimeScheduled> g_total_time_scheduled { LockRank::None };
 
@@ -55,7 +59,7 @@ static void dump_thread_list(bool = false);
 static inline u32 thread_priority_to_priority_index(u32 thread_priority)
 {
     // Converts the priority in the range of THREAD_PRIORITY_MIN...THREAD_PRIORITY_MAX
-    // to a index into g_ready_queues where 0 is the highest priority bucket
+    // to a index into s_ready_queues where 0 is the highest priority bucket
     VERIFY(thread_priority >= THREAD_PRIORITY_MIN && thread_priority <= THREAD_PRIORITY_MAX);
     constexpr u32 thread_priority_count = THREAD_PRIORITY_MAX - THREAD_PRIORITY_MIN + 1;
     static_assert(thread_priority_count > 0);
@@ -66,9 +70,15 @@ static inline u32 thread_priority_to_priority_index(u32 thread_priority)
 
 Thread& Scheduler::pull_next_runnable_thread()
 {
-    auto affinity_mask = 1u << Processor::current_id();
-
-    return g_ready_queues->with([&](auto& ready_queues) -> Thread& {
+    auto current_id = Processor::current_id();
+    auto affinity_mask = 1u << current_id;
+    auto processor_count = Processor::count();
+
+    // Check our own ready queues first; if they hold nothing runnable for us,
+    // go around and steal from the other processors' queues.
+    for (u32 i = 0; i < processor_count; ++i) {
+        auto& ready_queues = s_ready_queues[(current_id + i) % processor_count];
+        SpinlockLocker locker(ready_queues.lock);
         auto priority_mask = ready_queues.mask;
         while (priority_mask != 0) {
             auto priority = bit_scan_forward(priority_mask);
@@ -99,15 +109,19 @@ Thread& Scheduler::pull_next_runnable_thread()
             }
             priority_mask &= ~(1u << priority);
         }
-        return *Processor::idle_thread();
-    });
+    }
+    return *Processor::idle_thread();
 }
 
 Thread* Scheduler::peek_next_runnable_thread()
 {
-    auto affinity_mask = 1u << Processor::current_id();
+    auto current_id = Processor::current_id();
+    auto affinity_mask = 1u << current_id;
+    auto processor_count = Processor::count();
 
-    return g_ready_queues->with([&](auto& ready_queues) -> Thread* {
+    for (u32 i = 0; i < processor_count; ++i) {
+        auto& ready_queues = s_ready_queues[(current_id + i) % processor_count];
+        SpinlockLocker locker(ready_queues.lock);
         auto priority_mask = ready_queues.mask;
         while (priority_mask != 0) {
             auto priority = bit_scan_forward(priority_mask);
@@ -123,12 +137,12 @@ Thread* Scheduler::peek_next_runnable_thread()
             }
             priority_mask &= ~(1u << priority);
         }
+    }
 
-        // Unlike in pull_next_runnable_thread() we don't want to fall back to
-        // the idle thread. We just want to see if we have any other thread ready
-        // to be scheduled.
-        return nullptr;
-    });
+    // Unlike in pull_next_runnable_thread() we don't want to fall back to
+    // the idle thread. We just want to see if we have any other thread ready
+    // to be scheduled.
+    return nullptr;
 }
 
 bool Scheduler::dequeue_runnable_thread(Thread& thread, bool check_affinity)
@@ -136,24 +150,24 @@ bool Scheduler::dequeue_runnable_thread(Thread& thread, bool check_affinity)
     if (thread.is_idle_thread())
         return true;
 
-    return g_ready_queues->with([&](auto& ready_queues) {
-        auto priority = thread.m_runnable_priority;
-        if (priority < 0) {
-            VERIFY(!thread.m_ready_queue_node.is_in_list());
-            return false;
-        }
+    auto& ready_queues = s_ready_queues[thread.m_ready_queue_processor];
+    SpinlockLocker locker(ready_queues.lock);
+    auto priority = thread.m_runnable_priority;
+    if (priority < 0) {
+        VERIFY(!thread.m_ready_queue_node.is_in_list());
+        return false;
+    }
 
-        if (check_affinity && !(thread.affinity() & (1 << Processor::current_id())))
-            return false;
+    if (check_affinity && !(thread.affinity() & (1 << Processor::current_id())))
+        return false;
 
-        VERIFY(ready_queues.mask & (1u << priority));
-        auto& ready_queue = ready_queues.queues[priority];
-        thread.m_runnable_priority = -1;
-        ready_queue.thread_list.remove(thread);
-        if (ready_queue.thread_list.is_empty())
-            ready_queues.mask &= ~(1u << priority);
-        return true;
-    });
+    VERIFY(ready_queues.mask & (1u << priority));
+    auto& ready_queue = ready_queues.queues[priority];
+    thread.m_runnable_priority = -1;
+    ready_queue.thread_list.remove(thread);
+    if (ready_queue.thread_list.is_empty())
+        ready_queues.mask &= ~(1u << priority);
+    return true;
 }
 
 void Scheduler::enqueue_runnable_thread(Thread& thread)
@@ -163,16 +177,27 @@ void Scheduler::enqueue_runnable_thread(Thread& thread)
         return;
     auto priority = thread_priority_to_priority_index(thread.priority());
 
-    g_ready_queues->with([&](auto& ready_queues) {
-        VERIFY(thread.m_runnable_priority < 0);
-        thread.m_runnable_priority = (int)priority;
-        VERIFY(!thread.m_ready_queue_node.is_in_list());
-        auto& ready_queue = ready_queues.queues[priority];
-        bool was_empty = ready_queue.thread_list.is_empty();
-        ready_queue.thread_list.append(thread);
-        if (was_empty)
-            ready_queues.mask |= (1u << priority);
-    });
+    // Queue on the current processor if the thread may run here; otherwise on
+    // the first processor in its affinity mask.
+    auto target_processor = Processor::current_id();
+    if (!(thread.affinity() & (1u << target_processor))) {
+        auto processor_count = Processor::count();
+        auto usable_affinity = thread.affinity() & (processor_count >= 32 ? 0xffffffffu : ((1u << processor_count) - 1));
+        if (usable_affinity != 0)
+            target_processor = bit_scan_forward(usable_affinity) - 1;
+    }
+
+    auto& ready_queues = s_ready_queues[target_processor];
+    SpinlockLocker locker(ready_queues.lock);
+    VERIFY(thread.m_runnable_priority < 0);
+    thread.m_runnable_priority = (int)priority;
+    thread.m_ready_queue_processor = target_processor;
+    VERIFY(!thread.m_ready_queue_node.is_in_list());
+    auto& ready_queue = ready_queues.queues[priority];
+    bool was_empty = ready_queue.thread_list.is_empty();
+    ready_queue.thread_list.append(thread);
+    if (was_empty)
+        ready_queues.mask |= (1u << priority);
 }
 
 UNMAP_AFTER_INIT void Scheduler::start()
@@ -308,6 +333,7 @@ void Scheduler::enter_current(Thread& prev_thread)
     prev_thread.update_time_scheduled(scheduler_time, true, true);
     auto* current_thread = Thread::current();
     current_thread->update_time_scheduled(scheduler_time, true, false);
+    current_thread->record_scheduling_latency(scheduler_time);
 
     // NOTE: When doing an exec(), we will context switch from and to the same thread!
     //       In that case, we must not mark the previous thread as inactive.
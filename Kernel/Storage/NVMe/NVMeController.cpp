@@ -59,6 +59,11 @@ UNMAP_AFTER_INIT ErrorOr<void> NVMeController::initialize(bool is_queue_polled)
     VERIFY(IO_QUEUE_SIZE < MQES(caps));
     dbgln_if(NVME_DEBUG, "NVMe: IO queue depth is: {}", IO_QUEUE_SIZE);
 
+    // The controller decides how many queue pairs it can actually back; ask
+    // for one per core and clamp to what it grants, so the Create Queue
+    // commands below can't fail on controllers with fewer queues than cores.
+    nr_of_queues = min(nr_of_queues, TRY(set_io_queue_count(nr_of_queues)));
+
     // Create an IO queue per core
     for (u32 cpuid = 0; cpuid < nr_of_queues; ++cpuid) {
         // qid is zero is used for admin queue
@@ -295,6 +300,26 @@ UNMAP_AFTER_INIT ErrorOr<void> NVMeController::create_admin_queue(Optional<u8> i
     return {};
 }
 
+UNMAP_AFTER_INIT ErrorOr<u32> NVMeController::set_io_queue_count(u32 requested_count)
+{
+    // Number of Queues feature: both counts are 0-based and exclude the admin
+    // queue. The completion's dword0 reports how many submission and
+    // completion queues the controller actually allocated.
+    NVMeSubmission sub {};
+    sub.op = OP_ADMIN_SET_FEATURES;
+    sub.generic.cdw10 = AK::convert_between_host_and_little_endian(static_cast<u32>(FID_NUMBER_OF_QUEUES));
+    sub.generic.cdw11 = AK::convert_between_host_and_little_endian(((requested_count - 1) << 16) | (requested_count - 1));
+
+    u32 allocated_queues = 0;
+    if (submit_admin_command(sub, true, &allocated_queues) != 0) {
+        dbgln("NVMe: Set Features (Number of Queues) failed");
+        return EIO;
+    }
+    u32 allocated_sq_count = (allocated_queues & 0xffff) + 1;
+    u32 allocated_cq_count = (allocated_queues >> 16) + 1;
+    return min(allocated_sq_count, allocated_cq_count);
+}
+
 UNMAP_AFTER_INIT ErrorOr<void> NVMeController::create_io_queue(u8 qid, Optional<u8> irq)
 {
     OwnPtr<Memory::Region> cq_dma_region;
@@ -41,11 +41,11 @@ public:
     bool start_controller();
     u32 get_admin_q_dept();
 
-    u16 submit_admin_command(NVMeSubmission& sub, bool sync = false)
+    u16 submit_admin_command(NVMeSubmission& sub, bool sync = false, u32* completion_dw0 = nullptr)
     {
         // First queue is always the admin queue
         if (sync) {
-            return m_admin_queue->submit_sync_sqe(sub);
+            return m_admin_queue->submit_sync_sqe(sub, completion_dw0);
         }
         m_admin_queue->submit_sqe(sub);
         return 0;
@@ -61,6 +61,7 @@ private:
     Tuple<u64, u8> get_ns_features(IdentifyNamespace& identify_data_struct);
     ErrorOr<void> create_admin_queue(Optional<u8> irq);
     ErrorOr<void> create_io_queue(u8 qid, Optional<u8> irq);
+    ErrorOr<u32> set_io_queue_count(u32 requested_count);
     void calculate_doorbell_stride()
     {
         m_dbl_stride = (m_controller_regs->cap >> CAP_DBL_SHIFT) & CAP_DBL_MASK;
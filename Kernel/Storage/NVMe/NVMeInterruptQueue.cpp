@@ -20,6 +20,14 @@ UNMAP_AFTER_INIT NVMeInterruptQueue::NVMeInterruptQueue(NonnullOwnPtr<Memory::Re
 
 bool NVMeInterruptQueue::handle_irq(RegisterState const&)
 {
+    // All I/O queues share the controller's pin-based interrupt line, so every
+    // interrupt invokes every queue's handler. Peek at the phase tag before
+    // taking any locks, so queues with nothing completed stay off each other's
+    // cachelines. This is safe without the lock: only this handler advances
+    // the completion queue head, and handlers for one line don't run
+    // concurrently with themselves.
+    if (!cqe_available())
+        return false;
     SpinlockLocker lock(m_request_lock);
     return process_cq() ? true : false;
 }
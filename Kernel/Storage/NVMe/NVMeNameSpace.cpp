@@ -27,7 +27,8 @@ UNMAP_AFTER_INIT NVMeNameSpace::NVMeNameSpace(LUNAddress logical_unit_number_add
 
 void NVMeNameSpace::start_request(AsyncBlockDeviceRequest& request)
 {
-    auto index = Processor::current_id();
+    // The controller may have granted us fewer queues than there are cores.
+    auto index = Processor::current_id() % m_queues.size();
     auto& queue = m_queues.at(index);
     // TODO: For now we support only IO transfers of size PAGE_SIZE (Going along with the current constraint in the block layer)
     // Eventually remove this constraint by using the PRP2 field in the submission struct and remove block layer constraint for NVMe driver.
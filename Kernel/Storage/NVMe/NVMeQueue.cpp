@@ -110,15 +110,15 @@ void NVMeQueue::submit_sqe(NVMeSubmission& sub)
     update_sq_doorbell();
 }
 
-u16 NVMeQueue::submit_sync_sqe(NVMeSubmission& sub)
+u16 NVMeQueue::submit_sync_sqe(NVMeSubmission& sub, u32* completion_dw0)
 {
     // For now let's use sq tail as a unique command id.
     u16 cqe_cid;
     u16 cid = m_sq_tail;
+    int index = 0;
 
     submit_sqe(sub);
     do {
-        int index;
         {
             SpinlockLocker lock(m_cq_lock);
             index = m_cq_head - 1;
@@ -129,6 +129,8 @@ u16 NVMeQueue::submit_sync_sqe(NVMeSubmission& sub)
         microseconds_delay(1);
     } while (cid != cqe_cid);
 
+    if (completion_dw0)
+        *completion_dw0 = m_cqe_array[index].cmd_spec;
     auto status = CQ_STATUS_FIELD(m_cqe_array[m_cq_head].status);
     return status;
 }
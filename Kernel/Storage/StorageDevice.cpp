@@ -15,10 +15,15 @@
 #include <Kernel/FileSystem/SysFS/Subsystems/Devices/Storage/Directory.h>
 #include <Kernel/Storage/StorageDevice.h>
 #include <Kernel/Storage/StorageManagement.h>
+#include <Kernel/Time/TimeManagement.h>
 #include <LibC/sys/ioctl_numbers.h>
 
 namespace Kernel {
 
+// Deadline-style scheduling parameters (see select_next_queued_request()).
+static constexpr Time read_request_deadline = Time::from_milliseconds(500);
+static constexpr Time write_request_deadline = Time::from_seconds(5);
+
 StorageDevice::StorageDevice(LUNAddress logical_unit_number_address, u32 hardware_relative_controller_id, size_t sector_size, u64 max_addressable_block)
     : BlockDevice(StorageManagement::storage_type_major_number(), StorageManagement::generate_storage_minor_number(), sector_size)
     , m_logical_unit_number_address(logical_unit_number_address)
@@ -37,6 +42,60 @@ StorageDevice::StorageDevice(Badge<RamdiskDevice>, LUNAddress logical_unit_numbe
 {
 }
 
+void StorageDevice::select_next_queued_request(DoublyLinkedList<LockRefPtr<AsyncDeviceRequest>>& requests, AsyncDeviceRequest const& just_completed)
+{
+    // Elevator scheduling: sweep upwards across the device, servicing the
+    // pending request that starts closest to where the previous one ended,
+    // and wrap around to the lowest block once nothing lies ahead. This keeps
+    // mixed random I/O from ping-ponging the head the way FIFO order does.
+    // Every queued request on a storage device is an AsyncBlockDeviceRequest.
+    //
+    // To keep a steady stream of nearby requests (say, a background cp) from
+    // starving requests elsewhere on the disk (an interactive app's page
+    // faults), each request also carries a deadline; once one expires, the
+    // longest-expired request is serviced next regardless of head position.
+    // Reads get a short deadline since something usually waits on them,
+    // writes a longer one.
+    auto const& completed_block_request = static_cast<AsyncBlockDeviceRequest const&>(just_completed);
+    u64 current_position = completed_block_request.block_index() + completed_block_request.block_count();
+    auto now = TimeManagement::the().monotonic_time();
+
+    auto best = requests.end();
+    bool best_is_ahead = false;
+    bool best_is_expired = false;
+    u64 best_block_index = 0;
+    Time best_deadline {};
+    for (auto it = requests.begin(); it != requests.end(); ++it) {
+        auto const& request = static_cast<AsyncBlockDeviceRequest const&>(**it);
+        auto deadline = request.enqueue_time() + (request.request_type() == AsyncBlockDeviceRequest::Read ? read_request_deadline : write_request_deadline);
+        bool is_expired = deadline < now;
+        bool is_ahead = request.block_index() >= current_position;
+        bool is_better;
+        if (best == requests.end())
+            is_better = true;
+        else if (is_expired != best_is_expired)
+            is_better = is_expired;
+        else if (is_expired)
+            is_better = deadline < best_deadline;
+        else if (is_ahead != best_is_ahead)
+            is_better = is_ahead;
+        else
+            is_better = request.block_index() < best_block_index;
+        if (is_better) {
+            best = it;
+            best_is_ahead = is_ahead;
+            best_is_expired = is_expired;
+            best_block_index = request.block_index();
+            best_deadline = deadline;
+        }
+    }
+
+    if (best == requests.begin())
+        return;
+    // Swap values instead of relinking nodes; that way nothing can fail here.
+    swap(*best, *requests.begin());
+}
+
 void StorageDevice::after_inserting()
 {
     after_inserting_add_to_device_management();
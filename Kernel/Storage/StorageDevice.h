@@ -91,6 +91,9 @@ private:
     virtual void after_inserting() override;
     virtual void will_be_destroyed() override;
 
+    // ^Device
+    virtual void select_next_queued_request(DoublyLinkedList<LockRefPtr<AsyncDeviceRequest>>&, AsyncDeviceRequest const& just_completed) override;
+
     mutable IntrusiveListNode<StorageDevice, LockRefPtr<StorageDevice>> m_list_node;
     NonnullLockRefPtrVector<DiskPartition> m_partitions;
 
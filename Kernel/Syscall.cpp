@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BuiltinWrappers.h>
 #include <Kernel/API/Syscall.h>
 #include <Kernel/Arch/TrapFrame.h>
 #include <Kernel/Arch/x86/Interrupts.h>
@@ -14,7 +15,9 @@
 #include <Kernel/Process.h>
 #include <Kernel/Scheduler.h>
 #include <Kernel/Sections.h>
+#include <Kernel/SyscallLatency.h>
 #include <Kernel/ThreadTracer.h>
+#include <Kernel/Time/TimeManagement.h>
 
 namespace Kernel {
 
@@ -81,6 +84,37 @@ NEVER_INLINE NAKED void syscall_asm_entry()
     // clang-format on
 }
 
+namespace SyscallLatency {
+
+static Atomic<bool> s_tracking_enabled { false };
+static Atomic<u64> s_buckets[Syscall::Function::__Count][bucket_count];
+
+bool is_tracking_enabled()
+{
+    return s_tracking_enabled.load(AK::MemoryOrder::memory_order_relaxed);
+}
+
+void set_tracking_enabled(bool enabled)
+{
+    s_tracking_enabled.store(enabled, AK::MemoryOrder::memory_order_relaxed);
+}
+
+u64 bucket_value(Syscall::Function function, size_t bucket)
+{
+    return s_buckets[function][bucket].load(AK::MemoryOrder::memory_order_relaxed);
+}
+
+static void record(FlatPtr function, u64 elapsed_nanoseconds)
+{
+    u64 elapsed_microseconds = elapsed_nanoseconds / 1000;
+    size_t bucket = 0;
+    if (elapsed_microseconds != 0)
+        bucket = min(bucket_count - 1, sizeof(u64) * 8 - count_leading_zeroes(elapsed_microseconds));
+    s_buckets[function][bucket].fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+}
+
+}
+
 namespace Syscall {
 
 static ErrorOr<FlatPtr> handle(RegisterState&, FlatPtr function, FlatPtr arg1, FlatPtr arg2, FlatPtr arg3, FlatPtr arg4);
@@ -124,6 +158,14 @@ ErrorOr<FlatPtr> handle(RegisterState& regs, FlatPtr function, FlatPtr arg1, Fla
         return ENOSYS;
     }
 
+    // Time from here until the handler returns, so that waiting for the big
+    // process lock counts towards the syscall's latency. SC_exit and
+    // SC_exit_thread never return and therefore never produce a sample.
+    u64 latency_start_time = 0;
+    bool const track_latency = SyscallLatency::is_tracking_enabled();
+    if (track_latency)
+        latency_start_time = TimeManagement::scheduler_current_time();
+
     MutexLocker mutex_locker;
     auto const needs_big_lock = syscall_metadata.needs_lock == NeedsBigProcessLock::Yes;
     if (needs_big_lock) {
@@ -159,6 +201,12 @@ ErrorOr<FlatPtr> handle(RegisterState& regs, FlatPtr function, FlatPtr arg1, Fla
         result = (process.*(syscall_metadata.handler))(arg1, arg2, arg3, arg4);
     }
 
+    if (track_latency) {
+        u64 end_time = TimeManagement::scheduler_current_time();
+        if (end_time >= latency_start_time)
+            SyscallLatency::record(function, end_time - latency_start_time);
+    }
+
     return result;
 }
 
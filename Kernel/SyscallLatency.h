@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+#include <Kernel/API/Syscall.h>
+
+namespace Kernel::SyscallLatency {
+
+// Log-bucketed latency histograms, one per syscall number: bucket i counts
+// syscalls that took [2^(i-1), 2^i) microseconds from dispatch to return,
+// with sub-microsecond calls in bucket 0 and everything slower than the
+// range in the last bucket. Tracking is off by default and can be toggled
+// at runtime through /sys/kernel/variables/track_syscall_latency; while it
+// is off the only cost in the syscall path is one relaxed atomic load and
+// a predictable branch.
+static constexpr size_t bucket_count = 16;
+
+bool is_tracking_enabled();
+void set_tracking_enabled(bool);
+
+// NOTE: The counters only ever increase, and readers don't synchronize
+// with the syscall path beyond relaxed atomic loads.
+u64 bucket_value(Syscall::Function, size_t bucket);
+
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Time.h>
+#include <Kernel/FileSystem/EventQueue.h>
+#include <Kernel/FileSystem/OpenFileDescription.h>
+#include <Kernel/Process.h>
+
+namespace Kernel {
+
+using BlockFlags = Thread::FileBlocker::BlockFlags;
+
+ErrorOr<FlatPtr> Process::sys$event_queue_create()
+{
+    VERIFY_PROCESS_BIG_LOCK_ACQUIRED(this);
+    TRY(require_promise(Pledge::stdio));
+
+    auto fd_allocation = TRY(allocate_fd());
+    auto queue = TRY(EventQueue::try_create());
+    auto description = TRY(OpenFileDescription::try_create(move(queue)));
+
+    return m_fds.with_exclusive([&](auto& fds) -> ErrorOr<FlatPtr> {
+        fds[fd_allocation.fd].set(move(description));
+        fds[fd_allocation.fd].set_flags(fds[fd_allocation.fd].flags() | FD_CLOEXEC);
+        return fd_allocation.fd;
+    });
+}
+
+ErrorOr<FlatPtr> Process::sys$event_queue_ctl(int queue_fd, int operation, int fd, u32 events)
+{
+    VERIFY_PROCESS_BIG_LOCK_ACQUIRED(this);
+    TRY(require_promise(Pledge::stdio));
+
+    auto queue_description = TRY(open_file_description(queue_fd));
+    if (!queue_description->is_event_queue())
+        return EBADF;
+    auto* queue = queue_description->event_queue();
+
+    switch (static_cast<EventQueueOperation>(operation)) {
+    case EventQueueOperation::Add: {
+        auto description = TRY(open_file_description(fd));
+        // Registering a queue into a queue (including itself, through any
+        // dup'ed fd) would create a strong reference the kernel never
+        // breaks, since registrations are only dropped when the description
+        // is destroyed. Reject any nesting, like Linux does for epoll.
+        if (description->is_event_queue())
+            return ELOOP;
+        TRY(queue->register_fd(fd, move(description), events));
+        return 0;
+    }
+    case EventQueueOperation::Modify:
+        TRY(queue->modify_fd(fd, events));
+        return 0;
+    case EventQueueOperation::Remove:
+        TRY(queue->unregister_fd(fd));
+        return 0;
+    default:
+        return EINVAL;
+    }
+}
+
+ErrorOr<FlatPtr> Process::sys$event_queue_wait(Userspace<Syscall::SC_event_queue_wait_params const*> user_params)
+{
+    VERIFY_PROCESS_BIG_LOCK_ACQUIRED(this);
+    TRY(require_promise(Pledge::stdio));
+
+    auto params = TRY(copy_typed_from_user(user_params));
+    if (params.max_events == 0)
+        return EINVAL;
+
+    auto queue_description = TRY(open_file_description(params.queue_fd));
+    if (!queue_description->is_event_queue())
+        return EBADF;
+    auto* queue = queue_description->event_queue();
+
+    Thread::BlockTimeout timeout;
+    if (params.timeout) {
+        auto timeout_time = TRY(copy_time_from_user(params.timeout));
+        timeout = Thread::BlockTimeout(false, &timeout_time);
+    }
+
+    Thread::SelectBlocker::FDVector fds_info;
+    Vector<int> fds;
+    TRY(queue->collect_registrations(fds_info, fds));
+
+    if (Thread::current()->block<Thread::SelectBlocker>(timeout, fds_info).was_interrupted())
+        return EINTR;
+
+    size_t ready_count = 0;
+    for (size_t i = 0; i < fds_info.size() && ready_count < params.max_events; ++i) {
+        auto& fds_entry = fds_info[i];
+        if (fds_entry.unblocked_flags == BlockFlags::None)
+            continue;
+
+        EventQueueEvent event;
+        event.fd = fds[i];
+        event.events = EventQueueEvent::None;
+        if (has_flag(fds_entry.unblocked_flags, BlockFlags::Read))
+            event.events |= EventQueueEvent::Read;
+        if (!has_flag(fds_entry.unblocked_flags, BlockFlags::WriteHangUp) && has_flag(fds_entry.unblocked_flags, BlockFlags::Write))
+            event.events |= EventQueueEvent::Write;
+        if (has_flag(fds_entry.unblocked_flags, BlockFlags::WriteError))
+            event.events |= EventQueueEvent::Error;
+        if (has_flag(fds_entry.unblocked_flags, BlockFlags::WriteHangUp))
+            event.events |= EventQueueEvent::HangUp;
+        if (event.events == EventQueueEvent::None)
+            continue;
+
+        TRY(copy_to_user(&params.events[ready_count], &event));
+        ++ready_count;
+    }
+
+    return ready_count;
+}
+
+}
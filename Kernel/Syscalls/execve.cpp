@@ -583,6 +583,7 @@ ErrorOr<void> Process::do_exec(NonnullLockRefPtr<OpenFileDescription> main_progr
                 unveil_data.paths.clear();
                 unveil_data.paths.set_metadata({ TRY(KString::try_create("/"sv)), UnveilAccess::None, false });
             }
+            unveil_data.flush_permissions_cache();
             exec_unveil_data.paths.clear();
             exec_unveil_data.paths.set_metadata({ TRY(KString::try_create("/"sv)), UnveilAccess::None, false });
             return {};
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/NumericLimits.h>
+#include <Kernel/API/IOBatch.h>
+#include <Kernel/FileSystem/OpenFileDescription.h>
+#include <Kernel/Process.h>
+
+namespace Kernel {
+
+using BlockFlags = Thread::FileBlocker::BlockFlags;
+
+static ErrorOr<size_t> do_batched_read(OpenFileDescription& description, UserOrKernelBuffer& buffer, size_t buffer_size)
+{
+    if (!description.is_readable())
+        return EBADF;
+    if (description.is_directory())
+        return EISDIR;
+    if (description.is_blocking() && !description.can_read()) {
+        auto unblock_flags = BlockFlags::None;
+        if (Thread::current()->block<Thread::ReadBlocker>({}, description, unblock_flags).was_interrupted())
+            return EINTR;
+        if (!has_flag(unblock_flags, BlockFlags::Read))
+            return EAGAIN;
+    }
+    return description.read(buffer, buffer_size);
+}
+
+ErrorOr<FlatPtr> Process::sys$iobatch(Userspace<IOBatchOp*> user_ops, size_t op_count)
+{
+    VERIFY_PROCESS_BIG_LOCK_ACQUIRED(this);
+    TRY(require_promise(Pledge::stdio));
+
+    if (op_count == 0)
+        return 0;
+    if (op_count > max_iobatch_op_count)
+        return EINVAL;
+
+    Vector<IOBatchOp, 16> ops;
+    TRY(ops.try_resize(op_count));
+    TRY(copy_n_from_user(ops.data(), user_ops, op_count));
+
+    for (auto& op : ops) {
+        auto result = [&]() -> ErrorOr<size_t> {
+            if (op.buffer_size == 0)
+                return 0;
+            if (op.buffer_size > NumericLimits<ssize_t>::max())
+                return EINVAL;
+            auto description = TRY(open_file_description(op.fd));
+            auto buffer = TRY(UserOrKernelBuffer::for_user_buffer(static_cast<u8*>(op.buffer), op.buffer_size));
+            switch (static_cast<IOBatchOperation>(op.operation)) {
+            case IOBatchOperation::Read:
+                return do_batched_read(*description, buffer, op.buffer_size);
+            case IOBatchOperation::Write:
+                if (!description->is_writable())
+                    return EBADF;
+                return TRY(do_write(*description, buffer, op.buffer_size));
+            default:
+                return EINVAL;
+            }
+        }();
+        if (result.is_error())
+            op.result = -result.error().code();
+        else
+            op.result = static_cast<ssize_t>(result.value());
+    }
+
+    TRY(copy_n_to_user(user_ops.unsafe_userspace_ptr(), ops.data(), op_count));
+    return op_count;
+}
+
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2018-2022, Andreas Kling <kling@serenityos.org>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/NumericLimits.h>
+#include <Kernel/Debug.h>
+#include <Kernel/FileSystem/OpenFileDescription.h>
+#include <Kernel/Memory/MemoryManager.h>
+#include <Kernel/Memory/Region.h>
+#include <Kernel/Memory/SharedInodeVMObject.h>
+#include <Kernel/Process.h>
+
+namespace Kernel {
+
+// NOTE: The transfer is windowed so that we never map more than this much of
+//       the input file into kernel address space at once.
+static constexpr size_t max_window_size = 64 * PAGE_SIZE;
+
+ErrorOr<FlatPtr> Process::sys$sendfile(int out_fd, int in_fd, Userspace<off_t*> userspace_offset, size_t count)
+{
+    VERIFY_PROCESS_BIG_LOCK_ACQUIRED(this);
+    TRY(require_promise(Pledge::stdio));
+
+    if (count > NumericLimits<ssize_t>::max())
+        return EINVAL;
+
+    auto in_description = TRY(open_file_description(in_fd));
+    if (!in_description->is_readable())
+        return EBADF;
+    if (in_description->is_directory())
+        return EISDIR;
+    auto* inode = in_description->inode();
+    if (!inode || !in_description->file().is_seekable())
+        return EINVAL;
+
+    auto out_description = TRY(open_file_description(out_fd));
+    if (!out_description->is_writable())
+        return EBADF;
+
+    off_t offset = 0;
+    if (userspace_offset) {
+        offset = TRY(copy_typed_from_user(userspace_offset));
+        if (offset < 0)
+            return EINVAL;
+    } else {
+        offset = in_description->offset();
+    }
+
+    auto inode_size = inode->size();
+    if (count == 0 || static_cast<u64>(offset) >= inode_size)
+        return 0;
+    count = min(count, inode_size - static_cast<size_t>(offset));
+
+    dbgln_if(IO_DEBUG, "sys$sendfile({}, {}, {}, {})", out_fd, in_fd, offset, count);
+
+    auto vmobject = TRY(Memory::SharedInodeVMObject::try_create_with_inode(*inode));
+
+    size_t total_sent = 0;
+    Optional<Error> write_error;
+    while (total_sent < count) {
+        size_t remaining = count - total_sent;
+        size_t file_offset = static_cast<size_t>(offset) + total_sent;
+        size_t window_offset = Memory::page_round_down(file_offset);
+        size_t window_size = min<size_t>(TRY(Memory::page_round_up(file_offset + remaining)) - window_offset, max_window_size);
+        size_t chunk_size = min(remaining, window_offset + window_size - file_offset);
+
+        // Populate any missing pages of the shared VMObject (our page cache)
+        // up front, then map the window into kernel address space and stream
+        // straight from the cached pages into the output file description.
+        // This way the file contents never bounce through a userspace buffer.
+        TRY(vmobject->ensure_pages_present(window_offset / PAGE_SIZE, window_size / PAGE_SIZE));
+        auto region = TRY(MM.allocate_kernel_region_with_vmobject(*vmobject, window_size, "sendfile"sv, Memory::Region::Access::Read, Memory::Region::Cacheable::Yes, window_offset));
+
+        auto buffer = UserOrKernelBuffer::for_kernel_buffer(region->vaddr().offset(file_offset - window_offset).as_ptr());
+        auto result = do_write(*out_description, buffer, chunk_size);
+        if (result.is_error()) {
+            write_error = result.release_error();
+            break;
+        }
+        total_sent += result.value();
+        if (result.value() < chunk_size)
+            break;
+    }
+
+    if (write_error.has_value() && total_sent == 0)
+        return write_error.release_value();
+
+    if (userspace_offset) {
+        off_t new_offset = offset + total_sent;
+        TRY(copy_to_user(userspace_offset, &new_offset));
+    } else {
+        TRY(in_description->seek(total_sent, SEEK_CUR));
+    }
+
+    return total_sent;
+}
+
+}
@@ -178,13 +178,17 @@ ErrorOr<FlatPtr> Process::sys$sendmsg(int sockfd, Userspace<const struct msghdr*
     TRY(require_promise(Pledge::stdio));
     auto msg = TRY(copy_typed_from_user(user_msg));
 
-    if (msg.msg_iovlen != 1)
-        return ENOTSUP; // FIXME: Support this :)
+    if (msg.msg_iovlen < 1 || msg.msg_iovlen > IOV_MAX)
+        return EINVAL;
     Vector<iovec, 1> iovs;
     TRY(iovs.try_resize(msg.msg_iovlen));
     TRY(copy_n_from_user(iovs.data(), msg.msg_iov, msg.msg_iovlen));
-    if (iovs[0].iov_len > NumericLimits<ssize_t>::max())
-        return EINVAL;
+    u64 total_length = 0;
+    for (auto& iov : iovs) {
+        total_length += iov.iov_len;
+        if (total_length > NumericLimits<i32>::max())
+            return EINVAL;
+    }
 
     Userspace<sockaddr const*> user_addr((FlatPtr)msg.msg_name);
     socklen_t addr_length = msg.msg_namelen;
@@ -199,32 +203,54 @@ ErrorOr<FlatPtr> Process::sys$sendmsg(int sockfd, Userspace<const struct msghdr*
             Thread::current()->send_signal(SIGPIPE, &Process::current());
         return EPIPE;
     }
-    auto data_buffer = TRY(UserOrKernelBuffer::for_user_buffer((u8*)iovs[0].iov_base, iovs[0].iov_len));
 
-    while (true) {
-        while (!description->can_write()) {
-            if (!description->is_blocking()) {
-                return EAGAIN;
+    // FIXME: Gathering multiple iovecs into a single datagram needs assembly
+    //        in an intermediate buffer; only stream sockets get it for now.
+    if (msg.msg_iovlen != 1 && socket.type() != SOCK_STREAM)
+        return ENOTSUP;
+
+    size_t total_sent = 0;
+    for (auto& iov : iovs) {
+        if (iov.iov_len == 0)
+            continue;
+        auto data_buffer = TRY(UserOrKernelBuffer::for_user_buffer((u8*)iov.iov_base, iov.iov_len));
+
+        while (true) {
+            while (!description->can_write()) {
+                if (!description->is_blocking()) {
+                    if (total_sent > 0)
+                        return total_sent;
+                    return EAGAIN;
+                }
+
+                auto unblock_flags = Thread::FileBlocker::BlockFlags::None;
+                if (Thread::current()->block<Thread::WriteBlocker>({}, *description, unblock_flags).was_interrupted()) {
+                    if (total_sent > 0)
+                        return total_sent;
+                    return EINTR;
+                }
+                // TODO: handle exceptions in unblock_flags
             }
 
-            auto unblock_flags = Thread::FileBlocker::BlockFlags::None;
-            if (Thread::current()->block<Thread::WriteBlocker>({}, *description, unblock_flags).was_interrupted()) {
-                return EINTR;
+            auto bytes_sent_or_error = socket.sendto(*description, data_buffer, iov.iov_len, flags, user_addr, addr_length);
+            if (bytes_sent_or_error.is_error()) {
+                if ((flags & MSG_NOSIGNAL) == 0 && bytes_sent_or_error.error().code() == EPIPE)
+                    Thread::current()->send_signal(SIGPIPE, &Process::current());
+                if (total_sent > 0)
+                    return total_sent;
+                return bytes_sent_or_error.release_error();
             }
-            // TODO: handle exceptions in unblock_flags
-        }
 
-        auto bytes_sent_or_error = socket.sendto(*description, data_buffer, iovs[0].iov_len, flags, user_addr, addr_length);
-        if (bytes_sent_or_error.is_error()) {
-            if ((flags & MSG_NOSIGNAL) == 0 && bytes_sent_or_error.error().code() == EPIPE)
-                Thread::current()->send_signal(SIGPIPE, &Process::current());
-            return bytes_sent_or_error.release_error();
+            auto bytes_sent = bytes_sent_or_error.release_value();
+            if (bytes_sent > 0) {
+                total_sent += bytes_sent;
+                if (static_cast<size_t>(bytes_sent) < iov.iov_len)
+                    return total_sent;
+                break;
+            }
         }
-
-        auto bytes_sent = bytes_sent_or_error.release_value();
-        if (bytes_sent > 0)
-            return bytes_sent;
     }
+    return total_sent;
 }
 
 ErrorOr<FlatPtr> Process::sys$recvmsg(int sockfd, Userspace<struct msghdr*> user_msg, int flags)
@@ -56,6 +56,7 @@ static ErrorOr<void> update_unveil_data(Process::UnveilData& locked_unveil_data,
 
         matching_node.metadata_value().explicitly_unveiled = true;
         matching_node.metadata_value().permissions = new_permissions;
+        locked_unveil_data.flush_permissions_cache();
         locked_unveil_data.state = VeilState::Dropped;
         return {};
     }
@@ -71,6 +72,7 @@ static ErrorOr<void> update_unveil_data(Process::UnveilData& locked_unveil_data,
         }));
 
     VERIFY(locked_unveil_data.state != VeilState::Locked);
+    locked_unveil_data.flush_permissions_cache();
     locked_unveil_data.state = VeilState::Dropped;
     return {};
 }
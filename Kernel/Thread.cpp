@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BuiltinWrappers.h>
 #include <AK/ScopeGuard.h>
 #include <AK/Singleton.h>
 #include <AK/StringBuilder.h>
@@ -27,6 +28,7 @@
 #include <Kernel/Sections.h>
 #include <Kernel/Thread.h>
 #include <Kernel/ThreadTracer.h>
+#include <Kernel/Time/TimeManagement.h>
 #include <Kernel/TimerQueue.h>
 #include <Kernel/kstdio.h>
 #include <LibC/signal_numbers.h>
@@ -669,6 +671,21 @@ void Thread::update_time_scheduled(u64 current_scheduler_time, bool is_kernel, b
         m_last_time_scheduled = current_scheduler_time;
 }
 
+void Thread::record_scheduling_latency(u64 current_scheduler_time)
+{
+    if (m_ready_for_scheduling_time == 0)
+        return;
+    u64 ready_time = m_ready_for_scheduling_time;
+    m_ready_for_scheduling_time = 0;
+    if (current_scheduler_time < ready_time)
+        return; // the unlikely event that the clock wrapped
+    u64 latency_in_microseconds = (current_scheduler_time - ready_time) / 1000;
+    size_t bucket = 0;
+    if (latency_in_microseconds != 0)
+        bucket = min(scheduling_latency_bucket_count - 1, sizeof(u64) * 8 - count_leading_zeroes(latency_in_microseconds));
+    ++m_scheduling_latency_buckets[bucket];
+}
+
 bool Thread::tick()
 {
     if (previous_mode() == PreviousMode::KernelMode) {
@@ -1275,6 +1292,12 @@ ErrorOr<NonnullLockRefPtr<Thread>> Thread::try_clone(Process& process)
     return clone;
 }
 
+void Thread::did_schedule()
+{
+    ++m_times_scheduled;
+    m_process->bump_statistics_sequence();
+}
+
 void Thread::set_state(State new_state, u8 stop_signal)
 {
     State previous_state;
@@ -1282,6 +1305,8 @@ void Thread::set_state(State new_state, u8 stop_signal)
     if (new_state == m_state)
         return;
 
+    m_process->bump_statistics_sequence();
+
     {
         previous_state = m_state;
         if (previous_state == Thread::State::Invalid) {
@@ -1319,6 +1344,7 @@ void Thread::set_state(State new_state, u8 stop_signal)
     }
 
     if (m_state == Thread::State::Runnable) {
+        m_ready_for_scheduling_time = TimeManagement::scheduler_current_time();
         Scheduler::enqueue_runnable_thread(*this);
         Processor::smp_wake_n_idle_processors(1);
     } else if (m_state == Thread::State::Stopped) {
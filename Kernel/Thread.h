@@ -841,7 +841,7 @@ public:
         return {};
     }
 
-    void did_schedule() { ++m_times_scheduled; }
+    void did_schedule();
     u32 times_scheduled() const { return m_times_scheduled; }
 
     void resume_from_stopped();
@@ -1063,6 +1063,14 @@ public:
     u64 time_in_user() const { return m_total_time_scheduled_user.load(AK::MemoryOrder::memory_order_relaxed); }
     u64 time_in_kernel() const { return m_total_time_scheduled_kernel.load(AK::MemoryOrder::memory_order_relaxed); }
 
+    // Log-bucketed histogram of how long this thread sat in the run queue before
+    // getting scheduled: bucket i counts waits of [2^(i-1), 2^i) microseconds, with
+    // sub-microsecond waits in bucket 0 and everything else in the last bucket.
+    static constexpr size_t scheduling_latency_bucket_count = 16;
+    void record_scheduling_latency(u64 current_scheduler_time);
+    // NOTE: The counters only ever increase, and readers don't take the scheduler lock.
+    Span<u64 const> scheduling_latency_buckets() const { return { m_scheduling_latency_buckets, scheduling_latency_bucket_count }; }
+
     enum class PreviousMode : u8 {
         KernelMode = 0,
         UserMode
@@ -1177,6 +1185,7 @@ private:
 
     IntrusiveListNode<Thread> m_process_thread_list_node;
     int m_runnable_priority { -1 };
+    u32 m_ready_queue_processor { 0 };
 
     friend class WaitQueue;
 
@@ -1254,6 +1263,8 @@ private:
     Optional<u64> m_last_time_scheduled;
     Atomic<u64> m_total_time_scheduled_user { 0 };
     Atomic<u64> m_total_time_scheduled_kernel { 0 };
+    u64 m_ready_for_scheduling_time { 0 };
+    u64 m_scheduling_latency_buckets[scheduling_latency_bucket_count] {};
     u32 m_ticks_left { 0 };
     u32 m_times_scheduled { 0 };
     u32 m_ticks_in_user { 0 };
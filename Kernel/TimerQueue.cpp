@@ -91,28 +91,15 @@ void TimerQueue::add_timer_locked(NonnullLockRefPtr<Timer> timer)
     timer->clear_cancelled();
     timer->clear_callback_finished();
     timer->set_in_use();
+    timer->m_executing = false;
 
+    // The queue is deliberately kept unsorted so that arming a timer is O(1);
+    // we only track the earliest deadline. fire() does one batched sweep on
+    // ticks where that deadline has actually passed.
     auto& queue = queue_for_timer(*timer);
-    if (queue.list.is_empty()) {
-        queue.list.append(timer.leak_ref());
+    if (queue.list.is_empty() || timer_expiration < queue.next_timer_due)
         queue.next_timer_due = timer_expiration;
-    } else {
-        Timer* following_timer = nullptr;
-        for (auto& t : queue.list) {
-            if (t.m_expires > timer_expiration) {
-                following_timer = &t;
-                break;
-            }
-        }
-        if (following_timer) {
-            bool next_timer_needs_update = queue.list.first() == following_timer;
-            queue.list.insert_before(*following_timer, timer.leak_ref());
-            if (next_timer_needs_update)
-                queue.next_timer_due = timer_expiration;
-        } else {
-            queue.list.append(timer.leak_ref());
-        }
-    }
+    queue.list.append(timer.leak_ref());
 }
 
 bool TimerQueue::cancel_timer(Timer& timer, bool* was_in_use)
@@ -133,7 +120,7 @@ bool TimerQueue::cancel_timer(Timer& timer, bool* was_in_use)
         timer.clear_in_use();
 
         SpinlockLocker lock(g_timerqueue_lock);
-        if (timer_queue.list.contains(timer)) {
+        if (!timer.m_executing) {
             // The timer has not fired, remove it
             VERIFY(timer.ref_count() > 1);
             remove_timer_locked(timer_queue, timer);
@@ -147,6 +134,7 @@ bool TimerQueue::cancel_timer(Timer& timer, bool* was_in_use)
         // but since we called set_cancelled it will only drop its reference
         VERIFY(m_timers_executing.contains(timer));
         m_timers_executing.remove(timer);
+        timer.m_executing = false;
         return true;
     }
 
@@ -160,7 +148,7 @@ bool TimerQueue::cancel_timer(Timer& timer, bool* was_in_use)
 
 void TimerQueue::remove_timer_locked(Queue& queue, Timer& timer)
 {
-    bool was_next_timer = (queue.list.first() == &timer);
+    bool was_next_timer = (queue.next_timer_due == timer.m_expires);
     queue.list.remove(timer);
     auto now = timer.now(false);
     if (timer.m_expires > now)
@@ -178,18 +166,31 @@ void TimerQueue::fire()
 {
     SpinlockLocker lock(g_timerqueue_lock);
 
-    auto fire_timers = [&](Queue& queue) {
-        auto* timer = queue.list.first();
-        VERIFY(timer);
-        VERIFY(queue.next_timer_due == timer->m_expires);
+    auto fire_timers = [&](Queue& queue, clockid_t clock_id) {
+        // The queue is unsorted, so finding every expired timer takes a full
+        // sweep; only bother on ticks where the earliest deadline has actually
+        // passed, which lets every other tick return right here. The clocks
+        // that map to the same queue only deviate by sub-tick adjustments, so
+        // one timestamp is good enough for the whole sweep.
+        auto now = TimeManagement::the().current_time(clock_id);
+        if (!(now > queue.next_timer_due))
+            return;
+
+        for (;;) {
+            Timer* timer = nullptr;
+            for (auto& t : queue.list) {
+                if (now > t.m_expires) {
+                    timer = &t;
+                    break;
+                }
+            }
+            if (!timer)
+                break;
 
-        while (timer && timer->now(true) > timer->m_expires) {
             queue.list.remove(*timer);
-
+            timer->m_executing = true;
             m_timers_executing.append(*timer);
 
-            update_next_timer_due(queue);
-
             lock.unlock();
 
             // Defer executing the timer outside of the irq handler
@@ -200,6 +201,7 @@ void TimerQueue::fire()
                 if (!timer->set_cancelled()) {
                     timer->m_callback();
                     SpinlockLocker lock(g_timerqueue_lock);
+                    timer->m_executing = false;
                     m_timers_executing.remove(*timer);
                 }
                 timer->clear_in_use();
@@ -208,25 +210,33 @@ void TimerQueue::fire()
                 timer->unref();
             });
 
+            // Timers may have been armed or cancelled while the lock was
+            // dropped, so restart the sweep from the front.
             lock.lock();
-            timer = queue.list.first();
         }
+
+        update_next_timer_due(queue);
     };
 
     if (!m_timer_queue_monotonic.list.is_empty())
-        fire_timers(m_timer_queue_monotonic);
+        fire_timers(m_timer_queue_monotonic, CLOCK_MONOTONIC_COARSE);
     if (!m_timer_queue_realtime.list.is_empty())
-        fire_timers(m_timer_queue_realtime);
+        fire_timers(m_timer_queue_realtime, CLOCK_REALTIME_COARSE);
 }
 
 void TimerQueue::update_next_timer_due(Queue& queue)
 {
     VERIFY(g_timerqueue_lock.is_locked());
 
-    if (auto* next_timer = queue.list.first())
-        queue.next_timer_due = next_timer->m_expires;
-    else
-        queue.next_timer_due = {};
+    Time next_timer_due {};
+    bool found_any = false;
+    for (auto& timer : queue.list) {
+        if (!found_any || timer.m_expires < next_timer_due) {
+            next_timer_due = timer.m_expires;
+            found_any = true;
+        }
+    }
+    queue.next_timer_due = next_timer_due;
 }
 
 }
@@ -46,6 +46,9 @@ private:
     Atomic<bool> m_cancelled { false };
     Atomic<bool> m_callback_finished { false };
     Atomic<bool> m_in_use { false };
+    // Set when the timer has been moved to the executing list but its
+    // callback hasn't run yet. Only accessed with g_timerqueue_lock held.
+    bool m_executing { false };
 
     bool operator<(Timer const& rhs) const
     {
@@ -5,6 +5,7 @@
  */
 
 #include <Kernel/Debug.h>
+#include <Kernel/Scheduler.h>
 #include <Kernel/Thread.h>
 #include <Kernel/WaitQueue.h>
 
@@ -52,6 +53,16 @@ u32 WaitQueue::wake_n(u32 wake_count)
     dbgln_if(WAITQUEUE_DEBUG, "WaitQueue @ {}: wake_n({})", this, wake_count);
     u32 did_wake = 0;
 
+    if (is_empty_locked()) {
+        m_wake_requested = true;
+        return 0;
+    }
+
+    // Hold the scheduler lock across the whole batch so that each thread's
+    // unblock only re-enters the already-held (recursive) lock instead of
+    // performing its own global acquisition.
+    SpinlockLocker scheduler_lock(g_scheduler_lock);
+
     bool did_unblock_some = unblock_all_blockers_whose_conditions_are_met_locked([&](Thread::Blocker& b, void*, bool& stop_iterating) {
         VERIFY(b.blocker_type() == Thread::Blocker::Type::Queue);
         auto& blocker = static_cast<Thread::WaitQueueBlocker&>(b);
@@ -76,6 +87,15 @@ u32 WaitQueue::wake_all()
     dbgln_if(WAITQUEUE_DEBUG, "WaitQueue @ {}: wake_all", this);
     u32 did_wake = 0;
 
+    if (is_empty_locked()) {
+        m_wake_requested = true;
+        return 0;
+    }
+
+    // As in wake_n(), unblock the whole batch under one scheduler lock
+    // acquisition.
+    SpinlockLocker scheduler_lock(g_scheduler_lock);
+
     bool did_unblock_any = unblock_all_blockers_whose_conditions_are_met_locked([&](Thread::Blocker& b, void*, bool&) {
         VERIFY(b.blocker_type() == Thread::Blocker::Type::Queue);
         auto& blocker = static_cast<Thread::WaitQueueBlocker&>(b);
@@ -14,3 +14,5 @@ serenity_option(ENABLE_KERNEL_UNDEFINED_SANITIZER ON CACHE BOOL "Enable the Kern
 serenity_option(ENABLE_EXTRA_KERNEL_DEBUG_SYMBOLS  OFF CACHE BOOL "Enable -Og and -ggdb3 options for Kernel code for easier debugging")
 serenity_option(ENABLE_MOLD_LINKER OFF CACHE BOOL "Link the SerenityOS userland with the mold linker")
 serenity_option(ENABLE_USERSPACE_COVERAGE_COLLECTION OFF CACHE BOOL "Enable code coverage instrumentation for userspace binaries in clang")
+serenity_option(ENABLE_USERSPACE_PGO_GENERATE OFF CACHE BOOL "Build userspace with profile generation instrumentation (stage one of PGO) in gcc")
+serenity_option(USERSPACE_PGO_PROFILE_DIRECTORY "" CACHE PATH "Build userspace using the profiles in this directory (stage two of PGO) in gcc")
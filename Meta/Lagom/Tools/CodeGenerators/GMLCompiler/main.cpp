@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/DeprecatedString.h>
+#include <AK/HashMap.h>
+#include <AK/HashTable.h>
+#include <AK/JsonValue.h>
+#include <AK/LexicalPath.h>
+#include <AK/QuickSort.h>
+#include <AK/StringBuilder.h>
+#include <AK/StringUtils.h>
+#include <LibCore/ArgsParser.h>
+#include <LibCore/Stream.h>
+#include <LibGUI/GML/AST.h>
+#include <LibGUI/GML/Parser.h>
+#include <LibMain/Main.h>
+
+// Compiles a GML file into C++ that constructs the widget tree directly,
+// so applications don't have to lex and parse the GML (or look up classes
+// in the Core::Object registry) on every startup.
+
+static ErrorOr<DeprecatedString> include_path_for_class(StringView class_name)
+{
+    // Classes whose header does not simply match the class name.
+    static HashMap<StringView, StringView> const special_cases {
+        { "GUI::BoxLayout"sv, "LibGUI/BoxLayout.h"sv },
+        { "GUI::HorizontalBoxLayout"sv, "LibGUI/BoxLayout.h"sv },
+        { "GUI::VerticalBoxLayout"sv, "LibGUI/BoxLayout.h"sv },
+        { "GUI::HorizontalOpacitySlider"sv, "LibGUI/OpacitySlider.h"sv },
+        { "GUI::VerticalOpacitySlider"sv, "LibGUI/OpacitySlider.h"sv },
+        { "GUI::HorizontalProgressbar"sv, "LibGUI/Progressbar.h"sv },
+        { "GUI::VerticalProgressbar"sv, "LibGUI/Progressbar.h"sv },
+        { "GUI::HorizontalSeparator"sv, "LibGUI/SeparatorWidget.h"sv },
+        { "GUI::VerticalSeparator"sv, "LibGUI/SeparatorWidget.h"sv },
+        { "GUI::HorizontalSlider"sv, "LibGUI/Slider.h"sv },
+        { "GUI::VerticalSlider"sv, "LibGUI/Slider.h"sv },
+        { "GUI::HorizontalSplitter"sv, "LibGUI/Splitter.h"sv },
+        { "GUI::VerticalSplitter"sv, "LibGUI/Splitter.h"sv },
+        { "GUI::PasswordBox"sv, "LibGUI/TextBox.h"sv },
+        { "GUI::UrlBox"sv, "LibGUI/TextBox.h"sv },
+    };
+    if (auto special_case = special_cases.get(class_name); special_case.has_value())
+        return DeprecatedString { *special_case };
+    if (class_name.starts_with("GUI::"sv))
+        return DeprecatedString::formatted("LibGUI/{}.h", class_name.substring_view(5));
+    warnln("Cannot determine the header for class '{}'; it has to stay on runtime GML loading for now", class_name);
+    return Error::from_string_literal("Unsupported class");
+}
+
+static DeprecatedString escape_string_for_literal(StringView string)
+{
+    StringBuilder builder;
+    for (auto ch : string) {
+        switch (ch) {
+        case '"':
+            builder.append("\\\""sv);
+            break;
+        case '\\':
+            builder.append("\\\\"sv);
+            break;
+        case '\n':
+            builder.append("\\n"sv);
+            break;
+        case '\t':
+            builder.append("\\t"sv);
+            break;
+        default:
+            builder.append(ch);
+        }
+    }
+    return builder.to_deprecated_string();
+}
+
+static ErrorOr<DeprecatedString> scalar_value_expression(JsonValue const& value)
+{
+    if (value.is_bool())
+        return DeprecatedString { value.as_bool() ? "true"sv : "false"sv };
+    if (value.is_string())
+        return DeprecatedString::formatted("\"{}\"", escape_string_for_literal(value.as_string()));
+    if (value.is_number())
+        return value.serialized<StringBuilder>();
+    warnln("Cannot compile GML property value '{}'", value.serialized<StringBuilder>());
+    return Error::from_string_literal("Unsupported property value");
+}
+
+static ErrorOr<void> append_property(StringBuilder& builder, size_t indentation, StringView object_expression, DeprecatedString const& key, GUI::GML::JsonValueNode const& value)
+{
+    auto indent = [&](size_t levels) {
+        for (size_t i = 0; i < levels; ++i)
+            builder.append("    "sv);
+    };
+    if (value.is_array()) {
+        // Arrays (e.g. margins) have to be built up statement by statement.
+        indent(indentation);
+        builder.append("{\n"sv);
+        indent(indentation + 1);
+        builder.append("JsonArray property_value;\n"sv);
+        for (auto const& element : value.as_array().values()) {
+            indent(indentation + 1);
+            builder.appendff("property_value.append({});\n", TRY(scalar_value_expression(element)));
+        }
+        indent(indentation + 1);
+        builder.appendff("{}.set_property(\"{}\"sv, move(property_value));\n", object_expression, key);
+        indent(indentation);
+        builder.append("}\n"sv);
+        return {};
+    }
+    indent(indentation);
+    builder.appendff("{}.set_property(\"{}\"sv, JsonValue {{ {} }});\n", object_expression, key, TRY(scalar_value_expression(value)));
+    return {};
+}
+
+static DeprecatedString variable_name_for_class(StringView class_name, size_t serial)
+{
+    auto last_component = class_name;
+    if (auto index = class_name.find_last(':'); index.has_value())
+        last_component = class_name.substring_view(*index + 1);
+    return DeprecatedString::formatted("{}_{}", AK::StringUtils::to_snakecase(last_component), serial);
+}
+
+static ErrorOr<void> append_object(StringBuilder& builder, size_t indentation, StringView object_expression, GUI::GML::Object& object, size_t& next_serial)
+{
+    auto indent = [&](size_t levels) {
+        for (size_t i = 0; i < levels; ++i)
+            builder.append("    "sv);
+    };
+
+    ErrorOr<void> result {};
+    object.for_each_property([&](auto key, auto value) {
+        if (result.is_error())
+            return;
+        result = append_property(builder, indentation, object_expression, key, *value);
+    });
+    if (result.is_error())
+        return result.release_error();
+
+    if (auto layout = object.layout_object()) {
+        indent(indentation);
+        builder.appendff("{}.set_layout<{}>();\n", object_expression, layout->name());
+        layout->for_each_property([&](auto key, auto value) {
+            if (result.is_error())
+                return;
+            result = append_property(builder, indentation, DeprecatedString::formatted("(*{}.layout())", object_expression), key, *value);
+        });
+        if (result.is_error())
+            return result.release_error();
+    }
+
+    bool is_tab_widget = object.name() == "GUI::TabWidget"sv;
+    object.for_each_child_object([&](auto child) {
+        if (result.is_error())
+            return;
+        result = [&]() -> ErrorOr<void> {
+            auto class_name = child->name();
+            if (class_name == "GUI::Layout::Spacer"sv) {
+                if (!object.layout_object()) {
+                    warnln("Specified GUI::Layout::Spacer in GML, but the parent has no layout");
+                    return Error::from_string_literal("Spacer without layout");
+                }
+                indent(indentation);
+                builder.appendff("{}.layout()->add_spacer();\n", object_expression);
+                return {};
+            }
+            auto variable_name = variable_name_for_class(class_name, next_serial++);
+            indent(indentation);
+            builder.append("{\n"sv);
+            if (is_tab_widget) {
+                // TabWidget children must not be attached while their own
+                // children load, so construct them detached and hand them
+                // over at the end; this mirrors Widget::load_from_gml_ast().
+                indent(indentation + 1);
+                builder.appendff("auto {} = {}::construct();\n", variable_name, class_name);
+                TRY(append_object(builder, indentation + 1, DeprecatedString::formatted("(*{})", variable_name), *child, next_serial));
+                indent(indentation + 1);
+                builder.appendff("{}.add_widget(*{});\n", object_expression, variable_name);
+            } else {
+                indent(indentation + 1);
+                builder.appendff("auto& {} = {}.add<{}>();\n", variable_name, object_expression, class_name);
+                TRY(append_object(builder, indentation + 1, variable_name, *child, next_serial));
+            }
+            indent(indentation);
+            builder.append("}\n"sv);
+            return {};
+        }();
+    });
+    if (result.is_error())
+        return result.release_error();
+
+    return {};
+}
+
+static ErrorOr<void> collect_class_names(GUI::GML::Object& object, HashTable<DeprecatedString>& class_names)
+{
+    if (auto layout = object.layout_object())
+        class_names.set(layout->name());
+    ErrorOr<void> result {};
+    object.for_each_child_object([&](auto child) {
+        if (result.is_error())
+            return;
+        if (child->name() != "GUI::Layout::Spacer"sv) {
+            class_names.set(child->name());
+            result = collect_class_names(*child, class_names);
+        }
+    });
+    return result;
+}
+
+ErrorOr<int> serenity_main(Main::Arguments arguments)
+{
+    StringView gml_path;
+    StringView function_name;
+    Core::ArgsParser args_parser;
+    args_parser.add_positional_argument(gml_path, "GML file to compile", "gml-file", Core::ArgsParser::Required::Yes);
+    args_parser.add_positional_argument(function_name, "Name of the generated loader function", "function-name", Core::ArgsParser::Required::Yes);
+    args_parser.parse(arguments);
+
+    auto file = TRY(Core::Stream::File::open(gml_path, Core::Stream::OpenMode::Read));
+    auto content = TRY(file->read_until_eof());
+    auto ast = TRY(GUI::GML::parse_gml(content));
+    auto& main_class = ast->main_class();
+
+    HashTable<DeprecatedString> class_names;
+    class_names.set(main_class.name());
+    TRY(collect_class_names(main_class, class_names));
+
+    Vector<DeprecatedString> include_paths;
+    for (auto const& class_name : class_names)
+        TRY(include_paths.try_append(TRY(include_path_for_class(class_name))));
+    quick_sort(include_paths);
+
+    StringBuilder builder;
+    builder.appendff("// Auto-generated by GMLCompiler from {}. Do not edit; edit the GML file instead.\n", LexicalPath::basename(gml_path));
+    builder.append("\n#pragma once\n\n"sv);
+    builder.append("#include <AK/Error.h>\n"sv);
+    builder.append("#include <AK/JsonArray.h>\n"sv);
+    builder.append("#include <AK/JsonValue.h>\n"sv);
+    DeprecatedString previous_include_path;
+    for (auto const& include_path : include_paths) {
+        if (include_path == previous_include_path)
+            continue;
+        builder.appendff("#include <{}>\n", include_path);
+        previous_include_path = include_path;
+    }
+
+    builder.appendff("\ninline ErrorOr<void> {}({}& root)\n{{\n", function_name, main_class.name());
+    size_t next_serial = 1;
+    TRY(append_object(builder, 1, "root"sv, main_class, next_serial));
+    builder.append("    return {};\n}\n"sv);
+
+    out("{}", builder.string_view());
+    return 0;
+}
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/Debug.h>
 #include <AK/Function.h>
 #include <AK/GenericLexer.h>
@@ -77,6 +78,14 @@ static bool is_primitive_or_simple_type(DeprecatedString const& type)
     return is_primitive_type(type) || is_simple_type(type);
 }
 
+static bool is_borrowed_type(DeprecatedString const& type)
+{
+    // View types that decode without allocating; they point into a payload
+    // buffer pinned by the decoded message and are only valid as long as the
+    // message is alive, so they may only appear as message inputs.
+    return type.is_one_of("StringView", "ReadonlyBytes");
+}
+
 static DeprecatedString message_name(DeprecatedString const& endpoint, DeprecatedString const& message, bool is_response)
 {
     StringBuilder builder;
@@ -336,11 +345,28 @@ public:)~~~");
     virtual u32 endpoint_magic() const override { return @endpoint.magic@; }
     virtual i32 message_id() const override { return (int)MessageID::@message.pascal_name@; }
     static i32 static_message_id() { return (int)MessageID::@message.pascal_name@; }
-    virtual const char* message_name() const override { return "@endpoint.name@::@message.pascal_name@"; }
+    virtual const char* message_name() const override { return "@endpoint.name@::@message.pascal_name@"; })~~~");
+
+    bool has_borrowed_parameters = any_of(parameters, [](auto const& parameter) { return is_borrowed_type(parameter.type); });
 
+    if (has_borrowed_parameters) {
+        message_generator.appendln(R"~~~(
+    static OwnPtr<@message.pascal_name@> decode(InputMemoryStream& stream, Core::Stream::LocalSocket& socket)
+    {
+        // Borrowed parameters decode into views of the payload, so pin a copy
+        // of it that lives as long as the message itself.
+        auto buffer_or_error = ByteBuffer::copy(stream.bytes().slice(stream.offset()));
+        if (buffer_or_error.is_error())
+            return {};
+        auto buffer = buffer_or_error.release_value();
+        InputMemoryStream buffered_stream { buffer };
+        IPC::Decoder decoder { buffered_stream, socket };)~~~");
+    } else {
+        message_generator.appendln(R"~~~(
     static OwnPtr<@message.pascal_name@> decode(InputMemoryStream& stream, Core::Stream::LocalSocket& socket)
     {
         IPC::Decoder decoder { stream, socket };)~~~");
+    }
 
     for (auto const& parameter : parameters) {
         auto parameter_generator = message_generator.fork();
@@ -375,9 +401,18 @@ public:)~~~");
 
     message_generator.set("message.constructor_call_parameters", builder.build());
 
-    message_generator.appendln(R"~~~(
+    if (has_borrowed_parameters) {
+        message_generator.appendln(R"~~~(
+        stream.discard_or_error(buffered_stream.offset());
+        auto message = make<@message.pascal_name@>(@message.constructor_call_parameters@);
+        message->m_ipc_buffer = move(buffer);
+        return message;
+    })~~~");
+    } else {
+        message_generator.appendln(R"~~~(
         return make<@message.pascal_name@>(@message.constructor_call_parameters@);
     })~~~");
+    }
 
     message_generator.appendln(R"~~~(
     virtual bool valid() const override { return m_ipc_message_valid; }
@@ -416,6 +451,11 @@ public:)~~~");
 private:
     bool m_ipc_message_valid { true };)~~~");
 
+    if (has_borrowed_parameters) {
+        message_generator.appendln(R"~~~(
+    ByteBuffer m_ipc_buffer;)~~~");
+    }
+
     for (auto const& parameter : parameters) {
         auto parameter_generator = message_generator.fork();
         parameter_generator.set("parameter.type", parameter.type);
@@ -745,7 +785,7 @@ public:
             auto make_argument_type = [](DeprecatedString const& type) {
                 StringBuilder builder;
 
-                bool const_ref = !is_primitive_or_simple_type(type);
+                bool const_ref = !is_primitive_or_simple_type(type) && !is_borrowed_type(type);
 
                 builder.append(type);
                 if (const_ref)
@@ -830,6 +870,17 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
 
     auto endpoints = parse(file_contents);
 
+    for (auto const& endpoint : endpoints) {
+        for (auto const& message : endpoint.messages) {
+            for (auto const& parameter : message.outputs) {
+                if (is_borrowed_type(parameter.type)) {
+                    warnln("{}.{}: '{}' is a borrowed type and cannot be used as an output parameter", endpoint.name, message.name, parameter.type);
+                    return 1;
+                }
+            }
+        }
+    }
+
     StringBuilder builder;
     build(builder, endpoints);
 
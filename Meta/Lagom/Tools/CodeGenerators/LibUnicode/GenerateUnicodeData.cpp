@@ -1038,13 +1038,108 @@ static constexpr Array<Span<CodePointRange const>, @size@> @name@ { {)~~~");
 )~~~");
     };
 
-    append_prop_list("s_general_categories"sv, "s_general_category_{}"sv, unicode_data.general_categories);
+    // Two-stage lookup tables for the properties that text segmentation hits
+    // per code point. Stage one maps each 256-code-point block to one of the
+    // deduplicated blocks in stage two, whose entries index a small list of
+    // distinct property bitmasks; a lookup is three indexed loads and a bit
+    // test instead of a binary search over ranges.
+    auto append_two_stage_table = [&](StringView table_prefix, PropList const& property_list) {
+        static constexpr u32 first_invalid_code_point = 0x110000;
+        static constexpr size_t block_size = 256;
+
+        auto property_names = property_list.keys();
+        // NOTE: This must match the sort order used by generate_enum, as the
+        //       enum value is the bit index into the masks.
+        quick_sort(property_names, [](auto const& name1, auto const& name2) { return name1.to_lowercase() < name2.to_lowercase(); });
+        VERIFY(property_names.size() <= 64);
+
+        Vector<u64> code_point_masks;
+        code_point_masks.resize(first_invalid_code_point);
+        for (size_t i = 0; i < property_names.size(); ++i) {
+            auto it = property_list.find(property_names[i]);
+            VERIFY(it != property_list.end());
+            for (auto const& range : it->value) {
+                for (u32 code_point = range.first; code_point <= range.last && code_point < first_invalid_code_point; ++code_point)
+                    code_point_masks[code_point] |= 1ull << i;
+            }
+        }
+
+        Vector<u64> masks;
+        HashMap<u64, size_t> mask_indices;
+        Vector<u16> stage_one;
+        Vector<u8> stage_two;
+        HashMap<DeprecatedString, size_t> block_indices;
+
+        Vector<u8> block;
+        block.resize(block_size);
+        for (u32 block_start = 0; block_start < first_invalid_code_point; block_start += block_size) {
+            for (size_t i = 0; i < block_size; ++i) {
+                auto mask = code_point_masks[block_start + i];
+                size_t mask_index = 0;
+                if (auto existing_index = mask_indices.get(mask); existing_index.has_value()) {
+                    mask_index = *existing_index;
+                } else {
+                    mask_index = masks.size();
+                    mask_indices.set(mask, mask_index);
+                    masks.append(mask);
+                }
+                VERIFY(mask_index <= NumericLimits<u8>::max());
+                block[i] = static_cast<u8>(mask_index);
+            }
+
+            DeprecatedString block_key { StringView { reinterpret_cast<char const*>(block.data()), block.size() } };
+            size_t block_index = 0;
+            if (auto existing_index = block_indices.get(block_key); existing_index.has_value()) {
+                block_index = *existing_index;
+            } else {
+                block_index = stage_two.size() / block_size;
+                block_indices.set(block_key, block_index);
+                stage_two.extend(block);
+            }
+            stage_one.append(static_cast<u16>(block_index));
+        }
+
+        auto append_number_list = [&](StringView type, DeprecatedString name, auto const& values) {
+            generator.set("type", type);
+            generator.set("name", move(name));
+            generator.set("size", DeprecatedString::number(values.size()));
+            generator.append(R"~~~(
+static constexpr Array<@type@, @size@> @name@ { {
+    )~~~");
+
+            constexpr size_t max_values_per_row = 30;
+            size_t values_in_current_row = 0;
+
+            for (auto value : values) {
+                if (values_in_current_row++ > 0)
+                    generator.append(" ");
+
+                generator.set("value", DeprecatedString::formatted("{:#x}", value));
+                generator.append("@value@,");
+
+                if (values_in_current_row == max_values_per_row) {
+                    values_in_current_row = 0;
+                    generator.append("\n    ");
+                }
+            }
+
+            generator.append(R"~~~(
+} };
+)~~~");
+        };
+
+        append_number_list("u64"sv, DeprecatedString::formatted("{}_masks", table_prefix), masks);
+        append_number_list("u16"sv, DeprecatedString::formatted("{}_stage_one", table_prefix), stage_one);
+        append_number_list("u8"sv, DeprecatedString::formatted("{}_stage_two", table_prefix), stage_two);
+    };
+
+    append_two_stage_table("s_general_category"sv, unicode_data.general_categories);
     append_prop_list("s_properties"sv, "s_property_{}"sv, unicode_data.prop_list);
     append_prop_list("s_scripts"sv, "s_script_{}"sv, unicode_data.script_list);
     append_prop_list("s_script_extensions"sv, "s_script_extension_{}"sv, unicode_data.script_extensions);
     append_prop_list("s_blocks"sv, "s_block_{}"sv, unicode_data.block_list);
-    append_prop_list("s_grapheme_break_properties"sv, "s_grapheme_break_property_{}"sv, unicode_data.grapheme_break_props);
-    append_prop_list("s_word_break_properties"sv, "s_word_break_property_{}"sv, unicode_data.word_break_props);
+    append_two_stage_table("s_grapheme_break_property"sv, unicode_data.grapheme_break_props);
+    append_two_stage_table("s_word_break_property"sv, unicode_data.word_break_props);
     append_prop_list("s_sentence_break_properties"sv, "s_sentence_break_property_{}"sv, unicode_data.sentence_break_props);
 
     auto append_code_point_display_names = [&](StringView type, StringView name, auto const& display_names) {
@@ -1191,6 +1286,21 @@ bool code_point_has_@enum_snake@(u32 code_point, @enum_title@ @enum_snake@)
 )~~~");
     };
 
+    auto append_two_stage_search = [&](StringView enum_title, StringView enum_snake) {
+        generator.set("enum_title", enum_title);
+        generator.set("enum_snake", enum_snake);
+        generator.append(R"~~~(
+bool code_point_has_@enum_snake@(u32 code_point, @enum_title@ @enum_snake@)
+{
+    if (code_point >= 0x110000u)
+        return false;
+    auto block = s_@enum_snake@_stage_one[code_point >> 8];
+    auto mask_index = s_@enum_snake@_stage_two[(static_cast<size_t>(block) << 8) | (code_point & 0xff)];
+    return (s_@enum_snake@_masks[mask_index] >> static_cast<@enum_title@UnderlyingType>(@enum_snake@)) & 1;
+}
+)~~~");
+    };
+
     auto append_from_string = [&](StringView enum_title, StringView enum_snake, auto const& prop_list, Vector<Alias> const& aliases) -> ErrorOr<void> {
         HashValueMap<StringView> hashes;
         TRY(hashes.try_ensure_capacity(prop_list.size() + aliases.size()));
@@ -1216,7 +1326,7 @@ bool code_point_has_@enum_snake@(u32 code_point, @enum_title@ @enum_snake@)
 
     TRY(append_from_string("Locale"sv, "locale"sv, unicode_data.locales, {}));
 
-    append_prop_search("GeneralCategory"sv, "general_category"sv, "s_general_categories"sv);
+    append_two_stage_search("GeneralCategory"sv, "general_category"sv);
     TRY(append_from_string("GeneralCategory"sv, "general_category"sv, unicode_data.general_categories, unicode_data.general_category_aliases));
 
     append_prop_search("Property"sv, "property"sv, "s_properties"sv);
@@ -1229,8 +1339,8 @@ bool code_point_has_@enum_snake@(u32 code_point, @enum_title@ @enum_snake@)
     append_prop_search("Block"sv, "block"sv, "s_blocks"sv);
     TRY(append_from_string("Block"sv, "block"sv, unicode_data.block_list, unicode_data.block_aliases));
 
-    append_prop_search("GraphemeBreakProperty"sv, "grapheme_break_property"sv, "s_grapheme_break_properties"sv);
-    append_prop_search("WordBreakProperty"sv, "word_break_property"sv, "s_word_break_properties"sv);
+    append_two_stage_search("GraphemeBreakProperty"sv, "grapheme_break_property"sv);
+    append_two_stage_search("WordBreakProperty"sv, "word_break_property"sv);
     append_prop_search("SentenceBreakProperty"sv, "sentence_break_property"sv, "s_sentence_break_properties"sv);
 
     generator.append(R"~~~(
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/Coroutine.h>
+
+namespace {
+
+// A self-destroying root coroutine for driving tasks in tests.
+struct Detached {
+    struct promise_type {
+        Detached get_return_object() { return {}; }
+        std::suspend_never initial_suspend() { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() { }
+        void unhandled_exception() { VERIFY_NOT_REACHED(); }
+    };
+};
+
+// An awaitable that suspends until fire() is called, standing in for the
+// event loop integrations in LibCore.
+struct ManualEvent {
+    bool await_ready() const { return false; }
+    void await_suspend(std::coroutine_handle<> handle) { m_handle = handle; }
+    void await_resume() { }
+
+    void fire()
+    {
+        VERIFY(m_handle);
+        m_handle.resume();
+    }
+
+    std::coroutine_handle<> m_handle;
+};
+
+int s_steps_taken = 0;
+
+Coroutine<int> make_value()
+{
+    ++s_steps_taken;
+    co_return 7;
+}
+
+Coroutine<int> add_values(ManualEvent& event)
+{
+    int a = co_await make_value();
+    co_await event;
+    int b = co_await make_value();
+    co_return a + b;
+}
+
+Detached drive(Coroutine<int> task, int& out)
+{
+    out = co_await task;
+}
+
+}
+
+TEST_CASE(does_not_start_until_awaited)
+{
+    s_steps_taken = 0;
+    ManualEvent event;
+    auto task = add_values(event);
+    EXPECT_EQ(s_steps_taken, 0);
+
+    int result = 0;
+    drive(move(task), result);
+
+    // The task ran up to the suspension point and no further.
+    EXPECT_EQ(s_steps_taken, 1);
+    EXPECT_EQ(result, 0);
+
+    event.fire();
+    EXPECT_EQ(s_steps_taken, 2);
+    EXPECT_EQ(result, 14);
+}
+
+TEST_CASE(never_awaited_task_never_runs)
+{
+    s_steps_taken = 0;
+    {
+        auto task = make_value();
+    }
+    EXPECT_EQ(s_steps_taken, 0);
+}
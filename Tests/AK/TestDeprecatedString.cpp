@@ -25,6 +25,40 @@ TEST_CASE(construct_empty)
     EXPECT(DeprecatedString("").impl() == DeprecatedString::empty().impl());
 }
 
+TEST_CASE(short_strings)
+{
+    DeprecatedString short_string = "abc";
+    EXPECT(short_string.is_short_string());
+    EXPECT_EQ(short_string.length(), 3u);
+    EXPECT(!strcmp(short_string.characters(), "abc"));
+
+    // The longest string that still fits inline, and the shortest one that doesn't.
+    DeprecatedString barely_short = DeprecatedString::repeated('x', DeprecatedString::MAX_SHORT_STRING_BYTE_COUNT);
+    EXPECT(barely_short.is_short_string());
+    EXPECT_EQ(barely_short.length(), DeprecatedString::MAX_SHORT_STRING_BYTE_COUNT);
+    DeprecatedString barely_long = DeprecatedString::repeated('x', DeprecatedString::MAX_SHORT_STRING_BYTE_COUNT + 1);
+    EXPECT(!barely_long.is_short_string());
+    EXPECT_EQ(barely_long.length(), DeprecatedString::MAX_SHORT_STRING_BYTE_COUNT + 1);
+
+    // Short and StringImpl-backed strings with equal contents must compare and hash equally.
+    DeprecatedString heap_backed = DeprecatedString { StringImpl::create("abc", 3) };
+    EXPECT(!heap_backed.is_short_string());
+    EXPECT_EQ(short_string, heap_backed);
+    EXPECT_EQ(short_string.hash(), heap_backed.hash());
+    EXPECT_EQ(Traits<DeprecatedString>::hash(short_string), Traits<DeprecatedString>::hash(heap_backed));
+
+    // Asking for the impl materializes one, after which the string behaves as before.
+    auto const* impl = short_string.impl();
+    EXPECT(impl != nullptr);
+    EXPECT_EQ(short_string, "abc");
+    EXPECT_EQ(short_string.length(), 3u);
+
+    // FlyString interning still works across representations.
+    FlyString fly_of_short { DeprecatedString { "abc" } };
+    FlyString fly_of_heap { heap_backed };
+    EXPECT_EQ(fly_of_short.impl(), fly_of_heap.impl());
+}
+
 TEST_CASE(construct_contents)
 {
     DeprecatedString test_string = "ABCDEF";
@@ -104,10 +138,18 @@ TEST_CASE(ends_with)
 
 TEST_CASE(copy_string)
 {
+    // Short strings are stored inline, so copying copies the bytes.
     DeprecatedString test_string = "ABCDEF";
+    EXPECT(test_string.is_short_string());
     auto test_string_copy = test_string;
     EXPECT_EQ(test_string, test_string_copy);
-    EXPECT_EQ(test_string.characters(), test_string_copy.characters());
+
+    // Long strings share the same StringImpl when copied.
+    DeprecatedString long_string = "0123456789012345678901234567890123456789";
+    EXPECT(!long_string.is_short_string());
+    auto long_string_copy = long_string;
+    EXPECT_EQ(long_string, long_string_copy);
+    EXPECT_EQ(long_string.characters(), long_string_copy.characters());
 }
 
 TEST_CASE(move_string)
@@ -6,6 +6,7 @@
 
 #include <LibTest/TestCase.h>
 
+#include <AK/BumpAllocator.h>
 #include <AK/DeprecatedString.h>
 #include <AK/HashMap.h>
 #include <AK/OwnPtr.h>
@@ -202,6 +203,37 @@ TEST_CASE(basic_contains)
     EXPECT_EQ(map.contains(1), false);
 }
 
+TEST_CASE(bump_allocated_hash_map)
+{
+    BumpAllocator arena;
+    BumpAllocatedHashMap<int, DeprecatedString> map { BumpHashTableAllocator<> { arena } };
+
+    for (int i = 0; i < 20; ++i)
+        map.set(i, DeprecatedString::number(i));
+
+    EXPECT_EQ(map.size(), 20u);
+    for (int i = 0; i < 20; ++i)
+        EXPECT_EQ(*map.get(i), DeprecatedString::number(i));
+
+    EXPECT_EQ(map.remove(10), true);
+    EXPECT_EQ(map.contains(10), false);
+
+    // Growing past a single arena chunk's capacity must fail cleanly instead
+    // of handing out memory the arena doesn't have.
+    BumpAllocator small_arena;
+    BumpAllocatedHashTable<u64> table { BumpHashTableAllocator<> { small_arena } };
+    bool saw_enomem = false;
+    for (u64 i = 0; i < 100'000; ++i) {
+        auto result = table.try_set(i);
+        if (result.is_error()) {
+            EXPECT_EQ(result.error().code(), ENOMEM);
+            saw_enomem = true;
+            break;
+        }
+    }
+    EXPECT(saw_enomem);
+}
+
 TEST_CASE(in_place_rehashing_ordered_loop_bug)
 {
     OrderedHashMap<DeprecatedString, DeprecatedString> map;
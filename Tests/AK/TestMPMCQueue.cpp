@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/MPMCQueue.h>
+#include <AK/OwnPtr.h>
+#include <pthread.h>
+#include <sched.h>
+
+TEST_CASE(single_threaded_fifo_order)
+{
+    MPMCQueue<int, 8> queue;
+
+    for (int i = 0; i < 8; ++i)
+        EXPECT(queue.try_enqueue(move(i)));
+
+    // The queue is bounded; the ninth enqueue must fail.
+    int overflow = 8;
+    EXPECT(!queue.try_enqueue(move(overflow)));
+
+    for (int i = 0; i < 8; ++i) {
+        auto value = queue.try_dequeue();
+        EXPECT(value.has_value());
+        EXPECT_EQ(value.value(), i);
+    }
+    EXPECT(!queue.try_dequeue().has_value());
+
+    // Wrap-around: slots must be reusable after a full cycle.
+    for (int i = 100; i < 108; ++i)
+        EXPECT(queue.try_enqueue(move(i)));
+    EXPECT_EQ(queue.try_dequeue().value(), 100);
+}
+
+TEST_CASE(move_only_values)
+{
+    struct MoveOnly {
+        AK_MAKE_NONCOPYABLE(MoveOnly);
+
+    public:
+        explicit MoveOnly(int value)
+            : value(value)
+        {
+        }
+        MoveOnly(MoveOnly&&) = default;
+        MoveOnly& operator=(MoveOnly&&) = default;
+        int value { 0 };
+    };
+
+    MPMCQueue<MoveOnly, 4> queue;
+    EXPECT(queue.try_enqueue(MoveOnly { 7 }));
+    auto value = queue.try_dequeue();
+    EXPECT(value.has_value());
+    EXPECT_EQ(value->value, 7);
+}
+
+struct HammerState {
+    MPMCQueue<u32, 64> queue;
+    Atomic<u32> produced { 0 };
+    Atomic<u64> consumed_sum { 0 };
+    Atomic<u32> consumed_count { 0 };
+    static constexpr u32 items_per_producer = 10'000;
+};
+
+static void* hammer_producer(void* opaque_state)
+{
+    auto& state = *static_cast<HammerState*>(opaque_state);
+    for (u32 i = 0; i < HammerState::items_per_producer; ++i) {
+        u32 value = state.produced.fetch_add(1) + 1;
+        while (!state.queue.try_enqueue(move(value)))
+            sched_yield();
+    }
+    return nullptr;
+}
+
+static void* hammer_consumer(void* opaque_state)
+{
+    auto& state = *static_cast<HammerState*>(opaque_state);
+    while (state.consumed_count.load() < 2 * HammerState::items_per_producer) {
+        auto value = state.queue.try_dequeue();
+        if (!value.has_value()) {
+            sched_yield();
+            continue;
+        }
+        state.consumed_sum.fetch_add(value.value());
+        state.consumed_count.fetch_add(1);
+    }
+    return nullptr;
+}
+
+TEST_CASE(two_producers_two_consumers)
+{
+    auto state = make<HammerState>();
+
+    pthread_t producers[2];
+    pthread_t consumers[2];
+    for (auto& producer : producers)
+        EXPECT_EQ(pthread_create(&producer, nullptr, hammer_producer, state.ptr()), 0);
+    for (auto& consumer : consumers)
+        EXPECT_EQ(pthread_create(&consumer, nullptr, hammer_consumer, state.ptr()), 0);
+
+    for (auto& producer : producers)
+        pthread_join(producer, nullptr);
+    for (auto& consumer : consumers)
+        pthread_join(consumer, nullptr);
+
+    u32 const total_items = 2 * HammerState::items_per_producer;
+    EXPECT_EQ(state->consumed_count.load(), total_items);
+    // Every value 1..total_items must have been consumed exactly once.
+    EXPECT_EQ(state->consumed_sum.load(), static_cast<u64>(total_items) * (total_items + 1) / 2);
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/DeprecatedString.h>
+#include <AK/MemMem.h>
+#include <AK/StringBuilder.h>
+
+static Optional<size_t> find(StringView haystack, StringView needle)
+{
+    return AK::memmem_optional(haystack.characters_without_null_termination(), haystack.length(), needle.characters_without_null_termination(), needle.length());
+}
+
+TEST_CASE(empty_needle)
+{
+    EXPECT_EQ(find("hello"sv, ""sv), 0u);
+    EXPECT_EQ(find(""sv, ""sv), 0u);
+}
+
+TEST_CASE(needle_longer_than_haystack)
+{
+    EXPECT(!find("hi"sv, "hello"sv).has_value());
+}
+
+TEST_CASE(basic_match)
+{
+    EXPECT_EQ(find("hello friends"sv, "friends"sv), 6u);
+    EXPECT_EQ(find("hello friends"sv, "hello"sv), 0u);
+    EXPECT(!find("hello friends"sv, "enemies"sv).has_value());
+}
+
+TEST_CASE(single_byte_needle)
+{
+    EXPECT_EQ(find("abcdefghijklmnopqrstuvwxyz"sv, "q"sv), 16u);
+    EXPECT(!find("abcdefghijklmnopqrstuvwxyz"sv, "!"sv).has_value());
+}
+
+TEST_CASE(match_straddles_block_boundary)
+{
+    // The vectorized path works on 16-byte blocks; make sure matches that
+    // start near or across a block boundary are still found.
+    for (size_t offset = 0; offset < 48; ++offset) {
+        StringBuilder builder;
+        for (size_t i = 0; i < offset; ++i)
+            builder.append('x');
+        builder.append("needle"sv);
+        auto haystack = builder.to_deprecated_string();
+        EXPECT_EQ(find(haystack, "needle"sv), offset);
+    }
+}
+
+TEST_CASE(repeated_partial_matches)
+{
+    EXPECT_EQ(find("aaaaaaaaaaaaaaaaaaaaaaab"sv, "aab"sv), 21u);
+    EXPECT_EQ(find("abababababababababababac"sv, "abac"sv), 20u);
+}
+
+TEST_CASE(long_needle)
+{
+    auto haystack = "prefix prefix prefix this is a fairly long needle that exceeds the bitap limit, padding padding"sv;
+    auto needle = "this is a fairly long needle that exceeds the bitap limit"sv;
+    EXPECT_EQ(find(haystack, needle), 21u);
+}
+
+TEST_CASE(match_at_end_of_haystack)
+{
+    auto haystack = "0123456789abcdef0123456789abcdXY"sv;
+    EXPECT_EQ(find(haystack, "XY"sv), 30u);
+    EXPECT_EQ(find(haystack, "Y"sv), 31u);
+}
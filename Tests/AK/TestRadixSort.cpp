@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/QuickSort.h>
+#include <AK/RadixSort.h>
+#include <AK/Random.h>
+#include <AK/Vector.h>
+
+TEST_CASE(sorts_random_unsigned_values)
+{
+    Vector<u32> values;
+    for (size_t i = 0; i < 4096; ++i)
+        values.append(get_random<u32>());
+
+    auto expected = values;
+    quick_sort(expected);
+
+    radix_sort(values);
+    EXPECT_EQ(values, expected);
+}
+
+TEST_CASE(sorts_signed_values)
+{
+    Vector<i32> values;
+    for (size_t i = 0; i < 4096; ++i)
+        values.append(static_cast<i32>(get_random<u32>()));
+    values.append(NumericLimits<i32>::min());
+    values.append(NumericLimits<i32>::max());
+    values.append(0);
+    values.append(-1);
+
+    auto expected = values;
+    quick_sort(expected);
+
+    radix_sort(values);
+    EXPECT_EQ(values, expected);
+}
+
+TEST_CASE(sorts_small_collections_and_edge_cases)
+{
+    Vector<u8> empty;
+    radix_sort(empty);
+    EXPECT(empty.is_empty());
+
+    Vector<u8> single { 42 };
+    radix_sort(single);
+    EXPECT_EQ(single[0], 42u);
+
+    Vector<i16> few { 3, -1, 2, -7, 0 };
+    radix_sort(few);
+    EXPECT_EQ(few, (Vector<i16> { -7, -1, 0, 2, 3 }));
+}
+
+TEST_CASE(sorts_by_extracted_key_stably)
+{
+    struct Record {
+        u32 key;
+        u32 original_index;
+    };
+
+    Vector<Record> records;
+    for (size_t i = 0; i < 1024; ++i)
+        records.append({ get_random<u32>() % 16, static_cast<u32>(i) });
+
+    radix_sort(records, [](auto& record) { return record.key; });
+
+    for (size_t i = 1; i < records.size(); ++i) {
+        EXPECT(records[i - 1].key <= records[i].key);
+        if (records[i - 1].key == records[i].key)
+            EXPECT(records[i - 1].original_index < records[i].original_index);
+    }
+}
+
+TEST_CASE(sorts_already_sorted_input)
+{
+    Vector<u64> values;
+    for (size_t i = 0; i < 1024; ++i)
+        values.append(i);
+
+    auto expected = values;
+    radix_sort(values);
+    EXPECT_EQ(values, expected);
+}
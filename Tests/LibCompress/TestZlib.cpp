@@ -8,6 +8,7 @@
 
 #include <AK/Array.h>
 #include <LibCompress/Zlib.h>
+#include <LibCore/MemoryStream.h>
 
 TEST_CASE(zlib_decompress_simple)
 {
@@ -23,3 +24,28 @@ TEST_CASE(zlib_decompress_simple)
     auto const decompressed = Compress::Zlib::decompress_all(compressed);
     EXPECT(decompressed.value().bytes() == (ReadonlyBytes { uncompressed, sizeof(uncompressed) - 1 }));
 }
+
+TEST_CASE(zlib_decompress_streaming)
+{
+    Array<u8, 40> const compressed {
+        0x78, 0x01, 0x01, 0x1D, 0x00, 0xE2, 0xFF, 0x54, 0x68, 0x69, 0x73, 0x20,
+        0x69, 0x73, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x20,
+        0x74, 0x65, 0x78, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x3A, 0x29,
+        0x99, 0x5E, 0x09, 0xE8
+    };
+
+    const u8 uncompressed[] = "This is a simple text file :)";
+
+    auto memory_stream = MUST(Core::Stream::MemoryStream::construct(compressed));
+    Compress::ZlibDecompressor zlib_stream { move(memory_stream) };
+
+    // Pull the stream a few bytes at a time to exercise the chunked path.
+    Array<u8, 8> buffer;
+    ByteBuffer decompressed;
+    while (!zlib_stream.is_eof()) {
+        auto slice = MUST(zlib_stream.read(buffer));
+        MUST(decompressed.try_append(slice));
+    }
+
+    EXPECT(decompressed.bytes() == (ReadonlyBytes { uncompressed, sizeof(uncompressed) - 1 }));
+}
@@ -6,7 +6,9 @@
 
 #include <AK/Format.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/InputBitStream.h>
 #include <LibCore/LocalServer.h>
+#include <LibCore/MemoryStream.h>
 #include <LibCore/Stream.h>
 #include <LibCore/TCPServer.h>
 #include <LibCore/Timer.h>
@@ -463,6 +465,79 @@ TEST_CASE(buffered_small_file_read)
     EXPECT(!file->can_read_line().value());
 }
 
+TEST_CASE(buffered_stream_peek_and_consume)
+{
+    auto maybe_stream = Core::Stream::MemoryStream::construct("Well hello friends!"sv.bytes());
+    EXPECT(!maybe_stream.is_error());
+    auto maybe_buffered_stream = Core::Stream::BufferedStream::construct(maybe_stream.release_value());
+    EXPECT(!maybe_buffered_stream.is_error());
+    auto stream = maybe_buffered_stream.release_value();
+
+    // Peeking must not advance the stream...
+    auto peeked = stream->peek_bytes().release_value();
+    EXPECT_EQ(StringView { peeked }, "Well hello friends!"sv);
+    peeked = stream->peek_bytes().release_value();
+    EXPECT_EQ(StringView { peeked }, "Well hello friends!"sv);
+
+    // ...while consuming does.
+    stream->consume(5);
+    peeked = stream->peek_bytes().release_value();
+    EXPECT_EQ(StringView { peeked }, "hello friends!"sv);
+
+    // Reads are served from the buffered data.
+    auto buffer = ByteBuffer::create_uninitialized(6).release_value();
+    auto read_bytes = stream->read(buffer).release_value();
+    EXPECT_EQ(StringView { read_bytes }, "hello "sv);
+
+    stream->consume(8);
+    EXPECT(stream->is_eof());
+    EXPECT(stream->peek_bytes().release_value().is_empty());
+}
+
+TEST_CASE(little_endian_bit_stream)
+{
+    auto memory_stream = Core::Stream::MemoryStream::construct("\xaa\xf7\x55"sv.bytes()).release_value();
+    auto bit_stream = Core::Stream::LittleEndianInputBitStream::construct(move(memory_stream)).release_value();
+
+    // Bits are handed out least significant first.
+    EXPECT_EQ(bit_stream->read_bits(4).release_value(), 0xAu);
+    EXPECT_EQ(bit_stream->read_bits(4).release_value(), 0xAu);
+    EXPECT_EQ(bit_stream->read_bits(8).release_value(), 0xF7u);
+
+    // Aligning mid-byte returns the rest of the partially read byte.
+    EXPECT_EQ(bit_stream->read_bits(3).release_value(), 0x55u & 7);
+    EXPECT_EQ(bit_stream->align_to_byte_boundary(), 0x55 >> 3);
+    EXPECT(bit_stream->is_eof());
+}
+
+TEST_CASE(big_endian_bit_stream)
+{
+    auto memory_stream = Core::Stream::MemoryStream::construct("\xaa\xf7"sv.bytes()).release_value();
+    auto bit_stream = Core::Stream::BigEndianInputBitStream::construct(move(memory_stream)).release_value();
+
+    // Bits are handed out most significant first.
+    EXPECT_EQ(bit_stream->read_bits(4).release_value(), 0xAu);
+    EXPECT(bit_stream->read_bit().release_value());
+    EXPECT_EQ(bit_stream->read_bits(3).release_value(), 0b010u);
+    EXPECT_EQ(bit_stream->read_bits(8).release_value(), 0xF7u);
+    EXPECT(bit_stream->is_eof());
+}
+
+TEST_CASE(bit_stream_wide_reads)
+{
+    u8 const bytes[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+    auto little_endian_stream = Core::Stream::LittleEndianInputBitStream::construct(
+        Core::Stream::MemoryStream::construct({ bytes, sizeof(bytes) }).release_value())
+                                    .release_value();
+    EXPECT_EQ(little_endian_stream->read_bits(64).release_value(), 0x0807060504030201uLL);
+
+    auto big_endian_stream = Core::Stream::BigEndianInputBitStream::construct(
+        Core::Stream::MemoryStream::construct({ bytes, sizeof(bytes) }).release_value())
+                                 .release_value();
+    EXPECT_EQ(big_endian_stream->read_bits(64).release_value(), 0x0102030405060708uLL);
+}
+
 constexpr auto buffered_sent_data = "Well hello friends!\n:^)\nThis shouldn't be present. :^("sv;
 constexpr auto first_line = "Well hello friends!"sv;
 constexpr auto second_line = ":^)"sv;
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/Painter.h>
+#include <LibGfx/ParallelPainting.h>
+
+TEST_CASE(parallel_fill_covers_every_pixel)
+{
+    auto bitmap = Gfx::Bitmap::try_create(Gfx::BitmapFormat::BGRx8888, { 400, 400 }).release_value_but_fixme_should_propagate_errors();
+    Gfx::Painter painter(bitmap);
+    painter.fill_rect(bitmap->rect(), Gfx::Color::Black);
+
+    Gfx::paint_in_parallel(bitmap, bitmap->rect(), [](Gfx::Painter& band_painter, Gfx::IntRect const& band) {
+        band_painter.fill_rect(band, Gfx::Color::Red);
+    });
+
+    for (int y = 0; y < bitmap->height(); ++y) {
+        for (int x = 0; x < bitmap->width(); ++x)
+            EXPECT_EQ(bitmap->get_pixel(x, y), Gfx::Color(Gfx::Color::Red));
+    }
+}
+
+TEST_CASE(parallel_fill_respects_dirty_rects)
+{
+    auto bitmap = Gfx::Bitmap::try_create(Gfx::BitmapFormat::BGRx8888, { 300, 300 }).release_value_but_fixme_should_propagate_errors();
+    Gfx::Painter painter(bitmap);
+    painter.fill_rect(bitmap->rect(), Gfx::Color::Black);
+
+    Gfx::DisjointIntRectSet dirty_rects;
+    dirty_rects.add(Gfx::IntRect { 0, 0, 150, 300 });
+    dirty_rects.add(Gfx::IntRect { 200, 100, 50, 50 });
+
+    Gfx::paint_in_parallel(bitmap, dirty_rects, [](Gfx::Painter& band_painter, Gfx::IntRect const& band) {
+        band_painter.fill_rect(band, Gfx::Color::Green);
+    });
+
+    for (int y = 0; y < bitmap->height(); ++y) {
+        for (int x = 0; x < bitmap->width(); ++x) {
+            bool is_dirty = dirty_rects.contains(Gfx::IntRect { x, y, 1, 1 });
+            auto expected = is_dirty ? Gfx::Color(Gfx::Color::Green) : Gfx::Color(Gfx::Color::Black);
+            EXPECT_EQ(bitmap->get_pixel(x, y), expected);
+        }
+    }
+}
+
+TEST_CASE(small_rects_are_painted_inline)
+{
+    auto bitmap = Gfx::Bitmap::try_create(Gfx::BitmapFormat::BGRx8888, { 64, 64 }).release_value_but_fixme_should_propagate_errors();
+    Gfx::Painter painter(bitmap);
+    painter.fill_rect(bitmap->rect(), Gfx::Color::Black);
+
+    Gfx::paint_in_parallel(bitmap, bitmap->rect(), [](Gfx::Painter& band_painter, Gfx::IntRect const& band) {
+        band_painter.fill_rect(band, Gfx::Color::Blue);
+    });
+
+    EXPECT_EQ(bitmap->get_pixel(0, 0), Gfx::Color(Gfx::Color::Blue));
+    EXPECT_EQ(bitmap->get_pixel(63, 63), Gfx::Color(Gfx::Color::Blue));
+}
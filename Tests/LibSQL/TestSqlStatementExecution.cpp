@@ -322,6 +322,35 @@ TEST_CASE(select_with_where)
     }
 }
 
+TEST_CASE(select_with_where_conjunction)
+{
+    ScopeGuard guard([]() { unlink(db_name); });
+    auto database = SQL::Database::construct(db_name);
+    EXPECT(!database->open().is_error());
+    create_table(database);
+    auto result = execute(database,
+        "INSERT INTO TestSchema.TestTable ( TextColumn, IntColumn ) VALUES "
+        "( 'Test_1', 42 ), "
+        "( 'Test_2', 43 ), "
+        "( 'Other_1', 44 ), "
+        "( 'Test_4', 45 ), "
+        "( 'Test_5', 46 );");
+    EXPECT(result.size() == 5);
+
+    // These predicates are all pushed down into the table scan. The
+    // comparisons are parenthesized because expressions parse right-to-left
+    // without precedence.
+    result = execute(database, "SELECT TextColumn, IntColumn FROM TestSchema.TestTable WHERE ( IntColumn > 42 ) AND ( IntColumn < 46 ) AND ( TextColumn LIKE 'Test%' );");
+    EXPECT_EQ(result.size(), 2u);
+    for (auto& row : result) {
+        EXPECT(row.row[1].to_int().value() > 42 && row.row[1].to_int().value() < 46);
+    }
+
+    result = execute(database, "SELECT TextColumn FROM TestSchema.TestTable WHERE 45 = IntColumn;");
+    EXPECT_EQ(result.size(), 1u);
+    EXPECT_EQ(result[0].row[0].to_deprecated_string(), "Test_4");
+}
+
 TEST_CASE(select_cross_join)
 {
     ScopeGuard guard([]() { unlink(db_name); });
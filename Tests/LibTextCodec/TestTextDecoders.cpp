@@ -23,3 +23,27 @@ TEST_CASE(test_utf8_decode)
 
     EXPECT(decoder.to_utf8(test_string) == test_string);
 }
+
+TEST_CASE(test_latin1_decode)
+{
+    auto decoder = TextCodec::Latin1Decoder();
+    // "Hello é" with a long ASCII stretch to cover the bulk path.
+    auto test_string = "this is a long enough ascii-only prefix \xe9 and tail"sv;
+    EXPECT(decoder.to_utf8(test_string) == "this is a long enough ascii-only prefix \xc3\xa9 and tail"sv);
+}
+
+TEST_CASE(test_utf16be_decode)
+{
+    auto decoder = TextCodec::UTF16BEDecoder();
+    // BOM, "hi", U+00E9, U+20AC
+    auto test_string = "\xfe\xff\x00\x68\x00\x69\x00\xe9\x20\xac"sv;
+    EXPECT(decoder.to_utf8(test_string) == "hi\xc3\xa9\xe2\x82\xac"sv);
+}
+
+TEST_CASE(test_utf16le_decode)
+{
+    auto decoder = TextCodec::UTF16LEDecoder();
+    // BOM, "hi", U+00E9, U+20AC
+    auto test_string = "\xff\xfe\x68\x00\x69\x00\xe9\x00\xac\x20"sv;
+    EXPECT(decoder.to_utf8(test_string) == "hi\xc3\xa9\xe2\x82\xac"sv);
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <AK/Vector.h>
+#include <LibTest/TestCase.h>
+#include <LibThreading/ThreadPool.h>
+
+TEST_CASE(submit_and_wait)
+{
+    Threading::ThreadPool pool { 4 };
+    EXPECT_EQ(pool.thread_count(), 4u);
+
+    Atomic<u32> counter { 0 };
+    for (u32 i = 0; i < 1000; ++i) {
+        pool.submit([&counter] {
+            counter.fetch_add(1);
+        });
+    }
+    pool.wait_for_all();
+    EXPECT_EQ(counter.load(), 1000u);
+
+    // The pool must be reusable after a wait.
+    pool.submit([&counter] {
+        counter.fetch_add(1);
+    });
+    pool.wait_for_all();
+    EXPECT_EQ(counter.load(), 1001u);
+}
+
+TEST_CASE(parallel_for)
+{
+    Threading::ThreadPool pool { 3 };
+
+    Vector<u32> data;
+    data.resize(10'000);
+
+    pool.parallel_for(0, data.size(), 64, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+            data[i] = i * 2;
+    });
+
+    for (size_t i = 0; i < data.size(); ++i)
+        EXPECT_EQ(data[i], i * 2);
+}
+
+TEST_CASE(single_worker_pool)
+{
+    Threading::ThreadPool pool { 1 };
+
+    Atomic<u32> counter { 0 };
+    // More work than the per-worker queue can hold, to exercise the
+    // submission fallback when every queue is full.
+    for (u32 i = 0; i < 5000; ++i) {
+        pool.submit([&counter] {
+            counter.fetch_add(1);
+        });
+    }
+    pool.wait_for_all();
+    EXPECT_EQ(counter.load(), 5000u);
+}
@@ -227,6 +227,9 @@ JS_DEFINE_NATIVE_FUNCTION(WebAssemblyModule::wasm_invoke)
         case Wasm::ValueType::Kind::F64:
             arguments.append(Wasm::Value(static_cast<double>(double_value)));
             break;
+        case Wasm::ValueType::Kind::V128:
+            arguments.append(Wasm::Value(param, static_cast<u64>(double_value)));
+            break;
         case Wasm::ValueType::Kind::FunctionReference:
             arguments.append(Wasm::Value(Wasm::Reference { Wasm::Reference::Func { static_cast<u64>(double_value) } }));
             break;
@@ -252,6 +255,7 @@ JS_DEFINE_NATIVE_FUNCTION(WebAssemblyModule::wasm_invoke)
     JS::Value return_value;
     result.values().first().value().visit(
         [&](auto const& value) { return_value = JS::Value(static_cast<double>(value)); },
+        [&](u128 value) { return_value = JS::Value(static_cast<double>(value.low())); },
         [&](i32 value) { return_value = JS::Value(static_cast<double>(value)); },
         [&](i64 value) { return_value = JS::Value(JS::BigInt::create(vm, Crypto::SignedBigInteger { value })); },
         [&](Wasm::Reference const& reference) {
@@ -197,6 +197,43 @@ TEST_CASE(doctype)
     EXPECT_END_TAG_TOKEN(html);
 }
 
+static Vector<Token> run_tokenizer_incrementally(StringView input, size_t chunk_size)
+{
+    Vector<Token> tokens;
+    Tokenizer tokenizer;
+    tokenizer.set_incremental_input(true);
+    auto pump = [&] {
+        while (true) {
+            auto maybe_token = tokenizer.next_token();
+            if (!maybe_token.has_value())
+                break;
+            tokens.append(maybe_token.release_value());
+        }
+    };
+    for (size_t offset = 0; offset < input.length(); offset += chunk_size) {
+        tokenizer.append_input(input.substring_view(offset, min(chunk_size, input.length() - offset)));
+        pump();
+    }
+    tokenizer.insert_eof();
+    pump();
+    return tokens;
+}
+
+TEST_CASE(incremental_input)
+{
+    // Chunk boundaries may fall in the middle of a tag, an attribute value, a
+    // comment, a DOCTYPE, a named character reference or a CRLF pair; the
+    // token stream has to come out the same as for a single-shot parse.
+    auto input = "<!DOCTYPE html><html><p class='a&amp;b'>Text &notin; more&#x26;stuff\r\nsecond line</p><!-- a comment --></html>"sv;
+    auto expected = run_tokenizer(input);
+    auto expected_hash = hash_tokens(expected);
+    for (size_t chunk_size = 1; chunk_size <= input.length(); ++chunk_size) {
+        auto tokens = run_tokenizer_incrementally(input, chunk_size);
+        EXPECT_EQ(tokens.size(), expected.size());
+        EXPECT_EQ(hash_tokens(tokens), expected_hash);
+    }
+}
+
 // NOTE: This relies on the format of HTMLToken::to_string() staying the same.
 //       If that changes, or something is added to the test HTML, the hash needs to be adjusted.
 TEST_CASE(regression)
@@ -70,7 +70,7 @@ GUI::Variant ClipboardHistoryModel::data(const GUI::ModelIndex& index, GUI::Mode
     switch (index.column()) {
     case Column::Data:
         if (data_and_type.mime_type.starts_with("text/"sv))
-            return DeprecatedString::copy(data_and_type.data);
+            return DeprecatedString::copy(data_and_type.bytes());
         if (data_and_type.mime_type == "image/x-serenityos") {
             StringBuilder builder;
             builder.append('[');
@@ -102,7 +102,7 @@ GUI::Variant ClipboardHistoryModel::data(const GUI::ModelIndex& index, GUI::Mode
     case Column::Type:
         return data_and_type.mime_type;
     case Column::Size:
-        return AK::human_readable_size(data_and_type.data.size());
+        return AK::human_readable_size(data_and_type.bytes().size());
     case Column::Time:
         return time.to_deprecated_string();
     default:
@@ -113,7 +113,7 @@ GUI::Variant ClipboardHistoryModel::data(const GUI::ModelIndex& index, GUI::Mode
 void ClipboardHistoryModel::add_item(const GUI::Clipboard::DataAndType& item)
 {
     m_history_items.remove_first_matching([&](ClipboardItem& existing) {
-        return existing.data_and_type.data == item.data && existing.data_and_type.mime_type == item.mime_type;
+        return existing.data_and_type.bytes() == item.bytes() && existing.data_and_type.mime_type == item.mime_type;
     });
 
     if (m_history_items.size() == m_history_limit)
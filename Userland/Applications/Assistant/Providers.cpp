@@ -60,6 +60,14 @@ void URLResult::activate() const
     Desktop::Launcher::open(URL::create_with_url_or_path(title()));
 }
 
+AppProvider::AppProvider()
+{
+    Desktop::AppFile::for_each([this](NonnullRefPtr<Desktop::AppFile> app_file) {
+        auto icon = GUI::FileIconProvider::icon_for_executable(app_file->executable());
+        m_app_cache.append({ move(app_file), icon.bitmap_for_size(16) });
+    });
+}
+
 void AppProvider::query(DeprecatedString const& query, Function<void(NonnullRefPtrVector<Result>)> on_complete)
 {
     if (query.starts_with('=') || query.starts_with('$'))
@@ -67,14 +75,13 @@ void AppProvider::query(DeprecatedString const& query, Function<void(NonnullRefP
 
     NonnullRefPtrVector<Result> results;
 
-    Desktop::AppFile::for_each([&](NonnullRefPtr<Desktop::AppFile> app_file) {
-        auto match_result = fuzzy_match(query, app_file->name());
+    for (auto& cached_app : m_app_cache) {
+        auto match_result = fuzzy_match(query, cached_app.app_file->name());
         if (!match_result.matched)
-            return;
+            continue;
 
-        auto icon = GUI::FileIconProvider::icon_for_executable(app_file->executable());
-        results.append(adopt_ref(*new AppResult(icon.bitmap_for_size(16), app_file->name(), {}, app_file, match_result.score)));
-    });
+        results.append(adopt_ref(*new AppResult(cached_app.bitmap, cached_app.app_file->name(), {}, cached_app.app_file, match_result.score)));
+    }
 
     on_complete(move(results));
 }
@@ -126,26 +133,41 @@ void FileProvider::query(DeprecatedString const& query, Function<void(NonnullRef
     if (m_fuzzy_match_work)
         m_fuzzy_match_work->cancel();
 
-    m_fuzzy_match_work = Threading::BackgroundAction<NonnullRefPtrVector<Result>>::construct(
-        [this, query](auto& task) {
-            NonnullRefPtrVector<Result> results;
+    // When the user extends their previous query, only its matches have to be
+    // rescored; everything else already failed to match a prefix of the new
+    // query. The narrowed set is only remembered once a scan ran to
+    // completion over the finished filesystem cache, so partial scans never
+    // hide results from later keystrokes.
+    bool narrowing = !m_last_query.is_null() && query.starts_with(m_last_query);
+    bool authoritative = narrowing || !m_building_cache;
+    auto haystack = narrowing ? m_last_query_matches : m_full_path_cache;
 
-            for (auto& path : m_full_path_cache) {
+    m_fuzzy_match_work = Threading::BackgroundAction<QueryResults>::construct(
+        [query, haystack = move(haystack)](auto& task) {
+            QueryResults query_results;
+
+            for (auto& path : haystack) {
                 if (task.is_cancelled())
-                    return results;
+                    return query_results;
 
                 auto match_result = fuzzy_match(query, path);
                 if (!match_result.matched)
                     continue;
+                query_results.matched_paths.append(path);
                 if (match_result.score < 0)
                     continue;
 
-                results.append(adopt_ref(*new FileResult(path, match_result.score)));
+                query_results.results.append(adopt_ref(*new FileResult(path, match_result.score)));
             }
-            return results;
+            query_results.completed = true;
+            return query_results;
         },
-        [on_complete = move(on_complete)](auto results) {
-            on_complete(move(results));
+        [this, query, authoritative, on_complete = move(on_complete)](QueryResults query_results) {
+            if (query_results.completed && authoritative) {
+                m_last_query = query;
+                m_last_query_matches = move(query_results.matched_paths);
+            }
+            on_complete(move(query_results.results));
         });
 }
 
@@ -137,7 +137,19 @@ public:
 
 class AppProvider final : public Provider {
 public:
+    AppProvider();
+
     void query(DeprecatedString const& query, Function<void(NonnullRefPtrVector<Result>)> on_complete) override;
+
+private:
+    struct CachedApp {
+        NonnullRefPtr<Desktop::AppFile> app_file;
+        RefPtr<Gfx::Bitmap> bitmap;
+    };
+
+    // App files and their executables' icons are read from disk once instead
+    // of on every keystroke.
+    Vector<CachedApp> m_app_cache;
 };
 
 class CalculatorProvider final : public Provider {
@@ -153,10 +165,22 @@ public:
     void build_filesystem_cache();
 
 private:
-    RefPtr<Threading::BackgroundAction<NonnullRefPtrVector<Result>>> m_fuzzy_match_work;
+    struct QueryResults {
+        NonnullRefPtrVector<Result> results;
+        Vector<DeprecatedString> matched_paths;
+        bool completed { false };
+    };
+
+    RefPtr<Threading::BackgroundAction<QueryResults>> m_fuzzy_match_work;
     bool m_building_cache { false };
     Vector<DeprecatedString> m_full_path_cache;
     Queue<DeprecatedString> m_work_queue;
+
+    // The last fully scored query and the paths that matched it. A path that
+    // doesn't fuzzy-match a query cannot match any longer query starting with
+    // it, so extending the query only needs to rescore these.
+    DeprecatedString m_last_query;
+    Vector<DeprecatedString> m_last_query_matches;
 };
 
 class TerminalProvider final : public Provider {
@@ -179,10 +179,10 @@ Tab::Tab(BrowserWindow& window)
     };
 
     m_location_box->add_custom_context_menu_action(GUI::Action::create("Paste && Go", [this](auto&) {
-        auto [data, mime_type, _] = GUI::Clipboard::the().fetch_data_and_type();
-        if (!mime_type.starts_with("text/"sv))
+        auto data_and_type = GUI::Clipboard::the().fetch_data_and_type();
+        if (!data_and_type.mime_type.starts_with("text/"sv))
             return;
-        auto const& paste_text = data;
+        StringView paste_text { data_and_type.bytes() };
         if (paste_text.is_empty())
             return;
         m_location_box->set_text(paste_text);
@@ -51,10 +51,9 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     edit_menu.add_action(GUI::CommonActions::make_paste_action([&](auto&) {
         auto clipboard = GUI::Clipboard::the().fetch_data_and_type();
         if (clipboard.mime_type == "text/plain") {
-            if (!clipboard.data.is_empty()) {
-                auto const number = StringView(clipboard.data);
+            auto const number = StringView(clipboard.bytes());
+            if (!number.is_empty())
                 widget->set_entry(Crypto::BigFraction(number));
-            }
         }
     }));
 
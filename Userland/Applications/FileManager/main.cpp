@@ -152,7 +152,7 @@ void do_paste(DeprecatedString const& target_directory, GUI::Window* window)
         dbgln("Cannot paste clipboard type {}", data_and_type.mime_type);
         return;
     }
-    auto copied_lines = DeprecatedString::copy(data_and_type.data).split('\n');
+    auto copied_lines = DeprecatedString::copy(data_and_type.bytes()).split('\n');
     if (copied_lines.is_empty()) {
         dbgln("No files to paste");
         return;
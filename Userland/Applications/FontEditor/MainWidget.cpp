@@ -991,10 +991,12 @@ ErrorOr<void> MainWidget::cut_selected_glyphs()
 
 void MainWidget::paste_glyphs()
 {
-    auto [data, mime_type, metadata] = GUI::Clipboard::the().fetch_data_and_type();
-    if (!mime_type.starts_with("glyph/"sv))
+    auto data_and_type = GUI::Clipboard::the().fetch_data_and_type();
+    if (!data_and_type.mime_type.starts_with("glyph/"sv))
         return;
 
+    auto data = data_and_type.bytes();
+    auto const& metadata = data_and_type.metadata;
     auto glyph_count = metadata.get("count").value().to_uint().value_or(0);
     if (!glyph_count)
         return;
@@ -169,9 +169,10 @@ NonnullRefPtr<Core::File> HexDocumentFile::file() const
 void HexDocumentFile::ensure_position_in_buffer(size_t position)
 {
     if (position < m_buffer_file_pos || position >= m_buffer_file_pos + m_buffer.size()) {
-        m_file->seek(position, Core::SeekMode::SetPosition);
+        size_t window_start = position - (position % m_buffer.size());
+        m_file->seek(window_start, Core::SeekMode::SetPosition);
         m_file->read(m_buffer.data(), m_buffer.size());
-        m_buffer_file_pos = position;
+        m_buffer_file_pos = window_start;
     }
 }
 
@@ -79,7 +79,9 @@ private:
     NonnullRefPtr<Core::File> m_file;
     size_t m_file_size;
 
-    Array<u8, 2048> m_buffer;
+    // The window is aligned to its own size so that scanning in either
+    // direction only refills once per window instead of once per byte.
+    Array<u8, 64 * KiB> m_buffer;
     size_t m_buffer_file_pos;
 };
 
@@ -115,6 +115,7 @@ void PDFViewer::paint_event(GUI::PaintEvent& event)
         int y = max(0, (height() - page->height()) / 2);
 
         painter.blit({ x, y }, *page, page->rect());
+        pre_render_adjacent_pages();
         return;
     }
 
@@ -158,6 +159,33 @@ void PDFViewer::paint_event(GUI::PaintEvent& event)
 
         y_offset += diff_y;
     }
+
+    pre_render_adjacent_pages();
+}
+
+void PDFViewer::pre_render_adjacent_pages()
+{
+    if (m_pre_render_queued)
+        return;
+    m_pre_render_queued = true;
+
+    // Render the pages around the current one once the event loop goes idle,
+    // so that navigating to them usually hits the rendered page cache.
+    deferred_invoke([this] {
+        m_pre_render_queued = false;
+        if (!m_document)
+            return;
+
+        auto page_count = m_document->get_page_count();
+        for (auto offset : { 1, -1 }) {
+            auto page_index = static_cast<i64>(m_current_page_index) + offset;
+            if (page_index < 0 || page_index >= static_cast<i64>(page_count))
+                continue;
+            // Errors are surfaced by paint_event() if the user actually
+            // navigates to this page.
+            (void)get_rendered_page(page_index);
+        }
+    });
 }
 
 void PDFViewer::set_current_page(u32 current_page)
@@ -267,9 +295,10 @@ void PDFViewer::mousemove_event(GUI::MouseEvent& event)
 
 void PDFViewer::timer_event(Core::TimerEvent&)
 {
-    // Clear the bitmap vector of all pages except the current page
+    // Clear the bitmap vector of all pages except the current page and its
+    // pre-rendered neighbors
     for (size_t i = 0; i < m_rendered_page_list.size(); i++) {
-        if (i != m_current_page_index)
+        if (i + 1 < m_current_page_index || i > static_cast<size_t>(m_current_page_index) + 1)
             m_rendered_page_list[i].clear();
     }
 }
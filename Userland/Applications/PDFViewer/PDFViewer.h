@@ -86,6 +86,7 @@ private:
     PDF::PDFErrorOr<NonnullRefPtr<Gfx::Bitmap>> get_rendered_page(u32 index);
     PDF::PDFErrorOr<NonnullRefPtr<Gfx::Bitmap>> render_page(u32 page_index);
     PDF::PDFErrorOr<void> cache_page_dimensions(bool recalculate_fixed_info = false);
+    void pre_render_adjacent_pages();
     void change_page(u32 new_page);
 
     RefPtr<PDF::Document> m_document;
@@ -99,4 +100,5 @@ private:
 
     Gfx::IntPoint m_pan_starting_position;
     int m_rotations { 0 };
+    bool m_pre_render_queued { false };
 };
@@ -28,7 +28,7 @@ void PlaybackManager::set_loader(NonnullRefPtr<Audio::Loader>&& loader)
         m_total_length = m_loader->total_samples() / static_cast<float>(m_loader->sample_rate());
         m_device_samples_per_buffer = PlaybackManager::buffer_size_ms / 1000.0f * m_device_sample_rate;
         m_samples_to_load_per_buffer = PlaybackManager::buffer_size_ms / 1000.0f * m_loader->sample_rate();
-        m_resampler = Audio::ResampleHelper<Audio::Sample>(m_loader->sample_rate(), m_device_sample_rate);
+        m_resampler = Audio::SincResampler<Audio::Sample>(m_loader->sample_rate(), m_device_sample_rate);
         m_timer->start();
     } else {
         m_timer->stop();
@@ -65,6 +65,8 @@ void PlaybackManager::seek(int const position)
     set_paused(true);
 
     [[maybe_unused]] auto result = m_loader->seek(position);
+    if (m_resampler.has_value())
+        m_resampler->reset();
 
     m_connection->clear_client_buffer();
     m_connection->async_clear_buffer();
@@ -119,7 +121,8 @@ void PlaybackManager::next_buffer()
         if (!maybe_buffer.is_error()) {
             m_current_buffer.swap(maybe_buffer.value());
             VERIFY(m_resampler.has_value());
-            m_resampler->reset();
+            // NOTE: The resampler is deliberately not reset here; its filter
+            //       history makes consecutive buffers splice cleanly.
             // FIXME: Handle OOM better.
             auto resampled = MUST(FixedArray<Audio::Sample>::try_create(m_resampler->resample(move(m_current_buffer)).span()));
             m_current_buffer.swap(resampled);
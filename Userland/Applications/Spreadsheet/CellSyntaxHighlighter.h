@@ -16,6 +16,9 @@ public:
     CellSyntaxHighlighter() = default;
     virtual ~CellSyntaxHighlighter() override = default;
 
+    // Highlights the currently edited cell, so it cannot run against a snapshot.
+    virtual OwnPtr<Syntax::Highlighter> clone() const override { return {}; }
+
     virtual void rehighlight(Palette const&) override;
     void set_cell(Cell const* cell) { m_cell = cell; }
 
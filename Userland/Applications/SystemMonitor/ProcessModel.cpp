@@ -429,7 +429,7 @@ static DeprecatedString read_command_line(pid_t pid)
 void ProcessModel::update()
 {
     auto previous_tid_count = m_threads.size();
-    auto all_processes = Core::ProcessStatisticsReader::get_all(m_proc_all);
+    auto all_processes = Core::ProcessStatisticsReader::get_all(true, m_previous_statistics.has_value() ? &*m_previous_statistics : nullptr);
 
     HashTable<int> live_tids;
     u64 total_time_scheduled_diff = 0;
@@ -551,6 +551,9 @@ void ProcessModel::update()
     if (on_state_update)
         on_state_update(!all_processes.is_error() ? all_processes.value().processes.size() : 0, m_threads.size());
 
+    if (!all_processes.is_error())
+        m_previous_statistics = all_processes.release_value();
+
     // FIXME: This is a rather hackish way of invalidating indices.
     //        It would be good if GUI::Model had a way to orchestrate removal/insertion while preserving indices.
     did_update(previous_tid_count == m_threads.size() ? GUI::Model::UpdateFlag::DontInvalidateIndices : GUI::Model::UpdateFlag::InvalidateAllIndices);
@@ -11,6 +11,7 @@
 #include <AK/HashMap.h>
 #include <AK/NonnullOwnPtrVector.h>
 #include <AK/Vector.h>
+#include <LibCore/ProcessStatisticsReader.h>
 #include <LibGUI/Icon.h>
 #include <LibGUI/Model.h>
 #include <LibGUI/ModelIndex.h>
@@ -245,7 +246,9 @@ private:
     HashMap<int, NonnullRefPtr<Thread>> m_threads;
     NonnullOwnPtrVector<Process> m_processes;
     NonnullOwnPtrVector<CpuInfo> m_cpus;
-    RefPtr<Core::File> m_proc_all;
+    // The previous snapshot is kept so the reader can hand back unchanged
+    // processes without re-parsing their records.
+    Optional<Core::AllProcessesStatistics> m_previous_statistics;
     GUI::Icon m_kernel_process_icon;
     u64 m_total_time_scheduled { 0 };
     u64 m_total_time_scheduled_kernel { 0 };
@@ -39,6 +39,7 @@
 #include <LibGfx/Painter.h>
 #include <LibJS/SyntaxHighlighter.h>
 #include <LibMarkdown/Document.h>
+#include <LibMarkdown/IncrementalRenderer.h>
 #include <LibSQL/AST/SyntaxHighlighter.h>
 #include <LibWeb/CSS/SyntaxHighlighter/SyntaxHighlighter.h>
 #include <LibWeb/HTML/SyntaxHighlighter/SyntaxHighlighter.h>
@@ -837,13 +838,10 @@ void MainWidget::update_preview()
 
 void MainWidget::update_markdown_preview()
 {
-    auto document = Markdown::Document::parse(m_editor->text());
-    if (document) {
-        auto html = document->render_to_html();
-        auto current_scroll_pos = m_page_view->visible_content_rect();
-        m_page_view->load_html(html, URL::create_with_file_scheme(m_path));
-        m_page_view->scroll_into_view(current_scroll_pos, true, true);
-    }
+    auto html = m_markdown_renderer.render_to_html(m_editor->text());
+    auto current_scroll_pos = m_page_view->visible_content_rect();
+    m_page_view->load_html(html, URL::create_with_file_scheme(m_path));
+    m_page_view->scroll_into_view(current_scroll_pos, true, true);
 }
 
 void MainWidget::update_html_preview()
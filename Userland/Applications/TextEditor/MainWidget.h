@@ -16,6 +16,7 @@
 #include <LibGUI/TextEditor.h>
 #include <LibGUI/Widget.h>
 #include <LibGUI/Window.h>
+#include <LibMarkdown/IncrementalRenderer.h>
 #include <LibWebView/Forward.h>
 
 namespace TextEditor {
@@ -138,6 +139,8 @@ private:
 
     RefPtr<WebView::OutOfProcessWebView> m_page_view;
 
+    Markdown::IncrementalRenderer m_markdown_renderer;
+
     bool m_auto_detect_preview_mode { false };
     bool m_use_regex { false };
     bool m_match_case { true };
@@ -6,8 +6,10 @@
 
 #pragma once
 
+#include <AK/LexicalPath.h>
 #include <DevTools/HackStudio/LanguageServers/ConnectionFromClient.h>
 #include <LibCodeComprehension/Cpp/CppComprehensionEngine.h>
+#include <unistd.h>
 
 namespace LanguageServers::Cpp {
 
@@ -28,5 +30,20 @@ private:
     }
 
     virtual ~ConnectionFromClient() override = default;
+
+    virtual void greet(DeprecatedString const& project_root) override
+    {
+        // The persistent symbol index lives inside the project root, so it
+        // has to be unveiled writable before the base class locks the veil.
+        auto index_path = LexicalPath::join(project_root, CodeComprehension::Cpp::SymbolIndex::index_file_name).string();
+        if (unveil(index_path.characters(), "rwc") < 0) {
+            perror("unveil");
+            exit(1);
+        }
+
+        LanguageServers::ConnectionFromClient::greet(project_root);
+
+        static_cast<CodeComprehension::Cpp::CppComprehensionEngine&>(*m_autocomplete_engine).build_symbol_index();
+    }
 };
 }
@@ -15,11 +15,13 @@
 ErrorOr<int> serenity_main(Main::Arguments)
 {
     Core::EventLoop event_loop;
-    TRY(Core::System::pledge("stdio unix recvfd rpath"));
+    TRY(Core::System::pledge("stdio unix recvfd rpath wpath cpath thread"));
 
     auto client = TRY(IPC::take_over_accepted_client_from_system_server<LanguageServers::Cpp::ConnectionFromClient>());
 
-    TRY(Core::System::pledge("stdio recvfd rpath"));
+    // "thread" is for the background project indexer, and "wpath cpath" are
+    // for persisting the symbol index it builds.
+    TRY(Core::System::pledge("stdio recvfd rpath wpath cpath thread"));
     TRY(Core::System::unveil("/usr/include", "r"));
 
     // unveil will be sealed later, when we know the project's root path.
@@ -234,25 +234,18 @@ void Profile::rebuild_tree()
 Optional<MappedObject> g_kernel_debuginfo_object;
 OwnPtr<Debug::DebugInfo> g_kernel_debug_info;
 
-ErrorOr<NonnullOwnPtr<Profile>> Profile::load_from_perfcore_file(StringView path)
+struct ParsedPerfcore {
+    Vector<Process> processes;
+    Vector<Profile::Event> events;
+    size_t perf_event_count { 0 };
+};
+
+// Parses the events in a perfcore JSON object. Entries before
+// first_new_event_index are only replayed for their process/thread metadata;
+// their stacks were already symbolicated by an earlier parse of the same
+// (append-only) buffer, so they are not emitted again.
+static ErrorOr<ParsedPerfcore> parse_perfcore(JsonObject const& object, size_t first_new_event_index)
 {
-    auto file = TRY(Core::Stream::File::open(path, Core::Stream::OpenMode::Read));
-
-    auto json = JsonValue::from_string(TRY(file->read_until_eof()));
-    if (json.is_error() || !json.value().is_object())
-        return Error::from_string_literal("Invalid perfcore format (not a JSON object)");
-
-    auto const& object = json.value().as_object();
-
-    if (!g_kernel_debuginfo_object.has_value()) {
-        auto debuginfo_file_or_error = Core::MappedFile::map("/boot/Kernel.debug"sv);
-        if (!debuginfo_file_or_error.is_error()) {
-            auto debuginfo_file = debuginfo_file_or_error.release_value();
-            auto debuginfo_image = ELF::Image(debuginfo_file->bytes());
-            g_kernel_debuginfo_object = { { debuginfo_file, move(debuginfo_image) } };
-        }
-    }
-
     auto const* strings_value = object.get_ptr("strings"sv);
     if (!strings_value || !strings_value->is_array())
         return Error::from_string_literal("Malformed profile (strings is not an array)");
@@ -271,13 +264,13 @@ ErrorOr<NonnullOwnPtr<Profile>> Profile::load_from_perfcore_file(StringView path
 
     NonnullOwnPtrVector<Process> all_processes;
     HashMap<pid_t, Process*> current_processes;
-    Vector<Event> events;
+    Vector<Profile::Event> events;
     EventSerialNumber next_serial;
 
-    for (auto const& perf_event_value : perf_events.values()) {
-        auto const& perf_event = perf_event_value.as_object();
+    for (size_t perf_event_index = 0; perf_event_index < perf_events.size(); ++perf_event_index) {
+        auto const& perf_event = perf_events.at(perf_event_index).as_object();
 
-        Event event;
+        Profile::Event event;
 
         event.serial = next_serial;
         next_serial.increment();
@@ -289,19 +282,19 @@ ErrorOr<NonnullOwnPtr<Profile>> Profile::load_from_perfcore_file(StringView path
         auto type_string = perf_event.get("type"sv).to_deprecated_string();
 
         if (type_string == "sample"sv) {
-            event.data = Event::SampleData {};
+            event.data = Profile::Event::SampleData {};
         } else if (type_string == "malloc"sv) {
-            event.data = Event::MallocData {
+            event.data = Profile::Event::MallocData {
                 .ptr = perf_event.get("ptr"sv).to_number<FlatPtr>(),
                 .size = perf_event.get("size"sv).to_number<size_t>(),
             };
         } else if (type_string == "free"sv) {
-            event.data = Event::FreeData {
+            event.data = Profile::Event::FreeData {
                 .ptr = perf_event.get("ptr"sv).to_number<FlatPtr>(),
             };
         } else if (type_string == "signpost"sv) {
             auto string_id = perf_event.get("arg1"sv).to_number<FlatPtr>();
-            event.data = Event::SignpostData {
+            event.data = Profile::Event::SignpostData {
                 .string = profile_strings.get(string_id).value_or(DeprecatedString::formatted("Signpost #{}", string_id)),
                 .arg = perf_event.get("arg2"sv).to_number<FlatPtr>(),
             };
@@ -310,7 +303,7 @@ ErrorOr<NonnullOwnPtr<Profile>> Profile::load_from_perfcore_file(StringView path
             auto size = perf_event.get("size"sv).to_number<size_t>();
             auto name = perf_event.get("name"sv).to_deprecated_string();
 
-            event.data = Event::MmapData {
+            event.data = Profile::Event::MmapData {
                 .ptr = ptr,
                 .size = size,
                 .name = name,
@@ -321,7 +314,7 @@ ErrorOr<NonnullOwnPtr<Profile>> Profile::load_from_perfcore_file(StringView path
                 it->value->library_metadata.handle_mmap(ptr, size, name);
             continue;
         } else if (type_string == "munmap"sv) {
-            event.data = Event::MunmapData {
+            event.data = Profile::Event::MunmapData {
                 .ptr = perf_event.get("ptr"sv).to_number<FlatPtr>(),
                 .size = perf_event.get("size"sv).to_number<size_t>(),
             };
@@ -329,7 +322,7 @@ ErrorOr<NonnullOwnPtr<Profile>> Profile::load_from_perfcore_file(StringView path
         } else if (type_string == "process_create"sv) {
             auto parent_pid = perf_event.get("parent_pid"sv).to_number<pid_t>();
             auto executable = perf_event.get("executable"sv).to_deprecated_string();
-            event.data = Event::ProcessCreateData {
+            event.data = Profile::Event::ProcessCreateData {
                 .parent_pid = parent_pid,
                 .executable = executable,
             };
@@ -347,7 +340,7 @@ ErrorOr<NonnullOwnPtr<Profile>> Profile::load_from_perfcore_file(StringView path
             continue;
         } else if (type_string == "process_exec"sv) {
             auto executable = perf_event.get("executable"sv).to_deprecated_string();
-            event.data = Event::ProcessExecData {
+            event.data = Profile::Event::ProcessExecData {
                 .executable = executable,
             };
 
@@ -375,7 +368,7 @@ ErrorOr<NonnullOwnPtr<Profile>> Profile::load_from_perfcore_file(StringView path
             continue;
         } else if (type_string == "thread_create"sv) {
             auto parent_tid = perf_event.get("parent_tid"sv).to_number<pid_t>();
-            event.data = Event::ThreadCreateData {
+            event.data = Profile::Event::ThreadCreateData {
                 .parent_tid = parent_tid,
             };
             auto it = current_processes.find(event.pid);
@@ -389,7 +382,7 @@ ErrorOr<NonnullOwnPtr<Profile>> Profile::load_from_perfcore_file(StringView path
             continue;
         } else if (type_string == "read"sv) {
             auto const string_index = perf_event.get("filename_index"sv).to_number<FlatPtr>();
-            event.data = Event::ReadData {
+            event.data = Profile::Event::ReadData {
                 .fd = perf_event.get("fd"sv).to_number<int>(),
                 .size = perf_event.get("size"sv).to_number<size_t>(),
                 .path = profile_strings.get(string_index).value(),
@@ -401,6 +394,11 @@ ErrorOr<NonnullOwnPtr<Profile>> Profile::load_from_perfcore_file(StringView path
             VERIFY_NOT_REACHED();
         }
 
+        // An earlier snapshot of this buffer already symbolicated and recorded
+        // this event; only its process metadata (handled above) needed replaying.
+        if (perf_event_index < first_new_event_index)
+            continue;
+
         auto maybe_kernel_base = Symbolication::kernel_base();
 
         auto const* stack = perf_event.get_ptr("stack"sv);
@@ -445,9 +443,6 @@ ErrorOr<NonnullOwnPtr<Profile>> Profile::load_from_perfcore_file(StringView path
         events.append(move(event));
     }
 
-    if (events.is_empty())
-        return Error::from_string_literal("No events captured (targeted process was never on CPU)");
-
     quick_sort(all_processes, [](auto& a, auto& b) {
         if (a.pid == b.pid)
             return a.start_valid < b.start_valid;
@@ -459,7 +454,70 @@ ErrorOr<NonnullOwnPtr<Profile>> Profile::load_from_perfcore_file(StringView path
     for (auto& it : all_processes)
         processes.append(move(it));
 
-    return adopt_nonnull_own_or_enomem(new (nothrow) Profile(move(processes), move(events)));
+    return ParsedPerfcore { move(processes), move(events), perf_events.size() };
+}
+
+static ErrorOr<JsonObject> read_perfcore_file(StringView path)
+{
+    auto file = TRY(Core::Stream::File::open(path, Core::Stream::OpenMode::Read));
+
+    auto json = JsonValue::from_string(TRY(file->read_until_eof()));
+    if (json.is_error() || !json.value().is_object())
+        return Error::from_string_literal("Invalid perfcore format (not a JSON object)");
+
+    return json.value().as_object();
+}
+
+ErrorOr<NonnullOwnPtr<Profile>> Profile::load_from_perfcore_file(StringView path)
+{
+    auto object = TRY(read_perfcore_file(path));
+
+    if (!g_kernel_debuginfo_object.has_value()) {
+        auto debuginfo_file_or_error = Core::MappedFile::map("/boot/Kernel.debug"sv);
+        if (!debuginfo_file_or_error.is_error()) {
+            auto debuginfo_file = debuginfo_file_or_error.release_value();
+            auto debuginfo_image = ELF::Image(debuginfo_file->bytes());
+            g_kernel_debuginfo_object = { { debuginfo_file, move(debuginfo_image) } };
+        }
+    }
+
+    auto parsed = TRY(parse_perfcore(object, 0));
+
+    if (parsed.events.is_empty())
+        return Error::from_string_literal("No events captured (targeted process was never on CPU)");
+
+    auto profile = TRY(adopt_nonnull_own_or_enomem(new (nothrow) Profile(move(parsed.processes), move(parsed.events))));
+    profile->m_parsed_perf_event_count = parsed.perf_event_count;
+    return profile;
+}
+
+ErrorOr<bool> Profile::reload_new_events(StringView path)
+{
+    auto object = TRY(read_perfcore_file(path));
+
+    auto parsed = TRY(parse_perfcore(object, m_parsed_perf_event_count));
+    if (parsed.perf_event_count == m_parsed_perf_event_count && parsed.events.is_empty())
+        return false;
+    m_parsed_perf_event_count = parsed.perf_event_count;
+
+    // The old ProfileNodes reference the Process objects we're about to
+    // replace; rebuild_tree() below recreates them against the new list.
+    m_processes = move(parsed.processes);
+
+    m_events.ensure_capacity(m_events.size() + parsed.events.size());
+    for (auto& event : parsed.events) {
+        if (event.data.has<Event::SignpostData>())
+            m_signpost_indices.append(m_events.size());
+        m_events.unchecked_append(move(event));
+    }
+
+    m_first_timestamp = m_events.first().timestamp;
+    m_last_timestamp = m_events.last().timestamp;
+
+    rebuild_tree();
+    m_samples_model->invalidate();
+    m_signposts_model->invalidate();
+    return true;
 }
 
 void ProfileNode::sort_children()
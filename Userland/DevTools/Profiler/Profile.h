@@ -145,6 +145,11 @@ class Profile {
 public:
     static ErrorOr<NonnullOwnPtr<Profile>> load_from_perfcore_file(StringView path);
 
+    // Live profiling: parses any events the kernel has appended to the
+    // perfcore file since the last (re)load and merges them into the profile.
+    // Returns true if anything new was added.
+    ErrorOr<bool> reload_new_events(StringView path);
+
     GUI::Model& model();
     GUI::Model& samples_model();
     GUI::Model& signposts_model();
@@ -308,6 +313,9 @@ private:
 
     Vector<Process> m_processes;
     Vector<Event> m_events;
+    // How many entries of the perfcore "events" array have been parsed so far;
+    // reload_new_events() only symbolicates entries past this point.
+    size_t m_parsed_perf_event_count { 0 };
     Vector<size_t> m_signpost_indices;
     Vector<size_t> m_filtered_signpost_indices;
 
@@ -38,17 +38,20 @@
 #include <LibMain/Main.h>
 #include <serenity.h>
 #include <string.h>
+#include <unistd.h>
 
 using namespace Profiler;
 
-static bool generate_profile(pid_t& pid);
+static bool generate_profile(pid_t& pid, bool live_mode);
 
 ErrorOr<int> serenity_main(Main::Arguments arguments)
 {
     int pid = 0;
+    bool live_mode = false;
     char const* perfcore_file_arg = nullptr;
     Core::ArgsParser args_parser;
     args_parser.add_option(pid, "PID to profile", "pid", 'p', "PID");
+    args_parser.add_option(live_mode, "Keep updating the profile while the target keeps running", "live", 'l');
     args_parser.add_positional_argument(perfcore_file_arg, "Path of perfcore file", "perfcore-file", Core::ArgsParser::Required::No);
     args_parser.parse(arguments);
 
@@ -57,12 +60,17 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         return 1;
     }
 
+    if (live_mode && perfcore_file_arg) {
+        warnln("-l/--live option and perfcore-file argument must not be used together!");
+        return 1;
+    }
+
     auto app = TRY(GUI::Application::try_create(arguments));
     auto app_icon = TRY(GUI::Icon::try_create_default_icon("app-profiler"sv));
 
     DeprecatedString perfcore_file;
     if (!perfcore_file_arg) {
-        if (!generate_profile(pid))
+        if (!generate_profile(pid, live_mode))
             return 0;
         perfcore_file = DeprecatedString::formatted("/proc/{}/perf_events", pid);
     } else {
@@ -70,7 +78,17 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     }
 
     auto profile_or_error = Profile::load_from_perfcore_file(perfcore_file);
+    if (live_mode) {
+        // Right after enabling profiling the buffer may not contain any
+        // samples yet; give the target a moment to get back on CPU.
+        for (int attempt = 0; profile_or_error.is_error() && attempt < 50; ++attempt) {
+            usleep(100'000);
+            profile_or_error = Profile::load_from_perfcore_file(perfcore_file);
+        }
+    }
     if (profile_or_error.is_error()) {
+        if (live_mode)
+            profiling_disable(pid);
         GUI::MessageBox::show(nullptr, DeprecatedString::formatted("{}", profile_or_error.error()), "Profiler"sv, GUI::MessageBox::Type::Error);
         return 0;
     }
@@ -82,7 +100,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     TRY(Desktop::Launcher::add_allowed_handler_with_only_specific_urls("/bin/Help", { URL::create_with_file_scheme("/usr/share/man/man1/Profiler.md") }));
     TRY(Desktop::Launcher::seal_allowlist());
 
-    window->set_title("Profiler");
+    window->set_title(live_mode ? "Profiler (live)" : "Profiler");
     window->set_icon(app_icon.bitmap_for_size(16));
     window->resize(800, 600);
 
@@ -96,32 +114,37 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     timeline_header_container->set_shrink_to_fit(true);
 
     auto timeline_view = TRY(TimelineView::try_create(*profile));
-    for (auto const& process : profile->processes()) {
-        bool matching_event_found = false;
-        for (auto const& event : profile->events()) {
-            if (event.pid == process.pid && process.valid_at(event.serial)) {
-                matching_event_found = true;
-                break;
+    // The timeline headers and tracks bind to the process list loaded above,
+    // which is replaced wholesale on every live reload, so they are only
+    // shown for completed profiles.
+    if (!live_mode) {
+        for (auto const& process : profile->processes()) {
+            bool matching_event_found = false;
+            for (auto const& event : profile->events()) {
+                if (event.pid == process.pid && process.valid_at(event.serial)) {
+                    matching_event_found = true;
+                    break;
+                }
             }
+            if (!matching_event_found)
+                continue;
+            auto timeline_header = TRY(timeline_header_container->try_add<TimelineHeader>(*profile, process));
+            timeline_header->set_shrink_to_fit(true);
+            timeline_header->on_selection_change = [&](bool selected) {
+                auto end_valid = process.end_valid == EventSerialNumber {} ? EventSerialNumber::max_valid_serial() : process.end_valid;
+                if (selected)
+                    profile->add_process_filter(process.pid, process.start_valid, end_valid);
+                else
+                    profile->remove_process_filter(process.pid, process.start_valid, end_valid);
+
+                timeline_header_container->for_each_child_widget([](auto& other_timeline_header) {
+                    static_cast<TimelineHeader&>(other_timeline_header).update_selection();
+                    return IterationDecision::Continue;
+                });
+            };
+
+            (void)TRY(timeline_view->try_add<TimelineTrack>(*timeline_view, *profile, process));
         }
-        if (!matching_event_found)
-            continue;
-        auto timeline_header = TRY(timeline_header_container->try_add<TimelineHeader>(*profile, process));
-        timeline_header->set_shrink_to_fit(true);
-        timeline_header->on_selection_change = [&](bool selected) {
-            auto end_valid = process.end_valid == EventSerialNumber {} ? EventSerialNumber::max_valid_serial() : process.end_valid;
-            if (selected)
-                profile->add_process_filter(process.pid, process.start_valid, end_valid);
-            else
-                profile->remove_process_filter(process.pid, process.start_valid, end_valid);
-
-            timeline_header_container->for_each_child_widget([](auto& other_timeline_header) {
-                static_cast<TimelineHeader&>(other_timeline_header).update_selection();
-                return IterationDecision::Continue;
-            });
-        };
-
-        (void)TRY(timeline_view->try_add<TimelineTrack>(*timeline_view, *profile, process));
     }
 
     auto main_splitter = TRY(main_widget->try_add<GUI::VerticalSplitter>());
@@ -307,7 +330,19 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     TRY(help_menu->try_add_action(GUI::CommonActions::make_about_action("Profiler", app_icon, window)));
 
     window->show();
-    return app->exec();
+
+    RefPtr<Core::Timer> live_update_timer;
+    if (live_mode) {
+        live_update_timer = Core::Timer::construct(1000, [&] {
+            if (auto result = profile->reload_new_events(perfcore_file); result.is_error())
+                dbgln("Failed to load new profile events: {}", result.error());
+        });
+    }
+
+    auto exec_result = app->exec();
+    if (live_mode)
+        profiling_disable(pid);
+    return exec_result;
 }
 
 static bool prompt_to_stop_profiling(pid_t pid, DeprecatedString const& process_name)
@@ -340,7 +375,7 @@ static bool prompt_to_stop_profiling(pid_t pid, DeprecatedString const& process_
     return GUI::Application::the()->exec() == 0;
 }
 
-bool generate_profile(pid_t& pid)
+bool generate_profile(pid_t& pid, bool live_mode)
 {
     if (!pid) {
         auto process_chooser = GUI::ProcessChooser::construct("Profiler"sv, "Profile"sv, Gfx::Bitmap::try_load_from_file("/res/icons/16x16/app-profiler.png"sv).release_value_but_fixme_should_propagate_errors());
@@ -371,6 +406,11 @@ bool generate_profile(pid_t& pid)
         return false;
     }
 
+    // In live mode we leave profiling enabled and keep reading the event
+    // buffer while the main window is open; it's disabled on exit.
+    if (live_mode)
+        return true;
+
     if (!prompt_to_stop_profiling(pid, process_name))
         return false;
 
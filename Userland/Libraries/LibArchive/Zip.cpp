@@ -63,13 +63,12 @@ Optional<Zip> Zip::try_create(ReadonlyBytes buffer)
             return {}; // TODO: support multi-volume zip archives
         if (memchr(central_directory_record.name, 0, central_directory_record.name_length) != nullptr)
             return {};
-        LocalFileHeader local_file_header {};
         if (central_directory_record.local_file_header_offset > buffer.size())
             return {};
-        if (!local_file_header.read(buffer.slice(central_directory_record.local_file_header_offset)))
-            return {};
-        if (buffer.size() - (local_file_header.compressed_data - buffer.data()) < central_directory_record.compressed_size)
-            return {};
+        // NOTE: The member's local file header is only validated once the
+        //       member is opened through get_member(), so that creating a Zip
+        //       over a large (e.g. memory-mapped) archive only touches the
+        //       central directory at the end of the file.
         member_offset += central_directory_record.size();
     }
 
@@ -81,26 +80,31 @@ Optional<Zip> Zip::try_create(ReadonlyBytes buffer)
 }
 
 bool Zip::for_each_member(Function<IterationDecision(ZipMember const&)> callback)
+{
+    return for_each_member_information([&](ZipMemberInformation const& member_information) {
+        auto member = get_member(member_information);
+        VERIFY(member.has_value());
+        return callback(member.value());
+    });
+}
+
+bool Zip::for_each_member_information(Function<IterationDecision(ZipMemberInformation const&)> callback)
 {
     size_t member_offset = m_members_start_offset;
     for (size_t i = 0; i < m_member_count; i++) {
         CentralDirectoryRecord central_directory_record {};
         VERIFY(central_directory_record.read(m_input_data.slice(member_offset)));
-        LocalFileHeader local_file_header {};
-        VERIFY(local_file_header.read(m_input_data.slice(central_directory_record.local_file_header_offset)));
-
-        ZipMember member;
-        char null_terminated_name[central_directory_record.name_length + 1];
-        memcpy(null_terminated_name, central_directory_record.name, central_directory_record.name_length);
-        null_terminated_name[central_directory_record.name_length] = 0;
-        member.name = DeprecatedString { null_terminated_name };
-        member.compressed_data = { local_file_header.compressed_data, central_directory_record.compressed_size };
-        member.compression_method = central_directory_record.compression_method;
-        member.uncompressed_size = central_directory_record.uncompressed_size;
-        member.crc32 = central_directory_record.crc32;
-        member.is_directory = central_directory_record.external_attributes & zip_directory_external_attribute || member.name.ends_with('/'); // FIXME: better directory detection
-
-        if (callback(member) == IterationDecision::Break)
+
+        ZipMemberInformation member_information;
+        member_information.name = DeprecatedString { StringView { central_directory_record.name, central_directory_record.name_length } };
+        member_information.compression_method = central_directory_record.compression_method;
+        member_information.compressed_size = central_directory_record.compressed_size;
+        member_information.uncompressed_size = central_directory_record.uncompressed_size;
+        member_information.crc32 = central_directory_record.crc32;
+        member_information.is_directory = central_directory_record.external_attributes & zip_directory_external_attribute || member_information.name.ends_with('/'); // FIXME: better directory detection
+        member_information.local_file_header_offset = central_directory_record.local_file_header_offset;
+
+        if (callback(member_information) == IterationDecision::Break)
             return false;
 
         member_offset += central_directory_record.size();
@@ -108,6 +112,27 @@ bool Zip::for_each_member(Function<IterationDecision(ZipMember const&)> callback
     return true;
 }
 
+Optional<ZipMember> Zip::get_member(ZipMemberInformation const& member_information)
+{
+    if (member_information.local_file_header_offset > m_input_data.size())
+        return {};
+
+    LocalFileHeader local_file_header {};
+    if (!local_file_header.read(m_input_data.slice(member_information.local_file_header_offset)))
+        return {};
+    if (m_input_data.size() - (local_file_header.compressed_data - m_input_data.data()) < member_information.compressed_size)
+        return {};
+
+    ZipMember member;
+    member.name = member_information.name;
+    member.compressed_data = { local_file_header.compressed_data, member_information.compressed_size };
+    member.compression_method = member_information.compression_method;
+    member.uncompressed_size = member_information.uncompressed_size;
+    member.crc32 = member_information.crc32;
+    member.is_directory = member_information.is_directory;
+    return member;
+}
+
 ZipOutputStream::ZipOutputStream(OutputStream& stream)
     : m_stream(stream)
 {
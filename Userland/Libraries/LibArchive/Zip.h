@@ -233,10 +233,25 @@ struct ZipMember {
     bool is_directory;
 };
 
+// Metadata for a single member, parsed from the central directory alone. The
+// member's local file header and compressed data are only touched once the
+// member is actually opened through Zip::get_member().
+struct ZipMemberInformation {
+    DeprecatedString name;
+    ZipCompressionMethod compression_method;
+    u32 compressed_size;
+    u32 uncompressed_size;
+    u32 crc32;
+    bool is_directory;
+    u32 local_file_header_offset;
+};
+
 class Zip {
 public:
     static Optional<Zip> try_create(ReadonlyBytes buffer);
     bool for_each_member(Function<IterationDecision(ZipMember const&)>);
+    bool for_each_member_information(Function<IterationDecision(ZipMemberInformation const&)>);
+    Optional<ZipMember> get_member(ZipMemberInformation const&);
 
 private:
     static bool find_end_of_central_directory_offset(ReadonlyBytes, size_t& offset);
@@ -11,6 +11,7 @@
 #include <AK/Format.h>
 #include <AK/IntegralMath.h>
 #include <AK/Math.h>
+#include <AK/SIMD.h>
 #include <AK/ScopeGuard.h>
 #include <AK/StdLibExtras.h>
 #include <AK/Try.h>
@@ -737,19 +738,32 @@ ErrorOr<Vector<i32>, LoaderError> FlacLoaderPlugin::decode_custom_lpc(FlacSubfra
 
     TRY(decode_residual(decoded, subframe, bit_input));
 
-    // approximate the waveform with the predictor
-    for (size_t i = subframe.order; i < m_current_frame->sample_count; ++i) {
-        // (see below)
-        i64 sample = 0;
-        for (size_t t = 0; t < subframe.order; ++t) {
-            // It's really important that we compute in 64-bit land here.
-            // Even though FLAC operates at a maximum bit depth of 32 bits, modern encoders use super-large coefficients for maximum compression.
-            // These will easily overflow 32 bits and cause strange white noise that abruptly stops intermittently (at the end of a frame).
-            // The simple fix of course is to do intermediate computations in 64 bits.
-            // These considerations are not in the original FLAC spec, but have been added to the IETF standard: https://datatracker.ietf.org/doc/html/draft-ietf-cellar-flac-03#appendix-A.3
-            sample += static_cast<i64>(coefficients[t]) * static_cast<i64>(decoded[i - t - 1]);
+    // Approximate the waveform with the predictor.
+    // It's really important that we compute in 64-bit land here.
+    // Even though FLAC operates at a maximum bit depth of 32 bits, modern encoders use super-large coefficients for maximum compression.
+    // These will easily overflow 32 bits and cause strange white noise that abruptly stops intermittently (at the end of a frame).
+    // The simple fix of course is to do intermediate computations in 64 bits.
+    // These considerations are not in the original FLAC spec, but have been added to the IETF standard: https://datatracker.ietf.org/doc/html/draft-ietf-cellar-flac-03#appendix-A.3
+    // The dot product sums four taps per step into two independent vector
+    // accumulators; typical orders of 8-12 spend almost all their time here.
+    using AK::SIMD::i64x2;
+    auto const* coefficients_data = coefficients.data();
+    auto* decoded_data = decoded.data();
+    size_t const order = subframe.order;
+    for (size_t i = order; i < m_current_frame->sample_count; ++i) {
+        i64x2 accumulator_a { 0, 0 };
+        i64x2 accumulator_b { 0, 0 };
+        size_t t = 0;
+        for (; t + 4 <= order; t += 4) {
+            accumulator_a += i64x2 { coefficients_data[t], coefficients_data[t + 1] }
+                * i64x2 { decoded_data[i - t - 1], decoded_data[i - t - 2] };
+            accumulator_b += i64x2 { coefficients_data[t + 2], coefficients_data[t + 3] }
+                * i64x2 { decoded_data[i - t - 3], decoded_data[i - t - 4] };
         }
-        decoded[i] += sample >> lpc_shift;
+        i64 sample = accumulator_a[0] + accumulator_a[1] + accumulator_b[0] + accumulator_b[1];
+        for (; t < order; ++t)
+            sample += static_cast<i64>(coefficients_data[t]) * static_cast<i64>(decoded_data[i - t - 1]);
+        decoded_data[i] += sample >> lpc_shift;
     }
 
     return decoded;
@@ -791,32 +805,65 @@ ErrorOr<Vector<i32>, LoaderError> FlacLoaderPlugin::decode_fixed_lpc(FlacSubfram
     // http://mi.eng.cam.ac.uk/reports/svr-ftp/auto-pdf/robinson_tr156.pdf page 4
     // The coefficients for order 4 are undocumented in the original FLAC specification(s), but can now be found in
     // https://datatracker.ietf.org/doc/html/draft-ietf-cellar-flac-03#section-10.2.5
+    // Each kernel keeps its few samples of history in locals, so the
+    // recursion never reloads the value it just stored.
+    auto* decoded_data = decoded.data();
+    u32 const sample_count = m_current_frame->sample_count;
     switch (subframe.order) {
     case 0:
         // s_0(t) = 0
-        for (u32 i = subframe.order; i < m_current_frame->sample_count; ++i)
-            decoded[i] += 0;
         break;
-    case 1:
+    case 1: {
         // s_1(t) = s(t-1)
-        for (u32 i = subframe.order; i < m_current_frame->sample_count; ++i)
-            decoded[i] += decoded[i - 1];
+        i32 previous = decoded_data[0];
+        for (u32 i = 1; i < sample_count; ++i) {
+            previous += decoded_data[i];
+            decoded_data[i] = previous;
+        }
         break;
-    case 2:
+    }
+    case 2: {
         // s_2(t) = 2s(t-1) - s(t-2)
-        for (u32 i = subframe.order; i < m_current_frame->sample_count; ++i)
-            decoded[i] += 2 * decoded[i - 1] - decoded[i - 2];
+        i32 previous = decoded_data[1];
+        i32 second_previous = decoded_data[0];
+        for (u32 i = 2; i < sample_count; ++i) {
+            i32 current = decoded_data[i] + 2 * previous - second_previous;
+            decoded_data[i] = current;
+            second_previous = previous;
+            previous = current;
+        }
         break;
-    case 3:
+    }
+    case 3: {
         // s_3(t) = 3s(t-1) - 3s(t-2) + s(t-3)
-        for (u32 i = subframe.order; i < m_current_frame->sample_count; ++i)
-            decoded[i] += 3 * decoded[i - 1] - 3 * decoded[i - 2] + decoded[i - 3];
+        i32 previous = decoded_data[2];
+        i32 second_previous = decoded_data[1];
+        i32 third_previous = decoded_data[0];
+        for (u32 i = 3; i < sample_count; ++i) {
+            i32 current = decoded_data[i] + 3 * previous - 3 * second_previous + third_previous;
+            decoded_data[i] = current;
+            third_previous = second_previous;
+            second_previous = previous;
+            previous = current;
+        }
         break;
-    case 4:
+    }
+    case 4: {
         // s_4(t) = 4s(t-1) - 6s(t-2) + 4s(t-3) - s(t-4)
-        for (u32 i = subframe.order; i < m_current_frame->sample_count; ++i)
-            decoded[i] += 4 * decoded[i - 1] - 6 * decoded[i - 2] + 4 * decoded[i - 3] - decoded[i - 4];
+        i32 previous = decoded_data[3];
+        i32 second_previous = decoded_data[2];
+        i32 third_previous = decoded_data[1];
+        i32 fourth_previous = decoded_data[0];
+        for (u32 i = 4; i < sample_count; ++i) {
+            i32 current = decoded_data[i] + 4 * previous - 6 * second_previous + 4 * third_previous - fourth_previous;
+            decoded_data[i] = current;
+            fourth_previous = third_previous;
+            third_previous = second_previous;
+            second_previous = previous;
+            previous = current;
+        }
         break;
+    }
     default:
         return LoaderError { LoaderError::Category::Format, static_cast<size_t>(m_current_sample_or_frame), DeprecatedString::formatted("Unrecognized predictor order {}", subframe.order) };
     }
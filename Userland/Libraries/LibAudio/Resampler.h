@@ -7,6 +7,8 @@
 #pragma once
 
 #include <AK/Concepts.h>
+#include <AK/Math.h>
+#include <AK/StdLibExtras.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
 
@@ -84,4 +86,139 @@ private:
     SampleType m_last_sample_r {};
 };
 
+// A polyphase windowed-sinc resampler with precomputed filter banks.
+// Unlike ResampleHelper, which repeats or drops samples, this low-pass
+// filters while converting the rate, trading some CPU for far less aliasing;
+// when downsampling, the cutoff follows the target's Nyquist frequency.
+// Quality selects the filter length per phase.
+template<typename SampleType>
+class SincResampler {
+public:
+    enum class Quality {
+        Low,    // 8 taps per phase
+        Medium, // 16 taps per phase
+        High,   // 32 taps per phase
+    };
+
+    SincResampler(u32 source, u32 target, Quality quality = Quality::Medium)
+        : m_source(source)
+        , m_target(target)
+        , m_taps_per_phase(taps_for_quality(quality))
+    {
+        VERIFY(source > 0);
+        VERIFY(target > 0);
+
+        if (m_source == m_target)
+            return;
+
+        // Precompute one windowed-sinc low-pass per fractional phase,
+        // normalized to unity gain.
+        float const cutoff_ratio = m_target < m_source ? static_cast<float>(m_target) / static_cast<float>(m_source) : 1.0f;
+        float const center = static_cast<float>(m_taps_per_phase - 1) / 2.0f;
+        m_filter_bank.resize(phase_count * m_taps_per_phase);
+        for (size_t phase = 0; phase < phase_count; ++phase) {
+            auto* taps = m_filter_bank.data() + phase * m_taps_per_phase;
+            float const offset = static_cast<float>(phase) / static_cast<float>(phase_count);
+            float tap_sum = 0.0f;
+            for (size_t tap = 0; tap < m_taps_per_phase; ++tap) {
+                float const position = (static_cast<float>(tap) - center - offset) * cutoff_ratio;
+                float const sinc = position == 0.0f ? 1.0f : AK::sin(AK::Pi<float> * position) / (AK::Pi<float> * position);
+                // Hann window over the filter span, evaluated at the same
+                // fractional position as the sinc.
+                float const window_position = (static_cast<float>(tap) - offset + 0.5f) / static_cast<float>(m_taps_per_phase);
+                float const window = 0.5f - 0.5f * AK::cos(2.0f * AK::Pi<float> * window_position);
+                taps[tap] = sinc * window;
+                tap_sum += taps[tap];
+            }
+            for (size_t tap = 0; tap < m_taps_per_phase; ++tap)
+                taps[tap] /= tap_sum;
+        }
+
+        m_history.resize(m_taps_per_phase);
+    }
+
+    // Processes one block of samples. Filter history carries over between
+    // calls, so consecutive blocks splice cleanly; call reset() when seeking.
+    template<ArrayLike<SampleType> Samples>
+    Vector<SampleType> resample(Samples&& to_resample)
+    {
+        Vector<SampleType> resampled;
+        if (m_source == m_target) {
+            resampled.ensure_capacity(to_resample.size());
+            for (auto const& sample : to_resample)
+                resampled.unchecked_append(sample);
+            return resampled;
+        }
+
+        resampled.ensure_capacity(to_resample.size() * m_target / m_source + 1);
+        for (auto const& sample : to_resample) {
+            m_history[m_history_head] = sample;
+            m_history_head = (m_history_head + 1) % m_taps_per_phase;
+
+            m_current_ratio += m_target;
+            while (m_current_ratio >= m_source) {
+                m_current_ratio -= m_source;
+                auto const phase = static_cast<size_t>(static_cast<u64>(m_current_ratio) * phase_count / m_source);
+                resampled.append(convolve(phase));
+            }
+        }
+        return resampled;
+    }
+
+    void reset()
+    {
+        m_current_ratio = 0;
+        m_history_head = 0;
+        for (auto& sample : m_history)
+            sample = SampleType {};
+    }
+
+    u32 source() const { return m_source; }
+    u32 target() const { return m_target; }
+
+private:
+    static constexpr size_t phase_count = 256;
+
+    static size_t taps_for_quality(Quality quality)
+    {
+        switch (quality) {
+        case Quality::Low:
+            return 8;
+        case Quality::Medium:
+            return 16;
+        case Quality::High:
+            return 32;
+        }
+        VERIFY_NOT_REACHED();
+    }
+
+    SampleType convolve(size_t phase) const
+    {
+        // Integral sample types are accumulated in floating point and rounded
+        // once at the end.
+        using Accumulator = Conditional<IsIntegral<SampleType>, float, SampleType>;
+        auto const* taps = m_filter_bank.data() + phase * m_taps_per_phase;
+        Accumulator accumulator {};
+        for (size_t tap = 0; tap < m_taps_per_phase; ++tap) {
+            auto const& history_sample = m_history[(m_history_head + tap) % m_taps_per_phase];
+            if constexpr (IsIntegral<SampleType>)
+                accumulator += static_cast<float>(history_sample) * taps[tap];
+            else
+                accumulator += history_sample * taps[tap];
+        }
+        if constexpr (IsIntegral<SampleType>)
+            return static_cast<SampleType>(AK::round_to<SampleType>(accumulator));
+        else
+            return accumulator;
+    }
+
+    const u32 m_source;
+    const u32 m_target;
+    size_t m_taps_per_phase;
+    Vector<float> m_filter_bank;
+    Vector<SampleType> m_history;
+    size_t m_history_head { 0 };
+    u32 m_current_ratio { 0 };
+};
+
 }
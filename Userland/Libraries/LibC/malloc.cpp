@@ -96,6 +96,7 @@ struct MemoryAuditingSuppressor {
 
 struct MallocStats {
     size_t number_of_malloc_calls;
+    size_t number_of_thread_cache_hits;
 
     size_t number_of_big_allocator_hits;
     size_t number_of_big_allocator_purge_hits;
@@ -108,6 +109,7 @@ struct MallocStats {
     size_t number_of_blocks_full;
 
     size_t number_of_free_calls;
+    size_t number_of_thread_cache_flushes;
 
     size_t number_of_big_allocator_keeps;
     size_t number_of_big_allocator_frees;
@@ -154,6 +156,28 @@ static inline BigAllocator (&big_allocators())[1]
     return reinterpret_cast<BigAllocator(&)[1]>(g_big_allocators_storage);
 }
 
+#ifndef NO_TLS
+// Each thread keeps a small magazine of free chunks per size class so that
+// most malloc()/free() pairs never have to touch s_malloc_mutex. Chunks in a
+// magazine still count as "used" in their ChunkedBlock; they only go back to
+// the central allocator when a magazine overflows or the thread exits.
+struct ThreadCache {
+    FreelistEntry* freelist[num_size_classes];
+    size_t count[num_size_classes];
+    bool torn_down;
+};
+// Zero-initialized, like all thread-local data; no constructor may run here.
+static __thread ThreadCache s_thread_cache;
+static bool s_thread_caching_enabled = true;
+
+static size_t thread_cache_limit_for_size_class(size_t chunk_size)
+{
+    // Cap each magazine at 32 chunks, and at roughly 8 KiB for the larger
+    // size classes.
+    return max(static_cast<size_t>(2), min(static_cast<size_t>(32), static_cast<size_t>(8 * KiB) / chunk_size));
+}
+#endif
+
 // --- BEGIN MATH ---
 // This stuff is only used for checking if there exists an aligned block in a
 // chunk. It has no bearing on the rest of the allocator, especially for
@@ -285,6 +309,169 @@ static void* try_allocate_chunk_aligned(size_t align, ChunkedBlock& block)
     return nullptr;
 }
 
+// Carves one chunk out of the given size class, taking a block from the
+// empty-block pools or the OS if no usable block has a fitting chunk.
+// The malloc lock must be held.
+static ErrorOr<void*> allocate_chunk(Allocator& allocator, size_t good_size, size_t align)
+{
+    ChunkedBlock* block = nullptr;
+    void* ptr = nullptr;
+    for (auto& current : allocator.usable_blocks) {
+        if (current.free_chunks()) {
+            ptr = try_allocate_chunk_aligned(align, current);
+            if (ptr) {
+                block = &current;
+                break;
+            }
+        }
+    }
+
+    if (!block && s_hot_empty_block_count) {
+        g_malloc_stats.number_of_hot_empty_block_hits++;
+        block = s_hot_empty_blocks[--s_hot_empty_block_count];
+        if (block->m_size != good_size) {
+            new (block) ChunkedBlock(good_size);
+            ue_notify_chunk_size_changed(block, good_size);
+            char buffer[64];
+            snprintf(buffer, sizeof(buffer), "malloc: ChunkedBlock(%zu)", good_size);
+            set_mmap_name(block, ChunkedBlock::block_size, buffer);
+        }
+        allocator.usable_blocks.append(*block);
+    }
+
+    if (!block && s_cold_empty_block_count) {
+        g_malloc_stats.number_of_cold_empty_block_hits++;
+        block = s_cold_empty_blocks[--s_cold_empty_block_count];
+        int rc = madvise(block, ChunkedBlock::block_size, MADV_SET_NONVOLATILE);
+        bool this_block_was_purged = rc == 1;
+        if (rc < 0) {
+            perror("madvise");
+            VERIFY_NOT_REACHED();
+        }
+        rc = mprotect(block, ChunkedBlock::block_size, PROT_READ | PROT_WRITE);
+        if (rc < 0) {
+            perror("mprotect");
+            VERIFY_NOT_REACHED();
+        }
+        if (this_block_was_purged || block->m_size != good_size) {
+            if (this_block_was_purged)
+                g_malloc_stats.number_of_cold_empty_block_purge_hits++;
+            new (block) ChunkedBlock(good_size);
+            ue_notify_chunk_size_changed(block, good_size);
+        }
+        allocator.usable_blocks.append(*block);
+    }
+
+    if (!block) {
+        g_malloc_stats.number_of_block_allocs++;
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "malloc: ChunkedBlock(%zu)", good_size);
+        block = (ChunkedBlock*)TRY(os_alloc(ChunkedBlock::block_size, buffer));
+        new (block) ChunkedBlock(good_size);
+        allocator.usable_blocks.append(*block);
+        ++allocator.block_count;
+    }
+
+    if (!ptr) {
+        ptr = try_allocate_chunk_aligned(align, *block);
+    }
+
+    VERIFY(ptr);
+    if (block->is_full()) {
+        g_malloc_stats.number_of_blocks_full++;
+        dbgln_if(MALLOC_DEBUG, "Block {:p} is now full in size class {}", block, good_size);
+        allocator.usable_blocks.remove(*block);
+        allocator.full_blocks.append(*block);
+    }
+    dbgln_if(MALLOC_DEBUG, "LibC: allocated {:p} (chunk in block {:p}, size {})", ptr, block, block->bytes_per_chunk());
+    return ptr;
+}
+
+// Returns a chunk to its ChunkedBlock, handing the block to the empty-block
+// pools or back to the OS if this was its last used chunk. The malloc lock
+// must be held.
+static void free_chunk(void* ptr, ChunkedBlock& block)
+{
+    auto* entry = (FreelistEntry*)ptr;
+    entry->next = block.m_freelist;
+    block.m_freelist = entry;
+
+    if (block.is_full()) {
+        size_t good_size;
+        auto* allocator = allocator_for_size(block.m_size, good_size);
+        dbgln_if(MALLOC_DEBUG, "Block {:p} no longer full in size class {}", &block, good_size);
+        g_malloc_stats.number_of_freed_full_blocks++;
+        allocator->full_blocks.remove(block);
+        allocator->usable_blocks.prepend(block);
+    }
+
+    ++block.m_free_chunks;
+
+    if (!block.used_chunks()) {
+        size_t good_size;
+        auto* allocator = allocator_for_size(block.m_size, good_size);
+        if (s_hot_empty_block_count < number_of_hot_chunked_blocks_to_keep_around) {
+            dbgln_if(MALLOC_DEBUG, "Keeping hot block {:p} around", &block);
+            g_malloc_stats.number_of_hot_keeps++;
+            allocator->usable_blocks.remove(block);
+            s_hot_empty_blocks[s_hot_empty_block_count++] = &block;
+            return;
+        }
+        if (s_cold_empty_block_count < number_of_cold_chunked_blocks_to_keep_around) {
+            dbgln_if(MALLOC_DEBUG, "Keeping cold block {:p} around", &block);
+            g_malloc_stats.number_of_cold_keeps++;
+            allocator->usable_blocks.remove(block);
+            s_cold_empty_blocks[s_cold_empty_block_count++] = &block;
+            mprotect(&block, ChunkedBlock::block_size, PROT_NONE);
+            madvise(&block, ChunkedBlock::block_size, MADV_SET_VOLATILE);
+            return;
+        }
+        dbgln_if(MALLOC_DEBUG, "Releasing block {:p} for size class {}", &block, good_size);
+        g_malloc_stats.number_of_frees++;
+        allocator->usable_blocks.remove(block);
+        --allocator->block_count;
+        os_free(&block, ChunkedBlock::block_size);
+    }
+}
+
+#ifndef NO_TLS
+ALWAYS_INLINE static void* try_take_chunk_from_thread_cache(size_t class_index)
+{
+    auto& cache = s_thread_cache;
+    auto* entry = cache.freelist[class_index];
+    if (!entry)
+        return nullptr;
+    cache.freelist[class_index] = entry->next;
+    --cache.count[class_index];
+    g_malloc_stats.number_of_thread_cache_hits++;
+    return entry;
+}
+
+ALWAYS_INLINE static void put_chunk_into_thread_cache(size_t class_index, void* ptr)
+{
+    auto& cache = s_thread_cache;
+    auto* entry = (FreelistEntry*)ptr;
+    entry->next = cache.freelist[class_index];
+    cache.freelist[class_index] = entry;
+    ++cache.count[class_index];
+}
+
+// Gives half of an overflowing magazine back to the central allocator, so
+// chunks can migrate between threads with unbalanced allocation patterns.
+static void flush_thread_cache(size_t class_index, size_t chunks_to_keep)
+{
+    auto& cache = s_thread_cache;
+    g_malloc_stats.number_of_thread_cache_flushes++;
+    PthreadMutexLocker locker(s_malloc_mutex);
+    while (cache.count[class_index] > chunks_to_keep) {
+        auto* entry = cache.freelist[class_index];
+        cache.freelist[class_index] = entry->next;
+        --cache.count[class_index];
+        free_chunk(entry, *(ChunkedBlock*)((FlatPtr)entry & ChunkedBlock::block_mask));
+    }
+}
+#endif
+
 enum class CallerWillInitializeMemory {
     No,
     Yes,
@@ -322,6 +509,20 @@ static ErrorOr<void*> malloc_impl(size_t size, size_t align, CallerWillInitializ
     size_t good_size;
     auto* allocator = allocator_for_size(size, good_size, align);
 
+#ifndef NO_TLS
+    // Every chunk is 16-byte aligned, so the magazines can serve any
+    // standard-aligned allocation without consulting the block math.
+    bool can_use_thread_cache = s_thread_caching_enabled && !s_thread_cache.torn_down && allocator && align <= 16;
+    if (can_use_thread_cache) {
+        if (void* ptr = try_take_chunk_from_thread_cache(allocator - allocators())) {
+            if (s_scrub_malloc && caller_will_initialize_memory == CallerWillInitializeMemory::No)
+                memset(ptr, MALLOC_SCRUB_BYTE, good_size);
+            ue_notify_malloc(ptr, size);
+            return ptr;
+        }
+    }
+#endif
+
     PthreadMutexLocker locker(s_malloc_mutex);
 
     if (!allocator) {
@@ -366,79 +567,27 @@ static ErrorOr<void*> malloc_impl(size_t size, size_t align, CallerWillInitializ
         return ptr;
     }
 
-    ChunkedBlock* block = nullptr;
-    void* ptr = nullptr;
-    for (auto& current : allocator->usable_blocks) {
-        if (current.free_chunks()) {
-            ptr = try_allocate_chunk_aligned(align, current);
-            if (ptr) {
-                block = &current;
-                break;
-            }
-        }
-    }
-
-    if (!block && s_hot_empty_block_count) {
-        g_malloc_stats.number_of_hot_empty_block_hits++;
-        block = s_hot_empty_blocks[--s_hot_empty_block_count];
-        if (block->m_size != good_size) {
-            new (block) ChunkedBlock(good_size);
-            ue_notify_chunk_size_changed(block, good_size);
-            char buffer[64];
-            snprintf(buffer, sizeof(buffer), "malloc: ChunkedBlock(%zu)", good_size);
-            set_mmap_name(block, ChunkedBlock::block_size, buffer);
-        }
-        allocator->usable_blocks.append(*block);
-    }
+    auto* ptr = TRY(allocate_chunk(*allocator, good_size, align));
 
-    if (!block && s_cold_empty_block_count) {
-        g_malloc_stats.number_of_cold_empty_block_hits++;
-        block = s_cold_empty_blocks[--s_cold_empty_block_count];
-        int rc = madvise(block, ChunkedBlock::block_size, MADV_SET_NONVOLATILE);
-        bool this_block_was_purged = rc == 1;
-        if (rc < 0) {
-            perror("madvise");
-            VERIFY_NOT_REACHED();
-        }
-        rc = mprotect(block, ChunkedBlock::block_size, PROT_READ | PROT_WRITE);
-        if (rc < 0) {
-            perror("mprotect");
-            VERIFY_NOT_REACHED();
-        }
-        if (this_block_was_purged || block->m_size != good_size) {
-            if (this_block_was_purged)
-                g_malloc_stats.number_of_cold_empty_block_purge_hits++;
-            new (block) ChunkedBlock(good_size);
-            ue_notify_chunk_size_changed(block, good_size);
+#ifndef NO_TLS
+    if (can_use_thread_cache) {
+        // A magazine miss is a good predictor of more misses; grab half a
+        // magazine's worth of chunks while we already hold the lock.
+        size_t class_index = allocator - allocators();
+        size_t chunks_to_grab = thread_cache_limit_for_size_class(good_size) / 2;
+        while (s_thread_cache.count[class_index] < chunks_to_grab) {
+            auto chunk_or_error = allocate_chunk(*allocator, good_size, align);
+            if (chunk_or_error.is_error())
+                break;
+            if (s_scrub_free)
+                memset(chunk_or_error.value(), FREE_SCRUB_BYTE, good_size);
+            put_chunk_into_thread_cache(class_index, chunk_or_error.value());
         }
-        allocator->usable_blocks.append(*block);
     }
-
-    if (!block) {
-        g_malloc_stats.number_of_block_allocs++;
-        char buffer[64];
-        snprintf(buffer, sizeof(buffer), "malloc: ChunkedBlock(%zu)", good_size);
-        block = (ChunkedBlock*)TRY(os_alloc(ChunkedBlock::block_size, buffer));
-        new (block) ChunkedBlock(good_size);
-        allocator->usable_blocks.append(*block);
-        ++allocator->block_count;
-    }
-
-    if (!ptr) {
-        ptr = try_allocate_chunk_aligned(align, *block);
-    }
-
-    VERIFY(ptr);
-    if (block->is_full()) {
-        g_malloc_stats.number_of_blocks_full++;
-        dbgln_if(MALLOC_DEBUG, "Block {:p} is now full in size class {}", block, good_size);
-        allocator->usable_blocks.remove(*block);
-        allocator->full_blocks.append(*block);
-    }
-    dbgln_if(MALLOC_DEBUG, "LibC: allocated {:p} (chunk in block {:p}, size {})", ptr, block, block->bytes_per_chunk());
+#endif
 
     if (s_scrub_malloc && caller_will_initialize_memory == CallerWillInitializeMemory::No)
-        memset(ptr, MALLOC_SCRUB_BYTE, block->m_size);
+        memset(ptr, MALLOC_SCRUB_BYTE, good_size);
 
     ue_notify_malloc(ptr, size);
     return ptr;
@@ -460,10 +609,9 @@ static void free_impl(void* ptr)
     void* block_base = (void*)((FlatPtr)ptr & ChunkedBlock::ChunkedBlock::block_mask);
     size_t magic = *(size_t*)block_base;
 
-    PthreadMutexLocker locker(s_malloc_mutex);
-
     if (magic == MAGIC_BIGALLOC_HEADER) {
         auto* block = (BigAllocationBlock*)block_base;
+        PthreadMutexLocker locker(s_malloc_mutex);
 #ifdef RECYCLE_BIG_ALLOCATIONS
         if (auto* allocator = big_allocator_for_size(block->m_size)) {
             if (allocator->blocks.size() < number_of_big_blocks_to_keep_around_per_size_class) {
@@ -495,46 +643,22 @@ static void free_impl(void* ptr)
     if (s_scrub_free)
         memset(ptr, FREE_SCRUB_BYTE, block->bytes_per_chunk());
 
-    auto* entry = (FreelistEntry*)ptr;
-    entry->next = block->m_freelist;
-    block->m_freelist = entry;
-
-    if (block->is_full()) {
+#ifndef NO_TLS
+    if (s_thread_caching_enabled && !s_thread_cache.torn_down) {
         size_t good_size;
         auto* allocator = allocator_for_size(block->m_size, good_size);
-        dbgln_if(MALLOC_DEBUG, "Block {:p} no longer full in size class {}", block, good_size);
-        g_malloc_stats.number_of_freed_full_blocks++;
-        allocator->full_blocks.remove(*block);
-        allocator->usable_blocks.prepend(*block);
+        VERIFY(allocator);
+        size_t class_index = allocator - allocators();
+        auto limit = thread_cache_limit_for_size_class(block->m_size);
+        if (s_thread_cache.count[class_index] >= limit)
+            flush_thread_cache(class_index, limit / 2);
+        put_chunk_into_thread_cache(class_index, ptr);
+        return;
     }
+#endif
 
-    ++block->m_free_chunks;
-
-    if (!block->used_chunks()) {
-        size_t good_size;
-        auto* allocator = allocator_for_size(block->m_size, good_size);
-        if (s_hot_empty_block_count < number_of_hot_chunked_blocks_to_keep_around) {
-            dbgln_if(MALLOC_DEBUG, "Keeping hot block {:p} around", block);
-            g_malloc_stats.number_of_hot_keeps++;
-            allocator->usable_blocks.remove(*block);
-            s_hot_empty_blocks[s_hot_empty_block_count++] = block;
-            return;
-        }
-        if (s_cold_empty_block_count < number_of_cold_chunked_blocks_to_keep_around) {
-            dbgln_if(MALLOC_DEBUG, "Keeping cold block {:p} around", block);
-            g_malloc_stats.number_of_cold_keeps++;
-            allocator->usable_blocks.remove(*block);
-            s_cold_empty_blocks[s_cold_empty_block_count++] = block;
-            mprotect(block, ChunkedBlock::block_size, PROT_NONE);
-            madvise(block, ChunkedBlock::block_size, MADV_SET_VOLATILE);
-            return;
-        }
-        dbgln_if(MALLOC_DEBUG, "Releasing block {:p} for size class {}", block, good_size);
-        g_malloc_stats.number_of_frees++;
-        allocator->usable_blocks.remove(*block);
-        --allocator->block_count;
-        os_free(block, ChunkedBlock::block_size);
-    }
+    PthreadMutexLocker locker(s_malloc_mutex);
+    free_chunk(ptr, *block);
 }
 
 // https://pubs.opengroup.org/onlinepubs/9699919799/functions/malloc.html
@@ -674,6 +798,10 @@ void __malloc_init()
         s_log_malloc = true;
     if (secure_getenv("LIBC_PROFILE_MALLOC"))
         s_profiling = true;
+#ifndef NO_TLS
+    if (secure_getenv("LIBC_NOCACHE_MALLOC"))
+        s_thread_caching_enabled = false;
+#endif
 
     for (size_t i = 0; i < num_size_classes; ++i) {
         new (&allocators()[i]) Allocator();
@@ -683,9 +811,27 @@ void __malloc_init()
     new (&big_allocators()[0])(BigAllocator);
 }
 
+void __malloc_thread_cleanup()
+{
+#ifndef NO_TLS
+    // Return everything in this thread's magazines to the central allocator;
+    // the chunks may well outlive the thread.
+    PthreadMutexLocker locker(s_malloc_mutex);
+    for (size_t i = 0; i < num_size_classes; ++i) {
+        while (auto* entry = s_thread_cache.freelist[i]) {
+            s_thread_cache.freelist[i] = entry->next;
+            free_chunk(entry, *(ChunkedBlock*)((FlatPtr)entry & ChunkedBlock::block_mask));
+        }
+        s_thread_cache.count[i] = 0;
+    }
+    s_thread_cache.torn_down = true;
+#endif
+}
+
 void serenity_dump_malloc_stats()
 {
     dbgln("# malloc() calls: {}", g_malloc_stats.number_of_malloc_calls);
+    dbgln("thread cache hits: {}", g_malloc_stats.number_of_thread_cache_hits);
     dbgln();
     dbgln("big alloc hits: {}", g_malloc_stats.number_of_big_allocator_hits);
     dbgln("big alloc hits that were purged: {}", g_malloc_stats.number_of_big_allocator_purge_hits);
@@ -698,6 +844,7 @@ void serenity_dump_malloc_stats()
     dbgln("filled blocks: {}", g_malloc_stats.number_of_blocks_full);
     dbgln();
     dbgln("# free() calls: {}", g_malloc_stats.number_of_free_calls);
+    dbgln("thread cache flushes: {}", g_malloc_stats.number_of_thread_cache_flushes);
     dbgln();
     dbgln("big alloc keeps: {}", g_malloc_stats.number_of_big_allocator_keeps);
     dbgln("big alloc frees: {}", g_malloc_stats.number_of_big_allocator_frees);
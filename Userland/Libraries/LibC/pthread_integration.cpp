@@ -97,6 +97,13 @@ static constexpr u32 MUTEX_UNLOCKED = 0;
 static constexpr u32 MUTEX_LOCKED_NO_NEED_TO_WAKE = 1;
 static constexpr u32 MUTEX_LOCKED_NEED_TO_WAKE = 2;
 
+ALWAYS_INLINE static void mutex_relax()
+{
+#if ARCH(X86_64)
+    __builtin_ia32_pause();
+#endif
+}
+
 // https://pubs.opengroup.org/onlinepubs/009695399/functions/pthread_mutex_init.html
 int pthread_mutex_init(pthread_mutex_t* mutex, pthread_mutexattr_t const* attributes)
 {
@@ -149,6 +156,29 @@ int pthread_mutex_lock(pthread_mutex_t* mutex)
         }
     }
 
+    // Adaptive path: the mutex is taken, but nobody is sleeping on it yet.
+    // The holder is probably about to release it, so spin with exponential
+    // backoff for a little while before committing to a futex wait.
+    if (value == MUTEX_LOCKED_NO_NEED_TO_WAKE) {
+        constexpr u32 max_backoff = 64;
+        for (u32 backoff = 1; backoff <= max_backoff; backoff *= 2) {
+            for (u32 i = 0; i < backoff; ++i)
+                mutex_relax();
+            value = MUTEX_UNLOCKED;
+            exchanged = AK::atomic_compare_exchange_strong(&mutex->lock, value, MUTEX_LOCKED_NO_NEED_TO_WAKE, AK::memory_order_acquire);
+            if (exchanged) [[likely]] {
+                if (mutex->type == __PTHREAD_MUTEX_RECURSIVE)
+                    AK::atomic_store(&mutex->owner, pthread_self(), AK::memory_order_relaxed);
+                mutex->level = 0;
+                return 0;
+            }
+            // Once someone else has started sleeping on the mutex, stop
+            // spinning and join them, so the unlocker keeps waking us up.
+            if (value == MUTEX_LOCKED_NEED_TO_WAKE)
+                break;
+        }
+    }
+
     // Slow path: wait, record the fact that we're going to wait, and always
     // remember to wake the next thread up once we release the mutex.
     if (value != MUTEX_LOCKED_NEED_TO_WAKE)
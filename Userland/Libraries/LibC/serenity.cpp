@@ -101,6 +101,31 @@ int anon_create(size_t size, int options)
     __RETURN_WITH_ERRNO(rc, rc, -1);
 }
 
+int event_queue_create(void)
+{
+    int rc = syscall(SC_event_queue_create);
+    __RETURN_WITH_ERRNO(rc, rc, -1);
+}
+
+int event_queue_ctl(int queue_fd, int operation, int fd, unsigned events)
+{
+    int rc = syscall(SC_event_queue_ctl, queue_fd, operation, fd, events);
+    __RETURN_WITH_ERRNO(rc, rc, -1);
+}
+
+int event_queue_wait(int queue_fd, struct EventQueueEvent* events, size_t max_events, struct timespec const* timeout)
+{
+    Syscall::SC_event_queue_wait_params params { queue_fd, events, max_events, timeout };
+    int rc = syscall(SC_event_queue_wait, &params);
+    __RETURN_WITH_ERRNO(rc, rc, -1);
+}
+
+int iobatch(struct IOBatchOp* ops, size_t op_count)
+{
+    int rc = syscall(SC_iobatch, ops, op_count);
+    __RETURN_WITH_ERRNO(rc, rc, -1);
+}
+
 int serenity_readlink(char const* path, size_t path_length, char* buffer, size_t buffer_size)
 {
     Syscall::SC_readlink_params small_params {
@@ -61,6 +61,20 @@ int get_stack_bounds(uintptr_t* user_stack_base, size_t* user_stack_size);
 
 int anon_create(size_t size, int options);
 
+// A persistent kernel-side set of file descriptors to wait on; see
+// Kernel/API/EventQueue.h for the operation and event definitions.
+struct EventQueueEvent;
+struct timespec;
+int event_queue_create(void);
+int event_queue_ctl(int queue_fd, int operation, int fd, unsigned events);
+int event_queue_wait(int queue_fd, struct EventQueueEvent* events, size_t max_events, struct timespec const* timeout);
+
+// Submits a batch of I/O operations in one syscall; see Kernel/API/IOBatch.h
+// for the operation definitions. Each operation carries its own result, so a
+// failed operation does not abort the rest of the batch.
+struct IOBatchOp;
+int iobatch(struct IOBatchOp* ops, size_t op_count);
+
 int serenity_readlink(char const* path, size_t path_length, char* buffer, size_t buffer_size);
 
 int getkeymap(char* name_buffer, size_t name_buffer_size, uint32_t* map, uint32_t* shift_map, uint32_t* alt_map, uint32_t* altgr_map, uint32_t* shift_altgr_map);
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
 #include <AK/DateConstants.h>
 #include <AK/DeprecatedString.h>
 #include <AK/StringBuilder.h>
@@ -17,6 +18,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
 #include <sys/time.h>
 #include <sys/times.h>
 #include <syscall.h>
@@ -434,17 +436,26 @@ clock_t clock()
 
 static Kernel::TimePage* get_kernel_time_page()
 {
-    static Kernel::TimePage* s_kernel_time_page;
-    // FIXME: Thread safety
-    if (!s_kernel_time_page) {
-        auto rc = syscall(SC_map_time_page);
-        if ((int)rc < 0 && (int)rc > -EMAXERRNO) {
-            errno = -(int)rc;
-            return nullptr;
-        }
-        s_kernel_time_page = (Kernel::TimePage*)rc;
+    static Atomic<Kernel::TimePage*> s_kernel_time_page;
+
+    auto* page = s_kernel_time_page.load(AK::memory_order_acquire);
+    if (page)
+        return page;
+
+    auto rc = syscall(SC_map_time_page);
+    if ((int)rc < 0 && (int)rc > -EMAXERRNO) {
+        errno = -(int)rc;
+        return nullptr;
+    }
+
+    page = (Kernel::TimePage*)rc;
+    Kernel::TimePage* expected = nullptr;
+    if (!s_kernel_time_page.compare_exchange_strong(expected, page, AK::memory_order_acq_rel)) {
+        // Another thread won the race to map the page; drop ours and use theirs.
+        munmap(page, PAGE_SIZE);
+        page = expected;
     }
-    return s_kernel_time_page;
+    return page;
 }
 
 int clock_gettime(clockid_t clock_id, struct timespec* ts)
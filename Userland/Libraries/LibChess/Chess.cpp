@@ -4,12 +4,14 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/Assertions.h>
 #include <AK/DeprecatedString.h>
 #include <AK/StringBuilder.h>
 #include <AK/Vector.h>
 #include <LibChess/Chess.h>
 #include <stdlib.h>
+#include <string.h>
 
 namespace Chess {
 
@@ -342,10 +344,36 @@ Piece Board::get_piece(Square const& square) const
     return m_board[square.rank][square.file];
 }
 
+// Zobrist-style keys for the incremental position hash: one pseudo-random
+// value per (color, type, square) combination, XORed into Board::m_hash as
+// pieces are placed and removed.
+static constexpr auto s_piece_square_hash_keys = [] {
+    Array<u32, 2 * 6 * 64> keys {};
+    // xorshift32 with a fixed seed; the keys only need to be well-distributed.
+    u32 state = 0x9E3779B9;
+    for (auto& key : keys) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        key = state;
+    }
+    return keys;
+}();
+
+static u32 piece_square_hash_key(Piece const& piece, Square const& square)
+{
+    if (piece.type == Type::None || piece.color == Color::None)
+        return 0;
+    auto piece_index = static_cast<size_t>(piece.color) * 6 + static_cast<size_t>(piece.type);
+    return s_piece_square_hash_keys[piece_index * 64 + square.rank * 8 + square.file];
+}
+
 Piece Board::set_piece(Square const& square, Piece const& piece)
 {
     VERIFY(square.in_bounds());
-    return m_board[square.rank][square.file] = piece;
+    auto& slot = m_board[square.rank][square.file];
+    m_hash ^= piece_square_hash_key(slot, square) ^ piece_square_hash_key(piece, square);
+    return slot = piece;
 }
 
 bool Board::is_legal_promotion(Move const& move, Color color) const
@@ -388,9 +416,7 @@ bool Board::is_legal(Move const& move, Color color) const
     if (!is_legal_promotion(move, color))
         return false;
 
-    Board clone = *this;
-    clone.apply_illegal_move(move, color);
-    if (clone.in_check(color))
+    if (is_in_check_after_move(move, color))
         return false;
 
     // Don't allow castling through check or out of check.
@@ -409,16 +435,79 @@ bool Board::is_legal(Move const& move, Color color) const
         }
     }
     for (auto& square : check_squares) {
-        Board clone = *this;
-        clone.set_piece(move.from, EmptyPiece);
-        clone.set_piece(square, { color, Type::King });
-        if (clone.in_check(color))
+        auto& mutable_this = const_cast<Board&>(*this);
+        auto saved_from = get_piece(move.from);
+        auto saved_square = get_piece(square);
+        mutable_this.set_piece(move.from, EmptyPiece);
+        mutable_this.set_piece(square, { color, Type::King });
+        bool check = in_check(color);
+        mutable_this.set_piece(square, saved_square);
+        mutable_this.set_piece(move.from, saved_from);
+        if (check)
             return false;
     }
 
     return true;
 }
 
+bool Board::is_in_check_after_move(Move const& move, Color color) const
+{
+    // Checking a candidate move means making it, looking for check, and
+    // unmaking it again. Undoing the move in place keeps us from deep-copying
+    // the move history and the repetition table for every generated move.
+    auto& mutable_this = const_cast<Board&>(*this);
+
+    struct {
+        Piece board[8][8];
+        Optional<Move> last_move;
+        short moves_since_capture;
+        short moves_since_pawn_advance;
+        unsigned hash;
+        Color turn;
+        bool white_can_castle_kingside;
+        bool white_can_castle_queenside;
+        bool black_can_castle_kingside;
+        bool black_can_castle_queenside;
+    } saved_state;
+
+    memcpy(saved_state.board, m_board, sizeof(m_board));
+    saved_state.last_move = m_last_move;
+    saved_state.moves_since_capture = m_moves_since_capture;
+    saved_state.moves_since_pawn_advance = m_moves_since_pawn_advance;
+    saved_state.hash = m_hash;
+    saved_state.turn = m_turn;
+    saved_state.white_can_castle_kingside = m_white_can_castle_kingside;
+    saved_state.white_can_castle_queenside = m_white_can_castle_queenside;
+    saved_state.black_can_castle_kingside = m_black_can_castle_kingside;
+    saved_state.black_can_castle_queenside = m_black_can_castle_queenside;
+    auto state_hash = Traits<Board>::hash(*this);
+
+    mutable_this.apply_illegal_move(move, color);
+    bool check = in_check(color);
+
+    // apply_illegal_move() also recorded the move; take those records back
+    // out, since they live in heap-allocated containers we didn't save.
+    mutable_this.m_moves.take_last();
+    auto state_count = *mutable_this.m_previous_states.get(state_hash);
+    if (state_count == 1)
+        mutable_this.m_previous_states.remove(state_hash);
+    else
+        mutable_this.m_previous_states.set(state_hash, state_count - 1);
+
+    memcpy(mutable_this.m_board, saved_state.board, sizeof(m_board));
+    mutable_this.m_last_move = saved_state.last_move;
+    mutable_this.m_moves_since_capture = saved_state.moves_since_capture;
+    mutable_this.m_moves_since_pawn_advance = saved_state.moves_since_pawn_advance;
+    mutable_this.m_hash = saved_state.hash;
+    mutable_this.m_turn = saved_state.turn;
+    mutable_this.m_white_can_castle_kingside = saved_state.white_can_castle_kingside;
+    mutable_this.m_white_can_castle_queenside = saved_state.white_can_castle_queenside;
+    mutable_this.m_black_can_castle_kingside = saved_state.black_can_castle_kingside;
+    mutable_this.m_black_can_castle_queenside = saved_state.black_can_castle_queenside;
+
+    return check;
+}
+
 bool Board::is_legal_no_check(Move const& move, Color color) const
 {
     auto piece = get_piece(move.from);
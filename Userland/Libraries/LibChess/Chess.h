@@ -167,8 +167,10 @@ private:
     bool is_legal_no_check(Move const&, Color color) const;
     bool is_legal_promotion(Move const&, Color color) const;
     bool apply_illegal_move(Move const&, Color color);
+    bool is_in_check_after_move(Move const&, Color color) const;
 
     Piece m_board[8][8];
+    unsigned m_hash { 0 };
     Optional<Move> m_last_move;
     short m_moves_since_capture { 0 };
     short m_moves_since_pawn_advance { 0 };
@@ -302,11 +304,9 @@ struct AK::Traits<Chess::Board> : public GenericTraits<Chess::Board> {
         hash = pair_int_hash(hash, static_cast<u32>(chess.m_black_can_castle_queenside));
         hash = pair_int_hash(hash, static_cast<u32>(chess.m_black_can_castle_kingside));
 
-        Chess::Square::for_each([&](Chess::Square sq) {
-            hash = pair_int_hash(hash, Traits<Chess::Piece>::hash(chess.get_piece(sq)));
-            return IterationDecision::Continue;
-        });
-
-        return hash;
+        // The square contents are hashed incrementally: Board::set_piece()
+        // keeps m_hash in sync as pieces are placed and removed, so hashing a
+        // position is O(1) instead of a walk over all 64 squares.
+        return hash ^ chess.m_hash;
     }
 };
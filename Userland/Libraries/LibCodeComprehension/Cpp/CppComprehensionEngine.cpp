@@ -7,6 +7,7 @@
 #include "CppComprehensionEngine.h"
 #include <AK/Assertions.h>
 #include <AK/HashTable.h>
+#include <AK/LexicalPath.h>
 #include <AK/OwnPtr.h>
 #include <AK/ScopeGuard.h>
 #include <LibCore/DirIterator.h>
@@ -16,7 +17,9 @@
 #include <LibCpp/Parser.h>
 #include <LibCpp/Preprocessor.h>
 #include <LibRegex/Regex.h>
+#include <LibThreading/BackgroundAction.h>
 #include <Userland/DevTools/HackStudio/LanguageServers/ConnectionFromClient.h>
+#include <sys/stat.h>
 
 namespace CodeComprehension::Cpp {
 
@@ -413,7 +416,13 @@ Optional<CodeComprehension::ProjectLocation> CppComprehensionEngine::find_declar
         return CodeComprehension::ProjectLocation { decl->filename(), decl->start().line, decl->start().column };
     }
 
-    return find_preprocessor_definition(document, identifier_position);
+    auto definition = find_preprocessor_definition(document, identifier_position);
+    if (definition.has_value())
+        return definition;
+
+    // The symbol wasn't in any document we've parsed in this session; fall
+    // back to the persistent project-wide index.
+    return find_declaration_in_index(document, identifier_position);
 }
 
 RefPtr<Cpp::Declaration> CppComprehensionEngine::find_declaration_of(DocumentData const& document, const GUI::TextPosition& identifier_position)
@@ -581,13 +590,15 @@ void CppComprehensionEngine::update_declared_symbols(DocumentData& document)
     Vector<CodeComprehension::Declaration> declarations;
     for (auto& symbol_entry : document.m_symbols) {
         auto& symbol = symbol_entry.value;
-        declarations.append({ symbol.name.name, { document.filename(), symbol.declaration->start().line, symbol.declaration->start().column }, type_of_declaration(symbol.declaration), symbol.name.scope_as_string() });
+        declarations.append({ symbol.name.name, { document.filename(), symbol.declaration->start().line, symbol.declaration->start().column }, SymbolIndex::type_of_declaration(symbol.declaration), symbol.name.scope_as_string() });
     }
 
     for (auto& definition : document.preprocessor().definitions()) {
         declarations.append({ definition.key, { document.filename(), definition.value.line, definition.value.column }, CodeComprehension::DeclarationType::PreprocessorDefinition, {} });
     }
     set_declarations_of_document(document.filename(), move(declarations));
+
+    update_index_for_document(document);
 }
 
 void CppComprehensionEngine::update_todo_entries(DocumentData& document)
@@ -595,21 +606,84 @@ void CppComprehensionEngine::update_todo_entries(DocumentData& document)
     set_todo_entries_of_document(document.filename(), document.parser().get_todo_entries());
 }
 
-CodeComprehension::DeclarationType CppComprehensionEngine::type_of_declaration(Cpp::Declaration const& decl)
-{
-    if (decl.is_struct())
-        return CodeComprehension::DeclarationType::Struct;
-    if (decl.is_class())
-        return CodeComprehension::DeclarationType::Class;
-    if (decl.is_function())
-        return CodeComprehension::DeclarationType::Function;
-    if (decl.is_variable_declaration())
-        return CodeComprehension::DeclarationType::Variable;
-    if (decl.is_namespace())
-        return CodeComprehension::DeclarationType::Namespace;
-    if (decl.is_member())
-        return CodeComprehension::DeclarationType::Member;
-    return CodeComprehension::DeclarationType::Variable;
+void CppComprehensionEngine::build_symbol_index()
+{
+    if (filedb().project_root().is_empty())
+        return;
+    m_symbol_index_enabled = true;
+
+    if (auto result = m_symbol_index.load(symbol_index_path()); result.is_error())
+        dbgln_if(CPP_LANGUAGE_SERVER_DEBUG, "Could not load the symbol index: {}", result.error());
+
+    auto project_root = filedb().project_root();
+    auto known_mtimes = m_symbol_index.file_mtimes();
+    (void)Threading::BackgroundAction<Vector<SymbolIndex::FileUpdate>>::construct(
+        [project_root = move(project_root), known_mtimes = move(known_mtimes)](auto&) {
+            return SymbolIndex::build_updates_for_project(project_root, known_mtimes);
+        },
+        [this](auto updates) {
+            if (updates.is_empty())
+                return;
+            dbgln_if(CPP_LANGUAGE_SERVER_DEBUG, "Symbol index: re-parsed {} files", updates.size());
+            for (auto& update : updates)
+                m_symbol_index.update_file(move(update));
+            schedule_index_save();
+        });
+}
+
+DeprecatedString CppComprehensionEngine::symbol_index_path() const
+{
+    return LexicalPath::join(filedb().project_root(), SymbolIndex::index_file_name).string();
+}
+
+void CppComprehensionEngine::update_index_for_document(DocumentData const& document)
+{
+    if (!m_symbol_index_enabled)
+        return;
+
+    auto absolute_path = filedb().to_absolute_path(document.filename());
+
+    Vector<SymbolIndex::Entry> entries;
+    for (auto& symbol_entry : document.m_symbols) {
+        auto& symbol = symbol_entry.value;
+        if (symbol.is_local)
+            continue;
+        entries.append({ symbol.name.name, symbol.name.scope_as_string(), absolute_path, symbol.declaration->start().line, symbol.declaration->start().column, SymbolIndex::type_of_declaration(symbol.declaration) });
+    }
+
+    struct stat st { };
+    auto mtime = ::stat(absolute_path.characters(), &st) == 0 ? st.st_mtime : 0;
+    m_symbol_index.update_file({ move(absolute_path), mtime, move(entries) });
+    schedule_index_save();
+}
+
+void CppComprehensionEngine::schedule_index_save()
+{
+    if (!m_index_save_timer) {
+        m_index_save_timer = Core::Timer::create_single_shot(2000, [this] {
+            if (auto result = m_symbol_index.save(symbol_index_path()); result.is_error())
+                dbgln("Could not save the symbol index: {}", result.error());
+        });
+    }
+    m_index_save_timer->restart();
+}
+
+Optional<CodeComprehension::ProjectLocation> CppComprehensionEngine::find_declaration_in_index(DocumentData const& document, const GUI::TextPosition& identifier_position) const
+{
+    if (!m_symbol_index_enabled)
+        return {};
+
+    auto node = document.parser().node_at(Cpp::Position { identifier_position.line(), identifier_position.column() });
+    if (!node || !node->is_identifier())
+        return {};
+
+    auto name = static_cast<Identifier const&>(*node).name();
+    auto scope = DeprecatedString::join("::"sv, scope_of_reference_to_symbol(*node));
+
+    auto entry = m_symbol_index.find(name, scope);
+    if (!entry.has_value())
+        return {};
+    return CodeComprehension::ProjectLocation { entry->filename, entry->line, entry->column };
 }
 
 OwnPtr<CppComprehensionEngine::DocumentData> CppComprehensionEngine::create_document_data(DeprecatedString text, DeprecatedString const& filename)
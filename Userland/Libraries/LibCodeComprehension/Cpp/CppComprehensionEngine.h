@@ -6,11 +6,13 @@
 
 #pragma once
 
+#include "SymbolIndex.h"
 #include <AK/DeprecatedString.h>
 #include <AK/Function.h>
 #include <AK/Vector.h>
 #include <DevTools/HackStudio/AutoCompleteResponse.h>
 #include <DevTools/HackStudio/LanguageServers/FileDB.h>
+#include <LibCore/Timer.h>
 #include <LibCpp/AST.h>
 #include <LibCpp/Parser.h>
 #include <LibCpp/Preprocessor.h>
@@ -32,6 +34,12 @@ public:
     virtual Optional<FunctionParamsHint> get_function_params_hint(DeprecatedString const&, GUI::TextPosition const&) override;
     virtual Vector<CodeComprehension::TokenInfo> get_tokens_info(DeprecatedString const& filename) override;
 
+    // Loads the persistent symbol index from the project root and re-parses
+    // any files that changed since it was last saved, in the background.
+    // Afterwards, find-declaration falls back to the index for symbols in
+    // documents that were never opened in this session.
+    void build_symbol_index();
+
 private:
     struct SymbolName {
         StringView name;
@@ -122,12 +130,16 @@ private:
     DeprecatedString document_path_from_include_path(StringView include_path) const;
     void update_declared_symbols(DocumentData&);
     void update_todo_entries(DocumentData&);
-    CodeComprehension::DeclarationType type_of_declaration(Cpp::Declaration const&);
     Vector<StringView> scope_of_node(ASTNode const&) const;
     Vector<StringView> scope_of_reference_to_symbol(ASTNode const&) const;
 
     Optional<CodeComprehension::ProjectLocation> find_preprocessor_definition(DocumentData const&, const GUI::TextPosition&);
     Optional<Cpp::Preprocessor::Substitution> find_preprocessor_substitution(DocumentData const&, Cpp::Position const&);
+    Optional<CodeComprehension::ProjectLocation> find_declaration_in_index(DocumentData const&, const GUI::TextPosition&) const;
+
+    DeprecatedString symbol_index_path() const;
+    void update_index_for_document(DocumentData const&);
+    void schedule_index_save();
 
     OwnPtr<DocumentData> create_document_data(DeprecatedString text, DeprecatedString const& filename);
     Optional<Vector<CodeComprehension::AutocompleteResultEntry>> try_autocomplete_property(DocumentData const&, ASTNode const&, Optional<Token> containing_token) const;
@@ -151,6 +163,10 @@ private:
     // A document is added to this set when we start processing it (e.g because it was #included) and removed when we're done.
     // We use this to prevent circular #includes from looping indefinitely.
     HashTable<DeprecatedString> m_unfinished_documents;
+
+    SymbolIndex m_symbol_index;
+    bool m_symbol_index_enabled { false };
+    RefPtr<Core::Timer> m_index_save_timer;
 };
 
 template<typename Func>
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "SymbolIndex.h"
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <AK/LexicalPath.h>
+#include <LibCore/Stream.h>
+#include <LibCpp/AST.h>
+#include <LibCpp/Parser.h>
+#include <LibCpp/Preprocessor.h>
+#include <LibThreading/DirectoryTree.h>
+#include <LibThreading/ThreadPool.h>
+
+namespace CodeComprehension::Cpp {
+
+ErrorOr<void> SymbolIndex::load(DeprecatedString const& path)
+{
+    auto file = TRY(Core::Stream::File::open(path, Core::Stream::OpenMode::Read));
+
+    auto json = JsonValue::from_string(TRY(file->read_until_eof()));
+    if (json.is_error() || !json.value().is_object())
+        return Error::from_string_literal("Invalid symbol index (not a JSON object)");
+
+    auto const& files = json.value().as_object().get("files"sv);
+    if (!files.is_object())
+        return Error::from_string_literal("Invalid symbol index (no files object)");
+
+    HashMap<DeprecatedString, FileRecord> loaded_files;
+    files.as_object().for_each_member([&](DeprecatedString const& filename, JsonValue const& value) {
+        if (!value.is_object())
+            return;
+        FileRecord record;
+        record.mtime = static_cast<time_t>(value.as_object().get("mtime"sv).to_number<i64>());
+
+        auto const& declarations = value.as_object().get("declarations"sv);
+        if (!declarations.is_array())
+            return;
+        for (auto const& declaration_value : declarations.as_array().values()) {
+            if (!declaration_value.is_object())
+                continue;
+            auto const& declaration = declaration_value.as_object();
+            auto type = declaration.get("type"sv).to_number<u32>();
+            if (type > to_underlying(CodeComprehension::DeclarationType::Member))
+                continue;
+            record.declarations.append({
+                declaration.get("name"sv).to_deprecated_string(),
+                declaration.get("scope"sv).to_deprecated_string(),
+                filename,
+                declaration.get("line"sv).to_number<size_t>(),
+                declaration.get("column"sv).to_number<size_t>(),
+                static_cast<CodeComprehension::DeclarationType>(type),
+            });
+        }
+        loaded_files.set(filename, move(record));
+    });
+
+    m_files = move(loaded_files);
+    m_lookup_table_stale = true;
+    return {};
+}
+
+ErrorOr<void> SymbolIndex::save(DeprecatedString const& path) const
+{
+    JsonObject files;
+    for (auto const& file_entry : m_files) {
+        JsonArray declarations;
+        for (auto const& entry : file_entry.value.declarations) {
+            JsonObject declaration;
+            declaration.set("name", entry.name);
+            declaration.set("scope", entry.scope);
+            declaration.set("line", entry.line);
+            declaration.set("column", entry.column);
+            declaration.set("type", to_underlying(entry.type));
+            declarations.append(move(declaration));
+        }
+        JsonObject record;
+        record.set("mtime", static_cast<i64>(file_entry.value.mtime));
+        record.set("declarations", move(declarations));
+        files.set(file_entry.key, move(record));
+    }
+
+    JsonObject root;
+    root.set("version", 1);
+    root.set("files", move(files));
+
+    auto file = TRY(Core::Stream::File::open(path, Core::Stream::OpenMode::Write));
+    TRY(file->write_entire_buffer(root.to_deprecated_string().bytes()));
+    return {};
+}
+
+void SymbolIndex::update_file(FileUpdate update)
+{
+    auto& record = m_files.ensure(update.filename);
+    record.mtime = update.mtime;
+    record.declarations = move(update.declarations);
+    m_lookup_table_stale = true;
+}
+
+HashMap<DeprecatedString, time_t> SymbolIndex::file_mtimes() const
+{
+    HashMap<DeprecatedString, time_t> mtimes;
+    for (auto const& file_entry : m_files)
+        mtimes.set(file_entry.key, file_entry.value.mtime);
+    return mtimes;
+}
+
+void SymbolIndex::rebuild_lookup_table_if_needed() const
+{
+    if (!m_lookup_table_stale)
+        return;
+    m_entries_by_name.clear();
+    for (auto const& file_entry : m_files) {
+        for (auto const& entry : file_entry.value.declarations)
+            m_entries_by_name.ensure(entry.name).append(&entry);
+    }
+    m_lookup_table_stale = false;
+}
+
+Optional<SymbolIndex::Entry> SymbolIndex::find(StringView name, StringView scope) const
+{
+    rebuild_lookup_table_if_needed();
+    auto it = m_entries_by_name.find(DeprecatedString { name });
+    if (it == m_entries_by_name.end())
+        return {};
+    for (auto const* entry : it->value) {
+        if (entry->scope == scope)
+            return *entry;
+    }
+    if (scope.is_empty())
+        return *it->value.first();
+    return {};
+}
+
+static void collect_declarations_under(::Cpp::ASTNode const& node, Vector<DeprecatedString> const& scope, DeprecatedString const& filename, Vector<SymbolIndex::Entry>& entries)
+{
+    for (auto& declaration : node.declarations()) {
+        entries.append({
+            declaration.full_name(),
+            DeprecatedString::join("::"sv, scope),
+            filename,
+            declaration.start().line,
+            declaration.start().column,
+            SymbolIndex::type_of_declaration(declaration),
+        });
+
+        // Symbols declared inside functions are local; they have no place in
+        // a project-wide index.
+        bool should_recurse = declaration.is_namespace() || declaration.is_struct_or_class();
+        if (!should_recurse)
+            continue;
+
+        auto new_scope = scope;
+        new_scope.append(declaration.full_name());
+        collect_declarations_under(declaration, new_scope, filename, entries);
+    }
+}
+
+Vector<SymbolIndex::Entry> SymbolIndex::collect_declarations(DeprecatedString const& filename, DeprecatedString const& text)
+{
+    ::Cpp::Preprocessor preprocessor(filename, text);
+    preprocessor.set_ignore_unsupported_keywords(true);
+    preprocessor.set_ignore_invalid_statements(true);
+    preprocessor.set_keep_include_statements(true);
+    auto tokens = preprocessor.process_and_lex();
+
+    ::Cpp::Parser parser(move(tokens), filename);
+    auto root = parser.parse();
+
+    Vector<Entry> entries;
+    collect_declarations_under(*root, {}, filename, entries);
+    return entries;
+}
+
+CodeComprehension::DeclarationType SymbolIndex::type_of_declaration(::Cpp::Declaration const& decl)
+{
+    if (decl.is_struct())
+        return CodeComprehension::DeclarationType::Struct;
+    if (decl.is_class())
+        return CodeComprehension::DeclarationType::Class;
+    if (decl.is_function())
+        return CodeComprehension::DeclarationType::Function;
+    if (decl.is_variable_declaration())
+        return CodeComprehension::DeclarationType::Variable;
+    if (decl.is_namespace())
+        return CodeComprehension::DeclarationType::Namespace;
+    if (decl.is_member())
+        return CodeComprehension::DeclarationType::Member;
+    return CodeComprehension::DeclarationType::Variable;
+}
+
+static bool is_indexable_source_file(StringView path)
+{
+    return path.ends_with(".cpp"sv) || path.ends_with(".h"sv);
+}
+
+static void collect_indexable_files(Threading::DirectoryTree::Node const& node, Vector<DeprecatedString>& files, Vector<time_t>& mtimes)
+{
+    for (auto& child : node.children) {
+        auto basename = LexicalPath::basename(child.path);
+        if (child.is_directory()) {
+            // Hidden directories and build trees hold generated sources that
+            // would drown out the declarations the user actually wrote.
+            if (basename.starts_with('.') || basename == "Build")
+                continue;
+            collect_indexable_files(child, files, mtimes);
+            continue;
+        }
+        if (!is_indexable_source_file(basename))
+            continue;
+        files.append(child.path);
+        mtimes.append(child.stat.st_mtime);
+    }
+}
+
+Vector<SymbolIndex::FileUpdate> SymbolIndex::build_updates_for_project(DeprecatedString const& project_root, HashMap<DeprecatedString, time_t> const& known_mtimes)
+{
+    auto tree_or_error = Threading::DirectoryTree::gather(project_root);
+    if (tree_or_error.is_error())
+        return {};
+
+    Vector<DeprecatedString> files;
+    Vector<time_t> mtimes;
+    collect_indexable_files(tree_or_error.value().root(), files, mtimes);
+
+    Vector<DeprecatedString> stale_files;
+    Vector<time_t> stale_mtimes;
+    for (size_t i = 0; i < files.size(); ++i) {
+        auto known_mtime = known_mtimes.get(files[i]);
+        if (known_mtime.has_value() && known_mtime.value() == mtimes[i])
+            continue;
+        stale_files.append(files[i]);
+        stale_mtimes.append(mtimes[i]);
+    }
+    if (stale_files.is_empty())
+        return {};
+
+    // Each file is parsed independently, so the translation units can be
+    // spread over all processors. Files that fail to read are left with a
+    // null filename and retried on the next indexing run.
+    Vector<FileUpdate> updates;
+    updates.resize(stale_files.size());
+    Threading::ThreadPool pool;
+    pool.parallel_for(0, stale_files.size(), 16, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            auto file_or_error = Core::Stream::File::open(stale_files[i], Core::Stream::OpenMode::Read);
+            if (file_or_error.is_error())
+                continue;
+            auto contents_or_error = file_or_error.value()->read_until_eof();
+            if (contents_or_error.is_error())
+                continue;
+            auto text = DeprecatedString::copy(contents_or_error.value());
+            updates[i] = { stale_files[i], stale_mtimes[i], collect_declarations(stale_files[i], text) };
+        }
+    });
+
+    Vector<FileUpdate> successful_updates;
+    for (auto& update : updates) {
+        if (!update.filename.is_null())
+            successful_updates.append(move(update));
+    }
+    return successful_updates;
+}
+
+}
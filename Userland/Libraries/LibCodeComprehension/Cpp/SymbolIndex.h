@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/DeprecatedString.h>
+#include <AK/HashMap.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibCodeComprehension/Types.h>
+#include <time.h>
+
+namespace Cpp {
+class Declaration;
+}
+
+namespace CodeComprehension::Cpp {
+
+// A project-wide symbol index that persists across language server sessions.
+// It stores, per source file, the file's mtime and the global declarations it
+// contained when it was last parsed, so a freshly started server can answer
+// find-declaration queries for the whole project without re-parsing anything
+// that hasn't changed.
+class SymbolIndex {
+public:
+    static constexpr auto index_file_name = ".cpp_symbol_index.json"sv;
+
+    struct Entry {
+        DeprecatedString name;
+        DeprecatedString scope;
+        DeprecatedString filename;
+        size_t line { 0 };
+        size_t column { 0 };
+        CodeComprehension::DeclarationType type { CodeComprehension::DeclarationType::Variable };
+    };
+
+    struct FileUpdate {
+        DeprecatedString filename;
+        time_t mtime { 0 };
+        Vector<Entry> declarations;
+    };
+
+    ErrorOr<void> load(DeprecatedString const& path);
+    ErrorOr<void> save(DeprecatedString const& path) const;
+
+    void update_file(FileUpdate);
+    HashMap<DeprecatedString, time_t> file_mtimes() const;
+
+    // Returns the entry whose scope matches `scope` exactly, or any entry with
+    // a matching name if `scope` is empty.
+    Optional<Entry> find(StringView name, StringView scope) const;
+
+    // Walks the project tree and re-parses every indexable file whose mtime
+    // differs from the one in `known_mtimes`, distributing the parses over a
+    // thread pool. Blocks until all of them are done, so this is normally
+    // called from a background thread.
+    static Vector<FileUpdate> build_updates_for_project(DeprecatedString const& project_root, HashMap<DeprecatedString, time_t> const& known_mtimes);
+
+    // Parses `text` and extracts its global declarations. Only touches its
+    // arguments, so it's safe to call from several threads at once.
+    static Vector<Entry> collect_declarations(DeprecatedString const& filename, DeprecatedString const& text);
+
+    static CodeComprehension::DeclarationType type_of_declaration(::Cpp::Declaration const&);
+
+private:
+    struct FileRecord {
+        time_t mtime { 0 };
+        Vector<Entry> declarations;
+    };
+
+    void rebuild_lookup_table_if_needed() const;
+
+    HashMap<DeprecatedString, FileRecord> m_files;
+
+    // Entries grouped by symbol name, rebuilt lazily after updates. The
+    // pointers reference the Entry objects owned by m_files; moving a
+    // FileRecord around doesn't move its entries, but replacing a file's
+    // declarations invalidates them, which is why update_file() marks the
+    // table stale.
+    mutable HashMap<DeprecatedString, Vector<Entry const*>> m_entries_by_name;
+    mutable bool m_lookup_table_stale { true };
+};
+
+}
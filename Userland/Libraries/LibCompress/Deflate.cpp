@@ -9,7 +9,9 @@
 #include <AK/Assertions.h>
 #include <AK/BinaryHeap.h>
 #include <AK/BinarySearch.h>
+#include <AK/Math.h>
 #include <AK/MemoryStream.h>
+#include <AK/NumericLimits.h>
 #include <LibCore/MemoryStream.h>
 #include <string.h>
 
@@ -494,8 +496,18 @@ size_t DeflateCompressor::compare_match_candidate(size_t start, size_t candidate
             return 0;
     }
 
-    // Find the actual length
+    // Find the actual length; extending a machine word at a time first makes long
+    // matches (the common case on compressible data) much cheaper to measure.
     auto match_length = previous_match_length + 1;
+    while (match_length + sizeof(size_t) <= maximum_match_length) {
+        size_t start_word;
+        size_t candidate_word;
+        __builtin_memcpy(&start_word, &m_rolling_window[start + match_length], sizeof(start_word));
+        __builtin_memcpy(&candidate_word, &m_rolling_window[candidate + match_length], sizeof(candidate_word));
+        if (start_word != candidate_word)
+            break;
+        match_length += sizeof(size_t);
+    }
     while (match_length < maximum_match_length && m_rolling_window[start + match_length] == m_rolling_window[candidate + match_length]) {
         match_length++;
     }
@@ -881,6 +893,42 @@ void DeflateCompressor::write_dynamic_huffman(CanonicalCode const& literal_code,
     write_huffman(literal_code, distance_code);
 }
 
+// A dynamic Huffman table can only pay for itself when the entropy of the block's
+// symbols undercuts the fixed code lengths by more than the cost of transmitting the
+// table. Entropy is a lower bound on the size of any Huffman-coded body, so comparing
+// the two estimates (ignoring the extra bits, which cost the same under both codes)
+// cheaply detects blocks where building the dynamic table would be wasted work.
+bool DeflateCompressor::dynamic_huffman_may_beat_fixed_codes() const
+{
+    // 3 bit block header + 5/5/4 bit symbol counts + at least 4 code length code lengths.
+    constexpr size_t minimum_dynamic_table_cost = 3 + 5 + 5 + 4 + 4 * 3;
+
+    size_t total_symbol_count = 0;
+    for (auto frequency : m_symbol_frequencies)
+        total_symbol_count += frequency;
+    size_t total_distance_count = 0;
+    for (auto frequency : m_distance_frequencies)
+        total_distance_count += frequency;
+
+    float entropy_bits = 0;
+    for (auto frequency : m_symbol_frequencies) {
+        if (frequency != 0)
+            entropy_bits += frequency * AK::log2(static_cast<float>(total_symbol_count) / frequency);
+    }
+    for (auto frequency : m_distance_frequencies) {
+        if (frequency != 0)
+            entropy_bits += frequency * AK::log2(static_cast<float>(total_distance_count) / frequency);
+    }
+
+    size_t fixed_code_bits = 0;
+    for (size_t i = 0; i < max_huffman_literals; i++)
+        fixed_code_bits += m_symbol_frequencies[i] * fixed_literal_bit_lengths[i];
+    for (size_t i = 0; i < max_huffman_distances; i++)
+        fixed_code_bits += m_distance_frequencies[i] * fixed_distance_bit_lengths[i];
+
+    return static_cast<size_t>(entropy_bits) + minimum_dynamic_table_cost < fixed_code_bits;
+}
+
 void DeflateCompressor::flush()
 {
     if (m_output_stream.handle_any_error()) {
@@ -925,34 +973,46 @@ void DeflateCompressor::flush()
     m_symbol_buffer[m_pending_symbol_size++].literal = 256;
     m_symbol_frequencies[256]++;
 
-    // generate optimal dynamic huffman code lengths
     Array<u8, max_huffman_literals> dynamic_literal_bit_lengths {};
     Array<u8, max_huffman_distances> dynamic_distance_bit_lengths {};
-    generate_huffman_lengths(dynamic_literal_bit_lengths, m_symbol_frequencies, 15); // deflate data huffman can use up to 15 bits per symbol
-    generate_huffman_lengths(dynamic_distance_bit_lengths, m_distance_frequencies, 15);
-
-    // encode literal and distance lengths together in deflate format
     Array<code_length_symbol, max_huffman_literals + max_huffman_distances> encoded_lengths {};
-    size_t literal_code_count;
-    size_t distance_code_count;
-    auto encoded_lengths_count = encode_block_lengths(dynamic_literal_bit_lengths, dynamic_distance_bit_lengths, encoded_lengths, literal_code_count, distance_code_count);
-
-    // count code length frequencies
     Array<u16, 19> code_lengths_frequencies { 0 };
-    for (size_t i = 0; i < encoded_lengths_count; i++) {
-        code_lengths_frequencies[encoded_lengths[i].symbol]++;
-    }
-    // generate optimal huffman code lengths code lengths
     Array<u8, 19> code_lengths_bit_lengths {};
-    generate_huffman_lengths(code_lengths_bit_lengths, code_lengths_frequencies, 7); // deflate code length huffman can use up to 7 bits per symbol
-    // calculate actual code length code lengths count (without trailing zeros)
-    auto code_lengths_count = code_lengths_bit_lengths.size();
-    while (code_lengths_bit_lengths[code_lengths_code_lengths_order[code_lengths_count - 1]] == 0)
-        code_lengths_count--;
+    size_t literal_code_count = 0;
+    size_t distance_code_count = 0;
+    size_t encoded_lengths_count = 0;
+    size_t code_lengths_count = 0;
+    auto dynamic_huffman_size = NumericLimits<size_t>::max();
+
+    // Building the dynamic code tables is the most expensive part of flushing a block.
+    // On the fastest level a cheap entropy estimate decides up front whether a dynamic
+    // table can pay for itself; when it cannot, the construction is skipped wholesale
+    // and the block is emitted with the fixed codes (or stored).
+    bool consider_dynamic_huffman = m_compression_level != CompressionLevel::FAST || dynamic_huffman_may_beat_fixed_codes();
+    if (consider_dynamic_huffman) {
+        // generate optimal dynamic huffman code lengths
+        generate_huffman_lengths(dynamic_literal_bit_lengths, m_symbol_frequencies, 15); // deflate data huffman can use up to 15 bits per symbol
+        generate_huffman_lengths(dynamic_distance_bit_lengths, m_distance_frequencies, 15);
+
+        // encode literal and distance lengths together in deflate format
+        encoded_lengths_count = encode_block_lengths(dynamic_literal_bit_lengths, dynamic_distance_bit_lengths, encoded_lengths, literal_code_count, distance_code_count);
+
+        // count code length frequencies
+        for (size_t i = 0; i < encoded_lengths_count; i++) {
+            code_lengths_frequencies[encoded_lengths[i].symbol]++;
+        }
+        // generate optimal huffman code lengths code lengths
+        generate_huffman_lengths(code_lengths_bit_lengths, code_lengths_frequencies, 7); // deflate code length huffman can use up to 7 bits per symbol
+        // calculate actual code length code lengths count (without trailing zeros)
+        code_lengths_count = code_lengths_bit_lengths.size();
+        while (code_lengths_bit_lengths[code_lengths_code_lengths_order[code_lengths_count - 1]] == 0)
+            code_lengths_count--;
+
+        dynamic_huffman_size = dynamic_block_length(dynamic_literal_bit_lengths, dynamic_distance_bit_lengths, code_lengths_bit_lengths, code_lengths_frequencies, code_lengths_count);
+    }
 
     auto uncompressed_size = uncompressed_block_length();
     auto fixed_huffman_size = fixed_block_length();
-    auto dynamic_huffman_size = dynamic_block_length(dynamic_literal_bit_lengths, dynamic_distance_bit_lengths, code_lengths_bit_lengths, code_lengths_frequencies, code_lengths_count);
 
     // If the compression somehow didn't reduce the size enough, just write out the block uncompressed as it allows for much faster decompression
     if (uncompressed_size <= min(fixed_huffman_size, dynamic_huffman_size)) {
@@ -40,8 +40,13 @@ bool BlockHeader::supported_by_implementation() const
 }
 
 GzipDecompressor::GzipDecompressor(NonnullOwnPtr<Core::Stream::Stream> stream)
-    : m_input_stream(move(stream))
+    : m_input_stream(make<Core::Stream::BufferedStream>(Core::Stream::Handle<Core::Stream::Stream>(move(stream))))
 {
+    // Buffering the input here benefits every reader downstream of us: the
+    // member headers, the trailer, and most importantly the deflate bit
+    // stream, whose refills otherwise pull single bytes out of the
+    // underlying stream. The buffer has to live at this level, since all of
+    // those readers share one stream position.
 }
 
 GzipDecompressor::~GzipDecompressor()
@@ -68,6 +68,73 @@ u32 Zlib::checksum()
     return m_checksum;
 }
 
+ZlibDecompressor::ZlibDecompressor(NonnullOwnPtr<Core::Stream::Stream> stream)
+    : m_input_stream(move(stream))
+{
+}
+
+ErrorOr<Bytes> ZlibDecompressor::read(Bytes bytes)
+{
+    size_t total_read = 0;
+    while (total_read < bytes.size()) {
+        if (m_eof)
+            break;
+
+        auto slice = bytes.slice(total_read);
+
+        if (m_stream.has_value()) {
+            auto current_slice = TRY(m_stream->read(slice));
+            m_checksum.update(current_slice);
+
+            if (current_slice.size() < slice.size()) {
+                NetworkOrdered<u32> adler32;
+                TRY(m_input_stream->read(adler32.bytes()));
+
+                if (adler32 != m_checksum.digest())
+                    return Error::from_string_literal("Stored Adler-32 does not match the calculated Adler-32 of the decompressed data");
+
+                m_eof = true;
+            }
+
+            total_read += current_slice.size();
+            continue;
+        }
+
+        auto current_partial_header_slice = Bytes { m_partial_header, sizeof(ZlibHeader) }.slice(m_partial_header_offset);
+        auto current_partial_header_data = TRY(m_input_stream->read(current_partial_header_slice));
+        m_partial_header_offset += current_partial_header_data.size();
+
+        if (m_input_stream->is_eof()) {
+            m_eof = true;
+            break;
+        }
+
+        if (m_partial_header_offset < sizeof(ZlibHeader))
+            break; // partial header read
+
+        ZlibHeader header { .as_u16 = static_cast<u16>(m_partial_header[0] << 8 | m_partial_header[1]) };
+
+        if (header.compression_method != ZlibCompressionMethod::Deflate || header.compression_info > 7)
+            return Error::from_string_literal("Zlib stream is compressed with an unsupported method");
+
+        if (header.present_dictionary)
+            return Error::from_string_literal("Zlib stream uses a pre-defined dictionary, which is not supported");
+
+        if (header.as_u16 % 31 != 0)
+            return Error::from_string_literal("Zlib stream has a corrupted header");
+
+        m_stream.emplace(Core::Stream::Handle<Core::Stream::Stream>(*m_input_stream));
+    }
+    return bytes.slice(0, total_read);
+}
+
+bool ZlibDecompressor::is_eof() const { return m_eof; }
+
+ErrorOr<size_t> ZlibDecompressor::write(ReadonlyBytes)
+{
+    VERIFY_NOT_REACHED();
+}
+
 ZlibCompressor::ZlibCompressor(OutputStream& stream, ZlibCompressionLevel compression_level)
     : m_output_stream(stream)
 {
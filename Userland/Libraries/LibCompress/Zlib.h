@@ -10,8 +10,10 @@
 #include <AK/ByteBuffer.h>
 #include <AK/Optional.h>
 #include <AK/OwnPtr.h>
+#include <AK/NonnullOwnPtr.h>
 #include <AK/Span.h>
 #include <AK/Types.h>
+#include <LibCompress/Deflate.h>
 #include <LibCrypto/Checksum/Adler32.h>
 
 namespace Compress {
@@ -47,6 +49,10 @@ public:
     Optional<ByteBuffer> decompress();
     u32 checksum();
 
+    // The raw deflate stream between the zlib header and the Adler-32 trailer,
+    // for callers that want to drive decompression incrementally themselves.
+    ReadonlyBytes deflate_payload() const { return m_data_bytes; }
+
     static Optional<Zlib> try_create(ReadonlyBytes data);
     static Optional<ByteBuffer> decompress_all(ReadonlyBytes);
 
@@ -60,6 +66,28 @@ private:
     ReadonlyBytes m_data_bytes;
 };
 
+// A pull-based zlib decompressor that only ever keeps the deflate window in
+// memory, unlike Zlib::decompress_all() which materializes the whole output.
+class ZlibDecompressor final : public Core::Stream::Stream {
+public:
+    ZlibDecompressor(NonnullOwnPtr<Core::Stream::Stream>);
+
+    virtual ErrorOr<Bytes> read(Bytes) override;
+    virtual ErrorOr<size_t> write(ReadonlyBytes) override;
+    virtual bool is_eof() const override;
+    virtual bool is_open() const override { return true; }
+    virtual void close() override {};
+
+private:
+    NonnullOwnPtr<Core::Stream::Stream> m_input_stream;
+    u8 m_partial_header[sizeof(ZlibHeader)];
+    size_t m_partial_header_offset { 0 };
+    Optional<DeflateDecompressor> m_stream;
+    Crypto::Checksum::Adler32 m_checksum;
+
+    bool m_eof { false };
+};
+
 class ZlibCompressor : public OutputStream {
 public:
     ZlibCompressor(OutputStream&, ZlibCompressionLevel = ZlibCompressionLevel::Default);
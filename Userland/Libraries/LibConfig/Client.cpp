@@ -20,6 +20,11 @@ Client& Client::the()
     return *s_the;
 }
 
+static DeprecatedString make_cache_key(StringView domain, StringView group, StringView key)
+{
+    return DeprecatedString::formatted("{}\n{}\n{}", domain, group, key);
+}
+
 void Client::pledge_domains(Vector<DeprecatedString> const& domains)
 {
     async_pledge_domains(domains);
@@ -27,9 +32,25 @@ void Client::pledge_domains(Vector<DeprecatedString> const& domains)
 
 void Client::monitor_domain(DeprecatedString const& domain)
 {
+    m_monitored_domains.set(domain);
     async_monitor_domain(domain);
 }
 
+void Client::drop_cached_values_for_key(DeprecatedString const& cache_key)
+{
+    m_cached_string_values.remove(cache_key);
+    m_cached_i32_values.remove(cache_key);
+    m_cached_bool_values.remove(cache_key);
+}
+
+void Client::drop_cached_values_for_group(StringView domain, StringView group)
+{
+    auto prefix = DeprecatedString::formatted("{}\n{}\n", domain, group);
+    m_cached_string_values.remove_all_matching([&](auto& key, auto&) { return key.starts_with(prefix); });
+    m_cached_i32_values.remove_all_matching([&](auto& key, auto&) { return key.starts_with(prefix); });
+    m_cached_bool_values.remove_all_matching([&](auto& key, auto&) { return key.starts_with(prefix); });
+}
+
 Vector<DeprecatedString> Client::list_keys(StringView domain, StringView group)
 {
     return list_config_keys(domain, group);
@@ -42,41 +63,87 @@ Vector<DeprecatedString> Client::list_groups(StringView domain)
 
 DeprecatedString Client::read_string(StringView domain, StringView group, StringView key, StringView fallback)
 {
-    return read_string_value(domain, group, key).value_or(fallback);
+    if (!is_caching_domain(domain))
+        return read_string_value(domain, group, key).value_or(fallback);
+
+    auto cache_key = make_cache_key(domain, group, key);
+    if (auto cached_value = m_cached_string_values.get(cache_key); cached_value.has_value())
+        return cached_value->value_or(fallback);
+
+    auto value = read_string_value(domain, group, key);
+    m_cached_string_values.set(move(cache_key), value);
+    return value.value_or(fallback);
 }
 
 i32 Client::read_i32(StringView domain, StringView group, StringView key, i32 fallback)
 {
-    return read_i32_value(domain, group, key).value_or(fallback);
+    if (!is_caching_domain(domain))
+        return read_i32_value(domain, group, key).value_or(fallback);
+
+    auto cache_key = make_cache_key(domain, group, key);
+    if (auto cached_value = m_cached_i32_values.get(cache_key); cached_value.has_value())
+        return cached_value->value_or(fallback);
+
+    auto value = read_i32_value(domain, group, key);
+    m_cached_i32_values.set(move(cache_key), value);
+    return value.value_or(fallback);
 }
 
 bool Client::read_bool(StringView domain, StringView group, StringView key, bool fallback)
 {
-    return read_bool_value(domain, group, key).value_or(fallback);
+    if (!is_caching_domain(domain))
+        return read_bool_value(domain, group, key).value_or(fallback);
+
+    auto cache_key = make_cache_key(domain, group, key);
+    if (auto cached_value = m_cached_bool_values.get(cache_key); cached_value.has_value())
+        return cached_value->value_or(fallback);
+
+    auto value = read_bool_value(domain, group, key);
+    m_cached_bool_values.set(move(cache_key), value);
+    return value.value_or(fallback);
 }
 
 void Client::write_string(StringView domain, StringView group, StringView key, StringView value)
 {
+    // NOTE: The server does not echo changes back to the connection that made them,
+    //       so local writes have to update the cache themselves.
+    if (is_caching_domain(domain)) {
+        auto cache_key = make_cache_key(domain, group, key);
+        drop_cached_values_for_key(cache_key);
+        m_cached_string_values.set(move(cache_key), DeprecatedString { value });
+    }
     write_string_value(domain, group, key, value);
 }
 
 void Client::write_i32(StringView domain, StringView group, StringView key, i32 value)
 {
+    if (is_caching_domain(domain)) {
+        auto cache_key = make_cache_key(domain, group, key);
+        drop_cached_values_for_key(cache_key);
+        m_cached_i32_values.set(move(cache_key), value);
+    }
     write_i32_value(domain, group, key, value);
 }
 
 void Client::write_bool(StringView domain, StringView group, StringView key, bool value)
 {
+    if (is_caching_domain(domain)) {
+        auto cache_key = make_cache_key(domain, group, key);
+        drop_cached_values_for_key(cache_key);
+        m_cached_bool_values.set(move(cache_key), value);
+    }
     write_bool_value(domain, group, key, value);
 }
 
 void Client::remove_key(StringView domain, StringView group, StringView key)
 {
+    drop_cached_values_for_key(make_cache_key(domain, group, key));
     remove_key_entry(domain, group, key);
 }
 
 void Client::remove_group(StringView domain, StringView group)
 {
+    drop_cached_values_for_group(domain, group);
     remove_group_entry(domain, group);
 }
 
@@ -87,6 +154,9 @@ void Client::add_group(StringView domain, StringView group)
 
 void Client::notify_changed_string_value(DeprecatedString const& domain, DeprecatedString const& group, DeprecatedString const& key, DeprecatedString const& value)
 {
+    auto cache_key = make_cache_key(domain, group, key);
+    drop_cached_values_for_key(cache_key);
+    m_cached_string_values.set(move(cache_key), value);
     Listener::for_each([&](auto& listener) {
         listener.config_string_did_change(domain, group, key, value);
     });
@@ -94,6 +164,9 @@ void Client::notify_changed_string_value(DeprecatedString const& domain, Depreca
 
 void Client::notify_changed_i32_value(DeprecatedString const& domain, DeprecatedString const& group, DeprecatedString const& key, i32 value)
 {
+    auto cache_key = make_cache_key(domain, group, key);
+    drop_cached_values_for_key(cache_key);
+    m_cached_i32_values.set(move(cache_key), value);
     Listener::for_each([&](auto& listener) {
         listener.config_i32_did_change(domain, group, key, value);
     });
@@ -101,6 +174,9 @@ void Client::notify_changed_i32_value(DeprecatedString const& domain, Deprecated
 
 void Client::notify_changed_bool_value(DeprecatedString const& domain, DeprecatedString const& group, DeprecatedString const& key, bool value)
 {
+    auto cache_key = make_cache_key(domain, group, key);
+    drop_cached_values_for_key(cache_key);
+    m_cached_bool_values.set(move(cache_key), value);
     Listener::for_each([&](auto& listener) {
         listener.config_bool_did_change(domain, group, key, value);
     });
@@ -108,6 +184,7 @@ void Client::notify_changed_bool_value(DeprecatedString const& domain, Deprecate
 
 void Client::notify_removed_key(DeprecatedString const& domain, DeprecatedString const& group, DeprecatedString const& key)
 {
+    drop_cached_values_for_key(make_cache_key(domain, group, key));
     Listener::for_each([&](auto& listener) {
         listener.config_key_was_removed(domain, group, key);
     });
@@ -115,6 +192,7 @@ void Client::notify_removed_key(DeprecatedString const& domain, DeprecatedString
 
 void Client::notify_removed_group(DeprecatedString const& domain, DeprecatedString const& group)
 {
+    drop_cached_values_for_group(domain, group);
     Listener::for_each([&](auto& listener) {
         listener.config_group_was_removed(domain, group);
     });
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
+#include <AK/HashTable.h>
 #include <ConfigServer/ConfigClientEndpoint.h>
 #include <ConfigServer/ConfigServerEndpoint.h>
 #include <LibCore/File.h>
@@ -52,6 +54,17 @@ private:
     void notify_removed_key(DeprecatedString const& domain, DeprecatedString const& group, DeprecatedString const& key) override;
     void notify_removed_group(DeprecatedString const& domain, DeprecatedString const& group) override;
     void notify_added_group(DeprecatedString const& domain, DeprecatedString const& group) override;
+
+    bool is_caching_domain(StringView domain) const { return m_monitored_domains.contains(domain); }
+    void drop_cached_values_for_key(DeprecatedString const& cache_key);
+    void drop_cached_values_for_group(StringView domain, StringView group);
+
+    // For domains we monitor, the server tells us about every change, so values can
+    // be cached locally and repeat reads answered without a synchronous IPC call.
+    HashTable<DeprecatedString> m_monitored_domains;
+    HashMap<DeprecatedString, Optional<DeprecatedString>> m_cached_string_values;
+    HashMap<DeprecatedString, Optional<i32>> m_cached_i32_values;
+    HashMap<DeprecatedString, Optional<bool>> m_cached_bool_values;
 };
 
 inline Vector<DeprecatedString> list_groups(StringView domain)
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Coroutine.h>
+#include <AK/NonnullRefPtr.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/Notifier.h>
+
+namespace Core {
+
+namespace Detail {
+
+// One-shot readiness awaiter: registers a Notifier with the current event
+// loop and resumes the coroutine once the file descriptor becomes ready.
+// The resume happens through deferred_invoke rather than from inside the
+// notifier callback, so the coroutine frame (which owns the notifier) can
+// safely finish and be destroyed without tearing down a callback that is
+// still on the stack.
+class FdReadyAwaiter {
+public:
+    FdReadyAwaiter(int fd, Notifier::Event event)
+        : m_fd(fd)
+        , m_event(event)
+    {
+    }
+
+    bool await_ready() const { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        m_notifier = Notifier::construct(m_fd, m_event);
+        auto on_ready = [notifier = m_notifier, handle] {
+            notifier->set_enabled(false);
+            deferred_invoke([handle] { handle.resume(); });
+            // Break the notifier <-> callback reference cycle. Function
+            // defers the destruction until this invocation returns.
+            notifier->on_ready_to_read = nullptr;
+            notifier->on_ready_to_write = nullptr;
+        };
+        if (m_event == Notifier::Event::Read)
+            m_notifier->on_ready_to_read = move(on_ready);
+        else
+            m_notifier->on_ready_to_write = move(on_ready);
+    }
+
+    void await_resume() { m_notifier = nullptr; }
+
+private:
+    int m_fd { -1 };
+    Notifier::Event m_event { Notifier::Event::None };
+    RefPtr<Notifier> m_notifier;
+};
+
+// An eagerly started, self-destroying coroutine; the frame for one of these
+// owns a spawned task and frees both when the task completes.
+struct DetachedCoroutine {
+    struct promise_type {
+        DetachedCoroutine get_return_object() { return {}; }
+        std::suspend_never initial_suspend() { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() { }
+        void unhandled_exception() { VERIFY_NOT_REACHED(); }
+    };
+};
+
+}
+
+// Suspends the awaiting coroutine until the file descriptor is ready. The
+// resume comes from the current event loop's notifier dispatch, so timers,
+// IPC and other events keep flowing while the coroutine waits.
+inline auto until_readable(int fd) { return Detail::FdReadyAwaiter { fd, Notifier::Event::Read }; }
+inline auto until_writable(int fd) { return Detail::FdReadyAwaiter { fd, Notifier::Event::Write }; }
+
+// Starts a coroutine "in the background": it runs until its first suspension
+// point, and from then on is driven entirely by event loop callbacks.
+inline void spawn(Coroutine<void> task)
+{
+    [](Coroutine<void> task) -> Detail::DetachedCoroutine {
+        co_await task;
+    }(move(task));
+}
+
+}
@@ -37,7 +37,9 @@
 #include <unistd.h>
 
 #ifdef AK_OS_SERENITY
+#    include <Kernel/API/EventQueue.h>
 #    include <LibCore/Account.h>
+#    include <serenity.h>
 
 extern bool s_global_initializers_ran;
 #endif
@@ -74,6 +76,60 @@ static thread_local HashTable<Notifier*>* s_notifiers;
 thread_local int EventLoop::s_wake_pipe_fds[2];
 thread_local bool EventLoop::s_wake_pipe_initialized { false };
 
+#ifdef AK_OS_SERENITY
+// A kernel-side event queue mirrors the notifier set (and the wake pipe), so
+// waking up only pays for the descriptors that are actually ready instead of
+// re-submitting the whole interest set on every loop iteration.
+static thread_local int s_event_queue_fd { -1 };
+// What the kernel queue currently has registered for each fd.
+static thread_local HashMap<int, u32>* s_event_queue_registrations;
+
+static void event_queue_update_fd(int fd, u32 desired_events)
+{
+    auto registered_events = s_event_queue_registrations->get(fd);
+    if (desired_events == 0) {
+        if (registered_events.has_value()) {
+            (void)event_queue_ctl(s_event_queue_fd, to_underlying(EventQueueOperation::Remove), fd, 0);
+            s_event_queue_registrations->remove(fd);
+        }
+        return;
+    }
+    if (!registered_events.has_value()) {
+        if (event_queue_ctl(s_event_queue_fd, to_underlying(EventQueueOperation::Add), fd, desired_events) == 0)
+            s_event_queue_registrations->set(fd, desired_events);
+        return;
+    }
+    if (registered_events.value() != desired_events) {
+        if (event_queue_ctl(s_event_queue_fd, to_underlying(EventQueueOperation::Modify), fd, desired_events) == 0)
+            s_event_queue_registrations->set(fd, desired_events);
+    }
+}
+
+static u32 event_queue_events_for_notifier(Notifier const& notifier)
+{
+    if (notifier.event_mask() & Notifier::Exceptional)
+        VERIFY_NOT_REACHED();
+    u32 events = 0;
+    if (notifier.event_mask() & Notifier::Read)
+        events |= EventQueueEvent::Read;
+    if (notifier.event_mask() & Notifier::Write)
+        events |= EventQueueEvent::Write;
+    return events;
+}
+
+// Several notifiers may watch the same fd; the kernel registration carries
+// the union of their masks.
+static u32 combined_event_queue_events_for_fd(int fd)
+{
+    u32 events = 0;
+    for (auto& notifier : *s_notifiers) {
+        if (notifier->fd() == fd)
+            events |= event_queue_events_for_notifier(*notifier);
+    }
+    return events;
+}
+#endif
+
 void EventLoop::initialize_wake_pipes()
 {
     if (!s_wake_pipe_initialized) {
@@ -665,6 +721,15 @@ void EventLoop::notify_forked(ForkEvent event)
         s_notifiers->clear();
         s_wake_pipe_initialized = false;
         initialize_wake_pipes();
+#ifdef AK_OS_SERENITY
+        // The inherited queue still watches the parent's wake pipe (and keeps
+        // its registered descriptions alive), so start over with a fresh one.
+        if (s_event_queue_fd >= 0) {
+            close(s_event_queue_fd);
+            s_event_queue_fd = -1;
+            s_event_queue_registrations->clear();
+        }
+#endif
         if (auto* info = signals_info<false>()) {
             info->signal_handlers.clear();
             info->next_signal_id = 0;
@@ -678,9 +743,38 @@ void EventLoop::notify_forked(ForkEvent event)
 
 void EventLoop::wait_for_event(WaitMode mode)
 {
+#ifndef AK_OS_SERENITY
     fd_set rfds;
     fd_set wfds;
+#endif
 retry:
+#ifdef AK_OS_SERENITY
+    if (s_event_queue_fd < 0) {
+        s_event_queue_fd = event_queue_create();
+        VERIFY(s_event_queue_fd >= 0);
+        s_event_queue_registrations = new HashMap<int, u32>;
+    }
+
+    // Reconcile the kernel queue with the notifier set. When nothing has
+    // changed since the last iteration this makes no syscalls at all.
+    HashMap<int, u32> desired_registrations;
+    desired_registrations.set(s_wake_pipe_fds[0], EventQueueEvent::Read);
+    for (auto& notifier : *s_notifiers) {
+        auto events = event_queue_events_for_notifier(*notifier);
+        if (events == 0)
+            continue;
+        desired_registrations.set(notifier->fd(), desired_registrations.get(notifier->fd()).value_or(0) | events);
+    }
+    Vector<int> stale_fds;
+    for (auto& it : *s_event_queue_registrations) {
+        if (!desired_registrations.contains(it.key))
+            stale_fds.append(it.key);
+    }
+    for (auto fd : stale_fds)
+        event_queue_update_fd(fd, 0);
+    for (auto& it : desired_registrations)
+        event_queue_update_fd(it.key, it.value);
+#else
     FD_ZERO(&rfds);
     FD_ZERO(&wfds);
 
@@ -703,6 +797,7 @@ retry:
         if (notifier->event_mask() & Notifier::Exceptional)
             VERIFY_NOT_REACHED();
     }
+#endif
 
     bool queued_events_is_empty;
     {
@@ -727,7 +822,14 @@ retry:
     }
 
 try_select_again:
+#ifdef AK_OS_SERENITY
+    static constexpr size_t max_events_per_wait = 64;
+    EventQueueEvent event_buffer[max_events_per_wait];
+    struct timespec wait_timeout = { timeout.tv_sec, static_cast<long>(timeout.tv_usec) * 1000 };
+    int marked_fd_count = event_queue_wait(s_event_queue_fd, event_buffer, max_events_per_wait, should_wait_forever ? nullptr : &wait_timeout);
+#else
     int marked_fd_count = select(max_fd + 1, &rfds, &wfds, nullptr, should_wait_forever ? nullptr : &timeout);
+#endif
     if (marked_fd_count < 0) {
         int saved_errno = errno;
         if (saved_errno == EINTR) {
@@ -738,7 +840,27 @@ try_select_again:
         dbgln("Core::EventLoop::wait_for_event: {} ({}: {})", marked_fd_count, saved_errno, strerror(saved_errno));
         VERIFY_NOT_REACHED();
     }
+#ifdef AK_OS_SERENITY
+    bool wake_pipe_is_ready = false;
+    HashTable<int> ready_to_read_fds;
+    HashTable<int> ready_to_write_fds;
+    for (int i = 0; i < marked_fd_count; ++i) {
+        auto& event = event_buffer[i];
+        if (event.fd == s_wake_pipe_fds[0]) {
+            wake_pipe_is_ready = true;
+            continue;
+        }
+        // Like select(), report error and hang-up conditions as both readable
+        // and writable so whichever notifier is interested gets to react.
+        if (event.events & (EventQueueEvent::Read | EventQueueEvent::Error | EventQueueEvent::HangUp))
+            ready_to_read_fds.set(event.fd);
+        if (event.events & (EventQueueEvent::Write | EventQueueEvent::Error | EventQueueEvent::HangUp))
+            ready_to_write_fds.set(event.fd);
+    }
+    if (wake_pipe_is_ready) {
+#else
     if (FD_ISSET(s_wake_pipe_fds[0], &rfds)) {
+#endif
         int wake_events[8];
         ssize_t nread;
         // We might receive another signal while read()ing here. The signal will go to the handle_signal properly,
@@ -797,11 +919,19 @@ try_select_again:
         return;
 
     for (auto& notifier : *s_notifiers) {
+#ifdef AK_OS_SERENITY
+        if (ready_to_read_fds.contains(notifier->fd())) {
+#else
         if (FD_ISSET(notifier->fd(), &rfds)) {
+#endif
             if (notifier->event_mask() & Notifier::Event::Read)
                 post_event(*notifier, make<NotifierReadEvent>(notifier->fd()));
         }
+#ifdef AK_OS_SERENITY
+        if (ready_to_write_fds.contains(notifier->fd())) {
+#else
         if (FD_ISSET(notifier->fd(), &wfds)) {
+#endif
             if (notifier->event_mask() & Notifier::Event::Write)
                 post_event(*notifier, make<NotifierWriteEvent>(notifier->fd()));
         }
@@ -870,12 +1000,23 @@ void EventLoop::register_notifier(Badge<Notifier>, Notifier& notifier)
 {
     VERIFY_EVENT_LOOP_INITIALIZED();
     s_notifiers->set(&notifier);
+#ifdef AK_OS_SERENITY
+    if (s_event_queue_fd >= 0)
+        event_queue_update_fd(notifier.fd(), combined_event_queue_events_for_fd(notifier.fd()));
+#endif
 }
 
 void EventLoop::unregister_notifier(Badge<Notifier>, Notifier& notifier)
 {
     VERIFY_EVENT_LOOP_INITIALIZED();
     s_notifiers->remove(&notifier);
+#ifdef AK_OS_SERENITY
+    // Drop the kernel registration right away: the caller is likely about to
+    // close() the fd, and a registration would both keep the open file
+    // description alive and go stale if the fd number is reused.
+    if (s_event_queue_fd >= 0)
+        event_queue_update_fd(notifier.fd(), combined_event_queue_events_for_fd(notifier.fd()));
+#endif
 }
 
 void EventLoop::wake_current()
@@ -6,7 +6,6 @@
 
 #pragma once
 
-#include <AK/ByteBuffer.h>
 #include <AK/Concepts.h>
 #include <AK/Error.h>
 #include <AK/NonnullOwnPtr.h>
@@ -21,6 +20,12 @@ namespace Core::Stream {
 
 /// A stream wrapper class that allows you to read arbitrary amounts of bits
 /// in big-endian order from another stream.
+///
+/// Bits are kept in a cached 64-bit buffer, so multi-bit reads are a single
+/// mask-and-shift instead of a per-bit loop. The buffer is refilled with
+/// exactly the bytes whose bits the current read consumes: reading ahead
+/// would steal data from other readers of the underlying stream, and a
+/// partially read byte could never be given back.
 class BigEndianInputBitStream : public Stream {
 public:
     static ErrorOr<NonnullOwnPtr<BigEndianInputBitStream>> construct(Handle<Stream> stream)
@@ -31,16 +36,12 @@ public:
     // ^Stream
     virtual ErrorOr<Bytes> read(Bytes bytes) override
     {
-        if (m_current_byte.has_value() && is_aligned_to_byte_boundary()) {
-            bytes[0] = m_current_byte.release_value();
-            return m_stream->read(bytes.slice(1));
-        }
         align_to_byte_boundary();
         return m_stream->read(bytes);
     }
     virtual ErrorOr<size_t> write(ReadonlyBytes bytes) override { return m_stream->write(bytes); }
     virtual ErrorOr<void> write_entire_buffer(ReadonlyBytes bytes) override { return m_stream->write_entire_buffer(bytes); }
-    virtual bool is_eof() const override { return m_stream->is_eof() && !m_current_byte.has_value(); }
+    virtual bool is_eof() const override { return m_bit_count == 0 && m_stream->is_eof(); }
     virtual bool is_open() const override { return m_stream->is_open(); }
     virtual void close() override
     {
@@ -61,48 +62,21 @@ public:
         if constexpr (IsSame<bool, T>) {
             VERIFY(count == 1);
         }
-        T result = 0;
-
-        size_t nread = 0;
-        while (nread < count) {
-            if (m_current_byte.has_value()) {
-                if constexpr (!IsSame<bool, T> && !IsSame<u8, T>) {
-                    // read as many bytes as possible directly
-                    if (((count - nread) >= 8) && is_aligned_to_byte_boundary()) {
-                        // shift existing data over
-                        result <<= 8;
-                        result |= m_current_byte.value();
-                        nread += 8;
-                        m_current_byte.clear();
-                    } else {
-                        auto const bit = (m_current_byte.value() >> (7 - m_bit_offset)) & 1;
-                        result <<= 1;
-                        result |= bit;
-                        ++nread;
-                        if (m_bit_offset++ == 7)
-                            m_current_byte.clear();
-                    }
-                } else {
-                    // Always take this branch for booleans or u8: there's no purpose in reading more than a single bit
-                    auto const bit = (m_current_byte.value() >> (7 - m_bit_offset)) & 1;
-                    if constexpr (IsSame<bool, T>)
-                        result = bit;
-                    else {
-                        result <<= 1;
-                        result |= bit;
-                    }
-                    ++nread;
-                    if (m_bit_offset++ == 7)
-                        m_current_byte.clear();
-                }
-            } else {
-                auto temp_buffer = TRY(ByteBuffer::create_uninitialized(1));
-                TRY(m_stream->read(temp_buffer.bytes()));
-                m_current_byte = temp_buffer[0];
-                m_bit_offset = 0;
-            }
+
+        // Split large reads so that a refill always fits into the 64-bit
+        // buffer together with up to 7 leftover bits from a previous read.
+        if (count > 32) {
+            auto high = TRY(read_bits<u64>(count - 32));
+            auto low = TRY(read_bits<u64>(32));
+            return static_cast<T>((high << 32) | low);
         }
 
+        while (m_bit_count < count)
+            TRY(refill_bit_buffer(count));
+
+        m_bit_count -= count;
+        auto result = static_cast<T>(m_bit_buffer >> m_bit_count);
+        m_bit_buffer &= lsb_mask(m_bit_count);
         return result;
     }
 
@@ -110,12 +84,12 @@ public:
     /// Non-bitwise reads will implicitly call this.
     void align_to_byte_boundary()
     {
-        m_current_byte.clear();
-        m_bit_offset = 0;
+        m_bit_buffer = 0;
+        m_bit_count = 0;
     }
 
     /// Whether we are (accidentally or intentionally) at a byte boundary right now.
-    ALWAYS_INLINE bool is_aligned_to_byte_boundary() const { return m_bit_offset == 0; }
+    ALWAYS_INLINE bool is_aligned_to_byte_boundary() const { return m_bit_count % 8 == 0; }
 
 private:
     BigEndianInputBitStream(Handle<Stream> stream)
@@ -123,13 +97,38 @@ private:
     {
     }
 
-    Optional<u8> m_current_byte;
-    size_t m_bit_offset { 0 };
+    ALWAYS_INLINE ErrorOr<void> refill_bit_buffer(size_t count)
+    {
+        size_t bytes_needed = (count - m_bit_count + 7) / 8;
+        u8 bytes[sizeof(u64)] = {};
+        auto read_bytes = TRY(m_stream->read({ bytes, bytes_needed }));
+        if (read_bytes.is_empty())
+            return Error::from_string_literal("eof");
+        for (auto byte : read_bytes) {
+            m_bit_buffer = (m_bit_buffer << 8) | byte;
+            m_bit_count += 8;
+        }
+        return {};
+    }
+
+    static constexpr u64 lsb_mask(size_t bits)
+    {
+        return (static_cast<u64>(1) << bits) - 1;
+    }
+
+    u64 m_bit_buffer { 0 };
+    size_t m_bit_count { 0 };
     Handle<Stream> m_stream;
 };
 
 /// A stream wrapper class that allows you to read arbitrary amounts of bits
 /// in little-endian order from another stream.
+///
+/// Bits are kept in a cached 64-bit buffer, so multi-bit reads are a single
+/// mask-and-shift instead of a per-bit loop. The buffer is refilled with
+/// exactly the bytes whose bits the current read consumes: reading ahead
+/// would steal data from other readers of the underlying stream, and a
+/// partially read byte could never be given back.
 class LittleEndianInputBitStream : public Stream {
 public:
     static ErrorOr<NonnullOwnPtr<LittleEndianInputBitStream>> construct(Handle<Stream> stream)
@@ -145,16 +144,12 @@ public:
     // ^Stream
     virtual ErrorOr<Bytes> read(Bytes bytes) override
     {
-        if (m_current_byte.has_value() && is_aligned_to_byte_boundary()) {
-            bytes[0] = m_current_byte.release_value();
-            return m_stream->read(bytes.slice(1));
-        }
         align_to_byte_boundary();
         return m_stream->read(bytes);
     }
     virtual ErrorOr<size_t> write(ReadonlyBytes bytes) override { return m_stream->write(bytes); }
     virtual ErrorOr<void> write_entire_buffer(ReadonlyBytes bytes) override { return m_stream->write_entire_buffer(bytes); }
-    virtual bool is_eof() const override { return m_stream->is_eof() && !m_current_byte.has_value(); }
+    virtual bool is_eof() const override { return m_bit_count == 0 && m_stream->is_eof(); }
     virtual bool is_open() const override { return m_stream->is_open(); }
     virtual void close() override
     {
@@ -175,46 +170,21 @@ public:
         if constexpr (IsSame<bool, T>) {
             VERIFY(count == 1);
         }
-        T result = 0;
-
-        size_t nread = 0;
-        while (nread < count) {
-            if (m_current_byte.has_value()) {
-                if constexpr (!IsSame<bool, T> && !IsSame<u8, T>) {
-                    // read as many bytes as possible directly
-                    if (((count - nread) >= 8) && is_aligned_to_byte_boundary()) {
-                        // shift existing data over
-                        result |= (m_current_byte.value() << nread);
-                        nread += 8;
-                        m_current_byte.clear();
-                    } else {
-                        auto const bit = (m_current_byte.value() >> m_bit_offset) & 1;
-                        result |= (bit << nread);
-                        ++nread;
-                        if (m_bit_offset++ == 7)
-                            m_current_byte.clear();
-                    }
-                } else {
-                    // Always take this branch for booleans or u8: there's no purpose in reading more than a single bit
-                    auto const bit = (m_current_byte.value() >> m_bit_offset) & 1;
-                    if constexpr (IsSame<bool, T>)
-                        result = bit;
-                    else
-                        result |= (bit << nread);
-                    ++nread;
-                    if (m_bit_offset++ == 7)
-                        m_current_byte.clear();
-                }
-            } else {
-                auto temp_buffer = TRY(ByteBuffer::create_uninitialized(1));
-                auto read_bytes = TRY(m_stream->read(temp_buffer.bytes()));
-                if (read_bytes.is_empty())
-                    return Error::from_string_literal("eof");
-                m_current_byte = temp_buffer[0];
-                m_bit_offset = 0;
-            }
+
+        // Split large reads so that a refill always fits into the 64-bit
+        // buffer together with up to 7 leftover bits from a previous read.
+        if (count > 32) {
+            auto low = TRY(read_bits<u64>(32));
+            auto high = TRY(read_bits<u64>(count - 32));
+            return static_cast<T>(low | (high << 32));
         }
 
+        while (m_bit_count < count)
+            TRY(refill_bit_buffer(count));
+
+        auto result = static_cast<T>(m_bit_buffer & lsb_mask(count));
+        m_bit_buffer >>= count;
+        m_bit_count -= count;
         return result;
     }
 
@@ -222,18 +192,37 @@ public:
     /// Non-bitwise reads will implicitly call this.
     u8 align_to_byte_boundary()
     {
-        u8 remaining_bits = m_current_byte.value_or(0) >> m_bit_offset;
-        m_current_byte.clear();
-        m_bit_offset = 0;
+        u8 remaining_bits = static_cast<u8>(m_bit_buffer & lsb_mask(m_bit_count));
+        m_bit_buffer = 0;
+        m_bit_count = 0;
         return remaining_bits;
     }
 
     /// Whether we are (accidentally or intentionally) at a byte boundary right now.
-    ALWAYS_INLINE bool is_aligned_to_byte_boundary() const { return m_bit_offset == 0; }
+    ALWAYS_INLINE bool is_aligned_to_byte_boundary() const { return m_bit_count % 8 == 0; }
 
 private:
-    Optional<u8> m_current_byte;
-    size_t m_bit_offset { 0 };
+    ALWAYS_INLINE ErrorOr<void> refill_bit_buffer(size_t count)
+    {
+        size_t bytes_needed = (count - m_bit_count + 7) / 8;
+        u8 bytes[sizeof(u64)] = {};
+        auto read_bytes = TRY(m_stream->read({ bytes, bytes_needed }));
+        if (read_bytes.is_empty())
+            return Error::from_string_literal("eof");
+        for (auto byte : read_bytes) {
+            m_bit_buffer |= static_cast<u64>(byte) << m_bit_count;
+            m_bit_count += 8;
+        }
+        return {};
+    }
+
+    static constexpr u64 lsb_mask(size_t bits)
+    {
+        return (static_cast<u64>(1) << bits) - 1;
+    }
+
+    u64 m_bit_buffer { 0 };
+    size_t m_bit_count { 0 };
     Handle<Stream> m_stream;
 };
 
@@ -8,6 +8,7 @@
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/JsonValue.h>
+#include <Kernel/API/ProcessStatistics.h>
 #include <LibCore/ProcessStatisticsReader.h>
 #include <pwd.h>
 
@@ -15,13 +16,124 @@ namespace Core {
 
 HashMap<uid_t, DeprecatedString> ProcessStatisticsReader::s_usernames;
 
-ErrorOr<AllProcessesStatistics> ProcessStatisticsReader::get_all(Core::Stream::SeekableStream& proc_all_file, bool include_usernames)
+ErrorOr<AllProcessesStatistics> ProcessStatisticsReader::get_all_from_binary(ReadonlyBytes contents, bool include_usernames, AllProcessesStatistics const* previous)
+{
+    Kernel::ProcessStatisticsHeader header;
+    if (contents.size() < sizeof(header))
+        return Error::from_string_literal("ProcessStatisticsReader: Truncated binary statistics header");
+    memcpy(&header, contents.data(), sizeof(header));
+    VERIFY(header.magic == Kernel::process_statistics_magic);
+    if (header.version != Kernel::process_statistics_version)
+        return Error::from_string_literal("ProcessStatisticsReader: Unsupported binary statistics version");
+
+    AllProcessesStatistics all_processes_statistics;
+    all_processes_statistics.total_time_scheduled = header.total_time_scheduled;
+    all_processes_statistics.total_time_scheduled_kernel = header.total_time_scheduled_kernel;
+
+    HashMap<pid_t, ProcessStatistics const*> previous_by_pid;
+    if (previous) {
+        for (auto const& process : previous->processes)
+            previous_by_pid.set(process.pid, &process);
+    }
+
+    size_t offset = sizeof(header);
+    while (offset < contents.size()) {
+        if (contents.size() - offset < sizeof(Kernel::BinaryProcessStatistics))
+            return Error::from_string_literal("ProcessStatisticsReader: Truncated process record");
+        Kernel::BinaryProcessStatistics record;
+        memcpy(&record, contents.offset_pointer(offset), sizeof(record));
+        offset += sizeof(record);
+
+        if (auto it = previous_by_pid.find(record.pid); it != previous_by_pid.end()
+            && it->value->change_sequence == record.change_sequence
+            && it->value->threads.size() == record.thread_count) {
+            // Nothing about this process has changed since the previous
+            // snapshot, so reuse its entry instead of re-parsing the records.
+            size_t thread_records_size = record.thread_count * sizeof(Kernel::BinaryThreadStatistics);
+            if (contents.size() - offset < thread_records_size)
+                return Error::from_string_literal("ProcessStatisticsReader: Truncated thread record");
+            offset += thread_records_size;
+            TRY(all_processes_statistics.processes.try_append(*it->value));
+            continue;
+        }
+
+        Core::ProcessStatistics process;
+        process.pid = record.pid;
+        process.pgid = record.pgid;
+        process.pgp = record.pgp;
+        process.sid = record.sid;
+        process.uid = record.uid;
+        process.gid = record.gid;
+        process.ppid = record.ppid;
+        process.nfds = record.nfds;
+        process.kernel = record.kernel;
+        process.name = record.name;
+        process.executable = record.executable;
+        process.tty = record.tty;
+        process.pledge = record.pledge;
+        process.veil = record.veil;
+        process.amount_virtual = record.amount_virtual;
+        process.amount_resident = record.amount_resident;
+        process.amount_shared = record.amount_shared;
+        process.amount_dirty_private = record.amount_dirty_private;
+        process.amount_clean_inode = record.amount_clean_inode;
+        process.amount_purgeable_volatile = record.amount_purgeable_volatile;
+        process.amount_purgeable_nonvolatile = record.amount_purgeable_nonvolatile;
+        process.change_sequence = record.change_sequence;
+
+        process.threads.ensure_capacity(record.thread_count);
+        for (u32 i = 0; i < record.thread_count; ++i) {
+            if (contents.size() - offset < sizeof(Kernel::BinaryThreadStatistics))
+                return Error::from_string_literal("ProcessStatisticsReader: Truncated thread record");
+            Kernel::BinaryThreadStatistics thread_record;
+            memcpy(&thread_record, contents.offset_pointer(offset), sizeof(thread_record));
+            offset += sizeof(thread_record);
+
+            Core::ThreadStatistics thread;
+            thread.tid = thread_record.tid;
+            thread.times_scheduled = thread_record.times_scheduled;
+            thread.name = thread_record.name;
+            thread.state = thread_record.state;
+            thread.time_user = thread_record.time_user;
+            thread.time_kernel = thread_record.time_kernel;
+            thread.cpu = thread_record.cpu;
+            thread.priority = thread_record.priority;
+            thread.syscall_count = thread_record.syscall_count;
+            thread.inode_faults = thread_record.inode_faults;
+            thread.zero_faults = thread_record.zero_faults;
+            thread.cow_faults = thread_record.cow_faults;
+            thread.unix_socket_read_bytes = thread_record.unix_socket_read_bytes;
+            thread.unix_socket_write_bytes = thread_record.unix_socket_write_bytes;
+            thread.ipv4_socket_read_bytes = thread_record.ipv4_socket_read_bytes;
+            thread.ipv4_socket_write_bytes = thread_record.ipv4_socket_write_bytes;
+            thread.file_read_bytes = thread_record.file_read_bytes;
+            thread.file_write_bytes = thread_record.file_write_bytes;
+            process.threads.append(move(thread));
+        }
+
+        if (include_usernames)
+            process.username = username_from_uid(process.uid);
+        all_processes_statistics.processes.append(move(process));
+    }
+
+    return all_processes_statistics;
+}
+
+ErrorOr<AllProcessesStatistics> ProcessStatisticsReader::get_all(Core::Stream::SeekableStream& proc_all_file, bool include_usernames, AllProcessesStatistics const* previous)
 {
     TRY(proc_all_file.seek(0, Core::Stream::SeekMode::SetPosition));
 
     AllProcessesStatistics all_processes_statistics;
 
     auto file_contents = TRY(proc_all_file.read_until_eof());
+
+    if (file_contents.size() >= sizeof(u32)) {
+        u32 magic;
+        memcpy(&magic, file_contents.data(), sizeof(magic));
+        if (magic == Kernel::process_statistics_magic)
+            return get_all_from_binary(file_contents, include_usernames, previous);
+    }
+
     auto json_obj = TRY(JsonValue::from_string(file_contents)).as_object();
     json_obj.get("processes"sv).as_array().for_each([&](auto& value) {
         const JsonObject& process_object = value.as_object();
@@ -88,10 +200,15 @@ ErrorOr<AllProcessesStatistics> ProcessStatisticsReader::get_all(Core::Stream::S
     return all_processes_statistics;
 }
 
-ErrorOr<AllProcessesStatistics> ProcessStatisticsReader::get_all(bool include_usernames)
+ErrorOr<AllProcessesStatistics> ProcessStatisticsReader::get_all(bool include_usernames, AllProcessesStatistics const* previous)
 {
+    // Prefer the binary node, which is much cheaper to produce and consume.
+    // Fall back to the JSON node for callers that only unveiled that one.
+    auto binary_file_or_error = Core::Stream::File::open("/sys/kernel/processes_binary"sv, Core::Stream::OpenMode::Read);
+    if (!binary_file_or_error.is_error())
+        return get_all(*binary_file_or_error.value(), include_usernames, previous);
     auto proc_all_file = TRY(Core::Stream::File::open("/sys/kernel/processes"sv, Core::Stream::OpenMode::Read));
-    return get_all(*proc_all_file, include_usernames);
+    return get_all(*proc_all_file, include_usernames, previous);
 }
 
 DeprecatedString ProcessStatisticsReader::username_from_uid(uid_t uid)
@@ -57,6 +57,7 @@ struct ProcessStatistics {
     size_t amount_clean_inode;
     size_t amount_purgeable_volatile;
     size_t amount_purgeable_nonvolatile;
+    u64 change_sequence { 0 };
 
     Vector<Core::ThreadStatistics> threads;
 
@@ -72,10 +73,15 @@ struct AllProcessesStatistics {
 
 class ProcessStatisticsReader {
 public:
-    static ErrorOr<AllProcessesStatistics> get_all(Core::Stream::SeekableStream&, bool include_usernames = true);
-    static ErrorOr<AllProcessesStatistics> get_all(bool include_usernames = true);
+    // If the caller keeps its previous snapshot around and passes it in,
+    // processes whose change_sequence hasn't moved are copied from it instead
+    // of being re-parsed. (Only the binary statistics format carries change
+    // sequences; when reading JSON, the previous snapshot is ignored.)
+    static ErrorOr<AllProcessesStatistics> get_all(Core::Stream::SeekableStream&, bool include_usernames = true, AllProcessesStatistics const* previous = nullptr);
+    static ErrorOr<AllProcessesStatistics> get_all(bool include_usernames = true, AllProcessesStatistics const* previous = nullptr);
 
 private:
+    static ErrorOr<AllProcessesStatistics> get_all_from_binary(ReadonlyBytes, bool include_usernames, AllProcessesStatistics const* previous);
     static DeprecatedString username_from_uid(uid_t);
     static HashMap<uid_t, DeprecatedString> s_usernames;
 };
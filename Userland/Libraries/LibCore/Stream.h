@@ -603,6 +603,7 @@ public:
     BufferedHelper(BufferedHelper&& other)
         : m_stream(move(other.m_stream))
         , m_buffer(move(other.m_buffer))
+        , m_buffered_offset(exchange(other.m_buffered_offset, 0))
         , m_buffered_size(exchange(other.m_buffered_size, 0))
     {
     }
@@ -611,6 +612,7 @@ public:
     {
         m_stream = move(other.m_stream);
         m_buffer = move(other.m_buffer);
+        m_buffered_offset = exchange(other.m_buffered_offset, 0);
         m_buffered_size = exchange(other.m_buffered_size, 0);
         return *this;
     }
@@ -645,19 +647,10 @@ public:
         // Let's try to take all we can from the buffer first.
         size_t buffer_nread = 0;
         if (m_buffered_size > 0) {
-            // FIXME: Use a circular buffer to avoid shifting the buffer
-            //        contents.
             size_t amount_to_take = min(buffer.size(), m_buffered_size);
-            auto slice_to_take = m_buffer.span().slice(0, amount_to_take);
-            auto slice_to_shift = m_buffer.span().slice(amount_to_take);
-
-            slice_to_take.copy_to(buffer);
+            buffered_data().slice(0, amount_to_take).copy_to(buffer);
+            consume_buffered_data(amount_to_take);
             buffer_nread += amount_to_take;
-
-            if (amount_to_take < m_buffered_size) {
-                m_buffer.overwrite(0, slice_to_shift.data(), m_buffered_size - amount_to_take);
-            }
-            m_buffered_size -= amount_to_take;
         }
 
         return Bytes { buffer.data(), buffer_nread };
@@ -714,7 +707,7 @@ public:
         Optional<size_t> longest_match;
         size_t match_size = 0;
         for (auto& candidate : candidates) {
-            auto result = AK::memmem_optional(m_buffer.data(), readable_size, candidate.bytes().data(), candidate.bytes().size());
+            auto result = AK::memmem_optional(buffered_data().data(), readable_size, candidate.bytes().data(), candidate.bytes().size());
             if (result.has_value()) {
                 auto previous_match = longest_match.value_or(*result);
                 if ((previous_match < *result) || (previous_match == *result && match_size < candidate.length())) {
@@ -725,13 +718,9 @@ public:
         }
         if (longest_match.has_value()) {
             auto size_written_to_user_buffer = *longest_match;
-            auto buffer_to_take = m_buffer.span().slice(0, size_written_to_user_buffer);
-            auto buffer_to_shift = m_buffer.span().slice(size_written_to_user_buffer + match_size);
-
-            buffer_to_take.copy_to(buffer);
-            m_buffer.overwrite(0, buffer_to_shift.data(), buffer_to_shift.size());
 
-            m_buffered_size -= size_written_to_user_buffer + match_size;
+            buffered_data().slice(0, size_written_to_user_buffer).copy_to(buffer);
+            consume_buffered_data(size_written_to_user_buffer + match_size);
 
             return buffer.slice(0, size_written_to_user_buffer);
         }
@@ -739,13 +728,8 @@ public:
         // If we still haven't found anything, then it's most likely the case
         // that the delimiter ends beyond the length of the caller-passed
         // buffer. Let's just fill the caller's buffer up.
-        auto buffer_to_take = m_buffer.span().slice(0, readable_size);
-        auto buffer_to_shift = m_buffer.span().slice(readable_size);
-
-        buffer_to_take.copy_to(buffer);
-        m_buffer.overwrite(0, buffer_to_shift.data(), buffer_to_shift.size());
-
-        m_buffered_size -= readable_size;
+        buffered_data().slice(0, readable_size).copy_to(buffer);
+        consume_buffered_data(readable_size);
 
         return buffer.slice(0, readable_size);
     }
@@ -756,7 +740,7 @@ public:
         if (stream().is_eof() && m_buffered_size > 0)
             return true;
 
-        if (m_buffer.span().slice(0, m_buffered_size).contains_slow('\n'))
+        if (buffered_data().contains_slow('\n'))
             return true;
 
         if (stream().is_eof())
@@ -802,15 +786,38 @@ public:
 
     void clear_buffer()
     {
+        m_buffered_offset = 0;
         m_buffered_size = 0;
     }
 
 private:
+    ReadonlyBytes buffered_data() const
+    {
+        return m_buffer.span().slice(m_buffered_offset, m_buffered_size);
+    }
+
+    // Consuming buffered data only advances the start offset; the remaining
+    // contents are moved to the front of the buffer in one go when we need
+    // room to refill, rather than after every small read.
+    void consume_buffered_data(size_t size)
+    {
+        VERIFY(size <= m_buffered_size);
+        m_buffered_offset += size;
+        m_buffered_size -= size;
+        if (m_buffered_size == 0)
+            m_buffered_offset = 0;
+    }
+
     ErrorOr<ReadonlyBytes> populate_read_buffer()
     {
         if (m_buffered_size == m_buffer.size())
             return ReadonlyBytes {};
 
+        if (m_buffered_offset > 0) {
+            m_buffer.overwrite(0, m_buffer.data() + m_buffered_offset, m_buffered_size);
+            m_buffered_offset = 0;
+        }
+
         auto fillable_slice = m_buffer.span().slice(m_buffered_size);
         size_t nread = 0;
         do {
@@ -833,19 +840,114 @@ private:
     }
 
     NonnullOwnPtr<T> m_stream;
-    // FIXME: Replacing this with a circular buffer would be really nice and
-    //        would avoid excessive copies; however, right now
-    //        AK::CircularDuplexBuffer inlines its entire contents, and that
-    //        would make for a very large object on the stack.
-    //
-    //        The proper fix is to make a CircularQueue which uses a buffer on
-    //        the heap.
+    // Buffered data lives at [m_buffered_offset, m_buffered_offset + m_buffered_size).
     ByteBuffer m_buffer;
+    size_t m_buffered_offset { 0 };
     size_t m_buffered_size { 0 };
 };
 
-// NOTE: A Buffered which accepts any Stream could be added here, but it is not
-//       needed at the moment.
+// A buffered wrapper over any Stream, owned or borrowed through a Handle. In
+// addition to buffered reads it supports zero-copy lookahead: peek_bytes()
+// returns a span over the data sitting in the internal buffer, and consume()
+// advances past the bytes the caller has used, so parsers that need lookahead
+// don't have to copy into buffers of their own.
+class BufferedStream final : public Stream {
+public:
+    static ErrorOr<NonnullOwnPtr<BufferedStream>> construct(Handle<Stream> stream, size_t buffer_size = 16384)
+    {
+        return adopt_nonnull_own_or_enomem(new (nothrow) BufferedStream(move(stream), buffer_size));
+    }
+
+    explicit BufferedStream(Handle<Stream> stream, size_t buffer_size = 16384)
+        : m_stream(move(stream))
+        , m_buffer_size(buffer_size)
+    {
+        VERIFY(buffer_size > 0);
+    }
+
+    // ^Stream
+    virtual ErrorOr<Bytes> read(Bytes bytes) override
+    {
+        if (bytes.is_empty())
+            return bytes;
+        auto buffered = TRY(peek_bytes());
+        auto amount_to_take = min(bytes.size(), buffered.size());
+        buffered.slice(0, amount_to_take).copy_to(bytes);
+        consume(amount_to_take);
+        return bytes.slice(0, amount_to_take);
+    }
+    virtual ErrorOr<size_t> write(ReadonlyBytes bytes) override { return m_stream->write(bytes); }
+    virtual ErrorOr<void> write_entire_buffer(ReadonlyBytes bytes) override { return m_stream->write_entire_buffer(bytes); }
+    virtual bool is_eof() const override { return m_buffered_size == 0 && m_stream->is_eof(); }
+    virtual bool is_open() const override { return m_stream->is_open(); }
+    virtual void close() override { m_stream->close(); }
+
+    // Returns a span over the data currently sitting in the internal buffer,
+    // refilling it from the underlying stream first if it has run dry. An
+    // empty span means the underlying stream has no more data to give us
+    // right now.
+    ErrorOr<ReadonlyBytes> peek_bytes()
+    {
+        if (m_buffered_size == 0)
+            TRY(populate_read_buffer());
+        return buffered_data();
+    }
+
+    // Advances past bytes previously returned by peek_bytes().
+    void consume(size_t size)
+    {
+        VERIFY(size <= m_buffered_size);
+        m_buffered_offset += size;
+        m_buffered_size -= size;
+        if (m_buffered_size == 0)
+            m_buffered_offset = 0;
+    }
+
+    size_t buffer_size() const { return m_buffer_size; }
+
+private:
+    ReadonlyBytes buffered_data() const
+    {
+        return m_buffer.span().slice(m_buffered_offset, m_buffered_size);
+    }
+
+    ErrorOr<void> populate_read_buffer()
+    {
+        // The buffer is allocated lazily, so that merely constructing a
+        // BufferedStream cannot fail.
+        if (m_buffer.is_empty())
+            m_buffer = TRY(ByteBuffer::create_uninitialized(m_buffer_size));
+
+        if (m_buffered_offset > 0) {
+            m_buffer.overwrite(0, m_buffer.data() + m_buffered_offset, m_buffered_size);
+            m_buffered_offset = 0;
+        }
+
+        auto fillable_slice = m_buffer.span().slice(m_buffered_size);
+        do {
+            auto result = m_stream->read(fillable_slice);
+            if (result.is_error()) {
+                if (!result.error().is_errno())
+                    return result.error();
+                if (result.error().code() == EINTR)
+                    continue;
+                if (result.error().code() == EAGAIN)
+                    break;
+                return result.error();
+            }
+            m_buffered_size += result.value().size();
+            break;
+        } while (true);
+        return {};
+    }
+
+    Handle<Stream> m_stream;
+    // Buffered data lives at [m_buffered_offset, m_buffered_offset + m_buffered_size).
+    ByteBuffer m_buffer;
+    size_t m_buffer_size { 0 };
+    size_t m_buffered_offset { 0 };
+    size_t m_buffered_size { 0 };
+};
 
 template<SeekableStreamLike T>
 class BufferedSeekable final : public SeekableStream {
@@ -5,7 +5,6 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/ByteReader.h>
 #include <AK/HashTable.h>
 #include <AK/JsonObject.h>
 #include <AK/JsonValue.h>
@@ -139,9 +138,14 @@ Optional<FlatPtr> Reader::peek_memory(FlatPtr address) const
         return {};
 
     FlatPtr offset_in_region = address - region->region_start;
-    auto* region_data = bit_cast<u8 const*>(image().program_header(region->program_header_index).raw_data());
+    auto program_header = image().program_header(region->program_header_index);
+    // Pages the process never touched are omitted from the coredump file
+    // (p_filesz < p_memsz) and read back as zeroes.
     FlatPtr value { 0 };
-    ByteReader::load(region_data + offset_in_region, value);
+    if (offset_in_region < program_header.size_in_image()) {
+        auto available_bytes = min(sizeof(FlatPtr), program_header.size_in_image() - offset_in_region);
+        memcpy(&value, bit_cast<u8 const*>(program_header.raw_data()) + offset_in_region, available_bytes);
+    }
     return value;
 }
 
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Types.h>
+#include <LibCrypto/CPUFeatures.h>
+
+#if ARCH(X86_64) && !defined(KERNEL)
+#    include <cpuid.h>
+
+namespace Crypto {
+
+static u32 cpuid_feature_flags_ecx()
+{
+    u32 eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        return 0;
+    return ecx;
+}
+
+static u32 cpuid_extended_feature_flags_ebx()
+{
+    u32 eax, ebx, ecx, edx;
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+        return 0;
+    return ebx;
+}
+
+bool is_aes_ni_supported()
+{
+    static bool supported = (cpuid_feature_flags_ecx() & (1u << 25)) != 0;
+    return supported;
+}
+
+bool is_carryless_multiply_supported()
+{
+    static bool supported = (cpuid_feature_flags_ecx() & (1u << 1)) != 0;
+    return supported;
+}
+
+bool is_sha_extensions_supported()
+{
+    // The SHA round instructions still need SSE4.1 for the state shuffling around them.
+    static bool supported = (cpuid_extended_feature_flags_ebx() & (1u << 29)) != 0
+        && (cpuid_feature_flags_ecx() & (1u << 19)) != 0;
+    return supported;
+}
+
+}
+
+#else
+
+namespace Crypto {
+
+bool is_aes_ni_supported()
+{
+    return false;
+}
+
+bool is_carryless_multiply_supported()
+{
+    return false;
+}
+
+bool is_sha_extensions_supported()
+{
+    return false;
+}
+
+}
+
+#endif
@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Platform.h>
+
+namespace Crypto {
+
+// Runtime CPU feature detection for the hand-vectorized cipher kernels.
+// The kernel compiles parts of LibCrypto too, but must not touch the SIMD
+// register state, so everything here reports false in kernel builds.
+
+bool is_aes_ni_supported();
+bool is_carryless_multiply_supported();
+bool is_sha_extensions_supported();
+
+}
@@ -5,9 +5,14 @@
  */
 
 #include <AK/StringBuilder.h>
+#include <LibCrypto/CPUFeatures.h>
 #include <LibCrypto/Cipher/AES.h>
 #include <LibCrypto/Cipher/AESTables.h>
 
+#if ARCH(X86_64) && !defined(KERNEL)
+#    include <immintrin.h>
+#endif
+
 namespace Crypto {
 namespace Cipher {
 
@@ -197,8 +202,47 @@ void AESCipherKey::expand_decrypt_key(ReadonlyBytes user_key, size_t bits)
     }
 }
 
+#if ARCH(X86_64) && !defined(KERNEL)
+// The expanded round keys are stored as big-endian u32 words, but the AES
+// instructions want them in the original byte order, so swap each word back.
+[[gnu::target("ssse3")]] static __m128i load_round_key(u32 const* round_keys)
+{
+    auto const word_swap_mask = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    return _mm_shuffle_epi8(_mm_loadu_si128((__m128i const*)round_keys), word_swap_mask);
+}
+
+[[gnu::target("aes,ssse3")]] static void encrypt_block_aes_ni(u32 const* round_keys, size_t rounds, u8 const* in, u8* out)
+{
+    auto state = _mm_xor_si128(_mm_loadu_si128((__m128i const*)in), load_round_key(round_keys));
+    for (size_t i = 1; i < rounds; ++i)
+        state = _mm_aesenc_si128(state, load_round_key(round_keys + 4 * i));
+    state = _mm_aesenclast_si128(state, load_round_key(round_keys + 4 * rounds));
+    _mm_storeu_si128((__m128i*)out, state);
+}
+
+// Note: expand_decrypt_key() already produces the "equivalent inverse cipher"
+// key schedule (reversed order, with the inverse mix-column applied to the
+// middle round keys), which is exactly what aesdec expects.
+[[gnu::target("aes,ssse3")]] static void decrypt_block_aes_ni(u32 const* round_keys, size_t rounds, u8 const* in, u8* out)
+{
+    auto state = _mm_xor_si128(_mm_loadu_si128((__m128i const*)in), load_round_key(round_keys));
+    for (size_t i = 1; i < rounds; ++i)
+        state = _mm_aesdec_si128(state, load_round_key(round_keys + 4 * i));
+    state = _mm_aesdeclast_si128(state, load_round_key(round_keys + 4 * rounds));
+    _mm_storeu_si128((__m128i*)out, state);
+}
+#endif
+
 void AESCipher::encrypt_block(AESCipherBlock const& in, AESCipherBlock& out)
 {
+#if ARCH(X86_64) && !defined(KERNEL)
+    if (is_aes_ni_supported()) {
+        auto const& enc_key = key();
+        encrypt_block_aes_ni(enc_key.round_keys(), enc_key.rounds(), in.bytes().data(), out.bytes().data());
+        return;
+    }
+#endif
+
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
     size_t r { 0 };
 
@@ -288,6 +332,14 @@ void AESCipher::encrypt_block(AESCipherBlock const& in, AESCipherBlock& out)
 
 void AESCipher::decrypt_block(AESCipherBlock const& in, AESCipherBlock& out)
 {
+#if ARCH(X86_64) && !defined(KERNEL)
+    if (is_aes_ni_supported()) {
+        auto const& dec_key = key();
+        decrypt_block_aes_ni(dec_key.round_keys(), dec_key.rounds(), in.bytes().data(), out.bytes().data());
+        return;
+    }
+#endif
+
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
     size_t r { 0 };
 
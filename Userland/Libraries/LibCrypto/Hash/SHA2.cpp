@@ -5,8 +5,13 @@
  */
 
 #include <AK/Types.h>
+#include <LibCrypto/CPUFeatures.h>
 #include <LibCrypto/Hash/SHA2.h>
 
+#if ARCH(X86_64) && !defined(KERNEL)
+#    include <immintrin.h>
+#endif
+
 namespace Crypto {
 namespace Hash {
 constexpr static auto ROTRIGHT(u32 a, size_t b) { return (a >> b) | (a << (32 - b)); }
@@ -25,8 +30,60 @@ constexpr static auto EP1(u64 x) { return ROTRIGHT(x, 14) ^ ROTRIGHT(x, 18) ^ RO
 constexpr static auto SIGN0(u64 x) { return ROTRIGHT(x, 1) ^ ROTRIGHT(x, 8) ^ (x >> 7); }
 constexpr static auto SIGN1(u64 x) { return ROTRIGHT(x, 19) ^ ROTRIGHT(x, 61) ^ (x >> 6); }
 
+#if ARCH(X86_64) && !defined(KERNEL)
+/// SHA-256 compression using the SHA extensions. The instructions work on two
+/// halves of the state kept in "ABEF" and "CDGH" order, so the state is
+/// shuffled into that layout on entry and back on exit; doing that once per
+/// update (rather than per block) is why this takes a block count.
+[[gnu::target("sha,sse4.1")]] static void transform_sha_ni(u32* state, u8 const* data, size_t block_count)
+{
+    auto const byte_swap_mask = _mm_set_epi64x(0x0c0d0e0f08090a0b, 0x0405060700010203);
+
+    auto abcd = _mm_shuffle_epi32(_mm_loadu_si128((__m128i const*)&state[0]), 0xb1); // CDAB
+    auto efgh = _mm_shuffle_epi32(_mm_loadu_si128((__m128i const*)&state[4]), 0x1b); // EFGH
+    auto state0 = _mm_alignr_epi8(abcd, efgh, 8);                                    // ABEF
+    auto state1 = _mm_blend_epi16(efgh, abcd, 0xf0);                                 // CDGH
+
+    for (size_t block = 0; block < block_count; ++block, data += 64) {
+        auto saved_state0 = state0;
+        auto saved_state1 = state1;
+
+        // w[i % 4] holds the four message words for round group i.
+        __m128i w[4];
+        for (size_t i = 0; i < 4; ++i)
+            w[i] = _mm_shuffle_epi8(_mm_loadu_si128((__m128i const*)(data + 16 * i)), byte_swap_mask);
+
+        for (size_t i = 0; i < 16; ++i) {
+            auto with_constants = _mm_add_epi32(w[i % 4], _mm_loadu_si128((__m128i const*)&SHA256Constants::RoundConstants[4 * i]));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, with_constants);
+            if (i < 12) {
+                // Extend the message schedule four words ahead.
+                auto tmp = _mm_alignr_epi8(w[(i + 3) % 4], w[(i + 2) % 4], 4);
+                w[i % 4] = _mm_sha256msg1_epu32(w[i % 4], w[(i + 1) % 4]);
+                w[i % 4] = _mm_add_epi32(w[i % 4], tmp);
+                w[i % 4] = _mm_sha256msg2_epu32(w[i % 4], w[(i + 3) % 4]);
+            }
+            state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(with_constants, 0x0e));
+        }
+
+        state0 = _mm_add_epi32(state0, saved_state0);
+        state1 = _mm_add_epi32(state1, saved_state1);
+    }
+
+    auto feba = _mm_shuffle_epi32(state0, 0x1b);
+    auto dchg = _mm_shuffle_epi32(state1, 0xb1);
+    _mm_storeu_si128((__m128i*)&state[0], _mm_blend_epi16(feba, dchg, 0xf0));
+    _mm_storeu_si128((__m128i*)&state[4], _mm_alignr_epi8(dchg, feba, 8));
+}
+#endif
+
 inline void SHA256::transform(u8 const* data)
 {
+#if ARCH(X86_64) && !defined(KERNEL)
+    if (is_sha_extensions_supported())
+        return transform_sha_ni(m_state, data, 1);
+#endif
+
     u32 m[64];
 
     size_t i = 0;
@@ -68,13 +125,37 @@ inline void SHA256::transform(u8 const* data)
 
 void SHA256::update(u8 const* message, size_t length)
 {
-    for (size_t i = 0; i < length; ++i) {
+    while (length > 0) {
         if (m_data_length == BlockSize) {
             transform(m_data_buffer);
             m_bit_length += 512;
             m_data_length = 0;
         }
-        m_data_buffer[m_data_length++] = message[i];
+
+        // Hash full blocks straight out of the caller's buffer instead of
+        // staging them through m_data_buffer.
+        if (m_data_length == 0 && length >= BlockSize) {
+            size_t block_count = length / BlockSize;
+#if ARCH(X86_64) && !defined(KERNEL)
+            if (is_sha_extensions_supported()) {
+                transform_sha_ni(m_state, message, block_count);
+            } else
+#endif
+            {
+                for (size_t i = 0; i < block_count; ++i)
+                    transform(message + i * BlockSize);
+            }
+            m_bit_length += block_count * 512;
+            message += block_count * BlockSize;
+            length -= block_count * BlockSize;
+            continue;
+        }
+
+        size_t to_copy = min(BlockSize - m_data_length, length);
+        __builtin_memcpy(m_data_buffer + m_data_length, message, to_copy);
+        m_data_length += to_copy;
+        message += to_copy;
+        length -= to_copy;
     }
 }
 
@@ -90,6 +171,14 @@ SHA256::DigestType SHA256::peek()
     DigestType digest;
     size_t i = m_data_length;
 
+    // make a local copy of the data as we modify it
+    u8 data[BlockSize];
+    u32 state[8];
+    __builtin_memcpy(data, m_data_buffer, m_data_length);
+    __builtin_memcpy(state, m_state, sizeof(state));
+    auto data_length = m_data_length;
+    auto bit_length = m_bit_length;
+
     if (BlockSize == m_data_length) {
         transform(m_data_buffer);
         m_bit_length += BlockSize * 8;
@@ -139,6 +228,11 @@ SHA256::DigestType SHA256::peek()
         digest.data[i + 24] = (m_state[6] >> (24 - i * 8)) & 0x000000ff;
         digest.data[i + 28] = (m_state[7] >> (24 - i * 8)) & 0x000000ff;
     }
+    // restore the data
+    __builtin_memcpy(m_data_buffer, data, data_length);
+    __builtin_memcpy(m_state, state, sizeof(state));
+    m_data_length = data_length;
+    m_bit_length = bit_length;
     return digest;
 }
 
@@ -208,6 +302,14 @@ SHA384::DigestType SHA384::peek()
     DigestType digest;
     size_t i = m_data_length;
 
+    // make a local copy of the data as we modify it
+    u8 data[BlockSize];
+    u64 state[8];
+    __builtin_memcpy(data, m_data_buffer, m_data_length);
+    __builtin_memcpy(state, m_state, sizeof(state));
+    auto data_length = m_data_length;
+    auto bit_length = m_bit_length;
+
     if (BlockSize == m_data_length) {
         transform(m_data_buffer);
         m_bit_length += BlockSize * 8;
@@ -264,6 +366,11 @@ SHA384::DigestType SHA384::peek()
         digest.data[i + 32] = (m_state[4] >> (56 - i * 8)) & 0x000000ff;
         digest.data[i + 40] = (m_state[5] >> (56 - i * 8)) & 0x000000ff;
     }
+    // restore the data
+    __builtin_memcpy(m_data_buffer, data, data_length);
+    __builtin_memcpy(m_state, state, sizeof(state));
+    m_data_length = data_length;
+    m_bit_length = bit_length;
     return digest;
 }
 
@@ -332,6 +439,14 @@ SHA512::DigestType SHA512::peek()
     DigestType digest;
     size_t i = m_data_length;
 
+    // make a local copy of the data as we modify it
+    u8 data[BlockSize];
+    u64 state[8];
+    __builtin_memcpy(data, m_data_buffer, m_data_length);
+    __builtin_memcpy(state, m_state, sizeof(state));
+    auto data_length = m_data_length;
+    auto bit_length = m_bit_length;
+
     if (BlockSize == m_data_length) {
         transform(m_data_buffer);
         m_bit_length += BlockSize * 8;
@@ -390,6 +505,11 @@ SHA512::DigestType SHA512::peek()
         digest.data[i + 48] = (m_state[6] >> (56 - i * 8)) & 0x000000ff;
         digest.data[i + 56] = (m_state[7] >> (56 - i * 8)) & 0x000000ff;
     }
+    // restore the data
+    __builtin_memcpy(m_data_buffer, data, data_length);
+    __builtin_memcpy(m_state, state, sizeof(state));
+    m_data_length = data_length;
+    m_bit_length = bit_length;
     return digest;
 }
 }
@@ -37,53 +37,109 @@ void Classic::process_impl(Signal const& input_signal, [[maybe_unused]] Signal&
     auto const& in = input_signal.get<RollNotes>();
     auto& output_samples = output_signal.get<FixedArray<Sample>>();
 
-    // Do this for every time step and set the signal accordingly.
-    for (size_t sample_index = 0; sample_index < output_samples.size(); ++sample_index) {
-        Sample& out = output_samples[sample_index];
-        out = {};
-        u32 sample_time = m_transport->time() + sample_index;
-
-        Array<Optional<PitchedEnvelope>, note_frequencies.size()> playing_envelopes;
-
+    u32 const start_time = m_transport->time();
+    u32 const attack_samples = m_attack * m_transport->ms_sample_rate();
+    u32 const decay_samples = m_decay * m_transport->ms_sample_rate();
+    u32 const release_samples = m_release * m_transport->ms_sample_rate();
+
+    for (auto& sample : output_samples)
+        sample = {};
+
+    // Process the block note-major: each playing note contributes to the
+    // entire block before we look at the next one. This keeps the note
+    // bookkeeping and the waveform dispatch out of the per-sample path, and
+    // lets the synthesis run as tight kernels over spans of samples.
+    for (u8 i = 0; i < note_frequencies.size(); ++i) {
         // "Press" the necessary notes in the internal representation,
-        // and "release" all of the others
-        for (u8 i = 0; i < note_frequencies.size(); ++i) {
-            if (auto maybe_note = in[i]; maybe_note.has_value())
-                m_playing_notes[i] = maybe_note;
-
-            if (m_playing_notes[i].has_value()) {
-                Envelope note_envelope = m_playing_notes[i]->to_envelope(sample_time, m_attack * m_transport->ms_sample_rate(), m_decay * m_transport->ms_sample_rate(), m_release * m_transport->ms_sample_rate());
-                // There are two conditions for removing notes:
-                // 1. The envelope has expired, regardless of whether the note was still given to us in the input.
-                if (!note_envelope.is_active()) {
-                    m_playing_notes[i] = {};
+        // and "release" all of the others.
+        if (auto maybe_note = in[i]; maybe_note.has_value())
+            m_playing_notes[i] = maybe_note;
+        if (!m_playing_notes[i].has_value())
+            continue;
+
+        auto note = *m_playing_notes[i];
+        auto envelope_at_start = note.to_envelope(start_time, attack_samples, decay_samples, release_samples);
+
+        if (!in[i].has_value()) {
+            // The envelope has expired (or the note never started playing),
+            // and the note is no longer given to us; drop it.
+            if (!envelope_at_start.is_active()) {
+                m_playing_notes[i] = {};
+                continue;
+            }
+            // The envelope has not expired, but the note was not given to us.
+            // This means that the note abruptly stopped playing; i.e. the audio infrastructure didn't know the length of the notes initially.
+            // That basically means we're dealing with a keyboard note. Chop its end time to end now.
+            if (!envelope_at_start.is_release()) {
+                note.off_sample = start_time;
+                m_playing_notes[i] = note;
+            }
+        }
+
+        for (size_t offset = 0; offset < output_samples.size() && m_playing_notes[i].has_value(); offset += synthesis_block_size) {
+            size_t const chunk_size = min(synthesis_block_size, output_samples.size() - offset);
+
+            // The envelope is evaluated into a volume kernel first...
+            Array<double, synthesis_block_size> volumes;
+            bool note_expired = false;
+            for (size_t j = 0; j < chunk_size; ++j) {
+                u32 sample_time = start_time + offset + j;
+                auto envelope = note.to_envelope(sample_time, attack_samples, decay_samples, release_samples);
+                if (!envelope.is_active()) {
+                    volumes[j] = 0;
+                    // Inactive either because the note hasn't started yet
+                    // (keep waiting) or because it has fully expired.
+                    if (sample_time >= note.on_sample) {
+                        note_expired = true;
+                        for (size_t k = j + 1; k < chunk_size; ++k)
+                            volumes[k] = 0;
+                        break;
+                    }
                     continue;
                 }
-                // 2. The envelope has not expired, but the note was not given to us.
-                //    This means that the note abruptly stopped playing; i.e. the audio infrastructure didn't know the length of the notes initially.
-                //    That basically means we're dealing with a keyboard note. Chop its end time to end now.
-                if (!note_envelope.is_release() && !in[i].has_value()) {
-                    // dbgln("note {} not released, setting release phase, envelope={}", i, note_envelope.envelope);
-                    note_envelope.set_release(0);
-                    auto real_note = *m_playing_notes[i];
-                    real_note.off_sample = sample_time;
-                    m_playing_notes[i] = real_note;
-                }
-
-                playing_envelopes[i] = PitchedEnvelope { note_envelope, i };
+                volumes[j] = volume_from_envelope(envelope);
             }
-        }
 
-        for (auto envelope : playing_envelopes) {
-            if (!envelope.has_value())
-                continue;
-            double volume = volume_from_envelope(*envelope);
-            double wave = wave_position(sample_time, envelope->note);
-            out += volume * wave;
+            // ...then the oscillator runs as one kernel per waveform...
+            Array<double, synthesis_block_size> waves;
+            fill_wave_samples(start_time + offset, i, waves.span().trim(chunk_size));
+
+            // ...and the two multiply-accumulate into the output.
+            for (size_t j = 0; j < chunk_size; ++j)
+                output_samples[offset + j] += volumes[j] * waves[j];
+
+            if (note_expired)
+                m_playing_notes[i] = {};
         }
     }
 }
 
+void Classic::fill_wave_samples(u32 start_time, u8 note, Span<double> out)
+{
+    switch (m_waveform) {
+    case Sine:
+        for (size_t i = 0; i < out.size(); ++i)
+            out[i] = sin_position(start_time + i, note);
+        break;
+    case Triangle:
+        for (size_t i = 0; i < out.size(); ++i)
+            out[i] = triangle_position(start_time + i, note);
+        break;
+    case Square:
+        for (size_t i = 0; i < out.size(); ++i)
+            out[i] = square_position(start_time + i, note);
+        break;
+    case Saw:
+        for (size_t i = 0; i < out.size(); ++i)
+            out[i] = saw_position(start_time + i, note);
+        break;
+    case Noise:
+        for (size_t i = 0; i < out.size(); ++i)
+            out[i] = noise_position(start_time + i, note);
+        break;
+    }
+}
+
 // Linear ADSR envelope with no peak adjustment.
 double Classic::volume_from_envelope(Envelope const& envelope) const
 {
@@ -104,23 +160,6 @@ double Classic::volume_from_envelope(Envelope const& envelope) const
     VERIFY_NOT_REACHED();
 }
 
-double Classic::wave_position(u32 sample_time, u8 note)
-{
-    switch (m_waveform) {
-    case Sine:
-        return sin_position(sample_time, note);
-    case Triangle:
-        return triangle_position(sample_time, note);
-    case Square:
-        return square_position(sample_time, note);
-    case Saw:
-        return saw_position(sample_time, note);
-    case Noise:
-        return noise_position(sample_time, note);
-    }
-    VERIFY_NOT_REACHED();
-}
-
 double Classic::samples_per_cycle(u8 note) const
 {
     return m_transport->sample_rate() / note_frequencies[note];
@@ -47,10 +47,14 @@ public:
     Waveform wave() const { return m_waveform.value(); }
 
 private:
+    // Synthesis runs in fixed-size spans so the envelope and oscillator
+    // kernels can work on whole blocks of samples at a time.
+    static constexpr size_t synthesis_block_size = 256;
+
     virtual void process_impl(Signal const&, Signal&) override;
 
     double volume_from_envelope(Envelope const&) const;
-    double wave_position(u32 sample_time, u8 note);
+    void fill_wave_samples(u32 start_time, u8 note, Span<double> out);
     double samples_per_cycle(u8 note) const;
     double sin_position(u32 sample_time, u8 note) const;
     double triangle_position(u32 sample_time, u8 note) const;
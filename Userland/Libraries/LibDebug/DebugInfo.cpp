@@ -21,11 +21,29 @@ DebugInfo::DebugInfo(ELF::Image const& elf, DeprecatedString source_root, FlatPt
     , m_base_address(base_address)
     , m_dwarf_info(m_elf)
 {
+}
+
+void DebugInfo::ensure_prepared() const
+{
+    if (m_prepared)
+        return;
+    m_prepared = true;
+
     prepare_variable_scopes();
     prepare_lines();
+
+    // Sort the function scopes by start address so get_containing_function()
+    // can binary search instead of scanning every scope.
+    for (size_t i = 0; i < m_scopes.size(); ++i) {
+        if (m_scopes[i].is_function)
+            m_sorted_function_scope_indices.append(i);
+    }
+    quick_sort(m_sorted_function_scope_indices, [this](auto a, auto b) {
+        return m_scopes[a].address_low < m_scopes[b].address_low;
+    });
 }
 
-void DebugInfo::prepare_variable_scopes()
+void DebugInfo::prepare_variable_scopes() const
 {
     m_dwarf_info.for_each_compilation_unit([&](Dwarf::CompilationUnit const& unit) {
         auto root = unit.root_die();
@@ -33,7 +51,7 @@ void DebugInfo::prepare_variable_scopes()
     });
 }
 
-void DebugInfo::parse_scopes_impl(Dwarf::DIE const& die)
+void DebugInfo::parse_scopes_impl(Dwarf::DIE const& die) const
 {
     die.for_each_child([&](Dwarf::DIE const& child) {
         if (child.is_null())
@@ -79,7 +97,7 @@ void DebugInfo::parse_scopes_impl(Dwarf::DIE const& die)
     });
 }
 
-void DebugInfo::prepare_lines()
+void DebugInfo::prepare_lines() const
 {
     Vector<Dwarf::LineProgram::LineInfo> all_lines;
     m_dwarf_info.for_each_compilation_unit([&all_lines](Dwarf::CompilationUnit const& unit) {
@@ -111,26 +129,41 @@ void DebugInfo::prepare_lines()
     quick_sort(m_sorted_lines, [](auto& a, auto& b) {
         return a.address < b.address;
     });
+
+    for (size_t i = 0; i < m_sorted_lines.size(); ++i)
+        m_lines_by_file_basename.ensure(LexicalPath::basename(m_sorted_lines[i].file)).append(i);
 }
 
 Optional<DebugInfo::SourcePosition> DebugInfo::get_source_position(FlatPtr target_address) const
 {
+    ensure_prepared();
+
     if (m_sorted_lines.is_empty())
         return {};
     if (target_address < m_sorted_lines[0].address)
         return {};
 
-    // TODO: We can do a binary search here
-    for (size_t i = 0; i < m_sorted_lines.size() - 1; ++i) {
-        if (m_sorted_lines[i + 1].address > target_address) {
-            return SourcePosition::from_line_info(m_sorted_lines[i]);
-        }
+    // Binary search for the last line whose address is not above the target address.
+    size_t low = 0;
+    size_t high = m_sorted_lines.size();
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (m_sorted_lines[mid].address <= target_address)
+            low = mid + 1;
+        else
+            high = mid;
     }
-    return {};
+
+    // Addresses past the last line are not part of any line's range.
+    if (low == m_sorted_lines.size())
+        return {};
+    return SourcePosition::from_line_info(m_sorted_lines[low - 1]);
 }
 
 Optional<DebugInfo::SourcePositionAndAddress> DebugInfo::get_address_from_source_position(DeprecatedString const& file, size_t line) const
 {
+    ensure_prepared();
+
     DeprecatedString file_path = file;
     if (!file_path.starts_with('/'))
         file_path = DeprecatedString::formatted("/{}", file_path);
@@ -142,8 +175,15 @@ Optional<DebugInfo::SourcePositionAndAddress> DebugInfo::get_address_from_source
         file_path = DeprecatedString::formatted("../{}", file_path);
     }
 
+    // Any entry whose file ends with file_path shares its basename, so we only
+    // have to look at the entries in that bucket instead of the whole line table.
+    auto bucket = m_lines_by_file_basename.find(LexicalPath::basename(file_path));
+    if (bucket == m_lines_by_file_basename.end())
+        return {};
+
     Optional<SourcePositionAndAddress> result;
-    for (auto const& line_entry : m_sorted_lines) {
+    for (auto index : bucket->value) {
+        auto const& line_entry = m_sorted_lines[index];
         if (!line_entry.file.ends_with(file_path))
             continue;
 
@@ -164,7 +204,10 @@ NonnullOwnPtrVector<DebugInfo::VariableInfo> DebugInfo::get_variables_in_current
 {
     NonnullOwnPtrVector<DebugInfo::VariableInfo> variables;
 
-    // TODO: We can store the scopes in a better data structure
+    ensure_prepared();
+
+    // Nested lexical blocks all contribute variables, so we have to visit every
+    // scope that contains the instruction pointer.
     for (auto const& scope : m_scopes) {
         FlatPtr ip;
 #if ARCH(I386)
@@ -362,16 +405,32 @@ DeprecatedString DebugInfo::name_of_containing_function(FlatPtr address) const
 
 Optional<DebugInfo::VariablesScope> DebugInfo::get_containing_function(FlatPtr address) const
 {
-    for (auto const& scope : m_scopes) {
-        if (!scope.is_function || address < scope.address_low || address >= scope.address_high)
-            continue;
-        return scope;
+    ensure_prepared();
+
+    // Binary search for the function scope with the largest start address that
+    // is not above the given address.
+    size_t low = 0;
+    size_t high = m_sorted_function_scope_indices.size();
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (m_scopes[m_sorted_function_scope_indices[mid]].address_low <= address)
+            low = mid + 1;
+        else
+            high = mid;
     }
-    return {};
+
+    if (low == 0)
+        return {};
+    auto const& scope = m_scopes[m_sorted_function_scope_indices[low - 1]];
+    if (address >= scope.address_high)
+        return {};
+    return scope;
 }
 
 Vector<DebugInfo::SourcePosition> DebugInfo::source_lines_in_scope(VariablesScope const& scope) const
 {
+    ensure_prepared();
+
     Vector<DebugInfo::SourcePosition> source_lines;
     for (auto const& line : m_sorted_lines) {
         if (line.address < scope.address_low)
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <AK/NonnullOwnPtrVector.h>
 #include <AK/NonnullRefPtr.h>
 #include <AK/Optional.h>
@@ -113,9 +114,10 @@ public:
     Optional<VariablesScope> get_containing_function(FlatPtr address) const;
 
 private:
-    void prepare_variable_scopes();
-    void prepare_lines();
-    void parse_scopes_impl(Dwarf::DIE const& die);
+    void ensure_prepared() const;
+    void prepare_variable_scopes() const;
+    void prepare_lines() const;
+    void parse_scopes_impl(Dwarf::DIE const& die) const;
     OwnPtr<VariableInfo> create_variable_info(Dwarf::DIE const& variable_die, PtraceRegisters const&, u32 address_offset = 0) const;
     static bool is_variable_tag_supported(Dwarf::EntryTag const& tag);
     void add_type_info_to_variable(Dwarf::DIE const& type_die, PtraceRegisters const& regs, DebugInfo::VariableInfo* parent_variable) const;
@@ -128,8 +130,15 @@ private:
     FlatPtr m_base_address { 0 };
     Dwarf::DwarfInfo m_dwarf_info;
 
-    Vector<VariablesScope> m_scopes;
-    Vector<Dwarf::LineProgram::LineInfo> m_sorted_lines;
+    // Building these indices requires walking every DIE and line program, so
+    // it is deferred until the first query that needs them.
+    mutable bool m_prepared { false };
+    mutable Vector<VariablesScope> m_scopes;
+    // Indices into m_scopes of function scopes, sorted by start address.
+    mutable Vector<size_t> m_sorted_function_scope_indices;
+    mutable Vector<Dwarf::LineProgram::LineInfo> m_sorted_lines;
+    // Indices into m_sorted_lines, bucketed by the basename of their file.
+    mutable HashMap<DeprecatedString, Vector<size_t>> m_lines_by_file_basename;
 };
 
 }
@@ -27,8 +27,6 @@ DwarfInfo::DwarfInfo(ELF::Image const& elf)
     m_debug_str_offsets_data = section_data(".debug_str_offsets"sv);
     m_debug_addr_data = section_data(".debug_addr"sv);
     m_debug_ranges_data = section_data(".debug_ranges"sv);
-
-    populate_compilation_units();
 }
 
 DwarfInfo::~DwarfInfo() = default;
@@ -41,8 +39,10 @@ ReadonlyBytes DwarfInfo::section_data(StringView section_name) const
     return section->bytes();
 }
 
-void DwarfInfo::populate_compilation_units()
+void DwarfInfo::populate_compilation_units() const
 {
+    m_populated_compilation_units = true;
+
     if (!m_debug_info_data.data())
         return;
 
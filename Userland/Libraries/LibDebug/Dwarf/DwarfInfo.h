@@ -54,7 +54,7 @@ public:
     Optional<DIE> get_cached_die_at_offset(FlatPtr) const;
 
 private:
-    void populate_compilation_units();
+    void populate_compilation_units() const;
     void build_cached_dies() const;
 
     ReadonlyBytes section_data(StringView section_name) const;
@@ -70,7 +70,10 @@ private:
     ReadonlyBytes m_debug_addr_data;
     ReadonlyBytes m_debug_ranges_data;
 
-    NonnullOwnPtrVector<Dwarf::CompilationUnit> m_compilation_units;
+    // Parsing the compilation units means decoding every line program up
+    // front, so it is deferred until someone actually iterates the units.
+    mutable NonnullOwnPtrVector<Dwarf::CompilationUnit> m_compilation_units;
+    mutable bool m_populated_compilation_units { false };
 
     struct DIERange {
         FlatPtr start_address { 0 };
@@ -92,6 +95,9 @@ private:
 template<typename Callback>
 void DwarfInfo::for_each_compilation_unit(Callback callback) const
 {
+    if (!m_populated_compilation_units)
+        populate_compilation_units();
+
     for (auto const& unit : m_compilation_units) {
         callback(unit);
     }
@@ -108,7 +108,7 @@ class LineProgram {
     AK_MAKE_NONMOVABLE(LineProgram);
 
 public:
-    explicit LineProgram(DwarfInfo& dwarf_info, InputMemoryStream& stream);
+    explicit LineProgram(DwarfInfo const& dwarf_info, InputMemoryStream& stream);
 
     struct LineInfo {
         FlatPtr address { 0 };
@@ -170,7 +170,7 @@ private:
     static constexpr u16 MIN_DWARF_VERSION = 3;
     static constexpr u16 MAX_DWARF_VERSION = 5;
 
-    DwarfInfo& m_dwarf_info;
+    DwarfInfo const& m_dwarf_info;
     InputMemoryStream& m_stream;
 
     size_t m_unit_offset { 0 };
@@ -15,6 +15,7 @@
 #include <AK/NonnullRefPtrVector.h>
 #include <AK/Platform.h>
 #include <AK/ScopeGuard.h>
+#include <AK/StringBuilder.h>
 #include <AK/Vector.h>
 #include <LibC/bits/pthread_integration.h>
 #include <LibC/link.h>
@@ -30,6 +31,7 @@
 #include <fcntl.h>
 #include <pthread.h>
 #include <string.h>
+#include <sys/stat.h>
 #include <sys/types.h>
 #include <syscall.h>
 
@@ -38,6 +40,10 @@ namespace ELF {
 static HashMap<DeprecatedString, NonnullRefPtr<ELF::DynamicLoader>> s_loaders;
 static DeprecatedString s_main_program_path;
 static OrderedHashMap<DeprecatedString, NonnullRefPtr<ELF::DynamicObject>> s_global_objects;
+// Cache of global symbol lookups; every library's relocations hash the same
+// popular symbols (memcpy and friends) through every loaded object otherwise.
+// Has to be invalidated whenever the set of global objects changes.
+static HashMap<DeprecatedString, Optional<DynamicObject::SymbolLookupResult>> s_symbol_lookup_cache;
 
 using EntryPointFunction = int (*)(int, char**, char**);
 using LibCExitFunction = void (*)(int);
@@ -67,6 +73,9 @@ static Result<void, DlErrorMessage> __dladdr(void* addr, Dl_info* info);
 
 Optional<DynamicObject::SymbolLookupResult> DynamicLinker::lookup_global_symbol(StringView name)
 {
+    if (auto cached = s_symbol_lookup_cache.get(name); cached.has_value())
+        return cached.value();
+
     Optional<DynamicObject::SymbolLookupResult> weak_result;
 
     auto symbol = DynamicObject::HashSymbol { name };
@@ -75,12 +84,15 @@ Optional<DynamicObject::SymbolLookupResult> DynamicLinker::lookup_global_symbol(
         auto res = lib.value->lookup_symbol(symbol);
         if (!res.has_value())
             continue;
-        if (res.value().bind == STB_GLOBAL)
+        if (res.value().bind == STB_GLOBAL) {
+            s_symbol_lookup_cache.set(name, res);
             return res;
+        }
         if (res.value().bind == STB_WEAK && !weak_result.has_value())
             weak_result = res;
         // We don't want to allow local symbols to be pulled in to other modules
     }
+    s_symbol_lookup_cache.set(name, weak_result);
     return weak_result;
 }
 
@@ -100,6 +112,7 @@ static Result<NonnullRefPtr<DynamicLoader>, DlErrorMessage> map_library(Deprecat
     // This actually maps the library at the intended and final place.
     auto main_library_object = loader->map();
     s_global_objects.set(filepath, *main_library_object);
+    s_symbol_lookup_cache.clear();
 
     return loader;
 }
@@ -165,6 +178,116 @@ static Vector<DeprecatedString> get_dependencies(DeprecatedString const& path)
     return dependencies;
 }
 
+// The library cache records, per main program, the full set of libraries that
+// ended up mapped on a previous run (in mapping order) along with their mtimes.
+// When it validates, startup can map the recorded set directly and skip the
+// recursive DT_NEEDED walk with its per-library path searches.
+// Note that relocation results are deliberately *not* recorded: load addresses
+// change between runs, so they would be stale by construction.
+static constexpr char const* s_library_cache_directory = "/tmp/.loader-cache";
+static constexpr auto s_library_cache_magic = "# SerenityOS loader cache v1"sv;
+
+static DeprecatedString library_cache_path_for(DeprecatedString const& main_program_path)
+{
+    return DeprecatedString::formatted("{}/{}", s_library_cache_directory, main_program_path.replace("/"sv, "%"sv, ReplaceMode::All));
+}
+
+static Optional<Vector<DeprecatedString>> read_library_cache(DeprecatedString const& main_program_path)
+{
+    // A custom LD_LIBRARY_PATH changes how library names resolve in ways the
+    // cache cannot see, so ignore it entirely in that case.
+    if (!s_ld_library_path.is_empty())
+        return {};
+
+    auto cache_path = library_cache_path_for(main_program_path);
+    int fd = open(cache_path.characters(), O_RDONLY | O_NOFOLLOW);
+    if (fd < 0)
+        return {};
+    ScopeGuard close_guard = [fd] { close(fd); };
+
+    struct stat cache_stat = {};
+    if (fstat(fd, &cache_stat) < 0)
+        return {};
+
+    // Refuse caches we do not exclusively own; anything else could be abused
+    // to redirect library loads.
+    if (cache_stat.st_uid != geteuid() || (cache_stat.st_mode & (S_IWGRP | S_IWOTH)) != 0)
+        return {};
+
+    auto buffer_or_error = ByteBuffer::create_uninitialized(cache_stat.st_size);
+    if (buffer_or_error.is_error())
+        return {};
+    auto buffer = buffer_or_error.release_value();
+    if (read(fd, buffer.data(), buffer.size()) != static_cast<ssize_t>(buffer.size()))
+        return {};
+
+    StringView contents { buffer.data(), buffer.size() };
+    auto lines = contents.split_view('\n');
+    if (lines.is_empty() || lines.first() != s_library_cache_magic)
+        return {};
+
+    Vector<DeprecatedString> libraries;
+    for (size_t i = 1; i < lines.size(); ++i) {
+        auto parts = lines[i].split_view('\t');
+        if (parts.size() != 2)
+            return {};
+
+        DeprecatedString library_path = parts[0];
+        auto recorded_mtime = parts[1].to_int<i64>();
+        if (!recorded_mtime.has_value())
+            return {};
+
+        struct stat library_stat = {};
+        if (stat(library_path.characters(), &library_stat) < 0)
+            return {};
+        if (static_cast<i64>(library_stat.st_mtime) != recorded_mtime.value())
+            return {};
+
+        // The first entry is the main program itself, which is already mapped.
+        if (i == 1) {
+            if (library_path != main_program_path)
+                return {};
+            continue;
+        }
+        libraries.append(move(library_path));
+    }
+    return libraries;
+}
+
+static void write_library_cache(DeprecatedString const& main_program_path)
+{
+    // Writing is best effort; a process that is not allowed to write (pledge,
+    // read-only /tmp) simply leaves the cache cold.
+    if (!s_ld_library_path.is_empty())
+        return;
+
+    if (mkdir(s_library_cache_directory, 0700) < 0 && errno != EEXIST)
+        return;
+
+    auto cache_path = library_cache_path_for(main_program_path);
+    // Recreate the file from scratch so we never follow a symlink planted at
+    // this path.
+    unlink(cache_path.characters());
+    int fd = open(cache_path.characters(), O_WRONLY | O_CREAT | O_EXCL, 0600);
+    if (fd < 0)
+        return;
+    ScopeGuard close_guard = [fd] { close(fd); };
+
+    StringBuilder builder;
+    builder.append(s_library_cache_magic);
+    builder.append('\n');
+    for (auto& object : s_global_objects) {
+        struct stat library_stat = {};
+        if (stat(object.key.characters(), &library_stat) < 0)
+            return;
+        builder.appendff("{}\t{}\n", object.key, static_cast<i64>(library_stat.st_mtime));
+    }
+
+    auto contents = builder.string_view();
+    if (write(fd, contents.characters_without_null_termination(), contents.length()) != static_cast<ssize_t>(contents.length()))
+        unlink(cache_path.characters());
+}
+
 static Result<void, DlErrorMessage> map_dependencies(DeprecatedString const& path)
 {
     VERIFY(path.starts_with('/'));
@@ -380,6 +503,7 @@ static Result<void, DlErrorMessage> link_main_library(DeprecatedString const& pa
         if (dynamic_object)
             s_global_objects.set(dynamic_object->filepath(), *dynamic_object);
     }
+    s_symbol_lookup_cache.clear();
 
     for (auto& loader : loaders) {
         bool success = loader.link(flags);
@@ -628,11 +752,31 @@ void ELF::DynamicLinker::linker_main(DeprecatedString&& main_program_path, int m
     }
     (void)result1.release_value();
 
-    auto result2 = map_dependencies(main_program_path);
-    if (result2.is_error()) {
-        warnln("{}", result2.error().text);
-        fflush(stderr);
-        _exit(1);
+    bool mapped_from_cache = false;
+    if (!is_secure) {
+        if (auto cached_libraries = read_library_cache(main_program_path); cached_libraries.has_value()) {
+            mapped_from_cache = true;
+            for (auto& library_path : cached_libraries.value()) {
+                auto result = map_library(library_path);
+                if (result.is_error()) {
+                    warnln("{}", result.error().text);
+                    fflush(stderr);
+                    _exit(1);
+                }
+            }
+        }
+    }
+
+    if (!mapped_from_cache) {
+        auto result2 = map_dependencies(main_program_path);
+        if (result2.is_error()) {
+            warnln("{}", result2.error().text);
+            fflush(stderr);
+            _exit(1);
+        }
+
+        if (!is_secure)
+            write_library_cache(main_program_path);
     }
 
     dbgln_if(DYNAMIC_LOAD_DEBUG, "loaded all dependencies");
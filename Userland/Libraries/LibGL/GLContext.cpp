@@ -136,40 +136,34 @@ void GLContext::gl_end()
 
     sync_device_config();
 
-    GPU::PrimitiveType primitive_type;
-    switch (m_current_draw_mode) {
+    m_rasterizer->draw_primitives(primitive_type_for_draw_mode(m_current_draw_mode), model_view_matrix(), projection_matrix(), m_vertex_list);
+    m_vertex_list.clear_with_capacity();
+}
+
+GPU::PrimitiveType GLContext::primitive_type_for_draw_mode(GLenum draw_mode)
+{
+    switch (draw_mode) {
     case GL_LINE_LOOP:
-        primitive_type = GPU::PrimitiveType::LineLoop;
-        break;
+        return GPU::PrimitiveType::LineLoop;
     case GL_LINE_STRIP:
-        primitive_type = GPU::PrimitiveType::LineStrip;
-        break;
+        return GPU::PrimitiveType::LineStrip;
     case GL_LINES:
-        primitive_type = GPU::PrimitiveType::Lines;
-        break;
+        return GPU::PrimitiveType::Lines;
     case GL_POINTS:
-        primitive_type = GPU::PrimitiveType::Points;
-        break;
+        return GPU::PrimitiveType::Points;
     case GL_TRIANGLES:
-        primitive_type = GPU::PrimitiveType::Triangles;
-        break;
+        return GPU::PrimitiveType::Triangles;
     case GL_TRIANGLE_STRIP:
     case GL_QUAD_STRIP:
-        primitive_type = GPU::PrimitiveType::TriangleStrip;
-        break;
+        return GPU::PrimitiveType::TriangleStrip;
     case GL_TRIANGLE_FAN:
     case GL_POLYGON:
-        primitive_type = GPU::PrimitiveType::TriangleFan;
-        break;
+        return GPU::PrimitiveType::TriangleFan;
     case GL_QUADS:
-        primitive_type = GPU::PrimitiveType::Quads;
-        break;
+        return GPU::PrimitiveType::Quads;
     default:
         VERIFY_NOT_REACHED();
     }
-
-    m_rasterizer->draw_primitives(primitive_type, model_view_matrix(), projection_matrix(), m_vertex_list);
-    m_vertex_list.clear_with_capacity();
 }
 
 GLenum GLContext::gl_get_error()
@@ -251,7 +251,7 @@ private:
     void append_to_listing(Args&&... args)
     {
         VERIFY(m_current_listing_index.has_value());
-        m_current_listing_index->listing.entries.empend(member, Listing::ArgumentsFor<member> { forward<Args>(args)... });
+        m_current_listing_index->listing.entries.append(Listing::FunctionsAndArgs { member, Listing::ArgumentsFor<member> { forward<Args>(args)... } });
     }
 
     Optional<ContextParameter> get_context_parameter(GLenum pname);
@@ -264,6 +264,7 @@ private:
     template<typename T>
     void get_material_param(Face face, GLenum pname, T* params);
 
+    static GPU::PrimitiveType primitive_type_for_draw_mode(GLenum);
     void invoke_list(size_t list_index);
     [[nodiscard]] bool should_append_to_listing() const { return m_current_listing_index.has_value(); }
     [[nodiscard]] bool should_execute_after_appending_to_listing() const { return m_current_listing_index.has_value() && m_current_listing_index->mode == GL_COMPILE_AND_EXECUTE; }
@@ -491,10 +492,31 @@ private:
         using ExtraSavedArguments = Variant<
             FloatMatrix4x4>;
 
+        // A glBegin()..glEnd() sequence whose vertices were assembled at
+        // glEndList() time, so replaying it hands the device a ready-made
+        // vertex list instead of re-executing the recorded calls. Vertices
+        // recorded before the sequence's first color or normal call inherit
+        // those attributes from the state current at replay time; they always
+        // form a prefix of the vertex list. Texture coordinates are not
+        // recorded in call lists and are always taken from current state.
+        struct VertexBatch {
+            GLenum mode { GL_TRIANGLES };
+            Vector<GPU::Vertex> vertices;
+            size_t vertices_inheriting_color { 0 };
+            size_t vertices_inheriting_normal { 0 };
+            Optional<FloatVector4> final_color;
+            Optional<FloatVector3> final_normal;
+        };
+
+        using Entry = Variant<FunctionsAndArgs, VertexBatch>;
+
         Vector<NonnullOwnPtr<ExtraSavedArguments>> saved_arguments;
-        Vector<FunctionsAndArgs> entries;
+        Vector<Entry> entries;
     };
 
+    void compile_listing(Listing&);
+    void execute_vertex_batch(Listing::VertexBatch const&);
+
     static constexpr size_t max_allowed_gl_call_depth { 128 };
     size_t m_gl_call_depth { 0 };
     Vector<Listing> m_listings;
@@ -104,10 +104,126 @@ void GLContext::gl_end_list()
     RETURN_WITH_ERROR_IF(m_in_draw_state, GL_INVALID_OPERATION);
     RETURN_WITH_ERROR_IF(!m_current_listing_index.has_value(), GL_INVALID_OPERATION);
 
+    compile_listing(m_current_listing_index->listing);
     m_listings[m_current_listing_index->index] = move(m_current_listing_index->listing);
     m_current_listing_index.clear();
 }
 
+void GLContext::compile_listing(Listing& listing)
+{
+    auto is_call_to = [](auto member_function, Listing::FunctionsAndArgs const& entry) {
+        using FunctionType = decltype(member_function);
+        return entry.function.template has<FunctionType>() && entry.function.template get<FunctionType>() == member_function;
+    };
+
+    Vector<Listing::Entry> compiled_entries;
+    compiled_entries.ensure_capacity(listing.entries.size());
+
+    size_t entry_index = 0;
+    while (entry_index < listing.entries.size()) {
+        auto* call = listing.entries[entry_index].get_pointer<Listing::FunctionsAndArgs>();
+
+        // Try to fold a glBegin()..glEnd() run consisting purely of vertex
+        // attribute calls into a single pre-assembled vertex batch. Runs
+        // containing anything else replay call by call, as before.
+        if (call && is_call_to(&GLContext::gl_begin, *call)) {
+            Listing::VertexBatch batch;
+            batch.mode = call->arguments.get<Tuple<GLenum>>().template get<0>();
+
+            Optional<FloatVector4> current_color;
+            Optional<FloatVector3> current_normal;
+            bool valid_run = batch.mode <= GL_POLYGON;
+            bool saw_end = false;
+
+            size_t run_index = entry_index + 1;
+            while (valid_run && run_index < listing.entries.size()) {
+                auto* run_call = listing.entries[run_index].get_pointer<Listing::FunctionsAndArgs>();
+                if (run_call == nullptr) {
+                    valid_run = false;
+                    break;
+                }
+                if (is_call_to(&GLContext::gl_end, *run_call)) {
+                    saw_end = true;
+                    ++run_index;
+                    break;
+                }
+                if (is_call_to(&GLContext::gl_vertex, *run_call)) {
+                    GPU::Vertex vertex {};
+                    run_call->arguments.get<Tuple<GLdouble, GLdouble, GLdouble, GLdouble>>().apply_as_args([&](GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+                        vertex.position = { static_cast<float>(x), static_cast<float>(y), static_cast<float>(z), static_cast<float>(w) };
+                    });
+                    if (current_color.has_value())
+                        vertex.color = *current_color;
+                    else
+                        ++batch.vertices_inheriting_color;
+                    if (current_normal.has_value())
+                        vertex.normal = *current_normal;
+                    else
+                        ++batch.vertices_inheriting_normal;
+                    batch.vertices.append(vertex);
+                } else if (is_call_to(&GLContext::gl_color, *run_call)) {
+                    run_call->arguments.get<Tuple<GLdouble, GLdouble, GLdouble, GLdouble>>().apply_as_args([&](GLdouble r, GLdouble g, GLdouble b, GLdouble a) {
+                        current_color = FloatVector4 { static_cast<float>(r), static_cast<float>(g), static_cast<float>(b), static_cast<float>(a) };
+                    });
+                } else if (is_call_to(&GLContext::gl_normal, *run_call)) {
+                    run_call->arguments.get<Tuple<GLfloat, GLfloat, GLfloat>>().apply_as_args([&](GLfloat nx, GLfloat ny, GLfloat nz) {
+                        current_normal = FloatVector3 { nx, ny, nz };
+                    });
+                } else {
+                    valid_run = false;
+                }
+                ++run_index;
+            }
+
+            if (valid_run && saw_end) {
+                batch.final_color = current_color;
+                batch.final_normal = current_normal;
+                compiled_entries.append(move(batch));
+                entry_index = run_index;
+                continue;
+            }
+        }
+
+        compiled_entries.append(move(listing.entries[entry_index]));
+        ++entry_index;
+    }
+
+    listing.entries = move(compiled_entries);
+}
+
+void GLContext::execute_vertex_batch(Listing::VertexBatch const& batch)
+{
+    // Mirrors gl_begin(), the recorded attribute and vertex calls, and
+    // gl_end(), using the vertex list prepared at glEndList() time.
+    RETURN_WITH_ERROR_IF(m_in_draw_state, GL_INVALID_OPERATION);
+
+    m_vertex_list.ensure_capacity(m_vertex_list.size() + batch.vertices.size());
+    for (size_t i = 0; i < batch.vertices.size(); ++i) {
+        auto vertex = batch.vertices[i];
+        if (i < batch.vertices_inheriting_color)
+            vertex.color = m_current_vertex_color;
+        if (i < batch.vertices_inheriting_normal)
+            vertex.normal = m_current_vertex_normal;
+        for (size_t j = 0; j < m_device_info.num_texture_units; ++j)
+            vertex.tex_coords[j] = m_current_vertex_tex_coord[j];
+        m_vertex_list.unchecked_append(vertex);
+    }
+
+    // Attribute calls in the run still update the current state for
+    // everything that comes after the batch.
+    if (batch.final_color.has_value())
+        m_current_vertex_color = *batch.final_color;
+    if (batch.final_normal.has_value())
+        m_current_vertex_normal = *batch.final_normal;
+
+    m_current_draw_mode = batch.mode;
+
+    sync_device_config();
+
+    m_rasterizer->draw_primitives(primitive_type_for_draw_mode(m_current_draw_mode), model_view_matrix(), projection_matrix(), m_vertex_list);
+    m_vertex_list.clear_with_capacity();
+}
+
 GLuint GLContext::gl_gen_lists(GLsizei range)
 {
     RETURN_VALUE_WITH_ERROR_IF(range <= 0, GL_INVALID_VALUE, 0);
@@ -151,16 +267,22 @@ void GLContext::invoke_list(size_t list_index)
 {
     auto& listing = m_listings[list_index - 1];
     for (auto& entry : listing.entries) {
-        entry.function.visit([&](auto& function) {
-            entry.arguments.visit([&](auto& arguments) {
-                auto apply = [&]<typename... Args>(Args&&... args) {
-                    if constexpr (requires { (this->*function)(forward<Args>(args)...); })
-                        (this->*function)(forward<Args>(args)...);
-                };
-
-                arguments.apply_as_args(apply);
+        entry.visit(
+            [&](Listing::FunctionsAndArgs& function_and_args) {
+                function_and_args.function.visit([&](auto& function) {
+                    function_and_args.arguments.visit([&](auto& arguments) {
+                        auto apply = [&]<typename... Args>(Args&&... args) {
+                            if constexpr (requires { (this->*function)(forward<Args>(args)...); })
+                                (this->*function)(forward<Args>(args)...);
+                        };
+
+                        arguments.apply_as_args(apply);
+                    });
+                });
+            },
+            [&](Listing::VertexBatch const& batch) {
+                execute_vertex_batch(batch);
             });
-        });
     }
 }
 
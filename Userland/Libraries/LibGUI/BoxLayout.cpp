@@ -24,7 +24,7 @@ BoxLayout::BoxLayout(Orientation orientation)
         "orientation", [this] { return m_orientation == Gfx::Orientation::Vertical ? "Vertical" : "Horizontal"; }, nullptr);
 }
 
-UISize BoxLayout::preferred_size() const
+UISize BoxLayout::calculated_preferred_size() const
 {
     VERIFY(m_owner);
 
@@ -86,7 +86,7 @@ UISize BoxLayout::preferred_size() const
     return { result_secondary, result_primary };
 }
 
-UISize BoxLayout::min_size() const
+UISize BoxLayout::calculated_min_size() const
 {
     VERIFY(m_owner);
 
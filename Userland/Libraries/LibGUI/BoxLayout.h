@@ -22,10 +22,12 @@ public:
     Gfx::Orientation orientation() const { return m_orientation; }
 
     virtual void run(Widget&) override;
-    virtual UISize preferred_size() const override;
-    virtual UISize min_size() const override;
 
 protected:
+    virtual UISize calculated_preferred_size() const override;
+    virtual UISize calculated_min_size() const override;
+
+
     explicit BoxLayout(Gfx::Orientation);
 
 private:
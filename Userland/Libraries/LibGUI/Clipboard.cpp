@@ -59,13 +59,12 @@ Clipboard::DataAndType Clipboard::fetch_data_and_type() const
     auto response = connection().get_clipboard_data();
     if (!response.data().is_valid())
         return {};
-    auto data = ByteBuffer::copy(response.data().data<void>(), response.data().size());
-    if (data.is_error())
-        return {};
+    return { response.data(), response.mime_type(), response.metadata().entries() };
+}
 
-    auto type = response.mime_type();
-    auto metadata = response.metadata().entries();
-    return { data.release_value(), type, metadata };
+DeprecatedString Clipboard::fetch_mime_type() const
+{
+    return connection().get_clipboard_mime_type();
 }
 
 RefPtr<Gfx::Bitmap> Clipboard::DataAndType::as_bitmap() const
@@ -101,6 +100,10 @@ RefPtr<Gfx::Bitmap> Clipboard::DataAndType::as_bitmap() const
     if (Gfx::determine_storage_format(bitmap_format) == Gfx::StorageFormat::Indexed8)
         return nullptr;
 
+    auto data = bytes();
+    if (data.size() < static_cast<size_t>(pitch.value()) * height.value() * scale.value())
+        return nullptr;
+
     // We won't actually write to the clipping_bitmap, so casting away the const is okay.
     auto clipping_data = const_cast<u8*>(data.data());
     auto clipping_bitmap_or_error = Gfx::Bitmap::try_create_wrapper(bitmap_format, { (int)width.value(), (int)height.value() }, scale.value(), pitch.value(), clipping_data);
@@ -7,10 +7,10 @@
 
 #pragma once
 
-#include <AK/ByteBuffer.h>
 #include <AK/DeprecatedString.h>
 #include <AK/Function.h>
 #include <AK/HashMap.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibGUI/Forward.h>
 #include <LibGfx/Forward.h>
 
@@ -29,10 +29,21 @@ public:
     };
 
     struct DataAndType {
-        ByteBuffer data;
+        // The payload stays in the clipboard server's shared buffer; fetching
+        // maps it read-only instead of copying it through the IPC socket.
+        Core::AnonymousBuffer buffer;
         DeprecatedString mime_type;
         HashMap<DeprecatedString, DeprecatedString> metadata;
 
+        // A view of the shared pages, valid as long as this DataAndType is
+        // alive. Consumers that need the data to outlive it must copy.
+        ReadonlyBytes bytes() const
+        {
+            if (!buffer.is_valid())
+                return {};
+            return { buffer.data<u8>(), buffer.size() };
+        }
+
         RefPtr<Gfx::Bitmap> as_bitmap() const;
     };
 
@@ -40,7 +51,7 @@ public:
     static Clipboard& the();
 
     DataAndType fetch_data_and_type() const;
-    DeprecatedString fetch_mime_type() const { return fetch_data_and_type().mime_type; }
+    DeprecatedString fetch_mime_type() const;
 
     void set_data(ReadonlyBytes data, DeprecatedString const& mime_type = "text/plain", HashMap<DeprecatedString, DeprecatedString> const& metadata = {});
     void set_plain_text(DeprecatedString const& text) { set_data(text.bytes()); }
@@ -11,14 +11,17 @@
 #include <AK/QuickSort.h>
 #include <AK/StringBuilder.h>
 #include <LibCore/DirIterator.h>
+#include <LibCore/Directory.h>
 #include <LibCore/File.h>
 #include <LibCore/StandardPaths.h>
+#include <LibCore/System.h>
 #include <LibGUI/AbstractView.h>
 #include <LibGUI/FileIconProvider.h>
 #include <LibGUI/FileSystemModel.h>
 #include <LibGUI/Painter.h>
 #include <LibGfx/Bitmap.h>
-#include <LibThreading/BackgroundAction.h>
+#include <LibGfx/QOIWriter.h>
+#include <LibThreading/AsyncFile.h>
 #include <grp.h>
 #include <pwd.h>
 #include <stdio.h>
@@ -631,8 +634,39 @@ Icon FileSystemModel::icon_for(Node const& node) const
 
 static HashMap<DeprecatedString, RefPtr<Gfx::Bitmap>> s_thumbnail_cache;
 
+// Thumbnails are also cached on disk, shared by every application that uses
+// FileSystemModel. The cache is keyed by the source file's device, inode,
+// modification time and size, so an edited or replaced image never serves a
+// stale entry. QOI keeps the encode and decode on the render path cheap.
+static ErrorOr<DeprecatedString> disk_cache_path_for_thumbnail(struct stat const& st)
+{
+    auto cache_directory = DeprecatedString::formatted("{}/thumbnails", Core::StandardPaths::data_directory());
+    TRY(Core::Directory::create(cache_directory, Core::Directory::CreateDirectories::Yes));
+    return DeprecatedString::formatted("{}/{:x}-{:x}-{:x}-{:x}.qoi", cache_directory, (u64)st.st_dev, (u64)st.st_ino, (u64)st.st_mtime, (u64)st.st_size);
+}
+
+static ErrorOr<void> save_thumbnail_to_disk_cache(DeprecatedString const& cache_path, Gfx::Bitmap const& thumbnail)
+{
+    // Write to a temporary file first and atomically move it into place, so a
+    // concurrent reader (we run on the I/O pool, and other applications share
+    // the cache) never sees a partially written thumbnail.
+    static Atomic<u32> next_temporary_id;
+    auto temporary_path = DeprecatedString::formatted("{}.{}-{}.tmp", cache_path, getpid(), next_temporary_id.fetch_add(1));
+    auto file = TRY(Core::Stream::File::open(temporary_path, Core::Stream::OpenMode::Write));
+    TRY(file->write_entire_buffer(Gfx::QOIWriter::encode(thumbnail)));
+    TRY(Core::System::rename(temporary_path, cache_path));
+    return {};
+}
+
 static ErrorOr<NonnullRefPtr<Gfx::Bitmap>> render_thumbnail(StringView path)
 {
+    auto st = TRY(Core::System::stat(path));
+    auto cache_path_or_error = disk_cache_path_for_thumbnail(st);
+    if (!cache_path_or_error.is_error()) {
+        if (auto cached = Gfx::Bitmap::try_load_from_file(cache_path_or_error.value()); !cached.is_error())
+            return cached.release_value();
+    }
+
     auto bitmap = TRY(Gfx::Bitmap::try_load_from_file(path));
     auto thumbnail = TRY(Gfx::Bitmap::try_create(Gfx::BitmapFormat::BGRA8888, { 32, 32 }));
 
@@ -641,6 +675,11 @@ static ErrorOr<NonnullRefPtr<Gfx::Bitmap>> render_thumbnail(StringView path)
 
     Painter painter(thumbnail);
     painter.draw_scaled_bitmap(destination, *bitmap, bitmap->rect());
+
+    if (!cache_path_or_error.is_error()) {
+        if (auto result = save_thumbnail_to_disk_cache(cache_path_or_error.value(), *thumbnail); result.is_error())
+            dbgln("FileSystemModel: Failed to cache thumbnail for {}: {}", path, result.error());
+    }
     return thumbnail;
 }
 
@@ -665,8 +704,8 @@ bool FileSystemModel::fetch_thumbnail_for(Node const& node)
 
     auto weak_this = make_weak_ptr();
 
-    (void)Threading::BackgroundAction<ErrorOr<NonnullRefPtr<Gfx::Bitmap>>>::construct(
-        [path](auto&) {
+    Threading::AsyncFile::run<ErrorOr<NonnullRefPtr<Gfx::Bitmap>>>(
+        [path] {
             return render_thumbnail(path);
         },
 
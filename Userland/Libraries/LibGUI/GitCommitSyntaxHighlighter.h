@@ -20,6 +20,7 @@ public:
     virtual Optional<StringView> comment_prefix() const override { return {}; }
     virtual Optional<StringView> comment_suffix() const override { return {}; }
     virtual void rehighlight(Palette const&) override;
+    virtual OwnPtr<Syntax::Highlighter> clone() const override { return make<GitCommitSyntaxHighlighter>(); }
 
 protected:
     virtual Vector<MatchingTokenPair> matching_token_pairs_impl() const override;
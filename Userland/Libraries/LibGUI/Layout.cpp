@@ -40,11 +40,32 @@ Layout::Layout()
 
 Layout::~Layout() = default;
 
+UISize Layout::preferred_size() const
+{
+    if (!m_cached_preferred_size.has_value())
+        m_cached_preferred_size = calculated_preferred_size();
+    return m_cached_preferred_size.value();
+}
+
+UISize Layout::min_size() const
+{
+    if (!m_cached_min_size.has_value())
+        m_cached_min_size = calculated_min_size();
+    return m_cached_min_size.value();
+}
+
+void Layout::invalidate_cached_sizes()
+{
+    m_cached_preferred_size.clear();
+    m_cached_min_size.clear();
+}
+
 void Layout::notify_adopted(Badge<Widget>, Widget& widget)
 {
     if (m_owner == &widget)
         return;
     m_owner = widget;
+    invalidate_cached_sizes();
     m_owner->for_each_child_widget([&](Widget& child) {
         add_widget(child);
         return IterationDecision::Continue;
@@ -56,11 +77,13 @@ void Layout::notify_disowned(Badge<Widget>, Widget& widget)
     VERIFY(m_owner == &widget);
     m_owner.clear();
     m_entries.clear();
+    invalidate_cached_sizes();
 }
 
 ErrorOr<void> Layout::try_add_entry(Entry&& entry)
 {
     TRY(m_entries.try_append(move(entry)));
+    invalidate_cached_sizes();
     if (m_owner)
         m_owner->notify_layout_changed({});
     return {};
@@ -112,6 +135,7 @@ ErrorOr<void> Layout::try_insert_widget_before(Widget& widget, Widget& before_wi
     TRY(m_entries.try_insert_before_matching(move(entry), [&](auto& existing_entry) {
         return existing_entry.type == Entry::Type::Widget && existing_entry.widget.ptr() == &before_widget;
     }));
+    invalidate_cached_sizes();
     if (m_owner)
         m_owner->notify_layout_changed({});
     return {};
@@ -127,6 +151,7 @@ void Layout::remove_widget(Widget& widget)
     m_entries.remove_first_matching([&](auto& entry) {
         return entry.widget == &widget;
     });
+    invalidate_cached_sizes();
     if (m_owner)
         m_owner->notify_layout_changed({});
 }
@@ -136,6 +161,7 @@ void Layout::set_spacing(int spacing)
     if (m_spacing == spacing)
         return;
     m_spacing = spacing;
+    invalidate_cached_sizes();
     if (m_owner)
         m_owner->notify_layout_changed({});
 }
@@ -145,6 +171,7 @@ void Layout::set_margins(Margins const& margins)
     if (m_margins == margins)
         return;
     m_margins = margins;
+    invalidate_cached_sizes();
     if (m_owner)
         m_owner->notify_layout_changed({});
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Optional.h>
 #include <AK/OwnPtr.h>
 #include <AK/Vector.h>
 #include <AK/WeakPtr.h>
@@ -49,8 +50,11 @@ public:
     void remove_widget(Widget&);
 
     virtual void run(Widget&) = 0;
-    virtual UISize preferred_size() const = 0;
-    virtual UISize min_size() const = 0;
+    UISize preferred_size() const;
+    UISize min_size() const;
+
+    // Drops the cached preferred/min size so the next query recomputes them.
+    void invalidate_cached_sizes();
 
     void notify_adopted(Badge<Widget>, Widget&);
     void notify_disowned(Badge<Widget>, Widget&);
@@ -64,6 +68,9 @@ public:
 protected:
     Layout();
 
+    virtual UISize calculated_preferred_size() const = 0;
+    virtual UISize calculated_min_size() const = 0;
+
     struct Entry {
         enum class Type {
             Invalid = 0,
@@ -84,6 +91,10 @@ protected:
 
     Margins m_margins;
     int m_spacing { 3 };
+
+private:
+    mutable Optional<UISize> m_cached_preferred_size;
+    mutable Optional<UISize> m_cached_min_size;
 };
 
 }
@@ -180,8 +180,20 @@ void SortingProxyModel::sort_mapping(Mapping& mapping, int column, SortOrder sor
     for (int i = 0; i < row_count; ++i)
         mapping.source_rows[i] = i;
 
+    // Fetch and normalize each row's sort key up front. Comparing through
+    // the source model would do two data() calls (and, for strings, two
+    // lowercase copies) per comparison, which adds up fast on large models.
+    Vector<Variant> sort_keys;
+    sort_keys.ensure_capacity(row_count);
+    for (int i = 0; i < row_count; ++i) {
+        auto key = source().index(i, column, mapping.source_parent).data(m_sort_role);
+        if (key.is_string())
+            key = key.as_string().to_lowercase();
+        sort_keys.unchecked_append(move(key));
+    }
+
     quick_sort(mapping.source_rows, [&](auto row1, auto row2) -> bool {
-        bool is_less_than = less_than(source().index(row1, column, mapping.source_parent), source().index(row2, column, mapping.source_parent));
+        bool is_less_than = sort_keys[row1] < sort_keys[row2];
         return sort_order == SortOrder::Ascending ? is_less_than : !is_less_than;
     });
 
@@ -49,6 +49,10 @@ bool TextDocument::set_text(StringView text, AllowCallback allow_callback)
         set_text({});
     });
 
+    // Reserving the line list up front keeps large documents from repeatedly
+    // reallocating it as the lines come in.
+    m_lines.ensure_capacity(text.count("\n"sv) + 1);
+
     size_t start_of_current_line = 0;
 
     auto add_line = [&](size_t current_position) -> bool {
@@ -183,13 +187,33 @@ bool TextDocumentLine::set_text(TextDocument& document, StringView text)
         clear(document);
         return true;
     }
-    m_text.clear();
+    m_text.clear_with_capacity();
+
+    // All-ASCII text (the common case for e.g. source files and logs) is
+    // trivially valid UTF-8 with one code point per byte, so it can be widened
+    // directly without going through the UTF-8 decoder.
+    bool is_ascii = true;
+    for (auto byte : text.bytes()) {
+        if (byte & 0x80) {
+            is_ascii = false;
+            break;
+        }
+    }
+    if (is_ascii) {
+        m_text.ensure_capacity(text.length());
+        for (auto byte : text.bytes())
+            m_text.unchecked_append(byte);
+        document.update_views({});
+        return true;
+    }
+
     Utf8View utf8_view(text);
     if (!utf8_view.validate()) {
         return false;
     }
+    m_text.ensure_capacity(utf8_view.length());
     for (auto code_point : utf8_view)
-        m_text.append(code_point);
+        m_text.unchecked_append(code_point);
     document.update_views({});
     return true;
 }
@@ -66,6 +66,7 @@ public:
     TextDocumentLine& line(size_t line_index) { return m_lines[line_index]; }
 
     void set_spans(u32 span_collection_index, Vector<TextDocumentSpan> spans);
+    Vector<TextDocumentSpan> const& span_collection(u32 span_collection_index) { return m_span_collections.ensure(span_collection_index); }
 
     bool set_text(StringView, AllowCallback = AllowCallback::Yes);
 
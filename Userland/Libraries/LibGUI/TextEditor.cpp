@@ -32,6 +32,7 @@
 #include <LibGfx/Palette.h>
 #include <LibGfx/StandardCursor.h>
 #include <LibSyntax/Highlighter.h>
+#include <LibThreading/BackgroundAction.h>
 #include <fcntl.h>
 #include <stdio.h>
 #include <unistd.h>
@@ -1664,14 +1665,15 @@ void TextEditor::paste()
     if (!is_editable())
         return;
 
-    auto [data, mime_type, _] = GUI::Clipboard::the().fetch_data_and_type();
-    if (!mime_type.starts_with("text/"sv))
+    auto data_and_type = GUI::Clipboard::the().fetch_data_and_type();
+    if (!data_and_type.mime_type.starts_with("text/"sv))
         return;
 
+    StringView data { data_and_type.bytes() };
     if (data.is_empty())
         return;
 
-    dbgln_if(TEXTEDITOR_DEBUG, "Paste: \"{}\"", DeprecatedString::copy(data));
+    dbgln_if(TEXTEDITOR_DEBUG, "Paste: \"{}\"", data);
 
     TemporaryChange change(m_automatic_indentation_enabled, false);
     insert_at_cursor_or_replace_selection(data);
@@ -2125,11 +2127,115 @@ void TextEditor::rehighlight_if_needed()
     force_rehighlight();
 }
 
+// Documents below this size are cheap enough to rehighlight synchronously.
+static constexpr size_t background_rehighlight_line_threshold = 1000;
+
 void TextEditor::force_rehighlight()
 {
-    if (m_highlighter)
-        m_highlighter->rehighlight(palette());
     m_needs_rehighlight = false;
+    if (!m_highlighter)
+        return;
+
+    if (m_background_rehighlight_in_progress) {
+        // The running job is lexing text that is already stale; go again as
+        // soon as it completes.
+        m_background_rehighlight_queued = true;
+        return;
+    }
+
+    OwnPtr<Syntax::Highlighter> background_highlighter;
+    if (document().line_count() >= background_rehighlight_line_threshold)
+        background_highlighter = m_highlighter->clone();
+    if (!background_highlighter) {
+        m_highlighter->rehighlight(palette());
+        return;
+    }
+
+    m_background_rehighlight_in_progress = true;
+
+    auto snapshot_client = make<Syntax::SnapshotHighlighterClient>(text());
+    background_highlighter->attach(*snapshot_client);
+    auto palette_impl = palette().impl().clone();
+
+    (void)Threading::BackgroundAction<Syntax::BackgroundHighlightResult>::construct(
+        [background_highlighter = move(background_highlighter), snapshot_client = move(snapshot_client), palette_impl = move(palette_impl)](auto&) mutable {
+            background_highlighter->rehighlight(Gfx::Palette { *palette_impl });
+            Syntax::BackgroundHighlightResult result {
+                snapshot_client->take_spans(),
+                background_highlighter->nested_token_pairs(),
+            };
+            background_highlighter->detach();
+            return result;
+        },
+        [weak_this = make_weak_ptr<TextEditor>()](auto result) {
+            if (weak_this)
+                weak_this->background_rehighlight_did_complete(move(result));
+        });
+}
+
+void TextEditor::background_rehighlight_did_complete(Syntax::BackgroundHighlightResult result)
+{
+    m_background_rehighlight_in_progress = false;
+    if (!m_highlighter)
+        return;
+
+    if (m_background_rehighlight_queued || m_needs_rehighlight) {
+        // The document changed while the job was running, so these spans no
+        // longer match the text.
+        m_background_rehighlight_queued = false;
+        force_rehighlight();
+        return;
+    }
+
+    m_highlighter->register_nested_token_pairs(move(result.nested_token_pairs));
+
+    auto spans_equal = [](TextDocumentSpan const& a, TextDocumentSpan const& b) {
+        return a.range == b.range && a.data == b.data && a.is_skippable == b.is_skippable
+            && a.attributes.color == b.attributes.color
+            && a.attributes.background_color == b.attributes.background_color
+            && a.attributes.underline == b.attributes.underline
+            && a.attributes.bold == b.attributes.bold
+            && a.attributes.underline_color == b.attributes.underline_color
+            && a.attributes.underline_style == b.attributes.underline_style;
+    };
+
+    // Diff the new spans against the previous ones so we only have to repaint
+    // the lines whose highlighting actually changed.
+    auto& spans = result.spans;
+    auto const& old_spans = document().span_collection(Syntax::HighlighterClient::span_collection_index);
+    size_t common_prefix_length = 0;
+    while (common_prefix_length < old_spans.size() && common_prefix_length < spans.size()
+        && spans_equal(old_spans[common_prefix_length], spans[common_prefix_length]))
+        ++common_prefix_length;
+
+    if (common_prefix_length == old_spans.size() && common_prefix_length == spans.size())
+        return;
+
+    size_t common_suffix_length = 0;
+    while (common_suffix_length < old_spans.size() - common_prefix_length
+        && common_suffix_length < spans.size() - common_prefix_length
+        && spans_equal(old_spans[old_spans.size() - common_suffix_length - 1], spans[spans.size() - common_suffix_length - 1]))
+        ++common_suffix_length;
+
+    size_t first_changed_line = NumericLimits<size_t>::max();
+    size_t last_changed_line = 0;
+    auto include_changed_spans = [&](auto const& changed_spans) {
+        if (common_prefix_length + common_suffix_length >= changed_spans.size())
+            return;
+        first_changed_line = min(first_changed_line, changed_spans[common_prefix_length].range.start().line());
+        last_changed_line = max(last_changed_line, changed_spans[changed_spans.size() - common_suffix_length - 1].range.end().line());
+    };
+    include_changed_spans(old_spans);
+    include_changed_spans(spans);
+
+    document().set_spans(Syntax::HighlighterClient::span_collection_index, move(spans));
+
+    if (first_changed_line > last_changed_line) {
+        update();
+        return;
+    }
+    last_changed_line = min(last_changed_line, line_count() - 1);
+    update(line_widget_rect(first_changed_line).united(line_widget_rect(last_changed_line)));
 }
 
 Syntax::Highlighter const* TextEditor::syntax_highlighter() const
@@ -350,6 +350,7 @@ private:
     void recompute_all_visual_lines();
     void ensure_cursor_is_valid();
     void rehighlight_if_needed();
+    void background_rehighlight_did_complete(Syntax::BackgroundHighlightResult);
 
     size_t visual_line_containing(size_t line_index, size_t column) const;
     void recompute_visual_lines(size_t line_index);
@@ -382,6 +383,8 @@ private:
     bool m_ruler_visible { false };
     bool m_gutter_visible { false };
     bool m_needs_rehighlight { false };
+    bool m_background_rehighlight_in_progress { false };
+    bool m_background_rehighlight_queued { false };
     bool m_automatic_indentation_enabled { false };
     WrappingMode m_wrapping_mode { WrappingMode::NoWrap };
     bool m_visualize_trailing_whitespace { true };
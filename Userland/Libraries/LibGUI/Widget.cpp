@@ -201,6 +201,10 @@ Widget::~Widget() = default;
 
 void Widget::layout_relevant_change_occurred()
 {
+    // Anything that changes this widget's layout also invalidates the sizes
+    // that the enclosing layouts have computed and cached for it.
+    if (m_layout)
+        m_layout->invalidate_cached_sizes();
     if (auto* parent = parent_widget())
         parent->layout_relevant_change_occurred();
     else if (window())
@@ -422,30 +426,47 @@ void Widget::set_layout(NonnullRefPtr<Layout> layout)
     if (m_layout) {
         add_child(*m_layout);
         m_layout->notify_adopted({}, *this);
-        do_layout();
     } else {
         update();
     }
     layout_relevant_change_occurred();
 }
 
+static unsigned s_layout_pass = 0;
+static unsigned s_layout_pass_nesting = 0;
+
 void Widget::do_layout()
 {
+    // Each widget only needs a single visit per relayout: running our own
+    // layout resizes the children, and the resulting resize events lay out
+    // every child whose size actually changed right away.
+    if (s_layout_pass_nesting == 0)
+        ++s_layout_pass;
+    ++s_layout_pass_nesting;
+    ScopeGuard nesting_guard = [] { --s_layout_pass_nesting; };
+
+    if (m_last_layout_pass == s_layout_pass)
+        return;
+    m_last_layout_pass = s_layout_pass;
+
+    custom_layout();
+    if (m_layout) {
+        m_layout->run(*this);
+        did_layout();
+        update();
+    }
+
+    // Children whose size did not change still have to be visited.
     for_each_child_widget([&](auto& child) {
-        child.do_layout();
+        if (child.m_last_layout_pass != s_layout_pass)
+            child.do_layout();
         return IterationDecision::Continue;
     });
-    custom_layout();
-    if (!m_layout)
-        return;
-    m_layout->run(*this);
-    did_layout();
-    update();
 }
 
 void Widget::notify_layout_changed(Badge<Layout>)
 {
-    invalidate_layout();
+    layout_relevant_change_occurred();
 }
 
 void Widget::handle_resize_event(ResizeEvent& event)
@@ -882,8 +903,7 @@ Optional<UISize> Widget::calculated_min_size() const
 
 void Widget::invalidate_layout()
 {
-    if (window())
-        window()->schedule_relayout();
+    layout_relevant_change_occurred();
 }
 
 void Widget::set_visible(bool visible)
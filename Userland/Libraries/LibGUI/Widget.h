@@ -455,6 +455,8 @@ private:
     bool m_accepts_command_palette { true };
     bool m_default_font { true };
 
+    unsigned m_last_layout_pass { 0 };
+
     NonnullRefPtr<Gfx::PaletteImpl> m_palette;
     DeprecatedString m_title { DeprecatedString::empty() };
 
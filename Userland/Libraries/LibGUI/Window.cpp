@@ -401,7 +401,7 @@ void Window::handle_multi_paint_event(MultiPaintEvent& event)
         // It's possible that there had been some calls to update() that
         // haven't been flushed. We can handle these right now, avoiding
         // another round trip.
-        rects.extend(move(m_pending_paint_event_rects));
+        rects.extend(m_pending_paint_event_rects.take_rects());
     }
     VERIFY(!rects.is_empty());
     if (m_back_store && m_back_store->size() != event.window_size()) {
@@ -438,6 +438,13 @@ void Window::handle_multi_paint_event(MultiPaintEvent& event)
     if (rect.is_empty() || created_new_backing_store) {
         rects.clear();
         rects.append({ {}, event.window_size() });
+    } else if (rects.size() > 1) {
+        // Coalesce the dirty rects into a disjoint set before painting:
+        // the server's damage rects and our own still-pending updates often
+        // overlap, and each rect costs a full pass over the widget tree.
+        Gfx::DisjointIntRectSet coalesced;
+        coalesced.add_many(rects);
+        rects = coalesced.take_rects();
     }
 
     for (auto& rect : rects) {
@@ -518,7 +525,7 @@ void Window::handle_resize_event(ResizeEvent& event)
         m_back_store = nullptr;
     if (!m_pending_paint_event_rects.is_empty()) {
         m_pending_paint_event_rects.clear_with_capacity();
-        m_pending_paint_event_rects.append({ {}, new_size });
+        m_pending_paint_event_rects.add({ {}, new_size });
     }
     m_rect_when_windowless.set_size(new_size);
     if (m_main_widget)
@@ -743,22 +750,20 @@ void Window::update(Gfx::IntRect const& a_rect)
     if (!is_visible())
         return;
 
-    for (auto& pending_rect : m_pending_paint_event_rects) {
-        if (pending_rect.contains(a_rect)) {
-            dbgln_if(UPDATE_COALESCING_DEBUG, "Ignoring {} since it's contained by pending rect {}", a_rect, pending_rect);
-            return;
-        }
+    if (m_pending_paint_event_rects.contains(a_rect)) {
+        dbgln_if(UPDATE_COALESCING_DEBUG, "Ignoring {} since it's already covered by pending damage", a_rect);
+        return;
     }
 
     if (m_pending_paint_event_rects.is_empty()) {
         deferred_invoke([this] {
-            auto rects = move(m_pending_paint_event_rects);
+            auto rects = m_pending_paint_event_rects.take_rects();
             if (rects.is_empty())
                 return;
             ConnectionToWindowServer::the().async_invalidate_rect(m_window_id, rects, false);
         });
     }
-    m_pending_paint_event_rects.append(a_rect);
+    m_pending_paint_event_rects.add(a_rect);
 }
 
 void Window::set_main_widget(Widget* widget)
@@ -1328,7 +1333,7 @@ void Window::flush_pending_paints_immediately()
         return;
     if (m_pending_paint_event_rects.is_empty())
         return;
-    MultiPaintEvent paint_event(move(m_pending_paint_event_rects), size());
+    MultiPaintEvent paint_event(m_pending_paint_event_rects.take_rects(), size());
     handle_multi_paint_event(paint_event);
 }
 
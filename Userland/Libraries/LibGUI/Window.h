@@ -17,6 +17,7 @@
 #include <LibGUI/ResizeDirection.h>
 #include <LibGUI/WindowMode.h>
 #include <LibGUI/WindowType.h>
+#include <LibGfx/DisjointRectSet.h>
 #include <LibGfx/Forward.h>
 #include <LibGfx/Rect.h>
 #include <LibGfx/StandardCursor.h>
@@ -296,7 +297,7 @@ private:
     Gfx::IntRect m_rect_when_windowless;
     Gfx::IntSize m_minimum_size_when_windowless { 0, 0 };
     DeprecatedString m_title_when_windowless;
-    Vector<Gfx::IntRect, 32> m_pending_paint_event_rects;
+    Gfx::DisjointIntRectSet m_pending_paint_event_rects;
     Gfx::IntSize m_size_increment;
     Gfx::IntSize m_base_size;
     WindowType m_window_type { WindowType::Normal };
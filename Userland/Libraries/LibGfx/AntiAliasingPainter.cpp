@@ -15,6 +15,7 @@
 #include <AK/NumericLimits.h>
 #include <LibGfx/AntiAliasingPainter.h>
 #include <LibGfx/Line.h>
+#include <LibGfx/ScanlinePathRasterizer.h>
 
 namespace Gfx {
 
@@ -215,7 +216,7 @@ void AntiAliasingPainter::draw_line(FloatPoint actual_from, FloatPoint actual_to
 
 void AntiAliasingPainter::fill_path(Path& path, Color color, Painter::WindingRule rule)
 {
-    Detail::fill_path<Detail::FillPathMode::AllowFloatingPoints>(*this, path, color, rule);
+    ScanlinePathRasterizer::fill(m_underlying_painter, path, color, rule, m_transform);
 }
 
 void AntiAliasingPainter::stroke_path(Path const& path, Color color, float thickness)
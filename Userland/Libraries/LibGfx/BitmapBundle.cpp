@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Checked.h>
+#include <AK/StringBuilder.h>
+#include <LibGfx/BitmapBundle.h>
+
+namespace Gfx {
+
+static constexpr u8 bundle_magic[8] = { 'B', 'M', 'B', 'U', 'N', 'D', 'L', 'E' };
+static constexpr u32 bundle_version = 1;
+static constexpr size_t bundle_data_alignment = 16;
+
+struct [[gnu::packed]] BundleHeader {
+    u8 magic[8];
+    u32 version;
+    u32 entry_count;
+};
+
+struct [[gnu::packed]] BundleEntry {
+    u32 name_offset; // Offset of a NUL-terminated name from the start of the file
+    u32 scale_factor;
+    u32 format; // BitmapFormat
+    u32 width;  // Logical size; physical size is scaled by scale_factor
+    u32 height;
+    u32 pitch;
+    u32 data_offset; // Aligned to bundle_data_alignment
+    u32 data_size;
+};
+
+static DeprecatedString bundle_key(StringView name, int scale_factor)
+{
+    return DeprecatedString::formatted("{}:{}", name, scale_factor);
+}
+
+ErrorOr<NonnullRefPtr<BitmapBundle>> BitmapBundle::try_load_from_file(StringView path)
+{
+    auto file = TRY(Core::MappedFile::map(path));
+    auto bundle = TRY(adopt_nonnull_ref_or_enomem(new (nothrow) BitmapBundle(move(file))));
+    TRY(bundle->populate());
+    return bundle;
+}
+
+ErrorOr<void> BitmapBundle::populate()
+{
+    auto bytes = m_file->bytes();
+    if (bytes.size() < sizeof(BundleHeader))
+        return Error::from_string_literal("BitmapBundle: File too small for header");
+
+    auto const& header = *reinterpret_cast<BundleHeader const*>(bytes.data());
+    if (__builtin_memcmp(header.magic, bundle_magic, sizeof(bundle_magic)) != 0)
+        return Error::from_string_literal("BitmapBundle: Invalid magic bytes");
+    if (header.version != bundle_version)
+        return Error::from_string_literal("BitmapBundle: Unsupported version");
+
+    Checked<size_t> entries_end = static_cast<size_t>(header.entry_count);
+    entries_end *= sizeof(BundleEntry);
+    entries_end += sizeof(BundleHeader);
+    if (entries_end.has_overflow() || entries_end.value() > bytes.size())
+        return Error::from_string_literal("BitmapBundle: File too small for entry table");
+
+    auto const* entries = reinterpret_cast<BundleEntry const*>(bytes.data() + sizeof(BundleHeader));
+    for (u32 i = 0; i < header.entry_count; ++i) {
+        auto const& entry = entries[i];
+
+        if (entry.name_offset >= bytes.size())
+            return Error::from_string_literal("BitmapBundle: Entry name out of bounds");
+        auto const* name_terminator = __builtin_memchr(bytes.data() + entry.name_offset, '\0', bytes.size() - entry.name_offset);
+        if (!name_terminator)
+            return Error::from_string_literal("BitmapBundle: Entry name is not NUL-terminated");
+        StringView name { bytes.data() + entry.name_offset, static_cast<size_t>(reinterpret_cast<u8 const*>(name_terminator) - (bytes.data() + entry.name_offset)) };
+
+        auto format = static_cast<BitmapFormat>(entry.format);
+        if (format != BitmapFormat::BGRx8888 && format != BitmapFormat::BGRA8888 && format != BitmapFormat::RGBA8888)
+            return Error::from_string_literal("BitmapBundle: Unsupported bitmap format");
+
+        if (entry.scale_factor < 1 || entry.width < 1 || entry.height < 1)
+            return Error::from_string_literal("BitmapBundle: Invalid bitmap dimensions");
+        if (entry.pitch < Bitmap::minimum_pitch(static_cast<size_t>(entry.width) * entry.scale_factor, format))
+            return Error::from_string_literal("BitmapBundle: Pitch too small for bitmap width");
+
+        Checked<size_t> expected_data_size = static_cast<size_t>(entry.pitch);
+        expected_data_size *= static_cast<size_t>(entry.height) * entry.scale_factor;
+        if (expected_data_size.has_overflow() || expected_data_size.value() != entry.data_size)
+            return Error::from_string_literal("BitmapBundle: Entry data size mismatch");
+
+        Checked<size_t> data_end = static_cast<size_t>(entry.data_offset);
+        data_end += entry.data_size;
+        if (data_end.has_overflow() || data_end.value() > bytes.size())
+            return Error::from_string_literal("BitmapBundle: Entry data out of bounds");
+
+        // Wrapping is const-unfriendly, but the mapping is read-only and the
+        // bitmaps are only ever handed out as Bitmap const&.
+        auto* data = const_cast<u8*>(bytes.data() + entry.data_offset);
+        auto bitmap = TRY(Bitmap::try_create_wrapper(format, { static_cast<int>(entry.width), static_cast<int>(entry.height) }, static_cast<int>(entry.scale_factor), entry.pitch, data));
+        TRY(m_bitmaps.try_set(bundle_key(name, static_cast<int>(entry.scale_factor)), move(bitmap)));
+    }
+
+    return {};
+}
+
+RefPtr<Bitmap> BitmapBundle::find_bitmap(StringView name, int scale_factor) const
+{
+    auto it = m_bitmaps.find(bundle_key(name, scale_factor));
+    if (it == m_bitmaps.end())
+        return {};
+    return it->value;
+}
+
+ErrorOr<ByteBuffer> BitmapBundle::serialize(Vector<EntryForSerialization> const& entries)
+{
+    size_t const names_offset = sizeof(BundleHeader) + entries.size() * sizeof(BundleEntry);
+    size_t names_size = 0;
+    for (auto const& entry : entries)
+        names_size += entry.name.length() + 1;
+
+    Vector<BundleEntry> file_entries;
+    TRY(file_entries.try_ensure_capacity(entries.size()));
+
+    size_t current_name_offset = names_offset;
+    size_t current_data_offset = align_up_to(names_offset + names_size, bundle_data_alignment);
+    for (auto const& entry : entries) {
+        auto const& bitmap = *entry.bitmap;
+        if (bitmap.is_indexed())
+            return Error::from_string_literal("BitmapBundle: Indexed bitmaps cannot be bundled");
+        VERIFY(bitmap.scale() == entry.scale_factor);
+
+        size_t data_size = bitmap.pitch() * bitmap.physical_height();
+        file_entries.unchecked_append({
+            .name_offset = static_cast<u32>(current_name_offset),
+            .scale_factor = static_cast<u32>(entry.scale_factor),
+            .format = static_cast<u32>(bitmap.format()),
+            .width = static_cast<u32>(bitmap.width()),
+            .height = static_cast<u32>(bitmap.height()),
+            .pitch = static_cast<u32>(bitmap.pitch()),
+            .data_offset = static_cast<u32>(current_data_offset),
+            .data_size = static_cast<u32>(data_size),
+        });
+        current_name_offset += entry.name.length() + 1;
+        current_data_offset = align_up_to(current_data_offset + data_size, bundle_data_alignment);
+    }
+
+    auto buffer = TRY(ByteBuffer::create_zeroed(current_data_offset));
+
+    BundleHeader header {};
+    __builtin_memcpy(header.magic, bundle_magic, sizeof(bundle_magic));
+    header.version = bundle_version;
+    header.entry_count = static_cast<u32>(entries.size());
+    buffer.overwrite(0, &header, sizeof(header));
+
+    for (size_t i = 0; i < entries.size(); ++i) {
+        auto const& file_entry = file_entries[i];
+        buffer.overwrite(sizeof(BundleHeader) + i * sizeof(BundleEntry), &file_entry, sizeof(file_entry));
+        buffer.overwrite(file_entry.name_offset, entries[i].name.characters(), entries[i].name.length() + 1);
+        buffer.overwrite(file_entry.data_offset, entries[i].bitmap->scanline_u8(0), file_entry.data_size);
+    }
+
+    return buffer;
+}
+
+}
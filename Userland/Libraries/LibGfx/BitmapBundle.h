@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/DeprecatedString.h>
+#include <AK/HashMap.h>
+#include <AK/RefCounted.h>
+#include <LibCore/MappedFile.h>
+#include <LibGfx/Bitmap.h>
+
+namespace Gfx {
+
+// A bitmap bundle packs a set of decoded bitmaps into a single file that can
+// be mapped read-only and blitted from directly, without any per-image decode.
+// Pixel data is stored in native scanline layout, so loading a bundle is one
+// mmap() and the page cache shares the pixels between every process mapping
+// the same bundle.
+//
+// Bitmaps handed out by the bundle wrap the mapped pages: they must be
+// treated as read-only and stay valid for as long as the bundle object lives.
+//
+// Bundles are generated by the mkbitmapbundle utility, keyed by the path the
+// image would otherwise be decoded from plus the scale factor.
+class BitmapBundle : public RefCounted<BitmapBundle> {
+public:
+    static ErrorOr<NonnullRefPtr<BitmapBundle>> try_load_from_file(StringView path);
+
+    RefPtr<Bitmap> find_bitmap(StringView name, int scale_factor) const;
+
+    struct EntryForSerialization {
+        DeprecatedString name;
+        int scale_factor { 1 };
+        NonnullRefPtr<Bitmap> bitmap;
+    };
+    static ErrorOr<ByteBuffer> serialize(Vector<EntryForSerialization> const&);
+
+private:
+    explicit BitmapBundle(NonnullRefPtr<Core::MappedFile> file)
+        : m_file(move(file))
+    {
+    }
+
+    ErrorOr<void> populate();
+
+    NonnullRefPtr<Core::MappedFile> m_file;
+    HashMap<DeprecatedString, NonnullRefPtr<Bitmap>> m_bitmaps;
+};
+
+}
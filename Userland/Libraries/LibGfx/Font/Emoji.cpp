@@ -7,8 +7,10 @@
 
 #include <AK/DeprecatedString.h>
 #include <AK/HashMap.h>
+#include <AK/HashTable.h>
 #include <AK/Span.h>
 #include <AK/Utf8View.h>
+#include <LibCore/DirIterator.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/Font/Emoji.h>
 
@@ -20,6 +22,26 @@ namespace Gfx {
 
 static HashMap<DeprecatedString, RefPtr<Gfx::Bitmap>> s_emojis;
 
+// The names of all emoji files, scanned once on first lookup. Text layout
+// probes every prefix of a potential emoji sequence, and the overwhelming
+// majority of those probes miss; answering them from this index keeps them
+// off the filesystem entirely.
+static HashTable<DeprecatedString> const& emoji_basenames()
+{
+    static HashTable<DeprecatedString> s_basenames;
+    static bool s_initialized = false;
+    if (!s_initialized) {
+        s_initialized = true;
+        Core::DirIterator dir_iterator("/res/emoji", Core::DirIterator::SkipParentAndBaseDir);
+        while (dir_iterator.has_next()) {
+            auto name = dir_iterator.next_path();
+            if (name.ends_with(".png"sv))
+                s_basenames.set(name.substring(0, name.length() - 4));
+        }
+    }
+    return s_basenames;
+}
+
 Bitmap const* Emoji::emoji_for_code_point(u32 code_point)
 {
     return emoji_for_code_points(Array { code_point });
@@ -27,13 +49,15 @@ Bitmap const* Emoji::emoji_for_code_point(u32 code_point)
 
 Bitmap const* Emoji::emoji_for_code_points(Span<u32 const> const& code_points)
 {
-    // FIXME: This function is definitely not fast.
     auto basename = DeprecatedString::join('_', code_points, "U+{:X}"sv);
 
     auto it = s_emojis.find(basename);
     if (it != s_emojis.end())
         return (*it).value.ptr();
 
+    if (!emoji_basenames().contains(basename))
+        return nullptr;
+
     auto bitmap_or_error = Bitmap::try_load_from_file(DeprecatedString::formatted("/res/emoji/{}.png", basename));
     if (bitmap_or_error.is_error()) {
         s_emojis.set(basename, nullptr);
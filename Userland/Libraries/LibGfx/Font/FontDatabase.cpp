@@ -16,6 +16,7 @@
 #include <LibGfx/Font/Typeface.h>
 #include <LibGfx/Font/WOFF/Font.h>
 #include <stdlib.h>
+#include <string.h>
 
 namespace Gfx {
 
@@ -120,8 +121,54 @@ Font& FontDatabase::default_fixed_width_font()
 struct FontDatabase::Private {
     HashMap<DeprecatedString, NonnullRefPtr<Gfx::Font>> full_name_to_font_map;
     HashMap<FlyString, Vector<NonnullRefPtr<Typeface>>> typefaces;
+    // Which files each family was loaded from, in load order; this is what
+    // font_index() serializes.
+    HashMap<DeprecatedString, Vector<DeprecatedString>> family_to_paths;
+    // Families from a received font index whose files we haven't opened yet.
+    HashMap<FlyString, Vector<DeprecatedString>> unloaded_families;
+    Core::AnonymousBuffer serialized_font_index;
 };
 
+static Core::AnonymousBuffer s_system_font_index;
+static bool s_font_database_initialized = false;
+
+void FontDatabase::set_system_font_index(Core::AnonymousBuffer buffer)
+{
+    if (s_font_database_initialized) {
+        dbgln("FontDatabase: Ignoring font index that arrived after the database was already populated");
+        return;
+    }
+    s_system_font_index = move(buffer);
+}
+
+void FontDatabase::load_font_from_path(DeprecatedString const& path)
+{
+    if (path.ends_with(".font"sv)) {
+        if (auto font_or_error = Gfx::BitmapFont::try_load_from_file(path); !font_or_error.is_error()) {
+            auto font = font_or_error.release_value();
+            m_private->full_name_to_font_map.set(font->qualified_name(), *font);
+            m_private->family_to_paths.ensure(font->family()).append(path);
+            auto typeface = get_or_create_typeface(font->family(), font->variant());
+            typeface->add_bitmap_font(font);
+        }
+    } else if (path.ends_with(".ttf"sv)) {
+        // FIXME: What about .otf
+        if (auto font_or_error = TTF::Font::try_load_from_file(path); !font_or_error.is_error()) {
+            auto font = font_or_error.release_value();
+            m_private->family_to_paths.ensure(font->family()).append(path);
+            auto typeface = get_or_create_typeface(font->family(), font->variant());
+            typeface->set_vector_font(move(font));
+        }
+    } else if (path.ends_with(".woff"sv)) {
+        if (auto font_or_error = WOFF::Font::try_load_from_file(path); !font_or_error.is_error()) {
+            auto font = font_or_error.release_value();
+            m_private->family_to_paths.ensure(font->family()).append(path);
+            auto typeface = get_or_create_typeface(font->family(), font->variant());
+            typeface->set_vector_font(move(font));
+        }
+    }
+}
+
 void FontDatabase::load_all_fonts_from_path(DeprecatedString const& root)
 {
     Queue<DeprecatedString> path_queue;
@@ -142,39 +189,137 @@ void FontDatabase::load_all_fonts_from_path(DeprecatedString const& root)
                 continue;
             }
 
-            if (path.ends_with(".font"sv)) {
-                if (auto font_or_error = Gfx::BitmapFont::try_load_from_file(path); !font_or_error.is_error()) {
-                    auto font = font_or_error.release_value();
-                    m_private->full_name_to_font_map.set(font->qualified_name(), *font);
-                    auto typeface = get_or_create_typeface(font->family(), font->variant());
-                    typeface->add_bitmap_font(font);
-                }
-            } else if (path.ends_with(".ttf"sv)) {
-                // FIXME: What about .otf
-                if (auto font_or_error = TTF::Font::try_load_from_file(path); !font_or_error.is_error()) {
-                    auto font = font_or_error.release_value();
-                    auto typeface = get_or_create_typeface(font->family(), font->variant());
-                    typeface->set_vector_font(move(font));
-                }
-            } else if (path.ends_with(".woff"sv)) {
-                if (auto font_or_error = WOFF::Font::try_load_from_file(path); !font_or_error.is_error()) {
-                    auto font = font_or_error.release_value();
-                    auto typeface = get_or_create_typeface(font->family(), font->variant());
-                    typeface->set_vector_font(move(font));
-                }
-            }
+            load_font_from_path(path);
+        }
+    }
+}
+
+Core::AnonymousBuffer FontDatabase::font_index()
+{
+    if (s_system_font_index.is_valid())
+        return s_system_font_index;
+    if (m_private->serialized_font_index.is_valid())
+        return m_private->serialized_font_index;
+
+    ensure_all_fonts_loaded();
+
+    size_t size = sizeof(u32);
+    for (auto const& it : m_private->family_to_paths) {
+        size += sizeof(u32) + it.key.length() + sizeof(u32);
+        for (auto const& path : it.value)
+            size += sizeof(u32) + path.length();
+    }
+
+    auto buffer_or_error = Core::AnonymousBuffer::create_with_size(size);
+    if (buffer_or_error.is_error()) {
+        dbgln("FontDatabase: Failed to allocate font index: {}", buffer_or_error.error());
+        return {};
+    }
+    auto buffer = buffer_or_error.release_value();
+
+    auto* pointer = buffer.data<u8>();
+    auto write_u32 = [&pointer](u32 value) {
+        memcpy(pointer, &value, sizeof(value));
+        pointer += sizeof(value);
+    };
+    auto write_string = [&](DeprecatedString const& string) {
+        write_u32(string.length());
+        memcpy(pointer, string.characters(), string.length());
+        pointer += string.length();
+    };
+
+    write_u32(m_private->family_to_paths.size());
+    for (auto const& it : m_private->family_to_paths) {
+        write_string(it.key);
+        write_u32(it.value.size());
+        for (auto const& path : it.value)
+            write_string(path);
+    }
+    VERIFY(pointer == buffer.data<u8>() + size);
+
+    m_private->serialized_font_index = buffer;
+    return buffer;
+}
+
+bool FontDatabase::load_font_index(Core::AnonymousBuffer const& buffer)
+{
+    auto const* pointer = buffer.data<u8>();
+    size_t remaining = buffer.size();
+
+    auto read_u32 = [&](u32& value) {
+        if (remaining < sizeof(value))
+            return false;
+        memcpy(&value, pointer, sizeof(value));
+        pointer += sizeof(value);
+        remaining -= sizeof(value);
+        return true;
+    };
+    auto read_string = [&](DeprecatedString& string) {
+        u32 length = 0;
+        if (!read_u32(length) || remaining < length)
+            return false;
+        string = DeprecatedString { StringView { reinterpret_cast<char const*>(pointer), length } };
+        pointer += length;
+        remaining -= length;
+        return true;
+    };
+
+    auto fail = [&] {
+        dbgln("FontDatabase: Received a malformed font index, falling back to scanning {}", s_default_fonts_lookup_path);
+        m_private->unloaded_families.clear();
+        return false;
+    };
+
+    u32 family_count = 0;
+    if (!read_u32(family_count))
+        return fail();
+    for (u32 i = 0; i < family_count; ++i) {
+        DeprecatedString family;
+        u32 path_count = 0;
+        if (!read_string(family) || !read_u32(path_count))
+            return fail();
+        auto& paths = m_private->unloaded_families.ensure(family);
+        for (u32 j = 0; j < path_count; ++j) {
+            DeprecatedString path;
+            if (!read_string(path))
+                return fail();
+            paths.append(move(path));
         }
     }
+    return true;
+}
+
+void FontDatabase::ensure_family_loaded(FlyString const& family)
+{
+    auto it = m_private->unloaded_families.find(family);
+    if (it == m_private->unloaded_families.end())
+        return;
+    auto paths = move(it->value);
+    m_private->unloaded_families.remove(it);
+    for (auto const& path : paths)
+        load_font_from_path(path);
+}
+
+void FontDatabase::ensure_all_fonts_loaded()
+{
+    while (!m_private->unloaded_families.is_empty()) {
+        auto family = m_private->unloaded_families.begin()->key;
+        ensure_family_loaded(family);
+    }
 }
 
 FontDatabase::FontDatabase()
     : m_private(make<Private>())
 {
+    s_font_database_initialized = true;
+    if (s_system_font_index.is_valid() && load_font_index(s_system_font_index))
+        return;
     load_all_fonts_from_path(s_default_fonts_lookup_path);
 }
 
 void FontDatabase::for_each_font(Function<void(Gfx::Font const&)> callback)
 {
+    ensure_all_fonts_loaded();
     Vector<RefPtr<Gfx::Font>> fonts;
     fonts.ensure_capacity(m_private->full_name_to_font_map.size());
     for (auto& it : m_private->full_name_to_font_map)
@@ -186,6 +331,7 @@ void FontDatabase::for_each_font(Function<void(Gfx::Font const&)> callback)
 
 void FontDatabase::for_each_fixed_width_font(Function<void(Gfx::Font const&)> callback)
 {
+    ensure_all_fonts_loaded();
     Vector<RefPtr<Gfx::Font>> fonts;
     fonts.ensure_capacity(m_private->full_name_to_font_map.size());
     for (auto& it : m_private->full_name_to_font_map) {
@@ -217,6 +363,7 @@ RefPtr<Gfx::Font> FontDatabase::get_by_name(StringView name)
 
 RefPtr<Gfx::Font> FontDatabase::get(FlyString const& family, float point_size, unsigned weight, unsigned slope, Font::AllowInexactSizeMatch allow_inexact_size_match)
 {
+    ensure_family_loaded(family);
     auto it = m_private->typefaces.find(family);
     if (it == m_private->typefaces.end())
         return nullptr;
@@ -229,6 +376,7 @@ RefPtr<Gfx::Font> FontDatabase::get(FlyString const& family, float point_size, u
 
 RefPtr<Gfx::Font> FontDatabase::get(FlyString const& family, FlyString const& variant, float point_size, Font::AllowInexactSizeMatch allow_inexact_size_match)
 {
+    ensure_family_loaded(family);
     auto it = m_private->typefaces.find(family);
     if (it == m_private->typefaces.end())
         return nullptr;
@@ -255,6 +403,7 @@ RefPtr<Typeface> FontDatabase::get_or_create_typeface(DeprecatedString const& fa
 
 void FontDatabase::for_each_typeface(Function<void(Typeface const&)> callback)
 {
+    ensure_all_fonts_loaded();
     for (auto const& it : m_private->typefaces) {
         for (auto const& jt : it.value) {
             callback(*jt);
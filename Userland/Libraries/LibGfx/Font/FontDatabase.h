@@ -10,6 +10,7 @@
 #include <AK/Function.h>
 #include <AK/HashMap.h>
 #include <AK/OwnPtr.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibGfx/Font/Typeface.h>
 #include <LibGfx/Forward.h>
 
@@ -58,11 +59,23 @@ public:
 
     void load_all_fonts_from_path(DeprecatedString const&);
 
+    // The font index maps each font family to the files it was loaded from.
+    // WindowServer pays the full directory scan once at startup and hands the
+    // serialized index to every client; a client that received one via
+    // set_system_font_index() skips the scan and only opens a family's files
+    // on first lookup.
+    Core::AnonymousBuffer font_index();
+    static void set_system_font_index(Core::AnonymousBuffer);
+
 private:
     FontDatabase();
     ~FontDatabase() = default;
 
     void load_fonts();
+    void load_font_from_path(DeprecatedString const&);
+    bool load_font_index(Core::AnonymousBuffer const&);
+    void ensure_family_loaded(FlyString const& family);
+    void ensure_all_fonts_loaded();
 
     RefPtr<Typeface> get_or_create_typeface(DeprecatedString const& family, DeprecatedString const& variant);
 
@@ -38,6 +38,20 @@ ALWAYS_INLINE int ScaledFont::unicode_view_width(T const& view) const
     return longest_width;
 }
 
+u32 ScaledFont::glyph_id_for_code_point(u32 code_point) const
+{
+    // Mapping a code point to a glyph id means walking the font's cmap
+    // subtables, and drawing or measuring text does it several times per
+    // code point. Cache the answer; the mapping never changes for a font.
+    auto glyph_id_iterator = m_cached_glyph_ids.find(code_point);
+    if (glyph_id_iterator != m_cached_glyph_ids.end())
+        return glyph_id_iterator->value;
+
+    auto glyph_id = m_font->glyph_id_for_code_point(code_point);
+    m_cached_glyph_ids.set(code_point, glyph_id);
+    return glyph_id;
+}
+
 RefPtr<Gfx::Bitmap> ScaledFont::rasterize_glyph(u32 glyph_id) const
 {
     auto glyph_iterator = m_cached_glyph_bitmaps.find(glyph_id);
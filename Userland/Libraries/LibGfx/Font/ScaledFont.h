@@ -27,7 +27,7 @@ public:
         m_x_scale = (point_width * dpi_x) / (POINTS_PER_INCH * units_per_em);
         m_y_scale = (point_height * dpi_y) / (POINTS_PER_INCH * units_per_em);
     }
-    u32 glyph_id_for_code_point(u32 code_point) const { return m_font->glyph_id_for_code_point(code_point); }
+    u32 glyph_id_for_code_point(u32 code_point) const;
     ScaledFontMetrics metrics() const { return m_font->metrics(m_x_scale, m_y_scale); }
     ScaledGlyphMetrics glyph_metrics(u32 glyph_id) const { return m_font->glyph_metrics(glyph_id, m_x_scale, m_y_scale); }
     RefPtr<Gfx::Bitmap> rasterize_glyph(u32 glyph_id) const;
@@ -73,6 +73,7 @@ private:
     float m_point_width { 0.0f };
     float m_point_height { 0.0f };
     mutable HashMap<u32, RefPtr<Gfx::Bitmap>> m_cached_glyph_bitmaps;
+    mutable HashMap<u32, u32> m_cached_glyph_ids;
 
     template<typename T>
     int unicode_view_width(T const& view) const;
@@ -53,8 +53,20 @@ RefPtr<Font> Typeface::get_font(float point_size, Font::AllowInexactSizeMatch al
 {
     VERIFY(point_size > 0);
 
-    if (m_vector_font)
-        return adopt_ref(*new Gfx::ScaledFont(*m_vector_font, point_size, point_size));
+    if (m_vector_font) {
+        if (auto it = m_scaled_fonts.find(point_size); it != m_scaled_fonts.end())
+            return it->value;
+
+        // FIXME: It might be nicer to have a global cap on the number of fonts we cache
+        //        instead of doing it at the per-typeface level like this.
+        constexpr size_t max_cached_font_size_count = 64;
+        if (m_scaled_fonts.size() > max_cached_font_size_count)
+            m_scaled_fonts.remove(m_scaled_fonts.begin());
+
+        auto scaled_font = adopt_ref(*new Gfx::ScaledFont(*m_vector_font, point_size, point_size));
+        m_scaled_fonts.set(point_size, scaled_font);
+        return scaled_font;
+    }
 
     RefPtr<BitmapFont> best_match;
     int size = roundf(point_size);
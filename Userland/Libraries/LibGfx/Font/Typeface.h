@@ -8,6 +8,7 @@
 
 #include <AK/FlyString.h>
 #include <AK/Function.h>
+#include <AK/HashMap.h>
 #include <AK/RefCounted.h>
 #include <AK/Vector.h>
 #include <LibGfx/Font/BitmapFont.h>
@@ -44,6 +45,10 @@ private:
 
     Vector<RefPtr<BitmapFont>> m_bitmap_fonts;
     RefPtr<VectorFont> m_vector_font;
+
+    // Handing out one shared ScaledFont per size means everyone drawing at
+    // that size also shares its glyph id and rasterization caches.
+    mutable HashMap<float, NonnullRefPtr<Font>> m_scaled_fonts;
 };
 
 }
@@ -8,8 +8,10 @@
 #include <AK/HashMap.h>
 #include <AK/Math.h>
 #include <AK/MemoryStream.h>
+#include <AK/SIMD.h>
 #include <AK/Vector.h>
 #include <LibGfx/JPGLoader.h>
+#include <LibThreading/ThreadPool.h>
 
 #define JPG_INVALID 0X0000
 
@@ -843,28 +845,37 @@ static bool skip_marker_with_length(InputMemoryStream& stream)
     return !stream.handle_any_error();
 }
 
-static void dequantize(JPGLoadingContext& context, Vector<Macroblock>& macroblocks)
+static void dequantize_mcu_row(JPGLoadingContext const& context, Vector<Macroblock>& macroblocks, u32 vcursor)
 {
-    for (u32 vcursor = 0; vcursor < context.mblock_meta.vcount; vcursor += context.vsample_factor) {
-        for (u32 hcursor = 0; hcursor < context.mblock_meta.hcount; hcursor += context.hsample_factor) {
-            for (u32 i = 0; i < context.component_count; i++) {
-                auto& component = context.components[i];
-                u32 const* table = component.qtable_id == 0 ? context.luma_table : context.chroma_table;
-                for (u32 vfactor_i = 0; vfactor_i < component.vsample_factor; vfactor_i++) {
-                    for (u32 hfactor_i = 0; hfactor_i < component.hsample_factor; hfactor_i++) {
-                        u32 mb_index = (vcursor + vfactor_i) * context.mblock_meta.hpadded_count + (hfactor_i + hcursor);
-                        Macroblock& block = macroblocks[mb_index];
-                        int* block_component = get_component(block, i);
-                        for (u32 k = 0; k < 64; k++)
-                            block_component[k] *= table[k];
-                    }
+    for (u32 hcursor = 0; hcursor < context.mblock_meta.hcount; hcursor += context.hsample_factor) {
+        for (u32 i = 0; i < context.component_count; i++) {
+            auto& component = context.components[i];
+            u32 const* table = component.qtable_id == 0 ? context.luma_table : context.chroma_table;
+            for (u32 vfactor_i = 0; vfactor_i < component.vsample_factor; vfactor_i++) {
+                for (u32 hfactor_i = 0; hfactor_i < component.hsample_factor; hfactor_i++) {
+                    u32 mb_index = (vcursor + vfactor_i) * context.mblock_meta.hpadded_count + (hfactor_i + hcursor);
+                    Macroblock& block = macroblocks[mb_index];
+                    int* block_component = get_component(block, i);
+                    for (u32 k = 0; k < 64; k++)
+                        block_component[k] *= table[k];
                 }
             }
         }
     }
 }
 
-static void inverse_dct(JPGLoadingContext const& context, Vector<Macroblock>& macroblocks)
+static ALWAYS_INLINE void transpose_8x8(AK::SIMD::f32x8 (&rows)[8])
+{
+    float m[8][8];
+    for (u32 i = 0; i < 8; ++i)
+        __builtin_memcpy(m[i], &rows[i], sizeof(m[i]));
+    for (u32 i = 0; i < 8; ++i)
+        rows[i] = AK::SIMD::f32x8 { m[0][i], m[1][i], m[2][i], m[3][i], m[4][i], m[5][i], m[6][i], m[7][i] };
+}
+
+// One IDCT pass applies the same butterfly to each of the eight columns of a block
+// independently, so the butterfly runs once with every f32x8 lane holding one column.
+static ALWAYS_INLINE void inverse_dct_pass(AK::SIMD::f32x8 (&rows)[8])
 {
     static float const m0 = 2.0f * AK::cos(1.0f / 16.0f * 2.0f * AK::Pi<float>);
     static float const m1 = 2.0f * AK::cos(2.0f / 16.0f * 2.0f * AK::Pi<float>);
@@ -881,189 +892,216 @@ static void inverse_dct(JPGLoadingContext const& context, Vector<Macroblock>& ma
     static float const s6 = AK::cos(6.0f / 16.0f * AK::Pi<float>) / 2.0f;
     static float const s7 = AK::cos(7.0f / 16.0f * AK::Pi<float>) / 2.0f;
 
-    for (u32 vcursor = 0; vcursor < context.mblock_meta.vcount; vcursor += context.vsample_factor) {
-        for (u32 hcursor = 0; hcursor < context.mblock_meta.hcount; hcursor += context.hsample_factor) {
-            for (u32 component_i = 0; component_i < context.component_count; component_i++) {
-                auto& component = context.components[component_i];
-                for (u8 vfactor_i = 0; vfactor_i < component.vsample_factor; vfactor_i++) {
-                    for (u8 hfactor_i = 0; hfactor_i < component.hsample_factor; hfactor_i++) {
-                        u32 mb_index = (vcursor + vfactor_i) * context.mblock_meta.hpadded_count + (hfactor_i + hcursor);
-                        Macroblock& block = macroblocks[mb_index];
-                        i32* block_component = get_component(block, component_i);
-                        for (u32 k = 0; k < 8; ++k) {
-                            float const g0 = block_component[0 * 8 + k] * s0;
-                            float const g1 = block_component[4 * 8 + k] * s4;
-                            float const g2 = block_component[2 * 8 + k] * s2;
-                            float const g3 = block_component[6 * 8 + k] * s6;
-                            float const g4 = block_component[5 * 8 + k] * s5;
-                            float const g5 = block_component[1 * 8 + k] * s1;
-                            float const g6 = block_component[7 * 8 + k] * s7;
-                            float const g7 = block_component[3 * 8 + k] * s3;
-
-                            float const f0 = g0;
-                            float const f1 = g1;
-                            float const f2 = g2;
-                            float const f3 = g3;
-                            float const f4 = g4 - g7;
-                            float const f5 = g5 + g6;
-                            float const f6 = g5 - g6;
-                            float const f7 = g4 + g7;
-
-                            float const e0 = f0;
-                            float const e1 = f1;
-                            float const e2 = f2 - f3;
-                            float const e3 = f2 + f3;
-                            float const e4 = f4;
-                            float const e5 = f5 - f7;
-                            float const e6 = f6;
-                            float const e7 = f5 + f7;
-                            float const e8 = f4 + f6;
-
-                            float const d0 = e0;
-                            float const d1 = e1;
-                            float const d2 = e2 * m1;
-                            float const d3 = e3;
-                            float const d4 = e4 * m2;
-                            float const d5 = e5 * m3;
-                            float const d6 = e6 * m4;
-                            float const d7 = e7;
-                            float const d8 = e8 * m5;
-
-                            float const c0 = d0 + d1;
-                            float const c1 = d0 - d1;
-                            float const c2 = d2 - d3;
-                            float const c3 = d3;
-                            float const c4 = d4 + d8;
-                            float const c5 = d5 + d7;
-                            float const c6 = d6 - d8;
-                            float const c7 = d7;
-                            float const c8 = c5 - c6;
-
-                            float const b0 = c0 + c3;
-                            float const b1 = c1 + c2;
-                            float const b2 = c1 - c2;
-                            float const b3 = c0 - c3;
-                            float const b4 = c4 - c8;
-                            float const b5 = c8;
-                            float const b6 = c6 - c7;
-                            float const b7 = c7;
-
-                            block_component[0 * 8 + k] = b0 + b7;
-                            block_component[1 * 8 + k] = b1 + b6;
-                            block_component[2 * 8 + k] = b2 + b5;
-                            block_component[3 * 8 + k] = b3 + b4;
-                            block_component[4 * 8 + k] = b3 - b4;
-                            block_component[5 * 8 + k] = b2 - b5;
-                            block_component[6 * 8 + k] = b1 - b6;
-                            block_component[7 * 8 + k] = b0 - b7;
-                        }
-                        for (u32 l = 0; l < 8; ++l) {
-                            float const g0 = block_component[l * 8 + 0] * s0;
-                            float const g1 = block_component[l * 8 + 4] * s4;
-                            float const g2 = block_component[l * 8 + 2] * s2;
-                            float const g3 = block_component[l * 8 + 6] * s6;
-                            float const g4 = block_component[l * 8 + 5] * s5;
-                            float const g5 = block_component[l * 8 + 1] * s1;
-                            float const g6 = block_component[l * 8 + 7] * s7;
-                            float const g7 = block_component[l * 8 + 3] * s3;
-
-                            float const f0 = g0;
-                            float const f1 = g1;
-                            float const f2 = g2;
-                            float const f3 = g3;
-                            float const f4 = g4 - g7;
-                            float const f5 = g5 + g6;
-                            float const f6 = g5 - g6;
-                            float const f7 = g4 + g7;
-
-                            float const e0 = f0;
-                            float const e1 = f1;
-                            float const e2 = f2 - f3;
-                            float const e3 = f2 + f3;
-                            float const e4 = f4;
-                            float const e5 = f5 - f7;
-                            float const e6 = f6;
-                            float const e7 = f5 + f7;
-                            float const e8 = f4 + f6;
-
-                            float const d0 = e0;
-                            float const d1 = e1;
-                            float const d2 = e2 * m1;
-                            float const d3 = e3;
-                            float const d4 = e4 * m2;
-                            float const d5 = e5 * m3;
-                            float const d6 = e6 * m4;
-                            float const d7 = e7;
-                            float const d8 = e8 * m5;
-
-                            float const c0 = d0 + d1;
-                            float const c1 = d0 - d1;
-                            float const c2 = d2 - d3;
-                            float const c3 = d3;
-                            float const c4 = d4 + d8;
-                            float const c5 = d5 + d7;
-                            float const c6 = d6 - d8;
-                            float const c7 = d7;
-                            float const c8 = c5 - c6;
-
-                            float const b0 = c0 + c3;
-                            float const b1 = c1 + c2;
-                            float const b2 = c1 - c2;
-                            float const b3 = c0 - c3;
-                            float const b4 = c4 - c8;
-                            float const b5 = c8;
-                            float const b6 = c6 - c7;
-                            float const b7 = c7;
-
-                            block_component[l * 8 + 0] = b0 + b7;
-                            block_component[l * 8 + 1] = b1 + b6;
-                            block_component[l * 8 + 2] = b2 + b5;
-                            block_component[l * 8 + 3] = b3 + b4;
-                            block_component[l * 8 + 4] = b3 - b4;
-                            block_component[l * 8 + 5] = b2 - b5;
-                            block_component[l * 8 + 6] = b1 - b6;
-                            block_component[l * 8 + 7] = b0 - b7;
-                        }
-                    }
+    auto const g0 = rows[0] * s0;
+    auto const g1 = rows[4] * s4;
+    auto const g2 = rows[2] * s2;
+    auto const g3 = rows[6] * s6;
+    auto const g4 = rows[5] * s5;
+    auto const g5 = rows[1] * s1;
+    auto const g6 = rows[7] * s7;
+    auto const g7 = rows[3] * s3;
+
+    auto const f0 = g0;
+    auto const f1 = g1;
+    auto const f2 = g2;
+    auto const f3 = g3;
+    auto const f4 = g4 - g7;
+    auto const f5 = g5 + g6;
+    auto const f6 = g5 - g6;
+    auto const f7 = g4 + g7;
+
+    auto const e0 = f0;
+    auto const e1 = f1;
+    auto const e2 = f2 - f3;
+    auto const e3 = f2 + f3;
+    auto const e4 = f4;
+    auto const e5 = f5 - f7;
+    auto const e6 = f6;
+    auto const e7 = f5 + f7;
+    auto const e8 = f4 + f6;
+
+    auto const d0 = e0;
+    auto const d1 = e1;
+    auto const d2 = e2 * m1;
+    auto const d3 = e3;
+    auto const d4 = e4 * m2;
+    auto const d5 = e5 * m3;
+    auto const d6 = e6 * m4;
+    auto const d7 = e7;
+    auto const d8 = e8 * m5;
+
+    auto const c0 = d0 + d1;
+    auto const c1 = d0 - d1;
+    auto const c2 = d2 - d3;
+    auto const c3 = d3;
+    auto const c4 = d4 + d8;
+    auto const c5 = d5 + d7;
+    auto const c6 = d6 - d8;
+    auto const c7 = d7;
+    auto const c8 = c5 - c6;
+
+    auto const b0 = c0 + c3;
+    auto const b1 = c1 + c2;
+    auto const b2 = c1 - c2;
+    auto const b3 = c0 - c3;
+    auto const b4 = c4 - c8;
+    auto const b5 = c8;
+    auto const b6 = c6 - c7;
+    auto const b7 = c7;
+
+    rows[0] = b0 + b7;
+    rows[1] = b1 + b6;
+    rows[2] = b2 + b5;
+    rows[3] = b3 + b4;
+    rows[4] = b3 - b4;
+    rows[5] = b2 - b5;
+    rows[6] = b1 - b6;
+    rows[7] = b0 - b7;
+}
+
+static void inverse_dct_8x8(i32* block_component)
+{
+    using AK::SIMD::f32x8;
+    using AK::SIMD::i32x8;
+
+    f32x8 rows[8];
+    for (u32 i = 0; i < 8; ++i) {
+        i32x8 row;
+        __builtin_memcpy(&row, block_component + i * 8, sizeof(row));
+        rows[i] = __builtin_convertvector(row, f32x8);
+    }
+
+    // Column pass (lanes are columns).
+    inverse_dct_pass(rows);
+
+    // The scalar implementation stored the intermediate results as i32, so round-trip
+    // through i32 between the passes to keep the output bit-identical to it.
+    for (auto& row : rows)
+        row = __builtin_convertvector(__builtin_convertvector(row, i32x8), f32x8);
+
+    // Row pass, done as a column pass on the transposed block.
+    transpose_8x8(rows);
+    inverse_dct_pass(rows);
+    transpose_8x8(rows);
+
+    for (u32 i = 0; i < 8; ++i) {
+        auto row = __builtin_convertvector(rows[i], i32x8);
+        __builtin_memcpy(block_component + i * 8, &row, sizeof(row));
+    }
+}
+
+static void inverse_dct_mcu_row(JPGLoadingContext const& context, Vector<Macroblock>& macroblocks, u32 vcursor)
+{
+    for (u32 hcursor = 0; hcursor < context.mblock_meta.hcount; hcursor += context.hsample_factor) {
+        for (u32 component_i = 0; component_i < context.component_count; component_i++) {
+            auto& component = context.components[component_i];
+            for (u8 vfactor_i = 0; vfactor_i < component.vsample_factor; vfactor_i++) {
+                for (u8 hfactor_i = 0; hfactor_i < component.hsample_factor; hfactor_i++) {
+                    u32 mb_index = (vcursor + vfactor_i) * context.mblock_meta.hpadded_count + (hfactor_i + hcursor);
+                    Macroblock& block = macroblocks[mb_index];
+                    inverse_dct_8x8(get_component(block, component_i));
                 }
             }
         }
     }
 }
 
-static void ycbcr_to_rgb(JPGLoadingContext const& context, Vector<Macroblock>& macroblocks)
+static void ycbcr_to_rgb_mcu_row(JPGLoadingContext const& context, Vector<Macroblock>& macroblocks, u32 vcursor)
 {
-    for (u32 vcursor = 0; vcursor < context.mblock_meta.vcount; vcursor += context.vsample_factor) {
-        for (u32 hcursor = 0; hcursor < context.mblock_meta.hcount; hcursor += context.hsample_factor) {
-            const u32 chroma_block_index = vcursor * context.mblock_meta.hpadded_count + hcursor;
-            Macroblock const& chroma = macroblocks[chroma_block_index];
-            // Overflows are intentional.
-            for (u8 vfactor_i = context.vsample_factor - 1; vfactor_i < context.vsample_factor; --vfactor_i) {
-                for (u8 hfactor_i = context.hsample_factor - 1; hfactor_i < context.hsample_factor; --hfactor_i) {
-                    u32 mb_index = (vcursor + vfactor_i) * context.mblock_meta.hpadded_count + (hcursor + hfactor_i);
-                    i32* y = macroblocks[mb_index].y;
-                    i32* cb = macroblocks[mb_index].cb;
-                    i32* cr = macroblocks[mb_index].cr;
-                    for (u8 i = 7; i < 8; --i) {
-                        for (u8 j = 7; j < 8; --j) {
-                            const u8 pixel = i * 8 + j;
-                            const u32 chroma_pxrow = (i / context.vsample_factor) + 4 * vfactor_i;
-                            const u32 chroma_pxcol = (j / context.hsample_factor) + 4 * hfactor_i;
-                            const u32 chroma_pixel = chroma_pxrow * 8 + chroma_pxcol;
-                            int r = y[pixel] + 1.402f * chroma.cr[chroma_pixel] + 128;
-                            int g = y[pixel] - 0.344f * chroma.cb[chroma_pixel] - 0.714f * chroma.cr[chroma_pixel] + 128;
-                            int b = y[pixel] + 1.772f * chroma.cb[chroma_pixel] + 128;
-                            y[pixel] = r < 0 ? 0 : (r > 255 ? 255 : r);
-                            cb[pixel] = g < 0 ? 0 : (g > 255 ? 255 : g);
-                            cr[pixel] = b < 0 ? 0 : (b > 255 ? 255 : b);
-                        }
+    using AK::SIMD::f32x8;
+    using AK::SIMD::i32x8;
+
+    f32x8 const zero {};
+    f32x8 const max_color = zero + 255.0f;
+
+    for (u32 hcursor = 0; hcursor < context.mblock_meta.hcount; hcursor += context.hsample_factor) {
+        const u32 chroma_block_index = vcursor * context.mblock_meta.hpadded_count + hcursor;
+        Macroblock const& chroma = macroblocks[chroma_block_index];
+        // Overflows are intentional: the chroma block may alias one of the blocks being
+        // converted, so iterating the factors (and pixel rows) downwards makes every
+        // chroma sample get read before the conversion overwrites it.
+        for (u8 vfactor_i = context.vsample_factor - 1; vfactor_i < context.vsample_factor; --vfactor_i) {
+            for (u8 hfactor_i = context.hsample_factor - 1; hfactor_i < context.hsample_factor; --hfactor_i) {
+                u32 mb_index = (vcursor + vfactor_i) * context.mblock_meta.hpadded_count + (hcursor + hfactor_i);
+                i32* y = macroblocks[mb_index].y;
+                i32* cb = macroblocks[mb_index].cb;
+                i32* cr = macroblocks[mb_index].cr;
+                for (u8 i = 7; i < 8; --i) {
+                    // Gather the (possibly subsampled) chroma samples for this pixel row;
+                    // the color math below then runs on all eight pixels at once.
+                    const u32 chroma_pxrow = (i / context.vsample_factor) + 4 * vfactor_i;
+                    f32x8 cb_values;
+                    f32x8 cr_values;
+                    for (u8 j = 0; j < 8; ++j) {
+                        const u32 chroma_pixel = chroma_pxrow * 8 + (j / context.hsample_factor) + 4 * hfactor_i;
+                        cb_values[j] = chroma.cb[chroma_pixel];
+                        cr_values[j] = chroma.cr[chroma_pixel];
                     }
+
+                    i32x8 y_row;
+                    __builtin_memcpy(&y_row, y + i * 8, sizeof(y_row));
+                    auto luma = __builtin_convertvector(y_row, f32x8);
+
+                    auto r = luma + 1.402f * cr_values + 128.0f;
+                    auto g = luma - 0.344f * cb_values - 0.714f * cr_values + 128.0f;
+                    auto b = luma + 1.772f * cb_values + 128.0f;
+
+                    // Clamping before the float-to-int truncation is equivalent to the
+                    // truncate-then-clamp the scalar code did.
+                    auto store = [&](f32x8 v, i32* out) {
+                        v = v < zero ? zero : (v > max_color ? max_color : v);
+                        auto row = __builtin_convertvector(v, i32x8);
+                        __builtin_memcpy(out + i * 8, &row, sizeof(row));
+                    };
+                    store(r, y);
+                    store(g, cb);
+                    store(b, cr);
                 }
             }
         }
     }
 }
 
+static Threading::ThreadPool& decoding_thread_pool()
+{
+    static Threading::ThreadPool s_pool;
+    return s_pool;
+}
+
+// Below roughly this many macroblocks, handing the rows to the worker pool costs more
+// than the math itself.
+static constexpr u32 minimum_macroblock_count_for_parallel_decoding = 2048;
+
+// After entropy decoding, every MCU row can be dequantized, inverse-transformed and
+// color-converted independently of every other row, so large images spread the rows
+// across a worker pool. Fusing the three passes per row also keeps each row's
+// macroblocks hot in cache instead of streaming the whole image three times.
+static void process_macroblocks(JPGLoadingContext const& context, Vector<Macroblock>& macroblocks)
+{
+    Vector<u32> mcu_row_cursors;
+    for (u32 vcursor = 0; vcursor < context.mblock_meta.vcount; vcursor += context.vsample_factor)
+        mcu_row_cursors.append(vcursor);
+
+    auto process_one_row = [&](u32 vcursor) {
+        dequantize_mcu_row(context, macroblocks, vcursor);
+        inverse_dct_mcu_row(context, macroblocks, vcursor);
+        ycbcr_to_rgb_mcu_row(context, macroblocks, vcursor);
+    };
+
+    if (context.mblock_meta.total < minimum_macroblock_count_for_parallel_decoding || mcu_row_cursors.size() < 2) {
+        for (auto vcursor : mcu_row_cursors)
+            process_one_row(vcursor);
+        return;
+    }
+
+    auto& pool = decoding_thread_pool();
+    size_t chunk_size = max(static_cast<size_t>(1), mcu_row_cursors.size() / (pool.thread_count() * 4));
+    pool.parallel_for(0, mcu_row_cursors.size(), chunk_size, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+            process_one_row(mcu_row_cursors[i]);
+    });
+}
+
 static bool compose_bitmap(JPGLoadingContext& context, Vector<Macroblock> const& macroblocks)
 {
     auto bitmap_or_error = Bitmap::try_create(BitmapFormat::BGRx8888, { context.frame.width, context.frame.height });
@@ -1218,9 +1256,7 @@ static bool decode_jpg(JPGLoadingContext& context)
     }
 
     auto macroblocks = result.release_value();
-    dequantize(context, macroblocks);
-    inverse_dct(context, macroblocks);
-    ycbcr_to_rgb(context, macroblocks);
+    process_macroblocks(context, macroblocks);
     if (!compose_bitmap(context, macroblocks))
         return false;
     return true;
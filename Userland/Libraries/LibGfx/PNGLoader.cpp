@@ -9,9 +9,14 @@
 #include <AK/Debug.h>
 #include <AK/Endian.h>
 #include <AK/Vector.h>
+#include <LibCompress/Deflate.h>
 #include <LibCompress/Zlib.h>
+#include <LibCore/MemoryStream.h>
 #include <LibGfx/PNGLoader.h>
 #include <LibGfx/PNGShared.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/Thread.h>
 #include <string.h>
 
 namespace Gfx {
@@ -160,6 +165,7 @@ private:
 };
 
 static bool process_chunk(Streamer&, PNGLoadingContext& context);
+static ErrorOr<void> unpack_scanlines_to_bitmap(PNGLoadingContext& context);
 
 union [[gnu::packed]] Pixel {
     ARGB32 rgba { 0 };
@@ -173,41 +179,46 @@ union [[gnu::packed]] Pixel {
 };
 static_assert(AssertSize<Pixel, 4>());
 
-static void unfilter_scanline(PNG::FilterType filter, Bytes scanline_data, ReadonlyBytes previous_scanlines_data, u8 bytes_per_complete_pixel)
+// The first pixel of a scanline has no pixel to its left, so the "left" and "upper left"
+// inputs of the Sub, Average and Paeth filters are defined to be 0 for it. Handling that
+// pixel before entering the loops keeps the per-byte loops free of bounds checks, and
+// making the pixel stride a compile-time constant lets the compiler unroll and vectorize
+// them. This is where large PNG decodes spend most of their non-inflation time.
+template<size_t bytes_per_complete_pixel>
+NEVER_INLINE static void unfilter_scanline_with_pixel_stride(PNG::FilterType filter, Bytes scanline_data, ReadonlyBytes previous_scanlines_data)
 {
-    VERIFY(filter != PNG::FilterType::None);
+    auto size = scanline_data.size();
+    auto first_pixel_size = min(static_cast<size_t>(bytes_per_complete_pixel), size);
 
     switch (filter) {
     case PNG::FilterType::Sub:
-        // This loop starts at bytes_per_complete_pixel because all bytes before that are
-        // guaranteed to have no valid byte at index (i - bytes_per_complete pixel).
-        // All such invalid byte indexes should be treated as 0, and adding 0 to the current
-        // byte would do nothing, so the first bytes_per_complete_pixel bytes can instead
-        // just be skipped.
-        for (size_t i = bytes_per_complete_pixel; i < scanline_data.size(); ++i) {
+        // The "left" bytes of the first pixel are all 0, and adding 0 to the current byte
+        // would do nothing, so the first bytes_per_complete_pixel bytes can just be skipped.
+        for (size_t i = bytes_per_complete_pixel; i < size; ++i) {
             u8 left = scanline_data[i - bytes_per_complete_pixel];
             scanline_data[i] += left;
         }
         break;
-    case PNG::FilterType::Up:
-        for (size_t i = 0; i < scanline_data.size(); ++i) {
-            u8 above = previous_scanlines_data[i];
-            scanline_data[i] += above;
-        }
-        break;
     case PNG::FilterType::Average:
-        for (size_t i = 0; i < scanline_data.size(); ++i) {
-            u32 left = (i < bytes_per_complete_pixel) ? 0 : scanline_data[i - bytes_per_complete_pixel];
+        for (size_t i = 0; i < first_pixel_size; ++i) {
+            u32 above = previous_scanlines_data[i];
+            scanline_data[i] += above / 2;
+        }
+        for (size_t i = bytes_per_complete_pixel; i < size; ++i) {
+            u32 left = scanline_data[i - bytes_per_complete_pixel];
             u32 above = previous_scanlines_data[i];
             u8 average = (left + above) / 2;
             scanline_data[i] += average;
         }
         break;
     case PNG::FilterType::Paeth:
-        for (size_t i = 0; i < scanline_data.size(); ++i) {
-            u8 left = (i < bytes_per_complete_pixel) ? 0 : scanline_data[i - bytes_per_complete_pixel];
+        // With "left" and "upper left" both 0, the Paeth predictor always selects "above".
+        for (size_t i = 0; i < first_pixel_size; ++i)
+            scanline_data[i] += previous_scanlines_data[i];
+        for (size_t i = bytes_per_complete_pixel; i < size; ++i) {
+            u8 left = scanline_data[i - bytes_per_complete_pixel];
             u8 above = previous_scanlines_data[i];
-            u8 upper_left = (i < bytes_per_complete_pixel) ? 0 : previous_scanlines_data[i - bytes_per_complete_pixel];
+            u8 upper_left = previous_scanlines_data[i - bytes_per_complete_pixel];
             i32 predictor = left + above - upper_left;
             u32 predictor_left = abs(predictor - left);
             u32 predictor_above = abs(predictor - above);
@@ -228,6 +239,37 @@ static void unfilter_scanline(PNG::FilterType filter, Bytes scanline_data, Reado
     }
 }
 
+static void unfilter_scanline(PNG::FilterType filter, Bytes scanline_data, ReadonlyBytes previous_scanlines_data, u8 bytes_per_complete_pixel)
+{
+    VERIFY(filter != PNG::FilterType::None);
+
+    if (filter == PNG::FilterType::Up) {
+        // The Up filter doesn't care about the pixel stride, so it needs no dispatch.
+        for (size_t i = 0; i < scanline_data.size(); ++i) {
+            u8 above = previous_scanlines_data[i];
+            scanline_data[i] += above;
+        }
+        return;
+    }
+
+    switch (bytes_per_complete_pixel) {
+    case 1:
+        return unfilter_scanline_with_pixel_stride<1>(filter, scanline_data, previous_scanlines_data);
+    case 2:
+        return unfilter_scanline_with_pixel_stride<2>(filter, scanline_data, previous_scanlines_data);
+    case 3:
+        return unfilter_scanline_with_pixel_stride<3>(filter, scanline_data, previous_scanlines_data);
+    case 4:
+        return unfilter_scanline_with_pixel_stride<4>(filter, scanline_data, previous_scanlines_data);
+    case 6:
+        return unfilter_scanline_with_pixel_stride<6>(filter, scanline_data, previous_scanlines_data);
+    case 8:
+        return unfilter_scanline_with_pixel_stride<8>(filter, scanline_data, previous_scanlines_data);
+    default:
+        VERIFY_NOT_REACHED();
+    }
+}
+
 template<typename T>
 ALWAYS_INLINE static void unpack_grayscale_without_alpha(PNGLoadingContext& context)
 {
@@ -291,6 +333,17 @@ ALWAYS_INLINE static void unpack_triplets_with_transparency_value(PNGLoadingCont
     }
 }
 
+// From section 6.3 of http://www.libpng.org/pub/png/spec/1.2/PNG-Filters.html
+// "bpp is defined as the number of bytes per complete pixel, rounding up to one.
+// For example, for color type 2 with a bit depth of 16, bpp is equal to 6
+// (three samples, two bytes per sample); for color type 0 with a bit depth of 2,
+// bpp is equal to 1 (rounding up); for color type 4 with a bit depth of 16, bpp
+// is equal to 4 (two-byte grayscale sample, plus two-byte alpha sample)."
+static u8 bytes_per_complete_pixel(PNGLoadingContext const& context)
+{
+    return (context.bit_depth + 7) / 8 * context.channels;
+}
+
 NEVER_INLINE FLATTEN static ErrorOr<void> unfilter(PNGLoadingContext& context)
 {
     // First unfilter the scanlines:
@@ -306,14 +359,6 @@ NEVER_INLINE FLATTEN static ErrorOr<void> unfilter(PNGLoadingContext& context)
     }
     context.unfiltered_data = TRY(ByteBuffer::create_uninitialized(bytes_needed_for_all_unfiltered_scanlines));
 
-    // From section 6.3 of http://www.libpng.org/pub/png/spec/1.2/PNG-Filters.html
-    // "bpp is defined as the number of bytes per complete pixel, rounding up to one.
-    // For example, for color type 2 with a bit depth of 16, bpp is equal to 6
-    // (three samples, two bytes per sample); for color type 0 with a bit depth of 2,
-    // bpp is equal to 1 (rounding up); for color type 4 with a bit depth of 16, bpp
-    // is equal to 4 (two-byte grayscale sample, plus two-byte alpha sample)."
-    u8 bytes_per_complete_pixel = (context.bit_depth + 7) / 8 * context.channels;
-
     u8 dummy_scanline_bytes[bytes_per_scanline];
     memset(dummy_scanline_bytes, 0, sizeof(dummy_scanline_bytes));
     auto previous_scanlines_data = ReadonlyBytes { dummy_scanline_bytes, sizeof(dummy_scanline_bytes) };
@@ -326,14 +371,19 @@ NEVER_INLINE FLATTEN static ErrorOr<void> unfilter(PNGLoadingContext& context)
             context.scanlines[y].data.copy_to(scanline_data_slice);
             context.scanlines[y].data = scanline_data_slice;
 
-            unfilter_scanline(context.scanlines[y].filter, scanline_data_slice, previous_scanlines_data, bytes_per_complete_pixel);
+            unfilter_scanline(context.scanlines[y].filter, scanline_data_slice, previous_scanlines_data, bytes_per_complete_pixel(context));
 
             data_start += bytes_per_scanline;
         }
         previous_scanlines_data = context.scanlines[y].data;
     }
 
-    // Now unpack the scanlines to RGBA:
+    return unpack_scanlines_to_bitmap(context);
+}
+
+NEVER_INLINE FLATTEN static ErrorOr<void> unpack_scanlines_to_bitmap(PNGLoadingContext& context)
+{
+    // Unpack the (unfiltered) scanlines to RGBA:
     switch (context.color_type) {
     case PNG::ColorType::Greyscale:
         if (context.bit_depth == 8) {
@@ -579,6 +629,108 @@ static ErrorOr<void> decode_png_bitmap_simple(PNGLoadingContext& context)
     return unfilter(context);
 }
 
+// Pipelining only pays off once there is enough compressed data that inflation takes
+// much longer than spawning the worker thread; smaller images decode inline.
+static constexpr size_t minimum_compressed_size_for_pipelined_decoding = 64 * KiB;
+static constexpr size_t inflation_chunk_size = 64 * KiB;
+
+// Decoding a large PNG spends nearly all of its time in two serial stages: zlib
+// inflation and scanline unfiltering. Each scanline only depends on the scanline
+// directly above it, so it can be unfiltered as soon as the inflater has produced its
+// bytes. This decoder runs the inflater on a worker thread while the calling thread
+// unfilters scanlines in place as they become available, overlapping the two stages.
+static ErrorOr<void> decode_png_bitmap_simple_pipelined(PNGLoadingContext& context)
+{
+    auto zlib = Compress::Zlib::try_create(context.compressed_data.span());
+    if (!zlib.has_value())
+        return Error::from_string_literal("PNGImageDecoderPlugin: Invalid zlib stream");
+
+    auto row_size = context.compute_row_size_for_width(context.width);
+    if (row_size.has_overflow())
+        return Error::from_string_literal("PNGImageDecoderPlugin: Row size overflow");
+    size_t const bytes_per_scanline = row_size.value();
+    size_t const bytes_per_filtered_scanline = bytes_per_scanline + 1; // Including the leading filter type byte.
+    size_t const total_size = bytes_per_filtered_scanline * context.height;
+
+    // Inflating into the buffer that unfiltering then mutates in place means the
+    // decompressed data is never copied.
+    context.unfiltered_data = TRY(ByteBuffer::create_uninitialized(total_size));
+    auto decompressed_data = context.unfiltered_data.bytes();
+
+    struct {
+        Threading::Mutex mutex;
+        size_t bytes_produced { 0 };
+        bool inflation_has_ended { false };
+    } shared_state;
+    Threading::ConditionVariable scanline_data_available(shared_state.mutex);
+
+    auto inflate = [&]() -> ErrorOr<void> {
+        auto memory_stream = TRY(Core::Stream::MemoryStream::construct(zlib->deflate_payload()));
+        Compress::DeflateDecompressor deflate_stream { move(memory_stream) };
+        size_t bytes_produced = 0;
+        while (bytes_produced < total_size && !deflate_stream.is_eof()) {
+            auto chunk = decompressed_data.slice(bytes_produced, min(inflation_chunk_size, total_size - bytes_produced));
+            auto slice = TRY(deflate_stream.read(chunk));
+            bytes_produced += slice.size();
+            Threading::MutexLocker locker(shared_state.mutex);
+            shared_state.bytes_produced = bytes_produced;
+            scanline_data_available.signal();
+        }
+        if (bytes_produced < total_size)
+            return Error::from_string_literal("PNGImageDecoderPlugin: Decompression failed");
+        return {};
+    };
+
+    auto inflater = Threading::Thread::construct([&]() -> intptr_t {
+        auto result = inflate();
+        Threading::MutexLocker locker(shared_state.mutex);
+        shared_state.inflation_has_ended = true;
+        scanline_data_available.signal();
+        return result.is_error() ? 1 : 0;
+    },
+        "PNG inflation"sv);
+    inflater->start();
+
+    u8 dummy_scanline_bytes[bytes_per_scanline];
+    memset(dummy_scanline_bytes, 0, sizeof(dummy_scanline_bytes));
+    auto previous_scanlines_data = ReadonlyBytes { dummy_scanline_bytes, sizeof(dummy_scanline_bytes) };
+
+    auto unfilter_scanlines_as_they_arrive = [&]() -> ErrorOr<void> {
+        for (int y = 0; y < context.height; ++y) {
+            size_t bytes_needed = (y + 1) * bytes_per_filtered_scanline;
+            {
+                Threading::MutexLocker locker(shared_state.mutex);
+                scanline_data_available.wait_while([&] {
+                    return shared_state.bytes_produced < bytes_needed && !shared_state.inflation_has_ended;
+                });
+                if (shared_state.bytes_produced < bytes_needed)
+                    return Error::from_string_literal("PNGImageDecoderPlugin: Decompression failed");
+            }
+
+            u8 filter_byte = decompressed_data[y * bytes_per_filtered_scanline];
+            if (filter_byte > 4)
+                return Error::from_string_literal("PNGImageDecoderPlugin: Invalid PNG filter");
+
+            auto filter = static_cast<PNG::FilterType>(filter_byte);
+            auto scanline_data = decompressed_data.slice(y * bytes_per_filtered_scanline + 1, bytes_per_scanline);
+            if (filter != PNG::FilterType::None)
+                unfilter_scanline(filter, scanline_data, previous_scanlines_data, bytes_per_complete_pixel(context));
+            context.scanlines.append({ filter, scanline_data });
+            previous_scanlines_data = scanline_data;
+        }
+        return {};
+    };
+
+    auto result = unfilter_scanlines_as_they_arrive();
+    // The inflater never waits on this thread, so it always finishes on its own.
+    (void)inflater->join();
+    if (result.is_error())
+        return result.release_error();
+
+    context.bitmap = TRY(Bitmap::try_create(context.has_alpha() ? BitmapFormat::BGRA8888 : BitmapFormat::BGRx8888, { context.width, context.height }));
+    return unpack_scanlines_to_bitmap(context);
+}
+
 static int adam7_height(PNGLoadingContext& context, int pass)
 {
     switch (pass) {
@@ -707,6 +859,23 @@ static ErrorOr<void> decode_png_bitmap(PNGLoadingContext& context)
     if (context.color_type == PNG::ColorType::IndexedColor && context.palette_data.is_empty())
         return Error::from_string_literal("PNGImageDecoderPlugin: Didn't see a PLTE chunk for a palletized image, or it was empty.");
 
+    context.scanlines.ensure_capacity(context.height);
+
+    // Non-interlaced images with enough compressed data to pay for the thread handoff
+    // are decoded with inflation and unfiltering overlapped. If the pipelined decoder
+    // rejects the stream for any reason, fall through to the one-shot path below so
+    // that it can produce its usual errors.
+    if (context.interlace_method == PngInterlaceMethod::Null && context.compressed_data.size() >= minimum_compressed_size_for_pipelined_decoding) {
+        if (!decode_png_bitmap_simple_pipelined(context).is_error()) {
+            context.compressed_data.clear();
+            context.state = PNGLoadingContext::State::BitmapDecoded;
+            return {};
+        }
+        context.scanlines.clear_with_capacity();
+        context.unfiltered_data.clear();
+        context.bitmap = nullptr;
+    }
+
     auto result = Compress::Zlib::decompress_all(context.compressed_data.span());
     if (!result.has_value()) {
         context.state = PNGLoadingContext::State::Error;
@@ -714,8 +883,6 @@ static ErrorOr<void> decode_png_bitmap(PNGLoadingContext& context)
     }
     context.decompression_buffer = &result.value();
     context.compressed_data.clear();
-
-    context.scanlines.ensure_capacity(context.height);
     switch (context.interlace_method) {
     case PngInterlaceMethod::Null:
         TRY(decode_png_bitmap_simple(context));
@@ -32,6 +32,7 @@
 #include <LibGfx/Palette.h>
 #include <LibGfx/Path.h>
 #include <LibGfx/Quad.h>
+#include <AK/SIMD.h>
 #include <LibGfx/TextDirection.h>
 #include <LibGfx/TextLayout.h>
 #include <stdio.h>
@@ -65,6 +66,70 @@ ALWAYS_INLINE Color get_pixel(Gfx::Bitmap const& bitmap, int x, int y)
     return bitmap.get_pixel(x, y);
 }
 
+// The kernels below blend four packed (A)RGB32 pixels per step using vector
+// extensions, producing bit-identical results to four calls to Color::blend().
+
+// Exact v / 255 for v <= 65025, without a division.
+ALWAYS_INLINE static AK::SIMD::u32x4 divide_by_255(AK::SIMD::u32x4 v)
+{
+    return (v + 1 + (v >> 8)) >> 8;
+}
+
+// Fast path for when all four destination pixels are fully opaque: the blend
+// collapses to a plain lerp between source and destination.
+ALWAYS_INLINE static AK::SIMD::u32x4 blend_four_pixels_opaque_destination(AK::SIMD::u32x4 dst, AK::SIMD::u32x4 src)
+{
+    using AK::SIMD::u32x4;
+    u32x4 const src_alpha = src >> 24;
+    u32x4 const inverse_src_alpha = 255 - src_alpha;
+    u32x4 const red = divide_by_255(((dst >> 16) & 0xff) * inverse_src_alpha + ((src >> 16) & 0xff) * src_alpha);
+    u32x4 const green = divide_by_255(((dst >> 8) & 0xff) * inverse_src_alpha + ((src >> 8) & 0xff) * src_alpha);
+    u32x4 const blue = divide_by_255((dst & 0xff) * inverse_src_alpha + (src & 0xff) * src_alpha);
+    return 0xff000000 | (red << 16) | (green << 8) | blue;
+}
+
+ALWAYS_INLINE static AK::SIMD::u32x4 blend_four_pixels(AK::SIMD::u32x4 dst, AK::SIMD::u32x4 src)
+{
+    using AK::SIMD::u32x4;
+    u32x4 const dst_alpha = dst >> 24;
+    u32x4 const src_alpha = src >> 24;
+    u32x4 const inverse_src_alpha = 255 - src_alpha;
+    u32x4 const d = 255 * (dst_alpha + src_alpha) - dst_alpha * src_alpha;
+    // d is only zero when both alphas are zero; Color::blend() returns the
+    // source in that case, which we select below via transparent_lanes.
+    u32x4 const transparent_lanes = (u32x4)(d == 0);
+    u32x4 const safe_d = d - transparent_lanes;
+    u32x4 const red = (((dst >> 16) & 0xff) * dst_alpha * inverse_src_alpha + 255 * src_alpha * ((src >> 16) & 0xff)) / safe_d;
+    u32x4 const green = (((dst >> 8) & 0xff) * dst_alpha * inverse_src_alpha + 255 * src_alpha * ((src >> 8) & 0xff)) / safe_d;
+    u32x4 const blue = ((dst & 0xff) * dst_alpha * inverse_src_alpha + 255 * src_alpha * (src & 0xff)) / safe_d;
+    u32x4 const blended = (divide_by_255(d) << 24) | (red << 16) | (green << 8) | blue;
+    return (blended & ~transparent_lanes) | (src & transparent_lanes);
+}
+
+ALWAYS_INLINE static AK::SIMD::u32x4 blend_four_pixels_dispatch(AK::SIMD::u32x4 dst, AK::SIMD::u32x4 src)
+{
+    if (((dst[0] & dst[1] & dst[2] & dst[3]) >> 24) == 0xff)
+        return blend_four_pixels_opaque_destination(dst, src);
+    return blend_four_pixels(dst, src);
+}
+
+// Blends `color` over a span of pixels. The color must not be fully
+// transparent; callers already handle that trivial case.
+static void blend_color_span(ARGB32* dst, Color color, int width)
+{
+    using AK::SIMD::u32x4;
+    u32x4 const src = u32x4 {} + color.value();
+    int i = 0;
+    for (; i + 4 <= width; i += 4) {
+        u32x4 dst_chunk;
+        __builtin_memcpy(&dst_chunk, &dst[i], sizeof(dst_chunk));
+        u32x4 const blended = blend_four_pixels_dispatch(dst_chunk, src);
+        __builtin_memcpy(&dst[i], &blended, sizeof(blended));
+    }
+    for (; i < width; ++i)
+        dst[i] = Color::from_argb(dst[i]).blend(color).value();
+}
+
 Painter::Painter(Gfx::Bitmap& bitmap)
     : m_target(bitmap)
 {
@@ -122,8 +187,7 @@ void Painter::fill_physical_rect(IntRect const& physical_rect, Color color)
     size_t const dst_skip = m_target->pitch() / sizeof(ARGB32);
 
     for (int i = physical_rect.height() - 1; i >= 0; --i) {
-        for (int j = 0; j < physical_rect.width(); ++j)
-            dst[j] = Color::from_argb(dst[j]).blend(color).value();
+        blend_color_span(dst, color, physical_rect.width());
         dst += dst_skip;
     }
 }
@@ -857,12 +921,37 @@ static void swap_red_and_blue_channels(Color& color)
     color = Color::from_argb(bgra);
 }
 
-// FIXME: This function is very unoptimized.
 template<BlitState::AlphaState has_alpha>
 static void do_blit_with_opacity(BlitState& state)
 {
+    using AK::SIMD::u32x4;
     for (int row = 0; row < state.row_count; ++row) {
-        for (int x = 0; x < state.column_count; ++x) {
+        int x = 0;
+        for (; x + 4 <= state.column_count; x += 4) {
+            u32x4 src_chunk;
+            __builtin_memcpy(&src_chunk, &state.src[x], sizeof(src_chunk));
+            if (state.src_format == BitmapFormat::RGBA8888)
+                src_chunk = (src_chunk & 0xff00ff00) | ((src_chunk & 0xff) << 16) | ((src_chunk >> 16) & 0xff);
+            if constexpr (has_alpha & BlitState::SrcAlpha) {
+                // The per-pixel opacity goes through the same scalar float math
+                // as the loop below, so both paths produce identical alphas.
+                u32x4 alphas;
+                for (int lane = 0; lane < 4; ++lane) {
+                    float pixel_opacity = (src_chunk[lane] >> 24) / 255.0;
+                    alphas[lane] = static_cast<u8>(255 * (state.opacity * pixel_opacity));
+                }
+                src_chunk = (src_chunk & 0x00ffffff) | (alphas << 24);
+            } else {
+                src_chunk = (src_chunk & 0x00ffffff) | (static_cast<u32>(static_cast<u8>(state.opacity * 255)) << 24);
+            }
+            u32x4 dst_chunk;
+            __builtin_memcpy(&dst_chunk, &state.dst[x], sizeof(dst_chunk));
+            if constexpr (!(has_alpha & BlitState::DstAlpha))
+                dst_chunk |= 0xff000000;
+            u32x4 const blended = blend_four_pixels_dispatch(dst_chunk, src_chunk);
+            __builtin_memcpy(&state.dst[x], &blended, sizeof(blended));
+        }
+        for (; x < state.column_count; ++x) {
             Color dest_color = (has_alpha & BlitState::DstAlpha) ? Color::from_argb(state.dst[x]) : Color::from_rgb(state.dst[x]);
             if constexpr (has_alpha & BlitState::SrcAlpha) {
                 Color src_color_with_alpha = Color::from_argb(state.src[x]);
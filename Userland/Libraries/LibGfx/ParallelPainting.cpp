@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/Painter.h>
+#include <LibGfx/ParallelPainting.h>
+#include <LibThreading/ThreadPool.h>
+#include <sched.h>
+
+namespace Gfx {
+
+// Bands smaller than this are painted inline; the fixed cost of waking a
+// worker dwarfs the actual painting for tiny rects.
+static constexpr int minimum_band_area_for_dispatch = 128 * 128;
+static constexpr int band_height = 64;
+
+static Threading::ThreadPool& painting_thread_pool()
+{
+    static Threading::ThreadPool s_pool;
+    return s_pool;
+}
+
+static void paint_bands_of_rect(Bitmap& target, IntRect const& rect, Function<void(Painter&, IntRect const&)> const& paint_band, Atomic<size_t>& remaining_bands)
+{
+    auto clipped_rect = rect.intersected(target.rect());
+    if (clipped_rect.is_empty())
+        return;
+
+    auto paint_one_band = [&target, &paint_band](IntRect const& band) {
+        Painter band_painter(target);
+        band_painter.add_clip_rect(band);
+        paint_band(band_painter, band);
+    };
+
+    if (clipped_rect.width() * clipped_rect.height() < minimum_band_area_for_dispatch) {
+        paint_one_band(clipped_rect);
+        return;
+    }
+
+    for (int band_top = clipped_rect.top(); band_top <= clipped_rect.bottom(); band_top += band_height) {
+        IntRect band {
+            clipped_rect.left(),
+            band_top,
+            clipped_rect.width(),
+            min(band_height, clipped_rect.bottom() - band_top + 1),
+        };
+        remaining_bands.fetch_add(1, AK::memory_order_acq_rel);
+        painting_thread_pool().submit([paint_one_band, band, &remaining_bands] {
+            paint_one_band(band);
+            remaining_bands.fetch_sub(1, AK::memory_order_acq_rel);
+        });
+    }
+}
+
+void paint_in_parallel(Bitmap& target, DisjointIntRectSet const& dirty_rects, Function<void(Painter&, IntRect const&)> const& paint_band)
+{
+    // Waiting on a per-call counter (instead of ThreadPool::wait_for_all())
+    // keeps concurrent callers from blocking on each other's bands.
+    Atomic<size_t> remaining_bands { 0 };
+    for (auto& rect : dirty_rects.rects())
+        paint_bands_of_rect(target, rect, paint_band, remaining_bands);
+    while (remaining_bands.load(AK::memory_order_acquire) != 0)
+        sched_yield();
+}
+
+void paint_in_parallel(Bitmap& target, IntRect const& rect, Function<void(Painter&, IntRect const&)> const& paint_band)
+{
+    Atomic<size_t> remaining_bands { 0 };
+    paint_bands_of_rect(target, rect, paint_band, remaining_bands);
+    while (remaining_bands.load(AK::memory_order_acquire) != 0)
+        sched_yield();
+}
+
+}
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <LibGfx/DisjointRectSet.h>
+#include <LibGfx/Forward.h>
+#include <LibGfx/Rect.h>
+
+namespace Gfx {
+
+// Splits the given rects into horizontal bands and paints the bands on a
+// process-wide thread pool, blocking until every band has been painted.
+// The callback is handed a Painter that is already clipped to its band, so
+// two invocations never touch the same scanline and the callback may write
+// to the target bitmap without further synchronization. The callback itself
+// must be safe to invoke from several threads at once.
+//
+// Rects too small to be worth dispatching are painted inline on the caller's
+// thread, so this is safe to call unconditionally from per-frame paths.
+void paint_in_parallel(Bitmap& target, DisjointIntRectSet const& dirty_rects, Function<void(Painter&, IntRect const& band)> const& paint_band);
+void paint_in_parallel(Bitmap& target, IntRect const&, Function<void(Painter&, IntRect const& band)> const& paint_band);
+
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/QuickSort.h>
+#include <AK/Vector.h>
+#include <LibGfx/ScanlinePathRasterizer.h>
+#include <math.h>
+
+namespace Gfx {
+
+namespace {
+
+struct Edge {
+    // x at the top of the scanline currently being rasterized; stepped
+    // incrementally as the active edge table moves down one scanline.
+    float x;
+    float dxdy;
+    float top_y;
+    float bottom_y;
+    // +1 for edges pointing down in path direction, -1 for edges pointing up.
+    float direction;
+};
+
+}
+
+static u8 coverage_to_alpha(float coverage, Painter::WindingRule winding_rule)
+{
+    if (winding_rule == Painter::WindingRule::Nonzero) {
+        coverage = min(fabsf(coverage), 1.0f);
+    } else {
+        // Even-odd: coverage folds back once the winding count passes one.
+        coverage = fmodf(fabsf(coverage), 2.0f);
+        if (coverage > 1.0f)
+            coverage = 2.0f - coverage;
+    }
+    return static_cast<u8>(coverage * 255.0f + 0.5f);
+}
+
+void ScanlinePathRasterizer::fill(Painter& painter, Path const& path, Color color, Painter::WindingRule winding_rule, AffineTransform const& transform)
+{
+    auto const& lines = path.split_lines();
+    if (lines.is_empty())
+        return;
+
+    Vector<Edge, 32> edges;
+    edges.ensure_capacity(lines.size());
+
+    float min_x = NumericLimits<float>::max();
+    float max_x = NumericLimits<float>::lowest();
+    float min_y = NumericLimits<float>::max();
+    float max_y = NumericLimits<float>::lowest();
+
+    for (auto& line : lines) {
+        auto from = transform.map(line.from);
+        auto to = transform.map(line.to);
+        min_x = min(min_x, min(from.x(), to.x()));
+        max_x = max(max_x, max(from.x(), to.x()));
+        min_y = min(min_y, min(from.y(), to.y()));
+        max_y = max(max_y, max(from.y(), to.y()));
+        if (from.y() == to.y())
+            continue;
+        Edge edge;
+        if (from.y() < to.y()) {
+            edge.top_y = from.y();
+            edge.bottom_y = to.y();
+            edge.x = from.x();
+            edge.direction = 1;
+        } else {
+            edge.top_y = to.y();
+            edge.bottom_y = from.y();
+            edge.x = to.x();
+            edge.direction = -1;
+        }
+        edge.dxdy = (to.x() - from.x()) / (to.y() - from.y());
+        edges.append(edge);
+    }
+
+    if (edges.is_empty())
+        return;
+
+    quick_sort(edges, [](auto const& a, auto const& b) {
+        return a.top_y < b.top_y;
+    });
+
+    int first_scanline = static_cast<int>(floorf(min_y));
+    int last_scanline = static_cast<int>(ceilf(max_y));
+    int left_x = static_cast<int>(floorf(min_x));
+    int width = static_cast<int>(ceilf(max_x)) - left_x + 1;
+    if (width <= 0)
+        return;
+
+    // One accumulation cell per pixel column (plus spill for the right
+    // boundary); a running sum over the row turns the per-cell deltas into
+    // coverage.
+    Vector<float, 64> row_deltas;
+    row_deltas.resize(width + 1);
+
+    Vector<Edge, 16> active_edges;
+    size_t next_edge_index = 0;
+
+    auto accumulate_edge_in_row = [&](Edge& edge, float row_top, float row_bottom) {
+        float y0 = max(row_top, edge.top_y);
+        float y1 = min(row_bottom, edge.bottom_y);
+        float dy = y1 - y0;
+        if (dy <= 0)
+            return;
+        float directed_dy = dy * edge.direction;
+
+        float x_start = edge.x;
+        float x_end = x_start + edge.dxdy * dy;
+        edge.x = x_end;
+
+        float x0 = min(x_start, x_end) - left_x;
+        float x1 = max(x_start, x_end) - left_x;
+        x0 = clamp(x0, 0.0f, static_cast<float>(width - 1));
+        x1 = clamp(x1, 0.0f, static_cast<float>(width - 1));
+
+        float x0_floor = floorf(x0);
+        int x0i = static_cast<int>(x0_floor);
+
+        if (ceilf(x1) <= x0_floor + 1.0f) {
+            // Both crossings are within the same pixel column; split the
+            // signed area around the average crossing point.
+            float area = ((x0 + x1) * 0.5f) - x0_floor;
+            row_deltas[x0i] += directed_dy * (1.0f - area);
+            row_deltas[x0i + 1] += directed_dy * area;
+        } else {
+            float dydx = fabsf(1.0f / edge.dxdy);
+            float x0_right = 1.0f - (x0 - x0_floor);
+            int x1_floor_i = static_cast<int>(floorf(x1));
+            float area_up_to_here = 0.5f * x0_right * x0_right * dydx;
+            row_deltas[x0i] += edge.direction * area_up_to_here;
+            for (int x = x0i + 1; x < x1_floor_i; ++x) {
+                row_deltas[x] += edge.direction * dydx;
+                area_up_to_here += dydx;
+            }
+            row_deltas[x1_floor_i] += edge.direction * (dy - area_up_to_here);
+        }
+    };
+
+    for (int y = first_scanline; y < last_scanline; ++y) {
+        float row_top = y;
+        float row_bottom = y + 1.0f;
+
+        while (next_edge_index < edges.size() && edges[next_edge_index].top_y < row_bottom)
+            active_edges.append(edges[next_edge_index++]);
+
+        if (active_edges.is_empty())
+            continue;
+
+        for (auto& delta : row_deltas)
+            delta = 0;
+        for (auto& edge : active_edges)
+            accumulate_edge_in_row(edge, row_top, row_bottom);
+        active_edges.remove_all_matching([&](auto& edge) { return edge.bottom_y <= row_bottom; });
+
+        float coverage = 0;
+        int opaque_run_start = -1;
+        auto flush_opaque_run = [&](int end_x) {
+            if (opaque_run_start < 0)
+                return;
+            painter.fill_rect({ left_x + opaque_run_start, y, end_x - opaque_run_start, 1 }, color);
+            opaque_run_start = -1;
+        };
+        for (int x = 0; x < width; ++x) {
+            coverage += row_deltas[x];
+            u8 alpha = coverage_to_alpha(coverage, winding_rule);
+            if (alpha == 255 && color.alpha() == 255) {
+                if (opaque_run_start < 0)
+                    opaque_run_start = x;
+                continue;
+            }
+            flush_opaque_run(x);
+            if (alpha == 0)
+                continue;
+            auto pixel_color = color.with_alpha(static_cast<u8>(alpha * color.alpha() / 255));
+            painter.set_pixel(left_x + x, y, pixel_color, true);
+        }
+        flush_opaque_run(width);
+    }
+}
+
+}
@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibGfx/AffineTransform.h>
+#include <LibGfx/Painter.h>
+#include <LibGfx/Path.h>
+
+namespace Gfx {
+
+// Scanline rasterizer for filling a Gfx::Path: edges are bucketed into an
+// active edge table and stepped incrementally from one scanline to the next,
+// and per-pixel coverage is computed analytically from the signed area each
+// edge sweeps within a scanline. This gives antialiased output without
+// supersampling and without re-sorting intersections on every scanline.
+class ScanlinePathRasterizer {
+public:
+    static void fill(Painter&, Path const&, Color, Painter::WindingRule, AffineTransform const&);
+};
+
+}
@@ -94,7 +94,7 @@ Core::AnonymousBuffer load_system_theme(Core::ConfigFile const& file)
         return metric;
     };
 
-    auto get_path = [&](auto& name, auto role, bool allow_empty) {
+    auto get_path = [&](auto& name, auto role, bool allow_empty) -> DeprecatedString {
         auto path = file.read_entry("Paths", name);
         if (path.is_empty()) {
             switch (role) {
@@ -104,7 +104,7 @@ Core::AnonymousBuffer load_system_theme(Core::ConfigFile const& file)
                 return allow_empty ? "" : "/res/";
             }
         }
-        return &path[0];
+        return path;
     };
 
 #undef __ENUMERATE_COLOR_ROLE
@@ -134,7 +134,7 @@ Core::AnonymousBuffer load_system_theme(Core::ConfigFile const& file)
 #define ENCODE_PATH(x, allow_empty)                                                                              \
     do {                                                                                                         \
         auto path = get_path(#x, (int)PathRole::x, allow_empty);                                                 \
-        memcpy(data->path[(int)PathRole::x], path, min(strlen(path) + 1, sizeof(data->path[(int)PathRole::x]))); \
+        memcpy(data->path[(int)PathRole::x], path.characters(), min(path.length() + 1, sizeof(data->path[(int)PathRole::x]))); \
         data->path[(int)PathRole::x][sizeof(data->path[(int)PathRole::x]) - 1] = '\0';                           \
     } while (0)
 
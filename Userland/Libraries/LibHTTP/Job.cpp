@@ -191,8 +191,11 @@ void Job::register_on_ready_to_read(Function<void()> callback)
 
 ErrorOr<DeprecatedString> Job::read_line(size_t size)
 {
-    auto buffer = TRY(ByteBuffer::create_uninitialized(size));
-    auto bytes_read = TRY(m_socket->read_until(buffer, "\r\n"sv));
+    // NOTE: A line is read for every header line and every chunk boundary, so we reuse
+    //       one buffer across calls instead of allocating a fresh one every time.
+    if (m_line_buffer.size() < size)
+        TRY(m_line_buffer.try_resize(size));
+    auto bytes_read = TRY(m_socket->read_until(m_line_buffer.span().trim(size), "\r\n"sv));
     return DeprecatedString::copy(bytes_read);
 }
 
@@ -210,7 +213,10 @@ ErrorOr<ByteBuffer> Job::receive(size_t size)
         nread = TRY(result).size();
         break;
     } while (true);
-    return buffer.slice(0, nread);
+    // NOTE: Shrink the buffer in place instead of copying the read bytes into a
+    //       perfectly-sized allocation; this runs for every received payload.
+    buffer.resize(nread);
+    return buffer;
 }
 
 void Job::on_socket_connected()
@@ -530,9 +536,10 @@ void Job::on_socket_connected()
                 }
             }
 
-            m_received_buffers.append(make<ReceivedBuffer>(payload));
-            m_buffered_size += payload.size();
-            m_received_size += payload.size();
+            auto payload_size = payload.size();
+            m_received_buffers.append(make<ReceivedBuffer>(move(payload)));
+            m_buffered_size += payload_size;
+            m_received_size += payload_size;
             flush_received_buffers();
 
             deferred_invoke([this] { did_progress(m_content_length, m_received_size); });
@@ -552,7 +559,7 @@ void Job::on_socket_connected()
             }
 
             if (m_current_chunk_remaining_size.has_value()) {
-                auto size = m_current_chunk_remaining_size.value() - payload.size();
+                auto size = m_current_chunk_remaining_size.value() - payload_size;
 
                 dbgln_if(JOB_DEBUG, "Job: We have {} bytes left over in this chunk", size);
                 if (size == 0) {
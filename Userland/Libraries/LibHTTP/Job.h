@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
 #include <AK/FileStream.h>
 #include <AK/HashMap.h>
 #include <AK/NonnullOwnPtrVector.h>
@@ -73,6 +74,9 @@ protected:
 
     NonnullOwnPtrVector<ReceivedBuffer> m_received_buffers;
 
+    // Scratch buffer reused by read_line().
+    ByteBuffer m_line_buffer;
+
     size_t m_buffered_size { 0 };
     size_t m_received_size { 0 };
     Optional<u32> m_content_length;
@@ -72,10 +72,15 @@ ErrorOr<void> Client::on_ready_to_receive()
     }
 
     if (m_buffer[m_buffer.size() - 1] == '\n') {
-        // Don't try parsing until we have a complete line.
-        auto response = m_parser.parse(move(m_buffer), m_expecting_response);
-        TRY(handle_parsed_response(move(response)));
-        m_buffer.clear();
+        // Don't try parsing until we have a complete line. A single receive
+        // may carry the responses to several pipelined commands, so keep
+        // parsing until the parser has consumed everything.
+        auto buffer = move(m_buffer);
+        while (!buffer.is_empty()) {
+            auto response = m_parser.parse(move(buffer), !m_pending_promises.is_empty());
+            TRY(handle_parsed_response(move(response)));
+            buffer = m_parser.take_leftover_buffer();
+        }
     }
 
     return {};
@@ -154,14 +159,11 @@ ErrorOr<void> Client::send_raw(StringView data)
 
 RefPtr<Promise<Optional<Response>>> Client::send_command(Command&& command)
 {
-    m_command_queue.append(move(command));
-    m_current_command++;
-
     auto promise = Promise<Optional<Response>>::construct();
-    m_pending_promises.append(promise);
+    m_command_queue.append({ move(command), promise });
+    m_current_command++;
 
-    if (m_pending_promises.size() == 1)
-        MUST(send_next_command());
+    MUST(send_pending_commands());
 
     return promise;
 }
@@ -204,6 +206,117 @@ RefPtr<Promise<Optional<SolidResponse>>> Client::fetch(FetchCommand request, boo
     return cast_promise<SolidResponse>(send_command(move(command)));
 }
 
+RefPtr<Promise<Optional<SolidResponse>>> Client::fetch_chunked(FetchCommand request, bool uid, size_t chunk_size)
+{
+    VERIFY(chunk_size > 0);
+
+    // Carve the sequence set into chunks covering at most chunk_size messages
+    // each. Ranges that end in '*' have no known size and stay unsplit in a
+    // chunk of their own.
+    Vector<Vector<Sequence>> chunks;
+    Vector<Sequence> current_chunk;
+    size_t messages_in_current_chunk = 0;
+    auto flush_chunk = [&] {
+        if (!current_chunk.is_empty()) {
+            chunks.append(move(current_chunk));
+            current_chunk = {};
+            messages_in_current_chunk = 0;
+        }
+    };
+    for (auto const& sequence : request.sequence_set) {
+        if (sequence.start < 0 || sequence.end < 0) {
+            flush_chunk();
+            chunks.append(Vector<Sequence> { sequence });
+            continue;
+        }
+        auto start = min(sequence.start, sequence.end);
+        auto end = max(sequence.start, sequence.end);
+        while (start <= end) {
+            auto taken = min(static_cast<size_t>(end - start) + 1, chunk_size - messages_in_current_chunk);
+            current_chunk.append({ start, static_cast<int>(start + taken) - 1 });
+            messages_in_current_chunk += taken;
+            if (messages_in_current_chunk == chunk_size)
+                flush_chunk();
+            start += taken;
+        }
+    }
+    flush_chunk();
+
+    if (chunks.size() <= 1)
+        return fetch(move(request), uid);
+
+    struct ChunkedFetchState : public RefCounted<ChunkedFetchState> {
+        Optional<SolidResponse> merged_response;
+        size_t outstanding_chunks { 0 };
+        bool failed { false };
+    };
+    auto state = adopt_ref(*new ChunkedFetchState);
+    state->outstanding_chunks = chunks.size();
+    auto result_promise = Promise<Optional<SolidResponse>>::construct();
+
+    for (auto& chunk : chunks) {
+        auto chunk_promise = fetch(FetchCommand { move(chunk), request.data_items }, uid);
+        chunk_promise->on_resolved = [state, result_promise](Optional<SolidResponse>& response) {
+            if (state->failed)
+                return;
+            if (!response.has_value()) {
+                state->failed = true;
+                result_promise->resolve({});
+                return;
+            }
+            // The merged response takes its status and text from the first
+            // chunk; the remaining chunks only contribute their FETCH data.
+            if (!state->merged_response.has_value()) {
+                state->merged_response = move(response);
+            } else if (response->data().contains_response_type(ResponseType::Fetch)) {
+                for (auto& fetch_response : response->data().fetch_data())
+                    state->merged_response->data().add_fetch_response(fetch_response.get<0>(), move(fetch_response.get<1>()));
+            }
+            if (--state->outstanding_chunks == 0)
+                result_promise->resolve(move(state->merged_response));
+        };
+    }
+    return result_promise;
+}
+
+void Client::update_metadata_cache(SolidResponse& response)
+{
+    auto& data = response.data();
+    if (data.contains_response_type(ResponseType::UIDValidity)) {
+        // A changed UIDVALIDITY invalidates every UID we've cached.
+        if (data.uid_validity() != m_metadata_cache.uid_validity) {
+            m_metadata_cache.uid_validity = data.uid_validity();
+            m_metadata_cache.entries.clear();
+        }
+    }
+    if (!data.contains_response_type(ResponseType::Fetch))
+        return;
+    for (auto& fetch_response : data.fetch_data()) {
+        auto& fetch_data = fetch_response.get<1>();
+        if (!fetch_data.contains_response_type(FetchResponseType::UID))
+            continue;
+        bool has_envelope = fetch_data.contains_response_type(FetchResponseType::Envelope);
+        bool has_body_structure = fetch_data.contains_response_type(FetchResponseType::BodyStructure);
+        if (!has_envelope && !has_body_structure)
+            continue;
+        auto& entry = m_metadata_cache.entries.ensure(fetch_data.uid());
+        if (has_envelope)
+            entry.envelope = fetch_data.envelope();
+        if (has_body_structure)
+            entry.body_structure = fetch_data.body_structure().clone();
+    }
+}
+
+Client::CachedMessageMetadata const* Client::cached_message_metadata(unsigned uid_validity, unsigned uid) const
+{
+    if (uid_validity == 0 || uid_validity != m_metadata_cache.uid_validity)
+        return nullptr;
+    auto it = m_metadata_cache.entries.find(uid);
+    if (it == m_metadata_cache.entries.end())
+        return nullptr;
+    return &it->value;
+}
+
 RefPtr<Promise<Optional<Response>>> Client::send_simple_command(CommandType type)
 {
     auto command = Command { type, m_current_command, {} };
@@ -218,50 +331,84 @@ RefPtr<Promise<Optional<SolidResponse>>> Client::select(StringView string)
 
 ErrorOr<void> Client::handle_parsed_response(ParseStatus&& parse_status)
 {
-    if (!m_expecting_response) {
+    if (m_pending_promises.is_empty()) {
         if (!parse_status.successful) {
             dbgln("Parsing failed on unrequested data!");
         } else if (parse_status.response.has_value()) {
             unrequested_response_callback(move(parse_status.response.value().get<SolidResponse>().data()));
         }
-    } else {
-        bool should_send_next = false;
-        if (!parse_status.successful) {
-            m_expecting_response = false;
-            m_pending_promises.first()->resolve({});
-            m_pending_promises.remove(0);
-        }
-        if (parse_status.response.has_value()) {
-            m_expecting_response = false;
-            should_send_next = parse_status.response->has<SolidResponse>();
-            m_pending_promises.first()->resolve(move(parse_status.response));
-            m_pending_promises.remove(0);
-        }
+        return {};
+    }
 
-        if (should_send_next && !m_command_queue.is_empty()) {
-            TRY(send_next_command());
+    if (!parse_status.successful) {
+        auto& first = m_pending_promises.first();
+        if (first.tag.has_value() && first.tag == m_blocking_command_tag)
+            m_blocking_command_tag = {};
+        first.promise->resolve({});
+        m_pending_promises.remove(0);
+        return {};
+    }
+    if (!parse_status.response.has_value()) {
+        // The response is incomplete; wait for more data.
+        return {};
+    }
+
+    // Continuation requests carry no tag and always belong to the oldest
+    // command in flight; tagged responses are correlated back to the command
+    // that carried that tag.
+    size_t promise_index = 0;
+    bool should_send_next = false;
+    if (parse_status.response->has<SolidResponse>()) {
+        auto& response = parse_status.response->get<SolidResponse>();
+        for (size_t i = 0; i < m_pending_promises.size(); ++i) {
+            auto const& tag = m_pending_promises[i].tag;
+            if (tag.has_value() && tag.value() == response.tag()) {
+                promise_index = i;
+                break;
+            }
         }
+        if (m_blocking_command_tag == response.tag())
+            m_blocking_command_tag = {};
+        update_metadata_cache(response);
+        should_send_next = true;
     }
+    m_pending_promises[promise_index].promise->resolve(move(parse_status.response));
+    m_pending_promises.remove(promise_index);
+
+    if (should_send_next)
+        TRY(send_pending_commands());
 
     return {};
 }
 
-ErrorOr<void> Client::send_next_command()
+ErrorOr<void> Client::send_pending_commands()
 {
-    auto command = m_command_queue.take_first();
-    ByteBuffer buffer;
-    auto tag = AK::DeprecatedString::formatted("A{} ", m_current_command);
-    buffer += tag.to_byte_buffer();
-    auto command_type = command_byte_buffer(command.type);
-    buffer.append(command_type.data(), command_type.size());
+    // Queued commands are pipelined: each one is sent without waiting for the
+    // previous response, and the responses are correlated back by tag.
+    // Commands that expect a continuation request stall the pipeline until
+    // their tagged response arrives, since the server won't make progress
+    // past them either.
+    while (!m_command_queue.is_empty() && m_pending_promises.size() < max_pipelined_commands && !m_blocking_command_tag.has_value()) {
+        auto queued = m_command_queue.take_first();
+        auto& command = queued.command;
 
-    for (auto& arg : command.args) {
-        buffer.append(" ", 1);
-        buffer.append(arg.bytes().data(), arg.length());
-    }
+        ByteBuffer buffer;
+        auto tag = AK::DeprecatedString::formatted("A{} ", command.tag);
+        buffer += tag.to_byte_buffer();
+        auto command_type = command_byte_buffer(command.type);
+        buffer.append(command_type.data(), command_type.size());
+
+        for (auto& arg : command.args) {
+            buffer.append(" ", 1);
+            buffer.append(arg.bytes().data(), arg.length());
+        }
 
-    TRY(send_raw(buffer));
-    m_expecting_response = true;
+        if (command.type == CommandType::Idle || command.type == CommandType::Authenticate || command.type == CommandType::Append)
+            m_blocking_command_tag = command.tag;
+
+        m_pending_promises.append({ move(queued.promise), command.tag });
+        TRY(send_raw(buffer));
+    }
     return {};
 }
 
@@ -331,9 +478,9 @@ RefPtr<Promise<Optional<ContinueRequest>>> Client::idle()
 RefPtr<Promise<Optional<SolidResponse>>> Client::finish_idle()
 {
     auto promise = Promise<Optional<Response>>::construct();
-    m_pending_promises.append(promise);
+    // The server answers DONE with the tagged response of the IDLE command.
+    m_pending_promises.append({ promise, m_blocking_command_tag });
     MUST(send_raw("DONE"sv));
-    m_expecting_response = true;
     return cast_promise<SolidResponse>(promise);
 }
 
@@ -382,17 +529,19 @@ RefPtr<Promise<Optional<SolidResponse>>> Client::append(StringView mailbox, Mess
 
     args.append(DeprecatedString::formatted("{{{}}}", message.data.length()));
 
-    auto continue_req = send_command(Command { CommandType::Append, m_current_command, args });
+    auto tag = m_current_command;
+    auto continue_req = send_command(Command { CommandType::Append, tag, args });
 
     auto response_promise = Promise<Optional<Response>>::construct();
-    m_pending_promises.append(response_promise);
 
-    continue_req->on_resolved = [this, message2 { move(message) }](auto& data) {
+    continue_req->on_resolved = [this, message2 { move(message) }, response_promise, tag](auto& data) {
         if (!data.has_value()) {
-            MUST(handle_parsed_response({ .successful = false, .response = {} }));
+            response_promise->resolve({});
         } else {
+            // The message literal is answered with the APPEND's tagged
+            // response, so only register the promise once we actually send it.
+            m_pending_promises.append({ response_promise, tag });
             MUST(send_raw(message2.data));
-            m_expecting_response = true;
         }
     };
 
@@ -41,6 +41,10 @@ public:
     RefPtr<Promise<Optional<SolidResponse>>> examine(StringView string);
     RefPtr<Promise<Optional<SolidResponse>>> search(Optional<DeprecatedString> charset, Vector<SearchKey>&& search_keys, bool uid);
     RefPtr<Promise<Optional<SolidResponse>>> fetch(FetchCommand request, bool uid);
+    // Splits a large FETCH into pipelined commands covering at most
+    // chunk_size messages each, and resolves with all of the FETCH responses
+    // merged once the last chunk completes.
+    RefPtr<Promise<Optional<SolidResponse>>> fetch_chunked(FetchCommand request, bool uid, size_t chunk_size);
     RefPtr<Promise<Optional<SolidResponse>>> store(StoreMethod, Sequence, bool silent, Vector<DeprecatedString> const& flags, bool uid);
     RefPtr<Promise<Optional<SolidResponse>>> copy(Sequence sequence_set, StringView name, bool uid);
     RefPtr<Promise<Optional<SolidResponse>>> create_mailbox(StringView name);
@@ -57,6 +61,15 @@ public:
     bool is_open();
     void close();
 
+    struct CachedMessageMetadata {
+        Optional<Envelope> envelope;
+        Optional<BodyStructure> body_structure;
+    };
+    // Returns the cached ENVELOPE/BODYSTRUCTURE data for the given UID if the
+    // mailbox's UIDVALIDITY still matches the one the cache was filled under,
+    // so resyncs can skip refetching metadata for messages we've seen before.
+    CachedMessageMetadata const* cached_message_metadata(unsigned uid_validity, unsigned uid) const;
+
     Function<void(ResponseData&&)> unrequested_response_callback;
 
 private:
@@ -67,7 +80,8 @@ private:
     ErrorOr<void> on_tls_ready_to_receive();
 
     ErrorOr<void> handle_parsed_response(ParseStatus&& parse_status);
-    ErrorOr<void> send_next_command();
+    ErrorOr<void> send_pending_commands();
+    void update_metadata_cache(SolidResponse&);
 
     StringView m_host;
     u16 m_port;
@@ -77,14 +91,35 @@ private:
 
     int m_current_command = 1;
 
+    // How many commands may be in flight at once; responses are correlated
+    // back to their promises by tag, so the exact depth only bounds how much
+    // the server has to buffer.
+    static constexpr size_t max_pipelined_commands = 16;
+
+    struct PendingPromise {
+        RefPtr<Promise<Optional<Response>>> promise;
+        Optional<int> tag;
+    };
+    struct QueuedCommand {
+        Command command;
+        RefPtr<Promise<Optional<Response>>> promise;
+    };
+
     // Sent but response not received
-    Vector<RefPtr<Promise<Optional<Response>>>> m_pending_promises;
+    Vector<PendingPromise> m_pending_promises;
     // Not yet sent
-    Vector<Command> m_command_queue {};
+    Vector<QueuedCommand> m_command_queue {};
+    // Tag of a command that expects a continuation request (IDLE, APPEND,
+    // AUTHENTICATE); nothing else is sent until its tagged response arrives.
+    Optional<int> m_blocking_command_tag {};
+
+    struct MessageMetadataCache {
+        unsigned uid_validity { 0 };
+        HashMap<unsigned, CachedMessageMetadata> entries;
+    };
+    MessageMetadataCache m_metadata_cache;
 
     ByteBuffer m_buffer;
     Parser m_parser {};
-
-    bool m_expecting_response { false };
 };
 }
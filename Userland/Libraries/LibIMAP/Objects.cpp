@@ -113,6 +113,76 @@ DeprecatedString FetchCommand::serialize()
 
     return AK::DeprecatedString::formatted("{} ({})", sequence_builder.build(), data_items_builder.build());
 }
+BodyExtension BodyExtension::clone() const
+{
+    return data.visit(
+        [](Vector<OwnPtr<BodyExtension>> const& extensions) -> BodyExtension {
+            Vector<OwnPtr<BodyExtension>> cloned_extensions;
+            cloned_extensions.ensure_capacity(extensions.size());
+            for (auto const& extension : extensions)
+                cloned_extensions.unchecked_append(extension ? make<BodyExtension>(extension->clone()) : OwnPtr<BodyExtension> {});
+            return BodyExtension { move(cloned_extensions) };
+        },
+        [](auto const& value) -> BodyExtension {
+            return BodyExtension { value };
+        });
+}
+
+static Optional<Vector<BodyExtension>> clone_extensions(Optional<Vector<BodyExtension>> const& extensions)
+{
+    if (!extensions.has_value())
+        return {};
+    Vector<BodyExtension> cloned_extensions;
+    cloned_extensions.ensure_capacity(extensions->size());
+    for (auto const& extension : *extensions)
+        cloned_extensions.unchecked_append(extension.clone());
+    return cloned_extensions;
+}
+
+BodyStructureData BodyStructureData::clone() const
+{
+    return {
+        type,
+        subtype,
+        id,
+        desc,
+        encoding,
+        fields,
+        bytes,
+        lines,
+        envelope,
+        md5,
+        disposition,
+        langs,
+        location,
+        clone_extensions(extensions),
+    };
+}
+
+MultiPartBodyStructureData MultiPartBodyStructureData::clone() const
+{
+    Vector<OwnPtr<BodyStructure>> cloned_bodies;
+    cloned_bodies.ensure_capacity(bodies.size());
+    for (auto const& body : bodies)
+        cloned_bodies.unchecked_append(body ? make<BodyStructure>(body->clone()) : OwnPtr<BodyStructure> {});
+    return {
+        disposition,
+        move(cloned_bodies),
+        langs,
+        media_type,
+        params,
+        location,
+        clone_extensions(extensions),
+    };
+}
+
+BodyStructure BodyStructure::clone() const
+{
+    return m_data.visit(
+        [](BodyStructureData const& data) { return BodyStructure(data.clone()); },
+        [](MultiPartBodyStructureData const& data) { return BodyStructure(data.clone()); });
+}
+
 DeprecatedString serialize_astring(StringView string)
 {
     // Try to send an atom
@@ -193,6 +193,8 @@ class BodyStructure;
 
 struct BodyExtension {
     AK::Variant<Optional<DeprecatedString>, unsigned, Vector<OwnPtr<BodyExtension>>> data;
+
+    [[nodiscard]] BodyExtension clone() const;
 };
 
 struct MultiPartBodyStructureData {
@@ -203,6 +205,8 @@ struct MultiPartBodyStructureData {
     Optional<HashMap<DeprecatedString, DeprecatedString>> params;
     Optional<DeprecatedString> location;
     Optional<Vector<BodyExtension>> extensions;
+
+    [[nodiscard]] MultiPartBodyStructureData clone() const;
 };
 
 struct BodyStructureData {
@@ -222,6 +226,8 @@ struct BodyStructureData {
     Optional<DeprecatedString> location {};
 
     Optional<Vector<BodyExtension>> extensions {};
+
+    [[nodiscard]] BodyStructureData clone() const;
 };
 
 class BodyStructure {
@@ -240,6 +246,10 @@ public:
 
     AK::Variant<BodyStructureData, MultiPartBodyStructureData> const& data() const { return m_data; }
 
+    // Body structures own their multipart children through OwnPtrs, so they
+    // can't be copied implicitly; clone() performs the deep copy explicitly.
+    [[nodiscard]] BodyStructure clone() const;
+
 private:
     AK::Variant<BodyStructureData, MultiPartBodyStructureData> m_data;
 };
@@ -18,6 +18,7 @@ ParseStatus Parser::parse(ByteBuffer&& buffer, bool expecting_tag)
         m_buffer = move(buffer);
         position = 0;
         m_response = SolidResponse();
+        m_parsing_failed = false;
     }
 
     if (try_consume("+"sv)) {
@@ -46,6 +47,17 @@ ParseStatus Parser::parse(ByteBuffer&& buffer, bool expecting_tag)
     }
 }
 
+ByteBuffer Parser::take_leftover_buffer()
+{
+    ByteBuffer leftover;
+    if (!m_incomplete && !m_parsing_failed && position < m_buffer.size()) {
+        leftover = MUST(m_buffer.slice(position, m_buffer.size() - position));
+        m_buffer.clear();
+        position = 0;
+    }
+    return leftover;
+}
+
 bool Parser::try_consume(StringView x)
 {
     size_t i = 0;
@@ -21,6 +21,10 @@ struct ParseStatus {
 class Parser {
 public:
     ParseStatus parse(ByteBuffer&& buffer, bool expecting_tag);
+    // A single receive may contain several responses when commands are
+    // pipelined; this hands back whatever parse() didn't consume so the
+    // caller can feed it through again.
+    ByteBuffer take_leftover_buffer();
 
 private:
     static MailboxFlag parse_mailbox_flag(StringView);
@@ -9,6 +9,7 @@
 #include <LibIPC/Connection.h>
 #include <LibIPC/Stub.h>
 #include <sys/select.h>
+#include <sys/uio.h>
 
 namespace IPC {
 
@@ -30,6 +31,13 @@ ConnectionBase::ConnectionBase(IPC::Stub& local_stub, NonnullOwnPtr<Core::Stream
     m_responsiveness_timer = Core::Timer::create_single_shot(3000, [this] { may_have_become_unresponsive(); });
 }
 
+ConnectionBase::~ConnectionBase()
+{
+    // The scheduled flush keeps us alive, so it only gets skipped if the event
+    // loop never ran again; make sure queued messages still go out in that case.
+    (void)flush_outgoing_messages();
+}
+
 void ConnectionBase::set_deferred_invoker(NonnullOwnPtr<DeferredInvoker> deferred_invoker)
 {
     m_deferred_invoker = move(deferred_invoker);
@@ -70,39 +78,90 @@ ErrorOr<void> ConnectionBase::post_message(MessageBuffer buffer)
         }
     }
 
-    ReadonlyBytes bytes_to_write { buffer.data.span() };
+    m_unsent_bytes += buffer.data.size();
+    m_unsent_messages.append(move(buffer));
+
+    // Batch up outgoing messages and write them all out with a single writev()
+    // once the current event loop turn is over. This turns e.g. a burst of input
+    // events from WindowServer into one syscall instead of one per message.
+    // Don't let the queue grow without bound if the event loop is busy, though.
+    static constexpr size_t maximum_unsent_bytes = 64 * KiB;
+    if (m_unsent_bytes >= maximum_unsent_bytes)
+        return flush_outgoing_messages();
+
+    if (!m_flush_scheduled) {
+        m_flush_scheduled = true;
+        m_deferred_invoker->schedule([strong_this = NonnullRefPtr(*this)] {
+            strong_this->m_flush_scheduled = false;
+            if (auto result = strong_this->flush_outgoing_messages(); result.is_error())
+                dbgln("IPC::ConnectionBase::post_message: Failed to flush: {}", result.error());
+        });
+    }
+
+    return {};
+}
+
+ErrorOr<void> ConnectionBase::flush_outgoing_messages()
+{
+    if (m_unsent_messages.is_empty())
+        return {};
+
+    auto messages = move(m_unsent_messages);
+    m_unsent_bytes = 0;
+
+    if (!m_socket->is_open())
+        return Error::from_string_literal("Trying to flush queued messages during IPC shutdown");
+
+    // NOTE: We bypass Core::Stream here; it has no scatter/gather writes.
+    auto socket_fd = m_socket->fd().value();
+
+    size_t message_index = 0;
+    size_t bytes_written_into_current_message = 0;
     int writes_done = 0;
-    size_t initial_size = bytes_to_write.size();
-    while (!bytes_to_write.is_empty()) {
-        auto maybe_nwritten = m_socket->write(bytes_to_write);
+    while (message_index < messages.size()) {
+        static constexpr size_t maximum_iovecs_per_write = 64;
+        struct iovec iovecs[maximum_iovecs_per_write];
+        size_t iovec_count = 0;
+        for (size_t i = message_index; i < messages.size() && iovec_count < maximum_iovecs_per_write; ++i) {
+            size_t offset_into_message = (i == message_index) ? bytes_written_into_current_message : 0;
+            iovecs[iovec_count].iov_base = const_cast<u8*>(messages[i].data.data() + offset_into_message);
+            iovecs[iovec_count].iov_len = messages[i].data.size() - offset_into_message;
+            ++iovec_count;
+        }
+
+        auto nwritten = ::writev(socket_fd, iovecs, iovec_count);
         writes_done++;
-        if (maybe_nwritten.is_error()) {
-            auto error = maybe_nwritten.release_error();
-            if (error.is_errno()) {
-                // FIXME: This is a hacky way to at least not crash on large messages
-                // The limit of 100 writes is arbitrary, and there to prevent indefinite spinning on the EventLoop
-                if (error.code() == EAGAIN && writes_done < 100) {
-                    sched_yield();
-                    continue;
-                }
-                shutdown_with_error(error);
-                switch (error.code()) {
-                case EPIPE:
-                    return Error::from_string_literal("IPC::Connection::post_message: Disconnected from peer");
-                case EAGAIN:
-                    return Error::from_string_literal("IPC::Connection::post_message: Peer buffer overflowed");
-                default:
-                    return Error::from_syscall("IPC::Connection::post_message write"sv, -error.code());
-                }
-            } else {
-                return error;
+        if (nwritten < 0) {
+            // FIXME: This is a hacky way to at least not crash on large messages
+            // The limit of 100 writes is arbitrary, and there to prevent indefinite spinning on the EventLoop
+            if (errno == EAGAIN && writes_done < 100) {
+                sched_yield();
+                continue;
+            }
+            auto error = Error::from_errno(errno);
+            shutdown_with_error(error);
+            switch (error.code()) {
+            case EPIPE:
+                return Error::from_string_literal("IPC::Connection::flush_outgoing_messages: Disconnected from peer");
+            case EAGAIN:
+                return Error::from_string_literal("IPC::Connection::flush_outgoing_messages: Peer buffer overflowed");
+            default:
+                return Error::from_syscall("IPC::Connection::flush_outgoing_messages writev"sv, -error.code());
             }
         }
 
-        bytes_to_write = bytes_to_write.slice(maybe_nwritten.value());
-    }
-    if (writes_done > 1) {
-        dbgln("LibIPC::Connection FIXME Warning, needed {} writes needed to send message of size {}B, this is pretty bad, as it spins on the EventLoop", writes_done, initial_size);
+        auto bytes_to_account_for = static_cast<size_t>(nwritten);
+        while (bytes_to_account_for > 0) {
+            size_t remaining_in_current_message = messages[message_index].data.size() - bytes_written_into_current_message;
+            if (bytes_to_account_for >= remaining_in_current_message) {
+                bytes_to_account_for -= remaining_in_current_message;
+                ++message_index;
+                bytes_written_into_current_message = 0;
+            } else {
+                bytes_written_into_current_message += bytes_to_account_for;
+                bytes_to_account_for = 0;
+            }
+        }
     }
 
     m_responsiveness_timer->start();
@@ -111,6 +170,9 @@ ErrorOr<void> ConnectionBase::post_message(MessageBuffer buffer)
 
 void ConnectionBase::shutdown()
 {
+    // Flushing moves the queue out before writing, so this can't recurse even if
+    // the flush itself fails and ends up back here via shutdown_with_error().
+    (void)flush_outgoing_messages();
     m_socket->close();
     die();
 }
@@ -246,6 +308,11 @@ OwnPtr<IPC::Message> ConnectionBase::wait_for_specific_endpoint_message_impl(u32
         if (!m_socket->is_open())
             break;
 
+        // The message we're waiting for might be the response to something that's
+        // still sitting in the outgoing queue; get it onto the wire before blocking.
+        if (flush_outgoing_messages().is_error())
+            break;
+
         wait_for_socket_to_become_readable();
         if (drain_messages_from_peer().is_error())
             break;
@@ -38,7 +38,7 @@ class ConnectionBase : public Core::Object {
     C_OBJECT_ABSTRACT(ConnectionBase);
 
 public:
-    virtual ~ConnectionBase() override = default;
+    virtual ~ConnectionBase() override;
 
     void set_fd_passing_socket(NonnullOwnPtr<Core::Stream::LocalSocket>);
     void set_deferred_invoker(NonnullOwnPtr<DeferredInvoker>);
@@ -46,6 +46,11 @@ public:
     bool is_open() const { return m_socket->is_open(); }
     ErrorOr<void> post_message(Message const&);
 
+    // Messages posted with post_message() are batched up and only written out once
+    // per event loop turn (or when enough bytes have accumulated). This forces any
+    // queued messages onto the wire right away.
+    ErrorOr<void> flush_outgoing_messages();
+
     void shutdown();
     virtual void die() { }
 
@@ -78,6 +83,10 @@ protected:
     NonnullOwnPtrVector<Message> m_unprocessed_messages;
     ByteBuffer m_unprocessed_bytes;
 
+    Vector<MessageBuffer> m_unsent_messages;
+    size_t m_unsent_bytes { 0 };
+    bool m_flush_scheduled { false };
+
     u32 m_local_endpoint_magic { 0 };
 
     NonnullOwnPtr<DeferredInvoker> m_deferred_invoker;
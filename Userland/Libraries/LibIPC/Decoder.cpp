@@ -109,6 +109,38 @@ ErrorOr<void> Decoder::decode(DeprecatedString& value)
     return m_stream.try_handle_any_error();
 }
 
+ErrorOr<void> Decoder::decode(StringView& value)
+{
+    i32 length;
+    TRY(decode(length));
+
+    if (length < 0) {
+        value = {};
+        return {};
+    }
+    if (m_stream.remaining() < static_cast<size_t>(length))
+        return Error::from_string_literal("IPC: Truncated borrowed string");
+    value = StringView { m_stream.bytes().slice(m_stream.offset(), static_cast<size_t>(length)) };
+    m_stream.discard_or_error(static_cast<size_t>(length));
+    return m_stream.try_handle_any_error();
+}
+
+ErrorOr<void> Decoder::decode(ReadonlyBytes& value)
+{
+    i32 length;
+    TRY(decode(length));
+
+    if (length < 0) {
+        value = {};
+        return {};
+    }
+    if (m_stream.remaining() < static_cast<size_t>(length))
+        return Error::from_string_literal("IPC: Truncated borrowed buffer");
+    value = m_stream.bytes().slice(m_stream.offset(), static_cast<size_t>(length));
+    m_stream.discard_or_error(static_cast<size_t>(length));
+    return m_stream.try_handle_any_error();
+}
+
 ErrorOr<void> Decoder::decode(ByteBuffer& value)
 {
     i32 length;
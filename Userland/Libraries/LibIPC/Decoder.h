@@ -50,6 +50,10 @@ public:
     ErrorOr<void> decode(float&);
     ErrorOr<void> decode(double&);
     ErrorOr<void> decode(DeprecatedString&);
+    // Borrowed views into the message payload; only valid as long as the
+    // decoded message (which pins the payload) is alive.
+    ErrorOr<void> decode(StringView&);
+    ErrorOr<void> decode(ReadonlyBytes&);
     ErrorOr<void> decode(ByteBuffer&);
     ErrorOr<void> decode(JsonValue&);
     ErrorOr<void> decode(URL&);
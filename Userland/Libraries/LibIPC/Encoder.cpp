@@ -142,6 +142,7 @@ Encoder& Encoder::operator<<(char const* value)
 
 Encoder& Encoder::operator<<(StringView value)
 {
+    *this << static_cast<i32>(value.length());
     m_buffer.data.append((u8 const*)value.characters_without_null_termination(), value.length());
     return *this;
 }
@@ -150,11 +151,15 @@ Encoder& Encoder::operator<<(DeprecatedString const& value)
 {
     if (value.is_null())
         return *this << (i32)-1;
-    *this << static_cast<i32>(value.length());
     return *this << value.view();
 }
 
 Encoder& Encoder::operator<<(ByteBuffer const& value)
+{
+    return *this << value.bytes();
+}
+
+Encoder& Encoder::operator<<(ReadonlyBytes value)
 {
     *this << static_cast<i32>(value.size());
     m_buffer.data.append(value.data(), value.size());
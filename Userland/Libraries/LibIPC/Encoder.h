@@ -46,6 +46,7 @@ public:
     Encoder& operator<<(StringView);
     Encoder& operator<<(DeprecatedString const&);
     Encoder& operator<<(ByteBuffer const&);
+    Encoder& operator<<(ReadonlyBytes);
     Encoder& operator<<(JsonValue const&);
     Encoder& operator<<(URL const&);
     Encoder& operator<<(Dictionary const&);
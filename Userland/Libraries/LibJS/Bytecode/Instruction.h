@@ -50,7 +50,15 @@
     O(IteratorToArray)               \
     O(Jump)                          \
     O(JumpConditional)               \
+    O(JumpGreaterThan)               \
+    O(JumpGreaterThanEquals)         \
+    O(JumpLessThan)                  \
+    O(JumpLessThanEquals)            \
+    O(JumpLooselyEquals)             \
+    O(JumpLooselyInequals)           \
     O(JumpNullish)                   \
+    O(JumpStrictlyEquals)            \
+    O(JumpStrictlyInequals)          \
     O(JumpUndefined)                 \
     O(LeaveEnvironment)              \
     O(LeaveUnwindContext)            \
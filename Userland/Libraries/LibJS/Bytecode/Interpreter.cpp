@@ -76,17 +76,56 @@ Interpreter::ValueAndFrame Interpreter::run_and_return_frame(Executable const& e
 
         bool will_jump = false;
         bool will_return = false;
-        while (!pc.at_end()) {
-            auto& instruction = *pc;
-            auto ran_or_error = instruction.execute(*this);
-            if (ran_or_error.is_error()) {
-                auto exception_value = *ran_or_error.throw_completion().value();
-                m_saved_exception = make_handle(exception_value);
-                if (unwind_contexts().is_empty())
-                    break;
-                auto& unwind_context = unwind_contexts().last();
-                if (unwind_context.executable != m_current_executable)
-                    break;
+        Value exception_value;
+
+        // Instruction dispatch is threaded: every opcode has its own handler
+        // label (generated from ENUMERATE_BYTECODE_OPS), and each handler
+        // jumps straight to the next instruction's handler through the
+        // dispatch table instead of going back through a central switch.
+        static void* const dispatch_table[] = {
+#define __BYTECODE_OP(op) &&execute_##op,
+            ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+        };
+
+#define DISPATCH_NEXT()                                                 \
+    do {                                                                \
+        if (pc.at_end())                                                \
+            goto block_finished;                                        \
+        goto* dispatch_table[to_underlying((*pc).type())];              \
+    } while (0)
+
+        DISPATCH_NEXT();
+
+#define __BYTECODE_OP(op)                                                            \
+    execute_##op : {                                                                 \
+        auto ran_or_error = static_cast<Op::op const&>(*pc).execute_impl(*this);     \
+        if (ran_or_error.is_error()) [[unlikely]] {                                  \
+            exception_value = *ran_or_error.throw_completion().value();              \
+            goto handle_exception;                                                   \
+        }                                                                            \
+        if (m_pending_jump.has_value()) [[unlikely]] {                               \
+            m_current_block = m_pending_jump.release_value();                        \
+            will_jump = true;                                                        \
+            goto block_finished;                                                     \
+        }                                                                            \
+        if (!m_return_value.is_empty()) [[unlikely]] {                               \
+            will_return = true;                                                      \
+            goto block_finished;                                                     \
+        }                                                                            \
+        ++pc;                                                                        \
+        DISPATCH_NEXT();                                                             \
+    }
+
+        ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+#undef DISPATCH_NEXT
+
+    handle_exception:
+        m_saved_exception = make_handle(exception_value);
+        if (!unwind_contexts().is_empty()) {
+            auto& unwind_context = unwind_contexts().last();
+            if (unwind_context.executable == m_current_executable) {
                 if (unwind_context.handler) {
                     m_current_block = unwind_context.handler;
                     unwind_context.handler = nullptr;
@@ -94,29 +133,19 @@ Interpreter::ValueAndFrame Interpreter::run_and_return_frame(Executable const& e
                     accumulator() = exception_value;
                     m_saved_exception = {};
                     will_jump = true;
-                    break;
-                }
-                if (unwind_context.finalizer) {
+                } else if (unwind_context.finalizer) {
                     m_current_block = unwind_context.finalizer;
                     will_jump = true;
-                    break;
+                } else {
+                    // An unwind context with no handler or finalizer? We have nowhere to jump, and continuing on will make us crash on the next `Call` to a non-native function if there's an exception! So let's crash here instead.
+                    // If you run into this, you probably forgot to remove the current unwind_context somewhere.
+                    VERIFY_NOT_REACHED();
                 }
-                // An unwind context with no handler or finalizer? We have nowhere to jump, and continuing on will make us crash on the next `Call` to a non-native function if there's an exception! So let's crash here instead.
-                // If you run into this, you probably forgot to remove the current unwind_context somewhere.
-                VERIFY_NOT_REACHED();
-            }
-            if (m_pending_jump.has_value()) {
-                m_current_block = m_pending_jump.release_value();
-                will_jump = true;
-                break;
             }
-            if (!m_return_value.is_empty()) {
-                will_return = true;
-                break;
-            }
-            ++pc;
         }
 
+    block_finished:;
+
         if (will_jump)
             continue;
 
@@ -255,6 +284,9 @@ Bytecode::PassManager& Interpreter::optimization_pipeline(Interpreter::Optimizat
         pm->add<Passes::GenerateCFG>();
         pm->add<Passes::PlaceBlocks>();
         pm->add<Passes::EliminateLoads>();
+        pm->add<Passes::FoldConstants>();
+        pm->add<Passes::Peephole>();
+        pm->add<Passes::EliminateDeadStores>();
     } else {
         VERIFY_NOT_REACHED();
     }
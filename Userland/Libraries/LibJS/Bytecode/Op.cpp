@@ -48,6 +48,17 @@ DeprecatedString Instruction::to_deprecated_string(Bytecode::Executable const& e
 
 namespace JS::Bytecode::Op {
 
+// Inline caches for GetById/PutById only remember own data properties of
+// non-unique shapes: unique shapes mutate in place, so a matching shape
+// pointer wouldn't guarantee a stable storage offset. Empty slots (lazily
+// materialized intrinsics) and accessors always take the generic path.
+enum class RequireWritable {
+    No,
+    Yes,
+};
+
+static void fill_property_lookup_cache(Object const&, PropertyKey const&, WeakPtr<Shape>& cached_shape, u32& cached_property_offset, RequireWritable = RequireWritable::No);
+
 static ThrowCompletionOr<void> put_by_property_key(Object* object, Value value, PropertyKey name, Bytecode::Interpreter& interpreter, PropertyKind kind)
 {
     auto& vm = interpreter.vm();
@@ -143,6 +154,31 @@ static ThrowCompletionOr<Value> typed_equals(VM&, Value src1, Value src2)
 
 JS_ENUMERATE_COMMON_BINARY_OPS(JS_DEFINE_COMMON_BINARY_OP)
 
+#define JS_DEFINE_FUSED_JUMP_OP(OpTitleCase, op_snake_case)                                                              \
+    ThrowCompletionOr<void> OpTitleCase::execute_impl(Bytecode::Interpreter& interpreter) const                          \
+    {                                                                                                                    \
+        VERIFY(m_true_target.has_value());                                                                               \
+        VERIFY(m_false_target.has_value());                                                                              \
+        auto& vm = interpreter.vm();                                                                                     \
+        auto lhs = interpreter.reg(m_lhs_reg);                                                                           \
+        auto rhs = interpreter.accumulator();                                                                            \
+        auto result = TRY(op_snake_case(vm, lhs, rhs));                                                                  \
+        interpreter.accumulator() = result;                                                                              \
+        if (result.to_boolean())                                                                                         \
+            interpreter.jump(m_true_target.value());                                                                     \
+        else                                                                                                             \
+            interpreter.jump(m_false_target.value());                                                                    \
+        return {};                                                                                                       \
+    }                                                                                                                    \
+    DeprecatedString OpTitleCase::to_deprecated_string_impl(Bytecode::Executable const&) const                           \
+    {                                                                                                                    \
+        auto true_string = m_true_target.has_value() ? DeprecatedString::formatted("{}", *m_true_target) : "<empty>";    \
+        auto false_string = m_false_target.has_value() ? DeprecatedString::formatted("{}", *m_false_target) : "<empty>"; \
+        return DeprecatedString::formatted(#OpTitleCase " {} true:{} false:{}", m_lhs_reg, true_string, false_string);   \
+    }
+
+JS_ENUMERATE_FUSED_JUMP_OPS(JS_DEFINE_FUSED_JUMP_OP)
+
 static ThrowCompletionOr<Value> not_(VM&, Value value)
 {
     return Value(!value.to_boolean());
@@ -373,6 +409,24 @@ ThrowCompletionOr<void> GetVariable::execute_impl(Bytecode::Interpreter& interpr
 {
     auto& vm = interpreter.vm();
 
+    // Fast path for global variables: if the global object still has the shape
+    // we remembered and no lexical declaration has appeared on the global
+    // declarative record since, the value can be read straight out of storage.
+    if (m_cached_environment_coordinate.has_value()
+        && m_cached_environment_coordinate->index == EnvironmentCoordinate::global_marker
+        && m_cached_global_shape) {
+        auto& global_environment = vm.current_realm()->global_environment();
+        auto& global_object = global_environment.object_record().binding_object();
+        if (&global_object.shape() == m_cached_global_shape.ptr()
+            && global_environment.declarative_record().environment_serial_number() == m_cached_global_declarative_serial) {
+            auto value = global_object.get_direct(m_cached_global_property_offset);
+            if (!value.is_empty() && !value.is_accessor()) {
+                interpreter.accumulator() = value;
+                return {};
+            }
+        }
+    }
+
     auto get_reference = [&]() -> ThrowCompletionOr<Reference> {
         auto const& string = interpreter.current_executable().get_identifier(m_identifier);
         if (m_cached_environment_coordinate.has_value()) {
@@ -399,6 +453,19 @@ ThrowCompletionOr<void> GetVariable::execute_impl(Bytecode::Interpreter& interpr
     };
     auto reference = TRY(get_reference());
     interpreter.accumulator() = TRY(reference.get_value(vm));
+
+    if (m_cached_environment_coordinate.has_value()
+        && m_cached_environment_coordinate->index == EnvironmentCoordinate::global_marker) {
+        auto& global_environment = vm.current_realm()->global_environment();
+        auto const& string = interpreter.current_executable().get_identifier(m_identifier);
+        // Only bindings that live on the global object itself are cacheable;
+        // lexical (let/const) globals go through the declarative record.
+        if (!MUST(global_environment.declarative_record().has_binding(string))) {
+            fill_property_lookup_cache(global_environment.object_record().binding_object(), string, m_cached_global_shape, m_cached_global_property_offset);
+            m_cached_global_declarative_serial = global_environment.declarative_record().environment_serial_number();
+        }
+    }
+
     return {};
 }
 
@@ -489,21 +556,69 @@ ThrowCompletionOr<void> SetVariable::execute_impl(Bytecode::Interpreter& interpr
     return {};
 }
 
+static void fill_property_lookup_cache(Object const& object, PropertyKey const& property_key, WeakPtr<Shape>& cached_shape, u32& cached_property_offset, RequireWritable require_writable)
+{
+    auto& shape = object.shape();
+    if (shape.is_unique() || !property_key.is_string())
+        return;
+    auto metadata = shape.lookup(property_key.to_string_or_symbol());
+    if (!metadata.has_value())
+        return;
+    if (require_writable == RequireWritable::Yes && !metadata->attributes.is_writable())
+        return;
+    auto value = object.get_direct(metadata->offset);
+    if (value.is_empty() || value.is_accessor())
+        return;
+    cached_shape = shape.make_weak_ptr();
+    cached_property_offset = metadata->offset;
+}
+
 ThrowCompletionOr<void> GetById::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
-    auto* object = TRY(interpreter.accumulator().to_object(vm));
-    interpreter.accumulator() = TRY(object->get(interpreter.current_executable().get_identifier(m_property)));
+    auto base_value = interpreter.accumulator();
+
+    if (base_value.is_object()) {
+        auto& object = base_value.as_object();
+        if (&object.shape() == m_cached_shape.ptr()) {
+            auto value = object.get_direct(m_cached_property_offset);
+            if (!value.is_empty() && !value.is_accessor()) {
+                interpreter.accumulator() = value;
+                return {};
+            }
+        }
+    }
+
+    auto const& property_key = interpreter.current_executable().get_identifier(m_property);
+    auto* object = TRY(base_value.to_object(vm));
+    interpreter.accumulator() = TRY(object->get(property_key));
+    fill_property_lookup_cache(*object, property_key, m_cached_shape, m_cached_property_offset);
     return {};
 }
 
 ThrowCompletionOr<void> PutById::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
-    auto* object = TRY(interpreter.reg(m_base).to_object(vm));
-    PropertyKey name = interpreter.current_executable().get_identifier(m_property);
+    auto base_value = interpreter.reg(m_base);
     auto value = interpreter.accumulator();
-    return put_by_property_key(object, value, name, interpreter, m_kind);
+
+    if (m_kind == PropertyKind::KeyValue && base_value.is_object()) {
+        auto& object = base_value.as_object();
+        if (&object.shape() == m_cached_shape.ptr()) {
+            auto current_value = object.get_direct(m_cached_property_offset);
+            if (!current_value.is_empty() && !current_value.is_accessor()) {
+                object.put_direct(m_cached_property_offset, value);
+                return {};
+            }
+        }
+    }
+
+    auto* object = TRY(base_value.to_object(vm));
+    PropertyKey name = interpreter.current_executable().get_identifier(m_property);
+    TRY(put_by_property_key(object, value, name, interpreter, m_kind));
+    if (m_kind == PropertyKind::KeyValue)
+        fill_property_lookup_cache(*object, name, m_cached_shape, m_cached_property_offset, RequireWritable::Yes);
+    return {};
 }
 
 ThrowCompletionOr<void> DeleteById::execute_impl(Bytecode::Interpreter& interpreter) const
@@ -841,10 +956,29 @@ void Yield::replace_references_impl(BasicBlock const& from, BasicBlock const& to
         m_continuation_label = Label { to };
 }
 
+// An integer-indexed access to a plain Array can side-step the generic
+// property machinery and hit the indexed element storage directly, as long as
+// the element already exists as a plain data property: existence rules out
+// both prototype chain involvement and length changes, and plain Arrays (in
+// contrast to proxies, typed arrays or the arguments object) have no
+// interceptors that could observe the difference.
 ThrowCompletionOr<void> GetByValue::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
-    auto* object = TRY(interpreter.reg(m_base).to_object(vm));
+
+    auto base_value = interpreter.reg(m_base);
+    if (base_value.is_object() && is<Array>(base_value.as_object())) {
+        auto property_value = interpreter.accumulator();
+        if (property_value.is_integral_number() && property_value.as_double() >= 0 && property_value.as_double() < NumericLimits<u32>::max()) {
+            auto existing = base_value.as_object().indexed_properties().get(static_cast<u32>(property_value.as_double()));
+            if (existing.has_value() && !existing->value.is_accessor()) {
+                interpreter.accumulator() = existing->value;
+                return {};
+            }
+        }
+    }
+
+    auto* object = TRY(base_value.to_object(vm));
 
     auto property_key = TRY(interpreter.accumulator().to_property_key(vm));
 
@@ -855,7 +989,22 @@ ThrowCompletionOr<void> GetByValue::execute_impl(Bytecode::Interpreter& interpre
 ThrowCompletionOr<void> PutByValue::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
-    auto* object = TRY(interpreter.reg(m_base).to_object(vm));
+
+    auto base_value = interpreter.reg(m_base);
+    if (m_kind == PropertyKind::KeyValue && base_value.is_object() && is<Array>(base_value.as_object())) {
+        auto property_value = interpreter.reg(m_property);
+        if (property_value.is_integral_number() && property_value.as_double() >= 0 && property_value.as_double() < NumericLimits<u32>::max()) {
+            auto index = static_cast<u32>(property_value.as_double());
+            auto& storage = base_value.as_object().indexed_properties();
+            auto existing = storage.get(index);
+            if (existing.has_value() && !existing->value.is_accessor() && existing->attributes.is_writable()) {
+                storage.put(index, interpreter.accumulator(), existing->attributes);
+                return {};
+            }
+        }
+    }
+
+    auto* object = TRY(base_value.to_object(vm));
 
     auto property_key = TRY(interpreter.reg(m_property).to_property_key(vm));
     return put_by_property_key(object, interpreter.accumulator(), property_key, interpreter, m_kind);
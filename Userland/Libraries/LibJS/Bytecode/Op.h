@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AK/StdLibExtras.h>
+#include <AK/WeakPtr.h>
 #include <LibCrypto/BigInt/SignedBigInteger.h>
 #include <LibJS/Bytecode/IdentifierTable.h>
 #include <LibJS/Bytecode/Instruction.h>
@@ -40,6 +41,8 @@ public:
             m_src = to;
     }
 
+    Register src() const { return m_src; }
+
 private:
     Register m_src;
 };
@@ -57,6 +60,8 @@ public:
     void replace_references_impl(BasicBlock const&, BasicBlock const&) { }
     void replace_references_impl(Register, Register) { }
 
+    Value value() const { return m_value; }
+
 private:
     Value m_value;
 };
@@ -124,6 +129,8 @@ private:
                 m_lhs_reg = to;                                                        \
         }                                                                              \
                                                                                        \
+        Register lhs() const { return m_lhs_reg; }                                     \
+                                                                                       \
     private:                                                                           \
         Register m_lhs_reg;                                                            \
     };
@@ -255,6 +262,10 @@ public:
 
     size_t length_impl() const { return sizeof(*this) + sizeof(Register) * m_excluded_names_count; }
 
+    Register from_object() const { return m_from_object; }
+    size_t excluded_names_count() const { return m_excluded_names_count; }
+    Register excluded_name(size_t i) const { return m_excluded_names[i]; }
+
 private:
     Register m_from_object;
     size_t m_excluded_names_count { 0 };
@@ -342,6 +353,8 @@ public:
     // Note: This should never do anything, the lhs should always be an array, that is currently being constructed
     void replace_references_impl(Register from, Register) { VERIFY(from != m_lhs); }
 
+    Register lhs() const { return m_lhs; }
+
 private:
     Register m_lhs;
     bool m_is_spread = false;
@@ -374,6 +387,8 @@ public:
     // Note: lhs should always be a string in construction, so this should never do anything
     void replace_references_impl(Register from, Register) { VERIFY(from != m_lhs); }
 
+    Register lhs() const { return m_lhs; }
+
 private:
     Register m_lhs;
 };
@@ -483,6 +498,13 @@ private:
     IdentifierTableIndex m_identifier;
 
     Optional<EnvironmentCoordinate> mutable m_cached_environment_coordinate;
+
+    // Inline cache for global variables: remembers the global object shape and
+    // storage offset, plus the serial number of the global declarative record
+    // so a later lexical declaration shadowing the variable is noticed.
+    mutable WeakPtr<Shape> m_cached_global_shape;
+    mutable u32 m_cached_global_property_offset { 0 };
+    mutable u64 m_cached_global_declarative_serial { 0 };
 };
 
 class DeleteVariable final : public Instruction {
@@ -519,6 +541,11 @@ public:
 
 private:
     IdentifierTableIndex m_property;
+
+    // Inline cache: remembers the shape of the last base object that had this
+    // property as an own data property, and the property's storage offset.
+    mutable WeakPtr<Shape> m_cached_shape;
+    mutable u32 m_cached_property_offset { 0 };
 };
 
 enum class PropertyKind {
@@ -548,10 +575,16 @@ public:
             m_base = to;
     }
 
+    Register base() const { return m_base; }
+
 private:
     Register m_base;
     IdentifierTableIndex m_property;
     PropertyKind m_kind;
+
+    // Inline cache, see GetById.
+    mutable WeakPtr<Shape> m_cached_shape;
+    mutable u32 m_cached_property_offset { 0 };
 };
 
 class DeleteById final : public Instruction {
@@ -588,6 +621,8 @@ public:
             m_base = to;
     }
 
+    Register base() const { return m_base; }
+
 private:
     Register m_base;
 };
@@ -611,6 +646,9 @@ public:
             m_base = to;
     }
 
+    Register base() const { return m_base; }
+    Register property() const { return m_property; }
+
 private:
     Register m_base;
     Register m_property;
@@ -634,6 +672,8 @@ public:
             m_base = to;
     }
 
+    Register base() const { return m_base; }
+
 private:
     Register m_base;
 };
@@ -686,6 +726,47 @@ public:
     DeprecatedString to_deprecated_string_impl(Bytecode::Executable const&) const;
 };
 
+#define JS_ENUMERATE_FUSED_JUMP_OPS(O)            \
+    O(JumpGreaterThan, greater_than)              \
+    O(JumpGreaterThanEquals, greater_than_equals) \
+    O(JumpLessThan, less_than)                    \
+    O(JumpLessThanEquals, less_than_equals)       \
+    O(JumpLooselyEquals, abstract_equals)         \
+    O(JumpLooselyInequals, abstract_inequals)     \
+    O(JumpStrictlyEquals, typed_equals)           \
+    O(JumpStrictlyInequals, typed_inequals)
+
+// A comparison fused with the JumpConditional that consumes its result, so the
+// common compare-and-branch sequence takes one dispatch instead of two. The
+// comparison result is still left in the accumulator, as it would be by the
+// unfused sequence.
+#define JS_DECLARE_FUSED_JUMP_OP(OpTitleCase, op_snake_case)                                                        \
+    class OpTitleCase final : public Jump {                                                                         \
+    public:                                                                                                         \
+        explicit OpTitleCase(Register lhs_reg, Optional<Label> true_target = {}, Optional<Label> false_target = {}) \
+            : Jump(Type::OpTitleCase, move(true_target), move(false_target))                                        \
+            , m_lhs_reg(lhs_reg)                                                                                    \
+        {                                                                                                           \
+        }                                                                                                           \
+                                                                                                                    \
+        ThrowCompletionOr<void> execute_impl(Bytecode::Interpreter&) const;                                         \
+        DeprecatedString to_deprecated_string_impl(Bytecode::Executable const&) const;                              \
+        using Jump::replace_references_impl;                                                                        \
+        void replace_references_impl(Register from, Register to)                                                    \
+        {                                                                                                           \
+            if (m_lhs_reg == from)                                                                                  \
+                m_lhs_reg = to;                                                                                     \
+        }                                                                                                           \
+                                                                                                                    \
+        Register lhs() const { return m_lhs_reg; }                                                                  \
+                                                                                                                    \
+    private:                                                                                                        \
+        Register m_lhs_reg;                                                                                         \
+    };
+
+JS_ENUMERATE_FUSED_JUMP_OPS(JS_DECLARE_FUSED_JUMP_OP)
+#undef JS_DECLARE_FUSED_JUMP_OP
+
 class JumpNullish final : public Jump {
 public:
     explicit JumpNullish(Optional<Label> true_target = {}, Optional<Label> false_target = {})
@@ -732,6 +813,9 @@ public:
 
     Completion throw_type_error_for_callee(Bytecode::Interpreter&, StringView callee_type) const;
 
+    Register callee() const { return m_callee; }
+    Register this_value() const { return m_this_value; }
+
 private:
     Register m_callee;
     Register m_this_value;
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashMap.h>
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/PassManager.h>
+#include <math.h>
+
+namespace JS::Bytecode::Passes {
+
+static Optional<Register> binary_op_lhs(Instruction const& instruction)
+{
+    switch (instruction.type()) {
+#define __BYTECODE_OP(OpTitleCase, op_snake_case) \
+    case Instruction::Type::OpTitleCase:          \
+        return static_cast<Op::OpTitleCase const&>(instruction).lhs();
+        JS_ENUMERATE_COMMON_BINARY_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+    default:
+        return {};
+    }
+}
+
+// Evaluates a binary operation whose operands are both known numbers. Only
+// operations that cannot observe or mutate the running program are folded;
+// anything that could go through ToPrimitive keeps its instruction.
+static Optional<Value> fold_binary_op(Instruction::Type type, Value lhs, Value rhs)
+{
+    VERIFY(lhs.is_number() && rhs.is_number());
+    auto a = lhs.as_double();
+    auto b = rhs.as_double();
+    switch (type) {
+    case Instruction::Type::Add:
+        return Value(a + b);
+    case Instruction::Type::Sub:
+        return Value(a - b);
+    case Instruction::Type::Mul:
+        return Value(a * b);
+    case Instruction::Type::Div:
+        return Value(a / b);
+    case Instruction::Type::Mod:
+        return Value(fmod(a, b));
+    case Instruction::Type::LessThan:
+        return Value(a < b);
+    case Instruction::Type::LessThanEquals:
+        return Value(a <= b);
+    case Instruction::Type::GreaterThan:
+        return Value(a > b);
+    case Instruction::Type::GreaterThanEquals:
+        return Value(a >= b);
+    // For number operands, loose and strict (in)equality coincide, and IEEE
+    // comparison gives the correct NaN and ±0 behavior.
+    case Instruction::Type::LooselyEquals:
+    case Instruction::Type::StrictlyEquals:
+        return Value(a == b);
+    case Instruction::Type::LooselyInequals:
+    case Instruction::Type::StrictlyInequals:
+        return Value(a != b);
+    default:
+        return {};
+    }
+}
+
+static NonnullOwnPtr<BasicBlock> fold_constants(BasicBlock const& block)
+{
+    // Folding may replace a binary operation with a slightly larger
+    // LoadImmediate, so leave some headroom in the new block.
+    auto new_block = BasicBlock::create(block.name(), block.size() + block.size() / 2 + sizeof(Op::LoadImmediate));
+
+    // Values known to be in the accumulator and in registers at the current
+    // point of the block. Only LoadImmediate introduces known values, so
+    // everything tracked here is a primitive without observable identity.
+    Optional<Value> accumulator_value;
+    HashMap<u32, Value> register_values;
+
+    for (auto it = InstructionStreamIterator(block.instruction_stream()); !it.at_end(); ++it) {
+        auto const& instruction = *it;
+
+        Optional<Value> folded_value;
+        if (auto lhs_reg = binary_op_lhs(instruction); lhs_reg.has_value()) {
+            if (accumulator_value.has_value() && accumulator_value->is_number()) {
+                if (auto lhs = register_values.get(lhs_reg->index()); lhs.has_value() && lhs->is_number())
+                    folded_value = fold_binary_op(instruction.type(), lhs.value(), accumulator_value.value());
+            }
+        } else if (instruction.type() == Instruction::Type::Not) {
+            if (accumulator_value.has_value())
+                folded_value = Value(!accumulator_value->to_boolean());
+        } else if (instruction.type() == Instruction::Type::UnaryMinus) {
+            if (accumulator_value.has_value() && accumulator_value->is_number())
+                folded_value = Value(-accumulator_value->as_double());
+        } else if (instruction.type() == Instruction::Type::UnaryPlus) {
+            if (accumulator_value.has_value() && accumulator_value->is_number())
+                folded_value = accumulator_value;
+        }
+
+        if (folded_value.has_value()) {
+            new (new_block->next_slot()) Op::LoadImmediate(folded_value.value());
+            new_block->grow(sizeof(Op::LoadImmediate));
+            accumulator_value = folded_value;
+            continue;
+        }
+
+        // Track what the kept instruction does to the accumulator and
+        // registers. Registers are only ever written by Store, so everything
+        // else at most clobbers the accumulator.
+        switch (instruction.type()) {
+        case Instruction::Type::LoadImmediate:
+            accumulator_value = static_cast<Op::LoadImmediate const&>(instruction).value();
+            break;
+        case Instruction::Type::Load: {
+            auto src = static_cast<Op::Load const&>(instruction).src();
+            accumulator_value = register_values.get(src.index());
+            break;
+        }
+        case Instruction::Type::Store: {
+            auto dst = static_cast<Op::Store const&>(instruction).dst();
+            if (accumulator_value.has_value())
+                register_values.set(dst.index(), accumulator_value.value());
+            else
+                register_values.remove(dst.index());
+            break;
+        }
+        default:
+            accumulator_value = {};
+            break;
+        }
+
+        if (instruction.type() == Instruction::Type::NewBigInt) {
+            // FIXME: This is the only non trivially copyable Instruction,
+            //        so we need to do some extra work here
+            new (new_block->next_slot()) Op::NewBigInt(static_cast<Op::NewBigInt const&>(instruction));
+            new_block->grow(sizeof(Op::NewBigInt));
+            continue;
+        }
+
+        memcpy(new_block->next_slot(), &instruction, instruction.length());
+        reinterpret_cast<Instruction*>(new_block->next_slot())->replace_references(block, *new_block);
+        new_block->grow(instruction.length());
+    }
+
+    return new_block;
+}
+
+void FoldConstants::perform(PassPipelineExecutable& executable)
+{
+    started();
+
+    for (auto it = executable.executable.basic_blocks.begin(); it != executable.executable.basic_blocks.end(); ++it) {
+        auto const& old_block = *it;
+        auto new_block = fold_constants(old_block);
+
+        // We will replace the old block with a new one, so we need to replace
+        // all references to the old one with the new one
+        for (auto& block : executable.executable.basic_blocks) {
+            InstructionStreamIterator it { block.instruction_stream() };
+            while (!it.at_end()) {
+                auto& instruction = *it;
+                ++it;
+                const_cast<Instruction&>(instruction).replace_references(old_block, *new_block);
+            }
+        }
+
+        executable.executable.basic_blocks.ptr_at(it.index()) = move(new_block);
+    }
+
+    finished();
+}
+
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashTable.h>
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/PassManager.h>
+
+namespace JS::Bytecode::Passes {
+
+static void collect_register_reads(Instruction const& instruction, HashTable<u32>& read_registers)
+{
+    switch (instruction.type()) {
+    case Instruction::Type::Load:
+        read_registers.set(static_cast<Op::Load const&>(instruction).src().index());
+        break;
+#define __BYTECODE_OP(OpTitleCase, op_snake_case)                                           \
+    case Instruction::Type::OpTitleCase:                                                    \
+        read_registers.set(static_cast<Op::OpTitleCase const&>(instruction).lhs().index()); \
+        break;
+        JS_ENUMERATE_COMMON_BINARY_OPS(__BYTECODE_OP)
+        JS_ENUMERATE_FUSED_JUMP_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+    case Instruction::Type::Append:
+        read_registers.set(static_cast<Op::Append const&>(instruction).lhs().index());
+        break;
+    case Instruction::Type::ConcatString:
+        read_registers.set(static_cast<Op::ConcatString const&>(instruction).lhs().index());
+        break;
+    case Instruction::Type::NewArray: {
+        auto const& new_array = static_cast<Op::NewArray const&>(instruction);
+        for (size_t i = 0; i < new_array.element_count(); ++i)
+            read_registers.set(new_array.start().index() + i);
+        break;
+    }
+    case Instruction::Type::CopyObjectExcludingProperties: {
+        auto const& copy = static_cast<Op::CopyObjectExcludingProperties const&>(instruction);
+        read_registers.set(copy.from_object().index());
+        for (size_t i = 0; i < copy.excluded_names_count(); ++i)
+            read_registers.set(copy.excluded_name(i).index());
+        break;
+    }
+    case Instruction::Type::Call: {
+        auto const& call = static_cast<Op::Call const&>(instruction);
+        read_registers.set(call.callee().index());
+        read_registers.set(call.this_value().index());
+        break;
+    }
+    case Instruction::Type::PutById:
+        read_registers.set(static_cast<Op::PutById const&>(instruction).base().index());
+        break;
+    case Instruction::Type::GetByValue:
+        read_registers.set(static_cast<Op::GetByValue const&>(instruction).base().index());
+        break;
+    case Instruction::Type::PutByValue: {
+        auto const& put = static_cast<Op::PutByValue const&>(instruction);
+        read_registers.set(put.base().index());
+        read_registers.set(put.property().index());
+        break;
+    }
+    case Instruction::Type::DeleteByValue:
+        read_registers.set(static_cast<Op::DeleteByValue const&>(instruction).base().index());
+        break;
+    default:
+        // All other instructions operate on the accumulator, on named
+        // variables, or on jump targets only.
+        break;
+    }
+}
+
+static NonnullOwnPtr<BasicBlock> eliminate_dead_stores(BasicBlock const& block, HashTable<u32> const& read_registers)
+{
+    auto new_block = BasicBlock::create(block.name(), block.size());
+
+    for (auto it = InstructionStreamIterator(block.instruction_stream()); !it.at_end(); ++it) {
+        auto const& instruction = *it;
+
+        if (instruction.type() == Instruction::Type::Store
+            && !read_registers.contains(static_cast<Op::Store const&>(instruction).dst().index()))
+            continue;
+
+        if (instruction.type() == Instruction::Type::NewBigInt) {
+            // FIXME: This is the only non trivially copyable Instruction,
+            //        so we need to do some extra work here
+            new (new_block->next_slot()) Op::NewBigInt(static_cast<Op::NewBigInt const&>(instruction));
+            new_block->grow(sizeof(Op::NewBigInt));
+            continue;
+        }
+
+        memcpy(new_block->next_slot(), &instruction, instruction.length());
+        reinterpret_cast<Instruction*>(new_block->next_slot())->replace_references(block, *new_block);
+        new_block->grow(instruction.length());
+    }
+
+    return new_block;
+}
+
+void EliminateDeadStores::perform(PassPipelineExecutable& executable)
+{
+    started();
+
+    // A register is only ever read through the instructions that name it, so
+    // collecting reads over the whole executable (including all blocks a
+    // generator can resume into) tells us exactly which Stores are dead.
+    HashTable<u32> read_registers;
+    for (auto& block : executable.executable.basic_blocks) {
+        for (auto it = InstructionStreamIterator(block.instruction_stream()); !it.at_end(); ++it)
+            collect_register_reads(*it, read_registers);
+    }
+
+    for (auto it = executable.executable.basic_blocks.begin(); it != executable.executable.basic_blocks.end(); ++it) {
+        auto const& old_block = *it;
+        auto new_block = eliminate_dead_stores(old_block, read_registers);
+
+        // We will replace the old block with a new one, so we need to replace
+        // all references to the old one with the new one
+        for (auto& block : executable.executable.basic_blocks) {
+            InstructionStreamIterator it { block.instruction_stream() };
+            while (!it.at_end()) {
+                auto& instruction = *it;
+                ++it;
+                const_cast<Instruction&>(instruction).replace_references(old_block, *new_block);
+            }
+        }
+
+        executable.executable.basic_blocks.ptr_at(it.index()) = move(new_block);
+    }
+
+    finished();
+}
+
+}
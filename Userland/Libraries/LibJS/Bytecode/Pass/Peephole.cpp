@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/PassManager.h>
+
+namespace JS::Bytecode::Passes {
+
+// Local rewrites over adjacent instruction pairs:
+//
+//   * A comparison directly followed by the JumpConditional consuming its
+//     result is fused into a single compare-and-branch instruction.
+//   * A JumpConditional on a known immediate becomes an unconditional Jump.
+//   * A Load of the register that was just Store'd is dropped, since the
+//     accumulator still holds that value.
+//
+// Every rewrite produces the same or less bytecode, so the rebuilt block never
+// outgrows the original one.
+static NonnullOwnPtr<BasicBlock> peephole(BasicBlock const& block)
+{
+    auto new_block = BasicBlock::create(block.name(), block.size());
+
+    for (auto it = InstructionStreamIterator(block.instruction_stream()); !it.at_end();) {
+        auto const& instruction = *it;
+
+        switch (instruction.type()) {
+#define __JS_PEEPHOLE_CASE(CompareOp, FusedOp)                                                            \
+    case Instruction::Type::CompareOp: {                                                                  \
+        auto next = it;                                                                                   \
+        ++next;                                                                                           \
+        if (!next.at_end() && (*next).type() == Instruction::Type::JumpConditional) {                     \
+            auto const& comparison = static_cast<Op::CompareOp const&>(instruction);                      \
+            auto const& jump = static_cast<Op::JumpConditional const&>(*next);                            \
+            new (new_block->next_slot()) Op::FusedOp(comparison.lhs(), jump.true_target(), jump.false_target()); \
+            reinterpret_cast<Instruction*>(new_block->next_slot())->replace_references(block, *new_block); \
+            new_block->grow(sizeof(Op::FusedOp));                                                         \
+            it = next;                                                                                    \
+            ++it;                                                                                         \
+            continue;                                                                                     \
+        }                                                                                                 \
+        break;                                                                                            \
+    }
+            __JS_PEEPHOLE_CASE(GreaterThan, JumpGreaterThan)
+            __JS_PEEPHOLE_CASE(GreaterThanEquals, JumpGreaterThanEquals)
+            __JS_PEEPHOLE_CASE(LessThan, JumpLessThan)
+            __JS_PEEPHOLE_CASE(LessThanEquals, JumpLessThanEquals)
+            __JS_PEEPHOLE_CASE(LooselyEquals, JumpLooselyEquals)
+            __JS_PEEPHOLE_CASE(LooselyInequals, JumpLooselyInequals)
+            __JS_PEEPHOLE_CASE(StrictlyEquals, JumpStrictlyEquals)
+            __JS_PEEPHOLE_CASE(StrictlyInequals, JumpStrictlyInequals)
+#undef __JS_PEEPHOLE_CASE
+        case Instruction::Type::LoadImmediate: {
+            auto next = it;
+            ++next;
+            if (!next.at_end() && (*next).type() == Instruction::Type::JumpConditional) {
+                auto const& load = static_cast<Op::LoadImmediate const&>(instruction);
+                auto const& jump = static_cast<Op::JumpConditional const&>(*next);
+                auto target = load.value().to_boolean() ? jump.true_target() : jump.false_target();
+                new (new_block->next_slot()) Op::LoadImmediate(load);
+                new_block->grow(sizeof(Op::LoadImmediate));
+                new (new_block->next_slot()) Op::Jump(move(target));
+                reinterpret_cast<Instruction*>(new_block->next_slot())->replace_references(block, *new_block);
+                new_block->grow(sizeof(Op::Jump));
+                it = next;
+                ++it;
+                continue;
+            }
+            break;
+        }
+        case Instruction::Type::Store: {
+            auto const& store = static_cast<Op::Store const&>(instruction);
+            new (new_block->next_slot()) Op::Store(store);
+            new_block->grow(sizeof(Op::Store));
+            ++it;
+            // Skip any immediately following reload of the register we just
+            // stored to; the accumulator still holds its value.
+            while (!it.at_end() && (*it).type() == Instruction::Type::Load
+                && static_cast<Op::Load const&>(*it).src() == store.dst())
+                ++it;
+            continue;
+        }
+        case Instruction::Type::NewBigInt:
+            // FIXME: This is the only non trivially copyable Instruction,
+            //        so we need to do some extra work here
+            new (new_block->next_slot()) Op::NewBigInt(static_cast<Op::NewBigInt const&>(instruction));
+            new_block->grow(sizeof(Op::NewBigInt));
+            ++it;
+            continue;
+        default:
+            break;
+        }
+
+        memcpy(new_block->next_slot(), &instruction, instruction.length());
+        reinterpret_cast<Instruction*>(new_block->next_slot())->replace_references(block, *new_block);
+        new_block->grow(instruction.length());
+        ++it;
+    }
+
+    return new_block;
+}
+
+void Peephole::perform(PassPipelineExecutable& executable)
+{
+    started();
+
+    for (auto it = executable.executable.basic_blocks.begin(); it != executable.executable.basic_blocks.end(); ++it) {
+        auto const& old_block = *it;
+        auto new_block = peephole(old_block);
+
+        // We will replace the old block with a new one, so we need to replace
+        // all references to the old one with the new one
+        for (auto& block : executable.executable.basic_blocks) {
+            InstructionStreamIterator it { block.instruction_stream() };
+            while (!it.at_end()) {
+                auto& instruction = *it;
+                ++it;
+                const_cast<Instruction&>(instruction).replace_references(old_block, *new_block);
+            }
+        }
+
+        executable.executable.basic_blocks.ptr_at(it.index()) = move(new_block);
+    }
+
+    finished();
+}
+
+}
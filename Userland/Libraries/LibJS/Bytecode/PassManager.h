@@ -145,6 +145,33 @@ private:
     virtual void perform(PassPipelineExecutable&) override;
 };
 
+class FoldConstants : public Pass {
+public:
+    FoldConstants() = default;
+    virtual ~FoldConstants() override = default;
+
+private:
+    virtual void perform(PassPipelineExecutable&) override;
+};
+
+class Peephole : public Pass {
+public:
+    Peephole() = default;
+    virtual ~Peephole() override = default;
+
+private:
+    virtual void perform(PassPipelineExecutable&) override;
+};
+
+class EliminateDeadStores : public Pass {
+public:
+    EliminateDeadStores() = default;
+    virtual ~EliminateDeadStores() override = default;
+
+private:
+    virtual void perform(PassPipelineExecutable&) override;
+};
+
 }
 
 }
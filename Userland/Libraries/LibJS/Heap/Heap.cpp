@@ -7,6 +7,7 @@
 #include <AK/Badge.h>
 #include <AK/Debug.h>
 #include <AK/HashTable.h>
+#include <AK/NumericLimits.h>
 #include <AK/StackInfo.h>
 #include <AK/TemporaryChange.h>
 #include <LibCore/ElapsedTimer.h>
@@ -141,21 +142,37 @@ __attribute__((no_sanitize("address"))) void Heap::gather_conservative_roots(Has
 
     auto* raw_jmp_buf = reinterpret_cast<FlatPtr const*>(buf);
 
+    // Collect the live heap blocks (and the address range they span) up front,
+    // so that candidate values can be range-filtered before we pay for hashing
+    // them: almost every word on the stack is not a heap pointer.
+    HashTable<HeapBlock*> all_live_heap_blocks;
+    FlatPtr min_block_address = NumericLimits<FlatPtr>::max();
+    FlatPtr max_block_address = 0;
+    for_each_block([&](auto& block) {
+        all_live_heap_blocks.set(&block);
+        min_block_address = min(min_block_address, bit_cast<FlatPtr>(&block));
+        max_block_address = max(max_block_address, bit_cast<FlatPtr>(&block) + HeapBlock::block_size);
+        return IterationDecision::Continue;
+    });
+
     auto add_possible_value = [&](FlatPtr data) {
         if constexpr (sizeof(FlatPtr*) == sizeof(Value)) {
             // Because Value stores pointers in non-canonical form we have to check if the top bytes
             // match any pointer-backed tag, in that case we have to extract the pointer to its
             // canonical form and add that as a possible pointer.
             if ((data & SHIFTED_IS_CELL_PATTERN) == SHIFTED_IS_CELL_PATTERN)
-                possible_pointers.set(Value::extract_pointer_bits(data));
-            else
-                possible_pointers.set(data);
+                data = Value::extract_pointer_bits(data);
         } else {
             static_assert((sizeof(Value) % sizeof(FlatPtr*)) == 0);
             // In the 32-bit case we will look at the top and bottom part of Value separately we just
             // add both the upper and lower bytes as possible pointers.
-            possible_pointers.set(data);
         }
+        // A pointer into a live block necessarily points between the lowest
+        // and highest live block address, so anything outside that range can
+        // be rejected without touching the hash tables at all.
+        if (data < min_block_address || data >= max_block_address)
+            return;
+        possible_pointers.set(data);
     };
 
     for (size_t i = 0; i < ((size_t)sizeof(buf)) / sizeof(FlatPtr); i += sizeof(FlatPtr))
@@ -179,12 +196,6 @@ __attribute__((no_sanitize("address"))) void Heap::gather_conservative_roots(Has
         }
     }
 
-    HashTable<HeapBlock*> all_live_heap_blocks;
-    for_each_block([&](auto& block) {
-        all_live_heap_blocks.set(&block);
-        return IterationDecision::Continue;
-    });
-
     for (auto possible_pointer : possible_pointers) {
         if (!possible_pointer)
             continue;
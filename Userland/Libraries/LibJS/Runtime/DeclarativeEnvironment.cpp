@@ -70,6 +70,7 @@ ThrowCompletionOr<void> DeclarativeEnvironment::create_mutable_binding(VM&, FlyS
         .can_be_deleted = can_be_deleted,
         .initialized = false,
     });
+    ++m_environment_serial_number;
 
     // 3. Return unused.
     return {};
@@ -90,6 +91,7 @@ ThrowCompletionOr<void> DeclarativeEnvironment::create_immutable_binding(VM&, Fl
         .can_be_deleted = false,
         .initialized = false,
     });
+    ++m_environment_serial_number;
 
     // 3. Return unused.
     return {};
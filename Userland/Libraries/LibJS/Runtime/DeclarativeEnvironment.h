@@ -57,6 +57,12 @@ public:
     ThrowCompletionOr<void> set_mutable_binding_direct(VM&, size_t index, Value, bool strict);
     ThrowCompletionOr<Value> get_binding_value_direct(VM&, size_t index, bool strict);
 
+    // Incremented every time a binding is added, so caches keyed on the set of
+    // bindings in this environment (e.g. global variable access in bytecode)
+    // know when to re-resolve. Deleted bindings keep their slot and can only
+    // ever stop shadowing something, so they don't need to bump this.
+    u64 environment_serial_number() const { return m_environment_serial_number; }
+
     void shrink_to_fit();
 
 private:
@@ -117,6 +123,7 @@ private:
     virtual bool is_declarative_environment() const override { return true; }
 
     Vector<Binding> m_bindings;
+    u64 m_environment_serial_number { 0 };
 };
 
 template<>
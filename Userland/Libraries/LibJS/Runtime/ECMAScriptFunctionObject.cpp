@@ -811,36 +811,53 @@ Completion ECMAScriptFunctionObject::ordinary_call_evaluate_body()
     }
 
     if (bytecode_interpreter) {
-        if (!m_bytecode_executable) {
-            auto compile = [&](auto& node, auto kind, auto name) -> ThrowCompletionOr<NonnullOwnPtr<Bytecode::Executable>> {
-                auto executable_result = Bytecode::Generator::generate(node, kind);
-                if (executable_result.is_error())
-                    return vm.throw_completion<InternalError>(ErrorType::NotImplemented, executable_result.error().to_deprecated_string());
-
-                auto bytecode_executable = executable_result.release_value();
-                bytecode_executable->name = name;
-                auto& passes = Bytecode::Interpreter::optimization_pipeline();
-                passes.perform(*bytecode_executable);
-                if constexpr (JS_BYTECODE_DEBUG) {
-                    dbgln("Optimisation passes took {}us", passes.elapsed());
-                    dbgln("Compiled Bytecode::Block for function '{}':", m_name);
-                }
-                if (Bytecode::g_dump_bytecode)
-                    bytecode_executable->dump();
+        auto compile = [&](auto& node, auto kind, auto name, auto optimization_level) -> ThrowCompletionOr<NonnullOwnPtr<Bytecode::Executable>> {
+            auto executable_result = Bytecode::Generator::generate(node, kind);
+            if (executable_result.is_error())
+                return vm.throw_completion<InternalError>(ErrorType::NotImplemented, executable_result.error().to_deprecated_string());
+
+            auto bytecode_executable = executable_result.release_value();
+            bytecode_executable->name = name;
+            auto& passes = Bytecode::Interpreter::optimization_pipeline(optimization_level);
+            passes.perform(*bytecode_executable);
+            if constexpr (JS_BYTECODE_DEBUG) {
+                dbgln("Optimisation passes took {}us", passes.elapsed());
+                dbgln("Compiled Bytecode::Block for function '{}':", m_name);
+            }
+            if (Bytecode::g_dump_bytecode)
+                bytecode_executable->dump();
 
-                return bytecode_executable;
-            };
+            return bytecode_executable;
+        };
 
-            m_bytecode_executable = TRY(compile(*m_ecmascript_code, m_kind, m_name));
+        if (!m_bytecode_executable) {
+            m_bytecode_executable = TRY(compile(*m_ecmascript_code, m_kind, m_name, Bytecode::Interpreter::OptimizationLevel::Default));
 
             size_t default_parameter_index = 0;
             for (auto& parameter : m_formal_parameters) {
                 if (!parameter.default_value)
                     continue;
-                auto executable = TRY(compile(*parameter.default_value, FunctionKind::Normal, DeprecatedString::formatted("default parameter #{} for {}", default_parameter_index, m_name)));
+                auto executable = TRY(compile(*parameter.default_value, FunctionKind::Normal, DeprecatedString::formatted("default parameter #{} for {}", default_parameter_index, m_name), Bytecode::Interpreter::OptimizationLevel::Default));
                 m_default_parameter_bytecode_executables.append(move(executable));
             }
         }
+
+        // Once a function has been called often enough to look hot, recompile its body
+        // through the optimizing pass pipeline. Generator and async bodies are left
+        // alone: suspended generator objects keep pointers into the old executable's
+        // basic blocks, so it must not be replaced from under them.
+        static constexpr size_t bytecode_optimization_invocation_threshold = 32;
+        if (m_kind == FunctionKind::Normal && !m_bytecode_executable_is_optimized
+            && ++m_bytecode_invocation_count >= bytecode_optimization_invocation_threshold) {
+            auto optimized_executable = TRY(compile(*m_ecmascript_code, m_kind, m_name, Bytecode::Interpreter::OptimizationLevel::Optimize));
+            // If this call is a recursive one, outer activations of this function are
+            // still executing the unoptimized executable and hold references into it,
+            // so retire it instead of destroying it out from under them. The swap
+            // happens at most once per function, so a single slot is enough.
+            m_retired_bytecode_executable = move(m_bytecode_executable);
+            m_bytecode_executable = move(optimized_executable);
+            m_bytecode_executable_is_optimized = true;
+        }
         TRY(function_declaration_instantiation(nullptr));
         auto result_and_frame = bytecode_interpreter->run_and_return_frame(*m_bytecode_executable, nullptr);
 
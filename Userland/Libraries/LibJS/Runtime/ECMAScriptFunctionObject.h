@@ -107,7 +107,12 @@ private:
 
     FlyString m_name;
     OwnPtr<Bytecode::Executable> m_bytecode_executable;
+    // Keeps the unoptimized executable alive after hot recompilation, as live
+    // activations of this function may still be executing it.
+    OwnPtr<Bytecode::Executable> m_retired_bytecode_executable;
     Vector<OwnPtr<Bytecode::Executable>> m_default_parameter_bytecode_executables;
+    size_t m_bytecode_invocation_count { 0 };
+    bool m_bytecode_executable_is_optimized { false };
     i32 m_function_length { 0 };
 
     // Internal Slots of ECMAScript Function Objects, https://tc39.es/ecma262/#table-internal-slots-of-ecmascript-function-objects
@@ -213,7 +213,13 @@ void PrimitiveString::resolve_rope_if_needed() const
     }
 
     // Now that we have all the pieces, we can concatenate them using a StringBuilder.
-    StringBuilder builder;
+    // Reserving the exact resulting size up front matters here: the whole point of
+    // rope strings is to defer concatenation work to this single pass, so it should
+    // not degrade into repeated buffer growth for long ropes.
+    size_t total_length_in_bytes = 0;
+    for (auto const* current : pieces)
+        total_length_in_bytes += current->deprecated_string().length();
+    StringBuilder builder(total_length_in_bytes);
 
     // We keep track of the previous piece in order to handle surrogate pairs spread across two pieces.
     PrimitiveString const* previous = nullptr;
@@ -54,25 +54,45 @@ Shape* Shape::get_or_prune_cached_prototype_transition(Object* prototype)
 
 Shape* Shape::create_put_transition(StringOrSymbol const& property_key, PropertyAttributes attributes)
 {
+    // Hot object construction takes the same transition from a given shape over
+    // and over, so the transition taken most recently sits in a single-entry
+    // cache that's checked before hashing into the transition table.
+    if (auto* last_shape = m_last_forward_transition.ptr(); last_shape
+        && last_shape->m_transition_type == TransitionType::Put
+        && last_shape->m_attributes == attributes
+        && last_shape->m_property_key == property_key)
+        return last_shape;
     TransitionKey key { property_key, attributes };
-    if (auto* existing_shape = get_or_prune_cached_forward_transition(key))
+    if (auto* existing_shape = get_or_prune_cached_forward_transition(key)) {
+        m_last_forward_transition = existing_shape->make_weak_ptr();
         return existing_shape;
+    }
     auto* new_shape = heap().allocate_without_realm<Shape>(*this, property_key, attributes, TransitionType::Put);
     if (!m_forward_transitions)
         m_forward_transitions = make<HashMap<TransitionKey, WeakPtr<Shape>>>();
     m_forward_transitions->set(key, new_shape);
+    m_last_forward_transition = new_shape->make_weak_ptr();
     return new_shape;
 }
 
 Shape* Shape::create_configure_transition(StringOrSymbol const& property_key, PropertyAttributes attributes)
 {
+    // See create_put_transition() for the single-entry transition cache.
+    if (auto* last_shape = m_last_forward_transition.ptr(); last_shape
+        && last_shape->m_transition_type == TransitionType::Configure
+        && last_shape->m_attributes == attributes
+        && last_shape->m_property_key == property_key)
+        return last_shape;
     TransitionKey key { property_key, attributes };
-    if (auto* existing_shape = get_or_prune_cached_forward_transition(key))
+    if (auto* existing_shape = get_or_prune_cached_forward_transition(key)) {
+        m_last_forward_transition = existing_shape->make_weak_ptr();
         return existing_shape;
+    }
     auto* new_shape = heap().allocate_without_realm<Shape>(*this, property_key, attributes, TransitionType::Configure);
     if (!m_forward_transitions)
         m_forward_transitions = make<HashMap<TransitionKey, WeakPtr<Shape>>>();
     m_forward_transitions->set(key, new_shape);
+    m_last_forward_transition = new_shape->make_weak_ptr();
     return new_shape;
 }
 
@@ -125,10 +145,45 @@ void Shape::visit_edges(Cell::Visitor& visitor)
     }
 }
 
+// Shapes with at most this many properties resolve lookups by walking the
+// transition chain directly, which spares them from ever materializing a
+// property table. Keys compare by pointer, so a short walk is cheaper than
+// building and hashing into a HashMap.
+static constexpr u32 small_shape_property_limit = 8;
+
 Optional<PropertyMetadata> Shape::lookup(StringOrSymbol const& property_key) const
 {
     if (m_property_count == 0)
         return {};
+    if (!m_property_table && !m_unique && m_property_count <= small_shape_property_limit) {
+        // A configure transition closer to the tip of the chain overrides the
+        // attributes recorded by the put transition that added the property.
+        Optional<PropertyAttributes> reconfigured_attributes;
+        // Budget the walk so a chain padded with prototype or configure
+        // transitions still falls back to the property table.
+        u32 remaining_transitions = 2 * small_shape_property_limit;
+        auto const* shape = this;
+        for (; shape && remaining_transitions > 0; shape = shape->m_previous, --remaining_transitions) {
+            if (shape->m_property_table) {
+                auto property = shape->m_property_table->get(property_key);
+                if (!property.has_value())
+                    return {};
+                if (reconfigured_attributes.has_value())
+                    property->attributes = *reconfigured_attributes;
+                return property;
+            }
+            if (shape->m_property_key.is_valid() && shape->m_property_key == property_key) {
+                if (shape->m_transition_type == TransitionType::Put) {
+                    // The put transition added the property, so its offset is the number of properties before it.
+                    return PropertyMetadata { shape->m_property_count - 1, reconfigured_attributes.value_or(shape->m_attributes) };
+                }
+                if (shape->m_transition_type == TransitionType::Configure && !reconfigured_attributes.has_value())
+                    reconfigured_attributes = shape->m_attributes;
+            }
+        }
+        if (!shape)
+            return {};
+    }
     auto property = property_table().get(property_key);
     if (!property.has_value())
         return {};
@@ -161,7 +216,11 @@ void Shape::ensure_property_table() const
 
     u32 next_offset = 0;
 
+    // The chain is walked tip first, so this shape goes in before its
+    // ancestors; the reversed replay below then applies it last, after
+    // every inherited property has claimed its offset.
     Vector<Shape const&, 64> transition_chain;
+    transition_chain.append(*this);
     for (auto* shape = m_previous; shape; shape = shape->m_previous) {
         if (shape->m_property_table) {
             *m_property_table = *shape->m_property_table;
@@ -170,7 +229,6 @@ void Shape::ensure_property_table() const
         }
         transition_chain.append(*shape);
     }
-    transition_chain.append(*this);
 
     for (auto const& shape : transition_chain.in_reverse()) {
         if (!shape.m_property_key.is_valid()) {
@@ -99,6 +99,7 @@ private:
 
     OwnPtr<HashMap<TransitionKey, WeakPtr<Shape>>> m_forward_transitions;
     OwnPtr<HashMap<Object*, WeakPtr<Shape>>> m_prototype_transitions;
+    WeakPtr<Shape> m_last_forward_transition;
     Shape* m_previous { nullptr };
     StringOrSymbol m_property_key;
     Object* m_prototype { nullptr };
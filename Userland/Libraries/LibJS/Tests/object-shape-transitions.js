@@ -0,0 +1,20 @@
+test("properties keep their values when an object grows many properties", () => {
+    // Small objects resolve lookups by walking the shape transition chain, so
+    // growing past that limit materializes the property table from the whole
+    // chain at once; every property must keep the offset its transition
+    // assigned.
+    const o = {};
+    for (let i = 0; i < 20; ++i) o["property" + i] = i;
+    for (let i = 0; i < 20; ++i) expect(o["property" + i]).toBe(i);
+    expect(Object.getOwnPropertyNames(o)).toHaveLength(20);
+});
+
+test("properties keep their values after a late redefinition", () => {
+    const o = {};
+    for (let i = 0; i < 20; ++i) o["property" + i] = i;
+    Object.defineProperty(o, "property0", { enumerable: false, value: "hidden" });
+    expect(o.property0).toBe("hidden");
+    for (let i = 1; i < 20; ++i) expect(o["property" + i]).toBe(i);
+    expect(Object.getOwnPropertyNames(o)).toHaveLength(20);
+    expect(Object.keys(o)).toHaveLength(19);
+});
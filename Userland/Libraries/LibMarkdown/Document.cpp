@@ -13,6 +13,11 @@
 namespace Markdown {
 
 DeprecatedString Document::render_to_html(StringView extra_head_contents) const
+{
+    return wrap_in_html_document(render_to_inline_html(), extra_head_contents);
+}
+
+DeprecatedString Document::wrap_in_html_document(StringView inline_html, StringView extra_head_contents)
 {
     StringBuilder builder;
     builder.append(R"~~~(<!DOCTYPE html>
@@ -29,7 +34,7 @@ DeprecatedString Document::render_to_html(StringView extra_head_contents) const
 <body>
 )~~~"sv);
 
-    builder.append(render_to_inline_html());
+    builder.append(inline_html);
 
     builder.append(R"~~~(
 </body>
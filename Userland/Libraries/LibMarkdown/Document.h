@@ -36,6 +36,8 @@ public:
 
     static OwnPtr<Document> parse(StringView);
 
+    static DeprecatedString wrap_in_html_document(StringView inline_html, StringView extra_head_contents = ""sv);
+
 private:
     OwnPtr<ContainerBlock> m_container;
 };
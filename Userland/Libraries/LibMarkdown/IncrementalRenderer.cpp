@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringBuilder.h>
+#include <LibMarkdown/Document.h>
+#include <LibMarkdown/IncrementalRenderer.h>
+
+namespace Markdown {
+
+static size_t fence_run_length(StringView line, char& fence_char)
+{
+    // Matches CodeBlock's open fence: up to 3 spaces of indentation, then a
+    // run of at least 3 backticks or tildes.
+    size_t indent = 0;
+    while (indent < line.length() && indent < 3 && line[indent] == ' ')
+        ++indent;
+    if (indent >= line.length() || (line[indent] != '`' && line[indent] != '~'))
+        return 0;
+    fence_char = line[indent];
+    size_t length = 0;
+    while (indent + length < line.length() && line[indent + length] == fence_char)
+        ++length;
+    return length >= 3 ? length : 0;
+}
+
+static bool is_fence_close(StringView line, char fence_char, size_t open_length)
+{
+    char close_char = 0;
+    auto length = fence_run_length(line, close_char);
+    if (length < open_length || close_char != fence_char)
+        return false;
+    size_t indent = 0;
+    while (indent < line.length() && line[indent] == ' ')
+        ++indent;
+    return line.substring_view(indent + length).is_whitespace() || indent + length == line.length();
+}
+
+static bool looks_like_list_item(StringView line)
+{
+    size_t offset = 0;
+    while (offset < line.length() && line[offset] == ' ')
+        ++offset;
+    if (offset + 1 < line.length() && (line[offset] == '-' || line[offset] == '*' || line[offset] == '+') && line[offset + 1] == ' ')
+        return true;
+    size_t digits = 0;
+    while (offset + digits < line.length() && line[offset + digits] >= '0' && line[offset + digits] <= '9')
+        ++digits;
+    if (digits > 0 && offset + digits + 1 < line.length() && (line[offset + digits] == '.' || line[offset + digits] == ')') && line[offset + digits + 1] == ' ')
+        return true;
+    return false;
+}
+
+Vector<StringView> IncrementalRenderer::split_into_segments(StringView markdown)
+{
+    Vector<StringView> segments;
+
+    bool in_fence = false;
+    char fence_char = 0;
+    size_t fence_open_length = 0;
+    bool in_comment = false;
+    bool previous_line_blank = false;
+
+    size_t segment_start = 0;
+    size_t offset = 0;
+    while (offset < markdown.length()) {
+        auto line_end = markdown.find('\n', offset).value_or(markdown.length());
+        auto line = markdown.substring_view(offset, line_end - offset);
+        bool line_is_blank = line.is_whitespace();
+
+        // A segment may only begin on an unindented, non-blank line that
+        // follows a blank line and is neither inside a fenced code block or
+        // comment, nor a potential continuation of a list interrupted by
+        // blank lines.
+        if (previous_line_blank && !in_fence && !in_comment && !line_is_blank
+            && line[0] != ' ' && line[0] != '\t' && !looks_like_list_item(line)) {
+            segments.append(markdown.substring_view(segment_start, offset - segment_start));
+            segment_start = offset;
+        }
+
+        if (in_comment) {
+            if (line.contains("-->"sv))
+                in_comment = false;
+        } else if (in_fence) {
+            if (is_fence_close(line, fence_char, fence_open_length))
+                in_fence = false;
+        } else if (auto length = fence_run_length(line, fence_char); length > 0) {
+            in_fence = true;
+            fence_open_length = length;
+        } else if (line.trim_whitespace().starts_with("<!--"sv) && !line.contains("-->"sv)) {
+            in_comment = true;
+        }
+
+        previous_line_blank = line_is_blank;
+        offset = line_end + 1;
+    }
+
+    if (segment_start < markdown.length())
+        segments.append(markdown.substring_view(segment_start));
+
+    return segments;
+}
+
+DeprecatedString IncrementalRenderer::render_to_inline_html(StringView markdown)
+{
+    auto segments = split_into_segments(markdown);
+
+    HashMap<DeprecatedString, DeprecatedString> rendered_segments;
+    StringBuilder builder;
+
+    for (auto segment : segments) {
+        auto it = m_rendered_segments.find(segment.hash(), [&](auto& entry) { return entry.key == segment; });
+        if (it != m_rendered_segments.end()) {
+            builder.append(it->value);
+            rendered_segments.set(it->key, it->value);
+        } else {
+            auto html = Document::parse(segment)->render_to_inline_html();
+            builder.append(html);
+            rendered_segments.set(segment, html);
+        }
+    }
+
+    // Dropping the previous map bounds the cache to the current document.
+    m_rendered_segments = move(rendered_segments);
+    return builder.build();
+}
+
+DeprecatedString IncrementalRenderer::render_to_html(StringView markdown, StringView extra_head_contents)
+{
+    return Document::wrap_in_html_document(render_to_inline_html(markdown), extra_head_contents);
+}
+
+}
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/DeprecatedString.h>
+#include <AK/HashMap.h>
+#include <AK/Vector.h>
+
+namespace Markdown {
+
+// Renders a document by splitting it into independently parseable top-level
+// segments and caching each segment's rendered HTML between calls. An edit
+// only re-parses the segments whose text changed, which keeps live previews
+// of large documents cheap.
+class IncrementalRenderer {
+public:
+    DeprecatedString render_to_inline_html(StringView markdown);
+    DeprecatedString render_to_html(StringView markdown, StringView extra_head_contents = ""sv);
+
+private:
+    static Vector<StringView> split_into_segments(StringView markdown);
+
+    HashMap<DeprecatedString, DeprecatedString> m_rendered_segments;
+};
+
+}
@@ -503,6 +503,26 @@ PDFErrorOr<NonnullRefPtr<DictObject>> DocumentParser::parse_file_trailer()
 PDFErrorOr<Value> DocumentParser::parse_compressed_object_with_index(u32 index)
 {
     auto object_stream_index = m_xref_table->object_stream_for_object(index);
+
+    auto cached_stream = m_object_stream_cache.find(object_stream_index);
+    if (cached_stream == m_object_stream_cache.end()) {
+        TRY(load_object_stream(object_stream_index));
+        cached_stream = m_object_stream_cache.find(object_stream_index);
+        VERIFY(cached_stream != m_object_stream_cache.end());
+    }
+
+    auto const& object_stream = cached_stream->value;
+    auto object_byte_offset = object_stream.object_byte_offsets.get(index);
+    if (!object_byte_offset.has_value())
+        return error("Object not found in object stream");
+
+    Parser stream_parser(m_document, object_stream.stream->bytes());
+    stream_parser.move_to(object_stream.first_object_offset + object_byte_offset.value());
+    return TRY(stream_parser.parse_value());
+}
+
+PDFErrorOr<void> DocumentParser::load_object_stream(u32 object_stream_index)
+{
     auto stream_offset = m_xref_table->byte_offset_for_object(object_stream_index);
 
     m_reader.move_to(stream_offset);
@@ -510,7 +530,7 @@ PDFErrorOr<Value> DocumentParser::parse_compressed_object_with_index(u32 index)
     auto first_number = TRY(parse_number());
     auto second_number = TRY(parse_number());
 
-    if (first_number.get<int>() != object_stream_index)
+    if (first_number.get<int>() < 0 || static_cast<u32>(first_number.get<int>()) != object_stream_index)
         return error("Mismatching object stream index");
     if (second_number.get<int>() != 0)
         return error("Non-zero object stream generation number");
@@ -530,19 +550,18 @@ PDFErrorOr<Value> DocumentParser::parse_compressed_object_with_index(u32 index)
     auto first_object_offset = dict->get_value("First").get_u32();
 
     auto stream = TRY(parse_stream(dict));
-    Parser stream_parser(m_document, stream->bytes());
 
+    ObjectStreamCache cache_entry { *stream, first_object_offset, {} };
+
+    Parser stream_parser(m_document, stream->bytes());
     for (u32 i = 0; i < object_count; ++i) {
         auto object_number = TRY(stream_parser.parse_number());
         auto object_offset = TRY(stream_parser.parse_number());
-
-        if (object_number.get_u32() == index) {
-            stream_parser.move_to(first_object_offset + object_offset.get_u32());
-            break;
-        }
+        cache_entry.object_byte_offsets.set(object_number.get_u32(), object_offset.get_u32());
     }
 
-    return TRY(stream_parser.parse_value());
+    m_object_stream_cache.set(object_stream_index, move(cache_entry));
+    return {};
 }
 
 PDFErrorOr<DocumentParser::PageOffsetHintTable> DocumentParser::parse_page_offset_hint_table(ReadonlyBytes hint_stream_bytes)
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <LibPDF/Parser.h>
 
 namespace PDF {
@@ -71,6 +72,14 @@ private:
         u32 page_content_stream_length_number { 0 };
     };
 
+    // Object streams are compressed as a whole; decode and index each stream
+    // only once so every object fetched from it reuses the decoded bytes.
+    struct ObjectStreamCache {
+        NonnullRefPtr<StreamObject> stream;
+        u32 first_object_offset { 0 };
+        HashMap<u32, u32> object_byte_offsets;
+    };
+
     friend struct AK::Formatter<LinearizationDictionary>;
     friend struct AK::Formatter<PageOffsetHintTable>;
     friend struct AK::Formatter<PageOffsetHintTableEntry>;
@@ -87,6 +96,7 @@ private:
     PDFErrorOr<NonnullRefPtr<XRefTable>> parse_xref_table();
     PDFErrorOr<NonnullRefPtr<DictObject>> parse_file_trailer();
     PDFErrorOr<Value> parse_compressed_object_with_index(u32 index);
+    PDFErrorOr<void> load_object_stream(u32 object_stream_index);
 
     bool navigate_to_before_eof_marker();
     bool navigate_to_after_startxref();
@@ -94,6 +104,7 @@ private:
     RefPtr<XRefTable> m_xref_table;
     RefPtr<DictObject> m_trailer;
     Optional<LinearizationDictionary> m_linearization_dictionary;
+    HashMap<u32, ObjectStreamCache> m_object_stream_cache;
 };
 
 }
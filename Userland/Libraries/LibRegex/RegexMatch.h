@@ -415,6 +415,30 @@ public:
             });
     }
 
+    // Returns the first index at or after the given one holding the given
+    // ASCII code point, or length() if there is none. Views the matcher can't
+    // index in constant time (UTF-8/UTF-16) just return the given index, so
+    // callers degrade to trying every position.
+    size_t fast_forward_to_code_point(u32 code_point, size_t index) const
+    {
+        return m_view.visit(
+            [&](StringView view) -> size_t {
+                if (auto found = view.find(static_cast<char>(code_point), index); found.has_value())
+                    return *found;
+                return view.length();
+            },
+            [&](Utf32View const& view) -> size_t {
+                auto length = view.length();
+                for (auto i = index; i < length; ++i) {
+                    if (view.code_points()[i] == code_point)
+                        return i;
+                }
+                return length;
+            },
+            [&](Utf16View const&) -> size_t { return index; },
+            [&](Utf8View const&) -> size_t { return index; });
+    }
+
     size_t code_unit_offset_of(size_t code_point_index) const
     {
         return m_view.visit(
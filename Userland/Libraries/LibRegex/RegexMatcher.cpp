@@ -183,6 +183,11 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
     if (input.regex_options.has_flag_set(AllFlags::Sticky))
         continue_search = false;
 
+    // Sticky matches must start exactly at start_offset, so skipping ahead to
+    // the first position that could match would change the result there.
+    auto const& required_starting_code_point = m_pattern->parser_result.required_starting_code_point;
+    bool scan_for_starting_code_point = required_starting_code_point.has_value() && !input.regex_options.has_flag_set(AllFlags::Sticky);
+
     auto single_match_only = input.regex_options.has_flag_set(AllFlags::SingleMatch);
 
     for (auto const& view : views) {
@@ -227,6 +232,11 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
         }
 
         for (; view_index <= view_length; ++view_index) {
+            // Positions before the next occurrence of the required starting
+            // code point cannot possibly begin a match; skip straight past them.
+            if (scan_for_starting_code_point && view_index < view_length)
+                view_index = view.fast_forward_to_code_point(*required_starting_code_point, view_index);
+
             if (view_index == view_length && input.regex_options.has_flag_set(AllFlags::Multiline))
                 break;
 
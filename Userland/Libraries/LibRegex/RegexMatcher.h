@@ -233,6 +233,7 @@ public:
 private:
     void run_optimization_passes();
     void attempt_rewrite_loops_as_atomic_groups(BasicBlockList const&);
+    void attempt_compute_required_starting_code_point();
 };
 
 // free standing functions for match, search and has_match
@@ -28,6 +28,57 @@ void Regex<Parser>::run_optimization_passes()
     attempt_rewrite_loops_as_atomic_groups(split_basic_blocks(parser_result.bytecode));
 
     parser_result.bytecode.flatten();
+
+    attempt_compute_required_starting_code_point();
+}
+
+template<typename Parser>
+void Regex<Parser>::attempt_compute_required_starting_code_point()
+{
+    // If every possible match has to begin with one specific ASCII code point,
+    // remember it; the matcher can then scan ahead for it (memchr() on plain
+    // strings) instead of attempting a match at every single input position.
+    // Case-insensitive patterns are left alone, as two characters would have
+    // to be scanned for.
+    if (parser_result.options.has_flag_set(AllFlags::Insensitive))
+        return;
+
+    auto& bytecode = parser_result.bytecode;
+    MatchState state;
+    while (state.instruction_position < bytecode.size()) {
+        auto& opcode = bytecode.get_opcode(state);
+        switch (opcode.opcode_id()) {
+        // Bookkeeping and assertion opcodes don't consume anything, so they
+        // can't influence what the first consumed character is.
+        case OpCodeId::CheckBegin:
+        case OpCodeId::CheckBoundary:
+        case OpCodeId::Save:
+        case OpCodeId::SaveLeftCaptureGroup:
+        case OpCodeId::ClearCaptureGroup:
+        case OpCodeId::Checkpoint:
+            state.instruction_position += opcode.size();
+            continue;
+        case OpCodeId::Compare: {
+            auto flat_compares = static_cast<OpCode_Compare const&>(opcode).flat_compares();
+            // Note: Inverse and friends produce their own entries, so a single
+            //       Char (or String, whose entry holds its first character)
+            //       entry really is a plain literal comparison.
+            if (flat_compares.size() != 1)
+                return;
+            auto const& compare = flat_compares.first();
+            if (compare.type != CharacterCompareType::Char && compare.type != CharacterCompareType::String)
+                return;
+            if (compare.value >= 0x80)
+                return;
+            parser_result.required_starting_code_point = compare.value;
+            return;
+        }
+        default:
+            // Anything else (forks, repeats, GoBack for lookbehind, ...) can
+            // start a match in more than one way; give up.
+            return;
+        }
+    }
 }
 
 template<typename Parser>
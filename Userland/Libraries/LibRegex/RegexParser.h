@@ -55,6 +55,12 @@ public:
         Token error_token;
         Vector<FlyString> capture_groups;
         AllOptions options;
+
+        // Filled in by Regex::run_optimization_passes() when every possible
+        // match has to begin with one specific ASCII code point; the matcher
+        // then skips ahead to its next occurrence instead of attempting a
+        // match at every input position.
+        Optional<u32> required_starting_code_point;
     };
 
     explicit Parser(Lexer& lexer)
@@ -0,0 +1,496 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringBuilder.h>
+#include <LibSQL/AST/AST.h>
+#include <LibSQL/AST/ExpressionBytecode.h>
+#include <LibSQL/Tuple.h>
+
+namespace SQL::AST {
+
+struct CompiledExpression::Compiler {
+    // The types of the values a program leaves on the stack, tracked while
+    // compiling. A slot with an unknown type compiles to generic opcodes;
+    // a slot holding a constant remembers where, so comparisons against
+    // integer columns can convert integral float literals up front.
+    struct StackSlot {
+        Optional<SQLType> type;
+        Optional<u32> constant_index;
+    };
+
+    TupleDescriptor const& descriptor;
+    Vector<Instruction> instructions {};
+    Vector<Value> constants {};
+    Vector<StackSlot> stack {};
+    size_t max_stack_depth { 0 };
+
+    void emit(Opcode opcode, u32 operand = 0)
+    {
+        instructions.append({ opcode, operand });
+    }
+
+    void push(StackSlot slot)
+    {
+        stack.append(move(slot));
+        max_stack_depth = max(max_stack_depth, stack.size());
+    }
+
+    bool compile_constant(Value value)
+    {
+        auto index = static_cast<u32>(constants.size());
+        auto type = value.is_null() ? Optional<SQLType> {} : value.type();
+        constants.append(move(value));
+        emit(Opcode::PushConstant, index);
+        push({ type, index });
+        return true;
+    }
+
+    bool compile_column(ColumnNameExpression const& column)
+    {
+        // Mirrors the resolution in ColumnNameExpression::evaluate();
+        // expressions it would reject at runtime simply don't compile, so
+        // the AST fallback gets to produce the error.
+        Optional<size_t> index_in_row;
+        for (auto ix = 0u; ix < descriptor.size(); ix++) {
+            auto& column_descriptor = descriptor[ix];
+            if (!column.table_name().is_empty() && column_descriptor.table != column.table_name())
+                continue;
+            if (column_descriptor.name == column.column_name()) {
+                if (index_in_row.has_value())
+                    return false;
+                index_in_row = ix;
+            }
+        }
+        if (!index_in_row.has_value())
+            return false;
+
+        emit(Opcode::PushColumn, static_cast<u32>(index_in_row.value()));
+        push({ descriptor[index_in_row.value()].type, {} });
+        return true;
+    }
+
+    bool slot_is_integer_comparable(StackSlot const& slot) const
+    {
+        if (slot.type == SQLType::Integer)
+            return true;
+        // An integral float literal can stand in for an integer: every
+        // 32-bit int converts to a double and back without loss.
+        if (slot.type == SQLType::Float && slot.constant_index.has_value()) {
+            auto const& constant = constants[slot.constant_index.value()];
+            auto as_int = constant.to_int();
+            auto as_double = constant.to_double();
+            return as_int.has_value() && as_double.has_value() && as_double.value() == static_cast<double>(as_int.value());
+        }
+        return false;
+    }
+
+    bool specialize_comparison(StackSlot& lhs, StackSlot& rhs)
+    {
+        if (lhs.type != SQLType::Integer && rhs.type != SQLType::Integer)
+            return false;
+        if (!slot_is_integer_comparable(lhs) || !slot_is_integer_comparable(rhs))
+            return false;
+
+        for (auto* slot : { &lhs, &rhs }) {
+            if (slot->type != SQLType::Integer) {
+                auto& constant = constants[slot->constant_index.value()];
+                constant = Value(constant.to_int().value());
+                slot->type = SQLType::Integer;
+            }
+        }
+        return true;
+    }
+
+    bool compile_binary_operator(BinaryOperatorExpression const& binary)
+    {
+        if (!compile(*binary.lhs()) || !compile(*binary.rhs()))
+            return false;
+
+        auto rhs_slot = stack.take_last();
+        auto lhs_slot = stack.take_last();
+        bool specialized = false;
+
+        switch (binary.type()) {
+        case BinaryOperator::Concatenate:
+            emit(Opcode::Concatenate);
+            push({ SQLType::Text, {} });
+            return true;
+        case BinaryOperator::Multiplication:
+            emit(Opcode::Multiply);
+            break;
+        case BinaryOperator::Division:
+            emit(Opcode::Divide);
+            break;
+        case BinaryOperator::Modulo:
+            emit(Opcode::Modulo);
+            break;
+        case BinaryOperator::Plus:
+            emit(Opcode::Add);
+            break;
+        case BinaryOperator::Minus:
+            emit(Opcode::Subtract);
+            break;
+        case BinaryOperator::ShiftLeft:
+            emit(Opcode::ShiftLeft);
+            break;
+        case BinaryOperator::ShiftRight:
+            emit(Opcode::ShiftRight);
+            break;
+        case BinaryOperator::BitwiseAnd:
+            emit(Opcode::BitwiseAnd);
+            break;
+        case BinaryOperator::BitwiseOr:
+            emit(Opcode::BitwiseOr);
+            break;
+        case BinaryOperator::LessThan:
+            specialized = specialize_comparison(lhs_slot, rhs_slot);
+            emit(specialized ? Opcode::IntLessThan : Opcode::LessThan);
+            push({ SQLType::Boolean, {} });
+            return true;
+        case BinaryOperator::LessThanEquals:
+            specialized = specialize_comparison(lhs_slot, rhs_slot);
+            emit(specialized ? Opcode::IntLessThanEquals : Opcode::LessThanEquals);
+            push({ SQLType::Boolean, {} });
+            return true;
+        case BinaryOperator::GreaterThan:
+            specialized = specialize_comparison(lhs_slot, rhs_slot);
+            emit(specialized ? Opcode::IntGreaterThan : Opcode::GreaterThan);
+            push({ SQLType::Boolean, {} });
+            return true;
+        case BinaryOperator::GreaterThanEquals:
+            specialized = specialize_comparison(lhs_slot, rhs_slot);
+            emit(specialized ? Opcode::IntGreaterThanEquals : Opcode::GreaterThanEquals);
+            push({ SQLType::Boolean, {} });
+            return true;
+        case BinaryOperator::Equals:
+            specialized = specialize_comparison(lhs_slot, rhs_slot);
+            emit(specialized ? Opcode::IntEquals : Opcode::Equals);
+            push({ SQLType::Boolean, {} });
+            return true;
+        case BinaryOperator::NotEquals:
+            specialized = specialize_comparison(lhs_slot, rhs_slot);
+            emit(specialized ? Opcode::IntNotEquals : Opcode::NotEquals);
+            push({ SQLType::Boolean, {} });
+            return true;
+        case BinaryOperator::And:
+            emit(Opcode::And);
+            push({ SQLType::Boolean, {} });
+            return true;
+        case BinaryOperator::Or:
+            emit(Opcode::Or);
+            push({ SQLType::Boolean, {} });
+            return true;
+        default:
+            return false;
+        }
+
+        // Arithmetic results convert their operands as they see fit, so the
+        // result type is not tracked.
+        push({ {}, {} });
+        return true;
+    }
+
+    bool compile_unary_operator(UnaryOperatorExpression const& unary)
+    {
+        if (!compile(*unary.expression()))
+            return false;
+
+        auto slot = stack.take_last();
+        switch (unary.type()) {
+        case UnaryOperator::Plus:
+            emit(Opcode::UnaryPlus);
+            push({ slot.type, slot.constant_index });
+            return true;
+        case UnaryOperator::Minus:
+            emit(Opcode::UnaryMinus);
+            push({ slot.type, {} });
+            return true;
+        case UnaryOperator::Not:
+            emit(Opcode::UnaryNot);
+            push({ SQLType::Boolean, {} });
+            return true;
+        case UnaryOperator::BitwiseNot:
+            emit(Opcode::UnaryBitwiseNot);
+            push({ SQLType::Integer, {} });
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool compile(Expression const& expression)
+    {
+        if (is<NumericLiteral>(expression))
+            return compile_constant(Value(static_cast<NumericLiteral const&>(expression).value()));
+        if (is<StringLiteral>(expression))
+            return compile_constant(Value(static_cast<StringLiteral const&>(expression).value()));
+        if (is<NullLiteral>(expression))
+            return compile_constant(Value());
+        if (is<ColumnNameExpression>(expression))
+            return compile_column(static_cast<ColumnNameExpression const&>(expression));
+        if (is<ChainedExpression>(expression)) {
+            auto const& chain = static_cast<ChainedExpression const&>(expression);
+            for (auto& sub_expression : chain.expressions()) {
+                if (!compile(sub_expression))
+                    return false;
+            }
+            emit(Opcode::MakeTuple, static_cast<u32>(chain.expressions().size()));
+            stack.resize(stack.size() - chain.expressions().size());
+            push({ SQLType::Tuple, {} });
+            return true;
+        }
+        if (is<UnaryOperatorExpression>(expression))
+            return compile_unary_operator(static_cast<UnaryOperatorExpression const&>(expression));
+        if (is<BinaryOperatorExpression>(expression))
+            return compile_binary_operator(static_cast<BinaryOperatorExpression const&>(expression));
+
+        // Everything else (matches, casts, subqueries, placeholders, ...)
+        // keeps walking the AST.
+        return false;
+    }
+};
+
+Optional<CompiledExpression> CompiledExpression::compile(Expression const& expression, TupleDescriptor const& descriptor)
+{
+    Compiler compiler { descriptor };
+    if (!compiler.compile(expression))
+        return {};
+
+    VERIFY(compiler.stack.size() == 1);
+    return CompiledExpression { move(compiler.instructions), move(compiler.constants), compiler.max_stack_depth };
+}
+
+// Compares two values known at compile time to be integers. Nulls (and any
+// value that still fails to produce an integer) fall back to the generic
+// comparison, whose semantics they share.
+static int compare_integers(Value const& lhs, Value const& rhs)
+{
+    auto lhs_int = lhs.to_int();
+    auto rhs_int = rhs.to_int();
+    if (!lhs_int.has_value() || !rhs_int.has_value())
+        return lhs.compare(rhs);
+    if (lhs_int.value() == rhs_int.value())
+        return 0;
+    return lhs_int.value() < rhs_int.value() ? -1 : 1;
+}
+
+ResultOr<Value> CompiledExpression::evaluate(Tuple const& row) const
+{
+    Vector<Value> stack;
+    TRY(stack.try_ensure_capacity(m_max_stack_depth));
+
+    for (auto const& instruction : m_instructions) {
+        switch (instruction.opcode) {
+        case Opcode::PushConstant:
+            stack.unchecked_append(m_constants[instruction.operand]);
+            break;
+        case Opcode::PushColumn:
+            stack.unchecked_append(row[instruction.operand]);
+            break;
+        case Opcode::Concatenate: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            if (lhs.type() != SQLType::Text)
+                return Result { SQLCommand::Unknown, SQLErrorCode::BooleanOperatorTypeMismatch, BinaryOperator_name(BinaryOperator::Concatenate) };
+            StringBuilder builder;
+            builder.append(lhs.to_deprecated_string());
+            builder.append(rhs.to_deprecated_string());
+            lhs = Value(builder.to_deprecated_string());
+            break;
+        }
+        case Opcode::Multiply: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            lhs = TRY(lhs.multiply(rhs));
+            break;
+        }
+        case Opcode::Divide: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            lhs = TRY(lhs.divide(rhs));
+            break;
+        }
+        case Opcode::Modulo: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            lhs = TRY(lhs.modulo(rhs));
+            break;
+        }
+        case Opcode::Add: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            lhs = TRY(lhs.add(rhs));
+            break;
+        }
+        case Opcode::Subtract: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            lhs = TRY(lhs.subtract(rhs));
+            break;
+        }
+        case Opcode::ShiftLeft: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            lhs = TRY(lhs.shift_left(rhs));
+            break;
+        }
+        case Opcode::ShiftRight: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            lhs = TRY(lhs.shift_right(rhs));
+            break;
+        }
+        case Opcode::BitwiseAnd: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            lhs = TRY(lhs.bitwise_and(rhs));
+            break;
+        }
+        case Opcode::BitwiseOr: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            lhs = TRY(lhs.bitwise_or(rhs));
+            break;
+        }
+        case Opcode::LessThan: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            lhs = Value(lhs.compare(rhs) < 0);
+            break;
+        }
+        case Opcode::LessThanEquals: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            lhs = Value(lhs.compare(rhs) <= 0);
+            break;
+        }
+        case Opcode::GreaterThan: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            lhs = Value(lhs.compare(rhs) > 0);
+            break;
+        }
+        case Opcode::GreaterThanEquals: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            lhs = Value(lhs.compare(rhs) >= 0);
+            break;
+        }
+        case Opcode::Equals: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            lhs = Value(lhs.compare(rhs) == 0);
+            break;
+        }
+        case Opcode::NotEquals: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            lhs = Value(lhs.compare(rhs) != 0);
+            break;
+        }
+        case Opcode::IntLessThan: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            lhs = Value(compare_integers(lhs, rhs) < 0);
+            break;
+        }
+        case Opcode::IntLessThanEquals: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            lhs = Value(compare_integers(lhs, rhs) <= 0);
+            break;
+        }
+        case Opcode::IntGreaterThan: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            lhs = Value(compare_integers(lhs, rhs) > 0);
+            break;
+        }
+        case Opcode::IntGreaterThanEquals: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            lhs = Value(compare_integers(lhs, rhs) >= 0);
+            break;
+        }
+        case Opcode::IntEquals: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            lhs = Value(compare_integers(lhs, rhs) == 0);
+            break;
+        }
+        case Opcode::IntNotEquals: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            lhs = Value(compare_integers(lhs, rhs) != 0);
+            break;
+        }
+        case Opcode::And: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            auto lhs_bool = lhs.to_bool();
+            auto rhs_bool = rhs.to_bool();
+            if (!lhs_bool.has_value() || !rhs_bool.has_value())
+                return Result { SQLCommand::Unknown, SQLErrorCode::BooleanOperatorTypeMismatch, BinaryOperator_name(BinaryOperator::And) };
+            lhs = Value(lhs_bool.value() && rhs_bool.value());
+            break;
+        }
+        case Opcode::Or: {
+            auto rhs = stack.take_last();
+            auto& lhs = stack.last();
+            auto lhs_bool = lhs.to_bool();
+            auto rhs_bool = rhs.to_bool();
+            if (!lhs_bool.has_value() || !rhs_bool.has_value())
+                return Result { SQLCommand::Unknown, SQLErrorCode::BooleanOperatorTypeMismatch, BinaryOperator_name(BinaryOperator::Or) };
+            lhs = Value(lhs_bool.value() || rhs_bool.value());
+            break;
+        }
+        case Opcode::UnaryPlus: {
+            auto& value = stack.last();
+            if (value.type() != SQLType::Integer && value.type() != SQLType::Float)
+                return Result { SQLCommand::Unknown, SQLErrorCode::NumericOperatorTypeMismatch, UnaryOperator_name(UnaryOperator::Plus) };
+            break;
+        }
+        case Opcode::UnaryMinus: {
+            auto& value = stack.last();
+            if (value.type() == SQLType::Integer)
+                value = Value(-value.to_int().value());
+            else if (value.type() == SQLType::Float)
+                value = Value(-value.to_double().value());
+            else
+                return Result { SQLCommand::Unknown, SQLErrorCode::NumericOperatorTypeMismatch, UnaryOperator_name(UnaryOperator::Minus) };
+            break;
+        }
+        case Opcode::UnaryNot: {
+            auto& value = stack.last();
+            if (value.type() != SQLType::Boolean)
+                return Result { SQLCommand::Unknown, SQLErrorCode::BooleanOperatorTypeMismatch, UnaryOperator_name(UnaryOperator::Not) };
+            value = Value(!value.to_bool().value());
+            break;
+        }
+        case Opcode::UnaryBitwiseNot: {
+            auto& value = stack.last();
+            if (value.type() != SQLType::Integer)
+                return Result { SQLCommand::Unknown, SQLErrorCode::IntegerOperatorTypeMismatch, UnaryOperator_name(UnaryOperator::BitwiseNot) };
+            value = Value(~value.to_u32().value());
+            break;
+        }
+        case Opcode::MakeTuple: {
+            Vector<Value> values;
+            TRY(values.try_ensure_capacity(instruction.operand));
+            for (auto ix = stack.size() - instruction.operand; ix < stack.size(); ++ix)
+                values.unchecked_append(move(stack[ix]));
+            stack.shrink(stack.size() - instruction.operand, true);
+            stack.unchecked_append(TRY(Value::create_tuple(move(values))));
+            break;
+        }
+        }
+    }
+
+    VERIFY(stack.size() == 1);
+    return stack.take_last();
+}
+
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibSQL/TupleDescriptor.h>
+#include <LibSQL/Value.h>
+
+namespace SQL::AST {
+
+class Expression;
+
+/**
+ * Lowers an Expression tree to a flat stack machine program, so the per-row
+ * hot loop of a SELECT doesn't have to walk the AST for every row. Column
+ * references are resolved against the row descriptor once, at compile time,
+ * and comparisons whose operand types are statically known to be integers are
+ * emitted as integer-specialized opcodes that skip the generic Value
+ * dispatch.
+ *
+ * Compilation is best-effort: an expression using a feature the compiler
+ * doesn't know about simply fails to compile, and the caller keeps
+ * evaluating the AST directly. A compiled program always produces the same
+ * values and errors as the AST it was built from.
+ */
+class CompiledExpression {
+public:
+    static Optional<CompiledExpression> compile(Expression const&, TupleDescriptor const&);
+
+    ResultOr<Value> evaluate(Tuple const& row) const;
+
+private:
+    enum class Opcode : u8 {
+        PushConstant, // operand: index into the constant table
+        PushColumn,   // operand: index into the row
+
+        // These pop two values and push the combined value, mirroring
+        // BinaryOperatorExpression::evaluate().
+        Concatenate,
+        Multiply,
+        Divide,
+        Modulo,
+        Add,
+        Subtract,
+        ShiftLeft,
+        ShiftRight,
+        BitwiseAnd,
+        BitwiseOr,
+        LessThan,
+        LessThanEquals,
+        GreaterThan,
+        GreaterThanEquals,
+        Equals,
+        NotEquals,
+        And,
+        Or,
+
+        // Comparisons specialized for two integer operands.
+        IntLessThan,
+        IntLessThanEquals,
+        IntGreaterThan,
+        IntGreaterThanEquals,
+        IntEquals,
+        IntNotEquals,
+
+        // These pop one value, mirroring UnaryOperatorExpression::evaluate().
+        UnaryPlus,
+        UnaryMinus,
+        UnaryNot,
+        UnaryBitwiseNot,
+
+        MakeTuple, // operand: number of values to pop
+    };
+
+    struct Instruction {
+        Opcode opcode { Opcode::PushConstant };
+        u32 operand { 0 };
+    };
+
+    struct Compiler;
+
+    CompiledExpression(Vector<Instruction> instructions, Vector<Value> constants, size_t max_stack_depth)
+        : m_instructions(move(instructions))
+        , m_constants(move(constants))
+        , m_max_stack_depth(max_stack_depth)
+    {
+    }
+
+    Vector<Instruction> m_instructions;
+    Vector<Value> m_constants;
+    size_t m_max_stack_depth { 0 };
+};
+
+}
@@ -6,12 +6,113 @@
 
 #include <AK/NumericLimits.h>
 #include <LibSQL/AST/AST.h>
+#include <LibSQL/AST/ExpressionBytecode.h>
 #include <LibSQL/Database.h>
 #include <LibSQL/Meta.h>
 #include <LibSQL/Row.h>
 
 namespace SQL::AST {
 
+static Optional<size_t> resolve_column_index(TableDef const& table, ColumnNameExpression const& column)
+{
+    if (!column.table_name().is_empty() && column.table_name() != table.name())
+        return {};
+    for (size_t ix = 0; ix < table.columns().size(); ++ix) {
+        if (table.columns()[ix].name() == column.column_name())
+            return ix;
+    }
+    return {};
+}
+
+// Collects the WHERE predicates that can be checked while scanning the table
+// itself: AND-ed comparisons between a column of the scanned table and a
+// literal, and prefix LIKE patterns. Anything it cannot push down is simply
+// left for the per-row evaluation of the full WHERE clause, which still runs
+// over every returned row.
+static ResultOr<void> collect_pushdown_predicates(Expression const& expression, TableDef const& table, ExecutionContext& context, Vector<ColumnPredicate>& predicates)
+{
+    // A parenthesized expression parses as a chain with a single element.
+    if (is<ChainedExpression>(expression)) {
+        auto const& chain = static_cast<ChainedExpression const&>(expression);
+        if (chain.expressions().size() == 1)
+            return collect_pushdown_predicates(chain.expressions()[0], table, context, predicates);
+        return {};
+    }
+
+    if (is<BinaryOperatorExpression>(expression)) {
+        auto const& binary = static_cast<BinaryOperatorExpression const&>(expression);
+
+        if (binary.type() == BinaryOperator::And) {
+            TRY(collect_pushdown_predicates(*binary.lhs(), table, context, predicates));
+            TRY(collect_pushdown_predicates(*binary.rhs(), table, context, predicates));
+            return {};
+        }
+
+        if (binary.type() != BinaryOperator::Equals && binary.type() != BinaryOperator::LessThan && binary.type() != BinaryOperator::GreaterThan)
+            return {};
+
+        auto is_literal = [](Expression const& expression) {
+            return is<NumericLiteral>(expression) || is<StringLiteral>(expression);
+        };
+
+        ColumnNameExpression const* column = nullptr;
+        Expression const* literal = nullptr;
+        auto operation = ColumnPredicate::Operation::Equals;
+
+        if (is<ColumnNameExpression>(*binary.lhs()) && is_literal(*binary.rhs())) {
+            column = &static_cast<ColumnNameExpression const&>(*binary.lhs());
+            literal = binary.rhs();
+            if (binary.type() == BinaryOperator::LessThan)
+                operation = ColumnPredicate::Operation::LessThan;
+            else if (binary.type() == BinaryOperator::GreaterThan)
+                operation = ColumnPredicate::Operation::GreaterThan;
+        } else if (is_literal(*binary.lhs()) && is<ColumnNameExpression>(*binary.rhs())) {
+            column = &static_cast<ColumnNameExpression const&>(*binary.rhs());
+            literal = binary.lhs();
+            // The column is on the right-hand side, so the comparison flips.
+            if (binary.type() == BinaryOperator::LessThan)
+                operation = ColumnPredicate::Operation::GreaterThan;
+            else if (binary.type() == BinaryOperator::GreaterThan)
+                operation = ColumnPredicate::Operation::LessThan;
+        } else {
+            return {};
+        }
+
+        auto column_index = resolve_column_index(table, *column);
+        if (!column_index.has_value())
+            return {};
+
+        predicates.append({ column_index.value(), operation, TRY(literal->evaluate(context)) });
+        return {};
+    }
+
+    if (is<MatchExpression>(expression)) {
+        auto const& match = static_cast<MatchExpression const&>(expression);
+        if (match.type() != MatchOperator::Like || match.invert_expression() || match.escape())
+            return {};
+        if (!is<ColumnNameExpression>(*match.lhs()) || !is<StringLiteral>(*match.rhs()))
+            return {};
+
+        auto column_index = resolve_column_index(table, static_cast<ColumnNameExpression const&>(*match.lhs()));
+        if (!column_index.has_value())
+            return {};
+
+        // Only patterns that pin down a literal prefix can be pushed; a
+        // trailing '%' is stripped, and any other wildcard defeats us. The
+        // prefix check is an over-approximation of the full LIKE match, which
+        // the WHERE clause still applies afterwards.
+        auto pattern = static_cast<StringLiteral const&>(*match.rhs()).value();
+        auto prefix = pattern.ends_with('%') ? pattern.substring_view(0, pattern.length() - 1) : pattern.view();
+        if (prefix.is_empty() || prefix.contains('%') || prefix.contains('_'))
+            return {};
+
+        predicates.append({ column_index.value(), ColumnPredicate::Operation::StartsWith, Value { prefix } });
+        return {};
+    }
+
+    return {};
+}
+
 ResultOr<ResultSet> Select::execute(ExecutionContext& context) const
 {
     NonnullRefPtrVector<ResultColumn> columns;
@@ -55,6 +156,16 @@ ResultOr<ResultSet> Select::execute(ExecutionContext& context) const
     tuple.append(Value { true });
     rows.append(tuple);
 
+    // When a single table is scanned, the parts of the WHERE clause that
+    // compare its columns against literals are checked during the scan, so
+    // rows that cannot match are never materialized.
+    Vector<ColumnPredicate> pushdown_predicates;
+    if (where_clause() && table_or_subquery_list().size() == 1 && table_or_subquery_list()[0].is_table()) {
+        auto const& table_descriptor = table_or_subquery_list()[0];
+        auto table_def = TRY(context.database->get_table(table_descriptor.schema_name(), table_descriptor.table_name()));
+        TRY(collect_pushdown_predicates(*where_clause(), *table_def, context, pushdown_predicates));
+    }
+
     for (auto& table_descriptor : table_or_subquery_list()) {
         if (!table_descriptor.is_table())
             return Result { SQLCommand::Select, SQLErrorCode::NotYetImplemented, "Sub-selects are not yet implemented"sv };
@@ -68,7 +179,7 @@ ResultOr<ResultSet> Select::execute(ExecutionContext& context) const
 
         while (!rows.is_empty() && (rows.first().size() == old_descriptor_size)) {
             auto cartesian_row = rows.take_first();
-            auto table_rows = TRY(context.database->select_all(*table_def));
+            auto table_rows = TRY(context.database->select_matching(*table_def, pushdown_predicates));
 
             for (auto& table_row : table_rows) {
                 auto new_row = cartesian_row;
@@ -78,6 +189,18 @@ ResultOr<ResultSet> Select::execute(ExecutionContext& context) const
         }
     }
 
+    // The expressions evaluated for every row are lowered to bytecode once,
+    // now that the full row descriptor is known; anything the compiler
+    // doesn't support keeps walking the AST.
+    Optional<CompiledExpression> compiled_where;
+    if (where_clause())
+        compiled_where = CompiledExpression::compile(*where_clause(), *descriptor);
+
+    Vector<Optional<CompiledExpression>> compiled_columns;
+    TRY(compiled_columns.try_ensure_capacity(columns.size()));
+    for (auto& col : columns)
+        compiled_columns.unchecked_append(CompiledExpression::compile(*col.expression(), *descriptor));
+
     bool has_ordering { false };
     auto sort_descriptor = adopt_ref(*new TupleDescriptor);
     for (auto& term : m_ordering_term_list) {
@@ -90,15 +213,20 @@ ResultOr<ResultSet> Select::execute(ExecutionContext& context) const
         context.current_row = &row;
 
         if (where_clause()) {
-            auto where_result = TRY(where_clause()->evaluate(context)).to_bool();
+            auto where_value = compiled_where.has_value()
+                ? TRY(compiled_where->evaluate(row))
+                : TRY(where_clause()->evaluate(context));
+            auto where_result = where_value.to_bool();
             if (!where_result.has_value() || !where_result.value())
                 continue;
         }
 
         tuple.clear();
 
-        for (auto& col : columns) {
-            auto value = TRY(col.expression()->evaluate(context));
+        for (size_t ix = 0; ix < columns.size(); ++ix) {
+            auto value = compiled_columns[ix].has_value()
+                ? TRY(compiled_columns[ix]->evaluate(row))
+                : TRY(columns[ix].expression()->evaluate(context));
             tuple.append(value);
         }
 
@@ -181,6 +181,44 @@ ErrorOr<Vector<Row>> Database::select_all(TableDef const& table)
     return ret;
 }
 
+ErrorOr<Vector<Row>> Database::select_matching(TableDef const& table, Vector<ColumnPredicate> const& predicates)
+{
+    if (predicates.is_empty())
+        return select_all(table);
+
+    VERIFY(m_table_cache.get(table.key().hash()).has_value());
+    Vector<Row> ret;
+    for (auto pointer = table.pointer(); pointer;) {
+        auto row = m_serializer.deserialize_block<Row>(pointer, table, pointer);
+        pointer = row.next_pointer();
+
+        bool matches = true;
+        for (auto& predicate : predicates) {
+            auto const& value = row[predicate.column_index];
+            switch (predicate.operation) {
+            case ColumnPredicate::Operation::Equals:
+                matches = value == predicate.value;
+                break;
+            case ColumnPredicate::Operation::LessThan:
+                matches = value < predicate.value;
+                break;
+            case ColumnPredicate::Operation::GreaterThan:
+                matches = value > predicate.value;
+                break;
+            case ColumnPredicate::Operation::StartsWith:
+                // LIKE comparisons are case-insensitive.
+                matches = value.to_deprecated_string().starts_with(predicate.value.to_deprecated_string(), CaseSensitivity::CaseInsensitive);
+                break;
+            }
+            if (!matches)
+                break;
+        }
+        if (matches)
+            ret.append(move(row));
+    }
+    return ret;
+}
+
 ErrorOr<Vector<Row>> Database::match(TableDef const& table, Key const& key)
 {
     VERIFY(m_table_cache.get(table.key().hash()).has_value());
@@ -15,9 +15,29 @@
 #include <LibSQL/Meta.h>
 #include <LibSQL/Result.h>
 #include <LibSQL/Serializer.h>
+#include <LibSQL/Value.h>
 
 namespace SQL {
 
+/**
+ * A comparison between one column of a table and a constant value. Predicates
+ * extracted from a WHERE clause are checked while scanning the table, so rows
+ * that cannot match are never materialized into the result set.
+ */
+struct ColumnPredicate {
+    enum class Operation {
+        Equals,
+        LessThan,
+        GreaterThan,
+        // Case-insensitive prefix match, for LIKE patterns of the form 'abc%'.
+        StartsWith,
+    };
+
+    size_t column_index { 0 };
+    Operation operation { Operation::Equals };
+    Value value;
+};
+
 /**
  * A Database object logically connects a Heap with the SQL data we want
  * to store in it. It has BTree pointers for B-Trees holding the definitions
@@ -42,6 +62,7 @@ public:
     ResultOr<NonnullRefPtr<TableDef>> get_table(DeprecatedString const&, DeprecatedString const&);
 
     ErrorOr<Vector<Row>> select_all(TableDef const&);
+    ErrorOr<Vector<Row>> select_matching(TableDef const&, Vector<ColumnPredicate> const&);
     ErrorOr<Vector<Row>> match(TableDef const&, Key const&);
     ErrorOr<void> insert(Row&);
     ErrorOr<void> remove(Row&);
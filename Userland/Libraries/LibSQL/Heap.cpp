@@ -72,6 +72,11 @@ ErrorOr<ByteBuffer> Heap::read_block(u32 block)
     if (auto buffer = m_write_ahead_log.get(block); buffer.has_value())
         return TRY(ByteBuffer::copy(*buffer));
 
+    if (auto it = m_block_cache.find(block); it != m_block_cache.end()) {
+        it->value.last_used = m_block_cache_counter++;
+        return TRY(ByteBuffer::copy(it->value.data));
+    }
+
     if (block >= m_next_block) {
         warnln("Heap({})::read_block({}): block # out of range (>= {})"sv, name(), block, m_next_block);
         return Error::from_string_literal("Heap()::read_block(): block # out of range");
@@ -86,9 +91,25 @@ ErrorOr<ByteBuffer> Heap::read_block(u32 block)
     dbgln_if(SQL_DEBUG, "{:hex-dump}", bytes.trim(8));
     TRY(buffer.try_resize(bytes.size()));
 
+    cache_block(block, TRY(ByteBuffer::copy(buffer)));
     return buffer;
 }
 
+void Heap::cache_block(u32 block, ByteBuffer buffer)
+{
+    if (m_block_cache.size() >= maximum_cached_blocks) {
+        // Evict the least recently used block. The cache is small enough that
+        // a linear scan beats maintaining an eviction list on every hit.
+        auto least_recently_used = m_block_cache.begin();
+        for (auto it = m_block_cache.begin(); it != m_block_cache.end(); ++it) {
+            if (it->value.last_used < least_recently_used->value.last_used)
+                least_recently_used = it;
+        }
+        m_block_cache.remove(least_recently_used);
+    }
+    m_block_cache.set(block, { m_block_cache_counter++, move(buffer) });
+}
+
 ErrorOr<void> Heap::write_block(u32 block, ByteBuffer& buffer)
 {
     if (!m_file) {
@@ -115,6 +136,8 @@ ErrorOr<void> Heap::write_block(u32 block, ByteBuffer& buffer)
     dbgln_if(SQL_DEBUG, "{:hex-dump}", buffer.bytes().trim(8));
     TRY(m_file->write(buffer));
 
+    cache_block(block, TRY(ByteBuffer::copy(buffer)));
+
     if (block == m_end_of_file)
         m_end_of_file++;
     return {};
@@ -164,12 +187,45 @@ ErrorOr<void> Heap::flush()
         blocks.append(wal_entry.key);
     }
     quick_sort(blocks);
-    for (auto& block : blocks) {
-        auto buffer_it = m_write_ahead_log.find(block);
-        VERIFY(buffer_it != m_write_ahead_log.end());
-        dbgln_if(SQL_DEBUG, "Flushing block {} to {}", block, name());
-        TRY(write_block(block, buffer_it->value));
+
+    // Since the blocks are sorted, consecutive dirty blocks form runs that can
+    // be written back with a single seek and write each.
+    for (size_t i = 0; i < blocks.size();) {
+        size_t run_length = 1;
+        while (i + run_length < blocks.size() && blocks[i + run_length] == blocks[i] + run_length)
+            ++run_length;
+
+        if (run_length == 1) {
+            auto buffer_it = m_write_ahead_log.find(blocks[i]);
+            VERIFY(buffer_it != m_write_ahead_log.end());
+            dbgln_if(SQL_DEBUG, "Flushing block {} to {}", blocks[i], name());
+            TRY(write_block(blocks[i], buffer_it->value));
+            ++i;
+            continue;
+        }
+
+        dbgln_if(SQL_DEBUG, "Flushing blocks {}..{} to {}", blocks[i], blocks[i] + run_length - 1, name());
+        auto run_buffer = TRY(ByteBuffer::create_zeroed(run_length * BLOCKSIZE));
+        for (size_t j = 0; j < run_length; ++j) {
+            auto block = blocks[i + j];
+            auto buffer_it = m_write_ahead_log.find(block);
+            VERIFY(buffer_it != m_write_ahead_log.end());
+            auto& buffer = buffer_it->value;
+            if (buffer.size() > BLOCKSIZE) {
+                warnln("Heap({})::flush(): Oversized block {} ({} > {})"sv, name(), block, buffer.size(), BLOCKSIZE);
+                return Error::from_string_literal("Heap()::flush(): Oversized block");
+            }
+            run_buffer.overwrite(j * BLOCKSIZE, buffer.data(), buffer.size());
+            cache_block(block, TRY(run_buffer.slice(j * BLOCKSIZE, BLOCKSIZE)));
+        }
+
+        TRY(seek_block(blocks[i]));
+        TRY(m_file->write(run_buffer));
+        if (auto past_the_end = blocks[i] + run_length; past_the_end > m_end_of_file)
+            m_end_of_file = past_the_end;
+        i += run_length;
     }
+
     m_write_ahead_log.clear();
     dbgln_if(SQL_DEBUG, "WAL flushed. Heap size = {}", size());
     return {};
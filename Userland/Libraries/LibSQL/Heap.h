@@ -96,6 +96,16 @@ private:
     ErrorOr<void> read_zero_block();
     void initialize_zero_block();
     void update_zero_block();
+    void cache_block(u32, ByteBuffer);
+
+    // Keep recently used blocks around so table scans and B-tree descents
+    // don't pay for a seek and read syscall per block; dirty blocks live in
+    // the write-ahead log, which is always consulted first.
+    constexpr static size_t maximum_cached_blocks = 512;
+    struct BlockCacheEntry {
+        u64 last_used { 0 };
+        ByteBuffer data;
+    };
 
     OwnPtr<Core::Stream::BufferedFile> m_file;
     u32 m_free_list { 0 };
@@ -107,6 +117,8 @@ private:
     u32 m_version { 0x00000001 };
     Array<u32, 16> m_user_values { 0 };
     HashMap<u32, ByteBuffer> m_write_ahead_log;
+    HashMap<u32, BlockCacheEntry> m_block_cache;
+    u64 m_block_cache_counter { 0 };
 };
 
 }
@@ -50,6 +50,31 @@ using AK::SIMD::u32x4;
 
 static constexpr int subpixel_factor = 1 << SUBPIXEL_BITS;
 
+// Matrix-vector products with the matrix columns broadcast into SIMD lanes:
+// transforming a vertex takes 4 multiplies and 3 adds instead of 16 and 12.
+// The columns are extracted once per draw call and reused for every vertex.
+struct SIMDMatrixColumns {
+    f32x4 columns[4];
+};
+
+static SIMDMatrixColumns simd_columns_for(FloatMatrix4x4 const& matrix)
+{
+    auto const* elements = matrix.elements();
+    SIMDMatrixColumns result;
+    for (int column = 0; column < 4; ++column)
+        result.columns[column] = f32x4 { elements[0][column], elements[1][column], elements[2][column], elements[3][column] };
+    return result;
+}
+
+ALWAYS_INLINE static FloatVector4 transform_vector(SIMDMatrixColumns const& matrix, FloatVector4 const& vector)
+{
+    auto const result = matrix.columns[0] * vector.x()
+        + matrix.columns[1] * vector.y()
+        + matrix.columns[2] * vector.z()
+        + matrix.columns[3] * vector.w();
+    return { result[0], result[1], result[2], result[3] };
+}
+
 // Returns positive values for counter-clockwise rotation of vertices. Note that it returns the
 // area of a parallelogram with sides {a, b} and {b, c}, so _double_ the area of the triangle {a, b, c}.
 constexpr static i32 edge_function(IntVector2 const& a, IntVector2 const& b, IntVector2 const& c)
@@ -674,7 +699,7 @@ void Device::rasterize_point(GPU::Vertex& point)
         rasterize_point_aliased(point);
 }
 
-void Device::rasterize_triangle(Triangle& triangle)
+void Device::rasterize_triangle(Triangle& triangle, Gfx::IntRect const& clip_window)
 {
     INCREASE_STATISTICS_COUNTER(g_num_rasterized_triangles, 1);
 
@@ -784,6 +809,10 @@ void Device::rasterize_triangle(Triangle& triangle)
         expand4(vertex2.window_coordinates.z() + depth_offset),
     };
 
+    // NOTE: this happens after the depth offset calculation, so tiled
+    // rasterization applies the exact same offset as a full-window pass.
+    render_bounds.intersect(clip_window);
+
     rasterize(
         render_bounds,
         [&](auto& quad) {
@@ -1031,9 +1060,17 @@ void Device::draw_primitives(GPU::PrimitiveType primitive_type, FloatMatrix4x4 c
     // See section 2.11.3 of the OpenGL 1.5 spec
     auto const normal_transform = model_view_transform.submatrix_from_topleft<3>().transpose().inverse();
 
+    auto const model_view_columns = simd_columns_for(model_view_transform);
+    auto const projection_columns = simd_columns_for(projection_transform);
+    Array<SIMDMatrixColumns, GPU::NUM_TEXTURE_UNITS> texture_transform_columns;
+    for (GPU::TextureUnitIndex i = 0; i < GPU::NUM_TEXTURE_UNITS; ++i) {
+        if (m_texture_unit_configuration[i].enabled)
+            texture_transform_columns[i] = simd_columns_for(m_texture_unit_configuration[i].transformation_matrix);
+    }
+
     // First, transform all vertices
     for (auto& vertex : vertices) {
-        vertex.eye_coordinates = model_view_transform * vertex.position;
+        vertex.eye_coordinates = transform_vector(model_view_columns, vertex.position);
 
         vertex.normal = normal_transform * vertex.normal;
         if (m_options.normalization_enabled)
@@ -1041,14 +1078,14 @@ void Device::draw_primitives(GPU::PrimitiveType primitive_type, FloatMatrix4x4 c
 
         calculate_vertex_lighting(vertex);
 
-        vertex.clip_coordinates = projection_transform * vertex.eye_coordinates;
+        vertex.clip_coordinates = transform_vector(projection_columns, vertex.eye_coordinates);
 
         for (GPU::TextureUnitIndex i = 0; i < GPU::NUM_TEXTURE_UNITS; ++i) {
             auto const& texture_unit_configuration = m_texture_unit_configuration[i];
             if (!texture_unit_configuration.enabled)
                 continue;
             generate_texture_coordinates(vertex, vertex.tex_coords[i], texture_unit_configuration);
-            vertex.tex_coords[i] = texture_unit_configuration.transformation_matrix * vertex.tex_coords[i];
+            vertex.tex_coords[i] = transform_vector(texture_transform_columns[i], vertex.tex_coords[i]);
         }
     }
 
@@ -1199,8 +1236,78 @@ void Device::draw_primitives(GPU::PrimitiveType primitive_type, FloatMatrix4x4 c
         }
     }
 
-    for (auto& triangle : m_processed_triangles)
-        rasterize_triangle(triangle);
+    rasterize_triangles();
+}
+
+void Device::rasterize_triangles()
+{
+    auto const window = m_frame_buffer->rect();
+
+    // Tiles never share pixels and each tile visits its triangles in
+    // submission order, so the parallel result is identical to the serial
+    // one. Small draws stay serial: binning and waking the workers only pays
+    // off once a draw call carries a real amount of geometry.
+    constexpr size_t parallel_triangle_threshold = 64;
+    if (m_processed_triangles.size() < parallel_triangle_threshold) {
+        for (auto& triangle : m_processed_triangles)
+            rasterize_triangle(triangle, window);
+        return;
+    }
+
+    constexpr int tile_size = 64;
+    auto const tile_columns = ceil_div(window.width(), tile_size);
+    auto const tile_rows = ceil_div(window.height(), tile_size);
+    auto const tile_count = static_cast<size_t>(tile_columns) * tile_rows;
+
+    if (m_triangle_bins.size() < tile_count)
+        m_triangle_bins.resize(tile_count);
+    for (auto& bin : m_triangle_bins)
+        bin.clear_with_capacity();
+
+    // Bucket every triangle into the tiles its bounding box overlaps.
+    for (size_t triangle_index = 0; triangle_index < m_processed_triangles.size(); ++triangle_index) {
+        auto const& triangle = m_processed_triangles[triangle_index];
+        auto const v0 = (triangle.vertices[0].window_coordinates.xy() * subpixel_factor).to_rounded<int>();
+        auto const v1 = (triangle.vertices[1].window_coordinates.xy() * subpixel_factor).to_rounded<int>();
+        auto const v2 = (triangle.vertices[2].window_coordinates.xy() * subpixel_factor).to_rounded<int>();
+
+        Gfx::IntRect triangle_bounds;
+        triangle_bounds.set_left(min(min(v0.x(), v1.x()), v2.x()) / subpixel_factor);
+        triangle_bounds.set_right(max(max(v0.x(), v1.x()), v2.x()) / subpixel_factor);
+        triangle_bounds.set_top(min(min(v0.y(), v1.y()), v2.y()) / subpixel_factor);
+        triangle_bounds.set_bottom(max(max(v0.y(), v1.y()), v2.y()) / subpixel_factor);
+        triangle_bounds.intersect(window);
+        if (triangle_bounds.is_empty())
+            continue;
+
+        for (int tile_y = triangle_bounds.top() / tile_size; tile_y <= triangle_bounds.bottom() / tile_size; ++tile_y) {
+            for (int tile_x = triangle_bounds.left() / tile_size; tile_x <= triangle_bounds.right() / tile_size; ++tile_x)
+                m_triangle_bins[tile_y * tile_columns + tile_x].append(triangle_index);
+        }
+    }
+
+    if (!m_rasterizer_thread_pool)
+        m_rasterizer_thread_pool = make<Threading::ThreadPool>();
+
+    m_rasterizer_thread_pool->parallel_for(0, tile_count, 1, [&](size_t tile_begin, size_t tile_end) {
+        for (size_t tile_index = tile_begin; tile_index < tile_end; ++tile_index) {
+            auto const& bin = m_triangle_bins[tile_index];
+            if (bin.is_empty())
+                continue;
+            auto const tile_rect = Gfx::IntRect {
+                static_cast<int>(tile_index % tile_columns) * tile_size,
+                static_cast<int>(tile_index / tile_columns) * tile_size,
+                tile_size,
+                tile_size,
+            };
+            for (auto triangle_index : bin) {
+                // Rasterization reorients vertices in place, so tiles sharing
+                // a triangle each work on their own copy.
+                auto triangle = m_processed_triangles[triangle_index];
+                rasterize_triangle(triangle, tile_rect);
+            }
+        }
+    });
 }
 
 ALWAYS_INLINE void Device::shade_fragments(PixelQuad& quad)
@@ -1459,13 +1566,7 @@ void Device::blit_from_color_buffer(NonnullRefPtr<GPU::Image> image, u32 level,
     auto const* input_data = m_frame_buffer->color_buffer()->scanline(0);
 
     auto const& softgpu_image = reinterpret_cast<Image*>(image.ptr());
-    auto output_layout = softgpu_image->image_data_layout(level, output_offset);
-    auto* output_data = softgpu_image->texel_pointer(level, 0, 0, 0);
-
-    PixelConverter converter { input_layout, output_layout };
-    auto conversion_result = converter.convert(input_data, output_data, {});
-    if (conversion_result.is_error())
-        dbgln("Pixel conversion failed: {}", conversion_result.error().string_literal());
+    softgpu_image->write_texels(level, output_offset, input_data, input_layout);
 }
 
 void Device::blit_from_color_buffer(void* output_data, Vector2<i32> input_offset, GPU::ImageDataLayout const& output_layout)
@@ -1498,13 +1599,7 @@ void Device::blit_from_depth_buffer(NonnullRefPtr<GPU::Image> image, u32 level,
     auto const* input_data = m_frame_buffer->depth_buffer()->scanline(0);
 
     auto const& softgpu_image = reinterpret_cast<Image*>(image.ptr());
-    auto output_layout = softgpu_image->image_data_layout(level, output_offset);
-    auto* output_data = softgpu_image->texel_pointer(level, 0, 0, 0);
-
-    PixelConverter converter { input_layout, output_layout };
-    auto conversion_result = converter.convert(input_data, output_data, {});
-    if (conversion_result.is_error())
-        dbgln("Pixel conversion failed: {}", conversion_result.error().string_literal());
+    softgpu_image->write_texels(level, output_offset, input_data, input_layout);
 }
 
 void Device::blit_to_color_buffer_at_raster_position(void const* input_data, GPU::ImageDataLayout const& input_layout)
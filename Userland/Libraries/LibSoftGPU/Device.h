@@ -9,6 +9,7 @@
 
 #include <AK/Array.h>
 #include <AK/NonnullRefPtr.h>
+#include <AK/OwnPtr.h>
 #include <AK/RefPtr.h>
 #include <AK/Vector.h>
 #include <LibGPU/Device.h>
@@ -36,6 +37,7 @@
 #include <LibSoftGPU/Config.h>
 #include <LibSoftGPU/Sampler.h>
 #include <LibSoftGPU/Triangle.h>
+#include <LibThreading/ThreadPool.h>
 
 namespace SoftGPU {
 
@@ -96,7 +98,8 @@ private:
     void rasterize_point_antialiased(GPU::Vertex&);
     void rasterize_point(GPU::Vertex&);
 
-    void rasterize_triangle(Triangle&);
+    void rasterize_triangle(Triangle&, Gfx::IntRect const& clip_window);
+    void rasterize_triangles();
     void setup_blend_factors();
     void shade_fragments(PixelQuad&);
 
@@ -106,6 +109,8 @@ private:
     Clipper m_clipper;
     Vector<Triangle> m_triangle_list;
     Vector<Triangle> m_processed_triangles;
+    Vector<Vector<size_t>> m_triangle_bins;
+    OwnPtr<Threading::ThreadPool> m_rasterizer_thread_pool;
     Vector<GPU::Vertex> m_clipped_vertices;
     Array<Sampler, GPU::NUM_TEXTURE_UNITS> m_samplers;
     AlphaBlendFactors m_alpha_blend_factors;
@@ -16,7 +16,7 @@ namespace SoftGPU {
 Image::Image(void const* ownership_token, GPU::PixelFormat const& pixel_format, u32 width, u32 height, u32 depth, u32 max_levels)
     : GPU::Image(ownership_token)
     , m_pixel_format(pixel_format)
-    , m_mipmap_buffers(FixedArray<RefPtr<Typed3DBuffer<FloatVector4>>>::must_create_but_fixme_should_propagate_errors(max_levels))
+    , m_mipmaps(FixedArray<Mipmap>::must_create_but_fixme_should_propagate_errors(max_levels))
 {
     VERIFY(pixel_format == GPU::PixelFormat::Alpha
         || pixel_format == GPU::PixelFormat::Intensity
@@ -35,7 +35,16 @@ Image::Image(void const* ownership_token, GPU::PixelFormat const& pixel_format,
 
     u32 level;
     for (level = 0; level < max_levels; ++level) {
-        m_mipmap_buffers[level] = MUST(Typed3DBuffer<FloatVector4>::try_create(width, height, depth));
+        auto& mipmap = m_mipmaps[level];
+        mipmap.width = width;
+        mipmap.height = height;
+        mipmap.depth = depth;
+        mipmap.horizontal_tiles = (width + tile_mask) >> tile_shift;
+        mipmap.vertical_tiles = (height + tile_mask) >> tile_shift;
+
+        auto texels = FixedArray<FloatVector4>::must_create_but_fixme_should_propagate_errors(
+            static_cast<size_t>(depth) * mipmap.horizontal_tiles * mipmap.vertical_tiles * tile_size * tile_size);
+        mipmap.texels.swap(texels);
 
         if (width <= 1 && height <= 1 && depth <= 1)
             break;
@@ -48,6 +57,35 @@ Image::Image(void const* ownership_token, GPU::PixelFormat const& pixel_format,
     m_number_of_levels = level + 1;
 }
 
+FixedArray<FloatVector4> Image::linearized_texels(u32 level) const
+{
+    auto const& mipmap = m_mipmaps[level];
+    auto texels = FixedArray<FloatVector4>::must_create_but_fixme_should_propagate_errors(
+        static_cast<size_t>(mipmap.width) * mipmap.height * mipmap.depth);
+
+    size_t linear_index = 0;
+    for (u32 z = 0; z < mipmap.depth; ++z) {
+        for (u32 y = 0; y < mipmap.height; ++y) {
+            for (u32 x = 0; x < mipmap.width; ++x)
+                texels[linear_index++] = texel(level, x, y, z);
+        }
+    }
+    return texels;
+}
+
+void Image::write_linearized_texels(u32 level, FixedArray<FloatVector4> const& texels)
+{
+    auto const& mipmap = m_mipmaps[level];
+
+    size_t linear_index = 0;
+    for (u32 z = 0; z < mipmap.depth; ++z) {
+        for (u32 y = 0; y < mipmap.height; ++y) {
+            for (u32 x = 0; x < mipmap.width; ++x)
+                set_texel(level, x, y, z, texels[linear_index++]);
+        }
+    }
+}
+
 GPU::ImageDataLayout Image::image_data_layout(u32 level, Vector3<i32> offset) const
 {
     auto const width = width_at_level(level);
@@ -81,8 +119,10 @@ void Image::write_texels(u32 level, Vector3<i32> const& output_offset, void cons
 {
     VERIFY(level < number_of_levels());
 
+    // PixelConverter expects a linearly laid out destination, so convert into
+    // a linear copy of this level's texels and retile the result afterwards.
     auto output_layout = image_data_layout(level, output_offset);
-    auto texel_data = texel_pointer(level, 0, 0, 0);
+    auto staging_texels = linearized_texels(level);
 
     PixelConverter converter { input_layout, output_layout };
     ErrorOr<void> conversion_result;
@@ -90,13 +130,17 @@ void Image::write_texels(u32 level, Vector3<i32> const& output_offset, void cons
     case GPU::PixelFormat::Luminance:
     case GPU::PixelFormat::RGB:
         // Both Luminance and RGB set the alpha to 1, regardless of the source texel
-        conversion_result = converter.convert(input_data, texel_data, [](auto& components) { components[3] = 1.f; });
+        conversion_result = converter.convert(input_data, staging_texels.data(), [](auto& components) { components[3] = 1.f; });
         break;
     default:
-        conversion_result = converter.convert(input_data, texel_data, {});
+        conversion_result = converter.convert(input_data, staging_texels.data(), {});
     }
-    if (conversion_result.is_error())
+    if (conversion_result.is_error()) {
         dbgln("Pixel conversion failed: {}", conversion_result.error().string_literal());
+        return;
+    }
+
+    write_linearized_texels(level, staging_texels);
 }
 
 void Image::read_texels(u32 level, Vector3<i32> const& input_offset, void* output_data, GPU::ImageDataLayout const& output_layout) const
@@ -104,9 +148,10 @@ void Image::read_texels(u32 level, Vector3<i32> const& input_offset, void* outpu
     VERIFY(level < number_of_levels());
 
     auto input_layout = image_data_layout(level, input_offset);
+    auto staging_texels = linearized_texels(level);
 
     PixelConverter converter { input_layout, output_layout };
-    auto conversion_result = converter.convert(texel_pointer(level, 0, 0, 0), output_data, {});
+    auto conversion_result = converter.convert(staging_texels.data(), output_data, {});
     if (conversion_result.is_error())
         dbgln("Pixel conversion failed: {}", conversion_result.error().string_literal());
 }
@@ -172,13 +217,13 @@ void Image::regenerate_mipmaps()
         auto bitmap = empty_bitmap_for_level(level);
 
         auto input_layout = image_data_layout(level, { 0, 0, 0 });
-        auto const* input_data = texel_pointer(level, 0, 0, 0);
+        auto staging_texels = linearized_texels(level);
 
         auto output_layout = image_data_layout_for_bitmap(bitmap);
         auto* output_data = bitmap->scanline(0);
 
         PixelConverter converter { input_layout, output_layout };
-        MUST(converter.convert(input_data, output_data, {}));
+        MUST(converter.convert(staging_texels.data(), output_data, {}));
         return bitmap;
     };
     auto copy_bitmap_into_level = [&](NonnullRefPtr<Gfx::Bitmap> bitmap, u32 level) {
@@ -188,10 +233,12 @@ void Image::regenerate_mipmaps()
         auto const* input_data = bitmap->scanline(0);
 
         auto output_layout = image_data_layout(level, { 0, 0, 0 });
-        auto* output_data = texel_pointer(level, 0, 0, 0);
+        auto staging_texels = linearized_texels(level);
 
         PixelConverter converter { input_layout, output_layout };
-        MUST(converter.convert(input_data, output_data, {}));
+        MUST(converter.convert(input_data, staging_texels.data(), {}));
+
+        write_linearized_texels(level, staging_texels);
     };
 
     // For levels 1..number_of_levels-1, we generate downscaled versions of the level above
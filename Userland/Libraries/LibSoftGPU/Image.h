@@ -8,13 +8,11 @@
 #pragma once
 
 #include <AK/FixedArray.h>
-#include <AK/RefPtr.h>
 #include <LibGPU/Image.h>
 #include <LibGPU/ImageDataLayout.h>
 #include <LibGPU/ImageFormat.h>
 #include <LibGfx/Vector3.h>
 #include <LibGfx/Vector4.h>
-#include <LibSoftGPU/Buffer/Typed3DBuffer.h>
 
 namespace SoftGPU {
 
@@ -22,9 +20,9 @@ class Image final : public GPU::Image {
 public:
     Image(void const* ownership_token, GPU::PixelFormat const&, u32 width, u32 height, u32 depth, u32 max_levels);
 
-    virtual u32 width_at_level(u32 level) const override { return m_mipmap_buffers[level]->width(); }
-    virtual u32 height_at_level(u32 level) const override { return m_mipmap_buffers[level]->height(); }
-    virtual u32 depth_at_level(u32 level) const override { return m_mipmap_buffers[level]->depth(); }
+    virtual u32 width_at_level(u32 level) const override { return m_mipmaps[level].width; }
+    virtual u32 height_at_level(u32 level) const override { return m_mipmaps[level].height; }
+    virtual u32 depth_at_level(u32 level) const override { return m_mipmaps[level].depth; }
     virtual u32 number_of_levels() const override { return m_number_of_levels; }
     bool width_is_power_of_two() const { return m_width_is_power_of_two; }
     bool height_is_power_of_two() const { return m_height_is_power_of_two; }
@@ -49,19 +47,64 @@ public:
 
     FloatVector4 const* texel_pointer(u32 level, int x, int y, int z) const
     {
-        return m_mipmap_buffers[level]->buffer_pointer(x, y, z);
+        return &m_mipmaps[level].texels[texel_index(level, x, y, z)];
     }
 
     FloatVector4* texel_pointer(u32 level, int x, int y, int z)
     {
-        return m_mipmap_buffers[level]->buffer_pointer(x, y, z);
+        return &m_mipmaps[level].texels[texel_index(level, x, y, z)];
+    }
+
+    // Collects pointers to the four texels of a 2x2 bilinear footprint. When
+    // the footprint falls within a single tile, this reads one contiguous run
+    // of texels instead of two widely separated rows.
+    void texel_block_2x2(u32 level, int x0, int x1, int y0, int y1, FloatVector4 const* texels[4]) const
+    {
+        if (x1 == x0 + 1 && y1 == y0 + 1 && (x0 & tile_mask) != tile_mask && (y0 & tile_mask) != tile_mask) {
+            auto const* top_left = texel_pointer(level, x0, y0, 0);
+            texels[0] = top_left;
+            texels[1] = top_left + 1;
+            texels[2] = top_left + tile_size;
+            texels[3] = top_left + tile_size + 1;
+            return;
+        }
+        texels[0] = texel_pointer(level, x0, y0, 0);
+        texels[1] = texel_pointer(level, x1, y0, 0);
+        texels[2] = texel_pointer(level, x0, y1, 0);
+        texels[3] = texel_pointer(level, x1, y1, 0);
     }
 
 private:
+    // Texels are stored in 4x4 tiles so a bilinear footprint usually hits a
+    // single 256-byte tile, instead of thrashing the cache with widely
+    // separated rows on minified lookups.
+    static constexpr int tile_shift = 2;
+    static constexpr int tile_size = 1 << tile_shift;
+    static constexpr int tile_mask = tile_size - 1;
+
+    struct Mipmap {
+        u32 width { 0 };
+        u32 height { 0 };
+        u32 depth { 0 };
+        u32 horizontal_tiles { 0 };
+        u32 vertical_tiles { 0 };
+        FixedArray<FloatVector4> texels;
+    };
+
+    ALWAYS_INLINE size_t texel_index(u32 level, int x, int y, int z) const
+    {
+        auto const& mipmap = m_mipmaps[level];
+        size_t const tile_index = (z * mipmap.vertical_tiles + (y >> tile_shift)) * mipmap.horizontal_tiles + (x >> tile_shift);
+        return (tile_index << (2 * tile_shift)) + ((y & tile_mask) << tile_shift) + (x & tile_mask);
+    }
+
+    FixedArray<FloatVector4> linearized_texels(u32 level) const;
+    void write_linearized_texels(u32 level, FixedArray<FloatVector4> const& texels);
+
     u32 m_number_of_levels { 0 };
 
     GPU::PixelFormat m_pixel_format;
-    FixedArray<RefPtr<Typed3DBuffer<FloatVector4>>> m_mipmap_buffers;
+    FixedArray<Mipmap> m_mipmaps;
 
     bool m_width_is_power_of_two { false };
     bool m_height_is_power_of_two { false };
@@ -86,6 +86,26 @@ ALWAYS_INLINE static Vector4<f32x4> texel4(Image const& image, u32x4 level, u32x
     };
 }
 
+ALWAYS_INLINE static void texel4_block_2x2(Image const& image, u32x4 level, u32x4 x0, u32x4 x1, u32x4 y0, u32x4 y1, Vector4<f32x4>& t0, Vector4<f32x4>& t1, Vector4<f32x4>& t2, Vector4<f32x4>& t3)
+{
+    FloatVector4 const* texels[4][4];
+    for (auto lane = 0; lane < 4; ++lane)
+        image.texel_block_2x2(level[lane], x0[lane], x1[lane], y0[lane], y1[lane], texels[lane]);
+
+    auto transposed = [&texels](int corner) {
+        return Vector4<f32x4> {
+            f32x4 { texels[0][corner]->x(), texels[1][corner]->x(), texels[2][corner]->x(), texels[3][corner]->x() },
+            f32x4 { texels[0][corner]->y(), texels[1][corner]->y(), texels[2][corner]->y(), texels[3][corner]->y() },
+            f32x4 { texels[0][corner]->z(), texels[1][corner]->z(), texels[2][corner]->z(), texels[3][corner]->z() },
+            f32x4 { texels[0][corner]->w(), texels[1][corner]->w(), texels[2][corner]->w(), texels[3][corner]->w() },
+        };
+    };
+    t0 = transposed(0);
+    t1 = transposed(1);
+    t2 = transposed(2);
+    t3 = transposed(3);
+}
+
 ALWAYS_INLINE static Vector4<f32x4> texel4border(Image const& image, u32x4 level, u32x4 x, u32x4 y, FloatVector4 const& border, u32x4 w, u32x4 h)
 {
     auto border_mask = maskbits(x < 0 || x >= w || y < 0 || y >= h);
@@ -221,10 +241,7 @@ Vector4<AK::SIMD::f32x4> Sampler::sample_2d_lod(Vector2<AK::SIMD::f32x4> const&
     Vector4<f32x4> t0, t1, t2, t3;
 
     if (m_config.texture_wrap_u == GPU::TextureWrapMode::Repeat && m_config.texture_wrap_v == GPU::TextureWrapMode::Repeat) {
-        t0 = texel4(image, level, i0, j0);
-        t1 = texel4(image, level, i1, j0);
-        t2 = texel4(image, level, i0, j1);
-        t3 = texel4(image, level, i1, j1);
+        texel4_block_2x2(image, level, i0, i1, j0, j1, t0, t1, t2, t3);
     } else {
         t0 = texel4border(image, level, i0, j0, m_config.border_color, width, height);
         t1 = texel4border(image, level, i1, j0, m_config.border_color, width, height);
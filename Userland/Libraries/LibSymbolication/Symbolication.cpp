@@ -6,12 +6,17 @@
 
 #include <AK/Array.h>
 #include <AK/Checked.h>
+#include <AK/Demangle.h>
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/JsonValue.h>
 #include <AK/LexicalPath.h>
+#include <AK/QuickSort.h>
+#include <AK/StringBuilder.h>
 #include <LibCore/File.h>
 #include <LibCore/MappedFile.h>
+#include <LibCore/Stream.h>
+#include <LibCore/System.h>
 #include <LibDebug/DebugInfo.h>
 #include <LibSymbolication/Symbolication.h>
 
@@ -25,6 +30,183 @@ struct CachedELF {
 
 static HashMap<DeprecatedString, OwnPtr<CachedELF>> s_cache;
 
+// When no source positions are needed, lookups are answered from a per-binary
+// index of (address, demangled name) pairs that is persisted to /tmp, so
+// repeated symbolication of the same binary doesn't have to map the ELF image
+// and walk its symbol table again in every process.
+static constexpr auto symbol_index_directory = "/tmp/symbol-cache"sv;
+static constexpr u32 symbol_index_magic = 0x53594d31; // "SYM1"
+static constexpr u32 symbol_index_version = 1;
+
+struct [[gnu::packed]] SymbolIndexHeader {
+    u32 magic;
+    u32 version;
+    u64 inode;
+    u64 mtime;
+    u32 symbol_count;
+    u32 string_table_size;
+};
+
+struct [[gnu::packed]] SymbolIndexEntry {
+    u64 address;
+    u32 name_offset;
+    u32 name_length;
+};
+
+struct SymbolIndex {
+    Vector<SymbolIndexEntry> entries; // Sorted by address.
+    DeprecatedString string_table;
+
+    Optional<Symbol> lookup(FlatPtr address, DeprecatedString const& object_path) const
+    {
+        // Find the greatest entry with an address at or below the query,
+        // the same way ELF::Image::symbolicate() does.
+        SymbolIndexEntry const* best = nullptr;
+        size_t low = 0;
+        size_t high = entries.size();
+        while (low < high) {
+            size_t mid = low + (high - low) / 2;
+            if (entries[mid].address <= address) {
+                best = &entries[mid];
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        if (!best)
+            return {};
+        return Symbol {
+            .address = address,
+            .name = string_table.substring(best->name_offset, best->name_length),
+            .object = LexicalPath::basename(object_path),
+            .offset = static_cast<u32>(address - best->address),
+            .source_positions = {},
+        };
+    }
+};
+
+static HashMap<DeprecatedString, OwnPtr<SymbolIndex>> s_index_cache;
+
+static DeprecatedString symbol_index_path_for(DeprecatedString const& path)
+{
+    return DeprecatedString::formatted("{}/{}", symbol_index_directory, path.replace("/"sv, "%"sv, ReplaceMode::All));
+}
+
+static OwnPtr<SymbolIndex> load_symbol_index(DeprecatedString const& index_path, struct stat const& st)
+{
+    auto mapped_file = Core::MappedFile::map(index_path);
+    if (mapped_file.is_error())
+        return {};
+    auto bytes = mapped_file.value()->bytes();
+    if (bytes.size() < sizeof(SymbolIndexHeader))
+        return {};
+    SymbolIndexHeader header {};
+    memcpy(&header, bytes.data(), sizeof(header));
+    if (header.magic != symbol_index_magic || header.version != symbol_index_version)
+        return {};
+    if (header.inode != static_cast<u64>(st.st_ino) || header.mtime != static_cast<u64>(st.st_mtime))
+        return {};
+    Checked<size_t> expected_size = static_cast<size_t>(header.symbol_count);
+    expected_size *= sizeof(SymbolIndexEntry);
+    expected_size += sizeof(SymbolIndexHeader);
+    expected_size += header.string_table_size;
+    if (expected_size.has_overflow() || bytes.size() != expected_size.value())
+        return {};
+
+    auto index = make<SymbolIndex>();
+    index->entries.resize(header.symbol_count);
+    memcpy(index->entries.data(), bytes.offset(sizeof(SymbolIndexHeader)), header.symbol_count * sizeof(SymbolIndexEntry));
+    index->string_table = DeprecatedString { bytes.slice(sizeof(SymbolIndexHeader) + header.symbol_count * sizeof(SymbolIndexEntry)) };
+    for (auto const& entry : index->entries) {
+        Checked<size_t> name_end = static_cast<size_t>(entry.name_offset);
+        name_end += entry.name_length;
+        if (name_end.has_overflow() || name_end.value() > index->string_table.length())
+            return {};
+    }
+    return index;
+}
+
+static void store_symbol_index(SymbolIndex const& index, DeprecatedString const& index_path, struct stat const& st)
+{
+    // Failing to persist the index is not an error; the next process will
+    // simply rebuild it. Written via a temporary file and rename so a
+    // concurrent reader never sees a partial index.
+    if (auto result = Core::System::mkdir(symbol_index_directory, 0755); result.is_error() && result.error().code() != EEXIST)
+        return;
+
+    SymbolIndexHeader header {
+        .magic = symbol_index_magic,
+        .version = symbol_index_version,
+        .inode = static_cast<u64>(st.st_ino),
+        .mtime = static_cast<u64>(st.st_mtime),
+        .symbol_count = static_cast<u32>(index.entries.size()),
+        .string_table_size = static_cast<u32>(index.string_table.length()),
+    };
+
+    auto temporary_path = DeprecatedString::formatted("{}.{}.tmp", index_path, getpid());
+    auto file_or_error = Core::Stream::File::open(temporary_path, Core::Stream::OpenMode::Write);
+    if (file_or_error.is_error())
+        return;
+    auto file = file_or_error.release_value();
+    auto write_result = [&]() -> ErrorOr<void> {
+        TRY(file->write_entire_buffer({ &header, sizeof(header) }));
+        TRY(file->write_entire_buffer({ index.entries.data(), index.entries.size() * sizeof(SymbolIndexEntry) }));
+        TRY(file->write_entire_buffer(index.string_table.bytes()));
+        return {};
+    }();
+    if (write_result.is_error() || Core::System::rename(temporary_path, index_path).is_error())
+        (void)Core::System::unlink(temporary_path);
+}
+
+static OwnPtr<SymbolIndex> build_symbol_index(DeprecatedString const& path)
+{
+    auto mapped_file = Core::MappedFile::map(path);
+    if (mapped_file.is_error())
+        return {};
+    ELF::Image elf(mapped_file.value()->bytes());
+    if (!elf.is_valid())
+        return {};
+
+    auto index = make<SymbolIndex>();
+    StringBuilder string_table;
+    index->entries.ensure_capacity(elf.symbol_count());
+    elf.for_each_symbol([&](auto const& symbol) {
+        auto demangled = demangle(symbol.name());
+        index->entries.append({ symbol.value(), static_cast<u32>(string_table.length()), static_cast<u32>(demangled.length()) });
+        string_table.append(demangled);
+        return IterationDecision::Continue;
+    });
+    quick_sort(index->entries, [](auto& a, auto& b) {
+        return a.address < b.address;
+    });
+    index->string_table = string_table.to_deprecated_string();
+    return index;
+}
+
+static SymbolIndex const* symbol_index_for(DeprecatedString const& path)
+{
+    if (auto it = s_index_cache.find(path); it != s_index_cache.end())
+        return it->value.ptr();
+
+    auto st_or_error = Core::System::stat(path);
+    if (st_or_error.is_error()) {
+        s_index_cache.set(path, {});
+        return nullptr;
+    }
+    auto st = st_or_error.release_value();
+
+    auto index_path = symbol_index_path_for(path);
+    auto index = load_symbol_index(index_path, st);
+    if (!index) {
+        index = build_symbol_index(path);
+        if (index)
+            store_symbol_index(*index, index_path, st);
+    }
+    auto* index_ptr = index.ptr();
+    s_index_cache.set(path, move(index));
+    return index_ptr;
+}
+
 enum class KernelBaseState {
     Uninitialized,
     Valid,
@@ -82,6 +264,22 @@ Optional<Symbol> symbolicate(DeprecatedString const& path, FlatPtr address, Incl
             return {};
         }
     }
+    if (include_source_positions == IncludeSourcePosition::No) {
+        if (auto const* index = symbol_index_for(full_path)) {
+            if (auto symbol = index->lookup(address, path); symbol.has_value())
+                return symbol;
+            // Match what the ELF fallback reports when there is no symbol at
+            // or below the address.
+            return Symbol {
+                .address = address,
+                .name = "??",
+                .object = LexicalPath::basename(path),
+                .offset = 0,
+                .source_positions = {},
+            };
+        }
+    }
+
     if (!s_cache.contains(full_path)) {
         auto mapped_file = Core::MappedFile::map(full_path);
         if (mapped_file.is_error()) {
@@ -10,5 +10,6 @@ namespace Syntax {
 
 class Highlighter;
 class HighlighterClient;
+struct BackgroundHighlightResult;
 
 }
@@ -138,6 +138,15 @@ void Highlighter::register_nested_token_pairs(Vector<MatchingTokenPair> pairs)
         m_nested_token_pairs.set(pair);
 }
 
+Vector<Highlighter::MatchingTokenPair> Highlighter::nested_token_pairs() const
+{
+    Vector<MatchingTokenPair> pairs;
+    pairs.ensure_capacity(m_nested_token_pairs.size());
+    for (auto& pair : m_nested_token_pairs)
+        pairs.append(pair);
+    return pairs;
+}
+
 StringView Highlighter::language_string(Language language) const
 {
     switch (language) {
@@ -46,6 +46,12 @@ public:
     virtual void rehighlight(Palette const&) = 0;
     virtual void highlight_matching_token_pair();
 
+    // A stateless highlighter can return a fresh instance of itself here, which
+    // lets clients run the (potentially slow) rehighlight on a background thread
+    // against a snapshot of the text. Highlighters that carry state between
+    // calls return nullptr and keep highlighting synchronously.
+    virtual OwnPtr<Highlighter> clone() const { return {}; }
+
     virtual bool is_identifier(u64) const { return false; };
     virtual bool is_navigatable(u64) const { return false; };
 
@@ -59,6 +65,11 @@ public:
     };
     Vector<MatchingTokenPair> matching_token_pairs() const;
 
+    // These exist so the token pairs a clone() discovers during a background
+    // rehighlight can be handed back to the highlighter that stayed attached.
+    Vector<MatchingTokenPair> nested_token_pairs() const;
+    void register_nested_token_pairs(Vector<MatchingTokenPair>);
+
     template<typename T>
     bool fast_is() const = delete;
 
@@ -73,7 +84,6 @@ protected:
 
     virtual Vector<MatchingTokenPair> matching_token_pairs_impl() const = 0;
     virtual bool token_types_equal(u64, u64) const = 0;
-    void register_nested_token_pairs(Vector<MatchingTokenPair>);
     void clear_nested_token_pairs() { m_nested_token_pairs.clear(); }
     size_t first_free_token_kind_serial_value() const { return m_nested_token_pairs.size(); }
 
@@ -143,6 +153,52 @@ private:
     u64 m_nested_kind_start_value { 0 };
 };
 
+// Collects the spans a Highlighter produces for an immutable snapshot of a
+// document's text, so the highlighting can happen off the GUI thread. The
+// live document is never touched; if the highlighter asks for one, a private
+// document is created from the snapshot.
+class SnapshotHighlighterClient final : public Syntax::HighlighterClient {
+public:
+    explicit SnapshotHighlighterClient(DeprecatedString text)
+        : m_text(move(text))
+    {
+    }
+
+    Vector<GUI::TextDocumentSpan> take_spans() { return move(m_spans); }
+
+private:
+    virtual Vector<GUI::TextDocumentSpan>& spans() override { return m_spans; }
+    virtual Vector<GUI::TextDocumentSpan> const& spans() const override { return m_spans; }
+    virtual void set_span_at_index(size_t index, GUI::TextDocumentSpan span) override { m_spans.at(index) = move(span); }
+
+    virtual DeprecatedString highlighter_did_request_text() const override { return m_text; }
+    virtual void highlighter_did_request_update() override { }
+
+    // Defined inline so LibSyntax itself never references the out-of-line
+    // parts of GUI::TextDocument; only the code constructing a snapshot
+    // client (which lives in LibGUI) pulls them in.
+    virtual GUI::TextDocument& highlighter_did_request_document() override
+    {
+        if (!m_document) {
+            m_document = GUI::TextDocument::create(nullptr);
+            m_document->set_text(m_text);
+        }
+        return *m_document;
+    }
+
+    virtual GUI::TextPosition highlighter_did_request_cursor() const override { return {}; }
+    virtual void highlighter_did_set_spans(Vector<GUI::TextDocumentSpan> spans) override { m_spans = move(spans); }
+
+    DeprecatedString m_text;
+    Vector<GUI::TextDocumentSpan> m_spans;
+    RefPtr<GUI::TextDocument> m_document;
+};
+
+struct BackgroundHighlightResult {
+    Vector<GUI::TextDocumentSpan> spans;
+    Vector<Highlighter::MatchingTokenPair> nested_token_pairs;
+};
+
 }
 
 template<>
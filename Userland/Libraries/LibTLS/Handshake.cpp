@@ -20,6 +20,9 @@ ByteBuffer TLSv12::build_hello()
 {
     fill_with_random(&m_context.local_random, 32);
 
+    // If we have a recent session with this host, offer to resume it.
+    offer_cached_session_for_resumption();
+
     auto packet_version = (u16)m_context.options.version;
     auto version = (u16)m_context.options.version;
     PacketBuilder builder { MessageType::Handshake, packet_version };
@@ -79,6 +82,9 @@ ByteBuffer TLSv12::build_hello()
     // signature_algorithms: 2b extension ID, 2b extension length, 2b vector length, 2xN signatures and hashes
     extension_length += 2 + 2 + 2 + 2 * m_context.options.supported_signature_algorithms.size();
 
+    // extended_master_secret: 2b extension ID, 2b (zero) extension length
+    extension_length += 2 + 2;
+
     if (sni_length)
         extension_length += sni_length + 9;
 
@@ -114,6 +120,10 @@ ByteBuffer TLSv12::build_hello()
         builder.append((u8)entry.signature);
     }
 
+    // extended_master_secret extension (RFC 7627)
+    builder.append((u16)HandshakeExtension::ExtendedMasterSecret);
+    builder.append((u16)0);
+
     if (supports_elliptic_curves) {
         // elliptic_curves extension
         builder.append((u16)HandshakeExtension::EllipticCurves);
@@ -196,7 +206,12 @@ ssize_t TLSv12::handle_handshake_finished(ReadonlyBytes buffer, WritePacketStage
         return (i8)Error::UnexpectedMessage;
     }
 
-    write_packets = WritePacketStage::Initial;
+    // In an abbreviated (resumed) handshake the server finishes first, and we
+    // still owe it our ChangeCipherSpec and Finished messages.
+    if (m_context.is_resuming_session)
+        write_packets = WritePacketStage::Finished;
+    else
+        write_packets = WritePacketStage::Initial;
 
     if (buffer.size() < 3) {
         return (i8)Error::NeedMoreData;
@@ -220,6 +235,8 @@ ssize_t TLSv12::handle_handshake_finished(ReadonlyBytes buffer, WritePacketStage
     dbgln_if(TLS_DEBUG, "FIXME: handle_handshake_finished :: Check message validity");
     m_context.connection_status = ConnectionStatus::Established;
 
+    cache_established_session();
+
     if (m_handshake_timeout_timer) {
         // Disable the handshake timeout timer as handshake has been established.
         m_handshake_timeout_timer->stop();
@@ -126,12 +126,29 @@ bool TLSv12::compute_master_secret_from_pre_master_secret(size_t length)
         return false;
     }
 
-    pseudorandom_function(
-        m_context.master_key,
-        m_context.premaster_key,
-        (u8 const*)"master secret", 13,
-        ReadonlyBytes { m_context.local_random, sizeof(m_context.local_random) },
-        ReadonlyBytes { m_context.remote_random, sizeof(m_context.remote_random) });
+    if (m_context.extensions.extended_master_secret) {
+        // RFC 7627 section 4: master_secret = PRF(pre_master_secret, "extended master secret", session_hash)
+        // The session hash covers the handshake up to and including the
+        // ClientKeyExchange message, which our caller has already added to the
+        // running handshake hash; peek() leaves that hash undisturbed for the
+        // later Finished message.
+        ByteBuffer dummy;
+        auto digest = m_context.handshake_hash.peek();
+        auto session_hash = ReadonlyBytes { digest.immutable_data(), m_context.handshake_hash.digest_size() };
+        pseudorandom_function(
+            m_context.master_key,
+            m_context.premaster_key,
+            (u8 const*)"extended master secret", 22,
+            session_hash,
+            dummy);
+    } else {
+        pseudorandom_function(
+            m_context.master_key,
+            m_context.premaster_key,
+            (u8 const*)"master secret", 13,
+            ReadonlyBytes { m_context.local_random, sizeof(m_context.local_random) },
+            ReadonlyBytes { m_context.remote_random, sizeof(m_context.remote_random) });
+    }
 
     m_context.premaster_key.clear();
     if constexpr (TLS_DEBUG) {
@@ -198,11 +215,6 @@ void TLSv12::build_rsa_pre_master_secret(PacketBuilder& builder)
         print_buffer(outbuf);
     }
 
-    if (!compute_master_secret_from_pre_master_secret(bytes)) {
-        dbgln("oh noes we could not derive a master key :(");
-        return;
-    }
-
     builder.append_u24(outbuf.size() + 2);
     builder.append((u16)outbuf.size());
     builder.append(outbuf);
@@ -245,11 +257,6 @@ void TLSv12::build_dhe_rsa_pre_master_secret(PacketBuilder& builder)
         dbgln("premaster key: {:hex-dump}", (ReadonlyBytes)m_context.premaster_key);
     }
 
-    if (!compute_master_secret_from_pre_master_secret(48)) {
-        dbgln("oh noes we could not derive a master key :(");
-        return;
-    }
-
     builder.append_u24(dh_key_size + 2);
     builder.append((u16)dh_key_size);
     builder.append(dh_Yc_bytes);
@@ -297,11 +304,6 @@ void TLSv12::build_ecdhe_rsa_pre_master_secret(PacketBuilder& builder)
         dbgln("premaster key:      {:hex-dump}", (ReadonlyBytes)m_context.premaster_key);
     }
 
-    if (!compute_master_secret_from_pre_master_secret(48)) {
-        dbgln("oh noes we could not derive a master key :(");
-        return;
-    }
-
     builder.append_u24(public_key.size() + 1);
     builder.append((u8)public_key.size());
     builder.append(public_key);
@@ -414,6 +416,14 @@ ByteBuffer TLSv12::build_client_key_exchange()
 
     update_packet(packet);
 
+    // This can only happen now: with the extended master secret extension the
+    // derivation covers the handshake hash up to and including the
+    // ClientKeyExchange message built above.
+    if (!compute_master_secret_from_pre_master_secret(48)) {
+        dbgln("oh noes we could not derive a master key :(");
+        return {};
+    }
+
     return packet;
 }
 
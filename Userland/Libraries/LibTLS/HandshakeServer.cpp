@@ -61,7 +61,11 @@ ssize_t TLSv12::handle_server_hello(ReadonlyBytes buffer, WritePacketStage& writ
         return (i8)Error::NeedMoreData;
     }
 
+    bool session_id_matches_offered = false;
     if (session_length && session_length <= 32) {
+        session_id_matches_offered = m_context.session_resumption_offered
+            && session_length == m_context.session_id_size
+            && memcmp(m_context.session_id, buffer.offset_pointer(res), session_length) == 0;
         memcpy(m_context.session_id, buffer.offset_pointer(res), session_length);
         m_context.session_id_size = session_length;
         if constexpr (TLS_DEBUG) {
@@ -99,6 +103,7 @@ ssize_t TLSv12::handle_server_hello(ReadonlyBytes buffer, WritePacketStage& writ
 
     if (m_context.connection_status != ConnectionStatus::Renegotiating)
         m_context.connection_status = ConnectionStatus::Negotiating;
+
     if (m_context.is_server) {
         dbgln("unsupported: server mode");
         write_packets = WritePacketStage::ServerHandshake;
@@ -177,6 +182,9 @@ ssize_t TLSv12::handle_server_hello(ReadonlyBytes buffer, WritePacketStage& writ
             print_buffer(buffer.slice(res, extension_length));
             res += extension_length;
             // FIXME: what are we supposed to do here?
+        } else if (extension_type == HandshakeExtension::ExtendedMasterSecret) {
+            m_context.extensions.extended_master_secret = true;
+            res += extension_length;
         } else if (extension_type == HandshakeExtension::ECPointFormats) {
             // RFC8422 section 5.2: A server that selects an ECC cipher suite in response to a ClientHello message
             // including a Supported Point Formats Extension appends this extension (along with others) to its
@@ -193,6 +201,13 @@ ssize_t TLSv12::handle_server_hello(ReadonlyBytes buffer, WritePacketStage& writ
         }
     }
 
+    // The server echoing the session ID we offered means this is an
+    // abbreviated handshake: keys are derived from the cached master secret
+    // and the fresh randoms, and the server will proceed directly to
+    // ChangeCipherSpec and Finished.
+    if (session_id_matches_offered && try_resume_session())
+        m_context.connection_status = ConnectionStatus::KeyExchange;
+
     return res;
 }
 
@@ -540,7 +540,10 @@ ssize_t TLSv12::handle_message(ReadonlyBytes buffer)
 
             if (code == (u8)AlertDescription::CloseNotify) {
                 res += 2;
-                alert(AlertLevel::Critical, AlertDescription::CloseNotify);
+                // RFC 5246 section 7.2.1: close_notify is a warning-level alert;
+                // sending it as fatal makes the peer invalidate the session,
+                // breaking later resumption.
+                alert(AlertLevel::Warning, AlertDescription::CloseNotify);
                 if (!m_context.cipher_spec_set) {
                     // AWS CloudFront hits this.
                     dbgln("Server sent a close notify and we haven't agreed on a cipher suite. Treating it as a handshake failure.");
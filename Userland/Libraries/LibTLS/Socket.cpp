@@ -248,6 +248,11 @@ bool TLSv12::check_connection_state(bool read)
     if (m_context.critical_error) {
         dbgln_if(TLS_DEBUG, "CRITICAL ERROR {} :(", m_context.critical_error);
 
+        // If we offered to resume a session and the handshake fell apart,
+        // don't offer that session again.
+        if (m_context.session_resumption_offered && m_context.connection_status != ConnectionStatus::Established)
+            evict_cached_session();
+
         m_context.has_invoked_finish_or_error_callback = true;
         if (on_tls_error)
             on_tls_error((AlertDescription)m_context.critical_error);
@@ -317,7 +322,9 @@ ErrorOr<bool> TLSv12::flush()
 
 void TLSv12::close()
 {
-    alert(AlertLevel::Critical, AlertDescription::CloseNotify);
+    // RFC 5246 section 7.2.1: close_notify is a warning-level alert; a fatal
+    // alert would make the peer invalidate the session we may want to resume.
+    alert(AlertLevel::Warning, AlertDescription::CloseNotify);
     // bye bye.
     m_context.connection_status = ConnectionStatus::Disconnected;
 }
@@ -24,6 +24,107 @@
 
 namespace TLS {
 
+// Sessions we established with a server are remembered here for a while, so
+// subsequent connections can offer session-ID resumption (RFC 5246 section
+// 7.3) and get away with an abbreviated handshake.
+struct CachedSession {
+    u8 session_id[32] {};
+    u8 session_id_size { 0 };
+    ByteBuffer master_key;
+    CipherSuite cipher { CipherSuite::Invalid };
+    bool extended_master_secret { false };
+    time_t established_at { 0 };
+};
+
+constexpr static time_t SessionCacheLifetimeSeconds = 60 * 60;
+constexpr static size_t MaxCachedSessions = 64;
+static HashMap<DeprecatedString, CachedSession> s_session_cache;
+
+void TLSv12::offer_cached_session_for_resumption()
+{
+    m_context.session_id_size = 0;
+    m_context.session_resumption_offered = false;
+
+    if (m_context.extensions.SNI.is_empty())
+        return;
+
+    auto it = s_session_cache.find(m_context.extensions.SNI);
+    if (it == s_session_cache.end())
+        return;
+
+    if (it->value.established_at + SessionCacheLifetimeSeconds <= time(nullptr)) {
+        s_session_cache.remove(it);
+        return;
+    }
+
+    memcpy(m_context.session_id, it->value.session_id, it->value.session_id_size);
+    m_context.session_id_size = it->value.session_id_size;
+    m_context.session_resumption_offered = true;
+    dbgln_if(TLS_DEBUG, "Offering session resumption to {}", m_context.extensions.SNI);
+}
+
+bool TLSv12::try_resume_session()
+{
+    auto it = s_session_cache.find(m_context.extensions.SNI);
+    if (it == s_session_cache.end())
+        return false;
+
+    // RFC 5246 appendix F.1.4: a resumed session must use the cipher suite
+    // it was originally established with.
+    if (it->value.cipher != m_context.cipher) {
+        dbgln("TLS session resumption with a different cipher suite, falling back to a full handshake");
+        s_session_cache.remove(it);
+        return false;
+    }
+
+    // RFC 7627 section 5.3: only resume a session under the same
+    // extended-master-secret state it was established with.
+    if (it->value.extended_master_secret != m_context.extensions.extended_master_secret) {
+        dbgln("TLS session resumption with mismatched extended-master-secret state, falling back to a full handshake");
+        s_session_cache.remove(it);
+        return false;
+    }
+
+    auto master_key_or_error = ByteBuffer::copy(it->value.master_key);
+    if (master_key_or_error.is_error())
+        return false;
+    m_context.master_key = master_key_or_error.release_value();
+    if (!expand_key())
+        return false;
+
+    m_context.is_resuming_session = true;
+    dbgln_if(TLS_DEBUG, "Resuming session with {}", m_context.extensions.SNI);
+    return true;
+}
+
+void TLSv12::cache_established_session()
+{
+    if (m_context.extensions.SNI.is_empty() || m_context.session_id_size == 0 || m_context.master_key.is_empty())
+        return;
+
+    auto master_key_or_error = ByteBuffer::copy(m_context.master_key);
+    if (master_key_or_error.is_error())
+        return;
+
+    if (s_session_cache.size() >= MaxCachedSessions && !s_session_cache.contains(m_context.extensions.SNI))
+        s_session_cache.remove(s_session_cache.begin());
+
+    CachedSession session;
+    memcpy(session.session_id, m_context.session_id, m_context.session_id_size);
+    session.session_id_size = m_context.session_id_size;
+    session.master_key = master_key_or_error.release_value();
+    session.cipher = m_context.cipher;
+    session.extended_master_secret = m_context.extensions.extended_master_secret;
+    session.established_at = time(nullptr);
+    s_session_cache.set(m_context.extensions.SNI, move(session));
+}
+
+void TLSv12::evict_cached_session()
+{
+    if (!m_context.extensions.SNI.is_empty())
+        s_session_cache.remove(m_context.extensions.SNI);
+}
+
 void TLSv12::consume(ReadonlyBytes record)
 {
     if (m_context.critical_error) {
@@ -138,6 +138,7 @@ enum class HandshakeExtension : u16 {
     ECPointFormats = 0x0b,
     SignatureAlgorithms = 0x0d,
     ApplicationLayerProtocolNegotiation = 0x10,
+    ExtendedMasterSecret = 0x17,
 };
 
 enum class NameType : u8 {
@@ -274,6 +275,8 @@ struct Context {
     u8 local_random[32];
     u8 session_id[32];
     u8 session_id_size { 0 };
+    bool session_resumption_offered { false };
+    bool is_resuming_session { false };
     CipherSuite cipher;
     bool is_server { false };
     Vector<Certificate> certificates;
@@ -311,6 +314,8 @@ struct Context {
     struct {
         // Server Name Indicator
         DeprecatedString SNI; // I hate your existence
+        // RFC 7627; modern servers refuse to resume sessions established without this.
+        bool extended_master_secret { false };
     } extensions;
 
     u8 request_client_certificate { 0 };
@@ -562,6 +567,14 @@ private:
 
     bool compute_master_secret_from_pre_master_secret(size_t length);
 
+    // Session-ID resumption; established sessions are kept in a process-wide
+    // cache keyed on the server name, so later connections to the same host
+    // can skip the certificate and key exchange round-trips.
+    void offer_cached_session_for_resumption();
+    bool try_resume_session();
+    void cache_established_session();
+    void evict_cached_session();
+
     void try_disambiguate_error() const;
 
     bool m_eof { false };
@@ -8,10 +8,12 @@
 #include <LibTest/Macros.h> // intentionally first -- we redefine VERIFY and friends in here
 
 #include <AK/Function.h>
+#include <AK/QuickSort.h>
+#include <AK/Vector.h>
 #include <LibCore/ArgsParser.h>
 #include <LibTest/TestSuite.h>
 #include <stdlib.h>
-#include <sys/time.h>
+#include <time.h>
 
 namespace Test {
 
@@ -21,23 +23,30 @@ class TestElapsedTimer {
 public:
     TestElapsedTimer() { restart(); }
 
-    void restart() { gettimeofday(&m_started, nullptr); }
+    void restart() { clock_gettime(CLOCK_MONOTONIC, &m_started); }
 
     u64 elapsed_milliseconds()
     {
-        struct timeval now = {};
-        gettimeofday(&now, nullptr);
-
-        struct timeval delta = {};
-        timersub(&now, &m_started, &delta);
+        return elapsed_nanoseconds() / 1'000'000;
+    }
 
-        return delta.tv_sec * 1000 + delta.tv_usec / 1000;
+    u64 elapsed_nanoseconds()
+    {
+        struct timespec now = {};
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return (now.tv_sec - m_started.tv_sec) * 1'000'000'000ull + (now.tv_nsec - m_started.tv_nsec);
     }
 
 private:
-    struct timeval m_started = {};
+    struct timespec m_started = {};
 };
 
+// Benchmarks are repeated until they have run for this long in total (or hit
+// the repetition cap), so short benchmarks yield enough samples for the
+// reported statistics to mean something.
+static constexpr u64 benchmark_target_total_nanoseconds = 2'000'000'000;
+static constexpr u64 benchmark_max_repetitions = 25;
+
 // Declared in Macros.h
 void current_test_case_did_fail()
 {
@@ -69,6 +78,7 @@ int TestSuite::main(DeprecatedString const& suite_name, int argc, char** argv)
 
     args_parser.add_option(do_tests_only, "Only run tests.", "tests", 0);
     args_parser.add_option(do_benchmarks_only, "Only run benchmarks.", "bench", 0);
+    args_parser.add_option(m_benchmark_repetitions, "Number of times to repeat each benchmark (0 to calibrate automatically)", "bench-repeat", 0, "repetitions");
     args_parser.add_option(do_list_cases, "List available test cases.", "list", 0);
     args_parser.add_positional_argument(search_string, "Only run matching cases.", "pattern", Core::ArgsParser::Required::No);
     args_parser.parse(argc, argv);
@@ -124,16 +134,43 @@ int TestSuite::run(NonnullRefPtrVector<TestCase> const& tests)
         warnln("Running {} '{}'.", test_type, t.name());
         m_current_test_case_passed = true;
 
-        TestElapsedTimer timer;
-        t.func()();
-        auto const time = timer.elapsed_milliseconds();
-
-        dbgln("{} {} '{}' in {}ms", m_current_test_case_passed ? "Completed" : "Failed", test_type, t.name(), time);
-
         if (t.is_benchmark()) {
-            m_benchtime += time;
+            // One untimed warmup run, so that code, data and caches are warm
+            // when we start measuring.
+            t.func()();
+
+            Vector<u64> samples;
+            u64 total_nanoseconds = 0;
+            while (m_current_test_case_passed) {
+                TestElapsedTimer timer;
+                t.func()();
+                auto nanoseconds = timer.elapsed_nanoseconds();
+                samples.append(nanoseconds);
+                total_nanoseconds += nanoseconds;
+
+                if (m_benchmark_repetitions != 0) {
+                    if (samples.size() >= m_benchmark_repetitions)
+                        break;
+                } else if (samples.size() >= benchmark_max_repetitions || total_nanoseconds >= benchmark_target_total_nanoseconds) {
+                    break;
+                }
+            }
+
+            quick_sort(samples);
+            auto median_sample = samples[samples.size() / 2];
+            dbgln("{} benchmark '{}' with {} runs in {}ms: min {}us, median {}us, average {}us, max {}us",
+                m_current_test_case_passed ? "Completed" : "Failed", t.name(), samples.size(), total_nanoseconds / 1'000'000,
+                samples.first() / 1'000, median_sample / 1'000, total_nanoseconds / samples.size() / 1'000, samples.last() / 1'000);
+
+            m_benchtime += total_nanoseconds / 1'000'000;
             benchmark_count++;
         } else {
+            TestElapsedTimer timer;
+            t.func()();
+            auto const time = timer.elapsed_milliseconds();
+
+            dbgln("{} {} '{}' in {}ms", m_current_test_case_passed ? "Completed" : "Failed", test_type, t.name(), time);
+
             m_testtime += time;
             test_count++;
         }
@@ -9,6 +9,7 @@
 #include <AK/StringBuilder.h>
 #include <AK/Utf8View.h>
 #include <LibTextCodec/Decoder.h>
+#include <string.h>
 
 namespace TextCodec {
 
@@ -232,6 +233,39 @@ DeprecatedString UTF8Decoder::to_utf8(StringView input)
     return bomless_input;
 }
 
+namespace {
+// Encodes one UTF-16 code unit per loop iteration straight into the builder,
+// skipping the per-code-point callback of process(). Code units are at most
+// three UTF-8 bytes; unpaired surrogates are encoded as-is, which matches
+// what StringBuilder::append_code_point produces for them.
+DeprecatedString convert_utf16_to_utf8(StringView input, bool big_endian)
+{
+    StringBuilder builder(input.length() / 2);
+    size_t utf16_length = input.length() - (input.length() % 2);
+    auto const* data = reinterpret_cast<u8 const*>(input.characters_without_null_termination());
+
+    for (size_t i = 0; i < utf16_length; i += 2) {
+        u16 code_unit;
+        if (big_endian)
+            code_unit = (data[i] << 8) | data[i + 1];
+        else
+            code_unit = data[i] | (data[i + 1] << 8);
+
+        if (code_unit < 0x80) {
+            builder.append(static_cast<char>(code_unit));
+        } else if (code_unit < 0x800) {
+            builder.append(static_cast<char>(0xc0 | (code_unit >> 6)));
+            builder.append(static_cast<char>(0x80 | (code_unit & 0x3f)));
+        } else {
+            builder.append(static_cast<char>(0xe0 | (code_unit >> 12)));
+            builder.append(static_cast<char>(0x80 | ((code_unit >> 6) & 0x3f)));
+            builder.append(static_cast<char>(0x80 | (code_unit & 0x3f)));
+        }
+    }
+    return builder.to_deprecated_string();
+}
+}
+
 void UTF16BEDecoder::process(StringView input, Function<void(u32)> on_code_point)
 {
     size_t utf16_length = input.length() - (input.length() % 2);
@@ -248,9 +282,7 @@ DeprecatedString UTF16BEDecoder::to_utf8(StringView input)
     if (auto bytes = input.bytes(); bytes.size() >= 2 && bytes[0] == 0xFE && bytes[1] == 0xFF)
         bomless_input = input.substring_view(2);
 
-    StringBuilder builder(bomless_input.length() / 2);
-    process(bomless_input, [&builder](u32 c) { builder.append_code_point(c); });
-    return builder.to_deprecated_string();
+    return convert_utf16_to_utf8(bomless_input, true);
 }
 
 void UTF16LEDecoder::process(StringView input, Function<void(u32)> on_code_point)
@@ -269,9 +301,7 @@ DeprecatedString UTF16LEDecoder::to_utf8(StringView input)
     if (auto bytes = input.bytes(); bytes.size() >= 2 && bytes[0] == 0xFF && bytes[1] == 0xFE)
         bomless_input = input.substring_view(2);
 
-    StringBuilder builder(bomless_input.length() / 2);
-    process(bomless_input, [&builder](u32 c) { builder.append_code_point(c); });
-    return builder.to_deprecated_string();
+    return convert_utf16_to_utf8(bomless_input, false);
 }
 
 void Latin1Decoder::process(StringView input, Function<void(u32)> on_code_point)
@@ -283,6 +313,39 @@ void Latin1Decoder::process(StringView input, Function<void(u32)> on_code_point)
     }
 }
 
+DeprecatedString Latin1Decoder::to_utf8(StringView input)
+{
+    // ASCII stretches pass through unchanged; only bytes >= 0x80 need to be
+    // expanded to two UTF-8 bytes. Scan eight bytes at a time for the next
+    // non-ASCII byte and bulk-append everything before it.
+    StringBuilder builder(input.length());
+    auto const* data = reinterpret_cast<u8 const*>(input.characters_without_null_termination());
+    size_t length = input.length();
+
+    size_t i = 0;
+    while (i < length) {
+        size_t run_start = i;
+        while (i + sizeof(u64) <= length) {
+            u64 chunk;
+            memcpy(&chunk, data + i, sizeof(chunk));
+            if ((chunk & 0x8080808080808080ull) != 0)
+                break;
+            i += sizeof(u64);
+        }
+        while (i < length && !(data[i] & 0x80))
+            ++i;
+        if (i > run_start)
+            builder.append(StringView { reinterpret_cast<char const*>(data + run_start), i - run_start });
+
+        if (i < length) {
+            u8 ch = data[i++];
+            builder.append(static_cast<char>(0xc0 | (ch >> 6)));
+            builder.append(static_cast<char>(0x80 | (ch & 0x3f)));
+        }
+    }
+    return builder.to_deprecated_string();
+}
+
 namespace {
 u32 convert_latin2_to_utf8(u8 in)
 {
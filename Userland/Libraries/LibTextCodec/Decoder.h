@@ -42,6 +42,7 @@ public:
 class Latin1Decoder final : public Decoder {
 public:
     virtual void process(StringView, Function<void(u32)> on_code_point) override;
+    virtual DeprecatedString to_utf8(StringView) override;
 };
 
 class Latin2Decoder final : public Decoder {
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/Stream.h>
+#include <LibThreading/AsyncFile.h>
+
+namespace Threading {
+
+ThreadPool& AsyncFile::io_pool()
+{
+    // I/O requests spend most of their time blocked in the kernel, so a few
+    // workers go a long way; no need for a thread per processor. The pool is
+    // deliberately leaked, like the BackgroundAction thread, so completions
+    // in flight during exit don't race its destruction.
+    static ThreadPool* pool = new ThreadPool(4);
+    return *pool;
+}
+
+void AsyncFile::read_entire_file(DeprecatedString path, Function<void(ErrorOr<ByteBuffer>)> on_complete)
+{
+    run<ErrorOr<ByteBuffer>>(
+        [path = move(path)]() -> ErrorOr<ByteBuffer> {
+            auto file = TRY(Core::Stream::File::open(path, Core::Stream::OpenMode::Read));
+            return file->read_until_eof();
+        },
+        move(on_complete));
+}
+
+void AsyncFile::write_file(DeprecatedString path, ByteBuffer contents, Function<void(ErrorOr<void>)> on_complete)
+{
+    run<ErrorOr<void>>(
+        [path = move(path), contents = move(contents)]() -> ErrorOr<void> {
+            auto file = TRY(Core::Stream::File::open(path, Core::Stream::OpenMode::Write));
+            return file->write_entire_buffer(contents);
+        },
+        move(on_complete));
+}
+
+}
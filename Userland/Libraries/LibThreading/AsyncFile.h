@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/DeprecatedString.h>
+#include <AK/Error.h>
+#include <AK/Function.h>
+#include <LibCore/EventLoop.h>
+#include <LibThreading/ThreadPool.h>
+
+namespace Threading {
+
+// Asynchronous file I/O with completion callbacks. Operations run on a shared
+// pool of I/O worker threads, so several requests can wait on the disk at
+// once, and each completion callback is invoked on the event loop its request
+// was made from. The kernel has no asynchronous path for file I/O -- reads
+// and writes go through the VFS synchronously on the calling thread -- so a
+// worker pool is how the waiting stays off the event loop.
+class AsyncFile {
+public:
+    static void read_entire_file(DeprecatedString path, Function<void(ErrorOr<ByteBuffer>)> on_complete);
+    static void write_file(DeprecatedString path, ByteBuffer contents, Function<void(ErrorOr<void>)> on_complete);
+
+    // Runs an arbitrary action on the I/O pool and delivers its result like
+    // the operations above. For callers that want to process what they read
+    // (decode an image, parse a document) without occupying the event loop.
+    template<typename Result>
+    static void run(Function<Result()> action, Function<void(Result)> on_complete)
+    {
+        io_pool().submit([action = move(action), on_complete = move(on_complete), origin_event_loop = &Core::EventLoop::current()]() mutable {
+            auto result = action();
+            origin_event_loop->deferred_invoke([result = move(result), on_complete = move(on_complete)]() mutable {
+                on_complete(move(result));
+            });
+            origin_event_loop->wake();
+        });
+    }
+
+private:
+    static ThreadPool& io_pool();
+};
+
+}
@@ -5,42 +5,36 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/Queue.h>
+#include <AK/MPMCQueue.h>
 #include <LibThreading/BackgroundAction.h>
-#include <LibThreading/Mutex.h>
 #include <LibThreading/Thread.h>
+#include <sched.h>
+#include <semaphore.h>
 #include <unistd.h>
 
-static pthread_mutex_t s_mutex = PTHREAD_MUTEX_INITIALIZER;
-static pthread_cond_t s_condition = PTHREAD_COND_INITIALIZER;
-static Queue<Function<void()>>* s_all_actions;
+static MPMCQueue<Function<void()>>* s_all_actions;
+static sem_t s_ready_action_count;
 static Threading::Thread* s_background_thread;
 
 static intptr_t background_thread_func()
 {
-    Vector<Function<void()>> actions;
     while (true) {
-
-        pthread_mutex_lock(&s_mutex);
-
-        while (s_all_actions->is_empty())
-            pthread_cond_wait(&s_condition, &s_mutex);
-
-        while (!s_all_actions->is_empty())
-            actions.append(s_all_actions->dequeue());
-
-        pthread_mutex_unlock(&s_mutex);
-
-        for (auto& action : actions)
-            action();
-
-        actions.clear();
+        sem_wait(&s_ready_action_count);
+        auto action = s_all_actions->try_dequeue();
+        // The semaphore guarantees an enqueue has started, but the producer
+        // may not have published its slot yet; give it a chance to finish.
+        while (!action.has_value()) {
+            sched_yield();
+            action = s_all_actions->try_dequeue();
+        }
+        action.value()();
     }
 }
 
 static void init()
 {
-    s_all_actions = new Queue<Function<void()>>;
+    s_all_actions = new MPMCQueue<Function<void()>>;
+    sem_init(&s_ready_action_count, 0, 0);
     s_background_thread = &Threading::Thread::construct(background_thread_func, "Background Thread"sv).leak_ref();
     s_background_thread->start();
 }
@@ -57,8 +51,8 @@ void Threading::BackgroundActionBase::enqueue_work(Function<void()> work)
     if (s_all_actions == nullptr)
         init();
 
-    pthread_mutex_lock(&s_mutex);
-    s_all_actions->enqueue(move(work));
-    pthread_cond_broadcast(&s_condition);
-    pthread_mutex_unlock(&s_mutex);
+    // If the queue is full, yield until the background thread has caught up.
+    while (!s_all_actions->try_enqueue(move(work)))
+        sched_yield();
+    sem_post(&s_ready_action_count);
 }
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Vector.h>
+#include <LibCore/System.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/DirectoryTree.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/Thread.h>
+#include <dirent.h>
+#include <string.h>
+#include <unistd.h>
+
+namespace Threading {
+
+static size_t pick_worker_count(Optional<size_t> thread_count)
+{
+    if (thread_count.has_value() && thread_count.value() > 0)
+        return thread_count.value();
+    auto online_processors = sysconf(_SC_NPROCESSORS_ONLN);
+    return online_processors > 0 ? static_cast<size_t>(online_processors) : 1;
+}
+
+// Lists one directory, stat()ing every entry in a single pass, and attaches
+// the children to the node. Returns the children that are themselves
+// directories so the caller can add them to the frontier.
+static Vector<DirectoryTree::Node*> list_one_directory(DirectoryTree::Node& node)
+{
+    Vector<DirectoryTree::Node*> subdirectories;
+
+    DIR* dir = opendir(node.path.characters());
+    if (!dir) {
+        node.error = errno;
+        return subdirectories;
+    }
+
+    while (true) {
+        errno = 0;
+        auto* entry = readdir(dir);
+        if (!entry)
+            break;
+
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+            continue;
+
+        auto child = make<DirectoryTree::Node>();
+        child->path = DeprecatedString::formatted("{}/{}", node.path, StringView { entry->d_name, strlen(entry->d_name) });
+
+        auto stat_or_error = Core::System::lstat(child->path);
+        if (stat_or_error.is_error())
+            child->error = stat_or_error.error().code();
+        else
+            child->stat = stat_or_error.release_value();
+
+        if (child->is_directory())
+            subdirectories.append(child.ptr());
+        node.children.append(move(child));
+    }
+    if (errno != 0)
+        node.error = errno;
+
+    closedir(dir);
+    return subdirectories;
+}
+
+ErrorOr<DirectoryTree> DirectoryTree::gather(DeprecatedString root_path, Optional<size_t> thread_count)
+{
+    auto root = make<Node>();
+    root->path = move(root_path);
+    root->stat = TRY(Core::System::lstat(root->path));
+
+    if (!root->is_directory())
+        return DirectoryTree { move(root) };
+
+    // The frontier holds directories whose entries have not been listed yet.
+    // A worker pops a directory, lists it, and pushes any subdirectories it
+    // discovered back. The traversal is done once the frontier is empty and
+    // no worker is still listing (a busy worker may yet grow the frontier).
+    Vector<Node*> frontier;
+    frontier.append(root.ptr());
+
+    Mutex mutex;
+    ConditionVariable frontier_not_empty { mutex };
+    size_t busy_worker_count = 0;
+    bool traversal_has_ended = false;
+
+    auto worker_loop = [&]() -> intptr_t {
+        MutexLocker locker { mutex };
+        while (true) {
+            frontier_not_empty.wait_while([&] { return frontier.is_empty() && !traversal_has_ended; });
+            if (frontier.is_empty())
+                return 0;
+
+            auto* directory = frontier.take_last();
+            ++busy_worker_count;
+            locker.unlock();
+
+            auto subdirectories = list_one_directory(*directory);
+
+            locker.lock();
+            --busy_worker_count;
+            frontier.extend(move(subdirectories));
+            if (frontier.is_empty() && busy_worker_count == 0) {
+                traversal_has_ended = true;
+                frontier_not_empty.broadcast();
+                return 0;
+            }
+            if (!frontier.is_empty())
+                frontier_not_empty.broadcast();
+        }
+    };
+
+    Vector<NonnullRefPtr<Thread>> workers;
+    auto worker_count = pick_worker_count(thread_count);
+    for (size_t i = 0; i < worker_count; ++i) {
+        auto worker = Thread::construct([&worker_loop] { return worker_loop(); }, "Directory traversal"sv);
+        worker->start();
+        TRY(workers.try_append(move(worker)));
+    }
+    for (auto& worker : workers)
+        (void)worker->join();
+
+    return DirectoryTree { move(root) };
+}
+
+}
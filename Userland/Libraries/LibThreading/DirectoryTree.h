@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/DeprecatedString.h>
+#include <AK/Error.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/NonnullOwnPtrVector.h>
+#include <AK/Optional.h>
+#include <sys/stat.h>
+
+namespace Threading {
+
+// A recursive directory listing with lstat() information for every entry,
+// gathered by a crew of worker threads that share a frontier of unexplored
+// directories. Each directory is listed and stat()ed in one go by a single
+// worker, so a node's children are populated without any locking; the lock
+// only guards the frontier itself. This makes deep trees bounded by the
+// latency of the slowest chain of directories rather than the sum of all of
+// them.
+class DirectoryTree {
+public:
+    struct Node {
+        DeprecatedString path;
+        struct stat stat {
+        };
+        // Children in readdir() order. Only directories have any.
+        NonnullOwnPtrVector<Node> children;
+        // If non-zero, the errno encountered while listing this directory or
+        // stat()ing this entry.
+        int error { 0 };
+
+        bool is_directory() const { return S_ISDIR(stat.st_mode); }
+    };
+
+    // Defaults to one worker per online processor.
+    static ErrorOr<DirectoryTree> gather(DeprecatedString root_path, Optional<size_t> thread_count = {});
+
+    Node const& root() const { return *m_root; }
+    Node& root() { return *m_root; }
+
+private:
+    explicit DirectoryTree(NonnullOwnPtr<Node> root)
+        : m_root(move(root))
+    {
+    }
+
+    NonnullOwnPtr<Node> m_root;
+};
+
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibThreading/ThreadPool.h>
+#include <sched.h>
+#include <unistd.h>
+
+namespace Threading {
+
+static size_t pick_worker_count(Optional<size_t> thread_count)
+{
+    if (thread_count.has_value() && thread_count.value() > 0)
+        return thread_count.value();
+    auto online_processors = sysconf(_SC_NPROCESSORS_ONLN);
+    return online_processors > 0 ? static_cast<size_t>(online_processors) : 1;
+}
+
+ThreadPool::ThreadPool(Optional<size_t> thread_count)
+    : m_queues(FixedArray<WorkQueue>::must_create_but_fixme_should_propagate_errors(pick_worker_count(thread_count)))
+{
+    size_t worker_count = m_queues.size();
+    sem_init(&m_ready_work_count, 0, 0);
+
+    for (size_t i = 0; i < worker_count; ++i) {
+        auto thread = Thread::construct([this, i] {
+            return worker_loop(i);
+        },
+            DeprecatedString::formatted("ThreadPool worker {}", i));
+        thread->start();
+        m_workers.append(move(thread));
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    wait_for_all();
+    m_should_exit.store(true);
+    // Wake every worker so it can observe the exit flag.
+    for (size_t i = 0; i < m_workers.size(); ++i)
+        sem_post(&m_ready_work_count);
+    for (auto& worker : m_workers)
+        (void)worker.join();
+    sem_destroy(&m_ready_work_count);
+}
+
+void ThreadPool::submit(Function<void()> work)
+{
+    m_pending_work_count.fetch_add(1);
+    // Distribute round-robin; if the picked queue is full, try the others
+    // before yielding, so a slow worker cannot stall submission.
+    auto first_choice = m_next_queue.fetch_add(1) % m_queues.size();
+    for (;;) {
+        for (size_t offset = 0; offset < m_queues.size(); ++offset) {
+            if (m_queues[(first_choice + offset) % m_queues.size()].try_enqueue(move(work))) {
+                sem_post(&m_ready_work_count);
+                return;
+            }
+        }
+        sched_yield();
+    }
+}
+
+void ThreadPool::wait_for_all()
+{
+    // This is a cold path (once per batch); yielding is plenty.
+    while (m_pending_work_count.load() != 0)
+        sched_yield();
+}
+
+Optional<Function<void()>> ThreadPool::steal_work(size_t thief_index)
+{
+    for (size_t offset = 1; offset < m_queues.size(); ++offset) {
+        auto work = m_queues[(thief_index + offset) % m_queues.size()].try_dequeue();
+        if (work.has_value())
+            return work;
+    }
+    return {};
+}
+
+intptr_t ThreadPool::worker_loop(size_t worker_index)
+{
+    while (true) {
+        sem_wait(&m_ready_work_count);
+        if (m_should_exit.load())
+            return 0;
+
+        auto work = m_queues[worker_index].try_dequeue();
+        if (!work.has_value())
+            work = steal_work(worker_index);
+        // The semaphore guarantees an enqueue has started somewhere, but the
+        // producer may not have published its slot yet; spin until it shows up.
+        while (!work.has_value()) {
+            sched_yield();
+            work = m_queues[worker_index].try_dequeue();
+            if (!work.has_value())
+                work = steal_work(worker_index);
+        }
+
+        work.value()();
+        m_pending_work_count.fetch_sub(1);
+    }
+}
+
+}
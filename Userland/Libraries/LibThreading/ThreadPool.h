@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/FixedArray.h>
+#include <AK/Function.h>
+#include <AK/MPMCQueue.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullRefPtrVector.h>
+#include <AK/Optional.h>
+#include <LibThreading/Thread.h>
+#include <semaphore.h>
+
+namespace Threading {
+
+// A persistent pool of worker threads with work stealing. Every worker owns a
+// bounded lock-free queue; submitted work is distributed round-robin, and an
+// idle worker that finds its own queue empty steals from its siblings before
+// going to sleep. This keeps dispatch allocation-free and contention low even
+// when many small work items are submitted from several threads at once.
+class ThreadPool {
+    AK_MAKE_NONCOPYABLE(ThreadPool);
+    AK_MAKE_NONMOVABLE(ThreadPool);
+
+public:
+    // Defaults to one worker per online processor.
+    explicit ThreadPool(Optional<size_t> thread_count = {});
+    ~ThreadPool();
+
+    [[nodiscard]] size_t thread_count() const { return m_workers.size(); }
+
+    void submit(Function<void()>);
+
+    // Blocks until every piece of work submitted so far has finished.
+    void wait_for_all();
+
+    // Splits [begin, end) into chunks and runs `callback(chunk_begin, chunk_end)`
+    // on the pool, then waits for all chunks to finish. The callback must be
+    // safe to invoke from several threads at once.
+    template<typename Callback>
+    void parallel_for(size_t begin, size_t end, size_t chunk_size, Callback callback)
+    {
+        VERIFY(chunk_size > 0);
+        for (size_t chunk_begin = begin; chunk_begin < end; chunk_begin += chunk_size) {
+            size_t chunk_end = min(chunk_begin + chunk_size, end);
+            submit([callback, chunk_begin, chunk_end] {
+                callback(chunk_begin, chunk_end);
+            });
+        }
+        wait_for_all();
+    }
+
+private:
+    static constexpr size_t queue_capacity_per_worker = 256;
+    using WorkQueue = MPMCQueue<Function<void()>, queue_capacity_per_worker>;
+
+    intptr_t worker_loop(size_t worker_index);
+    Optional<Function<void()>> steal_work(size_t thief_index);
+
+    NonnullRefPtrVector<Thread> m_workers;
+    FixedArray<WorkQueue> m_queues;
+    sem_t m_ready_work_count {};
+    Atomic<size_t> m_next_queue { 0 };
+    Atomic<size_t> m_pending_work_count { 0 };
+    Atomic<bool> m_should_exit { false };
+};
+
+}
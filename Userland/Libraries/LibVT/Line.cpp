@@ -33,6 +33,18 @@ void Line::rewrap(size_t new_length, Line* next_line, CursorPosition* cursor, bo
         push_cells_into_next_line(new_length, next_line, cursor_is_on_next_line, cursor);
 }
 
+void Line::compact()
+{
+    // Scrollback lines are mostly short, but still carry one cell per screen
+    // column. Drop the cells past the termination column (the same ones
+    // rewrap() would drop) and give back the spare vector capacity; resizing
+    // the terminal re-expands every line to full width anyway.
+    size_t new_length = m_terminated_at.has_value() ? max<size_t>(*m_terminated_at, 1) : m_cells.size();
+    if (new_length < m_cells.size())
+        m_cells.remove(new_length, m_cells.size() - new_length);
+    m_cells.shrink_to_fit();
+}
+
 void Line::set_length(size_t new_length)
 {
     m_cells.resize(new_length);
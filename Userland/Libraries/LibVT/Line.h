@@ -45,6 +45,8 @@ public:
     void clear_range(size_t first_column, size_t last_column, Attribute const& attribute = Attribute());
     bool has_only_one_background_color() const;
 
+    void compact();
+
     bool is_empty() const
     {
         return !any_of(m_cells, [](auto& cell) { return cell != Cell(); });
@@ -331,7 +331,7 @@ void TerminalWidget::paint_event(GUI::PaintEvent& event)
                 && visual_row == row_with_cursor
                 && column == m_terminal.cursor_column();
             should_reverse_fill_for_cursor_or_selection |= selection_contains({ first_row_from_history + visual_row, (int)column });
-            auto attribute = line.attribute_at(column);
+            auto const& attribute = line.attribute_at(column);
             auto character_rect = glyph_rect(visual_row, column);
             auto cell_rect = character_rect.inflated(0, m_line_spacing);
             auto text_color_before_bold_change = should_reverse_fill_for_cursor_or_selection ? attribute.effective_background_color() : attribute.effective_foreground_color();
@@ -398,7 +398,7 @@ void TerminalWidget::paint_event(GUI::PaintEvent& event)
             continue;
         auto& line = m_terminal.line(first_row_from_history + visual_row);
         for (size_t column = 0; column < line.length(); ++column) {
-            auto attribute = line.attribute_at(column);
+            auto const& attribute = line.attribute_at(column);
             bool should_reverse_fill_for_cursor_or_selection = m_cursor_blink_state
                 && m_cursor_shape == VT::CursorShape::Block
                 && m_has_logical_focus
@@ -418,10 +418,20 @@ void TerminalWidget::paint_event(GUI::PaintEvent& event)
                 text_color = palette().base_text();
             }
 
+            auto& font_to_use = has_flag(attribute.flags, VT::Attribute::Flags::Bold) ? bold_font : font;
+
+            // Fast path: ASCII never starts an emoji sequence, so draw the
+            // glyph directly instead of going through the code point iterator
+            // machinery (which allocates) in draw_glyph_or_emoji().
+            if (code_point < 0x80 && font_to_use.contains_glyph(code_point)) {
+                painter.draw_glyph(character_rect.location(), code_point, font_to_use, text_color);
+                continue;
+            }
+
             painter.draw_glyph_or_emoji(
                 character_rect.location(),
                 code_point,
-                has_flag(attribute.flags, VT::Attribute::Flags::Bold) ? bold_font : font,
+                font_to_use,
                 text_color);
         }
     }
@@ -763,9 +773,10 @@ void TerminalWidget::paste()
     if (m_ptm_fd == -1)
         return;
 
-    auto [data, mime_type, _] = GUI::Clipboard::the().fetch_data_and_type();
-    if (!mime_type.starts_with("text/"sv))
+    auto data_and_type = GUI::Clipboard::the().fetch_data_and_type();
+    if (!data_and_type.mime_type.starts_with("text/"sv))
         return;
+    auto data = data_and_type.bytes();
     if (data.is_empty())
         return;
     send_non_user_input(data);
@@ -1194,8 +1205,8 @@ void TerminalWidget::update_copy_action()
 
 void TerminalWidget::update_paste_action()
 {
-    auto [data, mime_type, _] = GUI::Clipboard::the().fetch_data_and_type();
-    m_paste_action->set_enabled(mime_type.starts_with("text/"sv) && !data.is_empty());
+    auto data_and_type = GUI::Clipboard::the().fetch_data_and_type();
+    m_paste_action->set_enabled(data_and_type.mime_type.starts_with("text/"sv) && !data_and_type.bytes().is_empty());
 }
 
 void TerminalWidget::set_color_scheme(StringView name)
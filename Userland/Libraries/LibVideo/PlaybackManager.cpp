@@ -261,6 +261,35 @@ void PlaybackManager::post_decoder_error(DecoderError error)
     m_main_loop.post_event(m_event_handler, make<DecoderErrorEvent>(error));
 }
 
+DecoderErrorOr<NonnullRefPtr<Gfx::Bitmap>> PlaybackManager::bitmap_for_frame(VideoFrame& frame)
+{
+    // A bitmap is free for reuse when the pool holds the only reference to it,
+    // meaning the frame queue, the presented frame and the client have all let
+    // go of it. Everything runs on the event loop, so the reference count can't
+    // change under us between the check and the conversion below.
+    RefPtr<Gfx::Bitmap> bitmap;
+    for (auto& pooled_bitmap : m_bitmap_pool) {
+        if (pooled_bitmap->ref_count() == 1 && pooled_bitmap->size() == frame.size()) {
+            bitmap = pooled_bitmap;
+            break;
+        }
+    }
+
+    if (!bitmap) {
+        bitmap = DECODER_TRY_ALLOC(Gfx::Bitmap::try_create(Gfx::BitmapFormat::BGRx8888, frame.size()));
+        // The queue, the presented frame and the frame being converted bound
+        // how many bitmaps can be in flight at once. Drop unused bitmaps of a
+        // stale size first, so a resolution change doesn't leave them pinned.
+        constexpr size_t maximum_pool_size = FRAME_BUFFER_COUNT + 2;
+        m_bitmap_pool.remove_all_matching([&](auto& pooled_bitmap) { return pooled_bitmap->ref_count() == 1 && pooled_bitmap->size() != frame.size(); });
+        if (m_bitmap_pool.size() < maximum_pool_size)
+            DECODER_TRY_ALLOC(m_bitmap_pool.try_append(bitmap));
+    }
+
+    TRY(frame.output_to_bitmap(*bitmap));
+    return bitmap.release_nonnull();
+}
+
 bool PlaybackManager::decode_and_queue_one_sample()
 {
     if (m_frame_queue->size() >= FRAME_BUFFER_COUNT) {
@@ -323,7 +352,7 @@ bool PlaybackManager::decode_and_queue_one_sample()
         break;
     }
 
-    auto bitmap = TRY_OR_ENQUEUE_ERROR(decoded_frame->to_bitmap());
+    auto bitmap = TRY_OR_ENQUEUE_ERROR(bitmap_for_frame(*decoded_frame));
     m_frame_queue->enqueue(FrameQueueItem::frame(bitmap, frame_sample->timestamp()));
     m_present_timer->start(0);
 
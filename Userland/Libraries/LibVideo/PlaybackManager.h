@@ -135,6 +135,7 @@ private:
 
     // May run off the main thread
     void post_decoder_error(DecoderError error);
+    DecoderErrorOr<NonnullRefPtr<Gfx::Bitmap>> bitmap_for_frame(VideoFrame&);
     bool decode_and_queue_one_sample();
     void on_decode_timer();
 
@@ -155,6 +156,11 @@ private:
     NonnullOwnPtr<VideoFrameQueue> m_frame_queue;
     Optional<FrameQueueItem> m_next_frame;
 
+    // Bitmaps that frames have been converted into are recycled through this
+    // pool once the frame queue and the client drop their references, instead
+    // of allocating (and zeroing) a fresh bitmap for every decoded frame.
+    Vector<RefPtr<Gfx::Bitmap>> m_bitmap_pool;
+
     NonnullRefPtr<Core::Timer> m_present_timer;
     unsigned m_decoding_buffer_time_ms = 16;
 
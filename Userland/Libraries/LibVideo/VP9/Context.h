@@ -13,10 +13,12 @@
 #include <LibGfx/Size.h>
 #include <LibVideo/Color/CodingIndependentCodePoints.h>
 
+#include "BitStream.h"
 #include "ContextStorage.h"
 #include "Enums.h"
 #include "LookupTables.h"
 #include "MotionVector.h"
+#include "SyntaxElementCounter.h"
 #include "Utilities.h"
 
 namespace Video::VP9 {
@@ -175,14 +177,19 @@ static NonZeroTokensView create_non_zero_tokens_view(NonZeroTokens& non_zero_tok
 
 struct TileContext {
 public:
-    static ErrorOr<TileContext> try_create(FrameContext& frame_context, u32 rows_start, u32 rows_end, u32 columns_start, u32 columns_end, PartitionContextView above_partition_context, NonZeroTokensView above_non_zero_tokens, SegmentationPredictionContextView above_segmentation_ids)
+    static ErrorOr<TileContext> try_create(FrameContext& frame_context, ReadonlyBytes data, u32 rows_start, u32 rows_end, u32 columns_start, u32 columns_end, PartitionContextView above_partition_context, NonZeroTokensView above_non_zero_tokens, SegmentationPredictionContextView above_segmentation_ids)
     {
         auto width = columns_end - columns_start;
         auto height = rows_end - rows_start;
         auto context_view = frame_context.m_block_contexts.view(rows_start, columns_start, height, width);
 
+        SyntaxElementCounter counter;
+        counter.clear_counts();
+
         return TileContext {
             frame_context,
+            BitStream { data.data(), data.size() },
+            counter,
             rows_start,
             rows_end,
             columns_start,
@@ -200,6 +207,11 @@ public:
     Vector2D<FrameBlockContext> const& frame_block_contexts() const { return frame_context.block_contexts(); }
 
     FrameContext const& frame_context;
+    // Every tile has its own bit stream over its slice of the frame data and
+    // its own syntax element counter, so that tiles can be decoded on
+    // separate threads. The counters are merged after all tiles are decoded.
+    BitStream bit_stream;
+    SyntaxElementCounter counter;
     u32 rows_start { 0 };
     u32 rows_end { 0 };
     u32 columns_start { 0 };
@@ -231,6 +243,8 @@ struct BlockContext {
         return BlockContext {
             .frame_context = tile_context.frame_context,
             .tile_context = tile_context,
+            .bit_stream = tile_context.bit_stream,
+            .counter = tile_context.counter,
             .row = row,
             .column = column,
             .size = size,
@@ -246,6 +260,8 @@ struct BlockContext {
 
     FrameContext const& frame_context;
     TileContext const& tile_context;
+    BitStream& bit_stream;
+    SyntaxElementCounter& counter;
     u32 row { 0 };
     u32 column { 0 };
     BlockSubsize size;
@@ -101,7 +101,8 @@ DecoderErrorOr<FrameContext> Parser::parse_frame(ReadonlyBytes frame_data)
 
     TRY(m_decoder.allocate_buffers(frame_context));
 
-    TRY(decode_tiles(frame_context));
+    VERIFY(m_bit_stream->get_position() % 8 == 0);
+    TRY(decode_tiles(frame_context, frame_data.slice(m_bit_stream->get_position() / 8)));
     TRY(refresh_probs(frame_context));
 
     m_previous_frame_type = frame_context.type;
@@ -852,28 +853,50 @@ static u32 get_tile_offset(u32 tile_start, u32 frame_size_in_blocks, u32 tile_si
     return min(offset, frame_size_in_blocks);
 }
 
-DecoderErrorOr<void> Parser::decode_tiles(FrameContext& frame_context)
+DecoderErrorOr<void> Parser::decode_tiles(FrameContext& frame_context, ReadonlyBytes tile_data)
 {
     auto log2_dimensions = frame_context.log2_of_tile_counts;
-    auto tile_cols = 1 << log2_dimensions.width();
-    auto tile_rows = 1 << log2_dimensions.height();
+    auto tile_cols = 1u << log2_dimensions.width();
+    auto tile_rows = 1u << log2_dimensions.height();
 
     PartitionContext above_partition_context = DECODER_TRY_ALLOC(PartitionContext::try_create(superblocks_to_blocks(frame_context.superblock_columns())));
     NonZeroTokens above_non_zero_tokens = DECODER_TRY_ALLOC(create_non_zero_tokens(blocks_to_sub_blocks(frame_context.columns()), frame_context.color_config.subsampling_x));
     SegmentationPredictionContext above_segmentation_ids = DECODER_TRY_ALLOC(SegmentationPredictionContext::try_create(frame_context.columns()));
 
-    // FIXME: To implement tiled decoding, we'll need to pre-parse the tile positions and sizes into a 2D vector of ReadonlyBytes,
-    //        then run through each column of tiles in top to bottom order afterward. Each column can be sent to a worker thread
-    //        for execution. Each worker thread will want to create a set of above contexts sized to its tile width, then provide
-    //        those to each tile as it decodes them.
-    for (auto tile_row = 0; tile_row < tile_rows; tile_row++) {
-        for (auto tile_col = 0; tile_col < tile_cols; tile_col++) {
+    // The tile data is laid out in tile raster order, with every tile except the last
+    // prefixed by a 32-bit size field. Pre-parse the positions and sizes so that each
+    // tile gets its own slice of the data, and with it its own bit stream.
+    //
+    // Tile columns have no dependencies on each other: the syntax uses per-tile
+    // entropy contexts, and both prediction and motion vector candidate selection
+    // are restricted to the current tile's columns. The "above" contexts are sliced
+    // per column here, and tiles within a column share them by being decoded in top
+    // to bottom order. This lets us send each column of tiles to a worker thread.
+    Vector<Vector<TileContext, 1>, 4> tile_workloads;
+    DECODER_TRY_ALLOC(tile_workloads.try_ensure_capacity(tile_cols));
+    for (auto tile_col = 0u; tile_col < tile_cols; tile_col++) {
+        tile_workloads.append({});
+        DECODER_TRY_ALLOC(tile_workloads[tile_col].try_ensure_capacity(tile_rows));
+    }
+
+    size_t tile_data_offset = 0;
+    for (auto tile_row = 0u; tile_row < tile_rows; tile_row++) {
+        for (auto tile_col = 0u; tile_col < tile_cols; tile_col++) {
             auto last_tile = (tile_row == tile_rows - 1) && (tile_col == tile_cols - 1);
             size_t tile_size;
-            if (last_tile)
-                tile_size = m_bit_stream->bytes_remaining();
-            else
-                tile_size = TRY_READ(m_bit_stream->read_bits(32));
+            if (last_tile) {
+                tile_size = tile_data.size() - tile_data_offset;
+            } else {
+                if (tile_data.size() - tile_data_offset < sizeof(u32))
+                    return DecoderError::corrupted("Frame data is too small to contain tile sizes"sv);
+                tile_size = static_cast<size_t>(tile_data[tile_data_offset]) << 24
+                    | static_cast<size_t>(tile_data[tile_data_offset + 1]) << 16
+                    | static_cast<size_t>(tile_data[tile_data_offset + 2]) << 8
+                    | tile_data[tile_data_offset + 3];
+                tile_data_offset += sizeof(u32);
+                if (tile_size > tile_data.size() - tile_data_offset)
+                    return DecoderError::corrupted("Tile size exceeds the remaining frame data"sv);
+            }
 
             auto rows_start = get_tile_offset(tile_row, frame_context.rows(), log2_dimensions.height());
             auto rows_end = get_tile_offset(tile_row + 1, frame_context.rows(), log2_dimensions.height());
@@ -885,12 +908,51 @@ DecoderErrorOr<void> Parser::decode_tiles(FrameContext& frame_context)
             auto above_non_zero_tokens_view = create_non_zero_tokens_view(above_non_zero_tokens, blocks_to_sub_blocks(columns_start), blocks_to_sub_blocks(columns_end - columns_start), frame_context.color_config.subsampling_x);
             auto above_segmentation_ids_for_tile = safe_slice(above_segmentation_ids.span(), columns_start, columns_end - columns_start);
 
-            auto tile_context = DECODER_TRY_ALLOC(TileContext::try_create(frame_context, rows_start, rows_end, columns_start, columns_end, above_partition_context_for_tile, above_non_zero_tokens_view, above_segmentation_ids_for_tile));
+            auto tile_context = DECODER_TRY_ALLOC(TileContext::try_create(frame_context, tile_data.slice(tile_data_offset, tile_size), rows_start, rows_end, columns_start, columns_end, above_partition_context_for_tile, above_non_zero_tokens_view, above_segmentation_ids_for_tile));
+            tile_data_offset += tile_size;
+            tile_workloads[tile_col].append(move(tile_context));
+        }
+    }
 
-            TRY_READ(m_bit_stream->init_bool(tile_size));
-            TRY(decode_tile(tile_context));
-            TRY_READ(m_bit_stream->exit_bool());
+    if (tile_cols > 1 && !m_worker_pool)
+        m_worker_pool = make<Threading::ThreadPool>();
+
+    // Decoding a column per thread only pays off when there is more than one
+    // processor to run them on; otherwise the pool would just add scheduling
+    // overhead on top of the same serial work.
+    if (tile_cols > 1 && m_worker_pool->thread_count() > 1) {
+        Vector<Optional<DecoderError>, 4> errors;
+        DECODER_TRY_ALLOC(errors.try_resize(tile_cols));
+        for (auto tile_col = 0u; tile_col < tile_cols; tile_col++) {
+            m_worker_pool->submit([this, &errors, &tile_workloads, tile_col] {
+                auto result = decode_tile_column(tile_workloads[tile_col]);
+                if (result.is_error())
+                    errors[tile_col] = result.release_error();
+            });
+        }
+        m_worker_pool->wait_for_all();
+        for (auto& error : errors) {
+            if (error.has_value())
+                return error.release_value();
         }
+    } else {
+        for (auto& column : tile_workloads)
+            TRY(decode_tile_column(column));
+    }
+
+    for (auto& column : tile_workloads) {
+        for (auto& tile_context : column)
+            m_syntax_element_counter->add_counts_from(tile_context.counter);
+    }
+    return {};
+}
+
+DecoderErrorOr<void> Parser::decode_tile_column(Vector<TileContext, 1>& tiles)
+{
+    for (auto& tile_context : tiles) {
+        TRY_READ(tile_context.bit_stream.init_bool(tile_context.bit_stream.bytes_remaining()));
+        TRY(decode_tile(tile_context));
+        TRY_READ(tile_context.bit_stream.exit_bool());
     }
     return {};
 }
@@ -924,7 +986,7 @@ DecoderErrorOr<void> Parser::decode_partition(TileContext& tile_context, u32 row
     bool has_cols = (column + half_block_8x8) < tile_context.frame_context.columns();
     u32 row_in_tile = row - tile_context.rows_start;
     u32 column_in_tile = column - tile_context.columns_start;
-    auto partition = TRY_READ(TreeParser::parse_partition(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter, has_rows, has_cols, subsize, num_8x8, tile_context.above_partition_context, tile_context.left_partition_context.span(), row_in_tile, column_in_tile, !tile_context.frame_context.is_inter_predicted()));
+    auto partition = TRY_READ(TreeParser::parse_partition(tile_context.bit_stream, *m_probability_tables, tile_context.counter, has_rows, has_cols, subsize, num_8x8, tile_context.above_partition_context, tile_context.left_partition_context.span(), row_in_tile, column_in_tile, !tile_context.frame_context.is_inter_predicted()));
 
     auto child_subsize = subsize_lookup[partition][subsize];
     if (child_subsize < Block_8x8 || partition == PartitionNone) {
@@ -1000,14 +1062,14 @@ DecoderErrorOr<void> Parser::intra_frame_mode_info(BlockContext& block_context,
     // FIXME: This if statement is also present in parse_default_intra_mode. The selection of parameters for
     //        the probability table lookup should be inlined here.
     if (block_context.size >= Block_8x8) {
-        auto mode = TRY_READ(TreeParser::parse_default_intra_mode(*m_bit_stream, *m_probability_tables, block_context.size, above_context, left_context, block_context.sub_block_prediction_modes, 0, 0));
+        auto mode = TRY_READ(TreeParser::parse_default_intra_mode(block_context.bit_stream, *m_probability_tables, block_context.size, above_context, left_context, block_context.sub_block_prediction_modes, 0, 0));
         for (auto& block_sub_mode : block_context.sub_block_prediction_modes)
             block_sub_mode = mode;
     } else {
         auto size_in_sub_blocks = block_context.get_size_in_sub_blocks();
         for (auto idy = 0; idy < 2; idy += size_in_sub_blocks.height()) {
             for (auto idx = 0; idx < 2; idx += size_in_sub_blocks.width()) {
-                auto sub_mode = TRY_READ(TreeParser::parse_default_intra_mode(*m_bit_stream, *m_probability_tables, block_context.size, above_context, left_context, block_context.sub_block_prediction_modes, idx, idy));
+                auto sub_mode = TRY_READ(TreeParser::parse_default_intra_mode(block_context.bit_stream, *m_probability_tables, block_context.size, above_context, left_context, block_context.sub_block_prediction_modes, idx, idy));
 
                 for (auto y = 0; y < size_in_sub_blocks.height(); y++) {
                     for (auto x = 0; x < size_in_sub_blocks.width(); x++) {
@@ -1018,14 +1080,14 @@ DecoderErrorOr<void> Parser::intra_frame_mode_info(BlockContext& block_context,
             }
         }
     }
-    block_context.uv_prediction_mode = TRY_READ(TreeParser::parse_default_uv_mode(*m_bit_stream, *m_probability_tables, block_context.y_prediction_mode()));
+    block_context.uv_prediction_mode = TRY_READ(TreeParser::parse_default_uv_mode(block_context.bit_stream, *m_probability_tables, block_context.y_prediction_mode()));
     return {};
 }
 
 DecoderErrorOr<void> Parser::set_intra_segment_id(BlockContext& block_context)
 {
     if (block_context.frame_context.segmentation_enabled && block_context.frame_context.use_full_segment_id_tree)
-        block_context.segment_id = TRY_READ(TreeParser::parse_segment_id(*m_bit_stream, block_context.frame_context.full_segment_id_tree_probabilities));
+        block_context.segment_id = TRY_READ(TreeParser::parse_segment_id(block_context.bit_stream, block_context.frame_context.full_segment_id_tree_probabilities));
     else
         block_context.segment_id = 0;
     return {};
@@ -1035,7 +1097,7 @@ DecoderErrorOr<bool> Parser::read_should_skip_residuals(BlockContext& block_cont
 {
     if (seg_feature_active(block_context, SEG_LVL_SKIP))
         return true;
-    return TRY_READ(TreeParser::parse_skip(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter, above_context, left_context));
+    return TRY_READ(TreeParser::parse_skip(block_context.bit_stream, *m_probability_tables, block_context.counter, above_context, left_context));
 }
 
 bool Parser::seg_feature_active(BlockContext const& block_context, u8 feature)
@@ -1047,7 +1109,7 @@ DecoderErrorOr<TransformSize> Parser::read_tx_size(BlockContext& block_context,
 {
     auto max_tx_size = max_txsize_lookup[block_context.size];
     if (allow_select && block_context.frame_context.transform_mode == TransformMode::Select && block_context.size >= Block_8x8)
-        return (TRY_READ(TreeParser::parse_tx_size(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter, max_tx_size, above_context, left_context)));
+        return (TRY_READ(TreeParser::parse_tx_size(block_context.bit_stream, *m_probability_tables, block_context.counter, max_tx_size, above_context, left_context)));
     return min(max_tx_size, tx_mode_to_biggest_tx_size[to_underlying(block_context.frame_context.transform_mode)]);
 }
 
@@ -1077,17 +1139,17 @@ DecoderErrorOr<void> Parser::set_inter_segment_id(BlockContext& block_context)
         return {};
     }
     if (!block_context.frame_context.use_predicted_segment_id_tree) {
-        block_context.segment_id = TRY_READ(TreeParser::parse_segment_id(*m_bit_stream, block_context.frame_context.full_segment_id_tree_probabilities));
+        block_context.segment_id = TRY_READ(TreeParser::parse_segment_id(block_context.bit_stream, block_context.frame_context.full_segment_id_tree_probabilities));
         return {};
     }
 
     auto above_segmentation_id = block_context.tile_context.above_segmentation_ids[block_context.row - block_context.tile_context.rows_start];
     auto left_segmentation_id = block_context.tile_context.left_segmentation_ids[block_context.column - block_context.tile_context.columns_start];
-    auto seg_id_predicted = TRY_READ(TreeParser::parse_segment_id_predicted(*m_bit_stream, block_context.frame_context.predicted_segment_id_tree_probabilities, above_segmentation_id, left_segmentation_id));
+    auto seg_id_predicted = TRY_READ(TreeParser::parse_segment_id_predicted(block_context.bit_stream, block_context.frame_context.predicted_segment_id_tree_probabilities, above_segmentation_id, left_segmentation_id));
     if (seg_id_predicted)
         block_context.segment_id = predicted_segment_id;
     else
-        block_context.segment_id = TRY_READ(TreeParser::parse_segment_id(*m_bit_stream, block_context.frame_context.full_segment_id_tree_probabilities));
+        block_context.segment_id = TRY_READ(TreeParser::parse_segment_id(block_context.bit_stream, block_context.frame_context.full_segment_id_tree_probabilities));
 
     // (7.4.1) AboveSegPredContext[ i ] only needs to be set to 0 for i = 0..MiCols-1.
     // This is taken care of by the slicing in BlockContext.
@@ -1117,7 +1179,7 @@ DecoderErrorOr<bool> Parser::read_is_inter(BlockContext& block_context, FrameBlo
 {
     if (seg_feature_active(block_context, SEG_LVL_REF_FRAME))
         return block_context.frame_context.segmentation_features[block_context.segment_id][SEG_LVL_REF_FRAME].value != ReferenceFrameType::None;
-    return TRY_READ(TreeParser::parse_block_is_inter_predicted(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter, above_context, left_context));
+    return TRY_READ(TreeParser::parse_block_is_inter_predicted(block_context.bit_stream, *m_probability_tables, block_context.counter, above_context, left_context));
 }
 
 DecoderErrorOr<void> Parser::intra_block_mode_info(BlockContext& block_context)
@@ -1126,14 +1188,14 @@ DecoderErrorOr<void> Parser::intra_block_mode_info(BlockContext& block_context)
     VERIFY(!block_context.is_inter_predicted());
     auto& sub_modes = block_context.sub_block_prediction_modes;
     if (block_context.size >= Block_8x8) {
-        auto mode = TRY_READ(TreeParser::parse_intra_mode(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter, block_context.size));
+        auto mode = TRY_READ(TreeParser::parse_intra_mode(block_context.bit_stream, *m_probability_tables, block_context.counter, block_context.size));
         for (auto& block_sub_mode : sub_modes)
             block_sub_mode = mode;
     } else {
         auto size_in_sub_blocks = block_context.get_size_in_sub_blocks();
         for (auto idy = 0; idy < 2; idy += size_in_sub_blocks.height()) {
             for (auto idx = 0; idx < 2; idx += size_in_sub_blocks.width()) {
-                auto sub_intra_mode = TRY_READ(TreeParser::parse_sub_intra_mode(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter));
+                auto sub_intra_mode = TRY_READ(TreeParser::parse_sub_intra_mode(block_context.bit_stream, *m_probability_tables, block_context.counter));
                 for (auto y = 0; y < size_in_sub_blocks.height(); y++) {
                     for (auto x = 0; x < size_in_sub_blocks.width(); x++)
                         sub_modes[(idy + y) * 2 + idx + x] = sub_intra_mode;
@@ -1141,7 +1203,7 @@ DecoderErrorOr<void> Parser::intra_block_mode_info(BlockContext& block_context)
             }
         }
     }
-    block_context.uv_prediction_mode = TRY_READ(TreeParser::parse_uv_mode(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter, block_context.y_prediction_mode()));
+    block_context.uv_prediction_mode = TRY_READ(TreeParser::parse_uv_mode(block_context.bit_stream, *m_probability_tables, block_context.counter, block_context.y_prediction_mode()));
     return {};
 }
 
@@ -1163,17 +1225,17 @@ DecoderErrorOr<void> Parser::inter_block_mode_info(BlockContext& block_context,
     if (seg_feature_active(block_context, SEG_LVL_SKIP)) {
         block_context.y_prediction_mode() = PredictionMode::ZeroMv;
     } else if (block_context.size >= Block_8x8) {
-        block_context.y_prediction_mode() = TRY_READ(TreeParser::parse_inter_mode(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter, block_context.mode_context[block_context.reference_frame_types.primary]));
+        block_context.y_prediction_mode() = TRY_READ(TreeParser::parse_inter_mode(block_context.bit_stream, *m_probability_tables, block_context.counter, block_context.mode_context[block_context.reference_frame_types.primary]));
     }
     if (block_context.frame_context.interpolation_filter == Switchable)
-        block_context.interpolation_filter = TRY_READ(TreeParser::parse_interpolation_filter(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter, above_context, left_context));
+        block_context.interpolation_filter = TRY_READ(TreeParser::parse_interpolation_filter(block_context.bit_stream, *m_probability_tables, block_context.counter, above_context, left_context));
     else
         block_context.interpolation_filter = block_context.frame_context.interpolation_filter;
     if (block_context.size < Block_8x8) {
         auto size_in_sub_blocks = block_context.get_size_in_sub_blocks();
         for (auto idy = 0; idy < 2; idy += size_in_sub_blocks.height()) {
             for (auto idx = 0; idx < 2; idx += size_in_sub_blocks.width()) {
-                block_context.y_prediction_mode() = TRY_READ(TreeParser::parse_inter_mode(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter, block_context.mode_context[block_context.reference_frame_types.primary]));
+                block_context.y_prediction_mode() = TRY_READ(TreeParser::parse_inter_mode(block_context.bit_stream, *m_probability_tables, block_context.counter, block_context.mode_context[block_context.reference_frame_types.primary]));
                 if (block_context.y_prediction_mode() == PredictionMode::NearestMv || block_context.y_prediction_mode() == PredictionMode::NearMv) {
                     select_best_sub_block_reference_motion_vectors(block_context, motion_vector_candidates, idy * 2 + idx, ReferenceIndex::Primary);
                     if (block_context.is_compound())
@@ -1206,7 +1268,7 @@ DecoderErrorOr<void> Parser::read_ref_frames(BlockContext& block_context, FrameB
     ReferenceMode compound_mode = block_context.frame_context.reference_mode;
     auto fixed_reference = block_context.frame_context.fixed_reference_type;
     if (compound_mode == ReferenceModeSelect)
-        compound_mode = TRY_READ(TreeParser::parse_comp_mode(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter, fixed_reference, above_context, left_context));
+        compound_mode = TRY_READ(TreeParser::parse_comp_mode(block_context.bit_stream, *m_probability_tables, block_context.counter, fixed_reference, above_context, left_context));
     if (compound_mode == CompoundReference) {
         auto variable_references = block_context.frame_context.variable_reference_types;
 
@@ -1215,7 +1277,7 @@ DecoderErrorOr<void> Parser::read_ref_frames(BlockContext& block_context, FrameB
         if (block_context.frame_context.reference_frame_sign_biases[fixed_reference])
             swap(fixed_reference_index, variable_reference_index);
 
-        auto variable_reference_selection = TRY_READ(TreeParser::parse_comp_ref(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter, fixed_reference, variable_references, variable_reference_index, above_context, left_context));
+        auto variable_reference_selection = TRY_READ(TreeParser::parse_comp_ref(block_context.bit_stream, *m_probability_tables, block_context.counter, fixed_reference, variable_references, variable_reference_index, above_context, left_context));
 
         block_context.reference_frame_types[fixed_reference_index] = fixed_reference;
         block_context.reference_frame_types[variable_reference_index] = variable_references[variable_reference_selection];
@@ -1224,9 +1286,9 @@ DecoderErrorOr<void> Parser::read_ref_frames(BlockContext& block_context, FrameB
 
     // FIXME: Maybe consolidate this into a tree. Context is different between part 1 and 2 but still, it would look nice here.
     ReferenceFrameType primary_type = ReferenceFrameType::LastFrame;
-    auto single_ref_p1 = TRY_READ(TreeParser::parse_single_ref_part_1(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter, above_context, left_context));
+    auto single_ref_p1 = TRY_READ(TreeParser::parse_single_ref_part_1(block_context.bit_stream, *m_probability_tables, block_context.counter, above_context, left_context));
     if (single_ref_p1) {
-        auto single_ref_p2 = TRY_READ(TreeParser::parse_single_ref_part_2(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter, above_context, left_context));
+        auto single_ref_p2 = TRY_READ(TreeParser::parse_single_ref_part_2(block_context.bit_stream, *m_probability_tables, block_context.counter, above_context, left_context));
         primary_type = single_ref_p2 ? ReferenceFrameType::AltRefFrame : ReferenceFrameType::GoldenFrame;
     }
     block_context.reference_frame_types = { primary_type, ReferenceFrameType::None };
@@ -1271,35 +1333,35 @@ DecoderErrorOr<MotionVector> Parser::read_motion_vector(BlockContext const& bloc
 {
     auto use_high_precision = block_context.frame_context.high_precision_motion_vectors_allowed && should_use_high_precision_motion_vector(candidates[reference_index].best_vector);
     MotionVector delta_vector;
-    auto joint = TRY_READ(TreeParser::parse_motion_vector_joint(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter));
+    auto joint = TRY_READ(TreeParser::parse_motion_vector_joint(block_context.bit_stream, *m_probability_tables, block_context.counter));
     if ((joint & MotionVectorNonZeroRow) != 0)
-        delta_vector.set_row(TRY(read_single_motion_vector_component(0, use_high_precision)));
+        delta_vector.set_row(TRY(read_single_motion_vector_component(block_context.bit_stream, block_context.counter, 0, use_high_precision)));
     if ((joint & MotionVectorNonZeroColumn) != 0)
-        delta_vector.set_column(TRY(read_single_motion_vector_component(1, use_high_precision)));
+        delta_vector.set_column(TRY(read_single_motion_vector_component(block_context.bit_stream, block_context.counter, 1, use_high_precision)));
 
     return candidates[reference_index].best_vector + delta_vector;
 }
 
 // read_mv_component( comp ) in the spec.
-DecoderErrorOr<i32> Parser::read_single_motion_vector_component(u8 component, bool use_high_precision)
+DecoderErrorOr<i32> Parser::read_single_motion_vector_component(BitStream& bit_stream, SyntaxElementCounter& counter, u8 component, bool use_high_precision)
 {
-    auto mv_sign = TRY_READ(TreeParser::parse_motion_vector_sign(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter, component));
-    auto mv_class = TRY_READ(TreeParser::parse_motion_vector_class(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter, component));
+    auto mv_sign = TRY_READ(TreeParser::parse_motion_vector_sign(bit_stream, *m_probability_tables, counter, component));
+    auto mv_class = TRY_READ(TreeParser::parse_motion_vector_class(bit_stream, *m_probability_tables, counter, component));
     u32 magnitude;
     if (mv_class == MvClass0) {
-        auto mv_class0_bit = TRY_READ(TreeParser::parse_motion_vector_class0_bit(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter, component));
-        auto mv_class0_fr = TRY_READ(TreeParser::parse_motion_vector_class0_fr(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter, component, mv_class0_bit));
-        auto mv_class0_hp = TRY_READ(TreeParser::parse_motion_vector_class0_hp(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter, component, use_high_precision));
+        auto mv_class0_bit = TRY_READ(TreeParser::parse_motion_vector_class0_bit(bit_stream, *m_probability_tables, counter, component));
+        auto mv_class0_fr = TRY_READ(TreeParser::parse_motion_vector_class0_fr(bit_stream, *m_probability_tables, counter, component, mv_class0_bit));
+        auto mv_class0_hp = TRY_READ(TreeParser::parse_motion_vector_class0_hp(bit_stream, *m_probability_tables, counter, component, use_high_precision));
         magnitude = ((mv_class0_bit << 3) | (mv_class0_fr << 1) | mv_class0_hp) + 1;
     } else {
         u32 bits = 0;
         for (u8 i = 0; i < mv_class; i++) {
-            auto mv_bit = TRY_READ(TreeParser::parse_motion_vector_bit(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter, component, i));
+            auto mv_bit = TRY_READ(TreeParser::parse_motion_vector_bit(bit_stream, *m_probability_tables, counter, component, i));
             bits |= mv_bit << i;
         }
         magnitude = CLASS0_SIZE << (mv_class + 2);
-        auto mv_fr = TRY_READ(TreeParser::parse_motion_vector_fr(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter, component));
-        auto mv_hp = TRY_READ(TreeParser::parse_motion_vector_hp(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter, component, use_high_precision));
+        auto mv_fr = TRY_READ(TreeParser::parse_motion_vector_fr(bit_stream, *m_probability_tables, counter, component));
+        auto mv_hp = TRY_READ(TreeParser::parse_motion_vector_hp(bit_stream, *m_probability_tables, counter, component, use_high_precision));
         magnitude += ((bits << 3) | (mv_fr << 1) | mv_hp) + 1;
     }
     return (mv_sign ? -1 : 1) * static_cast<i32>(magnitude);
@@ -1449,10 +1511,10 @@ DecoderErrorOr<bool> Parser::tokens(BlockContext& block_context, size_t plane, u
         else
             tokens_context = TreeParser::get_context_for_other_tokens(token_cache, transform_size, transform_set, plane, token_position, block_context.is_inter_predicted(), band);
 
-        if (check_for_more_coefficients && !TRY_READ(TreeParser::parse_more_coefficients(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter, tokens_context)))
+        if (check_for_more_coefficients && !TRY_READ(TreeParser::parse_more_coefficients(block_context.bit_stream, *m_probability_tables, block_context.counter, tokens_context)))
             break;
 
-        auto token = TRY_READ(TreeParser::parse_token(*m_bit_stream, *m_probability_tables, *m_syntax_element_counter, tokens_context));
+        auto token = TRY_READ(TreeParser::parse_token(block_context.bit_stream, *m_probability_tables, block_context.counter, tokens_context));
         token_cache[token_position] = energy_class[token];
 
         i32 coef;
@@ -1460,7 +1522,7 @@ DecoderErrorOr<bool> Parser::tokens(BlockContext& block_context, size_t plane, u
             coef = 0;
             check_for_more_coefficients = false;
         } else {
-            coef = TRY(read_coef(block_context.frame_context.color_config.bit_depth, token));
+            coef = TRY(read_coef(block_context.bit_stream, block_context.frame_context.color_config.bit_depth, token));
             check_for_more_coefficients = true;
         }
         block_context.residual_tokens[token_position] = coef;
@@ -1469,22 +1531,22 @@ DecoderErrorOr<bool> Parser::tokens(BlockContext& block_context, size_t plane, u
     return coef_index > 0;
 }
 
-DecoderErrorOr<i32> Parser::read_coef(u8 bit_depth, Token token)
+DecoderErrorOr<i32> Parser::read_coef(BitStream& bit_stream, u8 bit_depth, Token token)
 {
     auto cat = extra_bits[token][0];
     auto num_extra = extra_bits[token][1];
     i32 coef = extra_bits[token][2];
     if (token == DctValCat6) {
         for (size_t e = 0; e < (u8)(bit_depth - 8); e++) {
-            auto high_bit = TRY_READ(m_bit_stream->read_bool(255));
+            auto high_bit = TRY_READ(bit_stream.read_bool(255));
             coef += high_bit << (5 + bit_depth - e);
         }
     }
     for (size_t e = 0; e < num_extra; e++) {
-        auto coef_bit = TRY_READ(m_bit_stream->read_bool(cat_probs[cat][e]));
+        auto coef_bit = TRY_READ(bit_stream.read_bool(cat_probs[cat][e]));
         coef += coef_bit << (num_extra - 1 - e);
     }
-    bool sign_bit = TRY_READ(m_bit_stream->read_literal(1));
+    bool sign_bit = TRY_READ(bit_stream.read_literal(1));
     coef = sign_bit ? -coef : coef;
     return coef;
 }
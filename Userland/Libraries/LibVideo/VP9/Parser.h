@@ -10,6 +10,8 @@
 #include <AK/Array.h>
 #include <AK/OwnPtr.h>
 #include <AK/Span.h>
+#include <AK/Vector.h>
+#include <LibThreading/ThreadPool.h>
 #include <LibGfx/Size.h>
 #include <LibVideo/Color/CodingIndependentCodePoints.h>
 #include <LibVideo/DecoderError.h>
@@ -91,7 +93,8 @@ private:
     DecoderErrorOr<u8> update_mv_prob(u8 prob);
 
     /* (6.4) Decode Tiles Syntax */
-    DecoderErrorOr<void> decode_tiles(FrameContext&);
+    DecoderErrorOr<void> decode_tiles(FrameContext&, ReadonlyBytes tile_data);
+    DecoderErrorOr<void> decode_tile_column(Vector<TileContext, 1>&);
     DecoderErrorOr<void> decode_tile(TileContext&);
     void clear_left_context(TileContext&);
     DecoderErrorOr<void> decode_partition(TileContext&, u32 row, u32 column, BlockSubsize subsize);
@@ -111,10 +114,10 @@ private:
     DecoderErrorOr<void> read_ref_frames(BlockContext&, FrameBlockContext above_context, FrameBlockContext left_context);
     DecoderErrorOr<MotionVectorPair> get_motion_vector(BlockContext const&, BlockMotionVectorCandidates const&);
     DecoderErrorOr<MotionVector> read_motion_vector(BlockContext const&, BlockMotionVectorCandidates const&, ReferenceIndex);
-    DecoderErrorOr<i32> read_single_motion_vector_component(u8 component, bool use_high_precision);
+    DecoderErrorOr<i32> read_single_motion_vector_component(BitStream&, SyntaxElementCounter&, u8 component, bool use_high_precision);
     DecoderErrorOr<bool> residual(BlockContext&, bool has_block_above, bool has_block_left);
     DecoderErrorOr<bool> tokens(BlockContext&, size_t plane, u32 x, u32 y, TransformSize, TransformSet, Array<u8, 1024> token_cache);
-    DecoderErrorOr<i32> read_coef(u8 bit_depth, Token token);
+    DecoderErrorOr<i32> read_coef(BitStream&, u8 bit_depth, Token token);
 
     /* (6.5) Motion Vector Prediction */
     MotionVectorPair find_reference_motion_vectors(BlockContext&, ReferenceFrameType, i32 block);
@@ -146,6 +149,10 @@ private:
     OwnPtr<ProbabilityTables> m_probability_tables;
     OwnPtr<SyntaxElementCounter> m_syntax_element_counter;
     Decoder& m_decoder;
+
+    // Created lazily the first time a frame with more than one tile column is
+    // decoded; the columns are then decoded in parallel on this pool.
+    OwnPtr<Threading::ThreadPool> m_worker_pool;
 };
 
 }
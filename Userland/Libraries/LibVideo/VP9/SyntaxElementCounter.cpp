@@ -34,4 +34,39 @@ void SyntaxElementCounter::clear_counts()
     __builtin_memset(m_counts_more_coefs, 0, TX_SIZES * BLOCK_TYPES * REF_TYPES * COEF_BANDS * PREV_COEF_CONTEXTS * 2);
 }
 
+template<typename T>
+static void sum_counts(T& destination, T const& source)
+{
+    auto* to = reinterpret_cast<u8*>(&destination);
+    auto const* from = reinterpret_cast<u8 const*>(&source);
+    for (size_t i = 0; i < sizeof(T); i++)
+        to[i] += from[i];
+}
+
+void SyntaxElementCounter::add_counts_from(SyntaxElementCounter const& other)
+{
+    sum_counts(m_counts_intra_mode, other.m_counts_intra_mode);
+    sum_counts(m_counts_uv_mode, other.m_counts_uv_mode);
+    sum_counts(m_counts_partition, other.m_counts_partition);
+    sum_counts(m_counts_interp_filter, other.m_counts_interp_filter);
+    sum_counts(m_counts_inter_mode, other.m_counts_inter_mode);
+    sum_counts(m_counts_tx_size, other.m_counts_tx_size);
+    sum_counts(m_counts_is_inter, other.m_counts_is_inter);
+    sum_counts(m_counts_comp_mode, other.m_counts_comp_mode);
+    sum_counts(m_counts_single_ref, other.m_counts_single_ref);
+    sum_counts(m_counts_comp_ref, other.m_counts_comp_ref);
+    sum_counts(m_counts_skip, other.m_counts_skip);
+    sum_counts(m_counts_mv_joint, other.m_counts_mv_joint);
+    sum_counts(m_counts_mv_sign, other.m_counts_mv_sign);
+    sum_counts(m_counts_mv_class, other.m_counts_mv_class);
+    sum_counts(m_counts_mv_class0_bit, other.m_counts_mv_class0_bit);
+    sum_counts(m_counts_mv_class0_fr, other.m_counts_mv_class0_fr);
+    sum_counts(m_counts_mv_class0_hp, other.m_counts_mv_class0_hp);
+    sum_counts(m_counts_mv_bits, other.m_counts_mv_bits);
+    sum_counts(m_counts_mv_fr, other.m_counts_mv_fr);
+    sum_counts(m_counts_mv_hp, other.m_counts_mv_hp);
+    sum_counts(m_counts_token, other.m_counts_token);
+    sum_counts(m_counts_more_coefs, other.m_counts_more_coefs);
+}
+
 }
@@ -16,6 +16,11 @@ public:
     /* (8.3) Clear Counts Process */
     void clear_counts();
 
+    // Sums the counts from another counter into this one. This is used to
+    // merge the per-tile counters into the frame's counter after all tiles
+    // have been decoded, possibly on different threads.
+    void add_counts_from(SyntaxElementCounter const&);
+
     u8 m_counts_intra_mode[BLOCK_SIZE_GROUPS][INTRA_MODES];
     u8 m_counts_uv_mode[INTRA_MODES][INTRA_MODES];
     u8 m_counts_partition[PARTITION_CONTEXTS][PARTITION_TYPES];
@@ -70,7 +70,7 @@ public:
     {
     }
 
-    using AnyValueType = Variant<i32, i64, float, double, Reference>;
+    using AnyValueType = Variant<i32, i64, float, double, u128, Reference>;
     explicit Value(AnyValueType value)
         : m_value(move(value))
     {
@@ -99,6 +99,9 @@ public:
         case ValueType::Kind::F64:
             m_value = bit_cast<double>(raw_value);
             break;
+        case ValueType::Kind::V128:
+            m_value = u128(bit_cast<u64>(raw_value), 0ull);
+            break;
         case ValueType::Kind::NullFunctionReference:
             VERIFY(raw_value == 0);
             m_value = Reference { Reference::Null { ValueType(ValueType::Kind::FunctionReference) } };
@@ -152,6 +155,7 @@ public:
             [](i64) { return ValueType::Kind::I64; },
             [](float) { return ValueType::Kind::F32; },
             [](double) { return ValueType::Kind::F64; },
+            [](u128) { return ValueType::Kind::V128; },
             [&](Reference const& type) {
                 return type.ref().visit(
                     [](Reference::Func const&) { return ValueType::Kind::FunctionReference; },
@@ -462,17 +466,22 @@ private:
 
 class Label {
 public:
-    explicit Label(size_t arity, InstructionPointer continuation)
+    explicit Label(size_t arity, InstructionPointer continuation, size_t stack_height)
         : m_arity(arity)
+        , m_stack_height(stack_height)
         , m_continuation(continuation)
     {
     }
 
     auto continuation() const { return m_continuation; }
     auto arity() const { return m_arity; }
+    // The height the value stack had when this label was entered; branching to
+    // the label drops every value pushed above it.
+    auto stack_height() const { return m_stack_height; }
 
 private:
     size_t m_arity { 0 };
+    size_t m_stack_height { 0 };
     InstructionPointer m_continuation { 0 };
 };
 
@@ -491,21 +500,28 @@ public:
     auto& locals() { return m_locals; }
     auto& expression() const { return m_expression; }
     auto arity() const { return m_arity; }
+    // The index of this frame's function label on the label stack; everything
+    // above it belongs to this invocation.
+    auto label_index() const { return m_label_index; }
+    void set_label_index(size_t index) { m_label_index = index; }
 
 private:
     ModuleInstance const& m_module;
     Vector<Value> m_locals;
     Expression const& m_expression;
     size_t m_arity { 0 };
+    size_t m_label_index { 0 };
 };
 
+// The value stack; labels and frames are kept on their own stacks in the
+// Configuration so that value pushes and pops stay small and branches don't
+// have to search through mixed entries.
 class Stack {
 public:
-    using EntryType = Variant<Value, Label, Frame>;
     Stack() = default;
 
     [[nodiscard]] ALWAYS_INLINE bool is_empty() const { return m_data.is_empty(); }
-    ALWAYS_INLINE void push(EntryType entry) { m_data.append(move(entry)); }
+    ALWAYS_INLINE void push(Value value) { m_data.append(move(value)); }
     ALWAYS_INLINE auto pop() { return m_data.take_last(); }
     ALWAYS_INLINE auto& peek() const { return m_data.last(); }
     ALWAYS_INLINE auto& peek() { return m_data.last(); }
@@ -515,7 +531,7 @@ public:
     ALWAYS_INLINE auto& entries() { return m_data; }
 
 private:
-    Vector<EntryType, 1024> m_data;
+    Vector<Value, 1024> m_data;
 };
 
 using InstantiationResult = AK::Result<NonnullOwnPtr<ModuleInstance>, InstantiationError>;
@@ -22,13 +22,6 @@ namespace Wasm {
         }                                                                                      \
     } while (false)
 
-#define TRAP_IF_NOT_NORETURN(x)                                                                \
-    do {                                                                                       \
-        if (trap_if_not(x, #x##sv)) {                                                          \
-            dbgln_if(WASM_TRACE_DEBUG, "Trapped because {} failed, at line {}", #x, __LINE__); \
-        }                                                                                      \
-    } while (false)
-
 void BytecodeInterpreter::interpret(Configuration& configuration)
 {
     m_trap.clear();
@@ -60,20 +53,14 @@ void BytecodeInterpreter::branch_to_label(Configuration& configuration, LabelInd
     dbgln_if(WASM_TRACE_DEBUG, "Branch to label with index {}...", index.value());
     auto label = configuration.nth_label(index.value());
     dbgln_if(WASM_TRACE_DEBUG, "...which is actually IP {}, and has {} result(s)", label->continuation().value(), label->arity());
-    auto results = pop_values(configuration, label->arity());
-
-    size_t drop_count = index.value() + 1;
-    for (; !configuration.stack().is_empty();) {
-        auto& entry = configuration.stack().peek();
-        if (entry.has<Label>()) {
-            if (--drop_count == 0)
-                break;
-        }
-        configuration.stack().pop();
-    }
 
+    // Drop every value pushed since the label was entered, and the labels
+    // nested inside it; the target label itself stays for the next branch.
+    auto results = pop_values(configuration, label->arity());
+    configuration.stack().entries().shrink(label->stack_height());
     for (auto& result : results)
         configuration.stack().push(move(result));
+    configuration.label_stack().shrink(configuration.label_stack().size() - index.value());
 
     configuration.ip() = label->continuation();
 }
@@ -88,8 +75,7 @@ void BytecodeInterpreter::load_and_push(Configuration& configuration, Instructio
         return;
     }
     auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
-    auto& entry = configuration.stack().peek();
-    auto base = entry.get<Value>().to<i32>();
+    auto base = configuration.stack().peek().to<i32>();
     if (!base.has_value()) {
         m_trap = Trap { "Memory access out of bounds" };
         return;
@@ -114,17 +100,14 @@ void BytecodeInterpreter::call_address(Configuration& configuration, FunctionAdd
     auto instance = configuration.store().get(address);
     FunctionType const* type { nullptr };
     instance->visit([&](auto const& function) { type = &function.type(); });
-    TRAP_IF_NOT(configuration.stack().entries().size() > type->parameters().size());
+    TRAP_IF_NOT(configuration.stack().entries().size() >= type->parameters().size());
     Vector<Value> args;
     args.ensure_capacity(type->parameters().size());
     auto span = configuration.stack().entries().span().slice_from_end(type->parameters().size());
-    for (auto& entry : span) {
-        auto* call_argument = entry.get_pointer<Value>();
-        TRAP_IF_NOT(call_argument);
-        args.unchecked_append(move(*call_argument));
-    }
+    for (auto& value : span)
+        args.unchecked_append(move(value));
 
-    configuration.stack().entries().remove(configuration.stack().size() - span.size(), span.size());
+    configuration.stack().entries().shrink(configuration.stack().size() - span.size());
 
     Result result { Trap { ""sv } };
     {
@@ -138,19 +121,39 @@ void BytecodeInterpreter::call_address(Configuration& configuration, FunctionAdd
     }
 
     configuration.stack().entries().ensure_capacity(configuration.stack().size() + result.values().size());
-    for (auto& entry : result.values().in_reverse())
-        configuration.stack().entries().unchecked_append(move(entry));
+    for (auto& value : result.values().in_reverse())
+        configuration.stack().entries().unchecked_append(move(value));
 }
 
 template<typename PopType, typename PushType, typename Operator>
 void BytecodeInterpreter::binary_numeric_operation(Configuration& configuration)
 {
-    auto rhs_entry = configuration.stack().pop();
+    auto rhs_value = configuration.stack().pop();
     auto& lhs_entry = configuration.stack().peek();
-    auto rhs_ptr = rhs_entry.get_pointer<Value>();
-    auto lhs_ptr = lhs_entry.get_pointer<Value>();
-    auto rhs = rhs_ptr->to<PopType>();
-    auto lhs = lhs_ptr->to<PopType>();
+    auto rhs = rhs_value.to<PopType>();
+    auto lhs = lhs_entry.to<PopType>();
+    PushType result;
+    auto call_result = Operator {}(lhs.value(), rhs.value());
+    if constexpr (IsSpecializationOf<decltype(call_result), AK::Result>) {
+        if (call_result.is_error()) {
+            trap_if_not(false, call_result.error());
+            return;
+        }
+        result = call_result.release_value();
+    } else {
+        result = call_result;
+    }
+    dbgln_if(WASM_TRACE_DEBUG, "{} {} {} = {}", lhs.value(), Operator::name(), rhs.value(), result);
+    lhs_entry = Value(result);
+}
+
+template<typename PopTypeLhs, typename PopTypeRhs, typename PushType, typename Operator>
+void BytecodeInterpreter::binary_numeric_operation(Configuration& configuration)
+{
+    auto rhs_value = configuration.stack().pop();
+    auto& lhs_entry = configuration.stack().peek();
+    auto rhs = rhs_value.to<PopTypeRhs>();
+    auto lhs = lhs_entry.to<PopTypeLhs>();
     PushType result;
     auto call_result = Operator {}(lhs.value(), rhs.value());
     if constexpr (IsSpecializationOf<decltype(call_result), AK::Result>) {
@@ -170,8 +173,7 @@ template<typename PopType, typename PushType, typename Operator>
 void BytecodeInterpreter::unary_operation(Configuration& configuration)
 {
     auto& entry = configuration.stack().peek();
-    auto entry_ptr = entry.get_pointer<Value>();
-    auto value = entry_ptr->to<PopType>();
+    auto value = entry.to<PopType>();
     auto call_result = Operator {}(*value);
     PushType result;
     if constexpr (IsSpecializationOf<decltype(call_result), AK::Result>) {
@@ -187,6 +189,26 @@ void BytecodeInterpreter::unary_operation(Configuration& configuration)
     entry = Value(result);
 }
 
+template<typename LaneType, typename PushType>
+void BytecodeInterpreter::vector_extract_lane(Configuration& configuration, Instruction const& instruction)
+{
+    auto lane = instruction.arguments().get<Instruction::LaneIndex>().lane;
+    auto& entry = configuration.stack().peek();
+    auto lanes = bit_cast<Array<LaneType, sizeof(u128) / sizeof(LaneType)>>(*entry.to<u128>());
+    entry = Value(static_cast<PushType>(lanes[lane]));
+}
+
+template<typename PopType, typename LaneType>
+void BytecodeInterpreter::vector_replace_lane(Configuration& configuration, Instruction const& instruction)
+{
+    auto lane = instruction.arguments().get<Instruction::LaneIndex>().lane;
+    auto new_value = static_cast<LaneType>(*configuration.stack().pop().to<PopType>());
+    auto& entry = configuration.stack().peek();
+    auto lanes = bit_cast<Array<LaneType, sizeof(u128) / sizeof(LaneType)>>(*entry.to<u128>());
+    lanes[lane] = new_value;
+    entry = Value(bit_cast<u128>(lanes));
+}
+
 template<typename T>
 struct ConvertToRaw {
     T operator()(T value)
@@ -221,14 +243,20 @@ struct ConvertToRaw<double> {
     }
 };
 
+template<>
+struct ConvertToRaw<u128> {
+    u128 operator()(u128 value)
+    {
+        return u128(static_cast<u64>(LittleEndian<u64>(value.low())), static_cast<u64>(LittleEndian<u64>(value.high())));
+    }
+};
+
 template<typename PopT, typename StoreT>
 void BytecodeInterpreter::pop_and_store(Configuration& configuration, Instruction const& instruction)
 {
-    auto entry = configuration.stack().pop();
-    auto value = ConvertToRaw<StoreT> {}(*entry.get<Value>().to<PopT>());
+    auto value = ConvertToRaw<StoreT> {}(*configuration.stack().pop().to<PopT>());
     dbgln_if(WASM_TRACE_DEBUG, "stack({}) -> temporary({}b)", value, sizeof(StoreT));
-    auto base_entry = configuration.stack().pop();
-    auto base = base_entry.get<Value>().to<i32>();
+    auto base = configuration.stack().pop().to<i32>();
     store_to_memory(configuration, instruction, { &value, sizeof(StoreT) }, *base);
 }
 
@@ -284,6 +312,18 @@ double BytecodeInterpreter::read_value<double>(ReadonlyBytes data)
     return bit_cast<double>(static_cast<u64>(raw_value));
 }
 
+template<>
+u128 BytecodeInterpreter::read_value<u128>(ReadonlyBytes data)
+{
+    InputMemoryStream stream { data };
+    LittleEndian<u64> low;
+    LittleEndian<u64> high;
+    stream >> low >> high;
+    if (stream.handle_any_error())
+        m_trap = Trap { "Read from memory failed" };
+    return u128(static_cast<u64>(low), static_cast<u64>(high));
+}
+
 template<typename V, typename T>
 MakeSigned<T> BytecodeInterpreter::checked_signed_truncate(V value)
 {
@@ -332,15 +372,10 @@ MakeUnsigned<T> BytecodeInterpreter::checked_unsigned_truncate(V value)
 Vector<Value> BytecodeInterpreter::pop_values(Configuration& configuration, size_t count)
 {
     Vector<Value> results;
-    results.resize(count);
+    results.ensure_capacity(count);
 
-    for (size_t i = 0; i < count; ++i) {
-        auto top_of_stack = configuration.stack().pop();
-        if (auto value = top_of_stack.get_pointer<Value>())
-            results[i] = move(*value);
-        else
-            TRAP_IF_NOT_NORETURN(value);
-    }
+    for (size_t i = 0; i < count; ++i)
+        results.unchecked_append(configuration.stack().pop());
     return results;
 }
 
@@ -358,8 +393,7 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
         configuration.stack().push(Value(configuration.frame().locals()[instruction.arguments().get<LocalIndex>().value()]));
         return;
     case Instructions::local_set.value(): {
-        auto entry = configuration.stack().pop();
-        configuration.frame().locals()[instruction.arguments().get<LocalIndex>().value()] = move(entry.get<Value>());
+        configuration.frame().locals()[instruction.arguments().get<LocalIndex>().value()] = configuration.stack().pop();
         return;
     }
     case Instructions::i32_const.value():
@@ -391,7 +425,7 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
         }
         }
 
-        configuration.stack().entries().insert(configuration.stack().size() - parameter_count, Label(arity, args.end_ip));
+        configuration.label_stack().append(Label(arity, args.end_ip, configuration.stack().size() - parameter_count));
         return;
     }
     case Instructions::loop.value(): {
@@ -411,7 +445,7 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
         }
         }
 
-        configuration.stack().entries().insert(configuration.stack().size() - parameter_count, Label(arity, ip.value() + 1));
+        configuration.label_stack().append(Label(arity, ip.value() + 1, configuration.stack().size() - parameter_count));
         return;
     }
     case Instructions::if_.value(): {
@@ -431,26 +465,23 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
         }
         }
 
-        auto entry = configuration.stack().pop();
-        auto value = entry.get<Value>().to<i32>();
-        auto end_label = Label(arity, args.end_ip.value());
+        auto value = configuration.stack().pop().to<i32>();
+        auto end_label = Label(arity, args.end_ip.value(), configuration.stack().size() - parameter_count);
         if (value.value() == 0) {
             if (args.else_ip.has_value()) {
                 configuration.ip() = args.else_ip.value();
-                configuration.stack().entries().insert(configuration.stack().size() - parameter_count, end_label);
+                configuration.label_stack().append(end_label);
             } else {
                 configuration.ip() = args.end_ip.value() + 1;
             }
         } else {
-            configuration.stack().entries().insert(configuration.stack().size() - parameter_count, end_label);
+            configuration.label_stack().append(end_label);
         }
         return;
     }
     case Instructions::structured_end.value():
     case Instructions::structured_else.value(): {
-        auto index = configuration.nth_label_index(0);
-        auto label = configuration.stack().entries()[*index].get<Label>();
-        configuration.stack().entries().remove(*index, 1);
+        auto label = configuration.label_stack().take_last();
 
         if (instruction.opcode() == Instructions::structured_end)
             return;
@@ -465,17 +496,14 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
         checked_index -= frame.arity();
         VERIFY(!checked_index.has_overflow());
 
-        auto index = checked_index.value();
-        size_t i = 1;
-        for (; i <= index; ++i) {
-            auto& entry = configuration.stack().entries()[index - i];
-            if (entry.has<Label>()) {
-                if (configuration.stack().entries()[index - i - 1].has<Frame>())
-                    break;
-            }
-        }
-
-        configuration.stack().entries().remove(index - i + 1, i - 1);
+        // Drop every value and label pushed since the function was entered;
+        // the function label itself stays, Configuration::execute() pops it.
+        auto& function_label = configuration.label_stack()[frame.label_index()];
+        auto results = pop_values(configuration, frame.arity());
+        configuration.stack().entries().shrink(function_label.stack_height());
+        for (auto& result : results.in_reverse())
+            configuration.stack().push(move(result));
+        configuration.label_stack().shrink(frame.label_index() + 1);
 
         // Jump past the call/indirect instruction
         configuration.ip() = configuration.frame().expression().instructions().size();
@@ -484,15 +512,13 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
     case Instructions::br.value():
         return branch_to_label(configuration, instruction.arguments().get<LabelIndex>());
     case Instructions::br_if.value(): {
-        auto entry = configuration.stack().pop();
-        if (entry.get<Value>().to<i32>().value_or(0) == 0)
+        if (configuration.stack().pop().to<i32>().value_or(0) == 0)
             return;
         return branch_to_label(configuration, instruction.arguments().get<LabelIndex>());
     }
     case Instructions::br_table.value(): {
         auto& arguments = instruction.arguments().get<Instruction::TableBranchArgs>();
-        auto entry = configuration.stack().pop();
-        auto maybe_i = entry.get<Value>().to<i32>();
+        auto maybe_i = configuration.stack().pop().to<i32>();
         if (0 <= *maybe_i) {
             size_t i = *maybe_i;
             if (i < arguments.labels.size())
@@ -511,8 +537,7 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
         auto& args = instruction.arguments().get<Instruction::IndirectCallArgs>();
         auto table_address = configuration.frame().module().tables()[args.table.value()];
         auto table_instance = configuration.store().get(table_address);
-        auto entry = configuration.stack().pop();
-        auto index = entry.get<Value>().to<i32>();
+        auto index = configuration.stack().pop().to<i32>();
         TRAP_IF_NOT(index.value() >= 0);
         TRAP_IF_NOT(static_cast<size_t>(index.value()) < table_instance->elements().size());
         auto element = table_instance->elements()[index.value()];
@@ -570,8 +595,7 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
     case Instructions::i64_store32.value():
         return pop_and_store<i64, i32>(configuration, instruction);
     case Instructions::local_tee.value(): {
-        auto& entry = configuration.stack().peek();
-        auto value = entry.get<Value>();
+        auto value = configuration.stack().peek();
         auto local_index = instruction.arguments().get<LocalIndex>();
         dbgln_if(WASM_TRACE_DEBUG, "stack:peek -> locals({})", local_index.value());
         configuration.frame().locals()[local_index.value()] = move(value);
@@ -588,8 +612,7 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
     case Instructions::global_set.value(): {
         auto global_index = instruction.arguments().get<GlobalIndex>();
         auto address = configuration.frame().module().globals()[global_index.value()];
-        auto entry = configuration.stack().pop();
-        auto value = entry.get<Value>();
+        auto value = configuration.stack().pop();
         dbgln_if(WASM_TRACE_DEBUG, "stack -> global({})", address.value());
         auto global = configuration.store().get(address);
         global->set_value(move(value));
@@ -607,8 +630,7 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
         auto address = configuration.frame().module().memories()[0];
         auto instance = configuration.store().get(address);
         i32 old_pages = instance->size() / Constants::page_size;
-        auto& entry = configuration.stack().peek();
-        auto new_pages = entry.get<Value>().to<i32>();
+        auto new_pages = configuration.stack().peek().to<i32>();
         dbgln_if(WASM_TRACE_DEBUG, "memory.grow({}), previously {} pages...", *new_pages, old_pages);
         if (instance->grow(new_pages.value() * Constants::page_size))
             configuration.stack().peek() = Value((i32)old_pages);
@@ -632,9 +654,9 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
         return;
     }
     case Instructions::ref_is_null.value(): {
-        auto top = configuration.stack().peek().get_pointer<Value>();
-        TRAP_IF_NOT(top->type().is_reference());
-        auto is_null = top->to<Reference::Null>().has_value();
+        auto& top = configuration.stack().peek();
+        TRAP_IF_NOT(top.type().is_reference());
+        auto is_null = top.to<Reference::Null>().has_value();
         configuration.stack().peek() = Value(ValueType(ValueType::I32), static_cast<u64>(is_null ? 1 : 0));
         return;
     }
@@ -644,14 +666,11 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
     case Instructions::select.value():
     case Instructions::select_typed.value(): {
         // Note: The type seems to only be used for validation.
-        auto entry = configuration.stack().pop();
-        auto value = entry.get<Value>().to<i32>();
+        auto value = configuration.stack().pop().to<i32>();
         dbgln_if(WASM_TRACE_DEBUG, "select({})", value.value());
-        auto rhs_entry = configuration.stack().pop();
-        auto& lhs_entry = configuration.stack().peek();
-        auto rhs = move(rhs_entry.get<Value>());
-        auto lhs = move(lhs_entry.get<Value>());
-        configuration.stack().peek() = value.value() != 0 ? move(lhs) : move(rhs);
+        auto rhs = configuration.stack().pop();
+        if (value.value() == 0)
+            configuration.stack().peek() = move(rhs);
         return;
     }
     case Instructions::i32_eqz.value():
@@ -926,13 +945,383 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
         return unary_operation<double, i64, Operators::SaturatingTruncate<i64>>(configuration);
     case Instructions::i64_trunc_sat_f64_u.value():
         return unary_operation<double, i64, Operators::SaturatingTruncate<u64>>(configuration);
+    case Instructions::v128_load.value():
+        return load_and_push<u128, u128>(configuration, instruction);
+    case Instructions::v128_store.value():
+        return pop_and_store<u128, u128>(configuration, instruction);
+    case Instructions::v128_const.value(): {
+        configuration.stack().push(Value(instruction.arguments().get<u128>()));
+        return;
+    }
+    case Instructions::i8x16_shuffle.value(): {
+        auto& args = instruction.arguments().get<Instruction::ShuffleArgs>();
+        auto rhs = bit_cast<Array<u8, 16>>(*configuration.stack().pop().to<u128>());
+        auto& lhs_entry = configuration.stack().peek();
+        auto lhs = bit_cast<Array<u8, 16>>(*lhs_entry.to<u128>());
+        Array<u8, 16> result;
+        for (size_t i = 0; i < 16; ++i)
+            result[i] = args.lanes[i] < 16 ? lhs[args.lanes[i]] : rhs[args.lanes[i] - 16];
+        lhs_entry = Value(bit_cast<u128>(result));
+        return;
+    }
+    case Instructions::i8x16_swizzle.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorSwizzle>(configuration);
+    case Instructions::i8x16_splat.value():
+        return unary_operation<i32, u128, Operators::VectorSplat<u8>>(configuration);
+    case Instructions::i16x8_splat.value():
+        return unary_operation<i32, u128, Operators::VectorSplat<u16>>(configuration);
+    case Instructions::i32x4_splat.value():
+        return unary_operation<i32, u128, Operators::VectorSplat<u32>>(configuration);
+    case Instructions::i64x2_splat.value():
+        return unary_operation<i64, u128, Operators::VectorSplat<u64>>(configuration);
+    case Instructions::f32x4_splat.value():
+        return unary_operation<float, u128, Operators::VectorSplat<float>>(configuration);
+    case Instructions::f64x2_splat.value():
+        return unary_operation<double, u128, Operators::VectorSplat<double>>(configuration);
+    case Instructions::i8x16_extract_lane_s.value():
+        return vector_extract_lane<i8, i32>(configuration, instruction);
+    case Instructions::i8x16_extract_lane_u.value():
+        return vector_extract_lane<u8, i32>(configuration, instruction);
+    case Instructions::i16x8_extract_lane_s.value():
+        return vector_extract_lane<i16, i32>(configuration, instruction);
+    case Instructions::i16x8_extract_lane_u.value():
+        return vector_extract_lane<u16, i32>(configuration, instruction);
+    case Instructions::i32x4_extract_lane.value():
+        return vector_extract_lane<i32, i32>(configuration, instruction);
+    case Instructions::i64x2_extract_lane.value():
+        return vector_extract_lane<i64, i64>(configuration, instruction);
+    case Instructions::f32x4_extract_lane.value():
+        return vector_extract_lane<float, float>(configuration, instruction);
+    case Instructions::f64x2_extract_lane.value():
+        return vector_extract_lane<double, double>(configuration, instruction);
+    case Instructions::i8x16_replace_lane.value():
+        return vector_replace_lane<i32, u8>(configuration, instruction);
+    case Instructions::i16x8_replace_lane.value():
+        return vector_replace_lane<i32, u16>(configuration, instruction);
+    case Instructions::i32x4_replace_lane.value():
+        return vector_replace_lane<i32, u32>(configuration, instruction);
+    case Instructions::i64x2_replace_lane.value():
+        return vector_replace_lane<i64, u64>(configuration, instruction);
+    case Instructions::f32x4_replace_lane.value():
+        return vector_replace_lane<float, float>(configuration, instruction);
+    case Instructions::f64x2_replace_lane.value():
+        return vector_replace_lane<double, double>(configuration, instruction);
+    case Instructions::i8x16_eq.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u8x16, Operators::Equals>>(configuration);
+    case Instructions::i8x16_ne.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u8x16, Operators::NotEquals>>(configuration);
+    case Instructions::i8x16_lt_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::i8x16, Operators::LessThan>>(configuration);
+    case Instructions::i8x16_lt_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u8x16, Operators::LessThan>>(configuration);
+    case Instructions::i8x16_gt_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::i8x16, Operators::GreaterThan>>(configuration);
+    case Instructions::i8x16_gt_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u8x16, Operators::GreaterThan>>(configuration);
+    case Instructions::i8x16_le_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::i8x16, Operators::LessThanOrEquals>>(configuration);
+    case Instructions::i8x16_le_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u8x16, Operators::LessThanOrEquals>>(configuration);
+    case Instructions::i8x16_ge_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::i8x16, Operators::GreaterThanOrEquals>>(configuration);
+    case Instructions::i8x16_ge_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u8x16, Operators::GreaterThanOrEquals>>(configuration);
+    case Instructions::i16x8_eq.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u16x8, Operators::Equals>>(configuration);
+    case Instructions::i16x8_ne.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u16x8, Operators::NotEquals>>(configuration);
+    case Instructions::i16x8_lt_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::i16x8, Operators::LessThan>>(configuration);
+    case Instructions::i16x8_lt_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u16x8, Operators::LessThan>>(configuration);
+    case Instructions::i16x8_gt_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::i16x8, Operators::GreaterThan>>(configuration);
+    case Instructions::i16x8_gt_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u16x8, Operators::GreaterThan>>(configuration);
+    case Instructions::i16x8_le_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::i16x8, Operators::LessThanOrEquals>>(configuration);
+    case Instructions::i16x8_le_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u16x8, Operators::LessThanOrEquals>>(configuration);
+    case Instructions::i16x8_ge_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::i16x8, Operators::GreaterThanOrEquals>>(configuration);
+    case Instructions::i16x8_ge_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u16x8, Operators::GreaterThanOrEquals>>(configuration);
+    case Instructions::i32x4_eq.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u32x4, Operators::Equals>>(configuration);
+    case Instructions::i32x4_ne.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u32x4, Operators::NotEquals>>(configuration);
+    case Instructions::i32x4_lt_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::i32x4, Operators::LessThan>>(configuration);
+    case Instructions::i32x4_lt_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u32x4, Operators::LessThan>>(configuration);
+    case Instructions::i32x4_gt_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::i32x4, Operators::GreaterThan>>(configuration);
+    case Instructions::i32x4_gt_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u32x4, Operators::GreaterThan>>(configuration);
+    case Instructions::i32x4_le_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::i32x4, Operators::LessThanOrEquals>>(configuration);
+    case Instructions::i32x4_le_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u32x4, Operators::LessThanOrEquals>>(configuration);
+    case Instructions::i32x4_ge_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::i32x4, Operators::GreaterThanOrEquals>>(configuration);
+    case Instructions::i32x4_ge_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u32x4, Operators::GreaterThanOrEquals>>(configuration);
+    case Instructions::i64x2_eq.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::i64x2, Operators::Equals>>(configuration);
+    case Instructions::i64x2_ne.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::i64x2, Operators::NotEquals>>(configuration);
+    case Instructions::i64x2_lt_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::i64x2, Operators::LessThan>>(configuration);
+    case Instructions::i64x2_gt_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::i64x2, Operators::GreaterThan>>(configuration);
+    case Instructions::i64x2_le_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::i64x2, Operators::LessThanOrEquals>>(configuration);
+    case Instructions::i64x2_ge_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::i64x2, Operators::GreaterThanOrEquals>>(configuration);
+    case Instructions::f32x4_eq.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::f32x4, Operators::Equals>>(configuration);
+    case Instructions::f32x4_ne.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::f32x4, Operators::NotEquals>>(configuration);
+    case Instructions::f32x4_lt.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::f32x4, Operators::LessThan>>(configuration);
+    case Instructions::f32x4_gt.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::f32x4, Operators::GreaterThan>>(configuration);
+    case Instructions::f32x4_le.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::f32x4, Operators::LessThanOrEquals>>(configuration);
+    case Instructions::f32x4_ge.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::f32x4, Operators::GreaterThanOrEquals>>(configuration);
+    case Instructions::f64x2_eq.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::f64x2, Operators::Equals>>(configuration);
+    case Instructions::f64x2_ne.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::f64x2, Operators::NotEquals>>(configuration);
+    case Instructions::f64x2_lt.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::f64x2, Operators::LessThan>>(configuration);
+    case Instructions::f64x2_gt.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::f64x2, Operators::GreaterThan>>(configuration);
+    case Instructions::f64x2_le.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::f64x2, Operators::LessThanOrEquals>>(configuration);
+    case Instructions::f64x2_ge.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::f64x2, Operators::GreaterThanOrEquals>>(configuration);
+    case Instructions::v128_not.value():
+        return unary_operation<u128, u128, Operators::BitNot>(configuration);
+    case Instructions::v128_and.value():
+        return binary_numeric_operation<u128, u128, Operators::BitAnd>(configuration);
+    case Instructions::v128_andnot.value():
+        return binary_numeric_operation<u128, u128, Operators::BitAndNot>(configuration);
+    case Instructions::v128_or.value():
+        return binary_numeric_operation<u128, u128, Operators::BitOr>(configuration);
+    case Instructions::v128_xor.value():
+        return binary_numeric_operation<u128, u128, Operators::BitXor>(configuration);
+    case Instructions::v128_bitselect.value(): {
+        auto mask = *configuration.stack().pop().to<u128>();
+        auto false_vector = *configuration.stack().pop().to<u128>();
+        auto& true_entry = configuration.stack().peek();
+        true_entry = Value((*true_entry.to<u128>() & mask) | (false_vector & ~mask));
+        return;
+    }
+    case Instructions::v128_any_true.value():
+        return unary_operation<u128, i32, Operators::VectorAnyTrue>(configuration);
+    case Instructions::i8x16_abs.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWise<i8, Operators::WrappingAbsolute>>(configuration);
+    case Instructions::i8x16_neg.value():
+        return unary_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u8x16, Operators::Negate>>(configuration);
+    case Instructions::i8x16_popcnt.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWise<u8, Operators::PopCount>>(configuration);
+    case Instructions::i8x16_all_true.value():
+        return unary_operation<u128, i32, Operators::VectorAllTrue<u8>>(configuration);
+    case Instructions::i8x16_bitmask.value():
+        return unary_operation<u128, i32, Operators::VectorBitmask<i8>>(configuration);
+    case Instructions::i8x16_shl.value():
+        return binary_numeric_operation<u128, i32, u128, Operators::VectorShiftLeft<AK::SIMD::u8x16>>(configuration);
+    case Instructions::i8x16_shr_s.value():
+        return binary_numeric_operation<u128, i32, u128, Operators::VectorShiftRight<AK::SIMD::i8x16>>(configuration);
+    case Instructions::i8x16_shr_u.value():
+        return binary_numeric_operation<u128, i32, u128, Operators::VectorShiftRight<AK::SIMD::u8x16>>(configuration);
+    case Instructions::i8x16_add.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u8x16, Operators::Add>>(configuration);
+    case Instructions::i8x16_sub.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u8x16, Operators::Subtract>>(configuration);
+    case Instructions::i8x16_add_sat_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<i8, Operators::SaturatingAdd>>(configuration);
+    case Instructions::i8x16_add_sat_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<u8, Operators::SaturatingAdd>>(configuration);
+    case Instructions::i8x16_sub_sat_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<i8, Operators::SaturatingSubtract>>(configuration);
+    case Instructions::i8x16_sub_sat_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<u8, Operators::SaturatingSubtract>>(configuration);
+    case Instructions::i8x16_avgr_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<u8, Operators::Average>>(configuration);
+    case Instructions::i8x16_min_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<i8, Operators::Minimum>>(configuration);
+    case Instructions::i8x16_min_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<u8, Operators::Minimum>>(configuration);
+    case Instructions::i8x16_max_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<i8, Operators::Maximum>>(configuration);
+    case Instructions::i8x16_max_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<u8, Operators::Maximum>>(configuration);
+    case Instructions::i16x8_abs.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWise<i16, Operators::WrappingAbsolute>>(configuration);
+    case Instructions::i16x8_neg.value():
+        return unary_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u16x8, Operators::Negate>>(configuration);
+    case Instructions::i16x8_all_true.value():
+        return unary_operation<u128, i32, Operators::VectorAllTrue<u16>>(configuration);
+    case Instructions::i16x8_bitmask.value():
+        return unary_operation<u128, i32, Operators::VectorBitmask<i16>>(configuration);
+    case Instructions::i16x8_shl.value():
+        return binary_numeric_operation<u128, i32, u128, Operators::VectorShiftLeft<AK::SIMD::u16x8>>(configuration);
+    case Instructions::i16x8_shr_s.value():
+        return binary_numeric_operation<u128, i32, u128, Operators::VectorShiftRight<AK::SIMD::i16x8>>(configuration);
+    case Instructions::i16x8_shr_u.value():
+        return binary_numeric_operation<u128, i32, u128, Operators::VectorShiftRight<AK::SIMD::u16x8>>(configuration);
+    case Instructions::i16x8_add.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u16x8, Operators::Add>>(configuration);
+    case Instructions::i16x8_sub.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u16x8, Operators::Subtract>>(configuration);
+    case Instructions::i16x8_add_sat_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<i16, Operators::SaturatingAdd>>(configuration);
+    case Instructions::i16x8_add_sat_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<u16, Operators::SaturatingAdd>>(configuration);
+    case Instructions::i16x8_sub_sat_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<i16, Operators::SaturatingSubtract>>(configuration);
+    case Instructions::i16x8_sub_sat_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<u16, Operators::SaturatingSubtract>>(configuration);
+    case Instructions::i16x8_avgr_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<u16, Operators::Average>>(configuration);
+    case Instructions::i16x8_mul.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u16x8, Operators::Multiply>>(configuration);
+    case Instructions::i16x8_min_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<i16, Operators::Minimum>>(configuration);
+    case Instructions::i16x8_min_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<u16, Operators::Minimum>>(configuration);
+    case Instructions::i16x8_max_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<i16, Operators::Maximum>>(configuration);
+    case Instructions::i16x8_max_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<u16, Operators::Maximum>>(configuration);
+    case Instructions::i32x4_abs.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWise<i32, Operators::WrappingAbsolute>>(configuration);
+    case Instructions::i32x4_neg.value():
+        return unary_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u32x4, Operators::Negate>>(configuration);
+    case Instructions::i32x4_all_true.value():
+        return unary_operation<u128, i32, Operators::VectorAllTrue<u32>>(configuration);
+    case Instructions::i32x4_bitmask.value():
+        return unary_operation<u128, i32, Operators::VectorBitmask<i32>>(configuration);
+    case Instructions::i32x4_shl.value():
+        return binary_numeric_operation<u128, i32, u128, Operators::VectorShiftLeft<AK::SIMD::u32x4>>(configuration);
+    case Instructions::i32x4_shr_s.value():
+        return binary_numeric_operation<u128, i32, u128, Operators::VectorShiftRight<AK::SIMD::i32x4>>(configuration);
+    case Instructions::i32x4_shr_u.value():
+        return binary_numeric_operation<u128, i32, u128, Operators::VectorShiftRight<AK::SIMD::u32x4>>(configuration);
+    case Instructions::i32x4_add.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u32x4, Operators::Add>>(configuration);
+    case Instructions::i32x4_sub.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u32x4, Operators::Subtract>>(configuration);
+    case Instructions::i32x4_mul.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u32x4, Operators::Multiply>>(configuration);
+    case Instructions::i32x4_min_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<i32, Operators::Minimum>>(configuration);
+    case Instructions::i32x4_min_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<u32, Operators::Minimum>>(configuration);
+    case Instructions::i32x4_max_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<i32, Operators::Maximum>>(configuration);
+    case Instructions::i32x4_max_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<u32, Operators::Maximum>>(configuration);
+    case Instructions::i64x2_abs.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWise<i64, Operators::WrappingAbsolute>>(configuration);
+    case Instructions::i64x2_neg.value():
+        return unary_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u64x2, Operators::Negate>>(configuration);
+    case Instructions::i64x2_all_true.value():
+        return unary_operation<u128, i32, Operators::VectorAllTrue<u64>>(configuration);
+    case Instructions::i64x2_bitmask.value():
+        return unary_operation<u128, i32, Operators::VectorBitmask<i64>>(configuration);
+    case Instructions::i64x2_shl.value():
+        return binary_numeric_operation<u128, i32, u128, Operators::VectorShiftLeft<AK::SIMD::u64x2>>(configuration);
+    case Instructions::i64x2_shr_s.value():
+        return binary_numeric_operation<u128, i32, u128, Operators::VectorShiftRight<AK::SIMD::i64x2>>(configuration);
+    case Instructions::i64x2_shr_u.value():
+        return binary_numeric_operation<u128, i32, u128, Operators::VectorShiftRight<AK::SIMD::u64x2>>(configuration);
+    case Instructions::i64x2_add.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u64x2, Operators::Add>>(configuration);
+    case Instructions::i64x2_sub.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u64x2, Operators::Subtract>>(configuration);
+    case Instructions::i64x2_mul.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::u64x2, Operators::Multiply>>(configuration);
+    case Instructions::i32x4_dot_i16x8_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorDotProduct>(configuration);
+    case Instructions::f32x4_ceil.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWise<float, Operators::Ceil>>(configuration);
+    case Instructions::f32x4_floor.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWise<float, Operators::Floor>>(configuration);
+    case Instructions::f32x4_trunc.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWise<float, Operators::Truncate>>(configuration);
+    case Instructions::f32x4_nearest.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWise<float, Operators::NearbyIntegral>>(configuration);
+    case Instructions::f32x4_abs.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWise<float, Operators::Absolute>>(configuration);
+    case Instructions::f32x4_neg.value():
+        return unary_operation<u128, u128, Operators::VectorOperation<AK::SIMD::f32x4, Operators::Negate>>(configuration);
+    case Instructions::f32x4_sqrt.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWise<float, Operators::SquareRoot>>(configuration);
+    case Instructions::f32x4_add.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::f32x4, Operators::Add>>(configuration);
+    case Instructions::f32x4_sub.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::f32x4, Operators::Subtract>>(configuration);
+    case Instructions::f32x4_mul.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::f32x4, Operators::Multiply>>(configuration);
+    case Instructions::f32x4_div.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<float, Operators::Divide>>(configuration);
+    case Instructions::f32x4_min.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<float, Operators::Minimum>>(configuration);
+    case Instructions::f32x4_max.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<float, Operators::Maximum>>(configuration);
+    case Instructions::f32x4_pmin.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<float, Operators::PseudoMinimum>>(configuration);
+    case Instructions::f32x4_pmax.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<float, Operators::PseudoMaximum>>(configuration);
+    case Instructions::f64x2_ceil.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWise<double, Operators::Ceil>>(configuration);
+    case Instructions::f64x2_floor.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWise<double, Operators::Floor>>(configuration);
+    case Instructions::f64x2_trunc.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWise<double, Operators::Truncate>>(configuration);
+    case Instructions::f64x2_nearest.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWise<double, Operators::NearbyIntegral>>(configuration);
+    case Instructions::f64x2_abs.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWise<double, Operators::Absolute>>(configuration);
+    case Instructions::f64x2_neg.value():
+        return unary_operation<u128, u128, Operators::VectorOperation<AK::SIMD::f64x2, Operators::Negate>>(configuration);
+    case Instructions::f64x2_sqrt.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWise<double, Operators::SquareRoot>>(configuration);
+    case Instructions::f64x2_add.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::f64x2, Operators::Add>>(configuration);
+    case Instructions::f64x2_sub.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::f64x2, Operators::Subtract>>(configuration);
+    case Instructions::f64x2_mul.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorOperation<AK::SIMD::f64x2, Operators::Multiply>>(configuration);
+    case Instructions::f64x2_div.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<double, Operators::Divide>>(configuration);
+    case Instructions::f64x2_min.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<double, Operators::Minimum>>(configuration);
+    case Instructions::f64x2_max.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<double, Operators::Maximum>>(configuration);
+    case Instructions::f64x2_pmin.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<double, Operators::PseudoMinimum>>(configuration);
+    case Instructions::f64x2_pmax.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWise<double, Operators::PseudoMaximum>>(configuration);
+    case Instructions::i32x4_trunc_sat_f32x4_s.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWise<float, Operators::SaturatingTruncate<i32>, i32>>(configuration);
+    case Instructions::i32x4_trunc_sat_f32x4_u.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWise<float, Operators::SaturatingTruncate<u32>, u32>>(configuration);
+    case Instructions::f32x4_convert_i32x4_s.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWise<i32, Operators::Convert<float>, float>>(configuration);
+    case Instructions::f32x4_convert_i32x4_u.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWise<u32, Operators::Convert<float>, float>>(configuration);
     case Instructions::memory_init.value(): {
         auto data_index = instruction.arguments().get<DataIndex>();
         auto& data_address = configuration.frame().module().datas()[data_index.value()];
         auto& data = *configuration.store().get(data_address);
-        auto count = *configuration.stack().pop().get<Value>().to<i32>();
-        auto source_offset = *configuration.stack().pop().get<Value>().to<i32>();
-        auto destination_offset = *configuration.stack().pop().get<Value>().to<i32>();
+        auto count = *configuration.stack().pop().to<i32>();
+        auto source_offset = *configuration.stack().pop().to<i32>();
+        auto destination_offset = *configuration.stack().pop().to<i32>();
 
         TRAP_IF_NOT(count > 0);
         TRAP_IF_NOT(source_offset + count > 0);
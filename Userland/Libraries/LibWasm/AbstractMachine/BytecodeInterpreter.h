@@ -45,9 +45,18 @@ protected:
     template<typename PopType, typename PushType, typename Operator>
     void binary_numeric_operation(Configuration&);
 
+    template<typename PopTypeLhs, typename PopTypeRhs, typename PushType, typename Operator>
+    void binary_numeric_operation(Configuration&);
+
     template<typename PopType, typename PushType, typename Operator>
     void unary_operation(Configuration&);
 
+    template<typename LaneType, typename PushType>
+    void vector_extract_lane(Configuration&, Instruction const&);
+
+    template<typename PopType, typename LaneType>
+    void vector_replace_lane(Configuration&, Instruction const&);
+
     template<typename V, typename T>
     MakeUnsigned<T> checked_unsigned_truncate(V);
 
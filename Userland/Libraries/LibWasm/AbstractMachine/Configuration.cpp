@@ -10,30 +10,17 @@
 
 namespace Wasm {
 
-Optional<size_t> Configuration::nth_label_index(size_t i)
-{
-    for (size_t index = m_stack.size(); index > 0; --index) {
-        auto& entry = m_stack.entries()[index - 1];
-        if (entry.has<Label>()) {
-            if (i == 0)
-                return index - 1;
-            --i;
-        }
-    }
-    return {};
-}
-
 void Configuration::unwind(Badge<CallFrameHandle>, CallFrameHandle const& frame_handle)
 {
-    if (m_stack.size() == frame_handle.stack_size && frame_handle.frame_index == m_current_frame_index)
+    if (m_stack.size() == frame_handle.stack_size && m_frame_stack.size() == frame_handle.frame_stack_size)
         return;
 
-    VERIFY(m_stack.size() > frame_handle.stack_size);
-    m_stack.entries().remove(frame_handle.stack_size, m_stack.size() - frame_handle.stack_size);
-    m_current_frame_index = frame_handle.frame_index;
+    VERIFY(m_stack.size() >= frame_handle.stack_size);
+    m_stack.entries().shrink(frame_handle.stack_size);
+    m_label_stack.shrink(frame_handle.label_stack_size);
+    m_frame_stack.shrink(frame_handle.frame_stack_size);
     m_depth--;
     m_ip = frame_handle.ip;
-    VERIFY(m_stack.size() == frame_handle.stack_size);
 }
 
 Result Configuration::call(Interpreter& interpreter, FunctionAddress address, Vector<Value> arguments)
@@ -68,17 +55,17 @@ Result Configuration::execute(Interpreter& interpreter)
     if (interpreter.did_trap())
         return Trap { interpreter.trap_reason() };
 
-    if (stack().size() <= frame().arity() + 1)
+    if (stack().size() < frame().arity())
         return Trap { "Not enough values to return from call" };
 
     Vector<Value> results;
     results.ensure_capacity(frame().arity());
     for (size_t i = 0; i < frame().arity(); ++i)
-        results.append(move(stack().pop().get<Value>()));
-    auto label = stack().pop();
-    // ASSERT: label == current frame
-    if (!label.has<Label>())
+        results.append(stack().pop());
+    // ASSERT: the current frame's function label is still the topmost label.
+    if (m_label_stack.size() != frame().label_index() + 1)
         return Trap { "Invalid stack configuration" };
+    m_label_stack.take_last();
     return Result { move(results) };
 }
 
@@ -90,20 +77,16 @@ void Configuration::dump_stack()
         ByteBuffer buffer = memory_stream.copy_into_contiguous_buffer();
         dbgln(format.view(), StringView(buffer).trim_whitespace());
     };
-    for (auto const& entry : stack().entries()) {
-        entry.visit(
-            [&](Value const& v) {
-                print_value("    {}", v);
-            },
-            [&](Frame const& f) {
-                dbgln("    frame({})", f.arity());
-                for (auto& local : f.locals()) {
-                    print_value("        {}", local);
-                }
-            },
-            [](Label const& l) {
-                dbgln("    label({}) -> {}", l.arity(), l.continuation());
-            });
+    for (auto const& frame : m_frame_stack) {
+        dbgln("    frame({})", frame.arity());
+        for (auto& local : frame.locals()) {
+            print_value("        {}", local);
+        }
+    }
+    for (auto const& label : m_label_stack)
+        dbgln("    label({}) -> {}", label.arity(), label.continuation());
+    for (auto const& value : stack().entries()) {
+        print_value("    {}", value);
     }
 }
 
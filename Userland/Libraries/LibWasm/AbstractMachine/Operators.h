@@ -6,11 +6,14 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/BitCast.h>
 #include <AK/BuiltinWrappers.h>
 #include <AK/Result.h>
+#include <AK/SIMD.h>
 #include <AK/StringView.h>
 #include <AK/Types.h>
+#include <AK/UFixedBigInt.h>
 #include <limits.h>
 #include <math.h>
 
@@ -210,7 +213,7 @@ struct PopCount {
     template<typename Lhs>
     auto operator()(Lhs lhs) const
     {
-        if constexpr (sizeof(Lhs) == 4 || sizeof(Lhs) == 8)
+        if constexpr (sizeof(Lhs) <= 8)
             return popcount(MakeUnsigned<Lhs>(lhs));
         else
             VERIFY_NOT_REACHED();
@@ -448,4 +451,247 @@ struct SaturatingTruncate {
     static StringView name() { return "truncate.saturating"sv; }
 };
 
+// Vector operations
+//
+// A v128 value travels around as a u128; these operators bit_cast it to the
+// AK::SIMD type (or a lane array) matching the instruction's shape, so the
+// compiler can lower the element-wise work to native vector code.
+
+// Applies the (scalar) operator Op to whole vectors at once, relying on the
+// native vector operators; comparisons yield an all-ones/all-zeroes lane mask.
+template<typename VectorType, typename Op>
+struct VectorOperation {
+    u128 operator()(u128 lhs, u128 rhs) const
+    {
+        return bit_cast<u128>(Op {}(bit_cast<VectorType>(lhs), bit_cast<VectorType>(rhs)));
+    }
+
+    u128 operator()(u128 value) const
+    {
+        return bit_cast<u128>(Op {}(bit_cast<VectorType>(value)));
+    }
+
+    static StringView name() { return Op::name(); }
+};
+
+// Applies the scalar operator Op to each lane in turn, for operations that
+// have no (correct) native vector equivalent.
+template<typename LaneType, typename Op, typename ResultLaneType = LaneType>
+struct VectorLaneWise {
+    static constexpr auto lane_count = sizeof(u128) / sizeof(LaneType);
+    static_assert(sizeof(ResultLaneType) == sizeof(LaneType));
+
+    u128 operator()(u128 lhs, u128 rhs) const
+    {
+        auto lhs_lanes = bit_cast<Array<LaneType, lane_count>>(lhs);
+        auto rhs_lanes = bit_cast<Array<LaneType, lane_count>>(rhs);
+        Array<ResultLaneType, lane_count> result;
+        for (size_t i = 0; i < lane_count; ++i)
+            result[i] = unwrap(Op {}(lhs_lanes[i], rhs_lanes[i]));
+        return bit_cast<u128>(result);
+    }
+
+    u128 operator()(u128 value) const
+    {
+        auto lanes = bit_cast<Array<LaneType, lane_count>>(value);
+        Array<ResultLaneType, lane_count> result;
+        for (size_t i = 0; i < lane_count; ++i)
+            result[i] = unwrap(Op {}(lanes[i]));
+        return bit_cast<u128>(result);
+    }
+
+    static StringView name() { return Op::name(); }
+
+private:
+    template<typename T>
+    static ResultLaneType unwrap(T result)
+    {
+        if constexpr (IsSpecializationOf<T, AK::Result>)
+            return result.release_value();
+        else
+            return result;
+    }
+};
+
+struct BitNot {
+    template<typename Lhs>
+    auto operator()(Lhs lhs) const { return ~lhs; }
+
+    static StringView name() { return "~"sv; }
+};
+struct BitAndNot {
+    template<typename Lhs, typename Rhs>
+    auto operator()(Lhs lhs, Rhs rhs) const { return lhs & ~rhs; }
+
+    static StringView name() { return "andnot"sv; }
+};
+struct SaturatingAdd {
+    template<typename Lhs, typename Rhs>
+    Lhs operator()(Lhs lhs, Rhs rhs) const
+    {
+        // Note: Only valid for lanes no wider than 16 bits.
+        auto result = static_cast<i32>(lhs) + static_cast<i32>(rhs);
+        if (result < static_cast<i32>(NumericLimits<Lhs>::min()))
+            return NumericLimits<Lhs>::min();
+        if (result > static_cast<i32>(NumericLimits<Lhs>::max()))
+            return NumericLimits<Lhs>::max();
+        return static_cast<Lhs>(result);
+    }
+
+    static StringView name() { return "add.saturating"sv; }
+};
+struct SaturatingSubtract {
+    template<typename Lhs, typename Rhs>
+    Lhs operator()(Lhs lhs, Rhs rhs) const
+    {
+        // Note: Only valid for lanes no wider than 16 bits.
+        auto result = static_cast<i32>(lhs) - static_cast<i32>(rhs);
+        if (result < static_cast<i32>(NumericLimits<Lhs>::min()))
+            return NumericLimits<Lhs>::min();
+        if (result > static_cast<i32>(NumericLimits<Lhs>::max()))
+            return NumericLimits<Lhs>::max();
+        return static_cast<Lhs>(result);
+    }
+
+    static StringView name() { return "subtract.saturating"sv; }
+};
+struct Average {
+    template<typename Lhs, typename Rhs>
+    Lhs operator()(Lhs lhs, Rhs rhs) const
+    {
+        return static_cast<Lhs>((static_cast<u32>(lhs) + static_cast<u32>(rhs) + 1) / 2);
+    }
+
+    static StringView name() { return "average"sv; }
+};
+struct WrappingAbsolute {
+    template<typename Lhs>
+    Lhs operator()(Lhs lhs) const
+    {
+        using Unsigned = MakeUnsigned<Lhs>;
+        if (lhs < 0)
+            return bit_cast<Lhs>(static_cast<Unsigned>(~static_cast<Unsigned>(lhs) + 1));
+        return lhs;
+    }
+
+    static StringView name() { return "abs.wrapping"sv; }
+};
+struct PseudoMinimum {
+    template<typename Lhs, typename Rhs>
+    auto operator()(Lhs lhs, Rhs rhs) const { return rhs < lhs ? rhs : lhs; }
+
+    static StringView name() { return "pmin"sv; }
+};
+struct PseudoMaximum {
+    template<typename Lhs, typename Rhs>
+    auto operator()(Lhs lhs, Rhs rhs) const { return lhs < rhs ? rhs : lhs; }
+
+    static StringView name() { return "pmax"sv; }
+};
+
+template<typename VectorType>
+struct VectorShiftLeft {
+    u128 operator()(u128 lhs, i32 rhs) const
+    {
+        auto value = bit_cast<VectorType>(lhs);
+        constexpr i32 lane_bits = sizeof(value[0]) * 8;
+        return bit_cast<u128>(value << (rhs % lane_bits));
+    }
+
+    static StringView name() { return "vec.<<"sv; }
+};
+template<typename VectorType>
+struct VectorShiftRight {
+    u128 operator()(u128 lhs, i32 rhs) const
+    {
+        auto value = bit_cast<VectorType>(lhs);
+        constexpr i32 lane_bits = sizeof(value[0]) * 8;
+        return bit_cast<u128>(value >> (rhs % lane_bits));
+    }
+
+    static StringView name() { return "vec.>>"sv; }
+};
+
+template<typename LaneType>
+struct VectorSplat {
+    template<typename T>
+    u128 operator()(T value) const
+    {
+        Array<LaneType, sizeof(u128) / sizeof(LaneType)> lanes;
+        for (auto& lane : lanes)
+            lane = static_cast<LaneType>(value);
+        return bit_cast<u128>(lanes);
+    }
+
+    static StringView name() { return "splat"sv; }
+};
+
+struct VectorSwizzle {
+    u128 operator()(u128 lhs, u128 rhs) const
+    {
+        auto values = bit_cast<Array<u8, 16>>(lhs);
+        auto indices = bit_cast<Array<u8, 16>>(rhs);
+        Array<u8, 16> result;
+        for (size_t i = 0; i < 16; ++i)
+            result[i] = indices[i] < 16 ? values[indices[i]] : 0;
+        return bit_cast<u128>(result);
+    }
+
+    static StringView name() { return "swizzle"sv; }
+};
+
+struct VectorAnyTrue {
+    i32 operator()(u128 value) const { return value != 0u; }
+
+    static StringView name() { return "any_true"sv; }
+};
+
+template<typename LaneType>
+struct VectorAllTrue {
+    i32 operator()(u128 value) const
+    {
+        auto lanes = bit_cast<Array<LaneType, sizeof(u128) / sizeof(LaneType)>>(value);
+        for (auto lane : lanes) {
+            if (lane == 0)
+                return 0;
+        }
+        return 1;
+    }
+
+    static StringView name() { return "all_true"sv; }
+};
+
+template<typename LaneType>
+struct VectorBitmask {
+    static_assert(IsSigned<LaneType>);
+
+    i32 operator()(u128 value) const
+    {
+        constexpr auto lane_count = sizeof(u128) / sizeof(LaneType);
+        auto lanes = bit_cast<Array<LaneType, lane_count>>(value);
+        i32 bitmask = 0;
+        for (size_t i = 0; i < lane_count; ++i)
+            bitmask |= (lanes[i] < 0) << i;
+        return bitmask;
+    }
+
+    static StringView name() { return "bitmask"sv; }
+};
+
+struct VectorDotProduct {
+    u128 operator()(u128 lhs, u128 rhs) const
+    {
+        auto lhs_lanes = bit_cast<Array<i16, 8>>(lhs);
+        auto rhs_lanes = bit_cast<Array<i16, 8>>(rhs);
+        Array<i32, 4> result;
+        for (size_t i = 0; i < 4; ++i) {
+            result[i] = static_cast<i32>(lhs_lanes[2 * i]) * static_cast<i32>(rhs_lanes[2 * i])
+                + static_cast<i32>(lhs_lanes[2 * i + 1]) * static_cast<i32>(rhs_lanes[2 * i + 1]);
+        }
+        return bit_cast<u128>(result);
+    }
+
+    static StringView name() { return "dot"sv; }
+};
+
 }
@@ -1916,6 +1916,1319 @@ VALIDATE_INSTRUCTION(data_drop)
     return {};
 }
 
+// https://webassembly.github.io/spec/core/bikeshed/#vector-instructions%E2%91%A2
+VALIDATE_INSTRUCTION(v128_load)
+{
+    TRY(validate(MemoryIndex { 0 }));
+
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    if ((1ull << arg.align) > sizeof(u128))
+        return Errors::out_of_bounds("memory op alignment"sv, 1ull << arg.align, 0, sizeof(u128));
+
+    TRY((stack.take<ValueType::I32>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(v128_store)
+{
+    TRY(validate(MemoryIndex { 0 }));
+
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    if ((1ull << arg.align) > sizeof(u128))
+        return Errors::out_of_bounds("memory op alignment"sv, 1ull << arg.align, 0, sizeof(u128));
+
+    TRY((stack.take<ValueType::V128, ValueType::I32>()));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(v128_const)
+{
+    is_constant = true;
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_shuffle)
+{
+    auto& args = instruction.arguments().get<Instruction::ShuffleArgs>();
+    for (auto lane : args.lanes) {
+        if (lane >= 32)
+            return Errors::out_of_bounds("shuffle lane index"sv, lane, 0, 31);
+    }
+
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_swizzle)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_splat)
+{
+    TRY((stack.take<ValueType::I32>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_splat)
+{
+    TRY((stack.take<ValueType::I32>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_splat)
+{
+    TRY((stack.take<ValueType::I32>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64x2_splat)
+{
+    TRY((stack.take<ValueType::I64>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_splat)
+{
+    TRY((stack.take<ValueType::F32>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_splat)
+{
+    TRY((stack.take<ValueType::F64>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_extract_lane_s)
+{
+    auto lane = instruction.arguments().get<Instruction::LaneIndex>().lane;
+    if (lane >= 16)
+        return Errors::out_of_bounds("lane index"sv, lane, 0, 15);
+
+    TRY((stack.take<ValueType::V128>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_extract_lane_u)
+{
+    auto lane = instruction.arguments().get<Instruction::LaneIndex>().lane;
+    if (lane >= 16)
+        return Errors::out_of_bounds("lane index"sv, lane, 0, 15);
+
+    TRY((stack.take<ValueType::V128>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_replace_lane)
+{
+    auto lane = instruction.arguments().get<Instruction::LaneIndex>().lane;
+    if (lane >= 16)
+        return Errors::out_of_bounds("lane index"sv, lane, 0, 15);
+
+    TRY((stack.take<ValueType::I32, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_extract_lane_s)
+{
+    auto lane = instruction.arguments().get<Instruction::LaneIndex>().lane;
+    if (lane >= 8)
+        return Errors::out_of_bounds("lane index"sv, lane, 0, 7);
+
+    TRY((stack.take<ValueType::V128>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_extract_lane_u)
+{
+    auto lane = instruction.arguments().get<Instruction::LaneIndex>().lane;
+    if (lane >= 8)
+        return Errors::out_of_bounds("lane index"sv, lane, 0, 7);
+
+    TRY((stack.take<ValueType::V128>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_replace_lane)
+{
+    auto lane = instruction.arguments().get<Instruction::LaneIndex>().lane;
+    if (lane >= 8)
+        return Errors::out_of_bounds("lane index"sv, lane, 0, 7);
+
+    TRY((stack.take<ValueType::I32, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_extract_lane)
+{
+    auto lane = instruction.arguments().get<Instruction::LaneIndex>().lane;
+    if (lane >= 4)
+        return Errors::out_of_bounds("lane index"sv, lane, 0, 3);
+
+    TRY((stack.take<ValueType::V128>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_replace_lane)
+{
+    auto lane = instruction.arguments().get<Instruction::LaneIndex>().lane;
+    if (lane >= 4)
+        return Errors::out_of_bounds("lane index"sv, lane, 0, 3);
+
+    TRY((stack.take<ValueType::I32, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64x2_extract_lane)
+{
+    auto lane = instruction.arguments().get<Instruction::LaneIndex>().lane;
+    if (lane >= 2)
+        return Errors::out_of_bounds("lane index"sv, lane, 0, 1);
+
+    TRY((stack.take<ValueType::V128>()));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64x2_replace_lane)
+{
+    auto lane = instruction.arguments().get<Instruction::LaneIndex>().lane;
+    if (lane >= 2)
+        return Errors::out_of_bounds("lane index"sv, lane, 0, 1);
+
+    TRY((stack.take<ValueType::I64, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_extract_lane)
+{
+    auto lane = instruction.arguments().get<Instruction::LaneIndex>().lane;
+    if (lane >= 4)
+        return Errors::out_of_bounds("lane index"sv, lane, 0, 3);
+
+    TRY((stack.take<ValueType::V128>()));
+    stack.append(ValueType(ValueType::F32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_replace_lane)
+{
+    auto lane = instruction.arguments().get<Instruction::LaneIndex>().lane;
+    if (lane >= 4)
+        return Errors::out_of_bounds("lane index"sv, lane, 0, 3);
+
+    TRY((stack.take<ValueType::F32, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_extract_lane)
+{
+    auto lane = instruction.arguments().get<Instruction::LaneIndex>().lane;
+    if (lane >= 2)
+        return Errors::out_of_bounds("lane index"sv, lane, 0, 1);
+
+    TRY((stack.take<ValueType::V128>()));
+    stack.append(ValueType(ValueType::F64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_replace_lane)
+{
+    auto lane = instruction.arguments().get<Instruction::LaneIndex>().lane;
+    if (lane >= 2)
+        return Errors::out_of_bounds("lane index"sv, lane, 0, 1);
+
+    TRY((stack.take<ValueType::F64, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_eq)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_ne)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_lt_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_lt_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_gt_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_gt_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_le_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_le_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_ge_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_ge_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_eq)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_ne)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_lt_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_lt_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_gt_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_gt_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_le_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_le_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_ge_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_ge_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_eq)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_ne)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_lt_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_lt_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_gt_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_gt_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_le_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_le_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_ge_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_ge_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64x2_eq)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64x2_ne)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64x2_lt_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64x2_gt_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64x2_le_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64x2_ge_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_eq)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_ne)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_lt)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_gt)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_le)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_ge)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_eq)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_ne)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_lt)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_gt)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_le)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_ge)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(v128_not)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(v128_and)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(v128_andnot)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(v128_or)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(v128_xor)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(v128_bitselect)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(v128_any_true)
+{
+    TRY((stack.take<ValueType::V128>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_abs)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_neg)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_popcnt)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_all_true)
+{
+    TRY((stack.take<ValueType::V128>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_bitmask)
+{
+    TRY((stack.take<ValueType::V128>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_shl)
+{
+    TRY((stack.take<ValueType::I32, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_shr_s)
+{
+    TRY((stack.take<ValueType::I32, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_shr_u)
+{
+    TRY((stack.take<ValueType::I32, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_add)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_sub)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_add_sat_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_add_sat_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_sub_sat_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_sub_sat_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_avgr_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_min_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_min_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_max_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_max_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_abs)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_neg)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_all_true)
+{
+    TRY((stack.take<ValueType::V128>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_bitmask)
+{
+    TRY((stack.take<ValueType::V128>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_shl)
+{
+    TRY((stack.take<ValueType::I32, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_shr_s)
+{
+    TRY((stack.take<ValueType::I32, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_shr_u)
+{
+    TRY((stack.take<ValueType::I32, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_add)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_sub)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_add_sat_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_add_sat_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_sub_sat_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_sub_sat_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_avgr_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_mul)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_min_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_min_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_max_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i16x8_max_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_abs)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_neg)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_all_true)
+{
+    TRY((stack.take<ValueType::V128>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_bitmask)
+{
+    TRY((stack.take<ValueType::V128>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_shl)
+{
+    TRY((stack.take<ValueType::I32, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_shr_s)
+{
+    TRY((stack.take<ValueType::I32, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_shr_u)
+{
+    TRY((stack.take<ValueType::I32, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_add)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_sub)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_mul)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_min_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_min_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_max_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_max_u)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64x2_abs)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64x2_neg)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64x2_all_true)
+{
+    TRY((stack.take<ValueType::V128>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64x2_bitmask)
+{
+    TRY((stack.take<ValueType::V128>()));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64x2_shl)
+{
+    TRY((stack.take<ValueType::I32, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64x2_shr_s)
+{
+    TRY((stack.take<ValueType::I32, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64x2_shr_u)
+{
+    TRY((stack.take<ValueType::I32, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64x2_add)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64x2_sub)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64x2_mul)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_dot_i16x8_s)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_ceil)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_floor)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_trunc)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_nearest)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_abs)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_neg)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_sqrt)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_add)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_sub)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_mul)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_div)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_min)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_max)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_pmin)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_pmax)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_ceil)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_floor)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_trunc)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_nearest)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_abs)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_neg)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_sqrt)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_add)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_sub)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_mul)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_div)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_min)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_max)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_pmin)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f64x2_pmax)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_trunc_sat_f32x4_s)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32x4_trunc_sat_f32x4_u)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_convert_i32x4_s)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
+VALIDATE_INSTRUCTION(f32x4_convert_i32x4_u)
+{
+    if (stack.is_empty() || !stack.last().is_of_kind(ValueType::V128))
+        return Errors::invalid_stack_state(stack, Tuple { ValueType(ValueType::V128) });
+    return {};
+}
+
 // https://webassembly.github.io/spec/core/bikeshed/#control-instructions%E2%91%A2
 VALIDATE_INSTRUCTION(nop)
 {
@@ -132,6 +132,8 @@ ParseResult<ValueType> ValueType::parse(InputStream& stream)
         return ValueType(F32);
     case Constants::f64_tag:
         return ValueType(F64);
+    case Constants::v128_tag:
+        return ValueType(V128);
     case Constants::function_reference_tag:
         return ValueType(FunctionReference);
     case Constants::extern_reference_tag:
@@ -761,6 +763,90 @@ ParseResult<Vector<Instruction>> Instruction::parse(InputStream& stream, Instruc
             default:
                 return ParseError::UnknownInstruction;
             }
+            break;
+        }
+        case 0xfd: {
+            // These are multibyte SIMD instructions.
+            u32 selector;
+            if (!LEB128::read_unsigned(stream, selector))
+                return with_eof_check(stream, ParseError::InvalidInput);
+            if (selector > 0xff)
+                return ParseError::UnknownInstruction;
+            switch (selector) {
+            case 0x00 ... 0x0b: // v128.load*, v128.store
+            case 0x5c:          // v128.load32_zero
+            case 0x5d: {        // v128.load64_zero
+                // op (align offset)
+                size_t align;
+                if (!LEB128::read_unsigned(stream, align))
+                    return with_eof_check(stream, ParseError::InvalidInput);
+
+                size_t offset;
+                if (!LEB128::read_unsigned(stream, offset))
+                    return with_eof_check(stream, ParseError::InvalidInput);
+
+                resulting_instructions.append(Instruction { OpCode { 0xfd00 | selector }, MemoryArgument { static_cast<u32>(align), static_cast<u32>(offset) } });
+                break;
+            }
+            case 0x54 ... 0x5b: { // v128.load*_lane, v128.store*_lane
+                // op (align offset) lane
+                // Note: The lane immediate is dropped; these instructions are
+                //       not implemented and get rejected in validation.
+                size_t align;
+                if (!LEB128::read_unsigned(stream, align))
+                    return with_eof_check(stream, ParseError::InvalidInput);
+
+                size_t offset;
+                if (!LEB128::read_unsigned(stream, offset))
+                    return with_eof_check(stream, ParseError::InvalidInput);
+
+                u8 lane;
+                stream >> lane;
+                if (stream.has_any_error())
+                    return with_eof_check(stream, ParseError::InvalidInput);
+
+                resulting_instructions.append(Instruction { OpCode { 0xfd00 | selector }, MemoryArgument { static_cast<u32>(align), static_cast<u32>(offset) } });
+                break;
+            }
+            case 0x0c: { // v128.const
+                // op literal:16
+                LittleEndian<u64> low;
+                LittleEndian<u64> high;
+                stream >> low >> high;
+                if (stream.has_any_error())
+                    return with_eof_check(stream, ParseError::InvalidImmediate);
+
+                resulting_instructions.append(Instruction { OpCode { 0xfd00 | selector }, u128(static_cast<u64>(low), static_cast<u64>(high)) });
+                break;
+            }
+            case 0x0d: { // i8x16.shuffle
+                // op lane:16
+                Instruction::ShuffleArgs lanes;
+                stream >> Bytes { lanes.lanes, 16 };
+                if (stream.has_any_error())
+                    return with_eof_check(stream, ParseError::InvalidImmediate);
+
+                resulting_instructions.append(Instruction { OpCode { 0xfd00 | selector }, lanes });
+                break;
+            }
+            case 0x15 ... 0x22: { // *.extract_lane*, *.replace_lane
+                // op lane
+                u8 lane;
+                stream >> lane;
+                if (stream.has_any_error())
+                    return with_eof_check(stream, ParseError::InvalidImmediate);
+
+                resulting_instructions.append(Instruction { OpCode { 0xfd00 | selector }, Instruction::LaneIndex { lane } });
+                break;
+            }
+            default:
+                // The rest of the proposal's instructions take no immediates;
+                // the ones not implemented by the interpreter get rejected in
+                // validation.
+                resulting_instructions.append(Instruction { OpCode { 0xfd00 | selector } });
+                break;
+            }
+            break;
         }
         }
     } while (!nested_instructions.is_empty());
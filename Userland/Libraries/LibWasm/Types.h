@@ -13,6 +13,7 @@
 #include <AK/MemoryStream.h>
 #include <AK/NonnullOwnPtrVector.h>
 #include <AK/Result.h>
+#include <AK/UFixedBigInt.h>
 #include <AK/Variant.h>
 #include <LibWasm/Constants.h>
 #include <LibWasm/Forward.h>
@@ -171,6 +172,7 @@ public:
         I64,
         F32,
         F64,
+        V128,
         FunctionReference,
         ExternReference,
         NullFunctionReference,
@@ -201,6 +203,8 @@ public:
             return "f32";
         case F64:
             return "f64";
+        case V128:
+            return "v128";
         case FunctionReference:
             return "funcref";
         case ExternReference:
@@ -422,6 +426,14 @@ public:
         u32 offset;
     };
 
+    struct LaneIndex {
+        u8 lane;
+    };
+
+    struct ShuffleArgs {
+        u8 lanes[16];
+    };
+
     template<typename T>
     explicit Instruction(OpCode opcode, T argument)
         : m_opcode(opcode)
@@ -445,8 +457,10 @@ private:
         GlobalIndex,
         IndirectCallArgs,
         LabelIndex,
+        LaneIndex,
         LocalIndex,
         MemoryArgument,
+        ShuffleArgs,
         StructuredInstructionArgs,
         TableBranchArgs,
         TableElementArgs,
@@ -458,6 +472,7 @@ private:
         float,
         i32,
         i64,
+        u128,
         u8 // Empty state
     > m_arguments;
     // clang-format on
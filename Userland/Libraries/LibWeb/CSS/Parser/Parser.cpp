@@ -90,6 +90,14 @@ Parser::Parser(ParsingContext const& context, StringView input, DeprecatedString
 {
 }
 
+Parser::Parser(ParsingContext const& context, Vector<Token> tokens)
+    : m_context(context)
+    , m_tokenizer({}, "utf-8")
+    , m_tokens(move(tokens))
+    , m_token_stream(TokenStream(m_tokens))
+{
+}
+
 // 5.3.3. Parse a stylesheet
 // https://www.w3.org/TR/css-syntax-3/#parse-stylesheet
 template<typename T>
@@ -7269,11 +7277,48 @@ TimePercentage Parser::Dimension::time_percentage() const
 
 namespace Web {
 
+// Identical framework stylesheets get re-tokenized for every document that
+// includes them. Tokenization is context-free (the document only matters from
+// the parse stage onwards), so the token streams are memoized by source text
+// and shared by every document in this process. The CSSOM itself is still
+// built per document, since style sheet objects are realm-bound GC cells and
+// cannot be shared across documents.
+struct CachedStylesheetTokens {
+    DeprecatedString source;
+    Vector<CSS::Parser::Token> tokens;
+};
+
+static constexpr size_t maximum_cached_stylesheet_count = 32;
+static OrderedHashMap<u32, CachedStylesheetTokens>& stylesheet_token_cache()
+{
+    static OrderedHashMap<u32, CachedStylesheetTokens> cache;
+    return cache;
+}
+
+static Vector<CSS::Parser::Token> tokenize_css_stylesheet(StringView css)
+{
+    auto& cache = stylesheet_token_cache();
+    auto source_hash = css.hash();
+    if (auto it = cache.find(source_hash); it != cache.end() && it->value.source == css) {
+        auto entry = it->value;
+        // Re-insert to refresh this entry's position in LRU order.
+        cache.remove(source_hash);
+        cache.set(source_hash, entry);
+        return move(entry.tokens);
+    }
+
+    auto tokens = CSS::Parser::Tokenizer(css, "utf-8").parse();
+    while (cache.size() >= maximum_cached_stylesheet_count)
+        cache.remove(cache.begin()->key);
+    cache.set(source_hash, { css, tokens });
+    return tokens;
+}
+
 CSS::CSSStyleSheet* parse_css_stylesheet(CSS::Parser::ParsingContext const& context, StringView css, Optional<AK::URL> location)
 {
     if (css.is_empty())
         return CSS::CSSStyleSheet::create(context.realm(), *CSS::CSSRuleList::create_empty(context.realm()), *CSS::MediaList::create(context.realm(), {}), location);
-    CSS::Parser::Parser parser(context, css);
+    CSS::Parser::Parser parser(context, tokenize_css_stylesheet(css));
     return parser.parse_as_css_stylesheet(location);
 }
 
@@ -60,6 +60,7 @@ private:
 class Parser {
 public:
     Parser(ParsingContext const&, StringView input, DeprecatedString const& encoding = "utf-8");
+    Parser(ParsingContext const&, Vector<Token> tokens);
     ~Parser() = default;
 
     CSSStyleSheet* parse_as_css_stylesheet(Optional<AK::URL> location);
@@ -118,6 +118,44 @@ u32 Selector::specificity() const
     return *m_specificity;
 }
 
+Vector<u32> const& Selector::ancestor_hashes() const
+{
+    if (m_ancestor_hashes.has_value())
+        return *m_ancestor_hashes;
+
+    // Only compounds that are guaranteed to match an ancestor of the rightmost
+    // compound's element contribute hashes. Crossing a descendant or child
+    // combinator moves us to an ancestor. Sibling combinators keep us on the
+    // same level (siblings share their ancestors), so the compound immediately
+    // to the left of a sibling combinator is skipped, but compounds further
+    // left may still be ancestors.
+    Vector<u32> hashes;
+    for (size_t i = m_compound_selectors.size(); i > 1; --i) {
+        auto combinator = m_compound_selectors[i - 1].combinator;
+        if (combinator == Combinator::Column)
+            break;
+        if (combinator != Combinator::Descendant && combinator != Combinator::ImmediateChild)
+            continue;
+        for (auto const& simple_selector : m_compound_selectors[i - 2].simple_selectors) {
+            switch (simple_selector.type) {
+            case SimpleSelector::Type::TagName:
+                hashes.append(ancestor_tag_name_hash(simple_selector.lowercase_name()));
+                break;
+            case SimpleSelector::Type::Id:
+                hashes.append(ancestor_id_hash(simple_selector.name()));
+                break;
+            case SimpleSelector::Type::Class:
+                hashes.append(ancestor_class_hash(simple_selector.name()));
+                break;
+            default:
+                break;
+            }
+        }
+    }
+    m_ancestor_hashes = move(hashes);
+    return *m_ancestor_hashes;
+}
+
 // https://www.w3.org/TR/cssom/#serialize-a-simple-selector
 DeprecatedString Selector::SimpleSelector::serialize() const
 {
@@ -9,6 +9,7 @@
 
 #include <AK/DeprecatedString.h>
 #include <AK/FlyString.h>
+#include <AK/HashFunctions.h>
 #include <AK/NonnullRefPtrVector.h>
 #include <AK/RefCounted.h>
 #include <AK/Vector.h>
@@ -202,11 +203,24 @@ public:
     u32 specificity() const;
     DeprecatedString serialize() const;
 
+    // Hashes of the tag names, classes and ids that any matching element is
+    // guaranteed to have among its ancestors. The style computer uses these to
+    // reject rules without running the full selector engine.
+    // See StyleComputer::collect_matching_rules().
+    Vector<u32> const& ancestor_hashes() const;
+
+    // The three identifier kinds are salted apart so that e.g. "div" used as a
+    // class name doesn't collide with the div tag name.
+    static u32 ancestor_tag_name_hash(FlyString const& lowercase_tag_name) { return pair_int_hash(lowercase_tag_name.hash(), 1); }
+    static u32 ancestor_class_hash(FlyString const& class_name) { return pair_int_hash(class_name.hash(), 2); }
+    static u32 ancestor_id_hash(FlyString const& id) { return pair_int_hash(id.hash(), 3); }
+
 private:
     explicit Selector(Vector<CompoundSelector>&&);
 
     Vector<CompoundSelector> m_compound_selectors;
     mutable Optional<u32> m_specificity;
+    mutable Optional<Vector<u32>> m_ancestor_hashes;
     Optional<Selector::PseudoElement> m_pseudo_element;
 };
 
@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/Debug.h>
 #include <AK/Error.h>
 #include <AK/HashMap.h>
@@ -148,55 +149,83 @@ void StyleComputer::for_each_stylesheet(CascadeOrigin cascade_origin, Callback c
     }
 }
 
+// A Bloom filter of every tag name, class and id found on an element's
+// ancestors. It may report false positives but never false negatives, so it
+// can only be used to skip selectors, never to match them.
+class AncestorFilter {
+public:
+    void add(u32 hash)
+    {
+        m_buckets[first_bucket(hash)] |= 1ull << first_bit(hash);
+        m_buckets[second_bucket(hash)] |= 1ull << second_bit(hash);
+    }
+
+    bool may_contain(u32 hash) const
+    {
+        return (m_buckets[first_bucket(hash)] & (1ull << first_bit(hash)))
+            && (m_buckets[second_bucket(hash)] & (1ull << second_bit(hash)));
+    }
+
+private:
+    static constexpr size_t bucket_count = 4;
+
+    static size_t first_bucket(u32 hash) { return (hash >> 6) % bucket_count; }
+    static size_t first_bit(u32 hash) { return hash & 63; }
+    static size_t second_bucket(u32 hash) { return (hash >> 22) % bucket_count; }
+    static size_t second_bit(u32 hash) { return (hash >> 16) & 63; }
+
+    Array<u64, bucket_count> m_buckets {};
+};
+
 Vector<MatchingRule> StyleComputer::collect_matching_rules(DOM::Element const& element, CascadeOrigin cascade_origin, Optional<CSS::Selector::PseudoElement> pseudo_element) const
 {
-    if (cascade_origin == CascadeOrigin::Author) {
-        Vector<MatchingRule> rules_to_run;
-        if (pseudo_element.has_value()) {
-            if (auto it = m_rule_cache->rules_by_pseudo_element.find(pseudo_element.value()); it != m_rule_cache->rules_by_pseudo_element.end())
+    auto const& rule_cache = rule_cache_for_cascade_origin(cascade_origin);
+
+    Vector<MatchingRule> rules_to_run;
+    if (pseudo_element.has_value()) {
+        if (auto it = rule_cache.rules_by_pseudo_element.find(pseudo_element.value()); it != rule_cache.rules_by_pseudo_element.end())
+            rules_to_run.extend(it->value);
+    } else {
+        for (auto const& class_name : element.class_names()) {
+            if (auto it = rule_cache.rules_by_class.find(class_name); it != rule_cache.rules_by_class.end())
                 rules_to_run.extend(it->value);
-        } else {
-            for (auto const& class_name : element.class_names()) {
-                if (auto it = m_rule_cache->rules_by_class.find(class_name); it != m_rule_cache->rules_by_class.end())
-                    rules_to_run.extend(it->value);
-            }
-            if (auto id = element.get_attribute(HTML::AttributeNames::id); !id.is_null()) {
-                if (auto it = m_rule_cache->rules_by_id.find(id); it != m_rule_cache->rules_by_id.end())
-                    rules_to_run.extend(it->value);
-            }
-            if (auto it = m_rule_cache->rules_by_tag_name.find(element.local_name()); it != m_rule_cache->rules_by_tag_name.end())
+        }
+        if (auto id = element.get_attribute(HTML::AttributeNames::id); !id.is_null()) {
+            if (auto it = rule_cache.rules_by_id.find(id); it != rule_cache.rules_by_id.end())
                 rules_to_run.extend(it->value);
-            rules_to_run.extend(m_rule_cache->other_rules);
         }
+        if (auto it = rule_cache.rules_by_tag_name.find(element.local_name()); it != rule_cache.rules_by_tag_name.end())
+            rules_to_run.extend(it->value);
+        rules_to_run.extend(rule_cache.other_rules);
+    }
 
-        Vector<MatchingRule> matching_rules;
-        matching_rules.ensure_capacity(rules_to_run.size());
-        for (auto const& rule_to_run : rules_to_run) {
-            auto const& selector = rule_to_run.rule->selectors()[rule_to_run.selector_index];
-            if (SelectorEngine::matches(selector, element, pseudo_element))
-                matching_rules.append(rule_to_run);
-        }
-        return matching_rules;
+    AncestorFilter ancestor_filter;
+    for (auto const* ancestor = element.parent_element(); ancestor; ancestor = ancestor->parent_element()) {
+        ancestor_filter.add(Selector::ancestor_tag_name_hash(ancestor->local_name().to_lowercase()));
+        if (auto id = ancestor->get_attribute(HTML::AttributeNames::id); !id.is_null())
+            ancestor_filter.add(Selector::ancestor_id_hash(id));
+        for (auto const& class_name : ancestor->class_names())
+            ancestor_filter.add(Selector::ancestor_class_hash(class_name));
     }
 
     Vector<MatchingRule> matching_rules;
-    size_t style_sheet_index = 0;
-    for_each_stylesheet(cascade_origin, [&](auto& sheet) {
-        size_t rule_index = 0;
-        sheet.for_each_effective_style_rule([&](auto const& rule) {
-            size_t selector_index = 0;
-            for (auto& selector : rule.selectors()) {
-                if (SelectorEngine::matches(selector, element, pseudo_element)) {
-                    matching_rules.append({ &rule, style_sheet_index, rule_index, selector_index, selector.specificity() });
-                    break;
-                }
-                ++selector_index;
+    matching_rules.ensure_capacity(rules_to_run.size());
+    for (auto const& rule_to_run : rules_to_run) {
+        auto const& selector = rule_to_run.rule->selectors()[rule_to_run.selector_index];
+        // If the selector demands an ancestor this element doesn't have, we can
+        // reject it without running the selector engine at all.
+        bool excluded_by_ancestor_filter = false;
+        for (u32 hash : selector.ancestor_hashes()) {
+            if (!ancestor_filter.may_contain(hash)) {
+                excluded_by_ancestor_filter = true;
+                break;
             }
-            ++rule_index;
-        });
-        ++style_sheet_index;
-    });
-
+        }
+        if (excluded_by_ancestor_filter)
+            continue;
+        if (SelectorEngine::matches(selector, element, pseudo_element))
+            matching_rules.append(rule_to_run);
+    }
     return matching_rules;
 }
 
@@ -1353,16 +1382,26 @@ bool PropertyDependencyNode::has_cycles()
 
 void StyleComputer::build_rule_cache_if_needed() const
 {
-    if (m_rule_cache)
+    if (m_author_rule_cache && m_user_agent_rule_cache)
         return;
     const_cast<StyleComputer&>(*this).build_rule_cache();
 }
 
-void StyleComputer::build_rule_cache()
+StyleComputer::RuleCache const& StyleComputer::rule_cache_for_cascade_origin(CascadeOrigin cascade_origin) const
 {
-    // FIXME: Make a rule cache for UA style as well.
+    switch (cascade_origin) {
+    case CascadeOrigin::Author:
+        return *m_author_rule_cache;
+    case CascadeOrigin::UserAgent:
+        return *m_user_agent_rule_cache;
+    default:
+        VERIFY_NOT_REACHED();
+    }
+}
 
-    m_rule_cache = make<RuleCache>();
+NonnullOwnPtr<StyleComputer::RuleCache> StyleComputer::make_rule_cache_for_cascade_origin(CascadeOrigin cascade_origin)
+{
+    auto rule_cache = make<RuleCache>();
 
     size_t num_class_rules = 0;
     size_t num_id_rules = 0;
@@ -1371,7 +1410,7 @@ void StyleComputer::build_rule_cache()
 
     Vector<MatchingRule> matching_rules;
     size_t style_sheet_index = 0;
-    for_each_stylesheet(CascadeOrigin::Author, [&](auto& sheet) {
+    for_each_stylesheet(cascade_origin, [&](auto& sheet) {
         size_t rule_index = 0;
         sheet.for_each_effective_style_rule([&](auto const& rule) {
             size_t selector_index = 0;
@@ -1381,7 +1420,7 @@ void StyleComputer::build_rule_cache()
                 bool added_to_bucket = false;
                 for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
                     if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoElement) {
-                        m_rule_cache->rules_by_pseudo_element.ensure(simple_selector.pseudo_element()).append(move(matching_rule));
+                        rule_cache->rules_by_pseudo_element.ensure(simple_selector.pseudo_element()).append(move(matching_rule));
                         ++num_pseudo_element_rules;
                         added_to_bucket = true;
                         break;
@@ -1390,19 +1429,19 @@ void StyleComputer::build_rule_cache()
                 if (!added_to_bucket) {
                     for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
                         if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Id) {
-                            m_rule_cache->rules_by_id.ensure(simple_selector.name()).append(move(matching_rule));
+                            rule_cache->rules_by_id.ensure(simple_selector.name()).append(move(matching_rule));
                             ++num_id_rules;
                             added_to_bucket = true;
                             break;
                         }
                         if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Class) {
-                            m_rule_cache->rules_by_class.ensure(simple_selector.name()).append(move(matching_rule));
+                            rule_cache->rules_by_class.ensure(simple_selector.name()).append(move(matching_rule));
                             ++num_class_rules;
                             added_to_bucket = true;
                             break;
                         }
                         if (simple_selector.type == CSS::Selector::SimpleSelector::Type::TagName) {
-                            m_rule_cache->rules_by_tag_name.ensure(simple_selector.name()).append(move(matching_rule));
+                            rule_cache->rules_by_tag_name.ensure(simple_selector.name()).append(move(matching_rule));
                             ++num_tag_name_rules;
                             added_to_bucket = true;
                             break;
@@ -1410,7 +1449,7 @@ void StyleComputer::build_rule_cache()
                     }
                 }
                 if (!added_to_bucket)
-                    m_rule_cache->other_rules.append(move(matching_rule));
+                    rule_cache->other_rules.append(move(matching_rule));
 
                 ++selector_index;
             }
@@ -1425,14 +1464,25 @@ void StyleComputer::build_rule_cache()
         dbgln("        Class: {}", num_class_rules);
         dbgln("      TagName: {}", num_tag_name_rules);
         dbgln("PseudoElement: {}", num_pseudo_element_rules);
-        dbgln("        Other: {}", m_rule_cache->other_rules.size());
-        dbgln("        Total: {}", num_class_rules + num_id_rules + num_tag_name_rules + m_rule_cache->other_rules.size());
+        dbgln("        Other: {}", rule_cache->other_rules.size());
+        dbgln("        Total: {}", num_class_rules + num_id_rules + num_tag_name_rules + rule_cache->other_rules.size());
     }
+    return rule_cache;
+}
+
+void StyleComputer::build_rule_cache()
+{
+    // NOTE: The UA cache is rebuilt along with the author cache. That keeps it
+    //       in sync with the document's quirks mode, which decides whether the
+    //       quirks mode stylesheet is included.
+    m_author_rule_cache = make_rule_cache_for_cascade_origin(CascadeOrigin::Author);
+    m_user_agent_rule_cache = make_rule_cache_for_cascade_origin(CascadeOrigin::UserAgent);
 }
 
 void StyleComputer::invalidate_rule_cache()
 {
-    m_rule_cache = nullptr;
+    m_author_rule_cache = nullptr;
+    m_user_agent_rule_cache = nullptr;
 }
 
 Gfx::IntRect StyleComputer::viewport_rect() const
@@ -22,6 +22,7 @@ public:
     virtual Optional<StringView> comment_prefix() const override { return "/*"sv; }
     virtual Optional<StringView> comment_suffix() const override { return "*/"sv; }
     virtual void rehighlight(Palette const&) override;
+    virtual OwnPtr<Syntax::Highlighter> clone() const override { return make<SyntaxHighlighter>(); }
 
 protected:
     virtual Vector<MatchingTokenPair> matching_token_pairs_impl() const override;
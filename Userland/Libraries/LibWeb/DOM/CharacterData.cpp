@@ -104,7 +104,10 @@ WebIDL::ExceptionOr<void> CharacterData::replace_data(size_t offset, size_t coun
         parent()->children_changed();
 
     set_needs_style_update(true);
-    document().set_needs_layout();
+    if (auto* layout_node = this->layout_node())
+        document().set_needs_subtree_layout(*layout_node);
+    else
+        document().set_needs_layout();
     return {};
 }
 
@@ -795,6 +795,19 @@ AK::URL Document::parse_url(DeprecatedString const& url) const
 
 void Document::set_needs_layout()
 {
+    // NOTE: Without a specific dirty subtree, we have to assume anything may
+    //       have changed and relayout the whole tree.
+    if (m_layout_root)
+        m_layout_root->set_needs_layout_update(true);
+    if (m_needs_layout)
+        return;
+    m_needs_layout = true;
+    schedule_layout_update();
+}
+
+void Document::set_needs_subtree_layout(Layout::Node& layout_node)
+{
+    layout_node.set_needs_layout_update(true);
     if (m_needs_layout)
         return;
     m_needs_layout = true;
@@ -813,6 +826,183 @@ void Document::invalidate_layout()
     schedule_layout_update();
 }
 
+// A box can serve as the root of a subtree-scoped relayout if its used size
+// cannot be affected by its contents, and its contents cannot affect layout
+// outside of it.
+static bool is_subtree_layout_boundary(Layout::Box const& box)
+{
+    if (!is<Layout::BlockContainer>(box))
+        return false;
+    if (box.is_anonymous() || !box.paint_box())
+        return false;
+    // Internal table boxes are sized by the table algorithm, not by their computed values.
+    if (box.display().is_internal() || box.display().is_table_inside())
+        return false;
+    if (!box.display().is_flow_inside() && !box.display().is_flow_root_inside())
+        return false;
+    // Overflowing content must not be visible outside the box.
+    if (box.computed_values().overflow_x() == CSS::Overflow::Visible || box.computed_values().overflow_y() == CSS::Overflow::Visible)
+        return false;
+    if (!Layout::FormattingContext::creates_block_formatting_context(box))
+        return false;
+    auto is_fixed_size = [](CSS::Size const& size) {
+        return size.is_length() && !size.length().is_calculated();
+    };
+    auto const& computed_values = box.computed_values();
+    if (!is_fixed_size(computed_values.width()) || !is_fixed_size(computed_values.height()))
+        return false;
+    // Min/max constraints may reintroduce a dependency on the contents.
+    if (!computed_values.min_width().is_auto() && !is_fixed_size(computed_values.min_width()))
+        return false;
+    if (!computed_values.min_height().is_auto() && !is_fixed_size(computed_values.min_height()))
+        return false;
+    if (!computed_values.max_width().is_none() && !is_fixed_size(computed_values.max_width()))
+        return false;
+    if (!computed_values.max_height().is_none() && !is_fixed_size(computed_values.max_height()))
+        return false;
+    return true;
+}
+
+// Pre-populates a box's UsedValues from its committed geometry, so that
+// re-committing it is a no-op and descendants can resolve against it.
+static void seed_used_values_from_committed_layout(Layout::LayoutState& layout_state, Layout::Box const& box)
+{
+    auto& used_values = layout_state.get_mutable(box);
+    auto const& paint_box = *box.paint_box();
+    used_values.set_content_width(paint_box.content_width());
+    used_values.set_content_height(paint_box.content_height());
+    used_values.set_content_offset(paint_box.offset());
+    used_values.overflow_data = paint_box.overflow_data();
+    used_values.containing_line_box_fragment = paint_box.containing_line_box_fragment();
+
+    auto const& box_model = box.box_model();
+    used_values.margin_top = box_model.margin.top;
+    used_values.margin_right = box_model.margin.right;
+    used_values.margin_bottom = box_model.margin.bottom;
+    used_values.margin_left = box_model.margin.left;
+    used_values.border_top = box_model.border.top;
+    used_values.border_right = box_model.border.right;
+    used_values.border_bottom = box_model.border.bottom;
+    used_values.border_left = box_model.border.left;
+    used_values.padding_top = box_model.padding.top;
+    used_values.padding_right = box_model.padding.right;
+    used_values.padding_bottom = box_model.padding.bottom;
+    used_values.padding_left = box_model.padding.left;
+    used_values.inset_top = box_model.inset.top;
+    used_values.inset_right = box_model.inset.right;
+    used_values.inset_bottom = box_model.inset.bottom;
+    used_values.inset_left = box_model.inset.left;
+}
+
+template<typename Callback>
+static void for_each_dirty_layout_subtree(Layout::Node& layout_node, Callback const& callback)
+{
+    if (layout_node.needs_layout_update()) {
+        callback(layout_node);
+        return;
+    }
+    if (!layout_node.child_needs_layout_update())
+        return;
+    layout_node.for_each_child([&](auto& child) {
+        for_each_dirty_layout_subtree(child, callback);
+        return IterationDecision::Continue;
+    });
+}
+
+bool Document::attempt_subtree_layout()
+{
+    VERIFY(m_layout_root);
+
+    // If the root itself is dirty, somebody asked for a full relayout.
+    if (m_layout_root->needs_layout_update())
+        return false;
+    if (!m_layout_root->child_needs_layout_update())
+        return false;
+
+    // Find a relayout boundary for each dirty subtree. If any dirty node has
+    // no boundary below the initial containing block, fall back to full layout.
+    Vector<Layout::Box const*> boundaries;
+    bool can_layout_incrementally = true;
+    for_each_dirty_layout_subtree(*m_layout_root, [&](Layout::Node& dirty_node) {
+        Layout::Box const* boundary = nullptr;
+        for (auto const* box = dirty_node.containing_block(); box && !box->is_initial_containing_block_box(); box = box->containing_block()) {
+            if (is_subtree_layout_boundary(*box)) {
+                boundary = box;
+                break;
+            }
+        }
+        if (!boundary) {
+            can_layout_incrementally = false;
+            return;
+        }
+        boundaries.remove_all_matching([&](auto* existing_boundary) { return boundary->is_inclusive_ancestor_of(*existing_boundary); });
+        for (auto* existing_boundary : boundaries) {
+            if (existing_boundary->is_inclusive_ancestor_of(*boundary))
+                return;
+        }
+        boundaries.append(boundary);
+    });
+    if (!can_layout_incrementally || boundaries.is_empty())
+        return false;
+
+    for (auto* boundary : boundaries) {
+        // The containing block chain will be seeded from committed geometry and
+        // re-committed as-is; that would throw away any line boxes, so bail if
+        // an ancestor has inline children.
+        for (auto const* ancestor = boundary->containing_block(); ancestor; ancestor = ancestor->containing_block()) {
+            if (!ancestor->paint_box())
+                return false;
+            if (ancestor->children_are_inline())
+                return false;
+        }
+        // Out-of-flow descendants are laid out by the formatting context of
+        // their containing block; if that is outside the subtree, the subtree
+        // is not self-contained.
+        bool subtree_is_self_contained = true;
+        boundary->for_each_in_subtree_of_type<Layout::Box>([&](auto& box) {
+            if (box.is_absolutely_positioned()) {
+                auto const* containing_block = box.containing_block();
+                if (!containing_block || (containing_block != boundary && !boundary->is_ancestor_of(*containing_block))) {
+                    subtree_is_self_contained = false;
+                    return IterationDecision::Break;
+                }
+            }
+            return IterationDecision::Continue;
+        });
+        if (!subtree_is_self_contained)
+            return false;
+    }
+
+    for (auto* boundary : boundaries) {
+        Layout::LayoutState layout_state;
+        layout_state.used_values_per_layout_node.resize(layout_node_count());
+
+        // Seed the containing block chain (outermost first) and the boundary
+        // itself, so nothing outside the subtree moves when we commit.
+        Vector<Layout::Box const*> chain;
+        chain.append(boundary);
+        for (auto const* ancestor = boundary->containing_block(); ancestor; ancestor = ancestor->containing_block())
+            chain.append(ancestor);
+        for (size_t i = chain.size(); i > 0; --i)
+            seed_used_values_from_committed_layout(layout_state, *chain[i - 1]);
+
+        {
+            auto const& block_container = static_cast<Layout::BlockContainer const&>(*boundary);
+            Layout::BlockFormattingContext context(layout_state, block_container, nullptr);
+            context.run(
+                *boundary,
+                Layout::LayoutMode::Normal,
+                Layout::AvailableSpace(
+                    Layout::AvailableSize::make_definite(boundary->paint_box()->content_width()),
+                    Layout::AvailableSize::make_definite(boundary->paint_box()->content_height())));
+        }
+
+        layout_state.commit();
+    }
+
+    return true;
+}
+
 void Document::update_layout()
 {
     // NOTE: If our parent document needs a relayout, we must do that *first*.
@@ -832,34 +1022,46 @@ void Document::update_layout()
     if (!browsing_context())
         return;
 
-    auto viewport_rect = browsing_context()->viewport_rect();
+    bool performed_subtree_layout = false;
+    if (m_layout_root)
+        performed_subtree_layout = attempt_subtree_layout();
 
-    if (!m_layout_root) {
-        m_next_layout_node_serial_id = 0;
-        Layout::TreeBuilder tree_builder;
-        m_layout_root = verify_cast<Layout::InitialContainingBlock>(*tree_builder.build(*this));
-    }
+    if (!performed_subtree_layout) {
+        auto viewport_rect = browsing_context()->viewport_rect();
+
+        if (!m_layout_root) {
+            m_next_layout_node_serial_id = 0;
+            Layout::TreeBuilder tree_builder;
+            m_layout_root = verify_cast<Layout::InitialContainingBlock>(*tree_builder.build(*this));
+        }
 
-    Layout::LayoutState layout_state;
-    layout_state.used_values_per_layout_node.resize(layout_node_count());
+        Layout::LayoutState layout_state;
+        layout_state.used_values_per_layout_node.resize(layout_node_count());
 
-    {
-        Layout::BlockFormattingContext root_formatting_context(layout_state, *m_layout_root, nullptr);
+        {
+            Layout::BlockFormattingContext root_formatting_context(layout_state, *m_layout_root, nullptr);
 
-        auto& icb = static_cast<Layout::InitialContainingBlock&>(*m_layout_root);
-        auto& icb_state = layout_state.get_mutable(icb);
-        icb_state.set_content_width(viewport_rect.width());
-        icb_state.set_content_height(viewport_rect.height());
+            auto& icb = static_cast<Layout::InitialContainingBlock&>(*m_layout_root);
+            auto& icb_state = layout_state.get_mutable(icb);
+            icb_state.set_content_width(viewport_rect.width());
+            icb_state.set_content_height(viewport_rect.height());
 
-        root_formatting_context.run(
-            *m_layout_root,
-            Layout::LayoutMode::Normal,
-            Layout::AvailableSpace(
-                Layout::AvailableSize::make_definite(viewport_rect.width()),
-                Layout::AvailableSize::make_definite(viewport_rect.height())));
+            root_formatting_context.run(
+                *m_layout_root,
+                Layout::LayoutMode::Normal,
+                Layout::AvailableSpace(
+                    Layout::AvailableSize::make_definite(viewport_rect.width()),
+                    Layout::AvailableSize::make_definite(viewport_rect.height())));
+        }
+
+        layout_state.commit();
     }
 
-    layout_state.commit();
+    m_layout_root->for_each_in_inclusive_subtree([](auto& layout_node) {
+        layout_node.set_needs_layout_update(false);
+        layout_node.set_child_needs_layout_update(false);
+        return IterationDecision::Continue;
+    });
 
     browsing_context()->set_needs_display();
 
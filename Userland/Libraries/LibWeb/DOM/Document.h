@@ -191,6 +191,11 @@ public:
 
     void set_needs_layout();
 
+    // Marks only the given layout subtree as needing layout. Prefer this over
+    // set_needs_layout() when a mutation is known to be contained in one
+    // subtree, so update_layout() can attempt a subtree-scoped relayout.
+    void set_needs_subtree_layout(Layout::Node&);
+
     void invalidate_layout();
     void invalidate_stacking_context_tree();
 
@@ -456,6 +461,8 @@ private:
 
     void tear_down_layout_tree();
 
+    [[nodiscard]] bool attempt_subtree_layout();
+
     void evaluate_media_rules();
 
     WebIDL::ExceptionOr<void> run_the_document_write_steps(DeprecatedString);
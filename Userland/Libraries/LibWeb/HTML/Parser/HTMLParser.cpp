@@ -214,6 +214,86 @@ void HTMLParser::run(const AK::URL& url)
     m_document->detach_parser({});
 }
 
+// Returns the length of the longest prefix of `bytes` that doesn't end in the
+// middle of a multi-byte UTF-8 sequence.
+static size_t length_without_trailing_incomplete_utf8_sequence(ReadonlyBytes bytes)
+{
+    // Look back at most 3 bytes for the start of a multi-byte sequence.
+    for (size_t i = 1; i <= 3 && i <= bytes.size(); ++i) {
+        u8 byte = bytes[bytes.size() - i];
+        if ((byte & 0xc0) == 0x80) {
+            // Continuation byte; keep looking for the sequence start.
+            continue;
+        }
+        size_t sequence_length = 1;
+        if ((byte & 0xe0) == 0xc0)
+            sequence_length = 2;
+        else if ((byte & 0xf0) == 0xe0)
+            sequence_length = 3;
+        else if ((byte & 0xf8) == 0xf0)
+            sequence_length = 4;
+        if (sequence_length > i)
+            return bytes.size() - i;
+        break;
+    }
+    return bytes.size();
+}
+
+void HTMLParser::feed(ByteBuffer const& chunk)
+{
+    VERIFY(!m_aborted);
+
+    // The first chunk determines the encoding, since that's all the sniffing
+    // algorithm is going to see.
+    if (!m_streaming_decoder) {
+        auto encoding = m_document->has_encoding()
+            ? m_document->encoding().value()
+            : run_encoding_sniffing_algorithm(*m_document, chunk);
+        dbgln_if(HTML_PARSER_DEBUG, "The encoding sniffing algorithm returned encoding '{}'", encoding);
+        auto standardized_encoding = TextCodec::get_standardized_encoding(encoding);
+        VERIFY(standardized_encoding.has_value());
+        m_streaming_decoder = TextCodec::decoder_for(standardized_encoding.value());
+        VERIFY(m_streaming_decoder);
+        m_streaming_input_is_utf8 = standardized_encoding.value() == "UTF-8";
+        m_document->set_encoding(standardized_encoding.value());
+    }
+
+    m_unparsed_streaming_input.append(chunk.data(), chunk.size());
+
+    auto decodable_length = m_unparsed_streaming_input.size();
+    if (m_streaming_input_is_utf8) {
+        // A multi-byte sequence may be cut off by the chunk boundary; hold its
+        // bytes back until the rest of it arrives.
+        decodable_length = length_without_trailing_incomplete_utf8_sequence(m_unparsed_streaming_input);
+    }
+    if (decodable_length == 0)
+        return;
+
+    auto decoded = m_streaming_decoder->to_utf8(StringView { m_unparsed_streaming_input.data(), decodable_length });
+    m_unparsed_streaming_input.remove(0, decodable_length);
+    m_tokenizer.append_input(decoded);
+    run();
+}
+
+void HTMLParser::finish()
+{
+    VERIFY(!m_aborted);
+
+    if (!m_unparsed_streaming_input.is_empty() && m_streaming_decoder) {
+        // Whatever is left was cut off by the end of the stream; hand it to
+        // the decoder as-is.
+        auto decoded = m_streaming_decoder->to_utf8(StringView { m_unparsed_streaming_input.data(), m_unparsed_streaming_input.size() });
+        m_unparsed_streaming_input.clear();
+        m_tokenizer.append_input(decoded);
+    }
+
+    m_document->set_source(m_tokenizer.source());
+    m_tokenizer.insert_eof();
+    run();
+    the_end();
+    m_document->detach_parser({});
+}
+
 // https://html.spec.whatwg.org/multipage/parsing.html#the-end
 void HTMLParser::the_end()
 {
@@ -3543,6 +3623,13 @@ JS::NonnullGCPtr<HTMLParser> HTMLParser::create_for_scripting(DOM::Document& doc
     return *document.heap().allocate_without_realm<HTMLParser>(document);
 }
 
+JS::NonnullGCPtr<HTMLParser> HTMLParser::create_for_streaming(DOM::Document& document)
+{
+    auto* parser = document.heap().allocate_without_realm<HTMLParser>(document);
+    parser->m_tokenizer.set_incremental_input(true);
+    return *parser;
+}
+
 JS::NonnullGCPtr<HTMLParser> HTMLParser::create_with_uncertain_encoding(DOM::Document& document, ByteBuffer const& input)
 {
     if (document.has_encoding())
@@ -12,6 +12,10 @@
 #include <LibWeb/HTML/Parser/ListOfActiveFormattingElements.h>
 #include <LibWeb/HTML/Parser/StackOfOpenElements.h>
 
+namespace TextCodec {
+class Decoder;
+}
+
 namespace Web::HTML {
 
 #define ENUMERATE_INSERTION_MODES               \
@@ -50,10 +54,17 @@ public:
     static JS::NonnullGCPtr<HTMLParser> create_for_scripting(DOM::Document&);
     static JS::NonnullGCPtr<HTMLParser> create_with_uncertain_encoding(DOM::Document&, ByteBuffer const& input);
     static JS::NonnullGCPtr<HTMLParser> create(DOM::Document&, StringView input, DeprecatedString const& encoding);
+    static JS::NonnullGCPtr<HTMLParser> create_for_streaming(DOM::Document&);
 
     void run();
     void run(const AK::URL&);
 
+    // Streaming interface: feed() network bytes as they arrive, then finish()
+    // once the stream ends. The document tree grows after every chunk instead
+    // of waiting for the last byte.
+    void feed(ByteBuffer const& chunk);
+    void finish();
+
     DOM::Document& document();
 
     static Vector<JS::Handle<DOM::Node>> parse_html_fragment(DOM::Element& context_element, StringView);
@@ -194,6 +205,10 @@ private:
 
     Vector<HTMLToken> m_pending_table_character_tokens;
 
+    TextCodec::Decoder* m_streaming_decoder { nullptr };
+    bool m_streaming_input_is_utf8 { false };
+    Vector<u8> m_unparsed_streaming_input;
+
     JS::GCPtr<DOM::Text> m_character_insertion_node;
     StringBuilder m_character_insertion_builder;
 };
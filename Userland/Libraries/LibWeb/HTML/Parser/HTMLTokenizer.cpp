@@ -99,7 +99,13 @@ namespace Web::HTML {
 #define ON(code_point) \
     if (current_input_character.has_value() && current_input_character.value() == code_point)
 
-#define ON_EOF \
+#define ON_EOF                                    \
+    if (!current_input_character.has_value()) {   \
+        if (should_wait_for_more_input()) {       \
+            restore_input_checkpoint();           \
+            return {};                            \
+        }                                         \
+    }                                             \
     if (!current_input_character.has_value())
 
 #define ON_ASCII_ALPHA \
@@ -188,6 +194,12 @@ Optional<u32> HTMLTokenizer::next_code_point()
     if (m_utf8_iterator == m_utf8_view.end())
         return {};
 
+    // If the input stream may still grow, a trailing CR cannot be normalized
+    // yet: the next chunk might start with LF. Hold it back until more input
+    // arrives or EOF is inserted.
+    if (should_wait_for_more_input() && peek_code_point(0).value_or(0) == '\r' && !peek_code_point(1).has_value())
+        return {};
+
     u32 code_point;
     // https://html.spec.whatwg.org/multipage/parsing.html#preprocessing-the-input-stream:tokenization
     // https://infra.spec.whatwg.org/#normalize-newlines
@@ -248,6 +260,11 @@ HTMLToken::Position HTMLTokenizer::nth_last_position(size_t n)
 
 Optional<HTMLToken> HTMLTokenizer::next_token()
 {
+    // NOTE: Every queued token was already accounted for by an earlier
+    //       checkpoint, so a new one is only captured once the queue is empty
+    //       and we're actually about to consume input.
+    if (m_incremental_input && m_queued_tokens.is_empty())
+        capture_input_checkpoint();
     if (!m_source_positions.is_empty()) {
         auto last_position = m_source_positions.last();
         m_source_positions.clear_with_capacity();
@@ -262,6 +279,14 @@ _StartOfFunction:
 
     for (;;) {
         auto current_input_character = next_code_point();
+        // Running dry in the middle of a token while the input stream may
+        // still grow is not an EOF: rewind to the last token boundary and try
+        // again once more input has been appended. (States that consume via
+        // SWITCH_TO get the same treatment from the ON_EOF macro.)
+        if (!current_input_character.has_value() && should_wait_for_more_input()) {
+            restore_input_checkpoint();
+            return {};
+        }
         switch (m_state) {
             // 13.2.5.1 Data state, https://html.spec.whatwg.org/multipage/parsing.html#data-state
             BEGIN_STATE(Data)
@@ -1642,6 +1667,21 @@ _StartOfFunction:
 
                 auto match = HTML::code_points_from_entity(m_decoded_input.substring_view(byte_offset, m_decoded_input.length() - byte_offset));
 
+                if (should_wait_for_more_input()) {
+                    // The named character reference might continue in the next
+                    // chunk, in which case the (longest) match would come out
+                    // differently. The longest named character reference is 33
+                    // code points, so anything shorter at the very end of the
+                    // input can still grow into a different match.
+                    static constexpr size_t longest_entity_length = 33;
+                    auto remaining_length = m_decoded_input.length() - byte_offset;
+                    bool match_may_change = !match.has_value() || (!match->entity.ends_with(';') && byte_offset + match->entity.length() >= m_decoded_input.length());
+                    if (remaining_length < longest_entity_length && match_may_change) {
+                        restore_input_checkpoint();
+                        return {};
+                    }
+                }
+
                 if (match.has_value()) {
                     skip(match->entity.length() - 1);
                     for (auto ch : match.value().entity)
@@ -2824,6 +2864,51 @@ void HTMLTokenizer::insert_input_at_insertion_point(DeprecatedString const& inpu
     m_insertion_point.position += input.length();
 }
 
+void HTMLTokenizer::append_input(StringView input)
+{
+    auto utf8_iterator_byte_offset = m_utf8_view.byte_offset_of(m_utf8_iterator);
+    auto prev_utf8_iterator_byte_offset = m_utf8_view.byte_offset_of(m_prev_utf8_iterator);
+
+    // FIXME: Implement a InputStream to handle appending and iterators.
+    StringBuilder builder {};
+    builder.append(m_decoded_input);
+    builder.append(input);
+    m_decoded_input = builder.build();
+
+    m_utf8_view = Utf8View(m_decoded_input);
+    m_utf8_iterator = m_utf8_view.iterator_at_byte_offset(utf8_iterator_byte_offset);
+    m_prev_utf8_iterator = m_utf8_view.iterator_at_byte_offset(prev_utf8_iterator_byte_offset);
+}
+
+void HTMLTokenizer::capture_input_checkpoint()
+{
+    m_input_checkpoint.state = m_state;
+    m_input_checkpoint.return_state = m_return_state;
+    m_input_checkpoint.temporary_buffer = m_temporary_buffer;
+    m_input_checkpoint.current_builder_contents = m_current_builder.to_deprecated_string();
+    m_input_checkpoint.character_reference_code = m_character_reference_code;
+    m_input_checkpoint.iterator_byte_offset = m_utf8_view.byte_offset_of(m_utf8_iterator);
+    m_input_checkpoint.prev_iterator_byte_offset = m_utf8_view.byte_offset_of(m_prev_utf8_iterator);
+    m_input_checkpoint.source_positions = m_source_positions;
+}
+
+void HTMLTokenizer::restore_input_checkpoint()
+{
+    m_state = m_input_checkpoint.state;
+    m_return_state = m_input_checkpoint.return_state;
+    m_temporary_buffer = m_input_checkpoint.temporary_buffer;
+    m_current_builder.clear();
+    m_current_builder.append(m_input_checkpoint.current_builder_contents);
+    m_character_reference_code = m_input_checkpoint.character_reference_code;
+    m_utf8_iterator = m_utf8_view.iterator_at_byte_offset(m_input_checkpoint.iterator_byte_offset);
+    m_prev_utf8_iterator = m_utf8_view.iterator_at_byte_offset(m_input_checkpoint.prev_iterator_byte_offset);
+    m_source_positions = m_input_checkpoint.source_positions;
+    // Whatever was tokenized since the checkpoint will be tokenized again once
+    // more input has arrived, so drop the results of the aborted attempt.
+    m_current_token = {};
+    m_queued_tokens.clear();
+}
+
 void HTMLTokenizer::insert_eof()
 {
     m_explicit_eof_inserted = true;
@@ -129,6 +129,13 @@ public:
     void insert_eof();
     bool is_eof_inserted();
 
+    // In incremental input mode the input stream may grow via append_input().
+    // Instead of emitting an end-of-file token when it runs out of input, the
+    // tokenizer rewinds to the last token boundary and waits for more input;
+    // insert_eof() marks the stream as complete.
+    void set_incremental_input(bool b) { m_incremental_input = b; }
+    void append_input(StringView);
+
     bool is_insertion_point_defined() const { return m_insertion_point.defined; }
     bool is_insertion_point_reached()
     {
@@ -176,6 +183,10 @@ private:
     void restore_to(Utf8CodePointIterator const& new_iterator);
     HTMLToken::Position nth_last_position(size_t n = 0);
 
+    bool should_wait_for_more_input() const { return m_incremental_input && !m_explicit_eof_inserted && !m_aborted; }
+    void capture_input_checkpoint();
+    void restore_input_checkpoint();
+
     HTMLParser* m_parser { nullptr };
 
     State m_state { State::Data };
@@ -212,6 +223,21 @@ private:
 
     bool m_aborted { false };
 
+    // Snapshot of the tokenizer as of the last token boundary, used to rewind
+    // when an incremental input stream runs dry in the middle of a token.
+    struct InputCheckpoint {
+        State state { State::Data };
+        State return_state { State::Data };
+        Vector<u32> temporary_buffer;
+        DeprecatedString current_builder_contents;
+        u32 character_reference_code { 0 };
+        size_t iterator_byte_offset { 0 };
+        size_t prev_iterator_byte_offset { 0 };
+        Vector<HTMLToken::Position> source_positions;
+    };
+    InputCheckpoint m_input_checkpoint {};
+    bool m_incremental_input { false };
+
     Vector<HTMLToken::Position> m_source_positions;
 };
 
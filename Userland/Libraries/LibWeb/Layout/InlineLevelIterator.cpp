@@ -144,7 +144,7 @@ Optional<InlineLevelIterator::Item> InlineLevelIterator::next(float available_wi
             m_text_node_context->is_last_chunk = true;
 
         auto& chunk = chunk_opt.value();
-        float chunk_width = text_node.font().width(chunk.view) + text_node.font().glyph_spacing();
+        float chunk_width = text_node.chunk_width(chunk);
 
         if (m_text_node_context->do_respect_linebreaks && chunk.has_breaking_newline) {
             return Item {
@@ -149,6 +149,18 @@ InitialContainingBlock& Node::root()
     return *document().layout_node();
 }
 
+void Node::set_needs_layout_update(bool value)
+{
+    if (m_needs_layout_update == value)
+        return;
+    m_needs_layout_update = value;
+
+    if (m_needs_layout_update) {
+        for (auto* ancestor = parent(); ancestor; ancestor = ancestor->parent())
+            ancestor->m_child_needs_layout_update = true;
+    }
+}
+
 void Node::set_needs_display()
 {
     auto* containing_block = this->containing_block();
@@ -123,6 +123,15 @@ public:
     bool is_visible() const { return m_visible; }
     void set_visible(bool visible) { m_visible = visible; }
 
+    // Dirty bits for incremental relayout. Setting the bit also marks
+    // child_needs_layout_update() on all ancestors, so Document::update_layout()
+    // can find dirty subtrees without walking the entire tree.
+    bool needs_layout_update() const { return m_needs_layout_update; }
+    void set_needs_layout_update(bool);
+
+    bool child_needs_layout_update() const { return m_child_needs_layout_update; }
+    void set_child_needs_layout_update(bool b) { m_child_needs_layout_update = b; }
+
     virtual void set_needs_display();
 
     bool children_are_inline() const { return m_children_are_inline; }
@@ -159,6 +168,8 @@ private:
     bool m_anonymous { false };
     bool m_has_style { false };
     bool m_visible { true };
+    bool m_needs_layout_update { false };
+    bool m_child_needs_layout_update { false };
     bool m_children_are_inline { false };
     SelectionState m_selection_state { SelectionState::None };
 
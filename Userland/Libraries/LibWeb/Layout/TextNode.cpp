@@ -91,6 +91,30 @@ void TextNode::compute_text_for_rendering(bool collapse)
     m_text_for_rendering = builder.to_deprecated_string();
 }
 
+// Measuring (shaping) text chunks is by far the most expensive part of inline layout,
+// and incremental relayouts and window resizes re-measure the same unchanged chunks
+// over and over. A chunk's width only depends on the font and the chunk's code points,
+// so we cache measured widths per node, keyed by the chunk's byte range within
+// text_for_rendering(). The cache is discarded whenever the font or the rendered
+// text changes.
+float TextNode::chunk_width(Chunk const& chunk) const
+{
+    auto const& font = this->font();
+    if (m_chunk_width_cache_font != &font || m_chunk_width_cache_text.characters() != m_text_for_rendering.characters()) {
+        m_chunk_width_cache.clear();
+        m_chunk_width_cache_font = font;
+        m_chunk_width_cache_text = m_text_for_rendering;
+    }
+
+    u64 cache_key = (static_cast<u64>(chunk.start) << 32) | static_cast<u64>(chunk.length);
+    if (auto cached_width = m_chunk_width_cache.get(cache_key); cached_width.has_value())
+        return cached_width.value();
+
+    float width = font.width(chunk.view) + font.glyph_spacing();
+    m_chunk_width_cache.set(cache_key, width);
+    return width;
+}
+
 TextNode::ChunkIterator::ChunkIterator(StringView text, bool wrap_lines, bool respect_linebreaks, bool is_generated_empty_string)
     : m_wrap_lines(wrap_lines)
     , m_respect_linebreaks(respect_linebreaks)
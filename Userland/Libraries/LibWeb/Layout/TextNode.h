@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <AK/Utf8View.h>
 #include <LibWeb/DOM/Text.h>
 #include <LibWeb/Layout/Node.h>
@@ -50,12 +51,18 @@ public:
 
     void compute_text_for_rendering(bool collapse);
 
+    float chunk_width(Chunk const&) const;
+
     virtual RefPtr<Painting::Paintable> create_paintable() const override;
 
 private:
     virtual bool is_text_node() const final { return true; }
 
     DeprecatedString m_text_for_rendering;
+
+    mutable RefPtr<Gfx::Font const> m_chunk_width_cache_font;
+    mutable DeprecatedString m_chunk_width_cache_text;
+    mutable HashMap<u64, float> m_chunk_width_cache;
 };
 
 template<>
@@ -39,7 +39,9 @@ void PaintableBox::invalidate_stacking_context()
 
 bool PaintableBox::is_out_of_view(PaintContext& context) const
 {
+    // NOTE: The paint rect is inflated a bit, since a focus outline is drawn just outside the border box.
     return !enclosing_int_rect(absolute_paint_rect())
+                .inflated(8, 8)
                 .translated(context.painter().translation())
                 .intersects(context.painter().clip_rect());
 }
@@ -149,6 +151,13 @@ void PaintableBox::paint(PaintContext& context, PaintPhase phase) const
     if (!is_visible())
         return;
 
+    // Everything a box paints for itself falls within its own paint rect, so if that
+    // rect is entirely outside the painter's clip (scrolled out of view, or untouched
+    // by the invalidated region) we can drop all of its paint commands up front.
+    // Descendants paint through their own paint() calls and are unaffected by this.
+    if (is_out_of_view(context))
+        return;
+
     auto clip_rect = computed_values().clip();
     auto should_clip_rect = clip_rect.is_rect() && layout_box().is_absolutely_positioned();
 
@@ -561,6 +570,16 @@ void PaintableWithLines::paint(PaintContext& context, PaintPhase phase) const
         }
     }
 
+    // Everything a fragment paints for itself falls within its own absolute rect, so
+    // fragments outside the painter's clip (e.g. scrolled out of view) can be culled
+    // without shaping or drawing their text at all.
+    auto fragment_is_out_of_view = [&](auto const& fragment, int inflation = 0) {
+        return !enclosing_int_rect(fragment.absolute_rect())
+                    .inflated(inflation, inflation)
+                    .translated(context.painter().translation())
+                    .intersects(context.painter().clip_rect());
+    };
+
     // Text shadows
     // This is yet another loop, but done here because all shadows should appear under all text.
     // So, we paint the shadows before painting any text.
@@ -582,6 +601,11 @@ void PaintableWithLines::paint(PaintContext& context, PaintPhase phase) const
                                 static_cast<int>(layer.spread_distance.to_px(layout_box())),
                                 ShadowPlacement::Outer);
                         }
+                        int shadow_extent = 0;
+                        for (auto const& shadow : resolved_shadow_data)
+                            shadow_extent = max(shadow_extent, max(AK::abs(shadow.offset_x), AK::abs(shadow.offset_y)) + shadow.blur_radius + shadow.spread_distance);
+                        if (fragment_is_out_of_view(fragment, shadow_extent))
+                            continue;
                         context.painter().set_font(fragment.layout_node().font());
                         Painting::paint_text_shadow(context, fragment, resolved_shadow_data);
                     }
@@ -599,7 +623,7 @@ void PaintableWithLines::paint(PaintContext& context, PaintPhase phase) const
                     fragment_absolute_rect.top_left().translated(0, fragment.baseline()).to_rounded<int>(),
                     fragment_absolute_rect.top_right().translated(0, fragment.baseline()).to_rounded<int>(), Color::Red);
             }
-            if (is<Layout::TextNode>(fragment.layout_node()))
+            if (is<Layout::TextNode>(fragment.layout_node()) && !fragment_is_out_of_view(fragment))
                 paint_text_fragment(context, static_cast<Layout::TextNode const&>(fragment.layout_node()), fragment, phase);
         }
     }
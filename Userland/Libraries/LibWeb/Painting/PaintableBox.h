@@ -35,6 +35,7 @@ public:
     Gfx::FloatRect absolute_rect() const;
     Gfx::FloatPoint effective_offset() const;
 
+    Gfx::FloatPoint offset() const { return m_offset; }
     void set_offset(Gfx::FloatPoint);
     void set_offset(float x, float y) { set_offset({ x, y }); }
 
@@ -98,7 +99,10 @@ public:
 
     Optional<Gfx::IntRect> clip_rect() const;
 
+    Optional<OverflowData> const& overflow_data() const { return m_overflow_data; }
     void set_overflow_data(Optional<OverflowData> data) { m_overflow_data = move(data); }
+
+    Optional<Layout::LineBoxFragmentCoordinate> const& containing_line_box_fragment() const { return m_containing_line_box_fragment; }
     void set_containing_line_box_fragment(Optional<Layout::LineBoxFragmentCoordinate>);
 
     StackingContext* stacking_context() { return m_stacking_context; }
@@ -101,6 +101,8 @@ static constexpr auto s_webdriver_endpoints = Array {
     ROUTE(GET, "/session/:session_id/screenshot"sv, take_screenshot),
     ROUTE(GET, "/session/:session_id/element/:element_id/screenshot"sv, take_element_screenshot),
     ROUTE(POST, "/session/:session_id/print"sv, print_page),
+    ROUTE(POST, "/session/:session_id/serenity/batch"sv, execute_batch),
+    ROUTE(GET, "/session/:session_id/serenity/screenshot-delta"sv, take_screenshot_delta),
 };
 
 // https://w3c.github.io/webdriver/#dfn-match-a-request
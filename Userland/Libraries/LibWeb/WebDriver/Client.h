@@ -100,6 +100,10 @@ public:
     // 18. Print, https://w3c.github.io/webdriver/#print
     virtual Response print_page(Parameters parameters, JsonValue payload) = 0;
 
+    // Non-standard SerenityOS extension endpoints.
+    virtual Response execute_batch(Parameters parameters, JsonValue payload) = 0;
+    virtual Response take_screenshot_delta(Parameters parameters, JsonValue payload) = 0;
+
 protected:
     Client(NonnullOwnPtr<Core::Stream::BufferedTCPSocket>, Core::Object* parent);
 
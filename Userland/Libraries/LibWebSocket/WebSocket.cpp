@@ -377,6 +377,29 @@ void WebSocket::read_server_handshake()
     // If needed, we will keep reading the header on the next drain_read call
 }
 
+// Section 5.3 : Masking is a XOR with a 4-byte key repeated over the payload.
+// Applying it one byte at a time dominates the cost of large frames, so we expand
+// the key to a machine word and XOR word-sized chunks; the compiler vectorizes
+// this further where it can. Any remaining tail bytes go through the scalar loop.
+static void apply_frame_mask(Bytes bytes, u8 const (&masking_key)[4])
+{
+    static_assert(sizeof(size_t) % 4 == 0);
+    size_t repeated_key;
+    auto* repeated_key_bytes = reinterpret_cast<u8*>(&repeated_key);
+    for (size_t i = 0; i < sizeof(size_t); ++i)
+        repeated_key_bytes[i] = masking_key[i % 4];
+
+    size_t i = 0;
+    for (; i + sizeof(size_t) <= bytes.size(); i += sizeof(size_t)) {
+        size_t word;
+        __builtin_memcpy(&word, bytes.data() + i, sizeof(size_t));
+        word ^= repeated_key;
+        __builtin_memcpy(bytes.data() + i, &word, sizeof(size_t));
+    }
+    for (; i < bytes.size(); ++i)
+        bytes[i] ^= masking_key[i % 4];
+}
+
 void WebSocket::read_frame()
 {
     VERIFY(m_impl);
@@ -476,9 +499,7 @@ void WebSocket::read_frame()
 
     if (is_masked) {
         // Unmask the payload
-        for (size_t i = 0; i < payload.size(); ++i) {
-            payload[i] = payload[i] ^ (masking_key[i % 4]);
-        }
+        apply_frame_mask(payload.bytes(), masking_key);
     }
 
     if (op_code == WebSocket::OpCode::ConnectionClose) {
@@ -579,12 +600,10 @@ void WebSocket::send_frame(WebSocket::OpCode op_code, ReadonlyBytes payload, boo
         if (payload.size() == 0)
             return;
         // Mask the payload
-        auto buffer_result = ByteBuffer::create_uninitialized(payload.size());
+        auto buffer_result = ByteBuffer::copy(payload);
         if (!buffer_result.is_error()) {
             auto& masked_payload = buffer_result.value();
-            for (size_t i = 0; i < payload.size(); ++i) {
-                masked_payload[i] = payload[i] ^ (masking_key[i % 4]);
-            }
+            apply_frame_mask(masked_payload.bytes(), masking_key);
             m_impl->send(masked_payload);
         }
     } else if (payload.size() > 0) {
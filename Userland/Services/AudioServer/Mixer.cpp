@@ -8,7 +8,6 @@
 #include "Mixer.h"
 #include <AK/Array.h>
 #include <AK/Format.h>
-#include <AK/MemoryStream.h>
 #include <AK/NumericLimits.h>
 #include <AudioServer/ConnectionFromClient.h>
 #include <AudioServer/Mixer.h>
@@ -84,39 +83,36 @@ void Mixer::mix()
             }
             queue->volume().advance_time();
 
-            for (auto& mixed_sample : mixed_buffer) {
-                Audio::Sample sample;
-                if (!queue->get_next_sample(sample))
-                    break;
-                if (queue->is_muted())
-                    continue;
-                sample.log_multiply(SAMPLE_HEADROOM);
-                sample.log_multiply(static_cast<float>(queue->volume()));
-                mixed_sample += sample;
-            }
+            Array<Audio::Sample, HARDWARE_BUFFER_SIZE> client_buffer;
+            auto sample_count = queue->collect_samples(client_buffer.span());
+            if (queue->is_muted())
+                continue;
+
+            // The volume fade only advances once per buffer, so the gain is
+            // the same for every sample; applying the (expensive) logarithmic
+            // volume curve once here keeps the mixing loop itself a simple
+            // multiply-accumulate that the compiler can vectorize.
+            auto gain = Audio::Sample::linear_to_log(SAMPLE_HEADROOM) * Audio::Sample::linear_to_log(static_cast<float>(queue->volume()));
+            for (size_t i = 0; i < sample_count; ++i)
+                mixed_buffer[i] += client_buffer[i] * gain;
         }
 
         // Even though it's not realistic, the user expects no sound at 0%.
         if (m_muted || m_main_volume < 0.01) {
             m_device->write(m_zero_filled_buffer.data(), static_cast<int>(m_zero_filled_buffer.size()));
         } else {
-            OutputMemoryStream stream { m_stream_buffer };
+            auto main_gain = Audio::Sample::linear_to_log(static_cast<float>(m_main_volume));
+            auto* output_samples = reinterpret_cast<LittleEndian<i16>*>(m_stream_buffer.data());
 
             for (auto& mixed_sample : mixed_buffer) {
-                mixed_sample.log_multiply(static_cast<float>(m_main_volume));
+                mixed_sample *= main_gain;
                 mixed_sample.clip();
 
-                LittleEndian<i16> out_sample;
-                out_sample = static_cast<i16>(mixed_sample.left * NumericLimits<i16>::max());
-                stream << out_sample;
-
-                out_sample = static_cast<i16>(mixed_sample.right * NumericLimits<i16>::max());
-                stream << out_sample;
+                *output_samples++ = static_cast<i16>(mixed_sample.left * NumericLimits<i16>::max());
+                *output_samples++ = static_cast<i16>(mixed_sample.right * NumericLimits<i16>::max());
             }
 
-            VERIFY(stream.is_end());
-            VERIFY(!stream.has_any_error());
-            m_device->write(stream.data(), static_cast<int>(stream.size()));
+            m_device->write(m_stream_buffer.data(), static_cast<int>(m_stream_buffer.size()));
         }
     }
 }
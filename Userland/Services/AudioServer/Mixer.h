@@ -41,32 +41,40 @@ public:
     explicit ClientAudioStream(ConnectionFromClient&);
     ~ClientAudioStream() = default;
 
-    bool get_next_sample(Audio::Sample& sample)
+    // Repeatedly dequeues chunks to fill as much of `samples` as possible in
+    // bulk, and returns the number of samples written.
+    size_t collect_samples(Span<Audio::Sample> samples)
     {
         if (m_paused)
-            return false;
-
-        if (m_in_chunk_location >= m_current_audio_chunk.size()) {
-            auto result = m_buffer->try_dequeue();
-            if (result.is_error()) {
-                if (result.error() == Audio::AudioQueue::QueueStatus::Empty) {
-                    dbgln("Audio client {} can't keep up!", m_client->client_id());
-                    // Note: Even though we only check client state here, we will probably close the client much earlier.
-                    if (!m_client->is_open()) {
-                        dbgln("Client socket {} has closed, closing audio server connection.", m_client->client_id());
-                        m_client->shutdown();
+            return 0;
+
+        size_t collected = 0;
+        while (collected < samples.size()) {
+            if (m_in_chunk_location >= m_current_audio_chunk.size()) {
+                auto result = m_buffer->try_dequeue();
+                if (result.is_error()) {
+                    if (result.error() == Audio::AudioQueue::QueueStatus::Empty) {
+                        dbgln("Audio client {} can't keep up!", m_client->client_id());
+                        // Note: Even though we only check client state here, we will probably close the client much earlier.
+                        if (!m_client->is_open()) {
+                            dbgln("Client socket {} has closed, closing audio server connection.", m_client->client_id());
+                            m_client->shutdown();
+                        }
                     }
-                }
 
-                return false;
+                    break;
+                }
+                m_current_audio_chunk = result.release_value();
+                m_in_chunk_location = 0;
             }
-            m_current_audio_chunk = result.release_value();
-            m_in_chunk_location = 0;
-        }
 
-        sample = m_current_audio_chunk[m_in_chunk_location++];
+            auto samples_to_copy = min(samples.size() - collected, m_current_audio_chunk.size() - m_in_chunk_location);
+            __builtin_memcpy(samples.offset_pointer(collected), m_current_audio_chunk.span().offset_pointer(m_in_chunk_location), samples_to_copy * sizeof(Audio::Sample));
+            collected += samples_to_copy;
+            m_in_chunk_location += samples_to_copy;
+        }
 
-        return true;
+        return collected;
     }
 
     bool is_connected() const { return m_client && m_client->is_open(); }
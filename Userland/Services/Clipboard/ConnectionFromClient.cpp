@@ -41,6 +41,13 @@ Messages::ClipboardServer::GetClipboardDataResponse ConnectionFromClient::get_cl
     return { storage.buffer(), storage.mime_type(), storage.metadata() };
 }
 
+Messages::ClipboardServer::GetClipboardMimeTypeResponse ConnectionFromClient::get_clipboard_mime_type()
+{
+    // Type sniffing is common enough (e.g. enabling paste actions) that it
+    // gets its own message, so it doesn't transfer and map the payload.
+    return Storage::the().mime_type();
+}
+
 void ConnectionFromClient::notify_about_clipboard_change()
 {
     async_clipboard_data_changed(Storage::the().mime_type());
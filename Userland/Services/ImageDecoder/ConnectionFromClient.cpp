@@ -5,13 +5,48 @@
  */
 
 #include <AK/Debug.h>
+#include <AK/Hex.h>
 #include <ImageDecoder/ConnectionFromClient.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
+#include <LibCrypto/Hash/SHA2.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/ImageDecoder.h>
 
 namespace ImageDecoder {
 
+struct DecodedImage {
+    bool is_animated { false };
+    u32 loop_count { 0 };
+    Vector<Gfx::ShareableBitmap> bitmaps;
+    Vector<u32> durations;
+    size_t byte_size { 0 };
+};
+
+// Decoded results are kept keyed by a hash of the encoded bytes, so that a
+// client requesting an identical image (e.g. when revisiting a page) gets the
+// previous result without a second decode. The cached frames stay in the same
+// anonymous shared memory that backed the original response, so a cache hit
+// shares memory instead of duplicating pixels.
+static constexpr size_t s_decoded_image_cache_byte_limit = 64 * MiB;
+static size_t s_decoded_image_cache_byte_size = 0;
+static OrderedHashMap<DeprecatedString, DecodedImage> s_decoded_image_cache;
+
+static DeprecatedString hash_encoded_data(ReadonlyBytes bytes)
+{
+    auto digest = Crypto::Hash::SHA256::hash(bytes.data(), bytes.size());
+    return encode_hex({ digest.immutable_data(), digest.data_length() });
+}
+
+static void evict_from_cache_until_there_is_room_for(size_t byte_size)
+{
+    while (!s_decoded_image_cache.is_empty() && s_decoded_image_cache_byte_size + byte_size > s_decoded_image_cache_byte_limit) {
+        auto least_recently_used = s_decoded_image_cache.begin();
+        auto key = (*least_recently_used).key;
+        s_decoded_image_cache_byte_size -= (*least_recently_used).value.byte_size;
+        s_decoded_image_cache.remove(key);
+    }
+}
+
 ConnectionFromClient::ConnectionFromClient(NonnullOwnPtr<Core::Stream::LocalSocket> socket)
     : IPC::ConnectionFromClient<ImageDecoderClientEndpoint, ImageDecoderServerEndpoint>(*this, move(socket), 1)
 {
@@ -29,7 +64,18 @@ Messages::ImageDecoderServer::DecodeImageResponse ConnectionFromClient::decode_i
         return nullptr;
     }
 
-    auto decoder = Gfx::ImageDecoder::try_create(ReadonlyBytes { encoded_buffer.data<u8>(), encoded_buffer.size() });
+    auto encoded_bytes = ReadonlyBytes { encoded_buffer.data<u8>(), encoded_buffer.size() };
+    auto cache_key = hash_encoded_data(encoded_bytes);
+    if (auto it = s_decoded_image_cache.find(cache_key); it != s_decoded_image_cache.end()) {
+        auto cached = (*it).value;
+        // Re-insert to refresh this entry's position in LRU order.
+        s_decoded_image_cache.remove(cache_key);
+        s_decoded_image_cache.set(cache_key, cached);
+        dbgln_if(IMAGE_DECODER_DEBUG, "Serving decoded image from cache");
+        return { cached.is_animated, cached.loop_count, cached.bitmaps, cached.durations };
+    }
+
+    auto decoder = Gfx::ImageDecoder::try_create(encoded_bytes);
 
     if (!decoder) {
         dbgln_if(IMAGE_DECODER_DEBUG, "Could not find suitable image decoder plugin for data");
@@ -55,6 +101,17 @@ Messages::ImageDecoderServer::DecodeImageResponse ConnectionFromClient::decode_i
         }
     }
 
+    DecodedImage decoded_image { decoder->is_animated(), static_cast<u32>(decoder->loop_count()), bitmaps, durations, 0 };
+    for (auto& bitmap : bitmaps) {
+        if (bitmap.is_valid())
+            decoded_image.byte_size += bitmap.bitmap()->size_in_bytes();
+    }
+    if (decoded_image.byte_size <= s_decoded_image_cache_byte_limit) {
+        evict_from_cache_until_there_is_room_for(decoded_image.byte_size);
+        s_decoded_image_cache_byte_size += decoded_image.byte_size;
+        s_decoded_image_cache.set(cache_key, move(decoded_image));
+    }
+
     return { decoder->is_animated(), static_cast<u32>(decoder->loop_count()), bitmaps, durations };
 }
 
@@ -25,6 +25,12 @@ namespace LookupServer {
 static LookupServer* s_the;
 // NOTE: This is the TTL we return for the hostname or answers from /etc/hosts.
 static constexpr u32 s_static_ttl = 86400;
+// NOTE: This is how long we remember that an upstream lookup yielded no answers.
+static constexpr u32 s_negative_ttl = 60;
+// Names that were looked up at least this many times are considered hot and get
+// their answers refreshed shortly before they would expire.
+static constexpr u64 s_hot_name_hit_threshold = 3;
+static constexpr time_t s_refresh_margin_seconds = 10;
 
 LookupServer& LookupServer::the()
 {
@@ -170,18 +176,38 @@ ErrorOr<Vector<Answer>> LookupServer::lookup(Name const& name, RecordType record
 
     // Third, try our cache.
     if (auto cached_answers = m_lookup_cache.find(name); cached_answers != m_lookup_cache.end()) {
-        for (auto& answer : cached_answers->value) {
-            // TODO: Actually remove expired answers from the cache.
-            if (answer.type() == record_type && !answer.has_expired()) {
+        auto& entry = cached_answers->value;
+        entry.answers.remove_all_matching([](Answer const& answer) { return answer.has_expired(); });
+        if (entry.answers.is_empty()) {
+            m_lookup_cache.remove(cached_answers);
+        } else {
+            ++entry.hits;
+            bool has_answer_close_to_expiry = false;
+            auto now = time(nullptr);
+            for (auto& answer : entry.answers) {
+                if (answer.type() != record_type)
+                    continue;
                 dbgln_if(LOOKUPSERVER_DEBUG, "Cache hit: {} -> {}", name.as_string(), answer.record_data());
                 add_answer(answer);
+                if (answer.received_time() + static_cast<time_t>(answer.ttl()) <= now + s_refresh_margin_seconds)
+                    has_answer_close_to_expiry = true;
+            }
+            if (!answers.is_empty()) {
+                if (has_answer_close_to_expiry && entry.hits >= s_hot_name_hit_threshold)
+                    schedule_cache_refresh(name, record_type);
+                return answers;
             }
         }
-        if (!answers.is_empty())
-            return answers;
     }
 
-    // Fourth, look up .local names using mDNS instead of DNS nameservers.
+    // Fourth, check if this lookup recently yielded no answers; if so, don't
+    // bother the upstream nameservers with it again just yet.
+    if (has_cached_failure(name, record_type)) {
+        dbgln_if(LOOKUPSERVER_DEBUG, "Negative cache hit: {}", name.as_string());
+        return Vector<Answer> {};
+    }
+
+    // Fifth, look up .local names using mDNS instead of DNS nameservers.
     if (name.as_string().ends_with(".local"sv)) {
         answers = m_mdns->lookup(name, record_type);
         for (auto& answer : answers)
@@ -189,39 +215,48 @@ ErrorOr<Vector<Answer>> LookupServer::lookup(Name const& name, RecordType record
         return answers;
     }
 
-    // Fifth, ask the upstream nameservers.
+    // Sixth, ask the upstream nameservers.
+    bool did_get_response = false;
+    for (auto& answer : lookup_upstream(name, record_type, did_get_response))
+        add_answer(answer);
+
+    // Seventh, fail.
+    if (answers.is_empty()) {
+        if (did_get_response) {
+            put_failure_in_cache(name, record_type);
+        } else {
+            dbgln("Tried all nameservers but never got a response :(");
+        }
+        return Vector<Answer> {};
+    }
+
+    return answers;
+}
+
+Vector<Answer> LookupServer::lookup_upstream(Name const& name, RecordType record_type, bool& did_get_response)
+{
     for (auto& nameserver : m_nameservers) {
         dbgln_if(LOOKUPSERVER_DEBUG, "Doing lookup using nameserver '{}'", nameserver);
-        bool did_get_response = false;
+        bool did_nameserver_respond = false;
         int retries = 3;
         Vector<Answer> upstream_answers;
         do {
-            auto upstream_answers_or_error = lookup(name, nameserver, did_get_response, record_type);
+            auto upstream_answers_or_error = lookup(name, nameserver, did_nameserver_respond, record_type);
             if (upstream_answers_or_error.is_error())
                 continue;
             upstream_answers = upstream_answers_or_error.release_value();
-            if (did_get_response)
+            if (did_nameserver_respond)
                 break;
         } while (--retries);
-        if (!upstream_answers.is_empty()) {
-            for (auto& answer : upstream_answers)
-                add_answer(answer);
-            break;
-        } else {
-            if (!did_get_response)
-                dbgln("Never got a response from '{}', trying next nameserver", nameserver);
-            else
-                dbgln("Received response from '{}' but no result(s), trying next nameserver", nameserver);
-        }
+        did_get_response |= did_nameserver_respond;
+        if (!upstream_answers.is_empty())
+            return upstream_answers;
+        if (!did_nameserver_respond)
+            dbgln("Never got a response from '{}', trying next nameserver", nameserver);
+        else
+            dbgln("Received response from '{}' but no result(s), trying next nameserver", nameserver);
     }
-
-    // Sixth, fail.
-    if (answers.is_empty()) {
-        dbgln("Tried all nameservers but never got a response :(");
-        return Vector<Answer> {};
-    }
-
-    return answers;
+    return {};
 }
 
 ErrorOr<Vector<Answer>> LookupServer::lookup(Name const& name, DeprecatedString const& nameserver, bool& did_get_response, RecordType record_type, ShouldRandomizeCase should_randomize_case)
@@ -313,14 +348,18 @@ void LookupServer::put_in_cache(Answer const& answer)
     if (m_lookup_cache.size() >= 256)
         m_lookup_cache.remove(m_lookup_cache.begin());
 
+    // A fresh answer supersedes any cached failure for this name and type.
+    if (auto it = m_failed_lookup_cache.find(answer.name()); it != m_failed_lookup_cache.end())
+        it->value.remove_all_matching([&](FailedLookup const& failure) { return failure.record_type == answer.type(); });
+
     auto it = m_lookup_cache.find(answer.name());
     if (it == m_lookup_cache.end())
-        m_lookup_cache.set(answer.name(), { answer });
+        m_lookup_cache.set(answer.name(), { { answer }, 0 });
     else {
         if (answer.mdns_cache_flush()) {
             auto now = time(nullptr);
 
-            it->value.remove_all_matching([&](Answer const& other_answer) {
+            it->value.answers.remove_all_matching([&](Answer const& other_answer) {
                 if (other_answer.type() != answer.type() || other_answer.class_code() != answer.class_code())
                     return false;
 
@@ -331,8 +370,64 @@ void LookupServer::put_in_cache(Answer const& answer)
                 return true;
             });
         }
-        it->value.append(answer);
+        // Replace any earlier copy of the same record so a refresh extends
+        // its lifetime instead of accumulating duplicates.
+        it->value.answers.remove_all_matching([&](Answer const& other_answer) {
+            return other_answer.type() == answer.type() && other_answer.class_code() == answer.class_code() && other_answer.record_data() == answer.record_data();
+        });
+        it->value.answers.append(answer);
+    }
+}
+
+void LookupServer::put_failure_in_cache(Name const& name, RecordType record_type)
+{
+    // Prevent the failure cache from growing too big.
+    if (m_failed_lookup_cache.size() >= 256)
+        m_failed_lookup_cache.remove(m_failed_lookup_cache.begin());
+
+    dbgln_if(LOOKUPSERVER_DEBUG, "Caching failure: {}", name.as_string());
+    m_failed_lookup_cache.ensure(name).append({ record_type, time(nullptr) + s_negative_ttl });
+}
+
+bool LookupServer::has_cached_failure(Name const& name, RecordType record_type)
+{
+    auto it = m_failed_lookup_cache.find(name);
+    if (it == m_failed_lookup_cache.end())
+        return false;
+
+    auto now = time(nullptr);
+    it->value.remove_all_matching([&](FailedLookup const& failure) { return failure.expiry_time <= now; });
+    if (it->value.is_empty()) {
+        m_failed_lookup_cache.remove(it);
+        return false;
+    }
+
+    for (auto& failure : it->value) {
+        if (failure.record_type == record_type)
+            return true;
     }
+    return false;
+}
+
+void LookupServer::schedule_cache_refresh(Name const& name, RecordType record_type)
+{
+    // .local answers come from mDNS, which has its own cache maintenance.
+    if (name.as_string().ends_with(".local"sv))
+        return;
+
+    // We handle one IPC request at a time, so identical client lookups never
+    // race each other; only these deferred refreshes could pile up.
+    if (m_refreshes_in_flight.contains(name))
+        return;
+    m_refreshes_in_flight.set(name);
+
+    deferred_invoke([this, name, record_type] {
+        dbgln_if(LOOKUPSERVER_DEBUG, "Refreshing hot name '{}' before its answers expire", name.as_string());
+        bool did_get_response = false;
+        // The upstream lookup caches any received answers as a side effect.
+        (void)lookup_upstream(name, record_type, did_get_response);
+        m_refreshes_in_flight.remove(name);
+    });
 }
 
 }
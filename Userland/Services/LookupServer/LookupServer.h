@@ -9,6 +9,7 @@
 #include "ConnectionFromClient.h"
 #include "DNSServer.h"
 #include "MulticastDNS.h"
+#include <AK/HashTable.h>
 #include <LibCore/FileWatcher.h>
 #include <LibCore/Object.h>
 #include <LibDNS/Name.h>
@@ -29,9 +30,28 @@ public:
 private:
     LookupServer();
 
+    // Cached answers for one name, together with how often clients asked
+    // for it; answers for hot names are refreshed just before they expire.
+    struct CacheEntry {
+        Vector<Answer> answers;
+        u64 hits { 0 };
+    };
+
+    // A (name, type) pair the upstream nameservers answered with an empty
+    // result. Kept for a short while so clients that keep asking for a
+    // non-existent name don't cause an upstream query every time.
+    struct FailedLookup {
+        RecordType record_type;
+        time_t expiry_time { 0 };
+    };
+
     void load_etc_hosts();
     void put_in_cache(Answer const&);
+    void put_failure_in_cache(Name const&, RecordType);
+    bool has_cached_failure(Name const&, RecordType);
+    void schedule_cache_refresh(Name const&, RecordType);
 
+    Vector<Answer> lookup_upstream(Name const& name, RecordType record_type, bool& did_get_response);
     ErrorOr<Vector<Answer>> lookup(Name const& hostname, DeprecatedString const& nameserver, bool& did_get_response, RecordType record_type, ShouldRandomizeCase = ShouldRandomizeCase::Yes);
 
     OwnPtr<IPC::MultiServer<ConnectionFromClient>> m_server;
@@ -40,7 +60,9 @@ private:
     Vector<DeprecatedString> m_nameservers;
     RefPtr<Core::FileWatcher> m_file_watcher;
     HashMap<Name, Vector<Answer>, Name::Traits> m_etc_hosts;
-    HashMap<Name, Vector<Answer>, Name::Traits> m_lookup_cache;
+    HashMap<Name, CacheEntry, Name::Traits> m_lookup_cache;
+    HashMap<Name, Vector<FailedLookup>, Name::Traits> m_failed_lookup_cache;
+    HashTable<Name, Name::Traits> m_refreshes_in_flight;
 };
 
 }
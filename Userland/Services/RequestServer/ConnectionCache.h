@@ -121,15 +121,21 @@ struct AK::Traits<RequestServer::ConnectionCache::ConnectionKey> : public AK::Ge
 
 namespace RequestServer::ConnectionCache {
 
+// Tunable pool limits; system administrators can override these in the
+// [ConnectionCache] section of /etc/RequestServer.ini.
+struct Options {
+    size_t max_connections_per_host { 4 };
+    size_t keep_alive_timeout_ms { 10'000 };
+};
+
+extern Options g_options;
+
 extern HashMap<ConnectionKey, NonnullOwnPtr<NonnullOwnPtrVector<Connection<Core::Stream::TCPSocket, Core::Stream::Socket>>>> g_tcp_connection_cache;
 extern HashMap<ConnectionKey, NonnullOwnPtr<NonnullOwnPtrVector<Connection<TLS::TLSv12>>>> g_tls_connection_cache;
 
 void request_did_finish(URL const&, Core::Stream::Socket const*);
 void dump_jobs();
 
-constexpr static size_t MaxConcurrentConnectionsPerURL = 4;
-constexpr static size_t ConnectionKeepAliveTimeMilliseconds = 10'000;
-
 template<typename T>
 ErrorOr<void> recreate_socket_if_needed(T& connection, URL const& url)
 {
@@ -179,10 +185,16 @@ decltype(auto) get_or_create_connection(auto& cache, URL const& url, auto& job,
     Proxy proxy { proxy_data };
 
     using ReturnType = decltype(&sockets_for_url[0]);
-    auto it = sockets_for_url.find_if([](auto& connection) { return connection->request_queue.is_empty(); });
+    // Prefer an idle connection whose socket is still open, so we don't pay for
+    // a new handshake while another warm connection is sitting unused.
+    auto it = sockets_for_url.find_if([](auto& connection) {
+        return connection->request_queue.is_empty() && !connection->has_started && connection->socket->is_open() && !connection->socket->is_eof();
+    });
+    if (it.is_end())
+        it = sockets_for_url.find_if([](auto& connection) { return connection->request_queue.is_empty(); });
     auto did_add_new_connection = false;
     auto failed_to_find_a_socket = it.is_end();
-    if (failed_to_find_a_socket && sockets_for_url.size() < ConnectionCache::MaxConcurrentConnectionsPerURL) {
+    if (failed_to_find_a_socket && sockets_for_url.size() < ConnectionCache::g_options.max_connections_per_host) {
         using ConnectionType = RemoveCVReference<decltype(cache.begin()->value->at(0))>;
         auto connection_result = proxy.tunnel<typename ConnectionType::SocketType, typename ConnectionType::StorageType>(url);
         if (connection_result.is_error()) {
@@ -203,7 +215,7 @@ decltype(auto) get_or_create_connection(auto& cache, URL const& url, auto& job,
         sockets_for_url.append(make<ConnectionType>(
             socket_result.release_value(),
             typename ConnectionType::QueueType {},
-            Core::Timer::create_single_shot(ConnectionKeepAliveTimeMilliseconds, nullptr)));
+            Core::Timer::create_single_shot(ConnectionCache::g_options.keep_alive_timeout_ms, nullptr)));
         sockets_for_url.last().proxy = move(proxy);
         did_add_new_connection = true;
     }
@@ -5,12 +5,14 @@
  */
 
 #include <AK/OwnPtr.h>
+#include <LibCore/ConfigFile.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/LocalServer.h>
 #include <LibCore/System.h>
 #include <LibIPC/SingleServer.h>
 #include <LibMain/Main.h>
 #include <LibTLS/Certificate.h>
+#include <RequestServer/ConnectionCache.h>
 #include <RequestServer/ConnectionFromClient.h>
 #include <RequestServer/GeminiProtocol.h>
 #include <RequestServer/HttpProtocol.h>
@@ -40,10 +42,16 @@ ErrorOr<int> serenity_main(Main::Arguments)
     // FIXME: Establish a connection to LookupServer and then drop "unix"?
     TRY(Core::System::unveil("/tmp/portal/lookup", "rw"));
     TRY(Core::System::unveil("/etc/timezone", "r"));
+    TRY(Core::System::unveil("/etc/RequestServer.ini", "r"));
     if constexpr (TLS_SSL_KEYLOG_DEBUG)
         TRY(Core::System::unveil("/home/anon", "rwc"));
     TRY(Core::System::unveil(nullptr, nullptr));
 
+    auto config = TRY(Core::ConfigFile::open_for_system("RequestServer"));
+    auto& cache_options = RequestServer::ConnectionCache::g_options;
+    cache_options.max_connections_per_host = config->read_num_entry("ConnectionCache", "MaxConnectionsPerHost", static_cast<int>(cache_options.max_connections_per_host));
+    cache_options.keep_alive_timeout_ms = config->read_num_entry("ConnectionCache", "KeepAliveTimeoutMs", static_cast<int>(cache_options.keep_alive_timeout_ms));
+
     [[maybe_unused]] auto gemini = make<RequestServer::GeminiProtocol>();
     [[maybe_unused]] auto http = make<RequestServer::HttpProtocol>();
     [[maybe_unused]] auto https = make<RequestServer::HttpsProtocol>();
@@ -15,6 +15,32 @@ namespace SQLServer {
 static HashMap<SQL::StatementID, NonnullRefPtr<SQLStatement>> s_statements;
 static SQL::StatementID s_next_statement_id = 0;
 
+// Parsed statements are immutable (execution only reads the AST), so we can
+// share one parse result between all statements prepared with the same text.
+// Clients tend to prepare the same parameterized statement over and over.
+static constexpr size_t maximum_cached_parsed_statements = 64;
+static HashMap<DeprecatedString, NonnullRefPtr<SQL::AST::Statement>> s_parsed_statement_cache;
+
+static SQL::ResultOr<NonnullRefPtr<SQL::AST::Statement>> parse_statement(StringView sql)
+{
+    DeprecatedString statement_text = sql.trim_whitespace();
+
+    if (s_parsed_statement_cache.contains(statement_text))
+        return *s_parsed_statement_cache.get(statement_text).value();
+
+    auto parser = SQL::AST::Parser(SQL::AST::Lexer(statement_text));
+    auto statement = parser.next_statement();
+
+    if (parser.has_errors())
+        return SQL::Result { SQL::SQLCommand::Unknown, SQL::SQLErrorCode::SyntaxError, parser.errors()[0].to_deprecated_string() };
+
+    if (s_parsed_statement_cache.size() >= maximum_cached_parsed_statements)
+        s_parsed_statement_cache.remove(s_parsed_statement_cache.begin());
+    s_parsed_statement_cache.set(move(statement_text), statement);
+
+    return statement;
+}
+
 RefPtr<SQLStatement> SQLStatement::statement_for(SQL::StatementID statement_id)
 {
     if (s_statements.contains(statement_id))
@@ -25,12 +51,7 @@ RefPtr<SQLStatement> SQLStatement::statement_for(SQL::StatementID statement_id)
 
 SQL::ResultOr<NonnullRefPtr<SQLStatement>> SQLStatement::create(DatabaseConnection& connection, StringView sql)
 {
-    auto parser = SQL::AST::Parser(SQL::AST::Lexer(sql));
-    auto statement = parser.next_statement();
-
-    if (parser.has_errors())
-        return SQL::Result { SQL::SQLCommand::Unknown, SQL::SQLErrorCode::SyntaxError, parser.errors()[0].to_deprecated_string() };
-
+    auto statement = TRY(parse_statement(sql));
     return TRY(adopt_nonnull_ref_or_enomem(new (nothrow) SQLStatement(connection, move(statement))));
 }
 
@@ -310,6 +310,7 @@ Service::Service(Core::ConfigFile const& config, StringView name)
     m_working_directory = config.read_entry(name, "WorkingDirectory");
     m_environment = config.read_entry(name, "Environment").split(' ');
     m_system_modes = config.read_entry(name, "SystemModes", "graphical").split(',');
+    m_depends_on = config.read_entry(name, "DependsOn").split(',');
     m_multi_instance = config.read_bool_entry(name, "MultiInstance");
     m_accept_socket_connections = config.read_bool_entry(name, "AcceptSocketConnections");
 
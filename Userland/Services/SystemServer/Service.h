@@ -24,6 +24,9 @@ public:
     void activate();
     void did_exit(int exit_code);
 
+    // Names of services that should be spawned before this one.
+    Vector<DeprecatedString> const& dependencies() const { return m_depends_on; }
+
     static Service* find_by_pid(pid_t);
 
     // FIXME: Port to Core::Property
@@ -68,6 +71,8 @@ private:
     DeprecatedString m_working_directory;
     // System modes in which to run this service. By default, this is the graphical mode.
     Vector<DeprecatedString> m_system_modes;
+    // Names of services to spawn before this one.
+    Vector<DeprecatedString> m_depends_on;
     // Whether several instances of this service can run at once.
     bool m_multi_instance { false };
     // Environment variables to pass to the service.
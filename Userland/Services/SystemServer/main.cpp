@@ -9,6 +9,7 @@
 #include <AK/Assertions.h>
 #include <AK/ByteBuffer.h>
 #include <AK/Debug.h>
+#include <AK/HashTable.h>
 #include <Kernel/API/DeviceEvent.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/ConfigFile.h>
@@ -482,6 +483,45 @@ static ErrorOr<void> set_default_coredump_directory()
     return {};
 }
 
+static void activate_services()
+{
+    // Every listening socket has already been created by this point, so
+    // spawned services initialize concurrently and socket-activated clients
+    // can connect to their dependencies right away. All "DependsOn" has to
+    // guarantee is that a service is forked after the services it depends on.
+    HashTable<DeprecatedString> enabled_services;
+    for (auto& service : g_services)
+        enabled_services.set(service.name());
+
+    HashTable<DeprecatedString> activated_services;
+    Vector<Service*> remaining_services;
+    for (auto& service : g_services)
+        remaining_services.append(&service);
+
+    while (!remaining_services.is_empty()) {
+        bool activated_any = false;
+        remaining_services.remove_all_matching([&](Service* service) {
+            for (auto const& dependency : service->dependencies()) {
+                // Dependencies that are disabled in this system mode (or
+                // misspelled) are considered satisfied, so a service doesn't
+                // silently stay down because of one.
+                if (enabled_services.contains(dependency) && !activated_services.contains(dependency))
+                    return false;
+            }
+            service->activate();
+            activated_services.set(service->name());
+            activated_any = true;
+            return true;
+        });
+        if (!activated_any) {
+            dbgln("Dependency cycle between {} remaining services, activating them in config order", remaining_services.size());
+            for (auto* service : remaining_services)
+                service->activate();
+            break;
+        }
+    }
+}
+
 static ErrorOr<void> create_tmp_semaphore_directory()
 {
     dbgln("Creating /tmp/semaphore directory");
@@ -530,8 +570,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
 
     // After we've set them all up, activate them!
     dbgln("Activating {} services...", g_services.size());
-    for (auto& service : g_services)
-        service.activate();
+    activate_services();
 
     return event_loop.exec();
 }
@@ -36,6 +36,7 @@ PageHost::~PageHost() = default;
 void PageHost::set_has_focus(bool has_focus)
 {
     m_has_focus = has_focus;
+    m_last_painted_frame_is_valid = false;
 }
 
 void PageHost::setup_palette()
@@ -122,7 +123,51 @@ void PageHost::paint(Web::DevicePixelRect const& content_rect, Gfx::Bitmap& targ
     context.set_should_show_line_box_borders(m_should_show_line_box_borders);
     context.set_viewport_rect(content_rect.to_type<int>());
     context.set_has_focus(m_has_focus);
+
+    // If nothing was invalidated since the last frame and only the scroll position
+    // changed, we can reuse most of that frame: blit the part that's still visible
+    // from the cached bitmap and repaint just the newly exposed strips. This keeps
+    // scrolling from repainting the entire viewport every time.
+    if (m_last_painted_frame_is_valid
+        && m_last_painted_frame
+        && m_last_painted_frame->size() == target.size()
+        && m_last_painted_frame_rect.size() == content_rect.size()
+        && m_last_painted_frame_rect != content_rect) {
+        auto old_rect = m_last_painted_frame_rect.to_type<int>();
+        auto new_rect = content_rect.to_type<int>();
+        auto still_visible_rect = old_rect.intersected(new_rect);
+        if (!still_visible_rect.is_empty()) {
+            painter.blit(still_visible_rect.location() - new_rect.location(), *m_last_painted_frame, still_visible_rect.translated(-old_rect.location()));
+            for (auto& exposed_rect : new_rect.shatter(still_visible_rect)) {
+                Gfx::PainterStateSaver saver(painter);
+                painter.add_clip_rect(exposed_rect.translated(-new_rect.location()));
+                layout_root->paint_all_phases(context);
+            }
+            remember_painted_frame(content_rect, target);
+            return;
+        }
+    }
+
     layout_root->paint_all_phases(context);
+    remember_painted_frame(content_rect, target);
+}
+
+void PageHost::remember_painted_frame(Web::DevicePixelRect const& content_rect, Gfx::Bitmap const& frame)
+{
+    if (!m_last_painted_frame || m_last_painted_frame->size() != frame.size()) {
+        auto bitmap_or_error = frame.clone();
+        if (bitmap_or_error.is_error()) {
+            m_last_painted_frame = nullptr;
+            m_last_painted_frame_is_valid = false;
+            return;
+        }
+        m_last_painted_frame = bitmap_or_error.release_value();
+    } else {
+        Gfx::Painter cache_painter(*m_last_painted_frame);
+        cache_painter.blit({}, frame, frame.rect());
+    }
+    m_last_painted_frame_rect = content_rect;
+    m_last_painted_frame_is_valid = true;
 }
 
 void PageHost::set_viewport_rect(Gfx::IntRect const& rect)
@@ -132,6 +177,7 @@ void PageHost::set_viewport_rect(Gfx::IntRect const& rect)
 
 void PageHost::page_did_invalidate(Web::CSSPixelRect const& content_rect)
 {
+    m_last_painted_frame_is_valid = false;
     m_invalidation_rect = m_invalidation_rect.united(page().enclosing_device_rect(content_rect));
     if (!m_invalidation_coalescing_timer->is_active())
         m_invalidation_coalescing_timer->start();
@@ -139,6 +185,7 @@ void PageHost::page_did_invalidate(Web::CSSPixelRect const& content_rect)
 
 void PageHost::page_did_change_selection()
 {
+    m_last_painted_frame_is_valid = false;
     m_client.async_did_change_selection();
 }
 
@@ -34,7 +34,11 @@ public:
     void set_screen_rects(Vector<Gfx::IntRect, 4> const& rects, size_t main_screen_index) { m_screen_rect = rects[main_screen_index].to_type<Web::DevicePixels>(); }
     void set_screen_display_scale(float device_pixels_per_css_pixel) { m_screen_display_scale = device_pixels_per_css_pixel; }
     void set_preferred_color_scheme(Web::CSS::PreferredColorScheme);
-    void set_should_show_line_box_borders(bool b) { m_should_show_line_box_borders = b; }
+    void set_should_show_line_box_borders(bool b)
+    {
+        m_should_show_line_box_borders = b;
+        m_last_painted_frame_is_valid = false;
+    }
     void set_has_focus(bool);
     void set_is_scripting_enabled(bool);
     void set_window_position(Gfx::IntPoint);
@@ -103,6 +107,7 @@ private:
 
     Web::Layout::InitialContainingBlock* layout_root();
     void setup_palette();
+    void remember_painted_frame(Web::DevicePixelRect const& content_rect, Gfx::Bitmap const& frame);
 
     ConnectionFromClient& m_client;
     NonnullOwnPtr<Web::Page> m_page;
@@ -116,6 +121,12 @@ private:
 
     RefPtr<Web::Platform::Timer> m_invalidation_coalescing_timer;
     Web::DevicePixelRect m_invalidation_rect;
+
+    // The most recently painted frame, kept around so that scrolling can blit the
+    // still-visible part of it instead of repainting the entire viewport.
+    RefPtr<Gfx::Bitmap> m_last_painted_frame;
+    Web::DevicePixelRect m_last_painted_frame_rect;
+    bool m_last_painted_frame_is_valid { false };
     Web::CSS::PreferredColorScheme m_preferred_color_scheme { Web::CSS::PreferredColorScheme::Auto };
 
     RefPtr<WebDriverConnection> m_webdriver;
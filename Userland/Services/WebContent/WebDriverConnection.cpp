@@ -8,9 +8,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Base64.h>
 #include <AK/JsonObject.h>
 #include <AK/JsonValue.h>
 #include <AK/Vector.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/PNGWriter.h>
 #include <LibJS/Runtime/JSONObject.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibWeb/CSS/PropertyID.h>
@@ -1570,6 +1573,194 @@ Messages::WebDriverClient::PrintPageResponse WebDriverConnection::print_page()
     return Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::UnsupportedOperation, "Print not implemented"sv);
 }
 
+// Non-standard extension: runs several commands in a single IPC round trip. The payload is of the form
+//     { "commands": [ { "name": "<command>", "parameters": { ... } }, ... ] }
+// and the result is an array with one { "value": ... } or { "error": ..., "message": ... } entry per
+// command, in order. A failed command does not stop the rest of the batch.
+Messages::WebDriverClient::ExecuteBatchResponse WebDriverConnection::execute_batch(JsonValue const& payload)
+{
+    auto const* commands = TRY(get_property<JsonArray const*>(payload, "commands"sv));
+
+    JsonArray results;
+    for (auto const& command : commands->values()) {
+        auto result = [&]() -> Web::WebDriver::Response {
+            auto name = TRY(get_property(command, "name"sv));
+            JsonValue command_payload;
+            if (command.as_object().has_object("parameters"sv))
+                command_payload = command.as_object().get("parameters"sv);
+            return dispatch_batched_command(name, command_payload);
+        }();
+
+        JsonObject serialized_result;
+        if (result.is_error()) {
+            serialized_result.set("error"sv, result.error().error);
+            serialized_result.set("message"sv, result.error().message);
+        } else {
+            serialized_result.set("value"sv, result.release_value());
+        }
+        results.append(move(serialized_result));
+    }
+
+    return JsonValue { move(results) };
+}
+
+Web::WebDriver::Response WebDriverConnection::dispatch_batched_command(StringView name, JsonValue const& command_payload)
+{
+    auto element_id = [&]() -> ErrorOr<DeprecatedString, Web::WebDriver::Error> {
+        return get_property(command_payload, "elementId"sv);
+    };
+
+    if (name == "navigate_to"sv)
+        return navigate_to(command_payload).take_response();
+    if (name == "get_current_url"sv)
+        return get_current_url().take_response();
+    if (name == "back"sv)
+        return back().take_response();
+    if (name == "forward"sv)
+        return forward().take_response();
+    if (name == "refresh"sv)
+        return refresh().take_response();
+    if (name == "get_title"sv)
+        return get_title().take_response();
+    if (name == "find_element"sv)
+        return find_element(command_payload).take_response();
+    if (name == "find_elements"sv)
+        return find_elements(command_payload).take_response();
+    if (name == "find_element_from_element"sv)
+        return find_element_from_element(command_payload, TRY(element_id())).take_response();
+    if (name == "find_elements_from_element"sv)
+        return find_elements_from_element(command_payload, TRY(element_id())).take_response();
+    if (name == "get_active_element"sv)
+        return get_active_element().take_response();
+    if (name == "is_element_selected"sv)
+        return is_element_selected(TRY(element_id())).take_response();
+    if (name == "get_element_attribute"sv)
+        return get_element_attribute(TRY(element_id()), TRY(get_property(command_payload, "name"sv))).take_response();
+    if (name == "get_element_property"sv)
+        return get_element_property(TRY(element_id()), TRY(get_property(command_payload, "name"sv))).take_response();
+    if (name == "get_element_css_value"sv)
+        return get_element_css_value(TRY(element_id()), TRY(get_property(command_payload, "name"sv))).take_response();
+    if (name == "get_element_text"sv)
+        return get_element_text(TRY(element_id())).take_response();
+    if (name == "get_element_tag_name"sv)
+        return get_element_tag_name(TRY(element_id())).take_response();
+    if (name == "get_element_rect"sv)
+        return get_element_rect(TRY(element_id())).take_response();
+    if (name == "is_element_enabled"sv)
+        return is_element_enabled(TRY(element_id())).take_response();
+    if (name == "get_source"sv)
+        return get_source().take_response();
+    if (name == "execute_script"sv)
+        return execute_script(command_payload).take_response();
+
+    return Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::UnknownCommand, DeprecatedString::formatted("Unknown batched command '{}'", name));
+}
+
+static constexpr int screenshot_tile_size = 64;
+
+static u32 hash_screenshot_tile(Gfx::Bitmap const& bitmap, Gfx::IntRect const& tile_rect)
+{
+    // FNV-1a over the tile's pixels; we only need a cheap change detector.
+    u32 hash = 2166136261u;
+    for (int y = 0; y < tile_rect.height(); ++y) {
+        for (int x = 0; x < tile_rect.width(); ++x) {
+            auto pixel = bitmap.get_pixel(tile_rect.x() + x, tile_rect.y() + y).value();
+            for (size_t i = 0; i < sizeof(pixel); ++i) {
+                hash ^= (pixel >> (i * 8)) & 0xff;
+                hash *= 16777619u;
+            }
+        }
+    }
+    return hash;
+}
+
+// Non-standard extension: captures the page like take_screenshot(), but remembers a hash per
+// screenshot_tile_size² tile and only re-encodes the tiles whose contents changed since the previous
+// call. The first capture (and any capture after the page is resized) returns the full image:
+//     { "full": true, "width": ..., "height": ..., "data": "<base64 PNG>" }
+// and subsequent captures return only the changed tiles:
+//     { "full": false, "width": ..., "height": ..., "tileSize": 64, "tiles": [ { "x": ..., "y": ..., "data": "<base64 PNG>" }, ... ] }
+Messages::WebDriverClient::TakeScreenshotDeltaResponse WebDriverConnection::take_screenshot_delta()
+{
+    // If the current top-level browsing context is no longer open, return error with error code no such window.
+    TRY(ensure_open_top_level_browsing_context());
+
+    auto* document = m_page_client.page().top_level_browsing_context().active_document();
+    auto root_rect = calculate_absolute_rect_of_element(m_page_client.page(), *document->document_element());
+
+    auto bitmap_or_error = Gfx::Bitmap::try_create(Gfx::BitmapFormat::BGRx8888, root_rect.size());
+    if (bitmap_or_error.is_error())
+        return Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::UnableToCaptureScreen, "Out of memory"sv);
+    auto bitmap = bitmap_or_error.release_value();
+
+    m_page_client.paint(root_rect.to_type<Web::DevicePixels>(), *bitmap);
+
+    auto columns = ceil_div(bitmap->width(), screenshot_tile_size);
+    auto rows = ceil_div(bitmap->height(), screenshot_tile_size);
+
+    auto tile_rect_for_index = [&](size_t index) {
+        auto column = static_cast<int>(index) % columns;
+        auto row = static_cast<int>(index) / columns;
+        return Gfx::IntRect {
+            column * screenshot_tile_size,
+            row * screenshot_tile_size,
+            min(screenshot_tile_size, bitmap->width() - column * screenshot_tile_size),
+            min(screenshot_tile_size, bitmap->height() - row * screenshot_tile_size),
+        };
+    };
+
+    Vector<u32> tile_hashes;
+    tile_hashes.ensure_capacity(static_cast<size_t>(columns) * rows);
+    for (size_t index = 0; index < static_cast<size_t>(columns) * rows; ++index)
+        tile_hashes.unchecked_append(hash_screenshot_tile(*bitmap, tile_rect_for_index(index)));
+
+    auto encode_bitmap = [](Gfx::Bitmap const& bitmap) -> ErrorOr<DeprecatedString> {
+        auto png_data = TRY(Gfx::PNGWriter::encode(bitmap));
+        return encode_base64(png_data.bytes());
+    };
+
+    JsonObject result;
+    result.set("width"sv, bitmap->width());
+    result.set("height"sv, bitmap->height());
+
+    if (m_screenshot_size != bitmap->size() || m_screenshot_tile_hashes.is_empty()) {
+        auto encoded = encode_bitmap(*bitmap);
+        if (encoded.is_error())
+            return Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::UnableToCaptureScreen, "Unable to encode screenshot"sv);
+
+        result.set("full"sv, true);
+        result.set("data"sv, encoded.release_value());
+    } else {
+        JsonArray changed_tiles;
+        for (size_t index = 0; index < tile_hashes.size(); ++index) {
+            if (tile_hashes[index] == m_screenshot_tile_hashes[index])
+                continue;
+
+            auto tile_rect = tile_rect_for_index(index);
+            auto encoded = [&]() -> ErrorOr<DeprecatedString> {
+                return encode_bitmap(*TRY(bitmap->cropped(tile_rect)));
+            }();
+            if (encoded.is_error())
+                return Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::UnableToCaptureScreen, "Unable to encode screenshot tile"sv);
+
+            JsonObject tile;
+            tile.set("x"sv, tile_rect.x());
+            tile.set("y"sv, tile_rect.y());
+            tile.set("data"sv, encoded.release_value());
+            changed_tiles.append(move(tile));
+        }
+
+        result.set("full"sv, false);
+        result.set("tileSize"sv, screenshot_tile_size);
+        result.set("tiles"sv, move(changed_tiles));
+    }
+
+    m_screenshot_size = bitmap->size();
+    m_screenshot_tile_hashes = move(tile_hashes);
+
+    return JsonValue { move(result) };
+}
+
 // https://w3c.github.io/webdriver/#dfn-no-longer-open
 ErrorOr<void, Web::WebDriver::Error> WebDriverConnection::ensure_open_top_level_browsing_context()
 {
@@ -11,6 +11,8 @@
 #include <AK/DeprecatedString.h>
 #include <AK/Function.h>
 #include <AK/HashMap.h>
+#include <AK/Vector.h>
+#include <LibGfx/Size.h>
 #include <LibIPC/ConnectionToServer.h>
 #include <LibJS/Forward.h>
 #include <LibJS/Heap/MarkedVector.h>
@@ -90,6 +92,10 @@ private:
     virtual Messages::WebDriverClient::TakeScreenshotResponse take_screenshot() override;
     virtual Messages::WebDriverClient::TakeElementScreenshotResponse take_element_screenshot(DeprecatedString const& element_id) override;
     virtual Messages::WebDriverClient::PrintPageResponse print_page() override;
+    virtual Messages::WebDriverClient::ExecuteBatchResponse execute_batch(JsonValue const& payload) override;
+    virtual Messages::WebDriverClient::TakeScreenshotDeltaResponse take_screenshot_delta() override;
+
+    Web::WebDriver::Response dispatch_batched_command(StringView name, JsonValue const& command_payload);
 
     ErrorOr<void, Web::WebDriver::Error> ensure_open_top_level_browsing_context();
     ErrorOr<void, Web::WebDriver::Error> handle_any_user_prompts();
@@ -127,6 +133,11 @@ private:
     };
     HashMap<DeprecatedString, Window> m_windows;
     DeprecatedString m_current_window_handle;
+
+    // Per-tile hashes of the last capture made by take_screenshot_delta(), so
+    // unchanged tiles can be skipped in subsequent captures.
+    Vector<u32> m_screenshot_tile_hashes;
+    Gfx::IntSize m_screenshot_size {};
 };
 
 }
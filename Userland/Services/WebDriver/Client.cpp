@@ -664,4 +664,22 @@ Web::WebDriver::Response Client::print_page(Web::WebDriver::Parameters parameter
     return session->web_content_connection().print_page();
 }
 
+// Non-standard extension: run a batch of commands in a single WebContent round trip.
+// POST /session/{session id}/serenity/batch
+Web::WebDriver::Response Client::execute_batch(Web::WebDriver::Parameters parameters, JsonValue payload)
+{
+    dbgln_if(WEBDRIVER_DEBUG, "Handling POST /session/<session_id>/serenity/batch");
+    auto* session = TRY(find_session_with_id(parameters[0]));
+    return session->web_content_connection().execute_batch(payload);
+}
+
+// Non-standard extension: take a screenshot, only re-encoding tiles that changed since the last capture.
+// GET /session/{session id}/serenity/screenshot-delta
+Web::WebDriver::Response Client::take_screenshot_delta(Web::WebDriver::Parameters parameters, JsonValue)
+{
+    dbgln_if(WEBDRIVER_DEBUG, "Handling GET /session/<session_id>/serenity/screenshot-delta");
+    auto* session = TRY(find_session_with_id(parameters[0]));
+    return session->web_content_connection().take_screenshot_delta();
+}
+
 }
@@ -16,6 +16,7 @@
 #include <AK/Debug.h>
 #include <AK/Memory.h>
 #include <AK/ScopeGuard.h>
+#include <AK/Time.h>
 #include <LibCore/Timer.h>
 #include <LibGfx/AntiAliasingPainter.h>
 #include <LibGfx/Font/Font.h>
@@ -132,6 +133,8 @@ void Compositor::init_bitmaps()
         return IterationDecision::Continue;
     });
 
+    update_frame_interval();
+
     invalidate_screen();
 }
 
@@ -144,6 +147,14 @@ void Compositor::did_construct_window_manager(Badge<WindowManager>)
     m_wallpaper_mode = mode_to_enum(wm.config()->read_entry("Background", "Mode", "Center"));
     m_custom_background_color = Color::from_string(wm.config()->read_entry("Background", "Color", ""));
 
+    if (auto driver_name = wm.config()->read_entry("Compositing", "GPUDriver", ""); !driver_name.is_empty()) {
+        auto renderer_or_error = GPURenderer::try_create(driver_name, Screen::main().size());
+        if (renderer_or_error.is_error())
+            dbgln("Compositor: Failed to create GPU renderer with driver '{}': {}", driver_name, renderer_or_error.error());
+        else
+            m_gpu_renderer = renderer_or_error.release_value();
+    }
+
     invalidate_screen();
     invalidate_occlusions();
     compose();
@@ -451,6 +462,14 @@ void Compositor::compose()
                             return color;
                         });
                     }
+                } else if (m_gpu_renderer && window.is_opaque() && screen.scale_factor() == 1 && &painter == screen.compositor_screen_data().m_back_painter.ptr()) {
+                    // Compose the opaque fast path through the GPU backend.
+                    // The back bitmap is in screen-local coordinates, so
+                    // translate the destination and damage rects accordingly.
+                    // FIXME: Route the transparency and scaled paths through
+                    //        the GPU as well.
+                    auto screen_location = screen.rect().location();
+                    m_gpu_renderer->blit_window_rect(*screen.compositor_screen_data().m_back_bitmap, *backing_store, dst.translated(-screen_location), dirty_rect_in_backing_coordinates, rect.translated(-screen_location));
                 } else {
                     painter.blit(dst, *backing_store, dirty_rect_in_backing_coordinates, window.opacity());
                 }
@@ -768,13 +787,32 @@ void Compositor::invalidate_window()
     start_compose_async_timer();
 }
 
+void Compositor::update_frame_interval()
+{
+    // Schedule frames against the fastest display so a high refresh rate
+    // screen isn't limited by a slower secondary one.
+    unsigned highest_refresh_rate = 0;
+    Screen::for_each([&](auto& screen) {
+        highest_refresh_rate = max(highest_refresh_rate, screen.refresh_rate());
+        return IterationDecision::Continue;
+    });
+    if (highest_refresh_rate == 0)
+        highest_refresh_rate = 60;
+    m_frame_interval_ms = max(1, 1000 / static_cast<int>(highest_refresh_rate));
+}
+
 void Compositor::start_compose_async_timer()
 {
     // We delay composition by a timer interval, but to not affect latency too
     // much, if a pending compose is not already scheduled, we also schedule an
     // immediate compose the next spin of the event loop.
     if (!m_compose_timer->is_active()) {
-        m_compose_timer->start();
+        // Align the delayed compose to the next frame boundary of the display
+        // refresh, so that composition keeps a steady cadence even when the
+        // event loop is busy processing client requests.
+        auto now_ms = AK::Time::now_monotonic().to_milliseconds();
+        int delay_ms = m_frame_interval_ms - static_cast<int>(now_ms % m_frame_interval_ms);
+        m_compose_timer->start(delay_ms);
         m_immediate_compose_timer->start();
     }
 }
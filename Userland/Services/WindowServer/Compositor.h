@@ -12,6 +12,7 @@
 #include <LibGfx/Color.h>
 #include <LibGfx/DisjointRectSet.h>
 #include <LibGfx/Font/Font.h>
+#include <WindowServer/GPURenderer.h>
 #include <WindowServer/Overlays.h>
 
 namespace WindowServer {
@@ -203,6 +204,7 @@ private:
     void remove_overlay(Overlay&);
     void update_fonts();
     void notify_display_links();
+    void update_frame_interval();
     void start_compose_async_timer();
     void recompute_overlay_rects();
     void recompute_occlusions();
@@ -219,6 +221,8 @@ private:
 
     RefPtr<Core::Timer> m_compose_timer;
     RefPtr<Core::Timer> m_immediate_compose_timer;
+    int m_frame_interval_ms { 1000 / 60 };
+    OwnPtr<GPURenderer> m_gpu_renderer;
     bool m_flash_flush { false };
     bool m_occlusions_dirty { true };
     bool m_invalidated_any { true };
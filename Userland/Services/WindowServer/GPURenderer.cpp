@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "GPURenderer.h"
+#include <AK/OwnPtr.h>
+#include <LibGPU/ImageDataLayout.h>
+#include <LibGPU/ImageFormat.h>
+#include <LibGPU/RasterizerOptions.h>
+#include <LibGPU/SamplerConfig.h>
+#include <LibGPU/TextureUnitConfiguration.h>
+#include <LibGPU/Vertex.h>
+
+namespace WindowServer {
+
+static GPU::ImageDataLayout bitmap_data_layout(Gfx::Bitmap const& bitmap, Gfx::IntRect const& rect)
+{
+    return {
+        .pixel_type = {
+            .format = GPU::PixelFormat::BGRA,
+            .bits = GPU::PixelComponentBits::B8_8_8_8,
+            .data_type = GPU::PixelDataType::UnsignedInt,
+            .components_order = GPU::ComponentsOrder::Reversed,
+        },
+        .packing = {
+            .row_stride = static_cast<u32>(bitmap.pitch() / sizeof(Gfx::ARGB32)),
+        },
+        .dimensions = {
+            .width = static_cast<u32>(bitmap.width()),
+            .height = static_cast<u32>(bitmap.height()),
+            .depth = 1,
+        },
+        .selection = {
+            .offset_x = rect.x(),
+            .offset_y = rect.y(),
+            .offset_z = 0,
+            .width = static_cast<u32>(rect.width()),
+            .height = static_cast<u32>(rect.height()),
+            .depth = 1,
+        },
+    };
+}
+
+ErrorOr<NonnullOwnPtr<GPURenderer>> GPURenderer::try_create(StringView driver_name, Gfx::IntSize size)
+{
+    auto driver = TRY(GPU::Driver::try_create(driver_name));
+    auto device = TRY(driver->try_create_device(size));
+    return adopt_nonnull_own_or_enomem(new (nothrow) GPURenderer(move(driver), move(device), size));
+}
+
+GPURenderer::GPURenderer(NonnullRefPtr<GPU::Driver> driver, NonnullOwnPtr<GPU::Device> device, Gfx::IntSize size)
+    : m_driver(move(driver))
+    , m_device(move(device))
+    , m_size(size)
+{
+}
+
+void GPURenderer::ensure_size(Gfx::IntSize size)
+{
+    if (m_size.width() >= size.width() && m_size.height() >= size.height())
+        return;
+    m_size = { max(m_size.width(), size.width()), max(m_size.height(), size.height()) };
+    m_device->resize(m_size);
+}
+
+void GPURenderer::blit_window_rect(Gfx::Bitmap& target, Gfx::Bitmap const& source, Gfx::IntPoint destination, Gfx::IntRect const& source_rect, Gfx::IntRect const& damage_rect)
+{
+    ensure_size(target.size());
+
+    // Upload the damaged part of the window's backing store as a texture.
+    // FIXME: Cache per-window textures across frames and only re-upload
+    //        texels the client actually painted.
+    auto image = m_device->create_image(GPU::PixelFormat::BGRA, source_rect.width(), source_rect.height(), 1, 1);
+    image->write_texels(0, { 0, 0, 0 }, source.scanline(0), bitmap_data_layout(source, source_rect));
+
+    GPU::SamplerConfig sampler;
+    sampler.bound_image = image;
+    sampler.texture_mag_filter = GPU::TextureFilter::Nearest;
+    sampler.texture_min_filter = GPU::TextureFilter::Nearest;
+    sampler.mipmap_filter = GPU::MipMapFilter::None;
+    sampler.texture_wrap_u = GPU::TextureWrapMode::ClampToEdge;
+    sampler.texture_wrap_v = GPU::TextureWrapMode::ClampToEdge;
+    sampler.fixed_function_texture_environment.env_mode = GPU::TextureEnvMode::Replace;
+    m_device->set_sampler_config(0, sampler);
+
+    GPU::TextureUnitConfiguration texture_unit;
+    texture_unit.enabled = true;
+    texture_unit.tex_coord_generation_enabled = 0;
+    m_device->set_texture_unit_configuration(0, texture_unit);
+
+    Gfx::IntRect destination_rect = { destination, source_rect.size() };
+
+    auto options = m_device->options();
+    options.viewport = { 0, 0, m_size.width(), m_size.height() };
+    options.scissor_enabled = true;
+    options.scissor_box = damage_rect.intersected(destination_rect);
+    options.enable_depth_test = false;
+    options.enable_depth_write = false;
+    options.enable_blending = false;
+    options.enable_alpha_test = false;
+    options.lighting_enabled = false;
+    m_device->set_options(options);
+
+    // Map screen coordinates (y down) directly onto the device's color buffer
+    // rows, so that the scissor box and the readback below can use target
+    // coordinates without any vertical flipping.
+    float device_width = m_size.width();
+    float device_height = m_size.height();
+    FloatMatrix4x4 projection {
+        2.f / device_width, 0, 0, -1,
+        0, 2.f / device_height, 0, -1,
+        0, 0, -1, 0,
+        0, 0, 0, 1
+    };
+
+    auto make_vertex = [&](float x, float y, float u, float v) {
+        GPU::Vertex vertex {};
+        vertex.position = { x, y, 0.f, 1.f };
+        vertex.color = { 1.f, 1.f, 1.f, 1.f };
+        vertex.tex_coords[0] = { u, v, 0.f, 1.f };
+        vertex.normal = { 0.f, 0.f, 1.f };
+        return vertex;
+    };
+
+    Vector<GPU::Vertex> vertices;
+    vertices.append(make_vertex(destination_rect.left(), destination_rect.top(), 0.f, 0.f));
+    vertices.append(make_vertex(destination_rect.right() + 1, destination_rect.top(), 1.f, 0.f));
+    vertices.append(make_vertex(destination_rect.right() + 1, destination_rect.bottom() + 1, 1.f, 1.f));
+    vertices.append(make_vertex(destination_rect.left(), destination_rect.bottom() + 1, 0.f, 1.f));
+
+    m_device->draw_primitives(GPU::PrimitiveType::Quads, FloatMatrix4x4::identity(), projection, vertices);
+
+    auto readback_rect = damage_rect.intersected(destination_rect).intersected(target.rect());
+    if (readback_rect.is_empty())
+        return;
+    m_device->blit_from_color_buffer(target.scanline(0), { readback_rect.x(), readback_rect.y() }, bitmap_data_layout(target, readback_rect));
+}
+
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullOwnPtr.h>
+#include <AK/NonnullRefPtr.h>
+#include <LibGPU/Device.h>
+#include <LibGPU/Driver.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/Rect.h>
+
+namespace WindowServer {
+
+// An optional compositing backend that renders window contents as textured
+// quads through a GPU::Device, scissored to the damaged screen region. The
+// device comes from a LibGPU driver, which is LibSoftGPU today but uses the
+// same abstraction that will let composition target real GPUs.
+class GPURenderer {
+public:
+    static ErrorOr<NonnullOwnPtr<GPURenderer>> try_create(StringView driver_name, Gfx::IntSize);
+
+    void blit_window_rect(Gfx::Bitmap& target, Gfx::Bitmap const& source, Gfx::IntPoint destination, Gfx::IntRect const& source_rect, Gfx::IntRect const& damage_rect);
+
+private:
+    GPURenderer(NonnullRefPtr<GPU::Driver>, NonnullOwnPtr<GPU::Device>, Gfx::IntSize);
+
+    void ensure_size(Gfx::IntSize);
+
+    NonnullRefPtr<GPU::Driver> m_driver;
+    NonnullOwnPtr<GPU::Device> m_device;
+    Gfx::IntSize m_size;
+};
+
+}
@@ -118,9 +118,28 @@ void Menu::redraw(MenuItem const& menu_item)
 
 void Menu::invalidate_menu_window()
 {
+    // If the menu has been rasterized before, it's likely to get opened again,
+    // so re-rasterize it in the background rather than on the next open.
+    if (m_menu_window)
+        warm_menu_window_soon();
     m_menu_window = nullptr;
 }
 
+void Menu::warm_menu_window_soon()
+{
+    if (m_window_warmup_scheduled)
+        return;
+    m_window_warmup_scheduled = true;
+    deferred_invoke([this] {
+        m_window_warmup_scheduled = false;
+        if (m_menu_window || is_empty())
+            return;
+        // The exact position doesn't matter: opening the menu recalculates the
+        // window rect for the screen it actually pops up on.
+        ensure_menu_window({});
+    });
+}
+
 Window& Menu::ensure_menu_window(Gfx::IntPoint position)
 {
     auto& screen = Screen::closest_to_location(position);
@@ -84,6 +84,10 @@ public:
     // Invalidates the menu window so that it gets rebuilt the next time it's showed.
     void invalidate_menu_window();
 
+    // Pre-rasterizes the menu window on the next event loop spin, so opening
+    // the menu doesn't have to pay for the initial rasterization.
+    void warm_menu_window_soon();
+
     Window* window_menu_of() { return m_window_menu_of; }
     void set_window_menu_of(Window& window) { m_window_menu_of = window; }
     bool is_window_menu_open() const { return m_is_window_menu_open; }
@@ -171,6 +175,7 @@ private:
     bool m_scrollable { false };
     int m_scroll_offset { 0 };
     int m_max_scroll_offset { 0 };
+    bool m_window_warmup_scheduled { false };
 
     HashMap<u32, Vector<size_t>> m_alt_shortcut_character_to_item_indices;
 };
@@ -6,9 +6,26 @@
 
 #include "MultiScaleBitmaps.h"
 #include "Screen.h"
+#include <LibGfx/BitmapBundle.h>
 
 namespace WindowServer {
 
+// Theme bitmaps and cursors that were packed into /res/theme.bundle at build
+// time are mapped read-only and blitted from directly, skipping the per-file
+// PNG decode; anything not in the bundle falls back to decoding as before.
+static Gfx::BitmapBundle const* theme_bundle()
+{
+    static RefPtr<Gfx::BitmapBundle> s_bundle;
+    static bool s_load_attempted = false;
+    if (!s_load_attempted) {
+        s_load_attempted = true;
+        auto bundle_or_error = Gfx::BitmapBundle::try_load_from_file("/res/theme.bundle"sv);
+        if (!bundle_or_error.is_error())
+            s_bundle = bundle_or_error.release_value();
+    }
+    return s_bundle.ptr();
+}
+
 Gfx::Bitmap const& MultiScaleBitmaps::bitmap(int scale_factor) const
 {
     auto it = m_bitmaps.find(scale_factor);
@@ -52,17 +69,22 @@ bool MultiScaleBitmaps::load(StringView filename, StringView default_filename)
     m_bitmaps.clear(); // If we're reloading the bitmaps get rid of the old ones
 
     auto add_bitmap = [&](StringView path, int scale_factor) {
-        auto bitmap_or_error = Gfx::Bitmap::try_load_from_file(path, scale_factor);
-        if (bitmap_or_error.is_error())
-            return;
-        auto bitmap = bitmap_or_error.release_value_but_fixme_should_propagate_errors();
+        RefPtr<Gfx::Bitmap> bitmap;
+        if (auto const* bundle = theme_bundle())
+            bitmap = bundle->find_bitmap(path, scale_factor);
+        if (!bitmap) {
+            auto bitmap_or_error = Gfx::Bitmap::try_load_from_file(path, scale_factor);
+            if (bitmap_or_error.is_error())
+                return;
+            bitmap = bitmap_or_error.release_value_but_fixme_should_propagate_errors();
+        }
         auto bitmap_format = bitmap->format();
         if (m_format == Gfx::BitmapFormat::Invalid || m_format == bitmap_format) {
             if (m_format == Gfx::BitmapFormat::Invalid)
                 m_format = bitmap_format;
 
             did_load_any = true;
-            m_bitmaps.set(scale_factor, move(bitmap));
+            m_bitmaps.set(scale_factor, bitmap.release_nonnull());
         } else {
             // Gracefully ignore, we have at least one bitmap already
             dbgln("Bitmap {} (scale {}) has format inconsistent with the other per-scale bitmaps", path, bitmap->scale());
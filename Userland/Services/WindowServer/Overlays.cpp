@@ -67,17 +67,24 @@ void BitmapOverlay::clear_bitmaps()
     m_bitmaps = MultiScaleBitmaps::create_empty();
 }
 
-void BitmapOverlay::render(Gfx::Painter& painter, Screen const& screen)
+Gfx::Bitmap const* BitmapOverlay::ensure_bitmap(int scale_factor)
 {
-    auto scale_factor = screen.scale_factor();
     auto* bitmap = m_bitmaps->find_bitmap(scale_factor);
     if (!bitmap) {
         auto new_bitmap = create_bitmap(scale_factor);
         if (!new_bitmap)
-            return;
+            return nullptr;
         bitmap = new_bitmap.ptr();
         m_bitmaps->add_bitmap(scale_factor, new_bitmap.release_nonnull());
     }
+    return bitmap;
+}
+
+void BitmapOverlay::render(Gfx::Painter& painter, Screen const& screen)
+{
+    auto* bitmap = ensure_bitmap(screen.scale_factor());
+    if (!bitmap)
+        return;
 
     painter.blit({}, *bitmap, bitmap->rect());
 }
@@ -277,7 +284,25 @@ DndOverlay::DndOverlay(DeprecatedString const& text, Gfx::Bitmap const* bitmap)
     : m_bitmap(bitmap)
     , m_text(text)
 {
+    // The overlay contents are fixed for the duration of the drag, so measure
+    // them once up front; moving the mouse then merely relocates the overlay
+    // and never invalidates the pre-rendered bitmaps.
+    int bitmap_width = m_bitmap ? m_bitmap->width() : 0;
+    int bitmap_height = m_bitmap ? m_bitmap->height() : 0;
+    auto& font = this->font();
+    int width = font.width(m_text) + bitmap_width;
+    int height = max((int)font.glyph_height(), bitmap_height);
+    m_size = Gfx::IntRect({}, Gfx::IntSize { width, height }).inflated(16, 8).size();
+
     update_rect();
+
+    // Pre-render the overlay for every scale factor currently in use, so the
+    // first paint on each screen doesn't have to compose and rescale the drag
+    // bitmap in the middle of a drag.
+    Screen::for_each_scale_factor_in_use([&](int scale_factor) {
+        (void)ensure_bitmap(scale_factor);
+        return IterationDecision::Continue;
+    });
 }
 
 Gfx::Font const& DndOverlay::font()
@@ -287,13 +312,8 @@ Gfx::Font const& DndOverlay::font()
 
 void DndOverlay::update_rect()
 {
-    int bitmap_width = m_bitmap ? m_bitmap->width() : 0;
-    int bitmap_height = m_bitmap ? m_bitmap->height() : 0;
-    auto& font = this->font();
-    int width = font.width(m_text) + bitmap_width;
-    int height = max((int)font.glyph_height(), bitmap_height);
     auto location = ScreenInput::the().cursor_location().translated(8, 8);
-    set_rect(Gfx::IntRect(location, { width, height }).inflated(16, 8));
+    set_rect({ location, m_size });
 }
 
 RefPtr<Gfx::Bitmap> DndOverlay::create_bitmap(int scale_factor)
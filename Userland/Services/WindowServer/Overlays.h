@@ -167,7 +167,7 @@ private:
 
     RefPtr<Gfx::Bitmap> m_bitmap;
     DeprecatedString m_text;
-    Gfx::IntRect m_label_rect;
+    Gfx::IntSize m_size;
 };
 
 class WindowStackSwitchOverlay : public RectangularOverlay {
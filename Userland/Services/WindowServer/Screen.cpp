@@ -352,6 +352,16 @@ bool Screen::set_resolution(bool initial)
         auto mode_setting = TRY(m_backend->get_head_mode_setting());
         info.resolution = { mode_setting.horizontal_active, mode_setting.vertical_active };
 
+        // Derive the vertical refresh rate from the mode timings so the
+        // compositor can schedule frames against the actual display refresh.
+        // Virtual screens (and hardware that doesn't report a pixel clock)
+        // fall back to the traditional 60Hz.
+        u64 total_pixels_per_frame = static_cast<u64>(mode_setting.horizontal_active + mode_setting.horizontal_blank_pixels) * static_cast<u64>(mode_setting.vertical_active + mode_setting.vertical_blank_lines);
+        if (mode_setting.pixel_clock_in_khz > 0 && total_pixels_per_frame > 0)
+            m_refresh_rate = max(1u, static_cast<unsigned>((static_cast<u64>(mode_setting.pixel_clock_in_khz) * 1000 + total_pixels_per_frame / 2) / total_pixels_per_frame));
+        else
+            m_refresh_rate = 60;
+
         update_virtual_and_physical_rects();
 
         // Since pending flush rects are affected by the scale factor
@@ -159,6 +159,7 @@ public:
     int width() const { return m_virtual_rect.width(); }
     int height() const { return m_virtual_rect.height(); }
     int scale_factor() const { return screen_layout_info().scale_factor; }
+    unsigned refresh_rate() const { return m_refresh_rate; }
 
     Gfx::ARGB32* scanline(int buffer_index, int y);
 
@@ -210,6 +211,7 @@ private:
 
     Gfx::IntRect m_virtual_rect;
     Gfx::IntRect m_physical_rect;
+    unsigned m_refresh_rate { 60 };
 
     NonnullOwnPtr<FlushRectData> m_flush_rects;
     NonnullOwnPtr<CompositorScreenData> m_compositor_screen_data;
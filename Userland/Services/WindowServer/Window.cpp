@@ -1040,6 +1040,9 @@ Optional<HitTestResult> Window::hit_test(Gfx::IntPoint position, bool include_fr
 void Window::add_menu(Menu& menu)
 {
     m_menubar.add_menu(menu, rect());
+    // Pre-rasterize the menu in the background so the first click on the
+    // menubar doesn't have to wait for it.
+    menu.warm_menu_window_soon();
     Compositor::the().invalidate_occlusions();
     frame().invalidate();
 }
@@ -22,8 +22,15 @@
 
 ErrorOr<int> serenity_main(Main::Arguments)
 {
-    TRY(Core::System::pledge("stdio video thread sendfd recvfd accept rpath wpath cpath unix proc sigaction exec tty"));
+    // The optional GPU compositing backend loads its driver with dlopen(),
+    // which needs prot_exec and a readable /usr/lib.
+    auto wm_config = TRY(Core::ConfigFile::open("/etc/WindowServer.ini"));
+    bool gpu_compositing = !wm_config->read_entry("Compositing", "GPUDriver", "").is_empty();
+
+    TRY(Core::System::pledge(DeprecatedString::formatted("stdio video thread sendfd recvfd accept rpath wpath cpath unix proc sigaction exec tty{}", gpu_compositing ? " prot_exec" : "")));
     TRY(Core::System::unveil("/res", "r"));
+    if (gpu_compositing)
+        TRY(Core::System::unveil("/usr/lib", "r"));
     TRY(Core::System::unveil("/tmp", "cw"));
     TRY(Core::System::unveil("/etc/WindowServer.ini", "rwc"));
     TRY(Core::System::unveil("/etc/Keyboard.ini", "r"));
@@ -39,9 +46,8 @@ ErrorOr<int> serenity_main(Main::Arguments)
     act.sa_flags = SA_NOCLDWAIT;
     act.sa_handler = SIG_IGN;
     TRY(Core::System::sigaction(SIGCHLD, &act, nullptr));
-    TRY(Core::System::pledge("stdio video thread sendfd recvfd accept rpath wpath cpath unix proc exec tty"));
+    TRY(Core::System::pledge(DeprecatedString::formatted("stdio video thread sendfd recvfd accept rpath wpath cpath unix proc exec tty{}", gpu_compositing ? " prot_exec" : "")));
 
-    auto wm_config = TRY(Core::ConfigFile::open("/etc/WindowServer.ini"));
     auto theme_name = wm_config->read_entry("Theme", "Name", "Default");
 
     auto theme = Gfx::load_system_theme(DeprecatedString::formatted("/res/themes/{}.ini", theme_name));
@@ -67,7 +73,7 @@ ErrorOr<int> serenity_main(Main::Arguments)
 
     WindowServer::EventLoop loop;
 
-    TRY(Core::System::pledge("stdio video thread sendfd recvfd accept rpath wpath cpath unix proc exec"));
+    TRY(Core::System::pledge(DeprecatedString::formatted("stdio video thread sendfd recvfd accept rpath wpath cpath unix proc exec{}", gpu_compositing ? " prot_exec" : "")));
 
     // First check which screens are explicitly configured
     {
@@ -15,8 +15,10 @@
 #include <LibCore/EventLoop.h>
 #include <LibCore/File.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <inttypes.h>
 #include <limits.h>
+#include <poll.h>
 #include <signal.h>
 #include <sys/wait.h>
 #include <unistd.h>
@@ -1019,6 +1021,179 @@ int Shell::builtin_wait(int argc, char const** argv)
     return 0;
 }
 
+int Shell::builtin_parallel(int argc, char const** argv)
+{
+    int max_jobs = 0;
+    Vector<DeprecatedString> commands;
+
+    Core::ArgsParser parser;
+    parser.add_option(max_jobs, "Maximum number of concurrent jobs (defaults to sharing an inherited job server, or the processor count)", "jobs", 'j', "jobs");
+    parser.add_positional_argument(commands, "Commands to run", "command");
+
+    if (!parser.parse(argc, const_cast<char**>(argv), Core::ArgsParser::FailureBehavior::PrintUsage))
+        return 1;
+
+    // Concurrency is limited through a make-style job server: a pipe holding
+    // one token per allowed extra job. If the environment already carries one
+    // (say, we were invoked from a 'make -j' driven Ports build), draw from
+    // that budget instead of multiplying it; otherwise create our own and
+    // advertise it through MAKEFLAGS so nested makes and 'parallel' calls
+    // share it.
+    int jobserver_read_fd = -1;
+    int jobserver_write_fd = -1;
+
+    if (max_jobs == 0) {
+        if (auto* makeflags = getenv("MAKEFLAGS")) {
+            for (auto field : StringView { makeflags, strlen(makeflags) }.split_view(' ')) {
+                for (auto option : { "--jobserver-auth="sv, "--jobserver-fds="sv }) {
+                    if (!field.starts_with(option))
+                        continue;
+                    auto fds = field.substring_view(option.length()).split_view(',');
+                    if (fds.size() != 2)
+                        continue;
+                    auto read_fd = fds[0].to_int();
+                    auto write_fd = fds[1].to_int();
+                    if (!read_fd.has_value() || !write_fd.has_value())
+                        continue;
+                    if (fcntl(*read_fd, F_GETFD) < 0 || fcntl(*write_fd, F_GETFD) < 0)
+                        continue;
+                    jobserver_read_fd = *read_fd;
+                    jobserver_write_fd = *write_fd;
+                }
+            }
+        }
+    }
+
+    bool created_jobserver = false;
+    DeprecatedString saved_makeflags;
+    bool had_makeflags = false;
+
+    if (jobserver_read_fd < 0) {
+        if (max_jobs <= 0) {
+            max_jobs = sysconf(_SC_NPROCESSORS_ONLN);
+            if (max_jobs < 1)
+                max_jobs = 1;
+        }
+
+        int pipe_fds[2];
+        if (pipe(pipe_fds) < 0) {
+            perror("pipe");
+            return 1;
+        }
+        jobserver_read_fd = pipe_fds[0];
+        jobserver_write_fd = pipe_fds[1];
+        created_jobserver = true;
+
+        for (int i = 0; i < max_jobs - 1; ++i) {
+            if (write(jobserver_write_fd, "+", 1) != 1) {
+                perror("write");
+                break;
+            }
+        }
+
+        if (auto* makeflags = getenv("MAKEFLAGS")) {
+            had_makeflags = true;
+            saved_makeflags = makeflags;
+        }
+        StringBuilder new_makeflags;
+        if (!saved_makeflags.is_empty()) {
+            new_makeflags.append(saved_makeflags);
+            new_makeflags.append(' ');
+        }
+        new_makeflags.appendff("-j{} --jobserver-auth={},{}", max_jobs, jobserver_read_fd, jobserver_write_fd);
+        setenv("MAKEFLAGS", new_makeflags.to_deprecated_string().characters(), 1);
+    }
+
+    ScopeGuard tear_down_jobserver = [&] {
+        if (!created_jobserver)
+            return;
+        close(jobserver_read_fd);
+        close(jobserver_write_fd);
+        if (had_makeflags)
+            setenv("MAKEFLAGS", saved_makeflags.characters(), 1);
+        else
+            unsetenv("MAKEFLAGS");
+    };
+
+    // The children get their own process group so that reaping them can't
+    // steal the exit notifications of the shell's regular background jobs.
+    pid_t pgid = 0;
+    HashMap<pid_t, bool> running_jobs;
+    size_t next_command = 0;
+    int failure_count = 0;
+
+    auto return_token = [&] {
+        if (write(jobserver_write_fd, "+", 1) != 1)
+            perror("write");
+    };
+
+    while (next_command < commands.size() || !running_jobs.is_empty()) {
+        if (next_command < commands.size()) {
+            // We always own one implicit job slot; every concurrent job
+            // beyond that needs a token from the job server.
+            bool holds_token = false;
+            bool can_spawn = running_jobs.is_empty();
+            if (!can_spawn) {
+                struct pollfd poller = { jobserver_read_fd, POLLIN, 0 };
+                if (poll(&poller, 1, 0) == 1 && (poller.revents & POLLIN) != 0) {
+                    char token = 0;
+                    if (read(jobserver_read_fd, &token, 1) == 1) {
+                        holds_token = true;
+                        can_spawn = true;
+                    }
+                }
+            }
+
+            if (can_spawn) {
+                auto command = commands[next_command++];
+                auto pid = fork();
+                if (pid < 0) {
+                    perror("fork");
+                    ++failure_count;
+                    if (holds_token)
+                        return_token();
+                    continue;
+                }
+                if (pid == 0) {
+                    Core::EventLoop::notify_forked(Core::EventLoop::ForkEvent::Child);
+                    setpgid(0, pgid);
+                    m_is_subshell = true;
+                    jobs.clear();
+                    Core::EventLoop mainloop;
+                    setup_signals();
+                    _exit(run_command(command));
+                }
+                if (pgid == 0)
+                    pgid = pid;
+                setpgid(pid, pgid);
+                running_jobs.set(pid, holds_token);
+                continue;
+            }
+        }
+
+        int status = 0;
+        auto pid = waitpid(-pgid, &status, 0);
+        if (pid < 0) {
+            if (errno == EINTR)
+                continue;
+            perror("waitpid");
+            break;
+        }
+        auto held_token = running_jobs.get(pid).value_or(false);
+        running_jobs.remove(pid);
+        if (held_token)
+            return_token();
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+            ++failure_count;
+    }
+
+    if (failure_count > 0) {
+        warnln("parallel: {} command{} failed", failure_count, failure_count == 1 ? "" : "s");
+        return 1;
+    }
+    return 0;
+}
+
 int Shell::builtin_unset(int argc, char const** argv)
 {
     Vector<DeprecatedString> vars;
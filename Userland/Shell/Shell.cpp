@@ -707,7 +707,11 @@ ErrorOr<RefPtr<Job>> Shell::run_command(const AST::Command& command)
         return nullptr;
     }
 
-    auto can_be_run_in_current_process = command.should_wait && !command.pipeline && !command.argv.is_empty();
+    // Functions can run in the current process under the same conditions as
+    // builtins: the command must be waited on, which in a pipeline is only
+    // true for the final command. Earlier pipeline members have to run
+    // concurrently with their consumers, so those still need a real process.
+    auto can_be_run_in_current_process = command.should_wait && !command.argv.is_empty();
     if (can_be_run_in_current_process && has_function(command.argv.first())) {
         SavedFileDescriptors fds { rewirings };
 
@@ -0,0 +1,24 @@
+#!/bin/Shell
+
+source $(dirname "$0")/test-commons.inc
+
+rm -rf shell-test-parallel
+mkdir -p shell-test-parallel
+cd shell-test-parallel
+
+# All commands should run, regardless of the job limit.
+parallel -j 1 'echo a > a' 'echo b > b' 'echo c > c'
+if not test -e a -a -e b -a -e c { fail "parallel -j 1 did not run all commands" }
+
+rm a b c
+parallel 'echo a > a' 'echo b > b' 'echo c > c'
+if not test -e a -a -e b -a -e c { fail "parallel did not run all commands" }
+
+# A failing command should make parallel fail, without stopping the others.
+if parallel 'exit 1' 'echo d > d' 2> /dev/null { fail "parallel ignored a failing command" }
+if not test -e d { fail "parallel dropped commands after a failure" }
+
+cd ..
+rm -rf shell-test-parallel
+
+echo PASS
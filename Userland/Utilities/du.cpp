@@ -10,10 +10,9 @@
 #include <AK/Vector.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/DateTime.h>
-#include <LibCore/DirIterator.h>
 #include <LibCore/Stream.h>
-#include <LibCore/System.h>
 #include <LibMain/Main.h>
+#include <LibThreading/DirectoryTree.h>
 #include <limits.h>
 #include <string.h>
 
@@ -36,7 +35,7 @@ struct DuOption {
 };
 
 static ErrorOr<void> parse_args(Main::Arguments arguments, Vector<DeprecatedString>& files, DuOption& du_option);
-static ErrorOr<u64> print_space_usage(DeprecatedString const& path, DuOption const& du_option, size_t current_depth, bool inside_dir = false);
+static ErrorOr<u64> print_space_usage(Threading::DirectoryTree::Node const& node, DuOption const& du_option, size_t current_depth, bool inside_dir = false);
 
 ErrorOr<int> serenity_main(Main::Arguments arguments)
 {
@@ -45,8 +44,13 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
 
     TRY(parse_args(arguments, files, du_option));
 
-    for (auto const& file : files)
-        TRY(print_space_usage(file, du_option, 0));
+    for (auto const& file : files) {
+        // Gathering the tree up front lets the directory walk and the stat()
+        // calls run on every processor; the usage is then totaled up and
+        // reported from the in-memory tree in the same order as before.
+        auto tree = TRY(Threading::DirectoryTree::gather(file));
+        TRY(print_space_usage(tree.root(), du_option, 0));
+    }
 
     return 0;
 }
@@ -133,25 +137,23 @@ ErrorOr<void> parse_args(Main::Arguments arguments, Vector<DeprecatedString>& fi
     return {};
 }
 
-ErrorOr<u64> print_space_usage(DeprecatedString const& path, DuOption const& du_option, size_t current_depth, bool inside_dir)
+ErrorOr<u64> print_space_usage(Threading::DirectoryTree::Node const& node, DuOption const& du_option, size_t current_depth, bool inside_dir)
 {
     u64 size = 0;
-    struct stat path_stat = TRY(Core::System::lstat(path));
-    bool const is_directory = S_ISDIR(path_stat.st_mode);
+    bool const is_directory = node.is_directory();
+    if (!is_directory && node.error != 0)
+        return Error::from_errno(node.error);
     if (is_directory) {
-        auto di = Core::DirIterator(path, Core::DirIterator::SkipParentAndBaseDir);
-        if (di.has_error()) {
-            outln("du: cannot read directory '{}': {}", path, di.error_string());
+        if (node.error != 0) {
+            outln("du: cannot read directory '{}': {}", node.path, strerror(node.error));
             return Error::from_string_literal("An error occurred. See previous error.");
         }
 
-        while (di.has_next()) {
-            auto const child_path = di.next_full_path();
-            size += TRY(print_space_usage(child_path, du_option, current_depth + 1, true));
-        }
+        for (auto const& child : node.children)
+            size += TRY(print_space_usage(child, du_option, current_depth + 1, true));
     }
 
-    auto const basename = LexicalPath::basename(path);
+    auto const basename = LexicalPath::basename(node.path);
     for (auto const& pattern : du_option.excluded_patterns) {
         if (basename.matches(pattern, CaseSensitivity::CaseSensitive))
             return { 0 };
@@ -159,9 +161,9 @@ ErrorOr<u64> print_space_usage(DeprecatedString const& path, DuOption const& du_
 
     if (!du_option.apparent_size) {
         constexpr auto block_size = 512;
-        size += path_stat.st_blocks * block_size;
+        size += node.stat.st_blocks * block_size;
     } else {
-        size += path_stat.st_size;
+        size += node.stat.st_size;
     }
 
     bool is_beyond_depth = current_depth > du_option.max_depth;
@@ -179,22 +181,22 @@ ErrorOr<u64> print_space_usage(DeprecatedString const& path, DuOption const& du_
     }
 
     if (du_option.time_type == DuOption::TimeType::NotUsed) {
-        outln("\t{}", path);
+        outln("\t{}", node.path);
     } else {
-        auto time = path_stat.st_mtime;
+        auto time = node.stat.st_mtime;
         switch (du_option.time_type) {
         case DuOption::TimeType::Access:
-            time = path_stat.st_atime;
+            time = node.stat.st_atime;
             break;
         case DuOption::TimeType::Status:
-            time = path_stat.st_ctime;
+            time = node.stat.st_ctime;
             break;
         default:
             break;
         }
 
         auto const formatted_time = Core::DateTime::from_timestamp(time).to_deprecated_string();
-        outln("\t{}\t{}", formatted_time, path);
+        outln("\t{}\t{}", formatted_time, node.path);
     }
 
     return { size };
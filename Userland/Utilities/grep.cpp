@@ -12,6 +12,7 @@
 #include <LibCore/ArgsParser.h>
 #include <LibCore/DirIterator.h>
 #include <LibCore/File.h>
+#include <LibCore/MappedFile.h>
 #include <LibCore/System.h>
 #include <LibMain/Main.h>
 #include <LibRegex/Regex.h>
@@ -195,6 +196,45 @@ ErrorOr<int> serenity_main(Main::Arguments args)
 
         auto handle_file = [&matches, binary_mode, suppress_errors, count_lines, quiet_mode,
                                user_specified_multiple_files, &matched_line_count, &did_match_something](StringView filename, bool print_filename) -> bool {
+            auto process_line = [&](StringView line, size_t line_number) {
+                auto is_binary = memchr(line.characters_without_null_termination(), 0, line.length()) != nullptr;
+
+                auto matched = matches(line, filename, line_number, print_filename, is_binary);
+                did_match_something = did_match_something || matched;
+                if (matched && is_binary && binary_mode == BinaryFileMode::Binary)
+                    return IterationDecision::Break;
+                return IterationDecision::Continue;
+            };
+
+            // Fast path: map the file and scan it in place, so large files
+            // don't cost one heap-allocated string copy per line.
+            if (auto mapped_file_or_error = Core::MappedFile::map(filename); !mapped_file_or_error.is_error()) {
+                auto mapped_file = mapped_file_or_error.release_value();
+                StringView contents { static_cast<char const*>(mapped_file->data()), mapped_file->size() };
+                size_t line_number = 0;
+                for (size_t offset = 0; offset < contents.length();) {
+                    auto const* start_of_line = contents.characters_without_null_termination() + offset;
+                    auto const* newline = static_cast<char const*>(memchr(start_of_line, '\n', contents.length() - offset));
+                    auto line_length = newline ? static_cast<size_t>(newline - start_of_line) : contents.length() - offset;
+                    ++line_number;
+                    if (process_line({ start_of_line, line_length }, line_number) == IterationDecision::Break)
+                        break;
+                    offset += line_length + 1;
+                }
+
+                if (count_lines && !quiet_mode) {
+                    if (user_specified_multiple_files)
+                        outln("{}:{}", filename, matched_line_count);
+                    else
+                        outln("{}", matched_line_count);
+                    matched_line_count = 0;
+                }
+
+                return true;
+            }
+
+            // Some files (like the zero-sized ones in /proc) can't be mapped;
+            // stream those line by line instead.
             auto file = Core::File::construct(filename);
             if (!file->open(Core::OpenMode::ReadOnly)) {
                 if (!suppress_errors)
@@ -213,11 +253,7 @@ ErrorOr<int> serenity_main(Main::Arguments args)
 
             for (size_t line_number = 1; file->can_read_line(); ++line_number) {
                 auto line = file->read_line(file_size);
-                auto is_binary = memchr(line.characters(), 0, line.length()) != nullptr;
-
-                auto matched = matches(line, filename, line_number, print_filename, is_binary);
-                did_match_something = did_match_something || matched;
-                if (matched && is_binary && binary_mode == BinaryFileMode::Binary)
+                if (process_line(line, line_number) == IterationDecision::Break)
                     break;
             }
 
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/LexicalPath.h>
+#include <LibCore/ArgsParser.h>
+#include <LibCore/DirIterator.h>
+#include <LibCore/File.h>
+#include <LibCore/Stream.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/BitmapBundle.h>
+#include <LibMain/Main.h>
+
+static ErrorOr<NonnullRefPtr<Gfx::Bitmap>> load_bitmap_with_scale(StringView path, int scale_factor)
+{
+    auto loaded = TRY(Gfx::Bitmap::try_load_from_file(path));
+    if (scale_factor == 1)
+        return loaded;
+    if (loaded->width() % scale_factor != 0 || loaded->height() % scale_factor != 0)
+        return Error::from_string_literal("HighDPI image size is not divisible by its scale factor");
+    auto bitmap = TRY(Gfx::Bitmap::try_create(loaded->format(), { loaded->width() / scale_factor, loaded->height() / scale_factor }, scale_factor));
+    VERIFY(bitmap->size_in_bytes() == loaded->size_in_bytes());
+    __builtin_memcpy(bitmap->scanline_u8(0), loaded->scanline_u8(0), bitmap->size_in_bytes());
+    return bitmap;
+}
+
+static ErrorOr<void> collect_directory(DeprecatedString const& root, DeprecatedString const& directory, StringView target_prefix, Vector<Gfx::BitmapBundle::EntryForSerialization>& entries)
+{
+    Core::DirIterator di(directory, Core::DirIterator::SkipParentAndBaseDir);
+    while (di.has_next()) {
+        auto path = di.next_full_path();
+        if (Core::File::is_directory(path)) {
+            TRY(collect_directory(root, path, target_prefix, entries));
+            continue;
+        }
+        if (!Gfx::Bitmap::is_path_a_supported_image_format(path))
+            continue;
+
+        LexicalPath lexical_path(path);
+        if (lexical_path.title().ends_with("-2x"sv)) {
+            // Packed below, alongside its base scale sibling.
+            continue;
+        }
+
+        auto name = DeprecatedString::formatted("{}{}", target_prefix, path.substring_view(root.length()));
+        auto bitmap_or_error = load_bitmap_with_scale(path, 1);
+        if (bitmap_or_error.is_error()) {
+            warnln("Skipping {}: {}", path, bitmap_or_error.error());
+            continue;
+        }
+        TRY(entries.try_append({ name, 1, bitmap_or_error.release_value() }));
+
+        auto highdpi_path = DeprecatedString::formatted("{}/{}-2x.{}", lexical_path.dirname(), lexical_path.title(), lexical_path.extension());
+        if (Core::File::exists(highdpi_path)) {
+            auto highdpi_bitmap_or_error = load_bitmap_with_scale(highdpi_path, 2);
+            if (highdpi_bitmap_or_error.is_error())
+                warnln("Skipping {}: {}", highdpi_path, highdpi_bitmap_or_error.error());
+            else
+                TRY(entries.try_append({ name, 2, highdpi_bitmap_or_error.release_value() }));
+        }
+    }
+    return {};
+}
+
+ErrorOr<int> serenity_main(Main::Arguments arguments)
+{
+    StringView output_path;
+    StringView directory;
+    StringView target_prefix = "/res"sv;
+
+    Core::ArgsParser args_parser;
+    args_parser.set_general_help("Pack all images below a directory into a bitmap bundle that can be mapped read-only and blitted from without decoding.");
+    args_parser.add_option(target_prefix, "Path prefix the images are loaded from at runtime (default: /res)", "target-prefix", 'p', "prefix");
+    args_parser.add_positional_argument(output_path, "Bundle file to write", "output");
+    args_parser.add_positional_argument(directory, "Directory to pack", "directory");
+    args_parser.parse(arguments);
+
+    auto root = LexicalPath::canonicalized_path(directory);
+
+    Vector<Gfx::BitmapBundle::EntryForSerialization> entries;
+    TRY(collect_directory(root, root, target_prefix, entries));
+
+    auto buffer = TRY(Gfx::BitmapBundle::serialize(entries));
+    auto output = TRY(Core::Stream::File::open(output_path, Core::Stream::OpenMode::Write));
+    TRY(output->write_entire_buffer(buffer));
+
+    outln("Packed {} bitmaps into {}", entries.size(), output_path);
+    return 0;
+}
@@ -17,7 +17,7 @@
 #include <string.h>
 #include <sys/wait.h>
 
-static void spawn_command(Span<StringView> command, ByteBuffer const& data, char const* state)
+static void spawn_command(Span<StringView> command, ReadonlyBytes data, char const* state)
 {
     auto pipefd = MUST(Core::System::pipe2(0));
     pid_t pid = MUST(Core::System::fork());
@@ -75,7 +75,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
             if (data_and_type.mime_type.is_null()) {
                 spawn_command(watch_command, {}, "clear");
             } else {
-                spawn_command(watch_command, data_and_type.data, "data");
+                spawn_command(watch_command, data_and_type.bytes(), "data");
             }
         };
 
@@ -93,7 +93,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     }
 
     if (!print_type) {
-        out("{}", StringView(data_and_type.data));
+        out("{}", StringView(data_and_type.bytes()));
         // Append a newline to text contents, unless the caller says otherwise.
         if (data_and_type.mime_type.starts_with("text/"sv) && !no_newline)
             outln();
@@ -6,7 +6,10 @@
 
 #include "LibCore/Directory.h"
 #include <AK/Assertions.h>
+#include <AK/Atomic.h>
+#include <AK/ByteBuffer.h>
 #include <AK/LexicalPath.h>
+#include <AK/OwnPtr.h>
 #include <AK/Span.h>
 #include <AK/Vector.h>
 #include <LibArchive/TarStream.h>
@@ -18,12 +21,14 @@
 #include <LibCore/Stream.h>
 #include <LibCore/System.h>
 #include <LibMain/Main.h>
+#include <LibThreading/ThreadPool.h>
 #include <fcntl.h>
 #include <stdio.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
 constexpr size_t buffer_size = 4096;
+constexpr size_t max_queued_write_bytes = 32 * MiB;
 
 ErrorOr<int> serenity_main(Main::Arguments arguments)
 {
@@ -72,6 +77,15 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
 
         auto tar_stream = TRY(Archive::TarInputStream::construct(move(input_stream)));
 
+        // Writing extracted files is offloaded to a pool of workers, so
+        // decompressing the next entry overlaps with the file system work for
+        // the previous ones.
+        OwnPtr<Threading::ThreadPool> writer_pool;
+        Atomic<bool> write_failed { false };
+        size_t queued_write_bytes = 0;
+        if (extract)
+            writer_pool = make<Threading::ThreadPool>();
+
         HashMap<DeprecatedString, DeprecatedString> global_overrides;
         HashMap<DeprecatedString, DeprecatedString> local_overrides;
 
@@ -160,15 +174,29 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
                 case Archive::TarFileType::AlternateNormalFile: {
                     MUST(Core::Directory::create(parent_path, Core::Directory::CreateDirectories::Yes));
 
-                    int fd = TRY(Core::System::open(absolute_path, O_CREAT | O_WRONLY, header_mode));
+                    auto contents = TRY(ByteBuffer::create_uninitialized(TRY(header.size())));
+                    TRY(file_stream.read_entire_buffer(contents));
 
-                    Array<u8, buffer_size> buffer;
-                    while (!file_stream.is_eof()) {
-                        auto slice = TRY(file_stream.read(buffer));
-                        TRY(Core::System::write(fd, slice));
+                    // Keep a lid on how much decompressed file data is in
+                    // flight at once.
+                    if (queued_write_bytes >= max_queued_write_bytes) {
+                        writer_pool->wait_for_all();
+                        queued_write_bytes = 0;
                     }
-
-                    TRY(Core::System::close(fd));
+                    queued_write_bytes += contents.size();
+
+                    writer_pool->submit([absolute_path, header_mode, contents = move(contents), &write_failed]() {
+                        auto write_file = [&]() -> ErrorOr<void> {
+                            int fd = TRY(Core::System::open(absolute_path, O_CREAT | O_WRONLY, header_mode));
+                            TRY(Core::System::ftruncate(fd, contents.size()));
+                            TRY(Core::System::write(fd, contents));
+                            return Core::System::close(fd);
+                        };
+                        if (auto result = write_file(); result.is_error()) {
+                            warnln("Failed to write {}: {}", absolute_path, result.error());
+                            write_failed.store(true);
+                        }
+                    });
                     break;
                 }
                 case Archive::TarFileType::SymLink: {
@@ -198,6 +226,12 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
             TRY(tar_stream->advance());
         }
 
+        if (writer_pool) {
+            writer_pool->wait_for_all();
+            if (write_failed.load())
+                return 1;
+        }
+
         return 0;
     }
 
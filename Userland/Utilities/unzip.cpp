@@ -116,14 +116,14 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         TRY(Core::System::chdir(output_directory_path));
     }
 
-    auto success = zip_file->for_each_member([&](auto zip_member) {
+    auto success = zip_file->for_each_member_information([&](auto const& member_information) {
         bool keep_file = false;
 
         if (!file_filters.is_empty()) {
             for (auto& filter : file_filters) {
                 // Convert underscore wildcards (usual unzip convention) to question marks (as used by StringUtils)
                 auto string_filter = filter.replace("_"sv, "?"sv, ReplaceMode::All);
-                if (zip_member.name.matches(string_filter, CaseSensitivity::CaseSensitive)) {
+                if (member_information.name.matches(string_filter, CaseSensitivity::CaseSensitive)) {
                     keep_file = true;
                     break;
                 }
@@ -133,7 +133,14 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         }
 
         if (keep_file) {
-            if (!unpack_zip_member(zip_member, quiet))
+            // Only members we actually extract get their local file header
+            // parsed and their compressed data touched.
+            auto zip_member = zip_file->get_member(member_information);
+            if (!zip_member.has_value()) {
+                warnln("Invalid zip member {}", member_information.name);
+                return IterationDecision::Break;
+            }
+            if (!unpack_zip_member(zip_member.release_value(), quiet))
                 return IterationDecision::Break;
         }
 